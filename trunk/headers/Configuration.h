@@ -93,6 +93,31 @@ namespace Configuration
 #define QE_CONFIG_ASSERTSTRACING_DEFAULT QE_CONFIG_ASSERTSTRACING_ENABLED // [Configurable]
 
 
+// --------------------------------------------------------------------------------------------------------
+// Math vectorization: Specifies whether the mathematical operations that support it (like matrix products
+// or inversions) will be calculated using SIMD instructions, which process 4 floating point values at once.
+// It is only taken into account when using simple precission; in double precission, the scalar version is used.
+//
+// How to use it: Write a vectorization value as the default definition.
+// --------------------------------------------------------------------------------------------------------
+#define QE_CONFIG_MATHVECTORIZATION_DISABLED 0x0
+#define QE_CONFIG_MATHVECTORIZATION_ENABLED  0x1
+
+#define QE_CONFIG_MATHVECTORIZATION_DEFAULT QE_CONFIG_MATHVECTORIZATION_ENABLED // [Configurable]
+
+
+// --------------------------------------------------------------------------------------------------------
+// Profiling: Specifies whether the profiling macros (QE_PROFILE_SCOPE and QE_PROFILE_FUNCTION) measure the
+// time spent in the scopes where they are placed. When disabled, the macros are replaced with nothing.
+//
+// How to use it: Write a profiling value as the default definition.
+// --------------------------------------------------------------------------------------------------------
+#define QE_CONFIG_PROFILING_DISABLED 0x0
+#define QE_CONFIG_PROFILING_ENABLED  0x1
+
+#define QE_CONFIG_PROFILING_DEFAULT QE_CONFIG_PROFILING_ENABLED // [Configurable]
+
+
 }//namespace Configuration
 }//namespace Common
 }//namespace QuimeraEngine
@@ -71,19 +71,7 @@ namespace DataTypes
         typedef long long           i64_q;  // Signed 64-bits integer
         typedef float               f32_q;  // 32-bits floating point number
         typedef double              f64_q;  // 64-bits floating point number
-        typedef union
-        {
-             __m128 m128;
-             float m128_f32[4];
-             u64_q m128_u64[2];
-             i8_q  m128_i8[16];
-             i16_q m128_i16[8];
-             i32_q m128_i32[4];
-             i64_q m128_i64[2];
-             u8_q  m128_u8[16];
-             u16_q m128_u16[8];
-             u32_q m128_u32[4];
-        } vf32_q;                           // 4 x 32-bits packed floating point numbers
+        typedef __m128              vf32_q; // 4 x 32-bits packed floating point numbers
 
         // Note: There is no integer or float whose size is greater than 64 bits on Windows 32 bits
     #else
@@ -106,19 +94,7 @@ namespace DataTypes
         typedef long long           i64_q;  // Signed 64-bits integer
         typedef float               f32_q;  // 32-bits floating point number
         typedef double              f64_q;  // 64-bits floating point number
-        typedef union
-        {
-             __m128 m128;
-             float m128_f32[4];
-             u64_q m128_u64[2];
-             i8_q  m128_i8[16];
-             i16_q m128_i16[8];
-             i32_q m128_i32[4];
-             i64_q m128_i64[2];
-             u8_q  m128_u8[16];
-             u16_q m128_u16[8];
-             u32_q m128_u32[4];
-        } vf32_q;                           // 4 x 32-bits packed floating point numbers
+        typedef __m128              vf32_q; // 4 x 32-bits packed floating point numbers
     #else
     
         #error Compiler not detected on Linux
@@ -128,6 +104,27 @@ namespace DataTypes
     typedef u32_q        pointer_uint_q; // Unsigned integer types for pointer conversion (32 bits) common for ms and gcc compilers
 
 
+#elif defined(QE_OS_LINUX) && (QE_OS_LINUX == 64)
+    #if QE_COMPILER_GCC
+        typedef unsigned char       u8_q;   // Unsigned 8-bits integer
+        typedef char                i8_q;   // Signed 8-bits integer
+        typedef short unsigned int  u16_q;  // Unsigned 16-bits integer
+        typedef short int           i16_q;  // Signed 16-bits integer
+        typedef unsigned int        u32_q;  // Unsigned 32-bits integer
+        typedef int                 i32_q;  // Signed 32-bits integer
+        typedef unsigned long long  u64_q;  // Unsigned 64-bits integer
+        typedef long long           i64_q;  // Signed 64-bits integer
+        typedef float               f32_q;  // 32-bits floating point number
+        typedef double              f64_q;  // 64-bits floating point number
+        typedef __m128              vf32_q; // 4 x 32-bits packed floating point numbers
+    #else
+    
+        #error Compiler not detected on Linux
+
+    #endif
+
+    typedef u64_q        pointer_uint_q; // Unsigned integer types for pointer conversion (64 bits)
+
 #elif defined(QE_OS_MAC) && (QE_OS_MAC == 32)
     #if QE_COMPILER_GCC
         typedef unsigned char       u8_q;   // Unsigned 8-bits integer
@@ -140,19 +137,7 @@ namespace DataTypes
         typedef long long           i64_q;  // Signed 64-bits integer
         typedef float               f32_q;  // 32-bits floating point number
         typedef double              f64_q;  // 64-bits floating point number
-        typedef union
-        {
-             __m128 m128;
-             float m128_f32[4];
-             u64_q m128_u64[2];
-             i8_q  m128_i8[16];
-             i16_q m128_i16[8];
-             i32_q m128_i32[4];
-             i64_q m128_i64[2];
-             u8_q  m128_u8[16];
-             u16_q m128_u16[8];
-             u32_q m128_u32[4];
-        } vf32_q;                           // 4 x 32-bits packed floating point numbers
+        typedef __m128              vf32_q; // 4 x 32-bits packed floating point numbers
     #else
     
         #error Compiler not detected on Mac
@@ -97,6 +97,18 @@ namespace DataTypes
     #else
         // [TODO] Thund: Test the system in another compiler and write the type sizes in that compiler
     #endif
+#elif defined(QE_OS_LINUX) && (QE_OS_LINUX == 64)
+    #if QE_COMPILER_GCC
+        #if   QE_CONFIG_PRECISION_DEFAULT == QE_CONFIG_PRECISION_SIMPLE
+            typedef i32_q int_for_float_q;
+        #elif QE_CONFIG_PRECISION_DEFAULT == QE_CONFIG_PRECISION_DOUBLE
+            typedef i64_q int_for_float_q;
+        #else
+            typedef i32_q int_for_float_q;
+        #endif
+    #else
+        // [TODO] Thund: Test the system in another compiler and write the type sizes in that compiler
+    #endif
 #elif defined(QE_OS_MAC) && (QE_OS_MAC == 32)
     #if QE_COMPILER_GCC
         #if   QE_CONFIG_PRECISION_DEFAULT == QE_CONFIG_PRECISION_SIMPLE
@@ -111,7 +123,7 @@ namespace DataTypes
     #endif
 #else
     // [TODO] Thund: Test the system in another platform and write the type sizes in that machine
-    // Win64, Linux64
+    // Win64, Mac64
 #endif
 
 
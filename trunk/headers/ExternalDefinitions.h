@@ -79,6 +79,21 @@
     #error Unknown compiler.
 #endif
 
+// --------------------------------------------------------------------------------------------------------
+// SIMD instruction sets: Defines which SIMD instruction set extensions the compiler is allowed to emit.
+// SSE2 is the minimum requirement; the others are optional and are only used when the compiler is told
+// to target them (for example, -msse4.1 or -mfma on GCC / Clang, or /arch:AVX2 on MSVC).
+// --------------------------------------------------------------------------------------------------------
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define QE_SIMD_SSE2    // SSE2 instructions available
+#endif
+#if defined(__SSE4_1__) || defined(__AVX__)
+    #define QE_SIMD_SSE41   // SSE 4.1 instructions available
+#endif
+#if defined(__FMA__) || defined(__AVX2__)
+    #define QE_SIMD_FMA     // Fused multiply-add instructions available
+#endif
+
 // --------------------------------------------------------------------------------------------------------
 // Compiler specifics: Assures that specific compiler macros are defined always.
 // --------------------------------------------------------------------------------------------------------
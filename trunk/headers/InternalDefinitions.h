@@ -129,4 +129,15 @@ const unsigned int QE_VERSION_REVISION = 0;
 #endif
 
 
+// --------------------------------------------------------------------------------------------------------
+// Thread-local storage specifier: Alias for every compiler's thread-local storage specifier.
+// Note: Constructors and destructors are not called for thread-local variables, so they can only be of basic data types or pointers.
+// --------------------------------------------------------------------------------------------------------
+#if   defined(QE_COMPILER_MSVC)
+    #define threadlocal_q __declspec(thread)
+#elif defined(QE_COMPILER_GCC)
+    #define threadlocal_q __thread
+#endif
+
+
 #endif // __INTERNALDEFINITIONS__
@@ -82,6 +82,14 @@ namespace Math
     #define fmod_q(fX, fY) fmod(fX, fY)
 #endif
 
+// --------------------------------------------------------------------------------------------------------
+// Vectorization: Defined when the mathematical operations that support it are calculated using SIMD
+// instructions. It depends on the configuration and is only possible when using simple precission.
+// --------------------------------------------------------------------------------------------------------
+#if QE_CONFIG_MATHVECTORIZATION_DEFAULT == QE_CONFIG_MATHVECTORIZATION_ENABLED && QE_CONFIG_PRECISION_DEFAULT == QE_CONFIG_PRECISION_SIMPLE
+    #define QE_MATH_VECTORIZATION_ENABLED
+#endif
+
 // --------------------------------------------------------------------------------------------------------
 // Pi: Defines how much accurate the mathematical Pi value is.
 // --------------------------------------------------------------------------------------------------------
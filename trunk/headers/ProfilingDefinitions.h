@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __PROFILINGDEFINITIONS__
+#define __PROFILINGDEFINITIONS__
+
+#include "SystemDefinitions.h"
+
+#include "QScopedProfilerSample.h"
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Diagnosis
+{
+
+// --------------------------------------------------------------------------------------------------------
+// Joins two tokens after expanding them, used to give a different name to every scoped sample.
+// --------------------------------------------------------------------------------------------------------
+#define QE_PROFILE_CONCATENATE_TOKENS(token1, token2) token1##token2
+#define QE_PROFILE_CONCATENATE(token1, token2) QE_PROFILE_CONCATENATE_TOKENS(token1, token2)
+
+#if QE_CONFIG_PROFILING_DEFAULT == QE_CONFIG_PROFILING_ENABLED
+
+// --------------------------------------------------------------------------------------------------------
+// Quimera Engine's Profiling utility: Measures the time spent from the point where it is placed until the end
+// of the enclosing scope. The name of the scope, which is a null-terminated array of chars that must exist 
+// while the profiler is used (like a string literal), is passed as parameter to this macro.
+// --------------------------------------------------------------------------------------------------------
+#define QE_PROFILE_SCOPE(szName)                                                                                  \
+    const Kinesis::QuimeraEngine::System::Diagnosis::QScopedProfilerSample QE_PROFILE_CONCATENATE(SCOPED_PROFILER_SAMPLE_, __LINE__)(szName);
+
+// --------------------------------------------------------------------------------------------------------
+// Quimera Engine's Profiling utility: It must be placed at the very beginning of the body of a function. 
+// It measures the time spent in the function, using its signature as the name of the scope.
+// --------------------------------------------------------------------------------------------------------
+#define QE_PROFILE_FUNCTION() QE_PROFILE_SCOPE(QE_PRINT_FUNCTION)
+
+#else
+
+#define QE_PROFILE_SCOPE(szName)
+#define QE_PROFILE_FUNCTION()
+
+#endif
+
+
+} //namespace Diagnosis
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __PROFILINGDEFINITIONS__
@@ -877,6 +877,71 @@ public:
         return arResult;
     }
 
+    /// <summary>
+    /// Replaces the elements of the array with the elements read from a binary reader.
+    /// </summary>
+    /// <remarks>
+    /// The elements are read directly into the memory of the array, which is only reallocated if its capacity is not enough. Trivially copyable elements 
+    /// (see QSerializationTraits) are read with only one call to the reader and no constructor is called; the rest of elements are default-constructed 
+    /// before being deserialized.<br/>
+    /// The destructor of every existing element will be called.
+    /// </remarks>
+    /// <typeparam name="ReaderT">The type of the binary reader. It must provide a ReadBytes method and the right shift operator, like QBinaryStreamReader does.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the elements will be read. They must have been written by the Serialize method.</param>
+    template<class ReaderT>
+    void Deserialize(ReaderT &reader)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+
+        const pointer_uint_q COUNT = SQBinarySerializer::ReadHeader(reader, SQBinarySerializer::GetElementSize<T>());
+
+        this->Clear();
+        this->Reserve(COUNT);
+
+        if(COUNT > 0)
+        {
+            // The elements occupy the first positions of the buffer
+            for(pointer_uint_q i = 0; i < COUNT; ++i)
+                m_allocator.Allocate();
+
+            m_uFirst = 0;
+            m_uLast = COUNT - 1U;
+
+            SQBinarySerializer::Construct(m_pElementBasePointer, COUNT);
+            SQBinarySerializer::Read(reader, m_pElementBasePointer, COUNT);
+        }
+    }
+
+    // The overloads that swap two elements would be hidden otherwise
+    using QArrayFixed<T, AllocatorT, ComparatorT>::Swap;
+
+    /// <summary>
+    /// Exchanges the elements and the capacity of the array with those of another array.
+    /// </summary>
+    /// <remarks>
+    /// The memory of both arrays is exchanged, so no element is copied and no assignment operator, copy constructor or destructor is called.
+    /// </remarks>
+    /// <param name="arInputArray">[IN/OUT] The array to exchange the elements with. If it is the resident array, nothing will happen.</param>
+    void Swap(QArrayDynamic &arInputArray)
+    {
+        if(&arInputArray != this)
+        {
+            const pointer_uint_q FIRST = m_uFirst;
+            const pointer_uint_q LAST = m_uLast;
+            T* pElementBasePointer = m_pElementBasePointer;
+
+            m_uFirst = arInputArray.m_uFirst;
+            m_uLast = arInputArray.m_uLast;
+            m_pElementBasePointer = arInputArray.m_pElementBasePointer;
+
+            arInputArray.m_uFirst = FIRST;
+            arInputArray.m_uLast = LAST;
+            arInputArray.m_pElementBasePointer = pElementBasePointer;
+
+            m_allocator.Swap(arInputArray.m_allocator);
+        }
+    }
+
 private:
 
     /// <summary>
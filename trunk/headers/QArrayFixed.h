@@ -36,6 +36,8 @@
 #include "SQComparatorDefault.h"
 #include "AllocationOperators.h"
 #include "EQIterationDirection.h"
+#include "SQBinarySerializer.h"
+#include "QStringUnicodeSerialization.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
@@ -1419,6 +1421,47 @@ public:
         return bElementFound ? --position : position;
     }
 
+    /// <summary>
+    /// Writes the elements of the array to a binary writer.
+    /// </summary>
+    /// <remarks>
+    /// Trivially copyable elements (see QSerializationTraits) are written with only one call to the writer.
+    /// </remarks>
+    /// <typeparam name="WriterT">The type of the binary writer. It must provide a WriteBytes method and the left shift operator, like QBinaryStreamWriter does.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer to which the elements will be written.</param>
+    template<class WriterT>
+    void Serialize(WriterT &writer) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+
+        const pointer_uint_q COUNT = this->GetCount();
+
+        SQBinarySerializer::WriteHeader(writer, SQBinarySerializer::GetElementSize<T>(), COUNT);
+        SQBinarySerializer::Write(writer, m_pElementBasePointer, COUNT);
+    }
+
+    /// <summary>
+    /// Replaces the elements of the array with the elements read from a binary reader.
+    /// </summary>
+    /// <remarks>
+    /// The elements are read directly into the memory of the array, which is not reallocated. Trivially copyable elements (see QSerializationTraits) 
+    /// are read with only one call to the reader; the rest of elements are deserialized over the existing ones.
+    /// </remarks>
+    /// <typeparam name="ReaderT">The type of the binary reader. It must provide a ReadBytes method and the right shift operator, like QBinaryStreamReader does.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the elements will be read. They must have been written by the Serialize method and 
+    /// their number must be equal to the number of elements in the array.</param>
+    template<class ReaderT>
+    void Deserialize(ReaderT &reader)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+
+        const pointer_uint_q COUNT = SQBinarySerializer::ReadHeader(reader, SQBinarySerializer::GetElementSize<T>());
+
+        QE_ASSERT_ERROR(COUNT == this->GetCount(), "The number of serialized elements must be equal to the number of elements in the array.");
+
+        SQBinarySerializer::Read(reader, m_pElementBasePointer, COUNT);
+    }
+
 private:
 
     /// <summary>
@@ -0,0 +1,670 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QASYNCHRONOUSFILESTREAM__
+#define __QASYNCHRONOUSFILESTREAM__
+
+#include "SystemDefinitions.h"
+
+#include "DataTypesDefinitions.h"
+#include "EQFileSystemError.h"
+#include "EQFileOpenMode.h"
+#include "QPath.h"
+#include "QMutex.h"
+#include "QConditionVariable.h"
+#include "QThread.h"
+
+#if defined(QE_OS_WINDOWS)
+    #include <Windows.h>
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+    #include <unistd.h>
+#endif
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( push )
+    #pragma warning( disable: 4251 ) // This warning occurs when using a template specialization as attribute
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace IO
+{
+namespace FileSystem
+{
+
+/// <summary>
+/// Represents a stream of data stored in a file, which is read and written in the background using a fixed amount of memory.
+/// </summary>
+/// <remarks>
+/// It keeps an internal pointer to a position of the stream, which allows reading or writing a group of bytes from there forward.<br/>
+/// The internal pointer can be moved back and forth as necessary, and it will be moved automatically after every read / write operation.<br/>
+/// The file is divided into windows of the size of the internal buffers, and the stream owns a fixed number of buffers, so the memory it uses never 
+/// grows regardless of the amount of data read or written. Every stream has a background thread that performs the operations on the file:
+/// <br/>
+/// - When reading, the window that follows the one being read is loaded in advance (read-ahead), so sequential reads rarely wait for the file.<br/>
+/// - When writing, the buffer of a window is sent to the background thread as soon as the internal pointer leaves the window, so the caller keeps writing 
+/// to another buffer while the previous one is written to the file (write-behind). The caller only waits when all the buffers have pending bytes.<br/>
+/// <br/>
+/// The throughput depends on the size and the number of buffers; larger buffers reduce the number of operations on the file, and more buffers allow the 
+/// background thread to fall behind for longer. There must be at least 2 buffers.<br/>
+/// Stream operations are not thread-safe, the stream must be used by one thread at a time.<br/>
+/// The range of positions this class can point to is limited by machine's address space. When compiling for 32-bits systems, only files whose size is 4 GB or less can be operated;
+/// 64-bits compilations allow up to 16 EB.<br/>
+/// An asynchronous file stream can be reutilized after it is closed, to operate with either the same file or another one.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QAsynchronousFileStream
+{
+    // TYPEDEFS
+    // ---------------
+public:
+    
+#if defined(QE_OS_WINDOWS)
+
+    typedef HANDLE NativeHandle;
+
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+
+    typedef int NativeHandle;
+
+#endif
+
+
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// One of the buffers that store a window of the file.
+    /// </summary>
+    struct QWindowBuffer
+    {
+        /// <summary>
+        /// The bytes of the window.
+        /// </summary>
+        u8_q* m_pData;
+
+        /// <summary>
+        /// The index of the window in the file, i.e. the position of its first byte divided by the size of the buffers.
+        /// </summary>
+        pointer_uint_q m_uWindow;
+
+        /// <summary>
+        /// The number of bytes of the window that belong to the stream, which may be lower than the size of the buffer for the last window.
+        /// </summary>
+        pointer_uint_q m_uValidBytes;
+
+        /// <summary>
+        /// The value of the use counter of the stream the last time the buffer was accessed, used to replace the least recently used buffer.
+        /// </summary>
+        pointer_uint_q m_uLastUse;
+
+        /// <summary>
+        /// The state of the buffer, one of the _BUFFER_* constants.
+        /// </summary>
+        unsigned int m_uState;
+
+        /// <summary>
+        /// The result of the last load or write of the window performed by the background thread.
+        /// </summary>
+        EQFileSystemError::EnumType m_eResult;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The default size (in bytes) of the batches used in the copy operation.
+    /// </summary>
+    static const pointer_uint_q _COPY_BATCH_SIZE = 4096U; // 4096 bytes is apparently the most common cluster size in a file system. It should be tuned to improve performance
+
+    /// <summary>
+    /// State of a buffer that does not store any window.
+    /// </summary>
+    static const unsigned int _BUFFER_EMPTY = 0;
+
+    /// <summary>
+    /// State of a buffer whose window is waiting for the background thread to load it.
+    /// </summary>
+    static const unsigned int _BUFFER_PENDING_LOAD = 1U;
+
+    /// <summary>
+    /// State of a buffer whose window is being loaded by the background thread.
+    /// </summary>
+    static const unsigned int _BUFFER_LOADING = 2U;
+
+    /// <summary>
+    /// State of a buffer whose content is equal to the content of the file.
+    /// </summary>
+    static const unsigned int _BUFFER_CLEAN = 3U;
+
+    /// <summary>
+    /// State of a buffer whose content has been modified and has not been sent to the background thread yet.
+    /// </summary>
+    static const unsigned int _BUFFER_DIRTY = 4U;
+
+    /// <summary>
+    /// State of a buffer whose content is waiting for the background thread to write it to the file.
+    /// </summary>
+    static const unsigned int _BUFFER_PENDING_WRITE = 5U;
+
+    /// <summary>
+    /// State of a buffer whose content is being written to the file by the background thread.
+    /// </summary>
+    static const unsigned int _BUFFER_WRITING = 6U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that initializes an asynchronous file stream.
+    /// </summary>
+    /// <remarks>
+    /// The instance is ready for opening a file and operate with it.<br/>
+    /// The memory used by the buffers is reserved here and does not change during the life of the instance.
+    /// </remarks>
+    /// <param name="uBufferSize">[IN] The size of every buffer, in bytes, which is also the size of the windows the file is divided into. It must not equal zero.</param>
+    /// <param name="uBufferCount">[IN] The number of buffers. It must be greater than or equal to 2.</param>
+    QAsynchronousFileStream(const pointer_uint_q uBufferSize, const unsigned int uBufferCount);
+
+    /// <summary>
+    /// Constructor that opens or creates an asynchronous file stream, receiving also the size and number of the buffers.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer's position is set to zero.<br/>
+    /// It calls the Open method.<br/>
+    /// If the current user has no writing permissions on the file, it will be opened as read-only.
+    /// </remarks>
+    /// <param name="filePath">[IN] The path of a file in the file system. It must neither be empty nor contain invalid characters.</param>
+    /// <param name="eOpenMode">[IN] The way the file will be opened.</param>
+    /// <param name="uBufferSize">[IN] The size of every buffer, in bytes, which is also the size of the windows the file is divided into. It must not equal zero.</param>
+    /// <param name="uBufferCount">[IN] The number of buffers. It must be greater than or equal to 2.</param>
+    /// <param name="eErrorInfo">[OUT] An error code representing the result of the operation. If nothing unexpected occurred, its value will be Success.</param>
+    QAsynchronousFileStream(const QPath &filePath, const EQFileOpenMode &eOpenMode, const pointer_uint_q uBufferSize, const unsigned int uBufferCount, EQFileSystemError &eErrorInfo);
+
+private:
+
+    // Hidden
+    QAsynchronousFileStream(const QAsynchronousFileStream &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// If the file is open, it will be closed.
+    /// </remarks>
+    ~QAsynchronousFileStream();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    QAsynchronousFileStream& operator=(const QAsynchronousFileStream &);
+
+public:
+
+    /// <summary>
+    /// Reads a group of bytes from the stream and copies them to an output buffer.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer is moved forward by the number of bytes read, after the operation. If the number of bytes
+    /// to read from the current position exceed the stream's limits, the pointer will be moved to the lastest valid position.<br/>
+    /// If a window is not already stored in a buffer, it waits for the background thread to load it. Every time the internal pointer enters a window,
+    /// the loading of the next window is requested.
+    /// </remarks>
+    /// <param name="pOutput">[IN] The output buffer where bytes are to be copied. Is must not be null.</param>
+    /// <param name="uOutputOffset">[IN] The offset, in bytes, from where to start writing to the output buffer.</param>
+    /// <param name="uOutputSize">[IN] The number of bytes to be read. It must not equal zero.</param>
+    void Read(void* pOutput, const pointer_uint_q uOutputOffset, const pointer_uint_q uOutputSize);
+    
+    /// <summary>
+    /// Copies a group of bytes from an input buffer to the stream.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer is moved forward by the number of bytes written, after the operation.<br/>
+    /// The stream will grow as more memory is required to store new data.<br/>
+    /// If the position of the internal pointer is not set to the end of the stream, the stream will be partially overwritten.<br/>
+    /// The buffer of a window is written to the file in the background when the internal pointer leaves the window. If all the buffers have pending
+    /// bytes, it waits for the background thread to write one of them.<br/>
+    /// The current user needs to have writing permissions on the file.
+    /// </remarks>
+    /// <param name="pInput">[IN] The input buffer from which bytes are to be copied. Is must not be null.</param>
+    /// <param name="uInputOffset">[IN] The offset, in bytes, from where to start reading from the input buffer.</param>
+    /// <param name="uInputSize">[IN] The number of bytes to be written. It must not equal zero.</param>
+    void Write(const void* pInput, const pointer_uint_q uInputOffset, const pointer_uint_q uInputSize);
+    
+    /// <summary>
+    /// Copies the content of the stream to another stream of any other kind.
+    /// </summary>
+    /// <remarks>
+    /// Bytes are copied sequentially as batches of an arbitrary size, starting at the specified offset.<br/>
+    /// The internal pointer of both streams is moved forward by the number of bytes copied.<br/>
+    /// The destination stream will grow as more memory is required to store new data.<br/>
+    /// The Flush method will not be called during this operation.
+    /// </remarks>
+    /// <typeparam name="StreamT">The type of the destination stream.</typeparam>
+    /// <param name="destinationStream">[OUT] The destination stream to which the content will be copied.</param>
+    /// <param name="uSourceOffset">[IN] The offset, in bytes, from where to start reading from the source stream (zero means the first position). 
+    /// It must be lower than the length of the source stream.</param>
+    /// <param name="uDestinationOffset">[IN] The offset, in bytes, from where to start writing to the destination stream (zero means the first position). 
+    /// It must be lower than or equal to the length of the destination stream.</param>
+    /// <param name="uNumberOfBytes">[IN] The number of bytes to copy. It must be lower than the length of the source stream minus the source offset.</param>
+    /// <param name="uBatchSize">[IN] The size, in bytes, of every copied batch. It must be greater than zero. It may affect the performance of the operation.</param>
+    template<class StreamT>
+    void CopyTo(StreamT &destinationStream, const pointer_uint_q uSourceOffset, const pointer_uint_q uDestinationOffset, 
+                                            const pointer_uint_q uNumberOfBytes, const pointer_uint_q uBatchSize=QAsynchronousFileStream::_COPY_BATCH_SIZE)
+    {
+        QE_ASSERT_ERROR(uBatchSize > 0, "The number of bytes per batch must be greater than zero.");
+        QE_ASSERT_ERROR(uSourceOffset < this->GetLength(), "The offset of the source stream is out of bounds.");
+        QE_ASSERT_ERROR(uDestinationOffset <= destinationStream.GetLength(), "The offset of the destination stream is out of bounds.");
+        QE_ASSERT_ERROR(uSourceOffset + uNumberOfBytes <= this->GetLength(), "The number of bytes to copy from the source, starting at the given offset, exceeds the limits of the stream.");
+
+        // If offsets point to valid positions
+        if(uSourceOffset < this->GetLength() && uDestinationOffset <= destinationStream.GetLength())
+        {
+            // The stream is copied batch by batch
+            const pointer_uint_q NUMBER_OF_BATCHES = uNumberOfBytes / uBatchSize;
+            u8_q* arBatch = new u8_q[uBatchSize];
+            
+            this->SetPosition(uSourceOffset);
+            destinationStream.SetPosition(uDestinationOffset);
+
+            for(pointer_uint_q i = 0; i < NUMBER_OF_BATCHES; ++i)
+            {
+                this->Read(arBatch, 0, uBatchSize);
+                destinationStream.Write(arBatch, 0, uBatchSize);
+            }
+
+            const pointer_uint_q REST_OF_BYTES = uNumberOfBytes % uBatchSize;
+
+            if(REST_OF_BYTES != 0)
+            {
+                this->Read(arBatch, 0, REST_OF_BYTES);
+                destinationStream.Write(arBatch, 0, REST_OF_BYTES);
+            }
+
+            delete[] arBatch;
+        }
+    }
+
+    /// <summary>
+    /// Sends all the modified buffers to the background thread and waits for it to write them to the file.
+    /// </summary>
+    /// <remarks>
+    /// The current user must have writing permissions on the file in case some bytes are needed to be written.<br/>
+    /// Errors that occur in the background thread cannot be reported when they happen, so they are kept until this method is called.
+    /// </remarks>
+    /// <returns>
+    /// An error code representing the result of the first load or write that failed in the background thread since the last call to this method. 
+    /// If nothing unexpected occurred, it returns Success.
+    /// </returns>
+    EQFileSystemError Flush();
+
+    /// <summary>
+    /// Moves the internal pointer to a prior position.
+    /// </summary>
+    /// <param name="uAmount">[IN] The number of bytes to move back the internal pointer's position. If it is already at the first position, it does nothing.</param>
+    void MoveBackward(const pointer_uint_q uAmount);
+
+    /// <summary>
+    /// Moves the internal pointer to a posterior position.
+    /// </summary>
+    /// <param name="uAmount">[IN] The number of bytes to move forward the internal pointer's position. If it is already at the latest position, it does nothing.</param>
+    void MoveForward(const pointer_uint_q uAmount);
+
+    /// <summary>
+    /// Opens or creates a file stream and starts the background thread.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer's position is set to zero.<br/>
+    /// The file stream must not be already opened.<br/>
+    /// If the current user has no writing permissions on the file, it will be opened as read-only.
+    /// </remarks>
+    /// <param name="filePath">[IN] The path of a file in the file system. It must neither be empty nor contain invalid characters.</param>
+    /// <param name="eOpenMode">[IN] The way the file will be opened.</param>
+    /// <returns>
+    /// An error code representing the result of the operation. If nothing unexpected occurred, it returns Success.
+    /// </returns>
+    EQFileSystemError Open(const QPath &filePath, const EQFileOpenMode &eOpenMode);
+
+    /// <summary>
+    /// Closes the file stream and stops the background thread.
+    /// </summary>
+    /// <remarks>
+    /// The Flush method is called before the stream is closed.
+    /// </remarks>
+    void Close();
+
+private:
+
+    /// <summary>
+    /// Gets the buffer that stores a window, waiting for the background thread to load it or to release a buffer if necessary.
+    /// </summary>
+    /// <remarks>
+    /// The buffer that was used previously is sent to the background thread if it was modified and it does not store the same window.
+    /// </remarks>
+    /// <param name="uWindow">[IN] The index of the window.</param>
+    /// <param name="bIsForWriting">[IN] Indicates whether the buffer is going to be modified.</param>
+    /// <returns>
+    /// The buffer that stores the window, whose content can be used until another buffer is requested.
+    /// </returns>
+    QWindowBuffer* _AcquireBuffer(const pointer_uint_q uWindow, const bool bIsForWriting);
+
+    /// <summary>
+    /// Searches for the buffer that stores a window.
+    /// </summary>
+    /// <remarks>
+    /// The mutex must be owned by the calling thread.
+    /// </remarks>
+    /// <param name="uWindow">[IN] The index of the window.</param>
+    /// <returns>
+    /// The buffer that stores the window, or null if no buffer stores it.
+    /// </returns>
+    QWindowBuffer* _FindBuffer(const pointer_uint_q uWindow) const;
+
+    /// <summary>
+    /// Searches for the least recently used buffer that can be replaced without waiting, which is either empty or clean.
+    /// </summary>
+    /// <remarks>
+    /// The mutex must be owned by the calling thread.
+    /// </remarks>
+    /// <returns>
+    /// The buffer to be replaced, or null if all the buffers are in use or have pending bytes.
+    /// </returns>
+    QWindowBuffer* _FindReplaceableBuffer() const;
+
+    /// <summary>
+    /// Makes a buffer store a window, requesting the background thread to load the window if it contains bytes of the stream.
+    /// </summary>
+    /// <remarks>
+    /// The mutex must be owned by the calling thread.
+    /// </remarks>
+    /// <param name="pBuffer">[IN] A buffer that is either empty or clean.</param>
+    /// <param name="uWindow">[IN] The index of the window.</param>
+    void _AssignWindow(QWindowBuffer* pBuffer, const pointer_uint_q uWindow);
+
+    /// <summary>
+    /// Sends a modified buffer to the background thread so it is written to the file.
+    /// </summary>
+    /// <remarks>
+    /// The mutex must be owned by the calling thread.
+    /// </remarks>
+    /// <param name="pBuffer">[IN] A buffer whose state is dirty.</param>
+    void _RequestWrite(QWindowBuffer* pBuffer);
+
+    /// <summary>
+    /// The function executed by the background thread, which loads and writes the buffers requested by the stream until it is closed.
+    /// </summary>
+    /// <remarks>
+    /// Nothing is asserted in the background thread; the result of every operation is stored in its buffer, and failures are also kept by the stream, 
+    /// so they are reported to the thread that uses the stream when it waits for the buffer or flushes the stream.
+    /// </remarks>
+    void _BackgroundThreadLoop();
+    
+    /// <summary>
+    /// The platform-specific implementation of the Read operation.
+    /// </summary>
+    /// <param name="pOutputBuffer">[OUT] The output buffer to which read bytes are to be copied.</param>
+    /// <param name="uNumberOfBytes">[IN] The number of bytes to copy to the output buffer.</param>
+    /// <param name="uFileOffset">[IN] The position to start copying from the file.</param>
+    /// <param name="handle">[IN] The operating system file handle.</param>
+    /// <param name="eErrorInfo">[OUT] The result of the operation.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    static bool _ReadPlatformImplementation(u8_q* pOutputBuffer, const pointer_uint_q uNumberOfBytes, const pointer_uint_q uFileOffset, const QAsynchronousFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo);
+    
+    /// <summary>
+    /// The platform-specific implementation of the Write operation.
+    /// </summary>
+    /// <param name="pInputBuffer">[IN] The input buffer whose content is to be written to the file.</param>
+    /// <param name="uNumberOfBytes">[IN] The number of bytes to copy to the file.</param>
+    /// <param name="uFileOffset">[IN] The position to start copying to the file.</param>
+    /// <param name="handle">[IN] The operating system file handle.</param>
+    /// <param name="eErrorInfo">[OUT] The result of the operation.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    static bool _WritePlatformImplementation(const void* pInputBuffer, const pointer_uint_q uNumberOfBytes, const pointer_uint_q uFileOffset, const QAsynchronousFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo);
+    
+    /// <summary>
+    /// The platform-specific implementation of the Open operation.
+    /// </summary>
+    /// <param name="filePath">[IN] The path to the file.</param>
+    /// <param name="eOpenMode">[IN] The way the operating system will open the file.</param>
+    /// <param name="bIsWritingAllowed">[IN] Indicates whether the current user has enough permissions to open the file.</param>
+    /// <param name="handle">[OUT] The operating system file handle.</param>
+    /// <param name="eErrorInfo">[OUT] The result of the operation.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    static bool _OpenPlatformImplementation(const QPath &filePath, const EQFileOpenMode &eOpenMode, const bool bIsWritingAllowed, QAsynchronousFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo);
+    
+    /// <summary>
+    /// The platform-specific implementation of the Close operation.
+    /// </summary>
+    /// <param name="handle">[IN] The operating system file handle.</param>
+    /// <param name="filePath">[IN] The path to the file.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    static bool _ClosePlatformImplementation(const QAsynchronousFileStream::NativeHandle &handle, const QPath &filePath);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the length of the stream, in bytes.
+    /// </summary>
+    /// <returns>
+    /// The number of bytes contained in the stream.
+    /// </returns>
+    pointer_uint_q GetLength() const;
+
+    /// <summary>
+    /// Gets the position of the internal pointer in the stream.
+    /// </summary>
+    /// <returns>
+    /// The byte number to which the internal pointer is pointing to.
+    /// </returns>
+    pointer_uint_q GetPosition() const;
+
+    /// <summary>
+    /// Sets the position of the internal pointer.
+    /// </summary>
+    /// <param name="uPosition">[IN] The new position of the internal pointer. It must be lower than or equal to the length of the stream 
+    /// or it will not be set.</param>
+    void SetPosition(const pointer_uint_q uPosition);
+
+    /// <summary>
+    /// Gets the path of the file.
+    /// </summary>
+    /// <returns>
+    /// The path of the file that is being read/written.
+    /// </returns>
+    QPath GetPath() const;
+
+    /// <summary>
+    /// Indicates whether the file is open or not.
+    /// </summary>
+    /// <returns>
+    /// True if the file is open; False otherwise.
+    /// </returns>
+    bool IsOpen() const;
+    
+    /// <summary>
+    /// Gets the native handle generated by the operating system.
+    /// </summary>
+    /// <returns>
+    /// A handle as the native type for the current operating system.
+    /// </returns>
+    QAsynchronousFileStream::NativeHandle GetNativeHandle() const;
+
+    /// <summary>
+    /// Gets the size of every buffer, which is also the size of the windows the file is divided into.
+    /// </summary>
+    /// <returns>
+    /// The size of the buffers, in bytes.
+    /// </returns>
+    pointer_uint_q GetBufferSize() const;
+
+    /// <summary>
+    /// Gets the number of buffers.
+    /// </summary>
+    /// <returns>
+    /// The number of buffers. The memory used by the stream is the size of the buffers multiplied by this number.
+    /// </returns>
+    unsigned int GetBufferCount() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The path of the file.
+    /// </summary>
+    QPath m_path;
+
+    /// <summary>
+    /// The memory block shared by all the buffers.
+    /// </summary>
+    u8_q* m_pBufferMemory;
+
+    /// <summary>
+    /// The buffers that store windows of the file.
+    /// </summary>
+    QWindowBuffer* m_arBuffers;
+
+    /// <summary>
+    /// The size of every buffer, in bytes.
+    /// </summary>
+    pointer_uint_q m_uBufferSize;
+
+    /// <summary>
+    /// The number of buffers.
+    /// </summary>
+    unsigned int m_uBufferCount;
+
+    /// <summary>
+    /// The buffer that was used by the last read or write operation. It is null when there is no such buffer.
+    /// </summary>
+    QWindowBuffer* m_pCurrentBuffer;
+
+    /// <summary>
+    /// A counter that increases every time a buffer is acquired, used to know which buffer was used least recently.
+    /// </summary>
+    pointer_uint_q m_uUseCounter;
+
+    /// <summary>
+    /// The size of the file, in bytes. Although the buffers have not been written to the file yet, if the length of the stream is increased, 
+    /// this attribute will store the size that the file would have once it is updated.
+    /// </summary>
+    pointer_uint_q m_uFileSize;
+
+    /// <summary>
+    /// A native handle for the file in the local file system.
+    /// </summary>
+    QAsynchronousFileStream::NativeHandle m_nativeHandle;
+
+    /// <summary>
+    /// The position of the internal reading/writing pointer.
+    /// </summary>
+    pointer_uint_q m_uPositionPointer;
+
+    /// <summary>
+    /// Indicates whether the file is open or not.
+    /// </summary>
+    bool m_bIsOpen;
+
+    /// <summary>
+    /// Indicates whether the user has permissions to write to the file or not.
+    /// </summary>
+    bool m_bWritingIsAllowed;
+
+    /// <summary>
+    /// The thread that loads and writes the buffers.
+    /// </summary>
+    Kinesis::QuimeraEngine::System::Threading::QThread* m_pBackgroundThread;
+
+    /// <summary>
+    /// Indicates whether the background thread has to finish once there are no pending buffers.
+    /// </summary>
+    bool m_bStopRequested;
+
+    /// <summary>
+    /// The result of the first load or write that failed in the background thread since the stream was last flushed.
+    /// </summary>
+    EQFileSystemError m_eBackgroundError;
+
+    /// <summary>
+    /// Mutex that protects the states of the buffers.
+    /// </summary>
+    Kinesis::QuimeraEngine::System::Threading::QMutex m_mutex;
+
+    /// <summary>
+    /// Condition variable used to notify the background thread that a buffer has to be loaded or written.
+    /// </summary>
+    Kinesis::QuimeraEngine::System::Threading::QConditionVariable m_bufferRequested;
+
+    /// <summary>
+    /// Condition variable used to notify the stream that a buffer has been loaded or written.
+    /// </summary>
+    Kinesis::QuimeraEngine::System::Threading::QConditionVariable m_bufferCompleted;
+};
+
+} //namespace FileSystem
+} //namespace IO
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( pop )
+#endif
+
+#endif // __QASYNCHRONOUSFILESTREAM__
@@ -28,6 +28,7 @@
 #define __QBASEDUALQUATERNION__
 
 #include "QQuaternion.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 
@@ -125,4 +126,6 @@ public:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QBaseDualQuaternion)
+
 #endif // __QBASEDUALQUATERNION__
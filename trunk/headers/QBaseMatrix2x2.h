@@ -29,6 +29,7 @@
 
 #include "DataTypesDefinitions.h"
 #include "ToolsDefinitions.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
@@ -135,4 +136,6 @@ public:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QBaseMatrix2x2)
+
 #endif // __QBASEMATRIX2X2__
@@ -29,6 +29,7 @@
 
 #include "DataTypesDefinitions.h"
 #include "ToolsDefinitions.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
@@ -146,4 +147,6 @@ public:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QBaseMatrix3x4)
+
 #endif // __QBASEMATRIX3X4__
@@ -29,6 +29,7 @@
 
 #include "DataTypesDefinitions.h"
 #include "ToolsDefinitions.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
@@ -151,4 +152,6 @@ public:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QBaseMatrix4x3)
+
 #endif // __QBASEMATRIX4X3__
@@ -35,6 +35,10 @@
 #include "SQComparatorDefault.h"
 #include "EQTreeTraversalOrder.h"
 #include "EQIterationDirection.h"
+#include "SQBinarySerializer.h"
+#include "QStringUnicodeSerialization.h"
+#include "QBufferedBinaryWriter.h"
+#include "QBufferedBinaryReader.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
@@ -62,12 +66,16 @@ namespace Containers
 /// In a binary search tree, elements cannot be modified, their position in the tree may become inconsistent since it depends on their value and the comparison algorithm.<br/>
 /// There is not a default way to traverse an binary search tree, the desired method will have to be specified when necessary.<br/>
 /// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
-/// If SQComparatorDefault is used as comparator, elements will be forced to implement operators "==" and "<".
+/// If SQComparatorDefault is used as comparator, elements will be forced to implement operators "==" and "<".<br/>
+/// Optionally, the tree can keep itself balanced (AVL tree), so the height of the tree is always proportional to the logarithm of the number of elements, 
+/// no matter the order in which they are added or removed. In that case, nodes are rotated when necessary, which changes the relations among them but 
+/// not their physical position.
 /// </remarks>
 /// <typeparam name="T">The type of the tree elements.</typeparam>
 /// <typeparam name="AllocatorT">The allocator used to reserve memory. The default type is QPoolAllocator.</typeparam>
 /// <typeparam name="ComparatorT">The comparator. The default type is SQComparatorDefault.</typeparam>
-template<class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T> >
+/// <typeparam name="IsBalancedT">Indicates whether the tree keeps itself balanced. By default, it is not balanced.</typeparam>
+template<class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T>, bool IsBalancedT = false>
 class QBinarySearchTree
 {
     // INTERNAL CLASSES
@@ -89,10 +97,14 @@ protected:
         /// <param name="uParentPosition">[IN] The physical position of the parent node.</param>
         /// <param name="uLeftChildPosition">[IN] The physical position of left child node.</param>
         /// <param name="uRightChildPosition">[IN] The physical position of the right child node.</param>
+        /// <remarks>
+        /// The height of the node is one, as corresponds to a leaf node.
+        /// </remarks>
         QBinaryNode(const pointer_uint_q uParentPosition, const pointer_uint_q uLeftChildPosition, const pointer_uint_q uRightChildPosition) :
                                                                                             m_uParent(uParentPosition),
                                                                                             m_uLeft(uLeftChildPosition),
-                                                                                            m_uRight(uRightChildPosition)
+                                                                                            m_uRight(uRightChildPosition),
+                                                                                            m_uHeight(1U)
         {
         }
         
@@ -160,6 +172,26 @@ protected:
         {
             m_uRight = uPosition;
         }
+        
+        /// <summary>
+        /// Gets the height of the subtree whose root is the node, which is only kept up to date when the tree is balanced.
+        /// </summary>
+        /// <returns>
+        /// The number of nodes in the longest path from the node to a leaf, including both.
+        /// </returns>
+        pointer_uint_q GetHeight() const
+        {
+            return m_uHeight;
+        }
+        
+        /// <summary>
+        /// Sets the height of the subtree whose root is the node.
+        /// </summary>
+        /// <param name="uHeight">[IN] The number of nodes in the longest path from the node to a leaf, including both.</param>
+        void SetHeight(const pointer_uint_q uHeight)
+        {
+            m_uHeight = uHeight;
+        }
 
 
         // ATTRIBUTES
@@ -181,6 +213,11 @@ protected:
         /// </returns>
         pointer_uint_q m_uRight;
 
+        /// <returns>
+        /// The height of the subtree whose root is the node.
+        /// </returns>
+        pointer_uint_q m_uHeight;
+
     }; // class QBinaryNode
     
 public:
@@ -1326,6 +1363,9 @@ public:
                     }
                 }
             } // while(pNewNode != null_q)
+
+            if(IsBalancedT)
+                this->_Rebalance(pNewNode->GetParent());
         }
 
         return QBinarySearchTree::QConstBinarySearchTreeIterator(this, pNewNode - m_pNodeBasePointer, eTraversalOrder);
@@ -1337,6 +1377,7 @@ public:
     /// <remarks>
     /// The destructor of the element will be called.<br/>
     /// Removing an element does not imply the removal of its child nodes; instead, they will be reordered so the right child will be always a descendant of the left child when both exist.
+    /// If the tree is balanced, the node is replaced with the rightmost descendant of its left child instead, and the tree is balanced again afterwards.
     /// </remarks>
     /// <param name="elementPosition">[IN] The position of the element to remove. It must not point to the end position.</param>
     /// <returns>
@@ -1359,11 +1400,54 @@ public:
         
         pointer_uint_q uNewChild = QBinarySearchTree::END_POSITION_FORWARD;
 
-        if(pNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD && 
+        // The deepest node whose height may have changed, from which the tree is balanced
+        pointer_uint_q uFirstNodeToBalance = pNode->GetParent();
+
+        if(IsBalancedT &&
+           pNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD && 
            pNode->GetLeftChild()  != QBinarySearchTree::END_POSITION_FORWARD)
         {
             // The node has both left and right children
 
+            // The node will be replaced with its in-order predecessor, the rightmost node in the branch of its left child
+            uNewChild = pNode->GetLeftChild();
+            QBinarySearchTree::QBinaryNode* pPredecessor = m_pNodeBasePointer + uNewChild;
+
+            while(pPredecessor->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
+                pPredecessor = m_pNodeBasePointer + pPredecessor->GetRightChild();
+
+            const pointer_uint_q PREDECESSOR_POSITION = pPredecessor - m_pNodeBasePointer;
+
+            if(PREDECESSOR_POSITION == uNewChild)
+            {
+                // The left child is the predecessor, it keeps its left branch
+                uFirstNodeToBalance = PREDECESSOR_POSITION;
+            }
+            else
+            {
+                // The predecessor is detached from its parent, which adopts its left child
+                uFirstNodeToBalance = pPredecessor->GetParent();
+                QBinarySearchTree::QBinaryNode* pPredecessorParent = m_pNodeBasePointer + uFirstNodeToBalance;
+                pPredecessorParent->SetRightChild(pPredecessor->GetLeftChild());
+
+                if(pPredecessor->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+                    (m_pNodeBasePointer + pPredecessor->GetLeftChild())->SetParent(uFirstNodeToBalance);
+
+                // The predecessor adopts the left child of the removed node
+                pPredecessor->SetLeftChild(pNode->GetLeftChild());
+                (m_pNodeBasePointer + pNode->GetLeftChild())->SetParent(PREDECESSOR_POSITION);
+                uNewChild = PREDECESSOR_POSITION;
+            }
+
+            // The predecessor adopts the right child of the removed node
+            pPredecessor->SetRightChild(pNode->GetRightChild());
+            (m_pNodeBasePointer + pNode->GetRightChild())->SetParent(PREDECESSOR_POSITION);
+        }
+        else if(pNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD && 
+                pNode->GetLeftChild()  != QBinarySearchTree::END_POSITION_FORWARD)
+        {
+            // The node has both left and right children
+
             // The node will be replaced with the left child
             uNewChild = pNode->GetLeftChild();
 
@@ -1418,6 +1502,9 @@ public:
         m_elementAllocator.Deallocate(pElement);
         m_nodeAllocator.Deallocate(pNode);
 
+        if(IsBalancedT)
+            this->_Rebalance(uFirstNodeToBalance);
+
         return resultIterator;
     }
     
@@ -1586,6 +1673,91 @@ public:
         destinationTree.m_uRoot = m_uRoot;
     }
     
+    /// <summary>
+    /// Writes the elements of the tree to a binary writer, in depth-first pre-order.
+    /// </summary>
+    /// <remarks>
+    /// Elements are not stored contiguously, so they are buffered and sent to the writer in blocks.
+    /// </remarks>
+    /// <typeparam name="WriterT">The type of the binary writer. It must provide a WriteBytes method and the left shift operator, like QBinaryStreamWriter does.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer to which the elements will be written.</param>
+    template<class WriterT>
+    void Serialize(WriterT &writer) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+        using Kinesis::QuimeraEngine::Common::DataTypes::QBufferedBinaryWriter;
+
+        SQBinarySerializer::WriteHeader(writer, SQBinarySerializer::GetElementSize<T>(), this->GetCount());
+
+        QBufferedBinaryWriter<WriterT> bufferedWriter(writer);
+
+        // Iterators do not support the pre-order traversal, nodes are visited by following their links
+        pointer_uint_q uPosition = m_uRoot;
+
+        while(uPosition != QBinarySearchTree::END_POSITION_FORWARD)
+        {
+            SQBinarySerializer::Write(bufferedWriter, m_pElementBasePointer + uPosition, 1U);
+
+            const QBinarySearchTree::QBinaryNode* pNode = m_pNodeBasePointer + uPosition;
+
+            if(pNode->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+            {
+                uPosition = pNode->GetLeftChild();
+            }
+            else if(pNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
+            {
+                uPosition = pNode->GetRightChild();
+            }
+            else
+            {
+                // Goes up until a node is reached from its left child and it has a right child, which is the next one
+                pointer_uint_q uParent = pNode->GetParent();
+
+                while(uParent != QBinarySearchTree::END_POSITION_FORWARD &&
+                      (m_pNodeBasePointer[uParent].GetLeftChild() != uPosition || m_pNodeBasePointer[uParent].GetRightChild() == QBinarySearchTree::END_POSITION_FORWARD))
+                {
+                    uPosition = uParent;
+                    uParent = m_pNodeBasePointer[uParent].GetParent();
+                }
+
+                uPosition = uParent == QBinarySearchTree::END_POSITION_FORWARD ? QBinarySearchTree::END_POSITION_FORWARD : 
+                                                                                   m_pNodeBasePointer[uParent].GetRightChild();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Replaces the elements of the tree with the elements read from a binary reader.
+    /// </summary>
+    /// <remarks>
+    /// Elements are added in the same order they were written, so unbalanced trees get the same shape they had. The memory is only reallocated if 
+    /// the capacity of the tree is not enough.<br/>
+    /// Trivially copyable elements (see QSerializationTraits) are read from the reader in blocks. The type of the elements must be default-constructible.<br/>
+    /// The destructor of every existing element will be called.
+    /// </remarks>
+    /// <typeparam name="ReaderT">The type of the binary reader. It must provide a ReadBytes method and the right shift operator, like QBinaryStreamReader does.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the elements will be read. They must have been written by the Serialize method.</param>
+    template<class ReaderT>
+    void Deserialize(ReaderT &reader)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+        using Kinesis::QuimeraEngine::Common::DataTypes::QBufferedBinaryReader;
+
+        const pointer_uint_q COUNT = SQBinarySerializer::ReadHeader(reader, SQBinarySerializer::GetElementSize<T>());
+
+        this->Clear();
+        this->Reserve(COUNT);
+
+        QBufferedBinaryReader<ReaderT> bufferedReader(reader, COUNT * SQBinarySerializer::GetElementSize<T>());
+        T element;
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+        {
+            SQBinarySerializer::Read(bufferedReader, &element, 1U);
+            this->Add(element, EQTreeTraversalOrder::E_DepthFirstInOrder);
+        }
+    }
+    
 private:
 
     /// <summary>
@@ -1599,6 +1771,158 @@ private:
         this->Reserve(FINAL_CAPACITY);
     }
 
+    /// <summary>
+    /// Gets the height of a node.
+    /// </summary>
+    /// <param name="uPosition">[IN] The physical position of the node. It may be the end position, which means there is no node.</param>
+    /// <returns>
+    /// The height of the node, or zero if there is no node.
+    /// </returns>
+    pointer_uint_q _GetHeight(const pointer_uint_q uPosition) const
+    {
+        return uPosition == QBinarySearchTree::END_POSITION_FORWARD ? 0 : (m_pNodeBasePointer + uPosition)->GetHeight();
+    }
+
+    /// <summary>
+    /// Calculates the height of a node from the height of its children.
+    /// </summary>
+    /// <param name="pNode">[IN/OUT] The node whose height is to be updated.</param>
+    void _UpdateHeight(QBinaryNode* pNode)
+    {
+        const pointer_uint_q LEFT_HEIGHT = this->_GetHeight(pNode->GetLeftChild());
+        const pointer_uint_q RIGHT_HEIGHT = this->_GetHeight(pNode->GetRightChild());
+        pNode->SetHeight((LEFT_HEIGHT > RIGHT_HEIGHT ? LEFT_HEIGHT : RIGHT_HEIGHT) + 1U);
+    }
+
+    /// <summary>
+    /// Replaces a node with one of its children in the relations of its parent, or as root of the tree if the node has no parent.
+    /// </summary>
+    /// <param name="pNode">[IN] The node to be replaced.</param>
+    /// <param name="uChild">[IN] The physical position of the child that occupies the place of the node.</param>
+    void _ReplaceInParent(const QBinaryNode* pNode, const pointer_uint_q uChild)
+    {
+        const pointer_uint_q NODE_POSITION = pNode - m_pNodeBasePointer;
+
+        (m_pNodeBasePointer + uChild)->SetParent(pNode->GetParent());
+
+        if(pNode->GetParent() == QBinarySearchTree::END_POSITION_FORWARD)
+        {
+            m_uRoot = uChild;
+        }
+        else
+        {
+            QBinarySearchTree::QBinaryNode* pParentNode = m_pNodeBasePointer + pNode->GetParent();
+
+            if(pParentNode->GetLeftChild() == NODE_POSITION)
+                pParentNode->SetLeftChild(uChild);
+            else
+                pParentNode->SetRightChild(uChild);
+        }
+    }
+
+    /// <summary>
+    /// Rotates a node to the left, so its right child occupies its place and the node becomes the left child of it.
+    /// </summary>
+    /// <param name="uPosition">[IN] The physical position of the node. It must have a right child.</param>
+    /// <returns>
+    /// The physical position of the node that occupies the place of the rotated node.
+    /// </returns>
+    pointer_uint_q _RotateLeft(const pointer_uint_q uPosition)
+    {
+        QBinarySearchTree::QBinaryNode* pNode = m_pNodeBasePointer + uPosition;
+        const pointer_uint_q PIVOT_POSITION = pNode->GetRightChild();
+        QBinarySearchTree::QBinaryNode* pPivot = m_pNodeBasePointer + PIVOT_POSITION;
+
+        this->_ReplaceInParent(pNode, PIVOT_POSITION);
+
+        // The left child of the pivot becomes the right child of the node
+        pNode->SetRightChild(pPivot->GetLeftChild());
+
+        if(pPivot->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+            (m_pNodeBasePointer + pPivot->GetLeftChild())->SetParent(uPosition);
+
+        pPivot->SetLeftChild(uPosition);
+        pNode->SetParent(PIVOT_POSITION);
+
+        this->_UpdateHeight(pNode);
+        this->_UpdateHeight(pPivot);
+
+        return PIVOT_POSITION;
+    }
+
+    /// <summary>
+    /// Rotates a node to the right, so its left child occupies its place and the node becomes the right child of it.
+    /// </summary>
+    /// <param name="uPosition">[IN] The physical position of the node. It must have a left child.</param>
+    /// <returns>
+    /// The physical position of the node that occupies the place of the rotated node.
+    /// </returns>
+    pointer_uint_q _RotateRight(const pointer_uint_q uPosition)
+    {
+        QBinarySearchTree::QBinaryNode* pNode = m_pNodeBasePointer + uPosition;
+        const pointer_uint_q PIVOT_POSITION = pNode->GetLeftChild();
+        QBinarySearchTree::QBinaryNode* pPivot = m_pNodeBasePointer + PIVOT_POSITION;
+
+        this->_ReplaceInParent(pNode, PIVOT_POSITION);
+
+        // The right child of the pivot becomes the left child of the node
+        pNode->SetLeftChild(pPivot->GetRightChild());
+
+        if(pPivot->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
+            (m_pNodeBasePointer + pPivot->GetRightChild())->SetParent(uPosition);
+
+        pPivot->SetRightChild(uPosition);
+        pNode->SetParent(PIVOT_POSITION);
+
+        this->_UpdateHeight(pNode);
+        this->_UpdateHeight(pPivot);
+
+        return PIVOT_POSITION;
+    }
+
+    /// <summary>
+    /// Updates the height of a node and all its ancestors, rotating those whose children heights differ in more than one.
+    /// </summary>
+    /// <param name="uPosition">[IN] The physical position of the deepest node to balance. It may be the end position, which means there is no node.</param>
+    void _Rebalance(const pointer_uint_q uPosition)
+    {
+        pointer_uint_q uCurrentPosition = uPosition;
+
+        while(uCurrentPosition != QBinarySearchTree::END_POSITION_FORWARD)
+        {
+            QBinarySearchTree::QBinaryNode* pNode = m_pNodeBasePointer + uCurrentPosition;
+            const pointer_uint_q LEFT_HEIGHT = this->_GetHeight(pNode->GetLeftChild());
+            const pointer_uint_q RIGHT_HEIGHT = this->_GetHeight(pNode->GetRightChild());
+
+            if(LEFT_HEIGHT > RIGHT_HEIGHT + 1U)
+            {
+                // The left branch is too deep; if the deepest part of it is at the right, it is moved to the left first
+                QBinarySearchTree::QBinaryNode* pLeftChild = m_pNodeBasePointer + pNode->GetLeftChild();
+
+                if(this->_GetHeight(pLeftChild->GetRightChild()) > this->_GetHeight(pLeftChild->GetLeftChild()))
+                    this->_RotateLeft(pNode->GetLeftChild());
+
+                uCurrentPosition = this->_RotateRight(uCurrentPosition);
+            }
+            else if(RIGHT_HEIGHT > LEFT_HEIGHT + 1U)
+            {
+                // The right branch is too deep; if the deepest part of it is at the left, it is moved to the right first
+                QBinarySearchTree::QBinaryNode* pRightChild = m_pNodeBasePointer + pNode->GetRightChild();
+
+                if(this->_GetHeight(pRightChild->GetLeftChild()) > this->_GetHeight(pRightChild->GetRightChild()))
+                    this->_RotateRight(pNode->GetRightChild());
+
+                uCurrentPosition = this->_RotateLeft(uCurrentPosition);
+            }
+            else
+            {
+                pNode->SetHeight((LEFT_HEIGHT > RIGHT_HEIGHT ? LEFT_HEIGHT : RIGHT_HEIGHT) + 1U);
+            }
+
+            uCurrentPosition = (m_pNodeBasePointer + uCurrentPosition)->GetParent();
+        }
+    }
+
     // PROPERTIES
     // ---------------
 public:
@@ -1681,11 +2005,11 @@ protected:
 
 // ATTRIBUTE INITIALIZATION
 // ----------------------------
-template <class T, class AllocatorT, class ComparatorT>
-pointer_uint_q QBinarySearchTree<T, AllocatorT, ComparatorT>::sm_uDefaultCapacity = 1;
+template <class T, class AllocatorT, class ComparatorT, bool IsBalancedT>
+pointer_uint_q QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::sm_uDefaultCapacity = 1;
 
-template<class T, class AllocatorT, class ComparatorT>
-float QBinarySearchTree<T, AllocatorT, ComparatorT>::REALLOCATION_FACTOR = 1.5f;
+template<class T, class AllocatorT, class ComparatorT, bool IsBalancedT>
+float QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::REALLOCATION_FACTOR = 1.5f;
 
 
 } //namespace Containers
@@ -0,0 +1,1296 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QBOUNDINGVOLUMEHIERARCHY__
+#define __QBOUNDINGVOLUMEHIERARCHY__
+
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "QVector3.h"
+#include "QBaseTriangle.h"
+#include "QBaseHexahedron.h"
+#include "QBaseOrb.h"
+#include "QBaseLineSegment.h"
+#include "QRay3D.h"
+#include "QLineSegment3D.h"
+#include "QHexahedron.h"
+#include "QArrayDynamic.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Math
+{
+
+/// <summary>
+/// Hierarchy of bounding volumes that speeds up the intersection queries against a big set of triangles or hexahedra, like a mesh or the
+/// objects of a scene, by discarding whole groups of primitives whose common bounding box is not touched by the figure being checked.
+/// </summary>
+/// <remarks>
+/// The tree is built once, using the surface area heuristic (SAH), over the axis-aligned bounding boxes of the primitives, which are an internal
+/// detail. Queries cost O(log n) on average instead of the O(n) of checking every primitive.<br/>
+/// The nodes are stored in a single array in depth-first order, so the first child of a node is always the next node in the array; the
+/// primitives are copied and sorted so the ones of every leaf are contiguous in memory.<br/>
+/// When the primitives move but keep roughly their relative position, Refit updates the bounding boxes without rebuilding the tree; if they
+/// are completely rearranged, the queries become slower and it is better to create a new hierarchy.<br/>
+/// Primitives are identified by their position in the array passed to the constructor. Both faces of the triangles are checked and hexahedra
+/// are expected to be convex.<br/>
+/// Instances of this class cannot be copied.
+/// </remarks>
+/// <typeparam name="PrimitiveT">Allowed types: QBaseTriangle<QVector3>, QBaseHexahedron<QVector3>.</typeparam>
+template <class PrimitiveT>
+class QBoundingVolumeHierarchy
+{
+    // INTERNAL CLASSES
+    // -----------------
+private:
+
+    /// <summary>
+    /// Axis-aligned box, defined by its minimum and maximum corners, that encloses a primitive or a group of them.
+    /// </summary>
+    class QBox
+    {
+        // METHODS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Makes the box empty, so the next merged point or box becomes the whole box.
+        /// </summary>
+        void Reset()
+        {
+            Min[0] = Min[1] = Min[2] = SQFloat::MaxFloat_Q;
+            Max[0] = Max[1] = Max[2] = -SQFloat::MaxFloat_Q;
+        }
+
+        /// <summary>
+        /// Enlarges the box so it contains a point.
+        /// </summary>
+        /// <param name="vPoint">[IN] The point to enclose.</param>
+        void Merge(const QBaseVector3 &vPoint)
+        {
+            Min[0] = vPoint.x < Min[0] ? vPoint.x : Min[0];
+            Min[1] = vPoint.y < Min[1] ? vPoint.y : Min[1];
+            Min[2] = vPoint.z < Min[2] ? vPoint.z : Min[2];
+            Max[0] = vPoint.x > Max[0] ? vPoint.x : Max[0];
+            Max[1] = vPoint.y > Max[1] ? vPoint.y : Max[1];
+            Max[2] = vPoint.z > Max[2] ? vPoint.z : Max[2];
+        }
+
+        /// <summary>
+        /// Enlarges the box so it contains another box.
+        /// </summary>
+        /// <param name="box">[IN] The box to enclose.</param>
+        void Merge(const QBox &box)
+        {
+            for(unsigned int i = 0; i < 3U; ++i)
+            {
+                Min[i] = box.Min[i] < Min[i] ? box.Min[i] : Min[i];
+                Max[i] = box.Max[i] > Max[i] ? box.Max[i] : Max[i];
+            }
+        }
+
+        /// <summary>
+        /// Checks whether the box and another box overlap. Touching boxes overlap.
+        /// </summary>
+        /// <param name="box">[IN] The other box.</param>
+        /// <returns>
+        /// True if the boxes overlap; False otherwise.
+        /// </returns>
+        bool Overlaps(const QBox &box) const
+        {
+            return SQFloat::IsLessOrEquals(Min[0], box.Max[0]) && SQFloat::IsLessOrEquals(box.Min[0], Max[0]) &&
+                   SQFloat::IsLessOrEquals(Min[1], box.Max[1]) && SQFloat::IsLessOrEquals(box.Min[1], Max[1]) &&
+                   SQFloat::IsLessOrEquals(Min[2], box.Max[2]) && SQFloat::IsLessOrEquals(box.Min[2], Max[2]);
+        }
+
+        /// <summary>
+        /// Calculates half the area of the surface of the box, which is all the SAH needs to compare boxes.
+        /// </summary>
+        /// <returns>
+        /// Half the area of the box.
+        /// </returns>
+        float_q GetHalfArea() const
+        {
+            const float_q SIZE_X = Max[0] - Min[0];
+            const float_q SIZE_Y = Max[1] - Min[1];
+            const float_q SIZE_Z = Max[2] - Min[2];
+            return SIZE_X * SIZE_Y + SIZE_Y * SIZE_Z + SIZE_Z * SIZE_X;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The minimum X, Y and Z coordinates.
+        /// </summary>
+        float_q Min[3];
+
+        /// <summary>
+        /// The maximum X, Y and Z coordinates.
+        /// </summary>
+        float_q Max[3];
+    };
+
+    /// <summary>
+    /// Node of the tree. Leaves refer to a range of primitives and the rest of nodes have two children, the first of which is the next node 
+    /// in the array.
+    /// </summary>
+    class QNode
+    {
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Indicates whether the node is a leaf.
+        /// </summary>
+        /// <returns>
+        /// True if the node contains primitives; False if it has children.
+        /// </returns>
+        bool IsLeaf() const
+        {
+            return Count != 0;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The box that encloses all the primitives under the node.
+        /// </summary>
+        QBox Bounds;
+
+        /// <summary>
+        /// In leaves, the position of the first primitive; otherwise, the position of the second child.
+        /// </summary>
+        u32_q Offset;
+
+        /// <summary>
+        /// The number of primitives in leaves; zero otherwise.
+        /// </summary>
+        u32_q Count;
+    };
+
+    /// <summary>
+    /// Range of primitives pending to be turned into a node while the tree is being built.
+    /// </summary>
+    class QBuildTask
+    {
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The position of the first primitive of the range.
+        /// </summary>
+        u32_q First;
+
+        /// <summary>
+        /// The position after the last primitive of the range.
+        /// </summary>
+        u32_q End;
+
+        /// <summary>
+        /// The node whose second child will be the new node, or NO_PARENT if it is a first child or the root.
+        /// </summary>
+        u32_q Parent;
+
+        /// <summary>
+        /// The depth of the new node.
+        /// </summary>
+        u32_q Depth;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The maximum number of primitives per leaf. Bigger ranges are split even if the SAH says it is not worth it.
+    /// </summary>
+    static const u32_q MAX_LEAF_SIZE = 4U;
+
+    /// <summary>
+    /// The number of intervals in which the centroids are classified along every axis when searching for the best split.
+    /// </summary>
+    static const u32_q SAH_BIN_COUNT = 12U;
+
+    /// <summary>
+    /// The depth from which ranges are split in halves instead of using the SAH, which keeps the tree shallow for pathological distributions.
+    /// </summary>
+    static const u32_q SAH_MAX_DEPTH = 64U;
+
+    /// <summary>
+    /// The capacity of the stack used when traversing the tree, which is greater than the maximum depth the tree can reach.
+    /// </summary>
+    static const u32_q TRAVERSAL_STACK_SIZE = 128U;
+
+    /// <summary>
+    /// Value of QBuildTask::Parent for first children and for the root.
+    /// </summary>
+    static const u32_q NO_PARENT = 0xFFFFFFFFU;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the primitives, which are copied, and builds the tree.
+    /// </summary>
+    /// <param name="arPrimitives">[IN] The primitives to store. It must not be null unless the number of primitives is zero.</param>
+    /// <param name="uCount">[IN] The number of primitives. It can be zero, although no query will find anything then.</param>
+    QBoundingVolumeHierarchy(const PrimitiveT* arPrimitives, const unsigned int uCount) : 
+                                                                    m_arPrimitives(null_q),
+                                                                    m_arPrimitiveIndices(null_q),
+                                                                    m_arNodes(null_q),
+                                                                    m_uPrimitiveCount(uCount),
+                                                                    m_uNodeCount(0)
+    {
+        QE_ASSERT_ERROR(null_q != arPrimitives || uCount == 0, "The input array of primitives cannot be null");
+
+        if(uCount > 0)
+            this->Build(arPrimitives);
+    }
+
+private:
+
+    // Disabled.
+    QBoundingVolumeHierarchy(const QBoundingVolumeHierarchy &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It frees the memory occupied by the nodes and the copy of the primitives.
+    /// </summary>
+    ~QBoundingVolumeHierarchy()
+    {
+        delete[] m_arPrimitives;
+        delete[] m_arPrimitiveIndices;
+        delete[] m_arNodes;
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Disabled.
+    QBoundingVolumeHierarchy& operator=(const QBoundingVolumeHierarchy &);
+
+public:
+
+    /// <summary>
+    /// Replaces the primitives and updates the bounding boxes of all the nodes, keeping the structure of the tree.
+    /// </summary>
+    /// <remarks>
+    /// This is much faster than building a new hierarchy and is intended for primitives that move slightly every frame. The queries
+    /// are always correct but they get slower as primitives that were close when the tree was built separate from each other.
+    /// </remarks>
+    /// <param name="arPrimitives">[IN] The new primitives, in the same order as the ones passed to the constructor. It must contain as 
+    /// many primitives as the hierarchy. It must not be null unless the hierarchy is empty.</param>
+    void Refit(const PrimitiveT* arPrimitives)
+    {
+        QE_ASSERT_ERROR(null_q != arPrimitives || m_uPrimitiveCount == 0, "The input array of primitives cannot be null");
+
+        for(u32_q i = 0; i < m_uPrimitiveCount; ++i)
+            m_arPrimitives[i] = arPrimitives[m_arPrimitiveIndices[i]];
+
+        // Children are always placed after their parents, so they are updated first
+        for(u32_q uNode = m_uNodeCount; uNode > 0; --uNode)
+        {
+            QNode &node = m_arNodes[uNode - 1U];
+
+            if(node.IsLeaf())
+            {
+                node.Bounds.Reset();
+
+                for(u32_q i = node.Offset; i < node.Offset + node.Count; ++i)
+                    node.Bounds.Merge(QBoundingVolumeHierarchy::GetBounds(m_arPrimitives[i]));
+            }
+            else
+            {
+                node.Bounds = m_arNodes[uNode].Bounds;
+                node.Bounds.Merge(m_arNodes[node.Offset].Bounds);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Searches for the primitive whose intersection with a ray is the closest to the origin of the ray.
+    /// </summary>
+    /// <remarks>
+    /// If the origin of the ray is inside a hexahedron, the distance to that hexahedron is zero. Triangles that are coplanar to the ray are 
+    /// not considered to intersect it.
+    /// </remarks>
+    /// <param name="ray">[IN] The ray. Its direction must be normalized.</param>
+    /// <param name="uPrimitive">[OUT] The position, in the array passed to the constructor, of the primitive that was hit. It is not modified if 
+    /// nothing is hit.</param>
+    /// <param name="fDistance">[OUT] The distance from the origin of the ray to the intersection point. It is not modified if nothing is hit.</param>
+    /// <returns>
+    /// True if any primitive intersects the ray; False otherwise.
+    /// </returns>
+    bool FindClosestIntersection(const QBaseRay<QVector3, QVector3> &ray, unsigned int &uPrimitive, float_q &fDistance) const
+    {
+        QE_ASSERT_WARNING(!ray.Direction.IsZero(), "The direction of the ray must not be null");
+
+        return this->FindClosestIntersection(QRay3D<QVector3>(ray), SQFloat::MaxFloat_Q, uPrimitive, fDistance);
+    }
+
+    /// <summary>
+    /// Searches for the primitive whose intersection with a line segment is the closest to the endpoint A.
+    /// </summary>
+    /// <remarks>
+    /// If the endpoint A is inside a hexahedron, the distance to that hexahedron is zero. Triangles that are coplanar to the line segment are 
+    /// not considered to intersect it.
+    /// </remarks>
+    /// <param name="segment">[IN] The line segment. Its endpoints must not coincide.</param>
+    /// <param name="uPrimitive">[OUT] The position, in the array passed to the constructor, of the primitive that was hit. It is not modified if 
+    /// nothing is hit.</param>
+    /// <param name="fDistance">[OUT] The distance from the endpoint A to the intersection point. It is not modified if nothing is hit.</param>
+    /// <returns>
+    /// True if any primitive intersects the line segment; False otherwise.
+    /// </returns>
+    bool FindClosestIntersection(const QBaseLineSegment<QVector3> &segment, unsigned int &uPrimitive, float_q &fDistance) const
+    {
+        QE_ASSERT_WARNING(segment.A != segment.B, "The endpoints of the line segment must not coincide");
+
+        const QVector3 A_TO_B = segment.B - segment.A;
+        return this->FindClosestIntersection(QRay3D<QVector3>(segment.A, A_TO_B.Normalize()), A_TO_B.GetLength(), uPrimitive, fDistance);
+    }
+
+    /// <summary>
+    /// Searches for all the primitives that intersect a ray.
+    /// </summary>
+    /// <remarks>
+    /// Triangles that are coplanar to the ray are not considered to intersect it.
+    /// </remarks>
+    /// <param name="ray">[IN] The ray. Its direction must be normalized.</param>
+    /// <param name="arPrimitives">[OUT] The array to which the positions of the primitives, in the array passed to the constructor, are added.
+    /// Its previous content is kept. The primitives are not sorted.</param>
+    /// <returns>
+    /// The number of primitives found.
+    /// </returns>
+    unsigned int FindIntersections(const QBaseRay<QVector3, QVector3> &ray, QArrayDynamic<unsigned int> &arPrimitives) const
+    {
+        QE_ASSERT_WARNING(!ray.Direction.IsZero(), "The direction of the ray must not be null");
+
+        return this->FindIntersections(QRay3D<QVector3>(ray), SQFloat::MaxFloat_Q, arPrimitives);
+    }
+
+    /// <summary>
+    /// Searches for all the primitives that intersect a line segment.
+    /// </summary>
+    /// <remarks>
+    /// Triangles that are coplanar to the line segment are not considered to intersect it.
+    /// </remarks>
+    /// <param name="segment">[IN] The line segment. Its endpoints must not coincide.</param>
+    /// <param name="arPrimitives">[OUT] The array to which the positions of the primitives, in the array passed to the constructor, are added.
+    /// Its previous content is kept. The primitives are not sorted.</param>
+    /// <returns>
+    /// The number of primitives found.
+    /// </returns>
+    unsigned int FindIntersections(const QBaseLineSegment<QVector3> &segment, QArrayDynamic<unsigned int> &arPrimitives) const
+    {
+        QE_ASSERT_WARNING(segment.A != segment.B, "The endpoints of the line segment must not coincide");
+
+        const QVector3 A_TO_B = segment.B - segment.A;
+        return this->FindIntersections(QRay3D<QVector3>(segment.A, A_TO_B.Normalize()), A_TO_B.GetLength(), arPrimitives);
+    }
+
+    /// <summary>
+    /// Searches for all the primitives that intersect an orb, including those which are completely contained in it or contain it.
+    /// </summary>
+    /// <param name="orb">[IN] The orb.</param>
+    /// <param name="arPrimitives">[OUT] The array to which the positions of the primitives, in the array passed to the constructor, are added.
+    /// Its previous content is kept. The primitives are not sorted.</param>
+    /// <returns>
+    /// The number of primitives found.
+    /// </returns>
+    unsigned int FindIntersections(const QBaseOrb<QVector3> &orb, QArrayDynamic<unsigned int> &arPrimitives) const
+    {
+        QE_ASSERT_WARNING(SQFloat::IsGreaterOrEquals(orb.Radius, SQFloat::_0), "The radius of the orb must not be negative");
+
+        const u32_q PREVIOUS_COUNT = scast_q(arPrimitives.GetCount(), u32_q);
+        const float_q SQUARED_RADIUS = orb.Radius * orb.Radius;
+        const float_q CENTER[3] = { orb.Center.x, orb.Center.y, orb.Center.z };
+
+        u32_q arStack[TRAVERSAL_STACK_SIZE];
+        u32_q uStackSize = m_uNodeCount > 0 ? 1U : 0;
+        arStack[0] = 0;
+
+        while(uStackSize > 0)
+        {
+            const u32_q NODE_INDEX = arStack[--uStackSize];
+            const QNode &NODE = m_arNodes[NODE_INDEX];
+
+            // Squared distance from the center to the closest point of the box
+            float_q fSquaredDistance = SQFloat::_0;
+
+            for(unsigned int i = 0; i < 3U; ++i)
+            {
+                const float_q OUTSIDE = CENTER[i] < NODE.Bounds.Min[i] ? NODE.Bounds.Min[i] - CENTER[i] :
+                                        CENTER[i] > NODE.Bounds.Max[i] ? CENTER[i] - NODE.Bounds.Max[i] :
+                                                                           SQFloat::_0;
+                fSquaredDistance += OUTSIDE * OUTSIDE;
+            }
+
+            if(SQFloat::IsGreaterThan(fSquaredDistance, SQUARED_RADIUS))
+                continue;
+
+            if(NODE.IsLeaf())
+            {
+                for(u32_q i = NODE.Offset; i < NODE.Offset + NODE.Count; ++i)
+                    if(QBoundingVolumeHierarchy::Intersection(m_arPrimitives[i], orb))
+                        arPrimitives.Add(m_arPrimitiveIndices[i]);
+            }
+            else
+            {
+                arStack[uStackSize++] = NODE.Offset;
+                arStack[uStackSize++] = NODE_INDEX + 1U;
+            }
+        }
+
+        return scast_q(arPrimitives.GetCount(), u32_q) - PREVIOUS_COUNT;
+    }
+
+    /// <summary>
+    /// Searches for all the primitives that intersect a hexahedron, including those which are completely contained in it or contain it.
+    /// </summary>
+    /// <param name="hexahedron">[IN] The hexahedron. It must be convex and its vertices must not coincide.</param>
+    /// <param name="arPrimitives">[OUT] The array to which the positions of the primitives, in the array passed to the constructor, are added.
+    /// Its previous content is kept. The primitives are not sorted.</param>
+    /// <returns>
+    /// The number of primitives found.
+    /// </returns>
+    unsigned int FindIntersections(const QBaseHexahedron<QVector3> &hexahedron, QArrayDynamic<unsigned int> &arPrimitives) const
+    {
+        const u32_q PREVIOUS_COUNT = scast_q(arPrimitives.GetCount(), u32_q);
+        const QBox HEXAHEDRON_BOUNDS = QBoundingVolumeHierarchy::GetBounds(hexahedron);
+
+        u32_q arStack[TRAVERSAL_STACK_SIZE];
+        u32_q uStackSize = m_uNodeCount > 0 ? 1U : 0;
+        arStack[0] = 0;
+
+        while(uStackSize > 0)
+        {
+            const u32_q NODE_INDEX = arStack[--uStackSize];
+            const QNode &NODE = m_arNodes[NODE_INDEX];
+
+            if(!NODE.Bounds.Overlaps(HEXAHEDRON_BOUNDS))
+                continue;
+
+            if(NODE.IsLeaf())
+            {
+                for(u32_q i = NODE.Offset; i < NODE.Offset + NODE.Count; ++i)
+                    if(QBoundingVolumeHierarchy::Intersection(m_arPrimitives[i], hexahedron))
+                        arPrimitives.Add(m_arPrimitiveIndices[i]);
+            }
+            else
+            {
+                arStack[uStackSize++] = NODE.Offset;
+                arStack[uStackSize++] = NODE_INDEX + 1U;
+            }
+        }
+
+        return scast_q(arPrimitives.GetCount(), u32_q) - PREVIOUS_COUNT;
+    }
+
+private:
+
+    /// <summary>
+    /// Builds the tree and stores the primitives sorted by leaf.
+    /// </summary>
+    /// <remarks>
+    /// Every range of primitives is split by the plane, perpendicular to an axis, that minimizes the sum of the areas of both halves weighted 
+    /// by their number of primitives, which is estimated by classifying the centroids into SAH_BIN_COUNT intervals per axis. The range becomes 
+    /// a leaf when splitting it would cost more than checking all its primitives.
+    /// </remarks>
+    /// <param name="arPrimitives">[IN] The primitives to store. There must be m_uPrimitiveCount primitives.</param>
+    void Build(const PrimitiveT* arPrimitives)
+    {
+        // The bounds and the centroids are only needed while building
+        QBox* arBounds = new QBox[m_uPrimitiveCount];
+        QBaseVector3* arCentroids = new QBaseVector3[m_uPrimitiveCount];
+        QBuildTask* arTasks = new QBuildTask[m_uPrimitiveCount];
+
+        m_arPrimitiveIndices = new u32_q[m_uPrimitiveCount];
+        m_arNodes = new QNode[2U * m_uPrimitiveCount - 1U];
+
+        for(u32_q i = 0; i < m_uPrimitiveCount; ++i)
+        {
+            arBounds[i] = QBoundingVolumeHierarchy::GetBounds(arPrimitives[i]);
+            arCentroids[i] = QBaseVector3((arBounds[i].Min[0] + arBounds[i].Max[0]) * SQFloat::_0_5,
+                                          (arBounds[i].Min[1] + arBounds[i].Max[1]) * SQFloat::_0_5,
+                                          (arBounds[i].Min[2] + arBounds[i].Max[2]) * SQFloat::_0_5);
+            m_arPrimitiveIndices[i] = i;
+        }
+
+        arTasks[0].First = 0;
+        arTasks[0].End = m_uPrimitiveCount;
+        arTasks[0].Parent = NO_PARENT;
+        arTasks[0].Depth = 0;
+        u32_q uTaskCount = 1U;
+
+        while(uTaskCount > 0)
+        {
+            const QBuildTask TASK = arTasks[--uTaskCount];
+            const u32_q NODE_INDEX = m_uNodeCount++;
+            QNode &node = m_arNodes[NODE_INDEX];
+
+            if(TASK.Parent != NO_PARENT)
+                m_arNodes[TASK.Parent].Offset = NODE_INDEX;
+
+            QBox centroidBounds;
+            node.Bounds.Reset();
+            centroidBounds.Reset();
+
+            for(u32_q i = TASK.First; i < TASK.End; ++i)
+            {
+                node.Bounds.Merge(arBounds[m_arPrimitiveIndices[i]]);
+                centroidBounds.Merge(arCentroids[m_arPrimitiveIndices[i]]);
+            }
+
+            const u32_q SPLIT = QBoundingVolumeHierarchy::Split(TASK, node.Bounds, centroidBounds, arBounds, arCentroids, m_arPrimitiveIndices);
+
+            if(SPLIT == TASK.End)
+            {
+                node.Offset = TASK.First;
+                node.Count = TASK.End - TASK.First;
+            }
+            else
+            {
+                node.Count = 0;
+
+                // The first child is processed first so it is placed right after its parent
+                arTasks[uTaskCount].First = SPLIT;
+                arTasks[uTaskCount].End = TASK.End;
+                arTasks[uTaskCount].Parent = NODE_INDEX;
+                arTasks[uTaskCount].Depth = TASK.Depth + 1U;
+                ++uTaskCount;
+
+                arTasks[uTaskCount].First = TASK.First;
+                arTasks[uTaskCount].End = SPLIT;
+                arTasks[uTaskCount].Parent = NO_PARENT;
+                arTasks[uTaskCount].Depth = TASK.Depth + 1U;
+                ++uTaskCount;
+            }
+        }
+
+        m_arPrimitives = new PrimitiveT[m_uPrimitiveCount];
+
+        for(u32_q i = 0; i < m_uPrimitiveCount; ++i)
+            m_arPrimitives[i] = arPrimitives[m_arPrimitiveIndices[i]];
+
+        delete[] arBounds;
+        delete[] arCentroids;
+        delete[] arTasks;
+    }
+
+    /// <summary>
+    /// Decides whether a range of primitives must be split and, if so, reorders it so the primitives of every half are contiguous.
+    /// </summary>
+    /// <param name="task">[IN] The range of primitives.</param>
+    /// <param name="bounds">[IN] The box that encloses all the primitives of the range.</param>
+    /// <param name="centroidBounds">[IN] The box that encloses the centroids of all the primitives of the range.</param>
+    /// <param name="arBounds">[IN] The boxes that enclose every primitive.</param>
+    /// <param name="arCentroids">[IN] The centroids of all the primitives.</param>
+    /// <param name="arPrimitiveIndices">[IN/OUT] The positions of the primitives, which are reordered.</param>
+    /// <returns>
+    /// The position of the first primitive of the second half, or the end of the range if it must not be split.
+    /// </returns>
+    static u32_q Split(const QBuildTask &task, const QBox &bounds, const QBox &centroidBounds, const QBox* arBounds, const QBaseVector3* arCentroids,
+                       u32_q* arPrimitiveIndices)
+    {
+        const u32_q COUNT = task.End - task.First;
+
+        if(COUNT == 1U)
+            return task.End;
+
+        // Beyond the maximum depth, or when the SAH cannot separate the centroids, ranges are split in halves so the depth never exceeds
+        // SAH_MAX_DEPTH + log2(count) and the traversal stack does not overflow
+        if(task.Depth >= SAH_MAX_DEPTH)
+            return COUNT > MAX_LEAF_SIZE ? task.First + COUNT / 2U : task.End;
+
+        float_q fBestCost = SQFloat::MaxFloat_Q;
+        unsigned int uBestAxis = 0;
+        u32_q uBestBin = 0;
+
+        for(unsigned int uAxis = 0; uAxis < 3U; ++uAxis)
+        {
+            const float_q EXTENT = centroidBounds.Max[uAxis] - centroidBounds.Min[uAxis];
+
+            if(SQFloat::IsZero(EXTENT))
+                continue;
+
+            QBox arBinBounds[SAH_BIN_COUNT];
+            u32_q arBinCounts[SAH_BIN_COUNT];
+
+            for(u32_q i = 0; i < SAH_BIN_COUNT; ++i)
+            {
+                arBinBounds[i].Reset();
+                arBinCounts[i] = 0;
+            }
+
+            for(u32_q i = task.First; i < task.End; ++i)
+            {
+                const u32_q BIN = QBoundingVolumeHierarchy::GetBin(arCentroids[arPrimitiveIndices[i]], uAxis, centroidBounds, EXTENT);
+                arBinBounds[BIN].Merge(arBounds[arPrimitiveIndices[i]]);
+                ++arBinCounts[BIN];
+            }
+
+            // The cost of the second half is accumulated from the last bin backwards
+            float_q arSecondHalfCosts[SAH_BIN_COUNT];
+            QBox accumulatedBounds;
+            accumulatedBounds.Reset();
+            u32_q uAccumulatedCount = 0;
+
+            for(u32_q i = SAH_BIN_COUNT - 1U; i > 0; --i)
+            {
+                uAccumulatedCount += arBinCounts[i];
+
+                if(arBinCounts[i] > 0)
+                    accumulatedBounds.Merge(arBinBounds[i]);
+
+                arSecondHalfCosts[i] = uAccumulatedCount > 0 ? accumulatedBounds.GetHalfArea() * scast_q(uAccumulatedCount, float_q) : SQFloat::_0;
+            }
+
+            accumulatedBounds.Reset();
+            uAccumulatedCount = 0;
+
+            for(u32_q i = 0; i < SAH_BIN_COUNT - 1U; ++i)
+            {
+                uAccumulatedCount += arBinCounts[i];
+
+                if(arBinCounts[i] > 0)
+                    accumulatedBounds.Merge(arBinBounds[i]);
+
+                if(uAccumulatedCount == 0 || uAccumulatedCount == COUNT)
+                    continue;
+
+                const float_q COST = accumulatedBounds.GetHalfArea() * scast_q(uAccumulatedCount, float_q) + arSecondHalfCosts[i + 1U];
+
+                if(COST < fBestCost)
+                {
+                    fBestCost = COST;
+                    uBestAxis = uAxis;
+                    uBestBin = i;
+                }
+            }
+        }
+
+        if(fBestCost == SQFloat::MaxFloat_Q)
+            return COUNT > MAX_LEAF_SIZE ? task.First + COUNT / 2U : task.End;
+
+        // Traversing a node costs as much as checking a primitive, relative to the area of the range
+        const float_q PARENT_AREA = bounds.GetHalfArea();
+        const bool IS_WORTH_SPLITTING = PARENT_AREA + fBestCost < PARENT_AREA * scast_q(COUNT, float_q);
+
+        if(!IS_WORTH_SPLITTING && COUNT <= MAX_LEAF_SIZE)
+            return task.End;
+
+        const float_q EXTENT = centroidBounds.Max[uBestAxis] - centroidBounds.Min[uBestAxis];
+        u32_q uFirst = task.First;
+        u32_q uLast = task.End;
+
+        while(uFirst < uLast)
+        {
+            if(QBoundingVolumeHierarchy::GetBin(arCentroids[arPrimitiveIndices[uFirst]], uBestAxis, centroidBounds, EXTENT) <= uBestBin)
+            {
+                ++uFirst;
+            }
+            else
+            {
+                --uLast;
+                const u32_q AUX = arPrimitiveIndices[uFirst];
+                arPrimitiveIndices[uFirst] = arPrimitiveIndices[uLast];
+                arPrimitiveIndices[uLast] = AUX;
+            }
+        }
+
+        return uFirst;
+    }
+
+    /// <summary>
+    /// Searches for the primitive whose intersection with a ray is the closest to the origin of the ray, ignoring those which are farther
+    /// than a given distance.
+    /// </summary>
+    /// <remarks>
+    /// The children whose boxes are closer to the origin of the ray are visited first, and nodes farther than the closest intersection 
+    /// found so far are discarded.
+    /// </remarks>
+    /// <param name="ray">[IN] The ray, whose direction is normalized.</param>
+    /// <param name="fMaxDistance">[IN] The maximum distance from the origin of the ray.</param>
+    /// <param name="uPrimitive">[OUT] The position, in the array passed to the constructor, of the primitive that was hit.</param>
+    /// <param name="fDistance">[OUT] The distance from the origin of the ray to the intersection point.</param>
+    /// <returns>
+    /// True if any primitive intersects the ray; False otherwise.
+    /// </returns>
+    bool FindClosestIntersection(const QRay3D<QVector3> &ray, const float_q fMaxDistance, unsigned int &uPrimitive, float_q &fDistance) const
+    {
+        const float_q ORIGIN[3] = { ray.Origin.x, ray.Origin.y, ray.Origin.z };
+        const float_q DIRECTION[3] = { ray.Direction.x, ray.Direction.y, ray.Direction.z };
+        float_q arInverseDirection[3];
+        QBoundingVolumeHierarchy::GetInverseDirection(DIRECTION, arInverseDirection);
+
+        bool bFound = false;
+        float_q fClosestDistance = fMaxDistance;
+        u32_q uClosestPrimitive = 0;
+
+        u32_q arStack[TRAVERSAL_STACK_SIZE];
+        float_q arStackDistances[TRAVERSAL_STACK_SIZE];
+        u32_q uStackSize = 0;
+        float_q fNear = SQFloat::_0;
+
+        if(m_uNodeCount > 0 && QBoundingVolumeHierarchy::Intersection(m_arNodes[0].Bounds, ORIGIN, DIRECTION, arInverseDirection, fMaxDistance, fNear))
+        {
+            arStack[0] = 0;
+            arStackDistances[0] = fNear;
+            uStackSize = 1U;
+        }
+
+        while(uStackSize > 0)
+        {
+            --uStackSize;
+
+            // The node may have been pushed before finding a closer intersection
+            if(bFound && arStackDistances[uStackSize] > fClosestDistance)
+                continue;
+
+            const u32_q NODE_INDEX = arStack[uStackSize];
+            const QNode &NODE = m_arNodes[NODE_INDEX];
+
+            if(NODE.IsLeaf())
+            {
+                for(u32_q i = NODE.Offset; i < NODE.Offset + NODE.Count; ++i)
+                {
+                    float_q fPrimitiveDistance = SQFloat::_0;
+
+                    if(QBoundingVolumeHierarchy::Intersection(m_arPrimitives[i], ray, fPrimitiveDistance) &&
+                       (bFound ? fPrimitiveDistance < fClosestDistance : SQFloat::IsLessOrEquals(fPrimitiveDistance, fMaxDistance)))
+                    {
+                        bFound = true;
+                        fClosestDistance = fPrimitiveDistance;
+                        uClosestPrimitive = i;
+                    }
+                }
+            }
+            else
+            {
+                const u32_q FIRST_CHILD = NODE_INDEX + 1U;
+                const u32_q SECOND_CHILD = NODE.Offset;
+                float_q fFirstNear = SQFloat::_0;
+                float_q fSecondNear = SQFloat::_0;
+                const bool HITS_FIRST = QBoundingVolumeHierarchy::Intersection(m_arNodes[FIRST_CHILD].Bounds, ORIGIN, DIRECTION, arInverseDirection, fClosestDistance, fFirstNear);
+                const bool HITS_SECOND = QBoundingVolumeHierarchy::Intersection(m_arNodes[SECOND_CHILD].Bounds, ORIGIN, DIRECTION, arInverseDirection, fClosestDistance, fSecondNear);
+
+                // The closest child is pushed last so it is visited first
+                if(HITS_FIRST && HITS_SECOND && fSecondNear < fFirstNear)
+                {
+                    arStack[uStackSize] = FIRST_CHILD;
+                    arStackDistances[uStackSize++] = fFirstNear;
+                    arStack[uStackSize] = SECOND_CHILD;
+                    arStackDistances[uStackSize++] = fSecondNear;
+                }
+                else
+                {
+                    if(HITS_SECOND)
+                    {
+                        arStack[uStackSize] = SECOND_CHILD;
+                        arStackDistances[uStackSize++] = fSecondNear;
+                    }
+
+                    if(HITS_FIRST)
+                    {
+                        arStack[uStackSize] = FIRST_CHILD;
+                        arStackDistances[uStackSize++] = fFirstNear;
+                    }
+                }
+            }
+        }
+
+        if(bFound)
+        {
+            uPrimitive = m_arPrimitiveIndices[uClosestPrimitive];
+            fDistance = fClosestDistance;
+        }
+
+        return bFound;
+    }
+
+    /// <summary>
+    /// Searches for all the primitives that intersect a ray, ignoring those which are farther than a given distance.
+    /// </summary>
+    /// <param name="ray">[IN] The ray, whose direction is normalized.</param>
+    /// <param name="fMaxDistance">[IN] The maximum distance from the origin of the ray.</param>
+    /// <param name="arPrimitives">[OUT] The array to which the positions of the primitives are added.</param>
+    /// <returns>
+    /// The number of primitives found.
+    /// </returns>
+    unsigned int FindIntersections(const QRay3D<QVector3> &ray, const float_q fMaxDistance, QArrayDynamic<unsigned int> &arPrimitives) const
+    {
+        const float_q ORIGIN[3] = { ray.Origin.x, ray.Origin.y, ray.Origin.z };
+        const float_q DIRECTION[3] = { ray.Direction.x, ray.Direction.y, ray.Direction.z };
+        float_q arInverseDirection[3];
+        QBoundingVolumeHierarchy::GetInverseDirection(DIRECTION, arInverseDirection);
+
+        const u32_q PREVIOUS_COUNT = scast_q(arPrimitives.GetCount(), u32_q);
+
+        u32_q arStack[TRAVERSAL_STACK_SIZE];
+        u32_q uStackSize = m_uNodeCount > 0 ? 1U : 0;
+        arStack[0] = 0;
+
+        while(uStackSize > 0)
+        {
+            const u32_q NODE_INDEX = arStack[--uStackSize];
+            const QNode &NODE = m_arNodes[NODE_INDEX];
+            float_q fNear = SQFloat::_0;
+
+            if(!QBoundingVolumeHierarchy::Intersection(NODE.Bounds, ORIGIN, DIRECTION, arInverseDirection, fMaxDistance, fNear))
+                continue;
+
+            if(NODE.IsLeaf())
+            {
+                for(u32_q i = NODE.Offset; i < NODE.Offset + NODE.Count; ++i)
+                {
+                    float_q fPrimitiveDistance = SQFloat::_0;
+
+                    if(QBoundingVolumeHierarchy::Intersection(m_arPrimitives[i], ray, fPrimitiveDistance) && 
+                       SQFloat::IsLessOrEquals(fPrimitiveDistance, fMaxDistance))
+                        arPrimitives.Add(m_arPrimitiveIndices[i]);
+                }
+            }
+            else
+            {
+                arStack[uStackSize++] = NODE.Offset;
+                arStack[uStackSize++] = NODE_INDEX + 1U;
+            }
+        }
+
+        return scast_q(arPrimitives.GetCount(), u32_q) - PREVIOUS_COUNT;
+    }
+
+    /// <summary>
+    /// Calculates the inverse of every component of the direction of a ray, used to intersect it with boxes.
+    /// </summary>
+    /// <param name="arDirection">[IN] The X, Y and Z components of the direction.</param>
+    /// <param name="arInverseDirection">[OUT] The inverse of every component, or zero for the components that are exactly zero.</param>
+    static void GetInverseDirection(const float_q* arDirection, float_q* arInverseDirection)
+    {
+        for(unsigned int i = 0; i < 3U; ++i)
+            arInverseDirection[i] = arDirection[i] == SQFloat::_0 ? SQFloat::_0 : SQFloat::_1 / arDirection[i];
+    }
+
+    /// <summary>
+    /// Checks whether a ray intersects a box before a given distance (slab method).
+    /// </summary>
+    /// <param name="box">[IN] The box.</param>
+    /// <param name="arOrigin">[IN] The X, Y and Z components of the origin of the ray.</param>
+    /// <param name="arDirection">[IN] The X, Y and Z components of the direction of the ray.</param>
+    /// <param name="arInverseDirection">[IN] The inverse of the components of the direction of the ray.</param>
+    /// <param name="fMaxDistance">[IN] The maximum distance from the origin of the ray.</param>
+    /// <param name="fNear">[OUT] The distance from the origin of the ray to the point where it enters the box, or zero if the origin is inside.</param>
+    /// <returns>
+    /// True if the ray intersects the box; False otherwise.
+    /// </returns>
+    static bool Intersection(const QBox &box, const float_q* arOrigin, const float_q* arDirection, const float_q* arInverseDirection, 
+                             const float_q fMaxDistance, float_q &fNear)
+    {
+        float_q fEnter = SQFloat::_0;
+        float_q fExit = fMaxDistance;
+
+        for(unsigned int i = 0; i < 3U; ++i)
+        {
+            // Only exact zeros are treated as parallel; tiny components produce big but valid distances
+            if(arDirection[i] == SQFloat::_0)
+            {
+                if(SQFloat::IsLessThan(arOrigin[i], box.Min[i]) || SQFloat::IsGreaterThan(arOrigin[i], box.Max[i]))
+                    return false;
+            }
+            else
+            {
+                const float_q DISTANCE_TO_MIN = (box.Min[i] - arOrigin[i]) * arInverseDirection[i];
+                const float_q DISTANCE_TO_MAX = (box.Max[i] - arOrigin[i]) * arInverseDirection[i];
+                const bool IS_MIN_CLOSER = DISTANCE_TO_MIN < DISTANCE_TO_MAX;
+                const float_q SLAB_ENTER = IS_MIN_CLOSER ? DISTANCE_TO_MIN : DISTANCE_TO_MAX;
+                const float_q SLAB_EXIT = IS_MIN_CLOSER ? DISTANCE_TO_MAX : DISTANCE_TO_MIN;
+
+                fEnter = SLAB_ENTER > fEnter ? SLAB_ENTER : fEnter;
+                fExit = SLAB_EXIT < fExit ? SLAB_EXIT : fExit;
+            }
+        }
+
+        fNear = fEnter;
+        return SQFloat::IsLessOrEquals(fEnter, fExit);
+    }
+
+    /// <summary>
+    /// Calculates the interval of the SAH in which a centroid falls along an axis.
+    /// </summary>
+    /// <param name="vCentroid">[IN] The centroid.</param>
+    /// <param name="uAxis">[IN] The axis: 0 for X, 1 for Y and 2 for Z.</param>
+    /// <param name="centroidBounds">[IN] The box that encloses all the centroids of the range being split.</param>
+    /// <param name="fExtent">[IN] The size of the box of the centroids along the axis. It must not be zero.</param>
+    /// <returns>
+    /// The index of the interval, lower than SAH_BIN_COUNT.
+    /// </returns>
+    static u32_q GetBin(const QBaseVector3 &vCentroid, const unsigned int uAxis, const QBox &centroidBounds, const float_q fExtent)
+    {
+        const float_q COMPONENT = uAxis == 0 ? vCentroid.x : uAxis == 1U ? vCentroid.y : vCentroid.z;
+        const u32_q BIN = scast_q((COMPONENT - centroidBounds.Min[uAxis]) * scast_q(SAH_BIN_COUNT, float_q) / fExtent, u32_q);
+        return BIN < SAH_BIN_COUNT ? BIN : SAH_BIN_COUNT - 1U;
+    }
+
+    /// <summary>
+    /// Calculates the box that encloses a triangle.
+    /// </summary>
+    /// <param name="triangle">[IN] The triangle.</param>
+    /// <returns>
+    /// The box that encloses the triangle.
+    /// </returns>
+    static QBox GetBounds(const QBaseTriangle<QVector3> &triangle)
+    {
+        QBox bounds;
+        bounds.Reset();
+        bounds.Merge(triangle.A);
+        bounds.Merge(triangle.B);
+        bounds.Merge(triangle.C);
+        return bounds;
+    }
+
+    /// <summary>
+    /// Calculates the box that encloses a hexahedron.
+    /// </summary>
+    /// <param name="hexahedron">[IN] The hexahedron.</param>
+    /// <returns>
+    /// The box that encloses the hexahedron.
+    /// </returns>
+    static QBox GetBounds(const QBaseHexahedron<QVector3> &hexahedron)
+    {
+        QBox bounds;
+        bounds.Reset();
+        bounds.Merge(hexahedron.A);
+        bounds.Merge(hexahedron.B);
+        bounds.Merge(hexahedron.C);
+        bounds.Merge(hexahedron.D);
+        bounds.Merge(hexahedron.E);
+        bounds.Merge(hexahedron.F);
+        bounds.Merge(hexahedron.G);
+        bounds.Merge(hexahedron.H);
+        return bounds;
+    }
+
+    /// <summary>
+    /// Calculates the intersection between a triangle and a ray.
+    /// </summary>
+    /// <param name="triangle">[IN] The triangle.</param>
+    /// <param name="ray">[IN] The ray, whose direction is normalized.</param>
+    /// <param name="fDistance">[OUT] The distance from the origin of the ray to the intersection point.</param>
+    /// <returns>
+    /// True if they intersect; False otherwise.
+    /// </returns>
+    static bool Intersection(const QBaseTriangle<QVector3> &triangle, const QRay3D<QVector3> &ray, float_q &fDistance)
+    {
+        float_q fU = SQFloat::_0;
+        float_q fV = SQFloat::_0;
+        return ray.Intersection(triangle, fDistance, fU, fV);
+    }
+
+    /// <summary>
+    /// Calculates the intersection between a hexahedron and a ray.
+    /// </summary>
+    /// <param name="hexahedron">[IN] The hexahedron.</param>
+    /// <param name="ray">[IN] The ray, whose direction is normalized.</param>
+    /// <param name="fDistance">[OUT] The distance from the origin of the ray to the closest intersection point, which is zero if the origin 
+    /// is inside the hexahedron.</param>
+    /// <returns>
+    /// True if they intersect; False otherwise.
+    /// </returns>
+    static bool Intersection(const QBaseHexahedron<QVector3> &hexahedron, const QRay3D<QVector3> &ray, float_q &fDistance)
+    {
+        if(QHexahedron<QVector3>(hexahedron).Contains(ray.Origin))
+        {
+            fDistance = SQFloat::_0;
+            return true;
+        }
+
+        QVector3 vIntersection;
+
+        if(ray.IntersectionPoint(hexahedron, vIntersection) == EQIntersections::E_None)
+            return false;
+
+        fDistance = (vIntersection - ray.Origin).GetLength();
+        return true;
+    }
+
+    /// <summary>
+    /// Checks whether a triangle and an orb intersect.
+    /// </summary>
+    /// <param name="triangle">[IN] The triangle.</param>
+    /// <param name="orb">[IN] The orb.</param>
+    /// <returns>
+    /// True if they intersect; False otherwise.
+    /// </returns>
+    static bool Intersection(const QBaseTriangle<QVector3> &triangle, const QBaseOrb<QVector3> &orb)
+    {
+        const QVector3 CENTER_TO_TRIANGLE = QBoundingVolumeHierarchy::GetClosestPoint(triangle, orb.Center) - orb.Center;
+        return SQFloat::IsLessOrEquals(CENTER_TO_TRIANGLE.GetSquaredLength(), orb.Radius * orb.Radius);
+    }
+
+    /// <summary>
+    /// Checks whether a hexahedron and an orb intersect.
+    /// </summary>
+    /// <param name="hexahedron">[IN] The hexahedron.</param>
+    /// <param name="orb">[IN] The orb.</param>
+    /// <returns>
+    /// True if they intersect; False otherwise.
+    /// </returns>
+    static bool Intersection(const QBaseHexahedron<QVector3> &hexahedron, const QBaseOrb<QVector3> &orb)
+    {
+        if(QHexahedron<QVector3>(hexahedron).Contains(orb.Center))
+            return true;
+
+        // If the center is outside, the orb must touch a face; every face is checked as two triangles
+        const QVector3* FACES[] = { &hexahedron.A, &hexahedron.B, &hexahedron.C, &hexahedron.D,
+                                    &hexahedron.E, &hexahedron.F, &hexahedron.G, &hexahedron.H,
+                                    &hexahedron.A, &hexahedron.B, &hexahedron.H, &hexahedron.E,
+                                    &hexahedron.B, &hexahedron.C, &hexahedron.G, &hexahedron.H,
+                                    &hexahedron.A, &hexahedron.D, &hexahedron.F, &hexahedron.E,
+                                    &hexahedron.C, &hexahedron.D, &hexahedron.F, &hexahedron.G };
+
+        for(unsigned int i = 0; i < 24U; i += 4U)
+        {
+            if(QBoundingVolumeHierarchy::Intersection(QBaseTriangle<QVector3>(*FACES[i], *FACES[i + 1U], *FACES[i + 2U]), orb) ||
+               QBoundingVolumeHierarchy::Intersection(QBaseTriangle<QVector3>(*FACES[i], *FACES[i + 2U], *FACES[i + 3U]), orb))
+                return true;
+        }
+
+        return false;
+    }
+
+    /// <summary>
+    /// Checks whether a triangle and a hexahedron intersect.
+    /// </summary>
+    /// <param name="triangle">[IN] The triangle.</param>
+    /// <param name="hexahedron">[IN] The hexahedron, which must be convex.</param>
+    /// <returns>
+    /// True if they intersect; False otherwise.
+    /// </returns>
+    static bool Intersection(const QBaseTriangle<QVector3> &triangle, const QBaseHexahedron<QVector3> &hexahedron)
+    {
+        // Either a vertex of the triangle is inside the hexahedron, an edge of the triangle crosses it or an edge of the hexahedron 
+        // crosses the triangle
+        const QHexahedron<QVector3> HEXAHEDRON(hexahedron);
+
+        if(HEXAHEDRON.Contains(triangle.A) || HEXAHEDRON.Contains(triangle.B) || HEXAHEDRON.Contains(triangle.C))
+            return true;
+
+        if(QLineSegment3D<QVector3>(triangle.A, triangle.B).Intersection(hexahedron) ||
+           QLineSegment3D<QVector3>(triangle.B, triangle.C).Intersection(hexahedron) ||
+           QLineSegment3D<QVector3>(triangle.C, triangle.A).Intersection(hexahedron))
+            return true;
+
+        const QVector3* EDGES[] = { &hexahedron.A, &hexahedron.B,   &hexahedron.B, &hexahedron.C,   &hexahedron.C, &hexahedron.D,   &hexahedron.D, &hexahedron.A, 
+                                    &hexahedron.E, &hexahedron.F,   &hexahedron.F, &hexahedron.G,   &hexahedron.G, &hexahedron.H,   &hexahedron.H, &hexahedron.E, 
+                                    &hexahedron.A, &hexahedron.E,   &hexahedron.B, &hexahedron.H,   &hexahedron.C, &hexahedron.G,   &hexahedron.D, &hexahedron.F };
+
+        for(unsigned int i = 0; i < 24U; i += 2U)
+        {
+            if(QLineSegment3D<QVector3>(*EDGES[i], *EDGES[i + 1U]).Intersection(triangle))
+                return true;
+        }
+
+        return false;
+    }
+
+    /// <summary>
+    /// Checks whether two hexahedra intersect.
+    /// </summary>
+    /// <param name="hexahedron1">[IN] The first hexahedron.</param>
+    /// <param name="hexahedron2">[IN] The second hexahedron.</param>
+    /// <returns>
+    /// True if they intersect; False otherwise.
+    /// </returns>
+    static bool Intersection(const QBaseHexahedron<QVector3> &hexahedron1, const QBaseHexahedron<QVector3> &hexahedron2)
+    {
+        return QHexahedron<QVector3>(hexahedron1).Intersection(hexahedron2);
+    }
+
+    /// <summary>
+    /// Calculates the point of a triangle that is the closest to another point.
+    /// </summary>
+    /// <remarks>
+    /// The point is classified into the regions of the plane of the triangle delimited by the perpendiculars to its edges at every vertex, 
+    /// so the result is either a vertex, a point of an edge or the projection of the point onto the triangle. If the vertices of the triangle
+    /// are aligned, the result is undefined.
+    /// </remarks>
+    /// <param name="triangle">[IN] The triangle.</param>
+    /// <param name="vPoint">[IN] The point.</param>
+    /// <returns>
+    /// The closest point of the triangle.
+    /// </returns>
+    static QVector3 GetClosestPoint(const QBaseTriangle<QVector3> &triangle, const QVector3 &vPoint)
+    {
+        const QVector3 EDGE_AB = triangle.B - triangle.A;
+        const QVector3 EDGE_AC = triangle.C - triangle.A;
+
+        const QVector3 A_TO_POINT = vPoint - triangle.A;
+        const float_q AB_DOT_AP = EDGE_AB.DotProduct(A_TO_POINT);
+        const float_q AC_DOT_AP = EDGE_AC.DotProduct(A_TO_POINT);
+
+        if(AB_DOT_AP <= SQFloat::_0 && AC_DOT_AP <= SQFloat::_0)
+            return triangle.A;
+
+        const QVector3 B_TO_POINT = vPoint - triangle.B;
+        const float_q AB_DOT_BP = EDGE_AB.DotProduct(B_TO_POINT);
+        const float_q AC_DOT_BP = EDGE_AC.DotProduct(B_TO_POINT);
+
+        if(AB_DOT_BP >= SQFloat::_0 && AC_DOT_BP <= AB_DOT_BP)
+            return triangle.B;
+
+        const float_q WEIGHT_C = AB_DOT_AP * AC_DOT_BP - AB_DOT_BP * AC_DOT_AP;
+
+        if(WEIGHT_C <= SQFloat::_0 && AB_DOT_AP >= SQFloat::_0 && AB_DOT_BP <= SQFloat::_0)
+            return triangle.A + EDGE_AB * (AB_DOT_AP / (AB_DOT_AP - AB_DOT_BP));
+
+        const QVector3 C_TO_POINT = vPoint - triangle.C;
+        const float_q AB_DOT_CP = EDGE_AB.DotProduct(C_TO_POINT);
+        const float_q AC_DOT_CP = EDGE_AC.DotProduct(C_TO_POINT);
+
+        if(AC_DOT_CP >= SQFloat::_0 && AB_DOT_CP <= AC_DOT_CP)
+            return triangle.C;
+
+        const float_q WEIGHT_B = AB_DOT_CP * AC_DOT_AP - AB_DOT_AP * AC_DOT_CP;
+
+        if(WEIGHT_B <= SQFloat::_0 && AC_DOT_AP >= SQFloat::_0 && AC_DOT_CP <= SQFloat::_0)
+            return triangle.A + EDGE_AC * (AC_DOT_AP / (AC_DOT_AP - AC_DOT_CP));
+
+        const float_q WEIGHT_A = AB_DOT_BP * AC_DOT_CP - AB_DOT_CP * AC_DOT_BP;
+
+        if(WEIGHT_A <= SQFloat::_0 && AC_DOT_BP - AB_DOT_BP >= SQFloat::_0 && AB_DOT_CP - AC_DOT_CP >= SQFloat::_0)
+        {
+            const float_q B_TO_C_PROPORTION = (AC_DOT_BP - AB_DOT_BP) / ((AC_DOT_BP - AB_DOT_BP) + (AB_DOT_CP - AC_DOT_CP));
+            return triangle.B + (triangle.C - triangle.B) * B_TO_C_PROPORTION;
+        }
+
+        const float_q INVERSE_TOTAL_WEIGHT = SQFloat::_1 / (WEIGHT_A + WEIGHT_B + WEIGHT_C);
+        return triangle.A + EDGE_AB * (WEIGHT_B * INVERSE_TOTAL_WEIGHT) + EDGE_AC * (WEIGHT_C * INVERSE_TOTAL_WEIGHT);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of primitives stored in the hierarchy.
+    /// </summary>
+    /// <returns>
+    /// The number of primitives.
+    /// </returns>
+    unsigned int GetPrimitiveCount() const
+    {
+        return m_uPrimitiveCount;
+    }
+
+    /// <summary>
+    /// Gets the number of nodes of the tree, including leaves.
+    /// </summary>
+    /// <returns>
+    /// The number of nodes. It is zero if there are no primitives.
+    /// </returns>
+    unsigned int GetNodeCount() const
+    {
+        return m_uNodeCount;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The copy of the primitives, sorted so the ones of every leaf are contiguous.
+    /// </summary>
+    PrimitiveT* m_arPrimitives;
+
+    /// <summary>
+    /// The position in the array passed to the constructor of every primitive of m_arPrimitives.
+    /// </summary>
+    u32_q* m_arPrimitiveIndices;
+
+    /// <summary>
+    /// The nodes of the tree in depth-first order. The first one is the root.
+    /// </summary>
+    QNode* m_arNodes;
+
+    /// <summary>
+    /// The number of primitives.
+    /// </summary>
+    u32_q m_uPrimitiveCount;
+
+    /// <summary>
+    /// The number of nodes.
+    /// </summary>
+    u32_q m_uNodeCount;
+
+};
+
+
+// SPECIALIZATION EXPORTATIONS
+// -----------------------------
+#ifdef QE_EXPORT_TOOLS_TEMPLATE_SPECIALIZATION
+
+template class QE_LAYER_TOOLS_SYMBOLS QBoundingVolumeHierarchy< QBaseTriangle<Kinesis::QuimeraEngine::Tools::Math::QVector3> >;
+template class QE_LAYER_TOOLS_SYMBOLS QBoundingVolumeHierarchy< QBaseHexahedron<Kinesis::QuimeraEngine::Tools::Math::QVector3> >;
+
+#endif // QE_EXPORT_TOOLS_TEMPLATE_SPECIALIZATION
+
+} //namespace Math
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QBOUNDINGVOLUMEHIERARCHY__
@@ -0,0 +1,198 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QBUFFEREDBINARYREADER__
+#define __QBUFFEREDBINARYREADER__
+
+#include "CommonDefinitions.h"
+#include "DataTypesDefinitions.h"
+#include "StringsDefinitions.h"
+#include "Assertions.h"
+#include <cstring>
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+
+/// <summary>
+/// Binary reader that obtains blocks of bytes from another binary reader in advance and serves small reads from an internal buffer.
+/// </summary>
+/// <remarks>
+/// It is used to deserialize elements that are not stored contiguously without accessing the stream once per element.<br/>
+/// Since the bytes that are read in advance cannot be returned to the wrapped reader, only a known number of bytes, which must belong to the 
+/// data being read, are read in advance. Once they are consumed, the rest of reads are sent directly to the wrapped reader.
+/// </remarks>
+/// <typeparam name="ReaderT">The type of the wrapped reader. It must provide a ReadBytes method, like QBinaryStreamReader does.</typeparam>
+template<class ReaderT>
+class QBufferedBinaryReader
+{
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The size of the internal buffer, in bytes.
+    /// </summary>
+    static const pointer_uint_q BUFFER_SIZE = 4096U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the reader from which bytes will be obtained and how many of them can be read in advance.
+    /// </summary>
+    /// <param name="reader">[IN] The wrapped reader.</param>
+    /// <param name="uReadAheadBytes">[IN] The number of bytes that can be read in advance. It must not exceed the size of the data that will be read 
+    /// through this instance. If it is zero, all reads are sent directly to the wrapped reader.</param>
+    QBufferedBinaryReader(ReaderT &reader, const pointer_uint_q uReadAheadBytes) : m_reader(reader),
+                                                                                  m_uReadAheadBytes(uReadAheadBytes),
+                                                                                  m_uBufferedBytes(0),
+                                                                                  m_uPosition(0)
+    {
+    }
+
+private:
+
+    // Hidden
+    QBufferedBinaryReader(const QBufferedBinaryReader &);
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    QBufferedBinaryReader& operator=(const QBufferedBinaryReader &);
+
+public:
+
+    /// <summary>
+    /// Reads a concrete amount of bytes and fills an output buffer.
+    /// </summary>
+    /// <param name="pBuffer">[OUT] The buffer to be filled with the read bytes. It must not be null.</param>
+    /// <param name="uSize">[IN] The size of the buffer, in bytes. It must be greater than zero.</param>
+    void ReadBytes(void* pBuffer, const pointer_uint_q uSize)
+    {
+        QE_ASSERT_ERROR(pBuffer != null_q, "The output buffer cannot be null.");
+        QE_ASSERT_ERROR(uSize > 0, "The size of the output buffer cannot equal zero.");
+
+        u8_q* pOutput = scast_q(pBuffer, u8_q*);
+        pointer_uint_q uPendingBytes = uSize;
+
+        // The bytes read in advance are consumed first
+        const pointer_uint_q AVAILABLE_BYTES = m_uBufferedBytes - m_uPosition;
+        const pointer_uint_q COPIED_BYTES = uPendingBytes < AVAILABLE_BYTES ? uPendingBytes : AVAILABLE_BYTES;
+
+        if(COPIED_BYTES > 0)
+        {
+            memcpy(pOutput, &m_arBuffer[m_uPosition], COPIED_BYTES);
+            m_uPosition += COPIED_BYTES;
+            pOutput += COPIED_BYTES;
+            uPendingBytes -= COPIED_BYTES;
+        }
+
+        if(uPendingBytes > 0)
+        {
+            if(uPendingBytes < QBufferedBinaryReader::BUFFER_SIZE && uPendingBytes < m_uReadAheadBytes)
+            {
+                // The buffer is refilled with as many bytes as allowed
+                m_uBufferedBytes = m_uReadAheadBytes < QBufferedBinaryReader::BUFFER_SIZE ? m_uReadAheadBytes : QBufferedBinaryReader::BUFFER_SIZE;
+                m_reader.ReadBytes(m_arBuffer, m_uBufferedBytes);
+                m_uReadAheadBytes -= m_uBufferedBytes;
+
+                memcpy(pOutput, m_arBuffer, uPendingBytes);
+                m_uPosition = uPendingBytes;
+            }
+            else
+            {
+                // Big blocks, and blocks that cannot be read in advance, are read directly
+                m_reader.ReadBytes(pOutput, uPendingBytes);
+                m_uReadAheadBytes = uPendingBytes < m_uReadAheadBytes ? m_uReadAheadBytes - uPendingBytes : 0;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Bitwise right shift operator that reads enough bytes to fill an instance of a given type.
+    /// </summary>
+    /// <typeparam name="T">The data type as which to interpret the read bytes.</typeparam>
+    /// <param name="value">[OUT] The instance to be filled.</param>
+    /// <returns>
+    /// A reference to the resident buffered reader.
+    /// </returns>
+    template<class T>
+    QBufferedBinaryReader& operator>>(T &value)
+    {
+        this->ReadBytes(&value, sizeof(T));
+        return *this;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The wrapped reader.
+    /// </summary>
+    ReaderT &m_reader;
+
+    /// <summary>
+    /// The number of bytes that can still be read in advance.
+    /// </summary>
+    pointer_uint_q m_uReadAheadBytes;
+
+    /// <summary>
+    /// The number of bytes stored in the internal buffer.
+    /// </summary>
+    pointer_uint_q m_uBufferedBytes;
+
+    /// <summary>
+    /// The position of the next byte to be consumed in the internal buffer.
+    /// </summary>
+    pointer_uint_q m_uPosition;
+
+    /// <summary>
+    /// The internal buffer.
+    /// </summary>
+    u8_q m_arBuffer[QBufferedBinaryReader::BUFFER_SIZE];
+
+};
+
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QBUFFEREDBINARYREADER__
@@ -0,0 +1,193 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QBUFFEREDBINARYWRITER__
+#define __QBUFFEREDBINARYWRITER__
+
+#include "CommonDefinitions.h"
+#include "DataTypesDefinitions.h"
+#include "StringsDefinitions.h"
+#include "Assertions.h"
+#include <cstring>
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+
+/// <summary>
+/// Binary writer that accumulates small writes in an internal buffer and sends them to another binary writer in blocks.
+/// </summary>
+/// <remarks>
+/// It is used to serialize elements that are not stored contiguously without accessing the stream once per element.<br/>
+/// Buffered bytes are sent to the wrapped writer when the buffer is full, when the Flush method is called and when the instance is destroyed.
+/// </remarks>
+/// <typeparam name="WriterT">The type of the wrapped writer. It must provide a WriteBytes method, like QBinaryStreamWriter does.</typeparam>
+template<class WriterT>
+class QBufferedBinaryWriter
+{
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The size of the internal buffer, in bytes.
+    /// </summary>
+    static const pointer_uint_q BUFFER_SIZE = 4096U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the writer to which the buffered bytes will be sent.
+    /// </summary>
+    /// <param name="writer">[IN] The wrapped writer.</param>
+    explicit QBufferedBinaryWriter(WriterT &writer) : m_writer(writer),
+                                                      m_uBufferedBytes(0)
+    {
+    }
+
+private:
+
+    // Hidden
+    QBufferedBinaryWriter(const QBufferedBinaryWriter &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It sends the buffered bytes to the wrapped writer.
+    /// </summary>
+    ~QBufferedBinaryWriter()
+    {
+        this->Flush();
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    QBufferedBinaryWriter& operator=(const QBufferedBinaryWriter &);
+
+public:
+
+    /// <summary>
+    /// Writes a concrete amount of bytes from an input buffer.
+    /// </summary>
+    /// <remarks>
+    /// Blocks that do not fit in the internal buffer are sent directly to the wrapped writer, after the buffered bytes.
+    /// </remarks>
+    /// <param name="pBuffer">[IN] The buffer from which to copy bytes. It must not be null.</param>
+    /// <param name="uSize">[IN] The size of the buffer, in bytes. It must be greater than zero.</param>
+    void WriteBytes(const void* pBuffer, const pointer_uint_q uSize)
+    {
+        QE_ASSERT_ERROR(pBuffer != null_q, "The input buffer cannot be null.");
+        QE_ASSERT_ERROR(uSize > 0, "The size of the buffer must be greater than zero.");
+
+        if(m_uBufferedBytes + uSize > QBufferedBinaryWriter::BUFFER_SIZE)
+        {
+            this->Flush();
+
+            if(uSize > QBufferedBinaryWriter::BUFFER_SIZE)
+            {
+                m_writer.WriteBytes(pBuffer, uSize);
+                return;
+            }
+        }
+
+        memcpy(&m_arBuffer[m_uBufferedBytes], pBuffer, uSize);
+        m_uBufferedBytes += uSize;
+    }
+
+    /// <summary>
+    /// Bitwise left shift operator that writes enough bytes to copy an instance of a given type.
+    /// </summary>
+    /// <typeparam name="T">The data type as which to interpret the bytes to write.</typeparam>
+    /// <param name="value">[IN] The instance to be copied.</param>
+    /// <returns>
+    /// A reference to the resident buffered writer.
+    /// </returns>
+    template<class T>
+    QBufferedBinaryWriter& operator<<(const T &value)
+    {
+        this->WriteBytes(&value, sizeof(T));
+        return *this;
+    }
+
+    /// <summary>
+    /// Sends the buffered bytes to the wrapped writer.
+    /// </summary>
+    /// <remarks>
+    /// The wrapped writer is not flushed.
+    /// </remarks>
+    void Flush()
+    {
+        if(m_uBufferedBytes > 0)
+        {
+            m_writer.WriteBytes(m_arBuffer, m_uBufferedBytes);
+            m_uBufferedBytes = 0;
+        }
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The wrapped writer.
+    /// </summary>
+    WriterT &m_writer;
+
+    /// <summary>
+    /// The number of bytes in the internal buffer that have not been sent yet.
+    /// </summary>
+    pointer_uint_q m_uBufferedBytes;
+
+    /// <summary>
+    /// The internal buffer.
+    /// </summary>
+    u8_q m_arBuffer[QBufferedBinaryWriter::BUFFER_SIZE];
+
+};
+
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QBUFFEREDBINARYWRITER__
@@ -28,14 +28,19 @@
 #define __QCALLSTACKTRACER__
 
 #include <boost/shared_ptr.hpp>
+#include <boost/atomic.hpp>
+#include <boost/thread/tss.hpp>
 
 #include "SystemDefinitions.h"
 #include "QCallTrace.h"
 #include "QAbstractCallStackTracePrinter.h"
 #include "QCallStackTrace.h"
-#include "QThread.h"
 #include "QSharedMutex.h"
-#include "QDictionary.h"
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( push )
+    #pragma warning( disable: 4251 ) // This warning occurs when using a template specialization as attribute
+#endif
 
 
 namespace Kinesis
@@ -52,15 +57,45 @@ namespace Diagnosis
 /// </summary>
 /// <remarks>
 /// It is a singleton.<br/>
-/// It is thread-safe.
+/// It is thread-safe. Every thread stores its call stack trace in its own thread-local storage, so adding and removing traces
+/// does not require any synchronization. Call stack traces are registered in a lock-free list the first time a thread adds a
+/// trace, and are reused by other threads when the thread that registered them finishes.
 /// </remarks>
 class QE_LAYER_SYSTEM_SYMBOLS QCallStackTracer
 {
-    // CONSTRUCTORS
+    // INTERNAL CLASSES
     // ---------------
 protected:
 
-    typedef Kinesis::QuimeraEngine::Tools::Containers::QDictionary<Kinesis::QuimeraEngine::System::Threading::QThread::Id, QCallStackTrace*> CallStackTraceContainer;
+    /// <summary>
+    /// A node of the list of call stack traces registered by threads.
+    /// </summary>
+    struct QRegisteredCallStackTrace
+    {
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        QRegisteredCallStackTrace() : m_pCallStackTrace(null_q),
+                                      m_bInUse(true),
+                                      m_pNext(null_q)
+        {
+        }
+
+        /// <summary>
+        /// The call stack trace of the thread that is using the node.
+        /// </summary>
+        QCallStackTrace* m_pCallStackTrace;
+
+        /// <summary>
+        /// Indicates whether the node belongs to a running thread. Otherwise, it can be reused by another thread.
+        /// </summary>
+        boost::atomic<bool> m_bInUse;
+
+        /// <summary>
+        /// The next node of the list. It does not change once the node has been added to the list.
+        /// </summary>
+        QRegisteredCallStackTrace* m_pNext;
+    };
 
 
     // CONSTRUCTORS
@@ -100,11 +135,51 @@ public:
     /// Uses a custom printer to send the information of the call stack trace of the current thread to an output channel with a concrete format.
     /// </summary>
     /// <remarks>
-    /// If there is not printer assigned, it does nothing.<br/>
-    /// If there are no traces for the current thread, it prints a message warning about that.
+    /// If there is not printer assigned or there are no traces for the current thread, it does nothing.
     /// </remarks>
     virtual void Dump();
 
+protected:
+
+    /// <summary>
+    /// Gets the call stack trace of the current thread, registering it the first time the thread calls this method.
+    /// </summary>
+    /// <returns>
+    /// The call stack trace of the current thread.
+    /// </returns>
+    QCallStackTrace* GetCurrentCallStackTrace();
+
+    /// <summary>
+    /// Assigns a call stack trace to the current thread, reusing one that belonged to a finished thread or adding a new one to the list
+    /// of registered call stack traces.
+    /// </summary>
+    /// <returns>
+    /// The call stack trace of the current thread, which is empty.
+    /// </returns>
+    QCallStackTrace* RegisterCurrentThread();
+
+    /// <summary>
+    /// Gets the pointer that the current thread keeps to its call stack trace, so it does not have to search for it in the 
+    /// thread-specific storage every time it adds or removes a trace.
+    /// </summary>
+    /// <remarks>
+    /// It is set when the call stack trace is assigned to the thread and cleared when it is released, so it never points to 
+    /// a call stack trace that has been reused by another thread.
+    /// </remarks>
+    /// <returns>
+    /// The pointer to the call stack trace of the current thread, which is null if the thread has no call stack trace.
+    /// </returns>
+    static QCallStackTrace*& GetCachedCallStackTrace();
+
+    /// <summary>
+    /// Marks a registered call stack trace as not used, so other threads can reuse it.
+    /// </summary>
+    /// <remarks>
+    /// It is called by the thread that registered the call stack trace when it finishes.
+    /// </remarks>
+    /// <param name="pRegisteredCallStackTrace">[IN] The node of the list of registered call stack traces that belongs to the thread.</param>
+    static void ReleaseCallStackTrace(QRegisteredCallStackTrace* pRegisteredCallStackTrace);
+
 
     // PROPERTIES
     // ---------------
@@ -136,9 +211,14 @@ public:
 protected:
 
     /// <summary>
-    /// A dictionary which contains every call stack trace associated to its thread Id.
+    /// The first node of the list of call stack traces registered by threads. Nodes are never removed from the list.
     /// </summary>
-    CallStackTraceContainer m_callStackTraces;
+    boost::atomic<QRegisteredCallStackTrace*> m_pRegisteredCallStackTraces;
+
+    /// <summary>
+    /// The node of the list that belongs to every thread, which is released when the thread finishes.
+    /// </summary>
+    boost::thread_specific_ptr<QRegisteredCallStackTrace> m_currentRegisteredCallStackTrace;
     
     /// <summary>
     /// The custom printer to be used by the tracer.
@@ -146,12 +226,7 @@ protected:
     boost::shared_ptr<QAbstractCallStackTracePrinter> m_pPrinter;
 
     // Synchronization
-    
-    /// <summary>
-    /// Mutex to synchronize the access to the call stack trace dictionary.
-    /// </summary>
-    mutable Kinesis::QuimeraEngine::System::Threading::QSharedMutex m_callStackTracesMutex;
-    
+
     /// <summary>
     /// Mutex to synchronize the access to the printer.
     /// </summary>
@@ -163,4 +238,8 @@ protected:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( pop )
+#endif
+
 #endif // __QCALLSTACKTRACER__
@@ -0,0 +1,858 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QCONCURRENTEVENT__
+#define __QCONCURRENTEVENT__
+
+#include <boost/atomic.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "SystemDefinitions.h"
+#include "QArrayDynamic.h"
+#include "QDelegate.h"
+#include "SQEqualityComparator.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+
+/// <summary>
+/// Stores the subscribers of a concurrent event and publishes immutable snapshots of them, so the event can be raised 
+/// by several threads at the same time while other threads subscribe or unsubscribe functions.
+/// </summary>
+/// <remarks>
+/// There are two snapshots; one is the current and the other is either being built by a writer or retired.<br/>
+/// Raising the event only requires a single atomic increment to register as a reader of the current snapshot and 
+/// another one to leave it, readers never wait.<br/>
+/// Subscribing and unsubscribing are copy-on-write operations serialized among them. A writer copies the current snapshot to the other 
+/// one, modifies it and publishes it. Before reusing a retired snapshot, the writer waits for the readers that were still 
+/// using it to finish.
+/// </remarks>
+/// <typeparam name="FunctionSignatureT">The signature of the functions that subscribe to the event.</typeparam>
+template<typename FunctionSignatureT>
+class QConcurrentEventBase
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef QDelegate<FunctionSignatureT> Subscriber;
+    typedef Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic<Subscriber, 
+                                                                     Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, 
+                                                                     Kinesis::QuimeraEngine::Tools::Containers::SQEqualityComparator<Subscriber> > 
+                                                                        SubscriberArray;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// An immutable version of the list of subscribers and the number of readers that finished using it.
+    /// </summary>
+    struct QSnapshot
+    {
+        QSnapshot() : m_uReleasedReaders(0),
+                      m_uAcquiredReaders(0)
+        {
+        }
+
+        /// <summary>
+        /// The list of subscribed functions.
+        /// </summary>
+        SubscriberArray m_arSubscribers;
+
+        /// <summary>
+        /// The number of readers that finished using the snapshot. It wraps around, only the difference with the number of acquisitions matters.
+        /// </summary>
+        mutable boost::atomic<u32_q> m_uReleasedReaders;
+
+        /// <summary>
+        /// The number of readers that acquired the snapshot while it was the current one. It is only written by writers, when the snapshot is retired.
+        /// </summary>
+        u32_q m_uAcquiredReaders;
+    };
+
+    /// <summary>
+    /// Acquires the current snapshot when it is constructed and releases it when it is destroyed, so a subscriber that throws an exception 
+    /// does not leave the snapshot acquired, which would make writers wait forever.
+    /// </summary>
+    class QScopedSnapshot
+    {
+    public:
+
+        /// <summary>
+        /// Constructor that acquires the current snapshot of an event.
+        /// </summary>
+        /// <param name="event">[IN] The event whose current snapshot is to be acquired.</param>
+        explicit QScopedSnapshot(const QConcurrentEventBase &event) : m_event(event),
+                                                                     m_uSnapshot(event.AcquireSnapshot())
+        {
+        }
+
+        /// <summary>
+        /// Destructor that releases the snapshot.
+        /// </summary>
+        ~QScopedSnapshot()
+        {
+            m_event.ReleaseSnapshot(m_uSnapshot);
+        }
+
+    private:
+
+        // Hidden
+        QScopedSnapshot(const QScopedSnapshot&);
+        QScopedSnapshot& operator=(const QScopedSnapshot&);
+
+    public:
+
+        /// <summary>
+        /// Gets the list of subscribers of the acquired snapshot.
+        /// </summary>
+        /// <returns>
+        /// The list of subscribed functions, which will not change while the snapshot is acquired.
+        /// </returns>
+        const SubscriberArray& GetSubscribers() const
+        {
+            return m_event.m_arSnapshots[m_uSnapshot].m_arSubscribers;
+        }
+
+    private:
+
+        /// <summary>
+        /// The event whose snapshot was acquired.
+        /// </summary>
+        const QConcurrentEventBase &m_event;
+
+        /// <summary>
+        /// The index of the acquired snapshot.
+        /// </summary>
+        const u32_q m_uSnapshot;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The value added to the state to register a reader, which increments the counter stored in the 32 most significant bits.
+    /// </summary>
+    static const u64_q READER_INCREMENT = 0x100000000ULL;
+
+    /// <summary>
+    /// The mask that extracts the index of the current snapshot from the state.
+    /// </summary>
+    static const u64_q SNAPSHOT_INDEX_MASK = 0x1ULL;
+
+
+    // CONSTRUCTORS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    QConcurrentEventBase() : m_uState(0),
+                             m_bIsBeingModified(false)
+    {
+    }
+
+private:
+
+    // Hidden
+    QConcurrentEventBase(const QConcurrentEventBase&);
+    QConcurrentEventBase& operator=(const QConcurrentEventBase&);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Subscribes a function to the event.
+    /// </summary>
+    /// <remarks>
+    /// It can be called while other threads raise the event, which will call either the previous or the new list of subscribers.<br/>
+    /// It must not be called by a subscriber of the same event while it is being raised.
+    /// </remarks>
+    /// <param name="subscriber">[IN] A function to subscribe. It should not be already subscribed. It must not be null.</param>
+    void operator+=(const Subscriber &subscriber)
+    {
+        QE_ASSERT_ERROR(!subscriber.IsNull(), "The input function must not be null.");
+
+        QSnapshot& snapshot = this->BeginModification();
+
+        QE_ASSERT_WARNING(!snapshot.m_arSubscribers.Contains(subscriber), "The input function is already subscribed to the event.");
+
+        snapshot.m_arSubscribers.Add(subscriber);
+
+        this->EndModification();
+    }
+    
+    /// <summary>
+    /// Unsubscribes a function from the event.
+    /// </summary>
+    /// <remarks>
+    /// It can be called while other threads raise the event, which will call either the previous or the new list of subscribers.<br/>
+    /// It must not be called by a subscriber of the same event while it is being raised.
+    /// </remarks>
+    /// <param name="subscriber">[IN] A function to unsubscribe. It must be already subscribed. It must not be null.</param>
+    void operator-=(const Subscriber &subscriber)
+    {
+        QE_ASSERT_ERROR(!subscriber.IsNull(), "The input function must not be null.");
+
+        QSnapshot& snapshot = this->BeginModification();
+
+        pointer_uint_q uIndex = snapshot.m_arSubscribers.IndexOf(subscriber);
+
+        QE_ASSERT_WARNING(uIndex != SubscriberArray::ELEMENT_NOT_FOUND, "The input function cannot be removed, it is not subscribed to the event.");
+
+        if(uIndex != SubscriberArray::ELEMENT_NOT_FOUND)
+            snapshot.m_arSubscribers.Remove(uIndex);
+
+        this->EndModification();
+    }
+
+    /// <summary>
+    /// Unsubscribes all the subscribed functions.
+    /// </summary>
+    /// <remarks>
+    /// It can be called while other threads raise the event, which will call either the previous or the new list of subscribers.<br/>
+    /// It must not be called by a subscriber of the same event while it is being raised.
+    /// </remarks>
+    void UnsubscribeAll()
+    {
+        QSnapshot& snapshot = this->BeginModification();
+        snapshot.m_arSubscribers.Clear();
+        this->EndModification();
+    }
+
+protected:
+
+    /// <summary>
+    /// Registers the calling thread as a reader of the current snapshot, which will not be modified until it is released.
+    /// </summary>
+    /// <returns>
+    /// The index of the acquired snapshot, to be passed to ReleaseSnapshot.
+    /// </returns>
+    u32_q AcquireSnapshot() const
+    {
+        // The same operation reads the index of the current snapshot and counts the reader, so writers know who is using it
+        return scast_q(m_uState.fetch_add(READER_INCREMENT, boost::memory_order_acquire) & SNAPSHOT_INDEX_MASK, u32_q);
+    }
+
+    /// <summary>
+    /// Unregisters the calling thread as a reader of a snapshot.
+    /// </summary>
+    /// <param name="uSnapshot">[IN] The index of the snapshot returned by AcquireSnapshot.</param>
+    void ReleaseSnapshot(const u32_q uSnapshot) const
+    {
+        m_arSnapshots[uSnapshot].m_uReleasedReaders.fetch_add(1U, boost::memory_order_release);
+    }
+
+    /// <summary>
+    /// Waits for other writers to finish, copies the current snapshot to the retired one once its readers have finished and 
+    /// returns it to be modified.
+    /// </summary>
+    /// <returns>
+    /// The snapshot to be modified and published by EndModification.
+    /// </returns>
+    QSnapshot& BeginModification()
+    {
+        bool bIsBeingModified = false;
+
+        // The thread yields while it waits so the writer or the readers it waits for can progress when there are more threads than cores
+        while(!m_bIsBeingModified.compare_exchange_weak(bIsBeingModified, true, boost::memory_order_acquire, boost::memory_order_relaxed))
+        {
+            bIsBeingModified = false;
+            boost::this_thread::yield();
+        }
+
+        const u32_q CURRENT_SNAPSHOT = scast_q(m_uState.load(boost::memory_order_relaxed) & SNAPSHOT_INDEX_MASK, u32_q);
+        QSnapshot& nextSnapshot = m_arSnapshots[1U - CURRENT_SNAPSHOT];
+
+        // Readers that acquired the retired snapshot before it was replaced may still be using it
+        while(nextSnapshot.m_uReleasedReaders.load(boost::memory_order_acquire) != nextSnapshot.m_uAcquiredReaders)
+            boost::this_thread::yield();
+
+        nextSnapshot.m_arSubscribers = m_arSnapshots[CURRENT_SNAPSHOT].m_arSubscribers;
+        nextSnapshot.m_uReleasedReaders.store(0, boost::memory_order_relaxed);
+        nextSnapshot.m_uAcquiredReaders = 0;
+
+        return nextSnapshot;
+    }
+
+    /// <summary>
+    /// Publishes the snapshot returned by BeginModification, retires the current one and lets other writers continue.
+    /// </summary>
+    void EndModification()
+    {
+        const u32_q CURRENT_SNAPSHOT = scast_q(m_uState.load(boost::memory_order_relaxed) & SNAPSHOT_INDEX_MASK, u32_q);
+        const u64_q PREVIOUS_STATE = m_uState.exchange(1U - CURRENT_SNAPSHOT, boost::memory_order_acq_rel);
+
+        m_arSnapshots[CURRENT_SNAPSHOT].m_uAcquiredReaders = scast_q(PREVIOUS_STATE >> 32U, u32_q);
+
+        m_bIsBeingModified.store(false, boost::memory_order_release);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Gets the entire list of subscribed functions.
+    /// </summary>
+    /// <returns>
+    /// A copy of the list of subscribed functions at the moment of the call.
+    /// </returns>
+    SubscriberArray GetSubscribers() const
+    {
+        const QScopedSnapshot snapshot(*this);
+        return snapshot.GetSubscribers();
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The current snapshot and the retired one.
+    /// </summary>
+    QSnapshot m_arSnapshots[2];
+
+    /// <summary>
+    /// The index of the current snapshot, in the least significant bit, and the number of readers that acquired it, in the 32 most significant bits.
+    /// </summary>
+    mutable boost::atomic<u64_q> m_uState;
+
+    /// <summary>
+    /// Indicates whether a writer is modifying the subscribers.
+    /// </summary>
+    boost::atomic<bool> m_bIsBeingModified;
+};
+
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="FunctionSignatureT">The signature of the functions that subscribe to the event.</typeparam>
+template<typename FunctionSignatureT>
+class QConcurrentEvent;
+
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT>
+class QConcurrentEvent< ReturnValueT(void) > : public QConcurrentEventBase< ReturnValueT(void) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The functions called are those subscribed when the method starts; subscriptions made meanwhile by other threads will take effect the next time.
+    /// </remarks>
+    void Raise() const
+    {
+        const typename QConcurrentEvent::QScopedSnapshot snapshot(*this);
+        const typename QConcurrentEvent::SubscriberArray &arSubscribers = snapshot.GetSubscribers();
+        const pointer_uint_q COUNT = arSubscribers.GetCount();
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+            arSubscribers[i]();
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T>
+class QConcurrentEvent< ReturnValueT(Param1T) > : public QConcurrentEventBase< ReturnValueT(Param1T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The functions called are those subscribed when the method starts; subscriptions made meanwhile by other threads will take effect the next time.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as parameter to every function.</param>
+    void Raise(Param1T p1) const
+    {
+        const typename QConcurrentEvent::QScopedSnapshot snapshot(*this);
+        const typename QConcurrentEvent::SubscriberArray &arSubscribers = snapshot.GetSubscribers();
+        const pointer_uint_q COUNT = arSubscribers.GetCount();
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+            arSubscribers[i](p1);
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T>
+class QConcurrentEvent< ReturnValueT(Param1T, Param2T) > : public QConcurrentEventBase< ReturnValueT(Param1T, Param2T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The functions called are those subscribed when the method starts; subscriptions made meanwhile by other threads will take effect the next time.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2) const
+    {
+        const typename QConcurrentEvent::QScopedSnapshot snapshot(*this);
+        const typename QConcurrentEvent::SubscriberArray &arSubscribers = snapshot.GetSubscribers();
+        const pointer_uint_q COUNT = arSubscribers.GetCount();
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+            arSubscribers[i](p1, p2);
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T>
+class QConcurrentEvent< ReturnValueT(Param1T, Param2T, Param3T) > : public QConcurrentEventBase< ReturnValueT(Param1T, Param2T, Param3T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The functions called are those subscribed when the method starts; subscriptions made meanwhile by other threads will take effect the next time.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3) const
+    {
+        const typename QConcurrentEvent::QScopedSnapshot snapshot(*this);
+        const typename QConcurrentEvent::SubscriberArray &arSubscribers = snapshot.GetSubscribers();
+        const pointer_uint_q COUNT = arSubscribers.GetCount();
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+            arSubscribers[i](p1, p2, p3);
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T>
+class QConcurrentEvent< ReturnValueT(Param1T, Param2T, Param3T, Param4T) > : public QConcurrentEventBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The functions called are those subscribed when the method starts; subscriptions made meanwhile by other threads will take effect the next time.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4) const
+    {
+        const typename QConcurrentEvent::QScopedSnapshot snapshot(*this);
+        const typename QConcurrentEvent::SubscriberArray &arSubscribers = snapshot.GetSubscribers();
+        const pointer_uint_q COUNT = arSubscribers.GetCount();
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+            arSubscribers[i](p1, p2, p3, p4);
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T>
+class QConcurrentEvent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T) > : public QConcurrentEventBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The functions called are those subscribed when the method starts; subscriptions made meanwhile by other threads will take effect the next time.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">An instance to be passed as fifth parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5) const
+    {
+        const typename QConcurrentEvent::QScopedSnapshot snapshot(*this);
+        const typename QConcurrentEvent::SubscriberArray &arSubscribers = snapshot.GetSubscribers();
+        const pointer_uint_q COUNT = arSubscribers.GetCount();
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+            arSubscribers[i](p1, p2, p3, p4, p5);
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T>
+class QConcurrentEvent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) > : public QConcurrentEventBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The functions called are those subscribed when the method starts; subscriptions made meanwhile by other threads will take effect the next time.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">An instance to be passed as fifth parameter to every function.</param>
+    /// <param name="p6">An instance to be passed as sixth parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6) const
+    {
+        const typename QConcurrentEvent::QScopedSnapshot snapshot(*this);
+        const typename QConcurrentEvent::SubscriberArray &arSubscribers = snapshot.GetSubscribers();
+        const pointer_uint_q COUNT = arSubscribers.GetCount();
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+            arSubscribers[i](p1, p2, p3, p4, p5, p6);
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param7T">The type of the seventh parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T>
+class QConcurrentEvent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) > : public QConcurrentEventBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The functions called are those subscribed when the method starts; subscriptions made meanwhile by other threads will take effect the next time.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">An instance to be passed as fifth parameter to every function.</param>
+    /// <param name="p6">An instance to be passed as sixth parameter to every function.</param>
+    /// <param name="p7">An instance to be passed as seventh parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7) const
+    {
+        const typename QConcurrentEvent::QScopedSnapshot snapshot(*this);
+        const typename QConcurrentEvent::SubscriberArray &arSubscribers = snapshot.GetSubscribers();
+        const pointer_uint_q COUNT = arSubscribers.GetCount();
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+            arSubscribers[i](p1, p2, p3, p4, p5, p6, p7);
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe and that can be raised by several threads at the same time, 
+/// even while other threads subscribe or unsubscribe functions. When an event is raised, all the functions subscribed to it 
+/// will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event never waits, so it is suitable for events raised frequently by several threads; subscriptions are 
+/// expected to be rare since they copy the whole list of subscribers.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param7T">The type of the seventh parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param8T">The type of the eighth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T, class Param8T>
+class QConcurrentEvent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) > : public QConcurrentEventBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The functions called are those subscribed when the method starts; subscriptions made meanwhile by other threads will take effect the next time.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">An instance to be passed as fifth parameter to every function.</param>
+    /// <param name="p6">An instance to be passed as sixth parameter to every function.</param>
+    /// <param name="p7">An instance to be passed as seventh parameter to every function.</param>
+    /// <param name="p8">An instance to be passed as eighth parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8) const
+    {
+        const typename QConcurrentEvent::QScopedSnapshot snapshot(*this);
+        const typename QConcurrentEvent::SubscriberArray &arSubscribers = snapshot.GetSubscribers();
+        const pointer_uint_q COUNT = arSubscribers.GetCount();
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+            arSubscribers[i](p1, p2, p3, p4, p5, p6, p7, p8);
+    }
+};
+
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QCONCURRENTEVENT__
@@ -32,6 +32,9 @@
 
 using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::i32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::i64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u16_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
 
 namespace Kinesis
@@ -64,6 +67,13 @@ class QE_LAYER_TOOLS_SYMBOLS QDateTime
 {
     // CONSTANTS
     // ---------------
+public:
+
+    /// <summary>
+    /// The maximum number of characters of a timestamp created by the ToString methods.
+    /// </summary>
+    static const unsigned int TIMESTAMP_MAXIMUM_LENGTH = 35U;
+
 private:
 
     /// <summary>
@@ -244,6 +254,28 @@ public:
     /// </remarks>
     /// <param name="strTimestamp">[IN] A valid timestamp compound of a date, a time or both. It must not be empty nor contain whitespaces.</param>
     QDateTime(const string_q &strTimestamp);
+
+    /// <summary>
+    /// Builds a valid date/time instance from a sequence of ASCII characters that contains a timestamp based on the ISO 8601:2004 standard.
+    /// </summary>
+    /// <remarks>
+    /// The same rules apply as when parsing a string. The characters are read directly, no memory is allocated.
+    /// </remarks>
+    /// <param name="arTimestamp">[IN] A valid timestamp compound of a date, a time or both. It must not be null nor contain whitespaces. 
+    /// It does not need to be null-terminated.</param>
+    /// <param name="uLength">[IN] The number of characters of the timestamp. It must be greater than zero.</param>
+    QDateTime(const i8_q* arTimestamp, const unsigned int uLength);
+
+    /// <summary>
+    /// Builds a valid date/time instance from a sequence of UTF-16 code units that contains a timestamp based on the ISO 8601:2004 standard.
+    /// </summary>
+    /// <remarks>
+    /// The same rules apply as when parsing a string. The code units are read directly, no memory is allocated.
+    /// </remarks>
+    /// <param name="arTimestamp">[IN] A valid timestamp compound of a date, a time or both. It must not be null nor contain whitespaces. 
+    /// It does not need to be null-terminated.</param>
+    /// <param name="uLength">[IN] The number of code units of the timestamp. It must be greater than zero.</param>
+    QDateTime(const u16_q* arTimestamp, const unsigned int uLength);
     
 
     // METHODS
@@ -442,6 +474,62 @@ public:
     /// A valid timestamp compound of the date and the time, including a time fraction and the time offset, if any.
     /// </returns>
     string_q ToString() const;
+
+    /// <summary>
+    /// Writes a timestamp that represents the date/time instance, following the ISO 8601:2004 standard, to a sequence of ASCII characters.
+    /// </summary>
+    /// <remarks>
+    /// The timestamp is the same as the one returned by ToString, but no memory is allocated. No null character is added at the end.<br/>
+    /// Undefined date/times cannot be represented as valid timestamps.
+    /// </remarks>
+    /// <param name="arTimestamp">[OUT] The array where the timestamp will be written. It must not be null and it must have room for,
+    /// at least, TIMESTAMP_MAXIMUM_LENGTH characters.</param>
+    /// <returns>
+    /// The number of characters written.
+    /// </returns>
+    unsigned int ToString(i8_q* arTimestamp) const;
+
+    /// <summary>
+    /// Writes a timestamp that represents the date/time instance, following the ISO 8601:2004 standard, to a sequence of UTF-16 code units.
+    /// </summary>
+    /// <remarks>
+    /// The timestamp is the same as the one returned by ToString, but no memory is allocated. No null character is added at the end.<br/>
+    /// Undefined date/times cannot be represented as valid timestamps.
+    /// </remarks>
+    /// <param name="arTimestamp">[OUT] The array where the timestamp will be written. It must not be null and it must have room for,
+    /// at least, TIMESTAMP_MAXIMUM_LENGTH code units.</param>
+    /// <returns>
+    /// The number of code units written.
+    /// </returns>
+    unsigned int ToString(u16_q* arTimestamp) const;
+
+    /// <summary>
+    /// Builds a date/time instance for every timestamp in a list, following the same rules as the constructor that receives a sequence 
+    /// of ASCII characters.
+    /// </summary>
+    /// <param name="arTimestamps">[IN] The list of timestamps. Neither the list nor any of its timestamps can be null.</param>
+    /// <param name="arLengths">[IN] The number of characters of every timestamp. It must not be null.</param>
+    /// <param name="uCount">[IN] The number of timestamps in the list.</param>
+    /// <param name="arDateTimes">[OUT] The array where the date/time instances will be stored, in the same order. It must not be null 
+    /// and it must have room for, at least, as many instances as timestamps.</param>
+    static void ParseTimestamps(const i8_q* const* arTimestamps, const unsigned int* arLengths, const unsigned int uCount, QDateTime* arDateTimes);
+
+    /// <summary>
+    /// Writes the timestamp of every date/time instance in a list to a sequence of ASCII characters, following the same rules as ToString.
+    /// </summary>
+    /// <remarks>
+    /// Every timestamp occupies a slot of TIMESTAMP_MAXIMUM_LENGTH characters in the output array, so the timestamp of the instance
+    /// at position N starts at position N * TIMESTAMP_MAXIMUM_LENGTH. The characters that remain in every slot after the timestamp are
+    /// not modified.<br/>
+    /// Undefined date/times cannot be represented as valid timestamps.
+    /// </remarks>
+    /// <param name="arDateTimes">[IN] The list of date/time instances. It must not be null.</param>
+    /// <param name="uCount">[IN] The number of date/time instances in the list.</param>
+    /// <param name="arTimestamps">[OUT] The array where the timestamps will be written. It must not be null and it must have room for,
+    /// at least, uCount * TIMESTAMP_MAXIMUM_LENGTH characters.</param>
+    /// <param name="arLengths">[OUT] The array where the number of characters of every timestamp will be stored. It must not be null 
+    /// and it must have room for, at least, as many lengths as date/time instances.</param>
+    static void FormatTimestamps(const QDateTime* arDateTimes, const unsigned int uCount, i8_q* arTimestamps, unsigned int* arLengths);
     
     /// <summary>
     /// Gets all the components of the date and the time, in local time.
@@ -530,20 +618,81 @@ private:
     /// </returns>
     QTimeSpan _GetInstantWithAddedTimeZoneOffset(const QTimeSpan &instant, const QTimeZone* pTimeZone) const;
     
+    /// <summary>
+    /// Gets all the components of the date and the time of an instant, with the time zone offset already applied.
+    /// </summary>
+    /// <param name="localTimeInstant">[IN] The instant, in local time.</param>
+    /// <param name="uYear">[OUT] The absolute value of the year.</param>
+    /// <param name="uMonth">[OUT] The value of the month, being 1 the value that represents January and 12 for December.</param>
+    /// <param name="uDay">[OUT] The value of the day, from 1 to 31.</param>
+    /// <param name="uHour">[OUT] The value of the hour, from 0 to 23.</param>
+    /// <param name="uMinute">[OUT] The value of the minute, from 0 to 59.</param>
+    /// <param name="uSecond">[OUT] The value of the second, from 0 to 59.</param>
+    /// <param name="uMillisecond">[OUT] The value of the millisecond, from 0 to 999.</param>
+    /// <param name="uMicrosecond">[OUT] The value of the microsecond, from 0 to 999.</param>
+    /// <param name="uHundredOfNanosecond">[OUT] The number of hundreds of nanoseconds, from 0 to 9.</param>
+    static void _DecomposeInstant(const QTimeSpan &localTimeInstant, unsigned int &uYear, unsigned int &uMonth,  unsigned int &uDay, 
+                                  unsigned int &uHour, unsigned int &uMinute, unsigned int &uSecond, 
+                                  unsigned int &uMillisecond, unsigned int &uMicrosecond, unsigned int &uHundredOfNanosecond);
+
+    /// <summary>
+    /// Parses a timestamp and stores the result in the date/time instance.
+    /// </summary>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The timestamp. It must not be empty nor contain whitespaces.</param>
+    /// <param name="uLength">[IN] The number of characters of the timestamp.</param>
+    template<class CharT>
+    void _ParseTimestamp(const CharT* arTimestamp, const unsigned int uLength);
+
+    /// <summary>
+    /// Searches for the first occurrence of a character in a range of a timestamp.
+    /// </summary>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The timestamp.</param>
+    /// <param name="uStart">[IN] The position of the first character of the range.</param>
+    /// <param name="uEnd">[IN] The position after the last character of the range.</param>
+    /// <param name="cCharacter">[IN] The character to search for.</param>
+    /// <returns>
+    /// The position of the character, if it was found; the end of the range otherwise.
+    /// </returns>
+    template<class CharT>
+    static unsigned int _FindCharacter(const CharT* arTimestamp, const unsigned int uStart, const unsigned int uEnd, const char cCharacter);
+
+    /// <summary>
+    /// Reads an integer number, optionally preceded by a sign, from a range of a timestamp.
+    /// </summary>
+    /// <remarks>
+    /// The reading stops at the first character that is not a digit.
+    /// </remarks>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The timestamp.</param>
+    /// <param name="uStart">[IN] The position of the first character of the range.</param>
+    /// <param name="uEnd">[IN] The position after the last character of the range. It may exceed the limit.</param>
+    /// <param name="uLimit">[IN] The position after the last character that can be read.</param>
+    /// <returns>
+    /// The number read. If the range is empty, it returns zero.
+    /// </returns>
+    template<class CharT>
+    static i64_q _ParseInteger(const CharT* arTimestamp, const unsigned int uStart, const unsigned int uEnd, const unsigned int uLimit);
+
     /// <summary>
     /// Parses a complete date from a timestamp.
     /// </summary>
-    /// <param name="strTimestamp">[IN] The original timestamp, which is a combination of date and time.</param>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The original timestamp, which is a combination of date and time.</param>
     /// <param name="uTPosition">[IN] The position of the date/time separator in the timestamp.</param>
     /// <param name="nYear">[OUT] The year read from the timestamp.</param>
     /// <param name="uMonth">[OUT] The month read from the timestamp.</param>
     /// <param name="uDay">[OUT] The day read from the timestamp.</param>
-    void _ParseTimestampCompleteDate(const string_q &strTimestamp, const u32_q uTPosition, i32_q &nYear, u32_q &uMonth, u32_q &uDay) const;
+    template<class CharT>
+    static void _ParseTimestampCompleteDate(const CharT* arTimestamp, const u32_q uTPosition, i32_q &nYear, u32_q &uMonth, u32_q &uDay);
 
     /// <summary>
     /// Parses a complete time from a timestamp.
     /// </summary>
-    /// <param name="strTimestamp">[IN] The original timestamp, which is a combination of date and time.</param>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The original timestamp, which is a combination of date and time.</param>
+    /// <param name="uLength">[IN] The number of characters of the timestamp.</param>
     /// <param name="uTPosition">[IN] The position of the date/time separator in the timestamp.</param>
     /// <param name="uHour">[OUT] The hour read from the timestamp.</param>
     /// <param name="uMinute">[OUT] The minute read from the timestamp.</param>
@@ -553,58 +702,79 @@ private:
     /// <param name="uHundredOfNanosecond">[OUT] The hundred of nanosecond read from the timestamp.</param>
     /// <param name="nOffsetHours">[OUT] The offset hour read from the timestamp.</param>
     /// <param name="uOffsetMinutes">[OUT] The offset minute read from the timestamp.</param>
-    void _ParseTimestampCompleteTime(const string_q &strTimestamp, const u32_q uTPosition, u32_q &uHour, u32_q &uMinute, u32_q &uSecond, u32_q &uMillisecond, 
-                                     u32_q &uMicrosecond, u32_q &uHundredOfNanosecond, i32_q &nOffsetHours, u32_q& uOffsetMinutes) const;
+    template<class CharT>
+    static void _ParseTimestampCompleteTime(const CharT* arTimestamp, const u32_q uLength, const u32_q uTPosition, u32_q &uHour, u32_q &uMinute, u32_q &uSecond, u32_q &uMillisecond, 
+                                            u32_q &uMicrosecond, u32_q &uHundredOfNanosecond, i32_q &nOffsetHours, u32_q& uOffsetMinutes);
 
     /// <summary>
     /// Parses a complete time from the time part of a timestamp, without fraction or time offset.
     /// </summary>
-    /// <param name="strTimeWithoutFraction">[IN] The time part of a timestamp, without fraction or time offset.</param>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The original timestamp.</param>
+    /// <param name="uStart">[IN] The position of the first character of the time part, without fraction or time offset.</param>
+    /// <param name="uEnd">[IN] The position after the last character of the time part, without fraction or time offset.</param>
     /// <param name="uHour">[OUT] The hour read from the timestamp.</param>
     /// <param name="uMinute">[OUT] The minute read from the timestamp.</param>
     /// <param name="uSecond">[OUT] The second read from the timestamp.</param>
-    void _ParseTimestampCompleteTimePart(const string_q& strTimeWithoutFraction, u32_q& uHour, u32_q& uMinute, u32_q& uSecond) const;
+    template<class CharT>
+    static void _ParseTimestampCompleteTimePart(const CharT* arTimestamp, const u32_q uStart, const u32_q uEnd, u32_q& uHour, u32_q& uMinute, u32_q& uSecond);
 
     /// <summary>
     /// Parses a time offset of a timestamp, including the sign. It may be incomplete and use either basic or extended formats.
     /// </summary>
-    /// <param name="strTimeOffset">[IN] The time offset of a timestamp.</param>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The original timestamp.</param>
+    /// <param name="uStart">[IN] The position of the sign of the time offset.</param>
+    /// <param name="uEnd">[IN] The position after the last character of the time offset.</param>
     /// <param name="nOffsetHours">[OUT] The offset hours read from the timestamp.</param>
     /// <param name="uOffsetMinutes">[OUT] The offset minutes read from the timestamp.</param>
-    void _ParseTimestampTimeOffset(const string_q& strTimeOffset, i32_q& nOffsetHours, u32_q& uOffsetMinutes) const;
+    template<class CharT>
+    static void _ParseTimestampTimeOffset(const CharT* arTimestamp, const u32_q uStart, const u32_q uEnd, i32_q& nOffsetHours, u32_q& uOffsetMinutes);
 
     /// <summary>
     /// Parses a fraction of second of a timestamp, without the initial separator.
     /// </summary>
-    /// <param name="strTimeFraction">[IN] The time fraction of a timestamp, without the initial separator.</param>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The original timestamp.</param>
+    /// <param name="uStart">[IN] The position of the first number of the fraction, after the separator.</param>
+    /// <param name="uEnd">[IN] The position after the last number of the fraction.</param>
     /// <param name="uMillisecond">[OUT] The milliseconds in the fraction.</param>
     /// <param name="uMicrosecond">[OUT] The microseconds in the fraction.</param>
     /// <param name="uHundredOfNanosecond">[OUT] The hundreds of nanoseconds in the fraction.</param>
-    void _ParseTimestampTimeFraction(const string_q& strTimeFraction, u32_q& uMillisecond, u32_q& uMicrosecond, u32_q& uHundredOfNanosecond) const;
+    template<class CharT>
+    static void _ParseTimestampTimeFraction(const CharT* arTimestamp, const u32_q uStart, const u32_q uEnd, u32_q& uMillisecond, u32_q& uMicrosecond, u32_q& uHundredOfNanosecond);
 
     /// <summary>
     /// Parses a date from a timestamp that may be incomplete and uses separators (extended format).
     /// </summary>
-    /// <param name="strTimestamp">[IN] The original timestamp.</param>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The original timestamp.</param>
+    /// <param name="uLength">[IN] The number of characters of the timestamp.</param>
     /// <param name="uFirstSeparatorPosition">[IN] The position of the first date separator in the timestamp.</param>
     /// <param name="nYear">[OUT] The year read from the timestamp.</param>
     /// <param name="uMonth">[OUT] The month read from the timestamp.</param>
     /// <param name="uDay">[OUT] The day read from the timestamp. It will be equal to 1 if the day was not provided.</param>
-    void _ParseTimestampIncompleteDateWithSeparators(const string_q &strTimestamp, const u32_q uFirstSeparatorPosition, i32_q &nYear, u32_q &uMonth, u32_q &uDay) const;
+    template<class CharT>
+    static void _ParseTimestampIncompleteDateWithSeparators(const CharT* arTimestamp, const u32_q uLength, const u32_q uFirstSeparatorPosition, i32_q &nYear, u32_q &uMonth, u32_q &uDay);
 
     /// <summary>
     /// Parses a date from a timestamp that may be incomplete and does not use separators (basic format).
     /// </summary>
-    /// <param name="strTimestamp">[IN] The original timestamp.</param>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The original timestamp.</param>
+    /// <param name="uLength">[IN] The number of characters of the timestamp.</param>
     /// <param name="nYear">[OUT] The year read from the timestamp.</param>
     /// <param name="uMonth">[OUT] The month read from the timestamp. It will be equal to 1 if the month was not provided.</param>
     /// <param name="uDay">[OUT] The day read from the timestamp. It will be equal to 1 if the day was not provided.</param>
-    void _ParseTimestampIncompleteDateWithoutSeparators(const string_q &strTimestamp, i32_q &nYear, u32_q &uMonth, u32_q &uDay) const;
+    template<class CharT>
+    static void _ParseTimestampIncompleteDateWithoutSeparators(const CharT* arTimestamp, const u32_q uLength, i32_q &nYear, u32_q &uMonth, u32_q &uDay);
 
     /// <summary>
     /// Parses a time from a timestamp which may be incomplete.
     /// </summary>
-    /// <param name="strTimestamp">[IN] The original timestamp, which is a time that may be incomplete, and that may not have fraction nor time offset.</param>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The original timestamp, which is a time that may be incomplete, and that may not have fraction nor time offset.</param>
+    /// <param name="uLength">[IN] The number of characters of the timestamp.</param>
     /// <param name="uHour">[OUT] The hour read from the timestamp.</param>
     /// <param name="uMinute">[OUT] The minute read from the timestamp. It will be equal to 0 if the minute was not provided.</param>
     /// <param name="uSecond">[OUT] The second read from the timestamp. It will be equal to 0 if the second was not provided.</param>
@@ -613,17 +783,21 @@ private:
     /// <param name="uHundredOfNanosecond">[OUT] The hundred of nanosecond read from the timestamp. It will be equal to 0 if the hundred of nanosecond was not provided.</param>
     /// <param name="nOffsetHours">[OUT] The offset hour read from the timestamp. It will be equal to 0 if the offset hours were not provided.</param>
     /// <param name="uOffsetMinutes">[OUT] The offset minute read from the timestamp. It will be equal to 0 if the offset minutes were not provided.</param>
-    void _ParseTimestampIncompleteTime(const string_q &strTimestamp, u32_q &uHour, u32_q &uMinute, u32_q &uSecond, u32_q &uMillisecond, u32_q &uMicrosecond, 
-                                       u32_q &uHundredOfNanosecond, i32_q &nOffsetHours, u32_q& uOffsetMinutes) const;
+    template<class CharT>
+    static void _ParseTimestampIncompleteTime(const CharT* arTimestamp, const u32_q uLength, u32_q &uHour, u32_q &uMinute, u32_q &uSecond, u32_q &uMillisecond, u32_q &uMicrosecond, 
+                                              u32_q &uHundredOfNanosecond, i32_q &nOffsetHours, u32_q& uOffsetMinutes);
 
     /// <summary>
     /// Parses a time from a timestamp which may be incomplete, without time offset or fraction.
     /// </summary>
-    /// <param name="strTimeWithoutFraction">[IN] The time part, which is a time that may be incomplete, and that may not have fraction nor time offset.</param>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[IN] The original timestamp.</param>
+    /// <param name="uEnd">[IN] The position after the last character of the time, without fraction or time offset.</param>
     /// <param name="uHour">[OUT] The hour read from the timestamp.</param>
     /// <param name="uMinute">[OUT] The minute read from the timestamp. It will be equal to 0 if the minute was not provided.</param>
     /// <param name="uSecond">[OUT] The second read from the timestamp. It will be equal to 0 if the second was not provided.</param>
-    void _ParseTimestampIncompleteTimePart(const string_q& strTimeWithoutFraction, u32_q& uHour, u32_q& uMinute, u32_q& uSecond) const;
+    template<class CharT>
+    static void _ParseTimestampIncompleteTimePart(const CharT* arTimestamp, const u32_q uEnd, u32_q& uHour, u32_q& uMinute, u32_q& uSecond);
 
     /// <summary>
     /// Parses a time from a timestamp which may be incomplete, without time offset or fraction.
@@ -646,14 +820,28 @@ private:
     void _ApplyOffsetToTimestampWithoutAffectingDate(const i32_q nOffsetHours, const u32_q uOffsetMinutes, const u32_q uHour, const u32_q uMinute, QDateTime &dateTime);
 
     /// <summary>
-    /// Transforms milliseconds, microseconds and hundreds of seconds to the fraction part of a timestamp, appending the result to the output timestamp.
-    /// If all the input values equal zero, no fraction will be appended.
+    /// Writes a timestamp that represents the date/time instance to a sequence of characters, decomposing the date and the time only once.
     /// </summary>
-    /// <param name="uMillisecond">[IN] The millisecond to transform.</param>
-    /// <param name="uMicrosecond">[IN] The microsecond to transform.</param>
-    /// <param name="uHundredOfNanosecond">[IN] The hundred of nanosecond to transform.</param>
-    /// <param name="strTimestamp">[OUT] The timestamp to which concatenate the fraction value, including the separator.</param>
-    void _SecondFractionToString(const unsigned int uMillisecond, const unsigned int uMicrosecond, const unsigned int uHundredOfNanosecond, string_q &strTimestamp) const;
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="arTimestamp">[OUT] The array where the timestamp will be written. It must have room for, at least, TIMESTAMP_MAXIMUM_LENGTH characters.</param>
+    /// <returns>
+    /// The number of characters written.
+    /// </returns>
+    template<class CharT>
+    unsigned int _FormatTimestamp(CharT* arTimestamp) const;
+
+    /// <summary>
+    /// Writes a number to a sequence of characters, padding it with zeroes on the left.
+    /// </summary>
+    /// <typeparam name="CharT">The type of the characters of the timestamp.</typeparam>
+    /// <param name="uValue">[IN] The number to write. It must fit in the given amount of digits.</param>
+    /// <param name="uDigits">[IN] The number of digits to write.</param>
+    /// <param name="arTimestamp">[OUT] The position where the first digit will be written.</param>
+    /// <returns>
+    /// The position after the last digit written.
+    /// </returns>
+    template<class CharT>
+    static CharT* _WriteDigits(const unsigned int uValue, const unsigned int uDigits, CharT* arTimestamp);
 
 
     // PROPERTIES
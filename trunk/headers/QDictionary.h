@@ -34,6 +34,10 @@
 #include "QBinarySearchTree.h"
 #include "SQKeyValuePairComparator.h"
 #include "SQAnyTypeToStringConverter.h"
+#include "SQBinarySerializer.h"
+#include "QStringUnicodeSerialization.h"
+#include "QBufferedBinaryWriter.h"
+#include "QBufferedBinaryReader.h"
 
 
 namespace Kinesis
@@ -51,7 +55,8 @@ namespace Containers
 /// </summary>
 /// <remarks>
 /// Key and value types are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
-/// If SQComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".
+/// If SQComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".<br/>
+/// Pairs are stored in a balanced binary search tree, so adding, removing and searching for keys takes logarithmic time regardless of the order of the keys.
 /// </remarks>
 /// <typeparam name="KeyT">The type of the keys associated to every value.</typeparam>
 /// <typeparam name="ValueT">The type of the values.</typeparam>
@@ -65,7 +70,7 @@ class QDictionary
     // ---------------
 protected:
 
-    typedef QBinarySearchTree<QKeyValuePair<KeyT, ValueT>, AllocatorT, SQKeyValuePairComparator<KeyT, ValueT, KeyComparatorT> > InternalBinaryTreeType;
+    typedef QBinarySearchTree<QKeyValuePair<KeyT, ValueT>, AllocatorT, SQKeyValuePairComparator<KeyT, ValueT, KeyComparatorT>, true> InternalBinaryTreeType;
     typedef QKeyValuePair<KeyT, ValueT> KeyValuePairType;
 
 
@@ -855,6 +860,65 @@ public:
         return !QDictionary::operator==(dictionary);
     }
 
+    /// <summary>
+    /// Writes the keys and values of the dictionary to a binary writer.
+    /// </summary>
+    /// <remarks>
+    /// Every key is followed by its value. Key-value pairs are written in the order of their keys; they are buffered and sent to the writer in blocks.
+    /// </remarks>
+    /// <typeparam name="WriterT">The type of the binary writer. It must provide a WriteBytes method and the left shift operator, like QBinaryStreamWriter does.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer to which the keys and values will be written.</param>
+    template<class WriterT>
+    void Serialize(WriterT &writer) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+        using Kinesis::QuimeraEngine::Common::DataTypes::QBufferedBinaryWriter;
+
+        SQBinarySerializer::WriteHeader(writer, SQBinarySerializer::GetElementSize<KeyT>() + SQBinarySerializer::GetElementSize<ValueT>(), this->GetCount());
+
+        QBufferedBinaryWriter<WriterT> bufferedWriter(writer);
+
+        for(typename InternalBinaryTreeType::QConstBinarySearchTreeIterator it = m_keyValues.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder); !it.IsEnd(); ++it)
+        {
+            SQBinarySerializer::Write(bufferedWriter, &it->GetKey(), 1U);
+            SQBinarySerializer::Write(bufferedWriter, &it->GetValue(), 1U);
+        }
+    }
+
+    /// <summary>
+    /// Replaces the content of the dictionary with the keys and values read from a binary reader.
+    /// </summary>
+    /// <remarks>
+    /// The memory is only reallocated if the capacity of the dictionary is not enough. Trivially copyable keys and values (see QSerializationTraits) 
+    /// are read from the reader in blocks. The types of the keys and values must be default-constructible.<br/>
+    /// The destructor of every existing key and value will be called.
+    /// </remarks>
+    /// <typeparam name="ReaderT">The type of the binary reader. It must provide a ReadBytes method and the right shift operator, like QBinaryStreamReader does.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the keys and values will be read. They must have been written by the Serialize method.</param>
+    template<class ReaderT>
+    void Deserialize(ReaderT &reader)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+        using Kinesis::QuimeraEngine::Common::DataTypes::QBufferedBinaryReader;
+
+        const pointer_uint_q PAIR_SIZE = SQBinarySerializer::GetElementSize<KeyT>() + SQBinarySerializer::GetElementSize<ValueT>();
+        const pointer_uint_q COUNT = SQBinarySerializer::ReadHeader(reader, PAIR_SIZE);
+
+        this->Clear();
+        this->Reserve(COUNT);
+
+        QBufferedBinaryReader<ReaderT> bufferedReader(reader, COUNT * PAIR_SIZE);
+        KeyT key;
+        ValueT value;
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+        {
+            SQBinarySerializer::Read(bufferedReader, &key, 1U);
+            SQBinarySerializer::Read(bufferedReader, &value, 1U);
+            this->Add(key, value);
+        }
+    }
+
 
     // PROPERTIES
     // ---------------
@@ -30,6 +30,7 @@
 #include "QBaseDualQuaternion.h"
 
 #include "SQFloat.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
 
@@ -595,4 +596,6 @@ private:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QDualQuaternion)
+
 #endif // __QDUALQUATERNION__
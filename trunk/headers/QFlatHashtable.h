@@ -0,0 +1,1455 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QFLATHASHTABLE__
+#define __QFLATHASHTABLE__
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+
+#include <cstring>
+
+#ifdef QE_SIMD_SSE2
+    #include <emmintrin.h> // SSE2 intrinsics
+#endif
+
+#ifdef QE_COMPILER_MSVC
+    #include <intrin.h> // _BitScanForward
+#endif
+
+#include "SQComparatorDefault.h"
+#include "QKeyValuePair.h"
+#include "SQIntegerHashProvider.h"
+#include "QPoolAllocator.h"
+#include "QAlignment.h"
+#include "SQAnyTypeToStringConverter.h"
+#include "QArrayResult.h"
+#include "EQIterationDirection.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a hash table, a data structure that acts as an associative array that maps unique keys to values, whose elements are stored inline.
+/// </summary>
+/// <remarks>
+/// The hash table is implemented following the open addressing model with linear probing. Slots are distributed in groups of 16; every group stores 
+/// the key-value pairs of its slots together with the hash of their keys and one control byte per slot. A control byte indicates whether the slot is empty, 
+/// whether its element was removed or, otherwise, contains 7 bits of the hash of the key. Searching a key means comparing its 7 bits to the 16 control bytes of 
+/// a group at once (using SSE2 when available) and only comparing keys whose hashes are equal, group after group until a group with an empty slot is found.<br/>
+/// Since there are no links to chase, it is faster than QHashtable for lookup-heavy workloads; on the other hand, adding or removing elements may move 
+/// key-value pairs to other positions in memory and the order of the elements when iterating is arbitrary.<br/>
+/// When the load factor (the number of used slots divided by the number of slots) exceeds a maximum, the number of groups is doubled and every element is 
+/// placed again using its stored hash, so the hash provider is called only once per key.<br/>
+/// Hash tables use a hash function or hash provider to compute an internal index that determines the position of a new key-value pair. Such provider depends on the key's data type.
+/// The provider is forced to implement a static method called GenerateHash, which receives a key and returns a hash that does not depend on the number of buckets 
+/// and may take any value of the range of pointer_uint_q.<br/>
+/// Keys and values are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
+/// If SQComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".
+/// </remarks>
+/// <typeparam name="KeyT">The type of the key associated to every value in the table.</typeparam>
+/// <typeparam name="ValueT">The type of the values stored in the table.</typeparam>
+/// <typeparam name="HashProviderT">Optional. The type of the hash provider, which must implement the GenerateHash method. By default, it is SQIntegerHashProvider.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of the allocator that reserves memory for the groups of slots. By default, it is QPoolAllocator.</typeparam>
+/// <typeparam name="KeyComparatorT">Optional. The type of comparator utilized to compare keys. The default type is SQComparatorDefault.</typeparam>
+/// <typeparam name="ValueComparatorT">Optional. The type of comparator utilized to compare values. The default type is SQComparatorDefault.</typeparam>
+template<class KeyT, class ValueT, class HashProviderT = SQIntegerHashProvider, 
+                                   class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, 
+                                   class KeyComparatorT = SQComparatorDefault<KeyT>, 
+                                   class ValueComparatorT = SQComparatorDefault<ValueT> >
+class QFlatHashtable
+{
+    // TYPEDEFS (I)
+    // ---------------
+protected:
+
+    typedef QKeyValuePair<KeyT, ValueT> KeyValuePairType;
+
+
+    // INTERNAL CLASSES
+    // -----------------
+public:
+
+    /// <summary>
+    /// Iterator that steps once per element of a flat hashtable and does not allow the modification of them. Elements are visited in an arbitrary order.
+    /// </summary>
+    /// <remarks>
+    /// Once an interator have been bound to a hashtable, it cannot point to another hashtable ever.<br/>
+    /// Iterators can be invalid, this means, they may not point to an existing position of the hashtable. Adding or removing elements may invalidate them.<br/>
+    /// The position just before the first element or just after the last one (end positions) are considered as valid positions.
+    /// </remarks>
+    class QConstFlatHashtableIterator
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the hashtable to iterate through and the position to physically point to. This constructor is intended 
+        /// to be used internally, use GetFirst or GetLast methods of the QFlatHashtable class instead.
+        /// </summary>
+        /// <param name="pHashtable">[IN] The hashtable to iterate through. It must not be null.</param>
+        /// <param name="uPosition">[IN] The position the iterator will point to. This is not the logical position of hashtable elements, but the physical.
+        /// It must be lower than the capacity of the hashtable.</param>
+        QConstFlatHashtableIterator(const QFlatHashtable* pHashtable, const pointer_uint_q uPosition) : m_pHashtable(pHashtable),
+                                                                                                        m_uPosition(uPosition)
+        {
+            QE_ASSERT_ERROR(pHashtable != null_q, "Invalid argument: The pointer to the hashtable cannot be null");
+            QE_ASSERT_WARNING(pHashtable->GetCapacity() > uPosition || 
+                              uPosition == QFlatHashtable::END_POSITION_BACKWARD || 
+                              uPosition == QFlatHashtable::END_POSITION_FORWARD, "Invalid argument: The position must be lower than the capacity of the hashtable");
+        }
+
+
+        // METHODS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Assignment operator that moves the iterator to the same position of other iterator.
+        /// </summary>
+        /// <param name="iterator">[IN] Iterator whose position will be copied. It must point to the same hashtable as the resident iterator.</param>
+        /// <returns>
+        /// A reference to the resident iterator.
+        /// </returns>
+        QConstFlatHashtableIterator& operator=(const QConstFlatHashtableIterator &iterator)
+        {
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid.");
+            QE_ASSERT_ERROR(m_pHashtable == iterator.m_pHashtable, "The input iterator points to a different hashtable.");
+
+            m_uPosition = iterator.m_uPosition;
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Indirection operator that returns a reference to the key-value pair the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A reference to the key-value pair the iterator points to. If the iterator is invalid or points to an end position,
+        /// the result is undefined.
+        /// </returns>
+        const KeyValuePairType& operator*() const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the reference to the hashtable element.");
+            QE_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the reference to the hashtable element.");
+
+            return *m_pHashtable->_GetSlot(m_uPosition);
+        }
+
+        /// <summary>
+        /// Dereferencing operator that returns a pointer to the key-value pair the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the key-value pair the iterator points to. If the iterator is invalid or points to an end position,
+        /// the result is undefined.
+        /// </returns>
+        const KeyValuePairType* operator->() const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the pointer to the hashtable element.");
+            QE_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the pointer to the hashtable element.");
+
+            return m_pHashtable->_GetSlot(m_uPosition);
+        }
+
+        /// <summary>
+        /// Post-increment operator that makes the iterator step forward after the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).<br/>
+        /// It is not possible to increment an invalid iterator.
+        /// </remarks>
+        /// <param name=".">[IN] Unused parameter.</param>
+        /// <returns>
+        /// A copy of the previous state of the iterator.
+        /// </returns>
+        QConstFlatHashtableIterator operator++(int)
+        {
+            QConstFlatHashtableIterator iteratorCopy = *this;
+            ++(*this);
+            return iteratorCopy;
+        }
+
+        /// <summary>
+        /// Post-decrement operator that makes the iterator step backward after the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to decrement an iterator that already points to the position before the first element (end position).<br/>
+        /// It is not possible to decrement an invalid iterator.
+        /// </remarks>
+        /// <param name=".">[IN] Unused parameter.</param>
+        /// <returns>
+        /// A copy of the previous state of the iterator.
+        /// </returns>
+        QConstFlatHashtableIterator operator--(int)
+        {
+            QConstFlatHashtableIterator iteratorCopy = *this;
+            --(*this);
+            return iteratorCopy;
+        }
+
+        /// <summary>
+        /// Pre-increment operator that makes the iterator step forward before the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).<br/>
+        /// It is not possible to increment an invalid iterator.
+        /// </remarks>
+        /// <returns>
+        /// A reference to the iterator.
+        /// </returns>
+        QConstFlatHashtableIterator& operator++()
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be incremented");
+            QE_ASSERT_WARNING(!this->IsEnd(EQIterationDirection::E_Forward), "The iterator points to an end position, it is not possible to increment it");
+
+            if(m_uPosition == QFlatHashtable::END_POSITION_BACKWARD)
+                m_uPosition = m_pHashtable->_FindUsedSlotForward(0);
+            else if(m_uPosition != QFlatHashtable::END_POSITION_FORWARD)
+                m_uPosition = m_pHashtable->_FindUsedSlotForward(m_uPosition + 1U);
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Pre-decrement operator that makes the iterator step backward before the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to decrement an iterator that already points to the position before the first element (end position).<br/>
+        /// It is not possible to decrement an invalid iterator.
+        /// </remarks>
+        /// <returns>
+        /// A reference to the iterator.
+        /// </returns>
+        QConstFlatHashtableIterator& operator--()
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be decremented");
+            QE_ASSERT_WARNING(!this->IsEnd(EQIterationDirection::E_Backward), "The iterator points to an end position, it is not possible to decrement it");
+
+            if(m_uPosition == QFlatHashtable::END_POSITION_FORWARD)
+                m_uPosition = m_pHashtable->_FindUsedSlotBackward(m_pHashtable->GetCapacity());
+            else if(m_uPosition != QFlatHashtable::END_POSITION_BACKWARD)
+                m_uPosition = m_pHashtable->_FindUsedSlotBackward(m_uPosition);
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Equality operator that checks if both iterators are the same.
+        /// </summary>
+        /// <remarks>
+        /// An iterator must point to the same position of the same hashtable to be considered equal.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if they are pointing to the same position of the same hashtable; False otherwise.
+        /// </returns>
+        bool operator==(const QConstFlatHashtableIterator &iterator) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            QE_ASSERT_ERROR(m_pHashtable == iterator.m_pHashtable, "Iterators point to different hashtables");
+
+            return m_pHashtable == iterator.m_pHashtable && m_uPosition == iterator.m_uPosition;
+        }
+
+        /// <summary>
+        /// Inequality operator that checks if both iterators are different.
+        /// </summary>
+        /// <remarks>
+        /// An iterator that points to a different position or to a different hashtable is considered distinct.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if they are pointing to the a different position or a different hashtable; False otherwise.
+        /// </returns>
+        bool operator!=(const QConstFlatHashtableIterator &iterator) const
+        {
+            return !this->operator==(iterator);
+        }
+
+        /// <summary>
+        /// Greater than operator that checks whether resident iterator points to a more posterior position than the input iterator.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different hashtables or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more posterior position than the input iterator; False otherwise.
+        /// </returns>
+        bool operator>(const QConstFlatHashtableIterator &iterator) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            QE_ASSERT_ERROR(m_pHashtable == iterator.m_pHashtable, "Iterators point to different hashtables");
+
+            // The backward end position (-1) becomes zero and the forward end position (-2) becomes the maximum value
+            return m_uPosition + 1U > iterator.m_uPosition + 1U;
+        }
+
+        /// <summary>
+        /// Lower than operator that checks whether resident iterator points to a more anterior position than the input iterator.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different hashtables or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more anterior position than the input iterator; False otherwise.
+        /// </returns>
+        bool operator<(const QConstFlatHashtableIterator &iterator) const
+        {
+            return iterator > *this;
+        }
+
+        /// <summary>
+        /// Greater than or equal to operator that checks whether resident iterator points to a more posterior position than the
+        /// input iterator or to the same position.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different hashtables or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more posterior position than the input iterator or to the same position; False otherwise.
+        /// </returns>
+        bool operator>=(const QConstFlatHashtableIterator &iterator) const
+        {
+            return !(iterator > *this);
+        }
+
+        /// <summary>
+        /// Lower than or equal to operator that checks whether resident iterator points to a more anterior position than the input
+        /// iterator or to the same position.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different hashtables or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more anterior position than the input iterator or to the same position; False otherwise.
+        /// </returns>
+        bool operator<=(const QConstFlatHashtableIterator &iterator) const
+        {
+            return !(*this > iterator);
+        }
+
+        /// <summary>
+        /// Indicates whether the iterator is pointing to one of the ends of the hashtable.
+        /// </summary>
+        /// <remarks>
+        /// The position immediately before the first element and the position immediately after the last element are cosidered end
+        /// positions; therefore, this method can be used for both forward and backard iteration.<br/>
+        /// An invalid iterator is not considered as an end position.
+        /// </remarks>
+        /// <returns>
+        /// True if the iterator is pointing to an end position; False otherwise.
+        /// </returns>
+        bool IsEnd() const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+
+            return m_uPosition == QFlatHashtable::END_POSITION_BACKWARD || m_uPosition == QFlatHashtable::END_POSITION_FORWARD;
+        }
+
+        /// <summary>
+        /// Indicates whether the iterator is pointing to one of the ends of the hashtable, distinguishing which of them.
+        /// </summary>
+        /// <remarks>
+        /// The position immediately before the first element and the position immediately after the last element are cosidered end
+        /// positions; therefore, this method can be used for both forward and backard iteration.<br/>
+        /// An invalid iterator is not considered as an end position.
+        /// </remarks>
+        /// <param name="eIterationDirection">[IN] The iteration direction used to identify which of the end positions is checked.</param>
+        /// <returns>
+        /// True if the iterator is pointing to the position after the last element when iterating forward or if it is
+        /// pointing to the position immediately before the first position when iterating backward; False otherwise.
+        /// </returns>
+        bool IsEnd(const EQIterationDirection &eIterationDirection) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+
+            return (eIterationDirection == EQIterationDirection::E_Backward && m_uPosition == QFlatHashtable::END_POSITION_BACKWARD) ||
+                   (eIterationDirection == EQIterationDirection::E_Forward  && m_uPosition == QFlatHashtable::END_POSITION_FORWARD);
+        }
+
+        /// <summary>
+        /// Makes the iterator point to the first position.
+        /// </summary>
+        /// <remarks>
+        /// If the hashtable is empty, the iterator will point to the end position (forward iteration).
+        /// </remarks>
+        void MoveFirst()
+        {
+            m_uPosition = m_pHashtable->_FindUsedSlotForward(0);
+        }
+
+        /// <summary>
+        /// Makes the iterator point to the last position.
+        /// </summary>
+        /// <remarks>
+        /// If the hashtable is empty, the iterator will point to the end position (forward iteration).
+        /// </remarks>
+        void MoveLast()
+        {
+            m_uPosition = m_pHashtable->IsEmpty() ? QFlatHashtable::END_POSITION_FORWARD : 
+                                                    m_pHashtable->_FindUsedSlotBackward(m_pHashtable->GetCapacity());
+        }
+
+        /// <summary>
+        /// Checks whether the iterator is valid or not.
+        /// </summary>
+        /// <remarks>
+        /// An iterator is considered invalid when it points to an unexisting position. If the hashtable to iterate has been destroyed, there is no way 
+        /// for the iterator to realize that so its behavior is undefined and this method will not detect that situation.<br/>
+        /// The position before the first element or after the last one (end positions) are considered as valid positions.
+        /// </remarks>
+        /// <returns>
+        /// True if the iterator is valid; False otherwise.
+        /// </returns>
+        bool IsValid() const
+        {
+            return m_pHashtable != null_q && 
+                   ((m_uPosition < m_pHashtable->GetCapacity() && m_pHashtable->_IsSlotUsed(m_uPosition)) ||
+                    m_uPosition == QFlatHashtable::END_POSITION_BACKWARD ||
+                    m_uPosition == QFlatHashtable::END_POSITION_FORWARD);
+        }
+        
+        /// <summary>
+        /// Gets the container that is being traversed by the iterator.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the container. It never changes since the iterator is created.
+        /// </returns>
+        const QFlatHashtable* GetContainer() const
+        {
+            return m_pHashtable;
+        }
+        
+        /// <summary>
+        /// Gets the "physical" position of the container's allocated buffer where the iterator is pointing to.
+        /// </summary>
+        /// <remarks>
+        /// This method is intended to be used internally by containers, users should not call it.
+        /// </remarks>
+        /// <returns>
+        /// The position the iterator points to.
+        /// </returns>
+        pointer_uint_q GetInternalPosition() const
+        {
+            return m_uPosition;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    protected:
+        
+        /// <summary>
+        /// The traversed hashtable.
+        /// </summary>
+        const QFlatHashtable* m_pHashtable;
+
+        /// <summary>
+        /// The position of the slot the iterator points to.
+        /// </summary>
+        pointer_uint_q m_uPosition;
+
+    }; // QConstFlatHashtableIterator
+
+
+    // TYPEDEFS (II)
+    // ---------------
+public:
+
+    typedef typename QFlatHashtable::QConstFlatHashtableIterator ConstIterator;
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The position before the first element.
+    /// </summary>
+    static const pointer_uint_q END_POSITION_BACKWARD = -1;
+
+    /// <summary>
+    /// The position after the last element.
+    /// </summary>
+    static const pointer_uint_q END_POSITION_FORWARD = -2;
+
+    /// <summary>
+    /// The number of slots per group, whose control bytes are checked at once.
+    /// </summary>
+    static const pointer_uint_q GROUP_SIZE = 16;
+
+    /// <summary>
+    /// The control byte of a slot that has never been used since the last rehash. Searches stop at groups that contain one.
+    /// </summary>
+    static const u8_q CONTROL_EMPTY = 0x80;
+
+    /// <summary>
+    /// The control byte of a slot whose element was removed. Searches continue through it.
+    /// </summary>
+    static const u8_q CONTROL_DELETED = 0xFE;
+
+    /// <summary>
+    /// The offset, in bytes, of the array of hashes in every group. The array of key-value pairs is placed at the beginning of the group.
+    /// </summary>
+    static const pointer_uint_q HASHES_OFFSET = (QFlatHashtable::GROUP_SIZE * sizeof(KeyValuePairType) + sizeof(pointer_uint_q) - 1U) / sizeof(pointer_uint_q) * sizeof(pointer_uint_q);
+
+    /// <summary>
+    /// The offset, in bytes, of the array of control bytes in every group.
+    /// </summary>
+    static const pointer_uint_q CONTROL_OFFSET = QFlatHashtable::HASHES_OFFSET + QFlatHashtable::GROUP_SIZE * sizeof(pointer_uint_q);
+
+    /// <summary>
+    /// The alignment of every group, which is the strictest between the alignment of key-value pairs and hashes.
+    /// </summary>
+    static const pointer_uint_q GROUP_ALIGNMENT = alignof_q(KeyValuePairType) > alignof_q(pointer_uint_q) ? alignof_q(KeyValuePairType) : alignof_q(pointer_uint_q);
+
+    /// <summary>
+    /// The size, in bytes, of every group, which is a block of the allocator.
+    /// </summary>
+    static const pointer_uint_q GROUP_BLOCK_SIZE = (QFlatHashtable::CONTROL_OFFSET + QFlatHashtable::GROUP_SIZE + QFlatHashtable::GROUP_ALIGNMENT - 1U) / QFlatHashtable::GROUP_ALIGNMENT * QFlatHashtable::GROUP_ALIGNMENT;
+
+private:
+
+    /// <summary>
+    /// The maximum ratio of used slots, including those whose elements were removed, to slots before the number of groups grows. It must be greater than zero and lower than 1.
+    /// </summary>
+    static float MAX_LOAD_FACTOR;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Default constructor that creates a hashtable with one group of slots.
+    /// </summary>
+    QFlatHashtable() : m_allocator(QFlatHashtable::GROUP_BLOCK_SIZE, QFlatHashtable::GROUP_BLOCK_SIZE, Kinesis::QuimeraEngine::Common::Memory::QAlignment(QFlatHashtable::GROUP_ALIGNMENT)),
+                       m_pGroupBasePointer(null_q),
+                       m_uGroupCount(0),
+                       m_uCount(0),
+                       m_uDeletedCount(0)
+    {
+        this->_ResizeGroups(1U);
+    }
+    
+    /// <summary>
+    /// Constructor that receives the number of elements the hashtable can store before growing.
+    /// </summary>
+    /// <remarks>
+    /// The actual capacity is rounded up to a power of two number of groups of slots, taking into account the maximum load factor.
+    /// </remarks>
+    /// <param name="uInitialCapacity">[IN] The number of elements for which to reserve memory.</param>
+    explicit QFlatHashtable(const pointer_uint_q uInitialCapacity) : m_allocator(QFlatHashtable::_GetRequiredGroupCount(uInitialCapacity) * QFlatHashtable::GROUP_BLOCK_SIZE, 
+                                                                                 QFlatHashtable::GROUP_BLOCK_SIZE, 
+                                                                                 Kinesis::QuimeraEngine::Common::Memory::QAlignment(QFlatHashtable::GROUP_ALIGNMENT)),
+                                                                     m_pGroupBasePointer(null_q),
+                                                                     m_uGroupCount(0),
+                                                                     m_uCount(0),
+                                                                     m_uDeletedCount(0)
+    {
+        this->_ResizeGroups(QFlatHashtable::_GetRequiredGroupCount(uInitialCapacity));
+    }
+    
+    /// <summary>
+    /// Copy constructor that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor is called for every copied key and value, in an arbitrary order. Hashes are copied, the hash provider is not called.<br/>
+    /// The capacity of the resultant hashtable is equal to the capacity of the input hashtable.
+    /// </remarks>
+    /// <param name="hashtable">[IN] The other hashtable to be copied.</param>
+    QFlatHashtable(const QFlatHashtable &hashtable) : m_allocator(hashtable.m_uGroupCount * QFlatHashtable::GROUP_BLOCK_SIZE, 
+                                                                  QFlatHashtable::GROUP_BLOCK_SIZE, 
+                                                                  Kinesis::QuimeraEngine::Common::Memory::QAlignment(QFlatHashtable::GROUP_ALIGNMENT)),
+                                                      m_pGroupBasePointer(null_q),
+                                                      m_uGroupCount(0),
+                                                      m_uCount(0),
+                                                      m_uDeletedCount(0)
+    {
+        this->_ResizeGroups(hashtable.m_uGroupCount);
+        this->_CopyElements(hashtable);
+    }
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every key and value will be called in an undetermined order.
+    /// </remarks>
+    ~QFlatHashtable()
+    {
+        this->_DestroyElements();
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Increases the capacity of the hashtable, reserving memory for more elements.
+    /// </summary>
+    /// <remarks>
+    /// All the elements are placed again, using their stored hashes, so adding them later does not require any rehash.<br/>
+    /// This operation implies a reallocation, which means that any pointer to elements of this hashtable will be pointing to garbage.
+    /// </remarks>
+    /// <param name="uNumberOfElements">[IN] The number of key-value pairs for which to reserve memory. It should be greater than the
+    /// current capacity or nothing will happen.</param>
+    void Reserve(const pointer_uint_q uNumberOfElements)
+    {
+        const pointer_uint_q REQUIRED_GROUPS = QFlatHashtable::_GetRequiredGroupCount(uNumberOfElements);
+
+        if(REQUIRED_GROUPS > m_uGroupCount)
+            this->_Rehash(REQUIRED_GROUPS);
+    }
+
+    /// <summary>
+    /// Adds a key and its associated value to the hashtable.
+    /// </summary>
+    /// <remarks>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this hashtable will be pointing to garbage.<br/>
+    /// The copy constructor of both the new key and the new value will be called.
+    /// </remarks>
+    /// <param name="key">[IN] The new key. It must not exist in the hashtable yet.</param>
+    /// <param name="value">[IN] The new value associated to the new key.</param>
+    /// <returns>
+    /// An iterator that points to the just added key-value pair.
+    /// </returns>
+    QConstFlatHashtableIterator Add(const KeyT &key, const ValueT &value)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
+
+        const pointer_uint_q HASH = QFlatHashtable::_GenerateHash(key);
+
+        QE_ASSERT_ERROR(this->_FindSlot(key, HASH) == QFlatHashtable::END_POSITION_FORWARD, string_q("The new key (") + SQAnyTypeToStringConverter::Convert(key) + ") already exists in the hashtable.");
+
+        // The number of groups grows when there are too many used slots; if most of them belong to removed elements, they are just cleaned
+        if(scast_q(m_uCount + m_uDeletedCount + 1U, float) > scast_q(this->GetCapacity(), float) * QFlatHashtable::MAX_LOAD_FACTOR)
+        {
+            const bool TOO_MANY_ELEMENTS = scast_q(m_uCount + 1U, float) * 2.0f > scast_q(this->GetCapacity(), float) * QFlatHashtable::MAX_LOAD_FACTOR;
+            this->_Rehash(TOO_MANY_ELEMENTS ? m_uGroupCount * 2U : m_uGroupCount);
+        }
+
+        const pointer_uint_q SLOT_POSITION = this->_AddElement(key, value, HASH);
+
+        return QFlatHashtable::QConstFlatHashtableIterator(this, SLOT_POSITION);
+    }
+    
+    /// <summary>
+    /// Array subscript operator that receives a key and retrieves its associated value.
+    /// </summary>
+    /// <param name="key">[IN] A key whose associated value will be obtained. It must exist in the hashtable.</param>
+    /// <returns>
+    /// A reference to the associated value.
+    /// </returns>
+    ValueT& operator[](const KeyT &key) const
+    {
+        return this->GetValue(key);
+    }
+    
+    /// <summary>
+    /// Gets the value that corresponds to the given key.
+    /// </summary>
+    /// <param name="key">[IN] A key whose associated value will be obtained. It must exist in the hashtable.</param>
+    /// <returns>
+    /// A reference to the associated value.
+    /// </returns>
+    ValueT& GetValue(const KeyT& key) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
+
+        const pointer_uint_q SLOT_POSITION = this->_FindSlot(key, QFlatHashtable::_GenerateHash(key));
+
+        QE_ASSERT_ERROR(SLOT_POSITION != QFlatHashtable::END_POSITION_FORWARD, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
+
+        return ccast_q(this->_GetSlot(SLOT_POSITION)->GetValue(), ValueT&);
+    }
+
+    /// <summary>
+    /// Sets the value that corresponds to the given key.
+    /// </summary>
+    /// <remarks>
+    /// It calls the assignment operator of the value.
+    /// </remarks>
+    /// <param name="key">[IN] A key whose associated value will be modified. It must exist in the hashtable.</param>
+    /// <param name="newValue">[IN] The value that will replace the existing one.</param>
+    void SetValue(const KeyT& key, const ValueT& newValue) const
+    {
+        this->GetValue(key) = newValue;
+    }
+    
+    /// <summary>
+    /// Checks whether there is any key in the hashtable that is equal to other given key.
+    /// </summary>
+    /// <remarks>
+    /// Keys are compared to the provided key using the container's key comparator.<br/>
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// True if the key is present in the hashtable; False otherwise.
+    /// </returns>
+    bool ContainsKey(const KeyT &key) const
+    {
+        return this->_FindSlot(key, QFlatHashtable::_GenerateHash(key)) != QFlatHashtable::END_POSITION_FORWARD;
+    }
+    
+    /// <summary>
+    /// Removes an key-value pair from the hashtable by its key.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of both the key and the value will be called.<br/>
+    /// The other elements are not moved.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for. It must exist in the hashtable.</param>
+    void Remove(const KeyT &key)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
+
+        const pointer_uint_q SLOT_POSITION = this->_FindSlot(key, QFlatHashtable::_GenerateHash(key));
+
+        QE_ASSERT_ERROR(SLOT_POSITION != QFlatHashtable::END_POSITION_FORWARD, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
+
+        if(SLOT_POSITION != QFlatHashtable::END_POSITION_FORWARD)
+        {
+            const pointer_uint_q GROUP = SLOT_POSITION / QFlatHashtable::GROUP_SIZE;
+            u8_q* pControlBytes = QFlatHashtable::_GetControlBytes(m_pGroupBasePointer, GROUP);
+
+            this->_GetSlot(SLOT_POSITION)->~KeyValuePairType();
+
+            // If the group has an empty slot, no search ever continued to the next group so the slot can be emptied too
+            if(QFlatHashtable::_MatchControlByte(pControlBytes, QFlatHashtable::CONTROL_EMPTY) != 0)
+            {
+                pControlBytes[SLOT_POSITION % QFlatHashtable::GROUP_SIZE] = QFlatHashtable::CONTROL_EMPTY;
+            }
+            else
+            {
+                pControlBytes[SLOT_POSITION % QFlatHashtable::GROUP_SIZE] = QFlatHashtable::CONTROL_DELETED;
+                ++m_uDeletedCount;
+            }
+
+            --m_uCount;
+        }
+    }
+    
+    /// <summary>
+    /// Gets an iterator that points to the first position.
+    /// </summary>
+    /// <remarks>
+    /// If the hashtable is empty, the iterator will point to the end position (forward iteration).
+    /// </remarks>
+    /// <returns>
+    /// An iterator that points to the first position.
+    /// </returns>
+    QConstFlatHashtableIterator GetFirst() const
+    {
+        QFlatHashtable::QConstFlatHashtableIterator iterator(this, QFlatHashtable::END_POSITION_FORWARD);
+        iterator.MoveFirst();
+        return iterator;
+    }
+    
+    /// <summary>
+    /// Gets an iterator that points to the last position.
+    /// </summary>
+    /// <remarks>
+    /// If the hashtable is empty, the iterator will point to the end position (forward iteration).
+    /// </remarks>
+    /// <returns>
+    /// An iterator that points to the last position.
+    /// </returns>
+    QConstFlatHashtableIterator GetLast() const
+    {
+        QFlatHashtable::QConstFlatHashtableIterator iterator(this, QFlatHashtable::END_POSITION_FORWARD);
+        iterator.MoveLast();
+        return iterator;
+    }
+    
+    /// <summary>
+    /// Searches for a given key and obtains its position.
+    /// </summary>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// An iterator that points to the position of the key. If the key is not present in the hashtable, the iterator will point to the end position.
+    /// </returns>
+    QConstFlatHashtableIterator PositionOfKey(const KeyT &key) const
+    {
+        return QFlatHashtable::QConstFlatHashtableIterator(this, this->_FindSlot(key, QFlatHashtable::_GenerateHash(key)));
+    }
+    
+    /// <summary>
+    /// Equality operator that checks whether two hashtables are equal.
+    /// </summary>
+    /// <remarks>
+    /// Keys and values are compared using the hashtable's key and value comparator, respectively.
+    /// The order in which key-value pairs were added is not relevant.
+    /// </remarks>
+    /// <param name="hashtable">[IN] The hashtable to compare to.</param>
+    /// <returns>
+    /// True if all the keys and values of both hashtables are equal; False otherwise.
+    /// </returns>
+    bool operator==(const QFlatHashtable &hashtable) const
+    {
+        bool bResult = this->GetCount() == hashtable.GetCount();
+
+        if(bResult && this != &hashtable)
+        {
+            QFlatHashtable::QConstFlatHashtableIterator itThisKeyValuePair = this->GetFirst();
+
+            while(!itThisKeyValuePair.IsEnd() && bResult)
+            {
+                const pointer_uint_q HASH = *QFlatHashtable::_GetHash(m_pGroupBasePointer, itThisKeyValuePair.GetInternalPosition());
+                const pointer_uint_q FOUND_POSITION = hashtable._FindSlot(itThisKeyValuePair->GetKey(), HASH);
+
+                bResult = FOUND_POSITION != QFlatHashtable::END_POSITION_FORWARD && 
+                          ValueComparatorT::Compare(itThisKeyValuePair->GetValue(), hashtable._GetSlot(FOUND_POSITION)->GetValue()) == 0;
+                ++itThisKeyValuePair;
+            }
+        }
+
+        return bResult;
+    }
+    
+    /// <summary>
+    /// Inequality operator that checks whether two hashtables are different.
+    /// </summary>
+    /// <remarks>
+    /// Keys and values are compared using the hashtable's key and value comparators, respectively.
+    /// The order in which key-value pairs were added is not relevant.
+    /// </remarks>
+    /// <param name="hashtable">[IN] The hashtable to compare to.</param>
+    /// <returns>
+    /// True if any of the keys or values are different; False otherwise.
+    /// </returns>
+    bool operator!=(const QFlatHashtable &hashtable) const
+    {
+        return !this->operator==(hashtable);
+    }
+        
+    /// <summary>
+    /// Assignment operator that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// All the elements in the resident hashtable will be firstly removed, calling each keys's and value's destructor.
+    /// The copy constructor is then called for every copied key and value, in an arbitrary order. Hashes are copied, the hash provider is not called.
+    /// </remarks>
+    /// <param name="hashtable">[IN] The other hashtable to be copied.</param>
+    /// <returns>
+    /// A reference to the resultant hashtable.
+    /// </returns>
+    QFlatHashtable& operator=(const QFlatHashtable &hashtable)
+    {
+        if(this != &hashtable)
+        {
+            this->_DestroyElements();
+            this->_ResizeGroups(m_uGroupCount > hashtable.m_uGroupCount ? m_uGroupCount : hashtable.m_uGroupCount);
+            this->_CopyElements(hashtable);
+        }
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Performs a shallow copy of the content of the hashtable to another hashtable.
+    /// </summary>
+    /// <remarks>
+    /// Care must be taken when instances store pointers to other objects (like strings do); cloning such types may lead to hard-to-debug errors.<br/>
+    /// If the capacity of the destination hashtable is lower than the resident's, it will reserve more memory before the copy takes place.<br/>
+    /// No constructors will be called during this operation.
+    /// </remarks>
+    /// <param name="destinationHashtable">[IN/OUT] The destination hashtable to which the contents will be copied.</param>
+    void Clone(QFlatHashtable &destinationHashtable) const
+    {
+        if(destinationHashtable.m_allocator.GetPoolSize() < m_allocator.GetPoolSize())
+            destinationHashtable.m_allocator.Reallocate(m_allocator.GetPoolSize());
+
+        m_allocator.CopyTo(destinationHashtable.m_allocator);
+        destinationHashtable.m_pGroupBasePointer = scast_q(destinationHashtable.m_allocator.GetPointer(), u8_q*);
+        destinationHashtable.m_uGroupCount = m_uGroupCount;
+        destinationHashtable.m_uCount = m_uCount;
+        destinationHashtable.m_uDeletedCount = m_uDeletedCount;
+    }
+
+protected:
+
+    /// <summary>
+    /// Generates the hash of a key, which does not depend on the number of groups.
+    /// </summary>
+    /// <remarks>
+    /// The hash returned by the provider is scrambled (Fibonacci hashing) so consecutive keys, like integers, do not fill consecutive slots.
+    /// </remarks>
+    /// <param name="key">[IN] The key whose hash is to be generated.</param>
+    /// <returns>
+    /// The hash of the key.
+    /// </returns>
+    static pointer_uint_q _GenerateHash(const KeyT &key)
+    {
+        static const pointer_uint_q GOLDEN_RATIO = scast_q(0x9E3779B97F4A7C15ULL, pointer_uint_q);
+        static const pointer_uint_q HALF_BITS = sizeof(pointer_uint_q) * 4U;
+
+        const pointer_uint_q HASH = HashProviderT::GenerateHash(key) * GOLDEN_RATIO;
+        return HASH ^ (HASH >> HALF_BITS);
+    }
+
+    /// <summary>
+    /// Gets the 7 bits of a hash that are stored in the control byte of a slot.
+    /// </summary>
+    /// <param name="uHash">[IN] The hash of a key.</param>
+    /// <returns>
+    /// The 7 most significant bits of the hash.
+    /// </returns>
+    static u8_q _GetControlHash(const pointer_uint_q uHash)
+    {
+        return scast_q(uHash >> (sizeof(pointer_uint_q) * 8U - 7U), u8_q);
+    }
+
+    /// <summary>
+    /// Compares a value to the 16 control bytes of a group.
+    /// </summary>
+    /// <param name="pControlBytes">[IN] The control bytes of a group. It must not be null.</param>
+    /// <param name="uValue">[IN] The value to compare to.</param>
+    /// <returns>
+    /// A mask where every bit whose position corresponds to a control byte equal to the value is set.
+    /// </returns>
+    static u32_q _MatchControlByte(const u8_q* pControlBytes, const u8_q uValue)
+    {
+#ifdef QE_SIMD_SSE2
+        const __m128i CONTROL_BYTES = _mm_loadu_si128(rcast_q(pControlBytes, const __m128i*));
+        return scast_q(_mm_movemask_epi8(_mm_cmpeq_epi8(CONTROL_BYTES, _mm_set1_epi8(scast_q(uValue, char)))), u32_q);
+#else
+        u32_q uMask = 0;
+
+        for(u32_q uByte = 0; uByte < QFlatHashtable::GROUP_SIZE; ++uByte)
+            uMask |= (pControlBytes[uByte] == uValue ? 1U : 0) << uByte;
+
+        return uMask;
+#endif
+    }
+
+    /// <summary>
+    /// Checks which of the 16 control bytes of a group belong to slots that do not contain elements, either empty or removed.
+    /// </summary>
+    /// <param name="pControlBytes">[IN] The control bytes of a group. It must not be null.</param>
+    /// <returns>
+    /// A mask where every bit whose position corresponds to a free slot is set.
+    /// </returns>
+    static u32_q _MatchFreeControlBytes(const u8_q* pControlBytes)
+    {
+#ifdef QE_SIMD_SSE2
+        // Only empty and removed slots have the most significant bit set
+        return scast_q(_mm_movemask_epi8(_mm_loadu_si128(rcast_q(pControlBytes, const __m128i*))), u32_q);
+#else
+        u32_q uMask = 0;
+
+        for(u32_q uByte = 0; uByte < QFlatHashtable::GROUP_SIZE; ++uByte)
+            uMask |= ((pControlBytes[uByte] & 0x80U) != 0 ? 1U : 0) << uByte;
+
+        return uMask;
+#endif
+    }
+
+    /// <summary>
+    /// Gets the position of the least significant bit that is set in a mask.
+    /// </summary>
+    /// <param name="uMask">[IN] A mask. It must not be zero.</param>
+    /// <returns>
+    /// The position of the bit.
+    /// </returns>
+    static u32_q _GetLowestBitPosition(const u32_q uMask)
+    {
+#ifdef QE_COMPILER_MSVC
+        unsigned long uPosition = 0;
+        _BitScanForward(&uPosition, uMask);
+        return scast_q(uPosition, u32_q);
+#else
+        return scast_q(__builtin_ctz(uMask), u32_q);
+#endif
+    }
+
+    /// <summary>
+    /// Gets the control bytes of a group.
+    /// </summary>
+    /// <param name="pGroups">[IN] The memory block where groups are stored.</param>
+    /// <param name="uGroup">[IN] The index of the group.</param>
+    /// <returns>
+    /// A pointer to the first control byte of the group.
+    /// </returns>
+    static u8_q* _GetControlBytes(u8_q* pGroups, const pointer_uint_q uGroup)
+    {
+        return pGroups + uGroup * QFlatHashtable::GROUP_BLOCK_SIZE + QFlatHashtable::CONTROL_OFFSET;
+    }
+
+    /// <summary>
+    /// Gets the stored hash of the key of a slot.
+    /// </summary>
+    /// <param name="pGroups">[IN] The memory block where groups are stored.</param>
+    /// <param name="uPosition">[IN] The position of the slot.</param>
+    /// <returns>
+    /// A pointer to the hash.
+    /// </returns>
+    static pointer_uint_q* _GetHash(u8_q* pGroups, const pointer_uint_q uPosition)
+    {
+        return rcast_q(pGroups + (uPosition / QFlatHashtable::GROUP_SIZE) * QFlatHashtable::GROUP_BLOCK_SIZE + QFlatHashtable::HASHES_OFFSET, pointer_uint_q*) + 
+               uPosition % QFlatHashtable::GROUP_SIZE;
+    }
+
+    /// <summary>
+    /// Gets the key-value pair of a slot.
+    /// </summary>
+    /// <param name="pGroups">[IN] The memory block where groups are stored.</param>
+    /// <param name="uPosition">[IN] The position of the slot.</param>
+    /// <returns>
+    /// A pointer to the key-value pair.
+    /// </returns>
+    static KeyValuePairType* _GetSlot(u8_q* pGroups, const pointer_uint_q uPosition)
+    {
+        return rcast_q(pGroups + (uPosition / QFlatHashtable::GROUP_SIZE) * QFlatHashtable::GROUP_BLOCK_SIZE, KeyValuePairType*) + 
+               uPosition % QFlatHashtable::GROUP_SIZE;
+    }
+
+    /// <summary>
+    /// Gets the key-value pair of a slot of the hashtable.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the slot. It must be lower than the capacity.</param>
+    /// <returns>
+    /// A pointer to the key-value pair.
+    /// </returns>
+    KeyValuePairType* _GetSlot(const pointer_uint_q uPosition) const
+    {
+        return QFlatHashtable::_GetSlot(m_pGroupBasePointer, uPosition);
+    }
+
+    /// <summary>
+    /// Indicates whether a slot of the hashtable contains an element.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the slot. It must be lower than the capacity.</param>
+    /// <returns>
+    /// True if the slot contains an element; False otherwise.
+    /// </returns>
+    bool _IsSlotUsed(const pointer_uint_q uPosition) const
+    {
+        return (QFlatHashtable::_GetControlBytes(m_pGroupBasePointer, uPosition / QFlatHashtable::GROUP_SIZE)[uPosition % QFlatHashtable::GROUP_SIZE] & 0x80U) == 0;
+    }
+
+    /// <summary>
+    /// Searches for a key, probing groups from the one that corresponds to its hash until it is found or a group with an empty slot is reached.
+    /// </summary>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <param name="uHash">[IN] The hash of the key.</param>
+    /// <returns>
+    /// The position of the slot that contains the key. If the key was not found, it equals the end position.
+    /// </returns>
+    pointer_uint_q _FindSlot(const KeyT &key, const pointer_uint_q uHash) const
+    {
+        const u8_q CONTROL_HASH = QFlatHashtable::_GetControlHash(uHash);
+        const pointer_uint_q GROUP_MASK = m_uGroupCount - 1U;
+        pointer_uint_q uGroup = uHash & GROUP_MASK;
+
+        for(pointer_uint_q uProbe = 0; uProbe < m_uGroupCount; ++uProbe)
+        {
+            const u8_q* pControlBytes = QFlatHashtable::_GetControlBytes(m_pGroupBasePointer, uGroup);
+            u32_q uMatches = QFlatHashtable::_MatchControlByte(pControlBytes, CONTROL_HASH);
+
+            // Keys are compared only when the complete hashes are equal
+            while(uMatches != 0)
+            {
+                const pointer_uint_q POSITION = uGroup * QFlatHashtable::GROUP_SIZE + QFlatHashtable::_GetLowestBitPosition(uMatches);
+
+                if(*QFlatHashtable::_GetHash(m_pGroupBasePointer, POSITION) == uHash && 
+                   KeyComparatorT::Compare(QFlatHashtable::_GetSlot(m_pGroupBasePointer, POSITION)->GetKey(), key) == 0)
+                    return POSITION;
+
+                uMatches &= uMatches - 1U;
+            }
+
+            if(QFlatHashtable::_MatchControlByte(pControlBytes, QFlatHashtable::CONTROL_EMPTY) != 0)
+                break;
+
+            uGroup = (uGroup + 1U) & GROUP_MASK;
+        }
+
+        return QFlatHashtable::END_POSITION_FORWARD;
+    }
+
+    /// <summary>
+    /// Searches for the first slot that does not contain any element, probing groups from the one that corresponds to a hash.
+    /// </summary>
+    /// <remarks>
+    /// There must be at least one free slot in the hashtable.
+    /// </remarks>
+    /// <param name="uHash">[IN] The hash of a key.</param>
+    /// <returns>
+    /// The position of the free slot.
+    /// </returns>
+    pointer_uint_q _FindFreeSlot(const pointer_uint_q uHash) const
+    {
+        const pointer_uint_q GROUP_MASK = m_uGroupCount - 1U;
+        pointer_uint_q uGroup = uHash & GROUP_MASK;
+        u32_q uFreeSlots = QFlatHashtable::_MatchFreeControlBytes(QFlatHashtable::_GetControlBytes(m_pGroupBasePointer, uGroup));
+
+        while(uFreeSlots == 0)
+        {
+            uGroup = (uGroup + 1U) & GROUP_MASK;
+            uFreeSlots = QFlatHashtable::_MatchFreeControlBytes(QFlatHashtable::_GetControlBytes(m_pGroupBasePointer, uGroup));
+        }
+
+        return uGroup * QFlatHashtable::GROUP_SIZE + QFlatHashtable::_GetLowestBitPosition(uFreeSlots);
+    }
+
+    /// <summary>
+    /// Searches for the first slot that contains an element, starting at a given position and moving forward.
+    /// </summary>
+    /// <param name="uFirstPosition">[IN] The position of the first slot to check.</param>
+    /// <returns>
+    /// The position of the slot. If there is no element, it equals the forward end position.
+    /// </returns>
+    pointer_uint_q _FindUsedSlotForward(const pointer_uint_q uFirstPosition) const
+    {
+        static const u32_q GROUP_MASK = (1U << QFlatHashtable::GROUP_SIZE) - 1U;
+
+        pointer_uint_q uGroup = uFirstPosition / QFlatHashtable::GROUP_SIZE;
+        u32_q uFirstSlotMask = GROUP_MASK << (uFirstPosition % QFlatHashtable::GROUP_SIZE);
+
+        // Whole groups are skipped when all their slots are free
+        for(; uGroup < m_uGroupCount; ++uGroup)
+        {
+            const u32_q USED_SLOTS = ~QFlatHashtable::_MatchFreeControlBytes(QFlatHashtable::_GetControlBytes(m_pGroupBasePointer, uGroup)) & uFirstSlotMask & GROUP_MASK;
+
+            if(USED_SLOTS != 0)
+                return uGroup * QFlatHashtable::GROUP_SIZE + QFlatHashtable::_GetLowestBitPosition(USED_SLOTS);
+
+            uFirstSlotMask = GROUP_MASK;
+        }
+
+        return QFlatHashtable::END_POSITION_FORWARD;
+    }
+
+    /// <summary>
+    /// Searches for the last slot that contains an element, before a given position.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position after the first slot to check.</param>
+    /// <returns>
+    /// The position of the slot. If there is no element, it equals the backward end position.
+    /// </returns>
+    pointer_uint_q _FindUsedSlotBackward(const pointer_uint_q uPosition) const
+    {
+        for(pointer_uint_q uSlot = uPosition; uSlot > 0; --uSlot)
+        {
+            if(this->_IsSlotUsed(uSlot - 1U))
+                return uSlot - 1U;
+        }
+
+        return QFlatHashtable::END_POSITION_BACKWARD;
+    }
+
+    /// <summary>
+    /// Stores a key-value pair in the first free slot for its hash, without checking whether the hashtable has to grow.
+    /// </summary>
+    /// <param name="key">[IN] The new key. It must not exist in the hashtable yet.</param>
+    /// <param name="value">[IN] The new value associated to the new key.</param>
+    /// <param name="uHash">[IN] The hash of the key.</param>
+    /// <returns>
+    /// The position of the slot.
+    /// </returns>
+    pointer_uint_q _AddElement(const KeyT &key, const ValueT &value, const pointer_uint_q uHash)
+    {
+        const pointer_uint_q SLOT_POSITION = this->_FindFreeSlot(uHash);
+        u8_q &uControlByte = QFlatHashtable::_GetControlBytes(m_pGroupBasePointer, SLOT_POSITION / QFlatHashtable::GROUP_SIZE)[SLOT_POSITION % QFlatHashtable::GROUP_SIZE];
+
+        if(uControlByte == QFlatHashtable::CONTROL_DELETED)
+            --m_uDeletedCount;
+
+        new(this->_GetSlot(SLOT_POSITION)) KeyValuePairType(key, value);
+        *QFlatHashtable::_GetHash(m_pGroupBasePointer, SLOT_POSITION) = uHash;
+        uControlByte = QFlatHashtable::_GetControlHash(uHash);
+        ++m_uCount;
+
+        return SLOT_POSITION;
+    }
+
+    /// <summary>
+    /// Copies all the elements of other hashtable, along with their hashes.
+    /// </summary>
+    /// <remarks>
+    /// The resident hashtable must be empty and have, at least, as many groups as the input hashtable.
+    /// </remarks>
+    /// <param name="hashtable">[IN] The hashtable whose elements are to be copied.</param>
+    void _CopyElements(const QFlatHashtable &hashtable)
+    {
+        for(QFlatHashtable::QConstFlatHashtableIterator it = hashtable.GetFirst(); !it.IsEnd(); ++it)
+            this->_AddElement(it->GetKey(), it->GetValue(), *QFlatHashtable::_GetHash(hashtable.m_pGroupBasePointer, it.GetInternalPosition()));
+    }
+
+    /// <summary>
+    /// Calls the destructor of every key and value and empties all the slots.
+    /// </summary>
+    void _DestroyElements()
+    {
+        for(pointer_uint_q uPosition = this->_FindUsedSlotForward(0); uPosition != QFlatHashtable::END_POSITION_FORWARD; uPosition = this->_FindUsedSlotForward(uPosition + 1U))
+            this->_GetSlot(uPosition)->~KeyValuePairType();
+
+        m_uCount = 0;
+    }
+
+    /// <summary>
+    /// Changes the number of groups, reallocating memory if necessary, and empties all the slots.
+    /// </summary>
+    /// <remarks>
+    /// Elements are neither destroyed nor moved.
+    /// </remarks>
+    /// <param name="uGroupCount">[IN] The new number of groups. It must be a power of two.</param>
+    void _ResizeGroups(const pointer_uint_q uGroupCount)
+    {
+        const pointer_uint_q REQUIRED_SIZE = uGroupCount * QFlatHashtable::GROUP_BLOCK_SIZE;
+
+        if(REQUIRED_SIZE > m_allocator.GetPoolSize())
+            m_allocator.Reallocate(REQUIRED_SIZE);
+
+        // Blocks are never deallocated, so the group N is always the block N of the pool
+        while(m_allocator.GetAllocatedBytes() < REQUIRED_SIZE)
+            m_allocator.Allocate();
+
+        m_pGroupBasePointer = scast_q(m_allocator.GetPointer(), u8_q*);
+        m_uGroupCount = uGroupCount;
+        m_uDeletedCount = 0;
+
+        for(pointer_uint_q uGroup = 0; uGroup < m_uGroupCount; ++uGroup)
+            memset(QFlatHashtable::_GetControlBytes(m_pGroupBasePointer, uGroup), QFlatHashtable::CONTROL_EMPTY, QFlatHashtable::GROUP_SIZE);
+    }
+
+    /// <summary>
+    /// Places all the elements again in a given number of groups, using their stored hashes, which removes the marks of removed elements.
+    /// </summary>
+    /// <remarks>
+    /// Key-value pairs are moved bitwise, no constructor, destructor or hash provider is called.
+    /// </remarks>
+    /// <param name="uGroupCount">[IN] The new number of groups. It must be a power of two, greater than or equal to the current number of groups.</param>
+    void _Rehash(const pointer_uint_q uGroupCount)
+    {
+        using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+        // The resident allocator exchanges the current groups for an empty pool of the new size, the current groups are freed when
+        // all the elements have been placed again
+        const pointer_uint_q OLD_GROUP_COUNT = m_uGroupCount;
+        AllocatorT oldGroups(uGroupCount * QFlatHashtable::GROUP_BLOCK_SIZE, QFlatHashtable::GROUP_BLOCK_SIZE, QAlignment(QFlatHashtable::GROUP_ALIGNMENT));
+        m_allocator.Swap(oldGroups);
+        u8_q* pOldGroups = scast_q(oldGroups.GetPointer(), u8_q*);
+
+        this->_ResizeGroups(uGroupCount);
+
+        for(pointer_uint_q uGroup = 0; uGroup < OLD_GROUP_COUNT; ++uGroup)
+        {
+            const u8_q* pOldControlBytes = QFlatHashtable::_GetControlBytes(pOldGroups, uGroup);
+
+            for(pointer_uint_q uSlot = 0; uSlot < QFlatHashtable::GROUP_SIZE; ++uSlot)
+            {
+                if((pOldControlBytes[uSlot] & 0x80U) == 0)
+                {
+                    const pointer_uint_q OLD_POSITION = uGroup * QFlatHashtable::GROUP_SIZE + uSlot;
+                    const pointer_uint_q HASH = *QFlatHashtable::_GetHash(pOldGroups, OLD_POSITION);
+                    const pointer_uint_q NEW_POSITION = this->_FindFreeSlot(HASH);
+
+                    memcpy(this->_GetSlot(NEW_POSITION), QFlatHashtable::_GetSlot(pOldGroups, OLD_POSITION), sizeof(KeyValuePairType));
+                    *QFlatHashtable::_GetHash(m_pGroupBasePointer, NEW_POSITION) = HASH;
+                    QFlatHashtable::_GetControlBytes(m_pGroupBasePointer, NEW_POSITION / QFlatHashtable::GROUP_SIZE)[NEW_POSITION % QFlatHashtable::GROUP_SIZE] = pOldControlBytes[uSlot];
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Calculates the number of groups required to store a number of elements without exceeding the maximum load factor.
+    /// </summary>
+    /// <param name="uNumberOfElements">[IN] The number of elements.</param>
+    /// <returns>
+    /// The number of groups, which is a power of two.
+    /// </returns>
+    static pointer_uint_q _GetRequiredGroupCount(const pointer_uint_q uNumberOfElements)
+    {
+        pointer_uint_q uGroupCount = 1U;
+
+        while(scast_q(uGroupCount * QFlatHashtable::GROUP_SIZE, float) * QFlatHashtable::MAX_LOAD_FACTOR < scast_q(uNumberOfElements, float))
+            uGroupCount *= 2U;
+
+        return uGroupCount;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of slots of the hashtable.
+    /// </summary>
+    /// <remarks>
+    /// The hashtable grows before all the slots are used, according to the maximum load factor.
+    /// </remarks>
+    /// <returns>
+    /// The number of slots.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_uGroupCount * QFlatHashtable::GROUP_SIZE;
+    }
+
+    /// <summary>
+    /// Gets the allocator of the groups of slots.
+    /// </summary>
+    /// <returns>
+    /// The allocator that stores the key-value pairs, their hashes and the control bytes.
+    /// </returns>
+    const AllocatorT* GetAllocator() const
+    {
+        return &m_allocator;
+    }
+
+    /// <summary>
+    /// Gets the number of elements added to the hashtable.
+    /// </summary>
+    /// <returns>
+    /// The number of elements in the hashtable.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_uCount;
+    }
+
+    /// <summary>
+    /// Indicates whether the hashtable is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if the hashtable is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_uCount == 0;
+    }
+    
+    /// <summary>
+    /// Gets the load factor of the hashtable, that is, the ratio of elements to slots.
+    /// </summary>
+    /// <returns>
+    /// The number of elements divided by the number of slots.
+    /// </returns>
+    float GetLoadFactor() const
+    {
+        return scast_q(m_uCount, float) / scast_q(this->GetCapacity(), float);
+    }
+    
+    /// <summary>
+    /// Gets all the existing keys from the hashtable.
+    /// </summary>
+    /// <returns>
+    /// An array of keys, in an undefined order. If the hashtable is empty, a null pointer is returned. The wrapper is attached to the array.
+    /// </returns>
+    Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult<KeyT> GetKeys() const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+
+        KeyT* arKeys = null_q;
+
+        // If the hashtable is empty, a null pointer will be returned
+        if(m_uCount != 0)
+            arKeys = new KeyT[m_uCount];
+
+        pointer_uint_q uKey = 0;
+
+        for(QFlatHashtable::QConstFlatHashtableIterator it = this->GetFirst(); !it.IsEnd(); ++it, ++uKey)
+            arKeys[uKey] = it->GetKey();
+
+        return QArrayResult<KeyT>(arKeys, uKey);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The allocator of the groups of slots. Every block is a group.
+    /// </summary>
+    AllocatorT m_allocator;
+
+    /// <summary>
+    /// The address of the first group.
+    /// </summary>
+    u8_q* m_pGroupBasePointer;
+
+    /// <summary>
+    /// The number of groups of slots. It is always a power of two.
+    /// </summary>
+    pointer_uint_q m_uGroupCount;
+
+    /// <summary>
+    /// The number of elements in the hashtable.
+    /// </summary>
+    pointer_uint_q m_uCount;
+
+    /// <summary>
+    /// The number of slots whose elements were removed and have not been emptied yet.
+    /// </summary>
+    pointer_uint_q m_uDeletedCount;
+
+};
+
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class KeyT, class ValueT, class HashProviderT, class AllocatorT, class KeyComparatorT, class ValueComparatorT>
+float QFlatHashtable<KeyT, ValueT, HashProviderT, AllocatorT, KeyComparatorT, ValueComparatorT>::MAX_LOAD_FACTOR = 0.875f;
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QFLATHASHTABLE__
@@ -0,0 +1,202 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QFRUSTUM__
+#define __QFRUSTUM__
+
+#include "ToolsDefinitions.h"
+#include "QPlane.h"
+#include "QVector3.h"
+#include "QBaseOrb.h"
+#include "QBaseHexahedron.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Math
+{
+
+// Forward declarations
+// ---------------------
+class QSpaceConversionMatrix;
+class QSoAPointBuffer;
+
+
+/// <summary>
+/// Convex volume delimited by six planes, like the region of the space a camera can see, used to discard the objects that are 
+/// outside of it before drawing them (frustum culling).
+/// </summary>
+/// <remarks>
+/// The planes are normalized and their normals point to the inside of the frustum, so the visible space is the intersection of the 
+/// positive sides of all of them.<br/>
+/// Objects are discarded only when they are completely in the negative side of a plane; objects that touch a plane are visible.
+/// This is conservative: a few objects near the edges of the frustum may be considered visible although they are not.<br/>
+/// Big sets of bounding volumes should be stored as structures of arrays (QSoAPointBuffer) and classified with FindVisible, 
+/// which checks 4 objects per instruction when math vectorization is enabled.
+/// </remarks>
+class QE_LAYER_TOOLS_SYMBOLS QFrustum
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The number of planes that delimit the frustum.
+    /// </summary>
+    static const unsigned int PLANE_COUNT;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the six planes of the frustum.
+    /// </summary>
+    /// <param name="leftPlane">[IN] The left plane. Its normal must point to the inside of the frustum. It must not be null.</param>
+    /// <param name="rightPlane">[IN] The right plane. Its normal must point to the inside of the frustum. It must not be null.</param>
+    /// <param name="bottomPlane">[IN] The bottom plane. Its normal must point to the inside of the frustum. It must not be null.</param>
+    /// <param name="topPlane">[IN] The top plane. Its normal must point to the inside of the frustum. It must not be null.</param>
+    /// <param name="nearPlane">[IN] The near plane. Its normal must point to the inside of the frustum. It must not be null.</param>
+    /// <param name="farPlane">[IN] The far plane. Its normal must point to the inside of the frustum. It must not be null.</param>
+    QFrustum(const QBasePlane &leftPlane, const QBasePlane &rightPlane, const QBasePlane &bottomPlane, 
+             const QBasePlane &topPlane, const QBasePlane &nearPlane, const QBasePlane &farPlane);
+
+    /// <summary>
+    /// Constructor that extracts the planes of the frustum from the combination of a view and a projection matrix.
+    /// </summary>
+    /// <remarks>
+    /// The frustum is obtained in the space the view matrix transforms from, usually the world space. If the matrix also includes
+    /// the world space matrix of an object, the frustum is obtained in the local space of that object.<br/>
+    /// The projection must map the depth of the visible points to values between 0 and 1, like QSpaceConversionMatrix::SetProjectionSpaceMatrix does.
+    /// </remarks>
+    /// <param name="viewProjection">[IN] The product of the view space matrix and the projection space matrix, in that order.</param>
+    explicit QFrustum(const QSpaceConversionMatrix &viewProjection);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Checks whether an orb or a sphere is, at least partially, inside the frustum.
+    /// </summary>
+    /// <param name="orb">[IN] The orb or sphere.</param>
+    /// <returns>
+    /// True if the orb is not completely in the negative side of any plane; False otherwise.
+    /// </returns>
+    bool IsVisible(const QBaseOrb<QVector3> &orb) const;
+
+    /// <summary>
+    /// Checks whether a hexahedron is, at least partially, inside the frustum.
+    /// </summary>
+    /// <param name="hexahedron">[IN] The hexahedron.</param>
+    /// <returns>
+    /// True if the vertices of the hexahedron are not all in the negative side of any plane; False otherwise.
+    /// </returns>
+    bool IsVisible(const QBaseHexahedron<QVector3> &hexahedron) const;
+
+    /// <summary>
+    /// Searches for the orbs or spheres that are, at least partially, inside the frustum.
+    /// </summary>
+    /// <param name="centers">[IN] The centers of the orbs.</param>
+    /// <param name="arRadii">[IN] The radius of every orb. It must contain as many elements as centers. It must not be null unless there are no centers.</param>
+    /// <param name="arVisibleIndices">[OUT] An array where the positions of the visible orbs will be stored, in ascending order. It must be 
+    /// able to contain as many elements as centers. It must not be null unless there are no centers.</param>
+    /// <returns>
+    /// The number of visible orbs.
+    /// </returns>
+    unsigned int FindVisible(const QSoAPointBuffer &centers, const float_q* arRadii, unsigned int* arVisibleIndices) const;
+
+    /// <summary>
+    /// Searches for the axis-aligned boxes that are, at least partially, inside the frustum.
+    /// </summary>
+    /// <param name="centers">[IN] The centers of the boxes.</param>
+    /// <param name="halfSizes">[IN] Half the size of every box along every axis. It must contain as many points as centers and none of
+    /// their components can be negative.</param>
+    /// <param name="arVisibleIndices">[OUT] An array where the positions of the visible boxes will be stored, in ascending order. It must be 
+    /// able to contain as many elements as centers. It must not be null unless there are no centers.</param>
+    /// <returns>
+    /// The number of visible boxes.
+    /// </returns>
+    unsigned int FindVisible(const QSoAPointBuffer &centers, const QSoAPointBuffer &halfSizes, unsigned int* arVisibleIndices) const;
+
+    /// <summary>
+    /// Searches for the hexahedra that are, at least partially, inside the frustum.
+    /// </summary>
+    /// <remarks>
+    /// Every hexahedron requires 8 vertices per plane, so storing axis-aligned bounding boxes as structures of arrays is much faster for 
+    /// big sets of objects.
+    /// </remarks>
+    /// <param name="arHexahedra">[IN] The hexahedra. It must not be null unless the number of hexahedra is zero.</param>
+    /// <param name="uCount">[IN] The number of hexahedra.</param>
+    /// <param name="arVisibleIndices">[OUT] An array where the positions of the visible hexahedra will be stored, in ascending order. It must be 
+    /// able to contain as many elements as hexahedra. It must not be null unless the number of hexahedra is zero.</param>
+    /// <returns>
+    /// The number of visible hexahedra.
+    /// </returns>
+    unsigned int FindVisible(const QBaseHexahedron<QVector3>* arHexahedra, const unsigned int uCount, unsigned int* arVisibleIndices) const;
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets one of the planes of the frustum.
+    /// </summary>
+    /// <param name="uIndex">[IN] The index of the plane, lower than PLANE_COUNT: 0 for the left plane, 1 for the right plane, 2 for the bottom
+    /// plane, 3 for the top plane, 4 for the near plane and 5 for the far plane.</param>
+    /// <returns>
+    /// The normalized plane, whose normal points to the inside of the frustum.
+    /// </returns>
+    const QPlane& GetPlane(const unsigned int uIndex) const;
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The normalized planes, in the order left, right, bottom, top, near and far.
+    /// </summary>
+    QPlane m_arPlanes[6];
+
+};
+
+} //namespace Math
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QFRUSTUM__
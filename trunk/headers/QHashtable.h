@@ -38,6 +38,10 @@
 #include "QPoolAllocator.h"
 #include "SQAnyTypeToStringConverter.h"
 #include "QArrayResult.h"
+#include "SQBinarySerializer.h"
+#include "QStringUnicodeSerialization.h"
+#include "QBufferedBinaryWriter.h"
+#include "QBufferedBinaryReader.h"
 
 
 namespace Kinesis
@@ -54,15 +58,20 @@ namespace Containers
 /// </summary>
 /// <remarks>
 /// Currently, the hash table is implemented following the separate-chaining model (a.k.a. closed addressing or open hashing). An array is filled with buckets which point to slots 
-/// (colliding elements) stored as key-value pairs into a single shared double-linked list; this allows every bucket to grow indefinitely. The array of buckets can grow too 
-/// although it implies rehashing everything.<br/>
-/// Hash tables use a hash function or hash provider to compute an internal index that determines the position of a new key-value pair. Such provider depends on the key's data type.<br/>
+/// (colliding elements) stored as key-value pairs into a single shared double-linked list; this allows every bucket to grow indefinitely. Every slot keeps the complete hash 
+/// of its key and the position of the next slot in the same bucket.<br/>
+/// When the load factor (the number of slots divided by the number of buckets) exceeds a maximum, the array of buckets doubles its size. Slots are moved to the new 
+/// array incrementally, a few buckets every time an element is added or removed, so no single operation pays for rehashing everything. Since hashes are stored, 
+/// the hash provider is never called while rehashing and keys or values are never copied.<br/>
+/// Hash tables use a hash function or hash provider to compute an internal index that determines the position of a new key-value pair. Such provider depends on the key's data type.
+/// The provider is forced to implement a static method called GenerateHash, which receives a key and returns a hash that does not depend on the number of buckets 
+/// and may take any value of the range of pointer_uint_q.<br/>
 /// Keys and values are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
 /// If SQComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".
 /// </remarks>
 /// <typeparam name="KeyT">The type of the key associated to every value in the table.</typeparam>
 /// <typeparam name="ValueT">The type of the values stored in the table.</typeparam>
-/// <typeparam name="HashProviderT">Optional. The type of the hash provider. By default, it is SQIntegerHashProvider.</typeparam>
+/// <typeparam name="HashProviderT">Optional. The type of the hash provider, which must implement the GenerateHash method. By default, it is SQIntegerHashProvider.</typeparam>
 /// <typeparam name="AllocatorT">Optional. The type of the allocator that reserves memory for keys, values and buckets. By default, it is QPoolAllocator.</typeparam>
 /// <typeparam name="KeyComparatorT">Optional. The type of comparator utilized to compare keys. The default type is SQComparatorDefault.</typeparam>
 /// <typeparam name="ValueComparatorT">Optional. The type of comparator utilized to compare values. The default type is SQComparatorDefault.</typeparam>
@@ -163,6 +172,85 @@ public:
     };
 
 
+    /// <summary>
+    /// Stores the hash of the key of a slot and the position of the next slot in the same bucket.
+    /// </summary>
+    class QSlotInfo
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor that sets up the information about a slot that does not belong to any bucket.
+        /// </summary>
+        QSlotInfo() : m_uHash(0),
+                      m_uNextSlotPosition(QHashtable::END_POSITION_FORWARD)
+        {
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+        
+        /// <summary>
+        /// Gets the complete hash of the key of the slot, as generated by the hash provider.
+        /// </summary>
+        /// <returns>
+        /// The hash of the key.
+        /// </returns>
+        pointer_uint_q GetHash() const
+        {
+            return m_uHash;
+        }
+        
+        /// <summary>
+        /// Sets the complete hash of the key of the slot.
+        /// </summary>
+        /// <param name="uHash">[IN] The hash of the key.</param>
+        void SetHash(const pointer_uint_q uHash)
+        {
+            m_uHash = uHash;
+        }
+        
+        /// <summary>
+        /// Gets the position of the next slot in the same bucket.
+        /// </summary>
+        /// <returns>
+        /// The position of the next slot. If it is the last slot of the bucket, it equals the end position.
+        /// </returns>
+        pointer_uint_q GetNextSlotPosition() const
+        {
+            return m_uNextSlotPosition;
+        }
+        
+        /// <summary>
+        /// Sets the position of the next slot in the same bucket.
+        /// </summary>
+        /// <param name="uPosition">[IN] The position of the next slot. If it is the last slot of the bucket, it must equal the end position.</param>
+        void SetNextSlotPosition(const pointer_uint_q uPosition)
+        {
+            m_uNextSlotPosition = uPosition;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+        
+        /// <summary>
+        /// The complete hash of the key of the slot.
+        /// </summary>
+        pointer_uint_q m_uHash;
+        
+        /// <summary>
+        /// The physical position of the next slot of the same bucket in the slot list.
+        /// </summary>
+        pointer_uint_q m_uNextSlotPosition;
+    };
+
+
     /// <summary>
     /// Iterator that steps once per key-value pair of a hashtable, in an undefined order.
     /// </summary>
@@ -573,6 +661,7 @@ public:
 protected:
 
     typedef QArrayDynamic<QBucket> BucketsArrayType;
+    typedef QArrayDynamic<QSlotInfo> SlotInfoArrayType;
 
 
     // CONSTANTS
@@ -589,6 +678,18 @@ protected:
     /// </summary>
     static const pointer_uint_q END_POSITION_BACKWARD = -1;
 
+    /// <summary>
+    /// The number of buckets moved to the new array of buckets every time an element is added or removed while rehashing.
+    /// </summary>
+    static const pointer_uint_q REHASHED_BUCKETS_PER_OPERATION = 4;
+
+private:
+
+    /// <summary>
+    /// The maximum number of slots per bucket, in average, before the array of buckets grows. It must be greater than zero.
+    /// </summary>
+    static float MAX_LOAD_FACTOR;
+
 
     // CONSTRUCTORS
     // ---------------
@@ -599,17 +700,19 @@ public:
     /// </summary>
     /// <param name="uNumberOfBuckets">[IN] The number of buckets in the table. The higher it is, the less collisions occurs. It must be greater than zero.</param>
     /// <param name="uSlotsPerBucket">[IN] The number of expected slots per bucket. The higher it is, the more capacity the table has initially. It must be greater than zero.</param>
+    /// <remarks>
+    /// The number of buckets is just the initial one, the array of buckets grows when the load factor exceeds its maximum.
+    /// </remarks>
     QHashtable(const pointer_uint_q uNumberOfBuckets, const pointer_uint_q uSlotsPerBucket) : m_arBuckets(uNumberOfBuckets),
-                                                                                              m_slots(uNumberOfBuckets * uSlotsPerBucket)
+                                                                                              m_uRehashedBuckets(0),
+                                                                                              m_slots(uNumberOfBuckets * uSlotsPerBucket),
+                                                                                              m_arSlotInfo(uNumberOfBuckets * uSlotsPerBucket)
     {
         QE_ASSERT_ERROR(uNumberOfBuckets > 0, "The number of buckets must be greater than zero.");
         QE_ASSERT_ERROR(uSlotsPerBucket > 0, "The number of slots per bucket must be greater than zero.");
 
-        static const QHashtable::QBucket DEFAULT_BUCKET;
-
-        // The array of buckets is pre-allocated and initialized
-        for(pointer_uint_q uIndex = 0; uIndex < uNumberOfBuckets; ++uIndex)
-            m_arBuckets.Add(DEFAULT_BUCKET);
+        this->_AddBuckets(m_arBuckets, uNumberOfBuckets);
+        this->_UpdateSlotInfoCapacity();
     }
     
     /// <summary>
@@ -620,18 +723,17 @@ public:
     /// The capacity of the resultant hashtable is equal to the amount of elements in the input hashtable. If it is empty, then the capacity of the input hashtable is used instead.
     /// </remarks>
     /// <param name="hashtable">[IN] The other hashtable to be copied.</param>
-    QHashtable(const QHashtable &hashtable) : m_arBuckets(hashtable.m_arBuckets.GetCount()),
-                                              m_slots(hashtable.m_slots.GetCount() == 0 ? hashtable.GetCapacity() : hashtable.m_slots.GetCount())
+    QHashtable(const QHashtable &hashtable) : m_arBuckets(hashtable._GetBucketCount()),
+                                              m_uRehashedBuckets(0),
+                                              m_slots(hashtable.m_slots.GetCount() == 0 ? hashtable.GetCapacity() : hashtable.m_slots.GetCount()),
+                                              m_arSlotInfo(hashtable.m_slots.GetCount() == 0 ? hashtable.GetCapacity() : hashtable.m_slots.GetCount())
     {
-        static const QHashtable::QBucket DEFAULT_BUCKET;
-
-        // The array of buckets is pre-allocated and initialized
-        for(pointer_uint_q uIndex = 0; uIndex < hashtable.m_arBuckets.GetCount(); ++uIndex)
-            m_arBuckets.Add(DEFAULT_BUCKET);
+        this->_AddBuckets(m_arBuckets, hashtable._GetBucketCount());
+        this->_UpdateSlotInfoCapacity();
 
-        // Every key-value pair is copied
+        // Every key-value pair is copied, along with its hash
         for(QHashtable::QConstHashtableIterator it = hashtable.GetFirst(); !it.IsEnd(); ++it)
-            this->Add(it->GetKey(), it->GetValue());
+            this->_AddSlot(it->GetKey(), it->GetValue(), hashtable.m_arSlotInfo[it.GetInternalPosition()].GetHash());
     }
 
 
@@ -658,7 +760,8 @@ public:
     /// Increases the capacity of the hashtable, reserving memory for more elements.
     /// </summary>
     /// <remarks>
-    /// It does not produce the rehash of any element.<br/>
+    /// If the number of buckets is not enough to store all the elements without exceeding the maximum load factor, the array of buckets grows and 
+    /// all the elements are rehashed at once, so adding them later does not require any rehash.<br/>
     /// This operation implies a reallocation, which means that any pointer to elements of this hashtable will be pointing to garbage.
     /// </remarks>
     /// <param name="uNumberOfElements">[IN] The number of key-value pairs for which to reserve memory. It should be greater than the
@@ -666,6 +769,15 @@ public:
     void Reserve(const pointer_uint_q uNumberOfElements)
     {
         m_slots.Reserve(uNumberOfElements);
+        this->_UpdateSlotInfoCapacity();
+
+        const pointer_uint_q REQUIRED_BUCKETS = scast_q(scast_q(uNumberOfElements, float) / QHashtable::MAX_LOAD_FACTOR, pointer_uint_q) + 1U;
+
+        if(REQUIRED_BUCKETS > this->_GetBucketCount())
+        {
+            this->_StartRehash(REQUIRED_BUCKETS);
+            this->_RehashBuckets(m_arBuckets.GetCount());
+        }
     }
 
     /// <summary>
@@ -673,7 +785,8 @@ public:
     /// </summary>
     /// <remarks>
     /// This operation may imply a reallocation, which means that any pointer to elements of this hashtable will be pointing to garbage.<br/>
-    /// The copy constructor of both the new key and the new value will be called.
+    /// The copy constructor of both the new key and the new value will be called.<br/>
+    /// If the maximum load factor is exceeded, the array of buckets starts growing; if it is already growing, some buckets are rehashed.
     /// </remarks>
     /// <param name="key">[IN] The new key. It must not exist in the hashtable yet.</param>
     /// <param name="value">[IN] The new value associated to the new key.</param>
@@ -686,36 +799,15 @@ public:
 
         QE_ASSERT_ERROR(!this->ContainsKey(key), string_q("The new key (") + SQAnyTypeToStringConverter::Convert(key) + ") already exists in the hashtable.");
 
-        // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
-        
-        // Creates a key-value by copying the data without calling any constructor
-        u8_q pKeyValueBlock[sizeof(KeyValuePairType)];
-        memcpy(pKeyValueBlock, &key, sizeof(KeyT));
-        memcpy(pKeyValueBlock + sizeof(KeyT), &value, sizeof(ValueT));
-        KeyValuePairType* pKeyValue = rcast_q(pKeyValueBlock, KeyValuePairType*);
-
-        // Finds the first slot of the bucket
-        pointer_uint_q uFirstSlotPosition = QHashtable::END_POSITION_FORWARD;
-
-        if(bucket.GetSlotCount() == 0)
-        {
-            // Adds the first slot to the bucket and stores its position
-            m_slots.Add(*pKeyValue);
-            uFirstSlotPosition = m_slots.GetLast().GetInternalPosition();
-        }
-        else
-        {
-            // Inserts the slot before the first one in the bucket
-            typename SlotListType::Iterator newSlot = m_slots.Insert(*pKeyValue, typename SlotListType::Iterator(&m_slots, bucket.GetSlotPosition()));
-            uFirstSlotPosition = newSlot.GetInternalPosition();
-        }
+        const pointer_uint_q SLOT_POSITION = this->_AddSlot(key, value, QHashtable::_GenerateHash(key));
 
-        bucket.SetSlotPosition(uFirstSlotPosition);
-        bucket.SetSlotCount(bucket.GetSlotCount() + 1U);
+        // The array of buckets grows when there are too many slots per bucket
+        if(this->_IsRehashing())
+            this->_RehashBuckets(QHashtable::REHASHED_BUCKETS_PER_OPERATION);
+        else if(scast_q(m_slots.GetCount(), float) > scast_q(m_arBuckets.GetCount(), float) * QHashtable::MAX_LOAD_FACTOR)
+            this->_StartRehash(m_arBuckets.GetCount() * 2U);
 
-        return QHashtable::QConstHashtableIterator(this, uFirstSlotPosition);
+        return QHashtable::QConstHashtableIterator(this, SLOT_POSITION);
     }
     
     /// <summary>
@@ -741,24 +833,13 @@ public:
     {
         using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
 
-        // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
-
-        QE_ASSERT_ERROR(bucket.GetSlotCount() > 0, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
-
-        typename SlotListType::Iterator slot(&m_slots, bucket.GetSlotPosition());
-        pointer_uint_q uSlot = 0;
+        QHashtable::QBucket* pBucket = null_q;
+        pointer_uint_q uPreviousSlotPosition = QHashtable::END_POSITION_FORWARD;
+        const pointer_uint_q SLOT_POSITION = this->_FindSlot(key, QHashtable::_GenerateHash(key), pBucket, uPreviousSlotPosition);
 
-        // Traverses all the slots of the bucket
-        while(uSlot < bucket.GetSlotCount() && KeyComparatorT::Compare(slot->GetKey(), key) != 0)
-        {
-            ++slot;
-            ++uSlot;
-        }
-        
-        QE_ASSERT_ERROR(uSlot < bucket.GetSlotCount(), string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
+        QE_ASSERT_ERROR(SLOT_POSITION != QHashtable::END_POSITION_FORWARD, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
 
+        typename SlotListType::Iterator slot(&m_slots, SLOT_POSITION);
         return ccast_q(slot->GetValue(), ValueT&);
     }
 
@@ -787,58 +868,48 @@ public:
     /// </returns>
     bool ContainsKey(const KeyT &key) const
     {
-        // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
-
-        typename SlotListType::Iterator slot(&m_slots, bucket.GetSlotPosition());
-        pointer_uint_q uSlot = 0;
-
-        // Traverses all the slots of the bucket
-        while(uSlot < bucket.GetSlotCount() && KeyComparatorT::Compare(slot->GetKey(), key) != 0)
-        {
-            ++slot;
-            ++uSlot;
-        }
+        QHashtable::QBucket* pBucket = null_q;
+        pointer_uint_q uPreviousSlotPosition = QHashtable::END_POSITION_FORWARD;
 
-        return uSlot != bucket.GetSlotCount();
+        return this->_FindSlot(key, QHashtable::_GenerateHash(key), pBucket, uPreviousSlotPosition) != QHashtable::END_POSITION_FORWARD;
     }
     
     /// <summary>
     /// Removes an key-value pair from the hashtable by its key.
     /// </summary>
     /// <remarks>
-    /// The destructor of both the key and the value will be called.
+    /// The destructor of both the key and the value will be called.<br/>
+    /// If the array of buckets is growing, some buckets are rehashed.
     /// </remarks>
     /// <param name="key">[IN] The key to search for. It must exist in the hashtable.</param>
     void Remove(const KeyT &key)
     {
         using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
 
-        // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
+        QHashtable::QBucket* pBucket = null_q;
+        pointer_uint_q uPreviousSlotPosition = QHashtable::END_POSITION_FORWARD;
+        const pointer_uint_q SLOT_POSITION = this->_FindSlot(key, QHashtable::_GenerateHash(key), pBucket, uPreviousSlotPosition);
 
-        QE_ASSERT_ERROR(bucket.GetSlotCount() > 0, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
+        QE_ASSERT_ERROR(SLOT_POSITION != QHashtable::END_POSITION_FORWARD, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
 
-        typename SlotListType::Iterator slot(&m_slots, bucket.GetSlotPosition());
-        pointer_uint_q uSlot = 0;
+        // Unlinks the slot from the bucket
+        const pointer_uint_q NEXT_SLOT_POSITION = m_arSlotInfo[SLOT_POSITION].GetNextSlotPosition();
 
-        while(uSlot < bucket.GetSlotCount() && KeyComparatorT::Compare(slot->GetKey(), key) != 0)
-        {
-            ++slot;
-            ++uSlot;
-        }
-        
-        QE_ASSERT_ERROR(uSlot < bucket.GetSlotCount(), string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
+        if(uPreviousSlotPosition == QHashtable::END_POSITION_FORWARD)
+            pBucket->SetSlotPosition(NEXT_SLOT_POSITION);
+        else
+            m_arSlotInfo[uPreviousSlotPosition].SetNextSlotPosition(NEXT_SLOT_POSITION);
 
         // Updates the bucket
-        bucket.SetSlotCount(bucket.GetSlotCount() - 1U);
+        pBucket->SetSlotCount(pBucket->GetSlotCount() - 1U);
 
-        if(bucket.GetSlotCount() == 0)
-            bucket.SetSlotPosition(QHashtable::END_POSITION_FORWARD);
+        if(pBucket->GetSlotCount() == 0)
+            pBucket->SetSlotPosition(QHashtable::END_POSITION_FORWARD);
+
+        m_slots.Remove(typename SlotListType::Iterator(&m_slots, SLOT_POSITION));
 
-        m_slots.Remove(slot);
+        if(this->_IsRehashing())
+            this->_RehashBuckets(QHashtable::REHASHED_BUCKETS_PER_OPERATION);
     }
 
     /// <summary>
@@ -876,27 +947,13 @@ public:
     /// </returns>
     QConstHashtableIterator PositionOfKey(const KeyT &key) const
     {
-        // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
-
-        typename SlotListType::Iterator slot(&m_slots, bucket.GetSlotPosition());
-        pointer_uint_q uSlot = 0;
-        pointer_uint_q uResultPosition = bucket.GetSlotPosition();
-
-        // Traverses all the slots of the bucket
-        while(uSlot < bucket.GetSlotCount() && KeyComparatorT::Compare(slot->GetKey(), key) != 0)
-        {
-            ++slot;
-            ++uSlot;
-            uResultPosition = slot.GetInternalPosition();
-        }
+        QHashtable::QBucket* pBucket = null_q;
+        pointer_uint_q uPreviousSlotPosition = QHashtable::END_POSITION_FORWARD;
 
         // If the key was not found, the iterator points to an end position
-        if(uSlot == bucket.GetSlotCount())
-            uResultPosition = QHashtable::END_POSITION_FORWARD;
+        const pointer_uint_q SLOT_POSITION = this->_FindSlot(key, QHashtable::_GenerateHash(key), pBucket, uPreviousSlotPosition);
 
-        return QHashtable::QConstHashtableIterator(this, uResultPosition);
+        return QHashtable::QConstHashtableIterator(this, SLOT_POSITION);
     }
 
     /// <summary>
@@ -959,23 +1016,22 @@ public:
     /// </returns>
     QHashtable& operator=(const QHashtable &hashtable)
     {
-        static const QHashtable::QBucket DEFAULT_BUCKET;
-
         if(this != &hashtable)
         {
             // Everything is cleared and prepared for the copy
             m_slots.Clear();
             m_slots.Reserve(hashtable.m_slots.GetCapacity()); // Thund: Using GetCount instead could save some memory?
+            this->_UpdateSlotInfoCapacity();
             m_arBuckets.Clear();
-            m_arBuckets.Reserve(hashtable.m_arBuckets.GetCapacity());
+            m_arRehashBuckets.Clear();
+            m_uRehashedBuckets = 0;
 
             // The array of buckets is pre-allocated and initialized
-            for(pointer_uint_q uIndex = 0; uIndex < hashtable.m_arBuckets.GetCount(); ++uIndex)
-                m_arBuckets.Add(DEFAULT_BUCKET);
+            this->_AddBuckets(m_arBuckets, hashtable._GetBucketCount());
 
-            // Every key-value pair is copied
+            // Every key-value pair is copied, along with its hash
             for(QHashtable::QConstHashtableIterator it = hashtable.GetFirst(); !it.IsEnd(); ++it)
-                this->Add(it->GetKey(), it->GetValue());
+                this->_AddSlot(it->GetKey(), it->GetValue(), hashtable.m_arSlotInfo[it.GetInternalPosition()].GetHash());
         }
 
         return *this;
@@ -994,6 +1050,319 @@ public:
     {
         m_slots.Clone(destinationHashtable.m_slots);
         m_arBuckets.Clone(destinationHashtable.m_arBuckets);
+        m_arRehashBuckets.Clone(destinationHashtable.m_arRehashBuckets);
+        m_arSlotInfo.Clone(destinationHashtable.m_arSlotInfo);
+        destinationHashtable.m_uRehashedBuckets = m_uRehashedBuckets;
+    }
+
+    /// <summary>
+    /// Writes the keys and values of the hashtable to a binary writer.
+    /// </summary>
+    /// <remarks>
+    /// Every key is followed by its value. Key-value pairs are buffered and sent to the writer in blocks.<br/>
+    /// Hashes are not written, they are calculated again when reading.
+    /// </remarks>
+    /// <typeparam name="WriterT">The type of the binary writer. It must provide a WriteBytes method and the left shift operator, like QBinaryStreamWriter does.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer to which the keys and values will be written.</param>
+    template<class WriterT>
+    void Serialize(WriterT &writer) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+        using Kinesis::QuimeraEngine::Common::DataTypes::QBufferedBinaryWriter;
+
+        SQBinarySerializer::WriteHeader(writer, SQBinarySerializer::GetElementSize<KeyT>() + SQBinarySerializer::GetElementSize<ValueT>(), this->GetCount());
+
+        QBufferedBinaryWriter<WriterT> bufferedWriter(writer);
+
+        for(typename QHashtable::QConstHashtableIterator it = this->GetFirst(); !it.IsEnd(); ++it)
+        {
+            SQBinarySerializer::Write(bufferedWriter, &it->GetKey(), 1U);
+            SQBinarySerializer::Write(bufferedWriter, &it->GetValue(), 1U);
+        }
+    }
+
+    /// <summary>
+    /// Replaces the content of the hashtable with the keys and values read from a binary reader.
+    /// </summary>
+    /// <remarks>
+    /// The capacity and the number of buckets are reserved at once, so adding the key-value pairs does not require any reallocation nor rehash. 
+    /// Trivially copyable keys and values (see QSerializationTraits) are read from the reader in blocks. The types of the keys and values must be 
+    /// default-constructible.<br/>
+    /// The destructor of every existing key and value will be called.
+    /// </remarks>
+    /// <typeparam name="ReaderT">The type of the binary reader. It must provide a ReadBytes method and the right shift operator, like QBinaryStreamReader does.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the keys and values will be read. They must have been written by the Serialize method.</param>
+    template<class ReaderT>
+    void Deserialize(ReaderT &reader)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+        using Kinesis::QuimeraEngine::Common::DataTypes::QBufferedBinaryReader;
+
+        const pointer_uint_q PAIR_SIZE = SQBinarySerializer::GetElementSize<KeyT>() + SQBinarySerializer::GetElementSize<ValueT>();
+        const pointer_uint_q COUNT = SQBinarySerializer::ReadHeader(reader, PAIR_SIZE);
+
+        while(!this->IsEmpty())
+        {
+            const KeyT KEY = this->GetFirst()->GetKey();
+            this->Remove(KEY);
+        }
+
+        this->Reserve(COUNT);
+
+        QBufferedBinaryReader<ReaderT> bufferedReader(reader, COUNT * PAIR_SIZE);
+        KeyT key;
+        ValueT value;
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+        {
+            SQBinarySerializer::Read(bufferedReader, &key, 1U);
+            SQBinarySerializer::Read(bufferedReader, &value, 1U);
+            this->Add(key, value);
+        }
+    }
+
+protected:
+
+    /// <summary>
+    /// Generates the complete hash of a key, which does not depend on the number of buckets.
+    /// </summary>
+    /// <param name="key">[IN] The key whose hash is to be generated.</param>
+    /// <returns>
+    /// The hash of the key. The position of its bucket is the remainder of dividing it by the number of buckets.
+    /// </returns>
+    static pointer_uint_q _GenerateHash(const KeyT &key)
+    {
+        return HashProviderT::GenerateHash(key);
+    }
+
+    /// <summary>
+    /// Adds a key-value pair to the bucket that corresponds to its hash, without checking whether the array of buckets has to grow.
+    /// </summary>
+    /// <remarks>
+    /// While rehashing, new slots are always added to the new array of buckets.
+    /// </remarks>
+    /// <param name="key">[IN] The new key. It must not exist in the hashtable yet.</param>
+    /// <param name="value">[IN] The new value associated to the new key.</param>
+    /// <param name="uHash">[IN] The complete hash of the key.</param>
+    /// <returns>
+    /// The position of the new slot in the slot list.
+    /// </returns>
+    pointer_uint_q _AddSlot(const KeyT &key, const ValueT &value, const pointer_uint_q uHash)
+    {
+        // Gets the corresponding bucket
+        BucketsArrayType& arBuckets = this->_IsRehashing() ? m_arRehashBuckets : m_arBuckets;
+        QHashtable::QBucket& bucket = arBuckets[uHash % arBuckets.GetCount()];
+        
+        // Creates a key-value by copying the data without calling any constructor
+        u8_q pKeyValueBlock[sizeof(KeyValuePairType)];
+        memcpy(pKeyValueBlock, &key, sizeof(KeyT));
+        memcpy(pKeyValueBlock + sizeof(KeyT), &value, sizeof(ValueT));
+        KeyValuePairType* pKeyValue = rcast_q(pKeyValueBlock, KeyValuePairType*);
+
+        // Finds the first slot of the bucket
+        pointer_uint_q uFirstSlotPosition = QHashtable::END_POSITION_FORWARD;
+
+        if(bucket.GetSlotCount() == 0)
+        {
+            // Adds the first slot to the bucket and stores its position
+            m_slots.Add(*pKeyValue);
+            uFirstSlotPosition = m_slots.GetLast().GetInternalPosition();
+        }
+        else
+        {
+            // Inserts the slot before the first one in the bucket
+            typename SlotListType::Iterator newSlot = m_slots.Insert(*pKeyValue, typename SlotListType::Iterator(&m_slots, bucket.GetSlotPosition()));
+            uFirstSlotPosition = newSlot.GetInternalPosition();
+        }
+
+        // The slot list may have grown
+        this->_UpdateSlotInfoCapacity();
+
+        QHashtable::QSlotInfo& slotInfo = m_arSlotInfo[uFirstSlotPosition];
+        slotInfo.SetHash(uHash);
+        slotInfo.SetNextSlotPosition(bucket.GetSlotCount() == 0 ? QHashtable::END_POSITION_FORWARD : bucket.GetSlotPosition());
+
+        bucket.SetSlotPosition(uFirstSlotPosition);
+        bucket.SetSlotCount(bucket.GetSlotCount() + 1U);
+
+        return uFirstSlotPosition;
+    }
+
+    /// <summary>
+    /// Searches for a key in the bucket that corresponds to its hash.
+    /// </summary>
+    /// <remarks>
+    /// While rehashing, the key may be either in the old or in the new array of buckets.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <param name="uHash">[IN] The complete hash of the key.</param>
+    /// <param name="pBucket">[OUT] The bucket where the key was searched for last, which contains the key if it was found.</param>
+    /// <param name="uPreviousSlotPosition">[OUT] The position of the slot that precedes the found one in the same bucket. If the found slot is 
+    /// the first one in the bucket, it equals the end position.</param>
+    /// <returns>
+    /// The position of the slot that contains the key in the slot list. If the key was not found, it equals the end position.
+    /// </returns>
+    pointer_uint_q _FindSlot(const KeyT &key, const pointer_uint_q uHash, QBucket* &pBucket, pointer_uint_q &uPreviousSlotPosition) const
+    {
+        // Buckets that have already been moved to the new array are empty
+        pBucket = &m_arBuckets[uHash % m_arBuckets.GetCount()];
+        pointer_uint_q uSlotPosition = this->_FindSlotInBucket(key, uHash, *pBucket, uPreviousSlotPosition);
+
+        if(uSlotPosition == QHashtable::END_POSITION_FORWARD && this->_IsRehashing())
+        {
+            pBucket = &m_arRehashBuckets[uHash % m_arRehashBuckets.GetCount()];
+            uSlotPosition = this->_FindSlotInBucket(key, uHash, *pBucket, uPreviousSlotPosition);
+        }
+
+        return uSlotPosition;
+    }
+
+    /// <summary>
+    /// Searches for a key among the slots of a bucket.
+    /// </summary>
+    /// <remarks>
+    /// Keys are only compared when the stored hash equals the hash of the input key.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <param name="uHash">[IN] The complete hash of the key.</param>
+    /// <param name="bucket">[IN] The bucket to traverse.</param>
+    /// <param name="uPreviousSlotPosition">[OUT] The position of the slot that precedes the found one in the bucket. If the found slot is 
+    /// the first one in the bucket, it equals the end position.</param>
+    /// <returns>
+    /// The position of the slot that contains the key in the slot list. If the key was not found, it equals the end position.
+    /// </returns>
+    pointer_uint_q _FindSlotInBucket(const KeyT &key, const pointer_uint_q uHash, const QBucket &bucket, pointer_uint_q &uPreviousSlotPosition) const
+    {
+        pointer_uint_q uSlotPosition = bucket.GetSlotPosition();
+        pointer_uint_q uSlot = 0;
+        uPreviousSlotPosition = QHashtable::END_POSITION_FORWARD;
+
+        // Traverses all the slots of the bucket
+        while(uSlot < bucket.GetSlotCount() && 
+              (m_arSlotInfo[uSlotPosition].GetHash() != uHash || 
+               KeyComparatorT::Compare(typename SlotListType::ConstIterator(&m_slots, uSlotPosition)->GetKey(), key) != 0))
+        {
+            uPreviousSlotPosition = uSlotPosition;
+            uSlotPosition = m_arSlotInfo[uSlotPosition].GetNextSlotPosition();
+            ++uSlot;
+        }
+
+        return uSlot == bucket.GetSlotCount() ? QHashtable::END_POSITION_FORWARD : uSlotPosition;
+    }
+
+    /// <summary>
+    /// Creates a new array of buckets to which all the slots will be moved progressively.
+    /// </summary>
+    /// <remarks>
+    /// If there is a rehash in progress, it is completed first.
+    /// </remarks>
+    /// <param name="uNumberOfBuckets">[IN] The number of buckets of the new array. It must be greater than zero.</param>
+    void _StartRehash(const pointer_uint_q uNumberOfBuckets)
+    {
+        if(this->_IsRehashing())
+            this->_RehashBuckets(m_arBuckets.GetCount());
+
+        m_arRehashBuckets.Reserve(uNumberOfBuckets);
+        this->_AddBuckets(m_arRehashBuckets, uNumberOfBuckets);
+        m_uRehashedBuckets = 0;
+    }
+
+    /// <summary>
+    /// Moves the slots of some buckets of the old array to the new array of buckets. When all of them have been moved, the new array replaces the old one.
+    /// </summary>
+    /// <remarks>
+    /// Slots are relinked using their stored hashes; neither the hash provider is called nor keys or values are copied.
+    /// </remarks>
+    /// <param name="uNumberOfBuckets">[IN] The maximum number of buckets of the old array to move.</param>
+    void _RehashBuckets(const pointer_uint_q uNumberOfBuckets)
+    {
+        const pointer_uint_q OLD_BUCKET_COUNT = m_arBuckets.GetCount();
+        const pointer_uint_q NEW_BUCKET_COUNT = m_arRehashBuckets.GetCount();
+        const pointer_uint_q LAST_BUCKET = std::min(m_uRehashedBuckets + uNumberOfBuckets, OLD_BUCKET_COUNT);
+
+        for(; m_uRehashedBuckets < LAST_BUCKET; ++m_uRehashedBuckets)
+        {
+            QHashtable::QBucket& oldBucket = m_arBuckets[m_uRehashedBuckets];
+            pointer_uint_q uSlotPosition = oldBucket.GetSlotPosition();
+
+            for(pointer_uint_q uSlot = 0; uSlot < oldBucket.GetSlotCount(); ++uSlot)
+            {
+                QHashtable::QSlotInfo& slotInfo = m_arSlotInfo[uSlotPosition];
+                const pointer_uint_q NEXT_SLOT_POSITION = slotInfo.GetNextSlotPosition();
+
+                // The slot becomes the first of its new bucket
+                QHashtable::QBucket& newBucket = m_arRehashBuckets[slotInfo.GetHash() % NEW_BUCKET_COUNT];
+                slotInfo.SetNextSlotPosition(newBucket.GetSlotCount() == 0 ? QHashtable::END_POSITION_FORWARD : newBucket.GetSlotPosition());
+                newBucket.SetSlotPosition(uSlotPosition);
+                newBucket.SetSlotCount(newBucket.GetSlotCount() + 1U);
+
+                uSlotPosition = NEXT_SLOT_POSITION;
+            }
+
+            oldBucket.SetSlotPosition(QHashtable::END_POSITION_FORWARD);
+            oldBucket.SetSlotCount(0);
+        }
+
+        // When all the buckets have been moved, the new array replaces the old one without copying any bucket
+        if(m_uRehashedBuckets == OLD_BUCKET_COUNT)
+        {
+            m_arBuckets.Swap(m_arRehashBuckets);
+            m_arRehashBuckets.Clear();
+            m_uRehashedBuckets = 0;
+        }
+    }
+
+    /// <summary>
+    /// Adds empty buckets to an array of buckets.
+    /// </summary>
+    /// <param name="arBuckets">[IN/OUT] The array of buckets to fill.</param>
+    /// <param name="uNumberOfBuckets">[IN] The number of buckets to add.</param>
+    static void _AddBuckets(BucketsArrayType &arBuckets, const pointer_uint_q uNumberOfBuckets)
+    {
+        static const QHashtable::QBucket DEFAULT_BUCKET;
+
+        for(pointer_uint_q uIndex = 0; uIndex < uNumberOfBuckets; ++uIndex)
+            arBuckets.Add(DEFAULT_BUCKET);
+    }
+
+    /// <summary>
+    /// Makes the array of slot information as large as the capacity of the slot list, so there is information for every possible slot position.
+    /// </summary>
+    void _UpdateSlotInfoCapacity()
+    {
+        static const QHashtable::QSlotInfo DEFAULT_SLOT_INFO;
+
+        const pointer_uint_q SLOT_CAPACITY = m_slots.GetCapacity();
+
+        if(m_arSlotInfo.GetCount() < SLOT_CAPACITY)
+        {
+            m_arSlotInfo.Reserve(SLOT_CAPACITY);
+
+            while(m_arSlotInfo.GetCount() < SLOT_CAPACITY)
+                m_arSlotInfo.Add(DEFAULT_SLOT_INFO);
+        }
+    }
+
+    /// <summary>
+    /// Indicates whether the slots are being moved to a new array of buckets.
+    /// </summary>
+    /// <returns>
+    /// True if there is a rehash in progress; False otherwise.
+    /// </returns>
+    bool _IsRehashing() const
+    {
+        return !m_arRehashBuckets.IsEmpty();
+    }
+
+    /// <summary>
+    /// Gets the number of buckets the hashtable has or will have when the rehash in progress, if any, finishes.
+    /// </summary>
+    /// <returns>
+    /// The number of buckets.
+    /// </returns>
+    pointer_uint_q _GetBucketCount() const
+    {
+        return this->_IsRehashing() ? m_arRehashBuckets.GetCount() : m_arBuckets.GetCount();
     }
    
 
@@ -1045,6 +1414,20 @@ public:
         return m_slots.IsEmpty();
     }
     
+    /// <summary>
+    /// Gets the load factor of the hashtable, that is, the average number of elements per bucket.
+    /// </summary>
+    /// <remarks>
+    /// When it exceeds its maximum, the number of buckets is doubled, so it is always low regardless of the number of elements.
+    /// </remarks>
+    /// <returns>
+    /// The number of elements divided by the number of buckets.
+    /// </returns>
+    float GetLoadFactor() const
+    {
+        return scast_q(m_slots.GetCount(), float) / scast_q(this->_GetBucketCount(), float);
+    }
+    
     /// <summary>
     /// Gets all the existing keys from the hashtable.
     /// </summary>
@@ -1080,13 +1463,34 @@ protected:
     /// </summary>
     BucketsArrayType m_arBuckets;
 
+    /// <summary>
+    /// The array of buckets to which slots are being moved while rehashing. It is empty otherwise.
+    /// </summary>
+    BucketsArrayType m_arRehashBuckets;
+
+    /// <summary>
+    /// The number of buckets of the old array whose slots have been moved to the new array of buckets while rehashing.
+    /// </summary>
+    pointer_uint_q m_uRehashedBuckets;
+
     /// <summary>
     /// The slot list. It is shared among all the buckets. Every bucket knows where its slots are placed in the list.
     /// </summary>
     SlotListType m_slots;
 
+    /// <summary>
+    /// The hash and the next slot in the same bucket of every slot, in the same physical position the slot occupies in the slot list.
+    /// </summary>
+    SlotInfoArrayType m_arSlotInfo;
+
 };
 
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class KeyT, class ValueT, class HashProviderT, class AllocatorT, class KeyComparatorT, class ValueComparatorT>
+float QHashtable<KeyT, ValueT, HashProviderT, AllocatorT, KeyComparatorT, ValueComparatorT>::MAX_LOAD_FACTOR = 1.0f;
+
 } //namespace Containers
 } //namespace Tools
 } //namespace QuimeraEngine
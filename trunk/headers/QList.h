@@ -35,6 +35,9 @@
 #include "SQComparatorDefault.h"
 #include "AllocationOperators.h"
 #include "EQIterationDirection.h"
+#include "SQBinarySerializer.h"
+#include "QStringUnicodeSerialization.h"
+#include "QBufferedBinaryWriter.h"
 
 
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
@@ -189,7 +192,7 @@ public:
         /// <param name="pList">[IN] The list to iterate. It must not be null.</param>
         /// <param name="uPosition">[IN] The position the iterator will point to. This is not the logical position of list elements, but the physical.
         /// It must be lower than the capacity of the list.</param>
-        QConstListIterator(const QList* pList, const unsigned int uPosition) : m_pList(pList), m_uPosition(uPosition)
+        QConstListIterator(const QList* pList, const pointer_uint_q uPosition) : m_pList(pList), m_uPosition(uPosition)
         {
             QE_ASSERT_ERROR(pList != null_q, "Invalid argument: The pointer to the list cannot be null");
             QE_ASSERT_WARNING(pList->GetCapacity() > uPosition || 
@@ -727,7 +730,7 @@ public:
         /// <param name="pList">[IN] The list to iterate. It must not be null.</param>
         /// <param name="uPosition">[IN] The position the iterator will point to. This is not the logical position of list elements, but the physical.
         /// It must be lower than the capacity of the list.</param>
-        QListIterator(const QList* pList, const unsigned int uPosition) : QConstListIterator(pList, uPosition)
+        QListIterator(const QList* pList, const pointer_uint_q uPosition) : QConstListIterator(pList, uPosition)
         {
         }
 
@@ -2164,6 +2167,71 @@ public:
         this->Remove(it);
     }
     
+    /// <summary>
+    /// Writes the elements of the list to a binary writer, from first to last.
+    /// </summary>
+    /// <remarks>
+    /// Elements are not stored contiguously, so they are buffered and sent to the writer in blocks.
+    /// </remarks>
+    /// <typeparam name="WriterT">The type of the binary writer. It must provide a WriteBytes method and the left shift operator, like QBinaryStreamWriter does.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer to which the elements will be written.</param>
+    template<class WriterT>
+    void Serialize(WriterT &writer) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+        using Kinesis::QuimeraEngine::Common::DataTypes::QBufferedBinaryWriter;
+
+        SQBinarySerializer::WriteHeader(writer, SQBinarySerializer::GetElementSize<T>(), this->GetCount());
+
+        QBufferedBinaryWriter<WriterT> bufferedWriter(writer);
+
+        for(typename QList::QConstListIterator it = this->GetFirst(); !it.IsEnd(); ++it)
+            SQBinarySerializer::Write(bufferedWriter, &*it, 1U);
+    }
+
+    /// <summary>
+    /// Replaces the elements of the list with the elements read from a binary reader.
+    /// </summary>
+    /// <remarks>
+    /// The elements are read directly into the memory of the list, in order, which is only reallocated if its capacity is not enough. Trivially 
+    /// copyable elements (see QSerializationTraits) are read with only one call to the reader and no constructor is called; the rest of elements 
+    /// are default-constructed before being deserialized.<br/>
+    /// The destructor of every existing element will be called.
+    /// </remarks>
+    /// <typeparam name="ReaderT">The type of the binary reader. It must provide a ReadBytes method and the right shift operator, like QBinaryStreamReader does.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the elements will be read. They must have been written by the Serialize method.</param>
+    template<class ReaderT>
+    void Deserialize(ReaderT &reader)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+
+        const pointer_uint_q COUNT = SQBinarySerializer::ReadHeader(reader, SQBinarySerializer::GetElementSize<T>());
+
+        this->Clear();
+
+        // Once the allocators are emptied, they return the blocks in the same order they occupy in the buffer
+        m_elementAllocator.Clear();
+        m_linkAllocator.Clear();
+        this->Reserve(COUNT);
+
+        if(COUNT > 0)
+        {
+            // Every element occupies the position of the buffer that corresponds to its position in the list
+            for(pointer_uint_q i = 0; i < COUNT; ++i)
+            {
+                m_elementAllocator.Allocate();
+                new(m_linkAllocator.Allocate()) QList::QLink(i == 0          ? QList::END_POSITION_BACKWARD : i - 1U, 
+                                                             i == COUNT - 1U ? QList::END_POSITION_FORWARD  : i + 1U);
+            }
+
+            m_uFirst = 0;
+            m_uLast = COUNT - 1U;
+
+            SQBinarySerializer::Construct(m_pElementBasePointer, COUNT);
+            SQBinarySerializer::Read(reader, m_pElementBasePointer, COUNT);
+        }
+    }
+    
     
 private:
 
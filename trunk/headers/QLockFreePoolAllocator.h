@@ -0,0 +1,326 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QLOCKFREEPOOLALLOCATOR__
+#define __QLOCKFREEPOOLALLOCATOR__
+
+#include <boost/atomic.hpp>
+
+#include "SystemDefinitions.h"
+#include "DataTypesDefinitions.h"
+#include "QAlignment.h"
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( push )
+    #pragma warning( disable: 4251 ) // This warning occurs when using a template specialization as attribute
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Represents a custom allocator that works as a pool, providing a limited set of fixed-size and fixed-alignment blocks
+/// that can be occupied and released by several threads at the same time without locking.
+/// </summary>
+/// <remarks>
+/// Free blocks are stored in a linked list of block indices whose head is replaced atomically. The head includes a counter
+/// that changes every time the list is modified, so a thread never replaces a head that was removed and added again by other
+/// threads while it was reading the list (ABA problem).<br/>
+/// Allocate, Deallocate, AllocateBatch and DeallocateBatch are thread-safe. The rest of methods are not.<br/>
+/// Unlike QPoolAllocator, the pool cannot be reallocated, since other threads could be using its blocks.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QLockFreePoolAllocator
+{
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// Index that indicates the end of the list of free blocks.
+    /// </summary>
+    static const u32_q END_OF_LIST;
+
+    /// <summary>
+    /// Size of the padding used to keep the head of the list of free blocks in its own cache line, in bytes.
+    /// </summary>
+    static const pointer_uint_q CACHE_LINE_SIZE = 64U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructs a pool allocator passing the pool size, block size and memory alignment.
+    /// </summary>
+    /// <remarks>
+    /// Pre-allocates uSize bytes plus (uSize/uBlockSize)*sizeof(u32_q) bytes for internals.
+    /// </remarks>
+    /// <param name="uSize">[IN] Size of the pool, in bytes. It must be greater than or equal to the block size.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
+    QLockFreePoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const Kinesis::QuimeraEngine::Common::Memory::QAlignment &alignment);
+
+private:
+
+    // Hidden
+    QLockFreePoolAllocator(const QLockFreePoolAllocator &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It frees the memory chunk allocated for the pool.
+    /// </summary>
+    ~QLockFreePoolAllocator();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Allocates a block in the pool and returns its address.
+    /// </summary>
+    /// <remarks>
+    /// This method is thread-safe.
+    /// </remarks>
+    /// <returns>
+    /// Pointer to the allocated memory block. Returns null if the pool is full.
+    /// </returns>
+    void* Allocate();
+
+    /// <summary>
+    /// Deallocates the block passed in the parameter.
+    /// </summary>
+    /// <remarks>
+    /// This method is thread-safe.
+    /// </remarks>
+    /// <param name="pBlock">[IN] Pointer to a block previously allocated by this pool. Other values may cause an unexpected behaviour.</param>
+    void Deallocate(const void* pBlock);
+
+    /// <summary>
+    /// Allocates several blocks in the pool at once.
+    /// </summary>
+    /// <remarks>
+    /// The blocks are taken from the list of free blocks in a single atomic operation, so it is faster than calling Allocate
+    /// for every block.<br/>
+    /// This method is thread-safe.
+    /// </remarks>
+    /// <param name="arBlocks">[OUT] The array where the addresses of the allocated blocks will be stored. It must not be null and must
+    /// have space for the requested number of blocks.</param>
+    /// <param name="uCount">[IN] The number of blocks to allocate.</param>
+    /// <returns>
+    /// The number of blocks allocated, which is lower than requested when there are not enough free blocks.
+    /// </returns>
+    unsigned int AllocateBatch(void** arBlocks, const unsigned int uCount);
+
+    /// <summary>
+    /// Deallocates several blocks at once.
+    /// </summary>
+    /// <remarks>
+    /// The blocks are added to the list of free blocks in a single atomic operation, so it is faster than calling Deallocate
+    /// for every block.<br/>
+    /// This method is thread-safe.
+    /// </remarks>
+    /// <param name="arBlocks">[IN] The addresses of blocks previously allocated by this pool. It must not be null.</param>
+    /// <param name="uCount">[IN] The number of blocks to deallocate.</param>
+    void DeallocateBatch(void* const* arBlocks, const unsigned int uCount);
+
+    /// <summary>
+    /// Clears the pool, so that makes it all available to allocate.
+    /// </summary>
+    /// <remarks>
+    /// This method is not thread-safe; no other thread can be using the pool meanwhile.
+    /// </remarks>
+    void Clear();
+
+private:
+
+    // Hidden
+    QLockFreePoolAllocator& operator=(const QLockFreePoolAllocator &);
+
+    /// <summary>
+    /// Calculates the index of a block of the pool.
+    /// </summary>
+    /// <param name="pBlock">[IN] Pointer to a block previously allocated by this pool.</param>
+    /// <returns>
+    /// The position of the block in the pool.
+    /// </returns>
+    u32_q GetBlockIndex(const void* pBlock) const;
+
+    /// <summary>
+    /// Adds a chain of free blocks, already linked among them, to the beginning of the list of free blocks.
+    /// </summary>
+    /// <param name="uFirstBlock">[IN] The index of the first block of the chain.</param>
+    /// <param name="uLastBlock">[IN] The index of the last block of the chain, whose next block will be replaced.</param>
+    void PushFreeBlocks(const u32_q uFirstBlock, const u32_q uLastBlock);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Returns the size of the buffer reserved to allocate blocks (passed to the constructor as pool's size parameter).
+    /// </summary>
+    /// <returns>
+    /// The size of the buffer reserved to allocate blocks.
+    /// </returns>
+    pointer_uint_q GetPoolSize() const;
+
+    /// <summary>
+    /// Returns the size of every block.
+    /// </summary>
+    /// <returns>
+    /// The size of the blocks, in bytes.
+    /// </returns>
+    pointer_uint_q GetBlockSize() const;
+
+    /// <summary>
+    /// Returns the number of blocks that fit into the pool.
+    /// </summary>
+    /// <returns>
+    /// The number of blocks.
+    /// </returns>
+    pointer_uint_q GetBlockCount() const;
+
+    /// <summary>
+    /// Returns if there are free blocks to allocate.
+    /// </summary>
+    /// <remarks>
+    /// The result may be out of date as soon as it is returned if other threads are using the pool.
+    /// </remarks>
+    /// <returns>
+    /// True if there are free blocks to allocate. Otherwise returns false.
+    /// </returns>
+    bool CanAllocate() const;
+
+    /// <summary>
+    /// Returns the bytes sum of current allocated blocks.
+    /// </summary>
+    /// <remarks>
+    /// The result may be out of date as soon as it is returned if other threads are using the pool.
+    /// </remarks>
+    /// <returns>
+    /// The bytes sum of current allocated blocks.
+    /// </returns>
+    pointer_uint_q GetAllocatedBytes() const;
+
+    /// <summary>
+    /// Returns a pointer to the first block of the entire chunk of memory.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first block of the entire chunk of memory.
+    /// </returns>
+    void* GetPointer() const;
+
+    /// <summary>
+    /// Returns the memory alignment.
+    /// </summary>
+    /// <returns>
+    /// The memory alignment.
+    /// </returns>
+    Kinesis::QuimeraEngine::Common::Memory::QAlignment GetAlignment() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The head of the list of free blocks. The lower 32 bits store the index of the first free block and the upper 32 bits store
+    /// a counter that is increased every time the list changes.
+    /// </summary>
+    boost::atomic<u64_q> m_uFreeListHead;
+
+    /// <summary>
+    /// The number of allocated blocks. It shares the cache line with the head of the list, which is already owned by the thread
+    /// that has just modified it.
+    /// </summary>
+    boost::atomic<pointer_uint_q> m_uAllocatedBlocks;
+
+    /// <summary>
+    /// Padding that prevents the rest of attributes, which are only read, from sharing the cache line with the head of the list.
+    /// </summary>
+    u8_q m_arPadding[CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The index of the next free block of every free block.
+    /// </summary>
+    boost::atomic<u32_q>* m_arNextFreeBlocks;
+
+    /// <summary>
+    /// Pointer to the first block in the pool.
+    /// </summary>
+    void* m_pFirst;
+
+    /// <summary>
+    /// Size of blocks to allocate.
+    /// </summary>
+    pointer_uint_q m_uBlockSize;
+
+    /// <summary>
+    /// Size of the pre-allocated chunk for the blocks.
+    /// </summary>
+    pointer_uint_q m_uPoolSize;
+
+    /// <summary>
+    /// Number of blocks that fit into the pool.
+    /// </summary>
+    pointer_uint_q m_uBlockCount;
+
+    /// <summary>
+    /// Alignment of the pool.
+    /// </summary>
+    Kinesis::QuimeraEngine::Common::Memory::QAlignment m_alignment;
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( pop )
+#endif
+
+#endif // __QLOCKFREEPOOLALLOCATOR__
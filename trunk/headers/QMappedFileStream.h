@@ -0,0 +1,565 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QMAPPEDFILESTREAM__
+#define __QMAPPEDFILESTREAM__
+
+#include "SystemDefinitions.h"
+
+#include "DataTypesDefinitions.h"
+#include "EQFileSystemError.h"
+#include "EQFileOpenMode.h"
+#include "QPath.h"
+#include <cstring>
+
+#if defined(QE_OS_WINDOWS)
+    #include <Windows.h>
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+    #include <unistd.h>
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace IO
+{
+namespace FileSystem
+{
+
+/// <summary>
+/// Represents a stream of data stored in a file, whose content is mapped into the address space of the process.
+/// </summary>
+/// <remarks>
+/// It keeps an internal pointer to a position of the stream, which allows reading or writing a group of bytes from there forward.<br/>
+/// The internal pointer can be moved back and forth as necessary, and it will be moved automatically after every read / write operation.<br/>
+/// Unlike QFileStream, there is no intermediate buffer: the operating system loads the pages of the file on demand when they are accessed and 
+/// bytes are copied directly from the mapped memory to the output buffer, or from the input buffer to the mapped memory. Besides, the content of the 
+/// file can be accessed without copying it at all by means of the GetCurrentPointer method. This makes it especially suitable for reading large files.<br/>
+/// Only a window of the file is mapped at a time. Its maximum size is set when the file is opened and it is rounded up to a multiple of the allocation 
+/// granularity of the operating system. When a position outside of the window is accessed, the window that contains it is mapped instead, so files larger 
+/// than the address space available to the process can be operated.<br/>
+/// Streams grow as more memory is required to store the incoming bytes. When that happens, the file is resized, reserving more space than necessary to 
+/// reduce the number of times it occurs; the file is truncated to the length of the stream when it is closed.<br/>
+/// The range of positions this class can point to is limited by the size of pointer_uint_q. When compiling for 32-bits systems, only files whose size is 4 GB or less can be operated;
+/// 64-bits compilations allow up to 16 EB.<br/>
+/// A mapped file stream can be reutilized after it is closed, to operate with either the same file or another one.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QMappedFileStream
+{
+    // TYPEDEFS
+    // ---------------
+public:
+    
+#if defined(QE_OS_WINDOWS)
+
+    typedef HANDLE NativeHandle;
+
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+
+    typedef int NativeHandle;
+
+#endif
+    
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The reallocation factor to be applied to calculate the new size of the mapped file every time it grows. It must be greater than or equal to 1.
+    /// </summary>
+    static float _REALLOCATION_FACTOR;
+
+    /// <summary>
+    /// The default size (in bytes) of the batches used in the copy operation.
+    /// </summary>
+    static const pointer_uint_q _COPY_BATCH_SIZE = 4096U; // 4096 bytes is apparently the most common cluster size in a file system. It should be tuned to improve performance
+
+    /// <summary>
+    /// The default maximum size (in bytes) of the window of the file that is mapped at a time.
+    /// </summary>
+#if defined(QE_ARCH_64BITS)
+    static const pointer_uint_q _DEFAULT_WINDOW_SIZE = 1024U * 1024U * 1024U;
+#else
+    static const pointer_uint_q _DEFAULT_WINDOW_SIZE = 64U * 1024U * 1024U; // The address space of 32-bits processes is easily fragmented
+#endif
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <remarks>
+    /// The instance is ready for opening a file and operate with it.
+    /// </remarks>
+    QMappedFileStream();
+
+    /// <summary>
+    /// Constructor that opens or creates a file stream and maps it into memory.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer's position is set to zero.<br/>
+    /// It calls the Open method.<br/>
+    /// If the current user has no writing permissions on the file, it will be opened as read-only.
+    /// </remarks>
+    /// <param name="filePath">[IN] The path of a file in the file system. It must neither be empty nor contain invalid characters.</param>
+    /// <param name="eOpenMode">[IN] The way the file will be opened.</param>
+    /// <param name="eErrorInfo">[OUT] An error code representing the result of the operation. If nothing unexpected occurred, its value will be Success.</param>
+    /// <param name="uWindowSize">[Optional][IN] The maximum number of bytes of the file that are mapped at a time. It must be greater than zero.</param>
+    QMappedFileStream(const QPath &filePath, const EQFileOpenMode &eOpenMode, EQFileSystemError &eErrorInfo, const pointer_uint_q uWindowSize=QMappedFileStream::_DEFAULT_WINDOW_SIZE);
+
+private:
+
+    // Hidden
+    QMappedFileStream(const QMappedFileStream &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// If the file is open, it will be closed.
+    /// </remarks>
+    ~QMappedFileStream();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    QMappedFileStream& operator=(const QMappedFileStream &);
+
+public:
+
+    /// <summary>
+    /// Reads a group of bytes from the stream and copies them to an output buffer.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer is moved forward by the number of bytes read, after the operation. If the number of bytes
+    /// to read from the current position exceed the stream's limits, the pointer will be moved to the lastest valid position.<br/>
+    /// If the bytes are not in the mapped window, other windows are mapped, so any pointer previously obtained by calling GetCurrentPointer becomes invalid.
+    /// </remarks>
+    /// <param name="pOutput">[IN] The output buffer where bytes are to be copied. Is must not be null.</param>
+    /// <param name="uOutputOffset">[IN] The offset, in bytes, from where to start writing to the output buffer.</param>
+    /// <param name="uOutputSize">[IN] The number of bytes to be read. It must not equal zero.</param>
+    void Read(void* pOutput, const pointer_uint_q uOutputOffset, const pointer_uint_q uOutputSize);
+    
+    /// <summary>
+    /// Copies a group of bytes from an input buffer to the stream.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer is moved forward by the number of bytes written, after the operation.<br/>
+    /// The stream will grow as more memory is required to store new data. This implies that the file is resized and mapped again, so any pointer previously 
+    /// obtained by calling GetCurrentPointer becomes invalid. The same occurs if the bytes are not written in the mapped window.<br/>
+    /// If the position of the internal pointer is not set to the end of the stream, the stream will be partially overwritten.<br/>
+    /// The operating system decides when the modified pages are written to the file, unless the Flush method is called.<br/>
+    /// The current user needs to have writing permissions on the file.
+    /// </remarks>
+    /// <param name="pInput">[IN] The input buffer from which bytes are to be copied. Is must not be null.</param>
+    /// <param name="uInputOffset">[IN] The offset, in bytes, from where to start reading from the input buffer.</param>
+    /// <param name="uInputSize">[IN] The number of bytes to be written. It must not equal zero.</param>
+    void Write(const void* pInput, const pointer_uint_q uInputOffset, const pointer_uint_q uInputSize);
+    
+    /// <summary>
+    /// Copies the content of the stream to another stream of any other kind.
+    /// </summary>
+    /// <remarks>
+    /// Bytes are written to the destination stream sequentially as batches of an arbitrary size, directly from the mapped memory, starting at the specified offset.
+    /// Batches are shortened so they do not exceed the end of the mapped window.<br/>
+    /// The internal pointer of both streams is moved forward by the number of bytes copied.<br/>
+    /// The destination stream will grow as more memory is required to store new data.<br/>
+    /// The Flush method will not be called during this operation.
+    /// </remarks>
+    /// <typeparam name="StreamT">The type of the destination stream.</typeparam>
+    /// <param name="destinationStream">[OUT] The destination stream to which the content will be copied.</param>
+    /// <param name="uSourceOffset">[IN] The offset, in bytes, from where to start reading from the source stream (zero means the first position). 
+    /// It must be lower than the length of the source stream.</param>
+    /// <param name="uDestinationOffset">[IN] The offset, in bytes, from where to start writing to the destination stream (zero means the first position). 
+    /// It must be lower than or equal to the length of the destination stream.</param>
+    /// <param name="uNumberOfBytes">[IN] The number of bytes to copy. It must be lower than the length of the source stream minus the source offset.</param>
+    /// <param name="uBatchSize">[IN] The size, in bytes, of every copied batch. It must be greater than zero. It may affect the performance of the operation.</param>
+    template<class StreamT>
+    void CopyTo(StreamT &destinationStream, const pointer_uint_q uSourceOffset, const pointer_uint_q uDestinationOffset, 
+                                            const pointer_uint_q uNumberOfBytes, const pointer_uint_q uBatchSize=QMappedFileStream::_COPY_BATCH_SIZE)
+    {
+        QE_ASSERT_ERROR(uBatchSize > 0, "The number of bytes per batch must be greater than zero.");
+        QE_ASSERT_ERROR(uSourceOffset < this->GetLength(), "The offset of the source stream is out of bounds.");
+        QE_ASSERT_ERROR(uDestinationOffset <= destinationStream.GetLength(), "The offset of the destination stream is out of bounds.");
+        QE_ASSERT_ERROR(uSourceOffset + uNumberOfBytes <= this->GetLength(), "The number of bytes to copy from the source, starting at the given offset, exceeds the limits of the stream.");
+
+        // If offsets point to valid positions
+        if(uSourceOffset < this->GetLength() && uDestinationOffset <= destinationStream.GetLength())
+        {
+            // The stream is copied batch by batch, with no intermediate buffer
+            destinationStream.SetPosition(uDestinationOffset);
+            m_uPositionPointer = uSourceOffset;
+
+            pointer_uint_q uRemainingBytes = uNumberOfBytes;
+
+            while(uRemainingBytes > 0)
+            {
+                pointer_uint_q uMappedBytes = 0;
+                const u8_q* pBatch = this->_MapWindow(m_uPositionPointer, uMappedBytes);
+
+                if(pBatch == null_q)
+                    break;
+
+                pointer_uint_q uCurrentBatchSize = uBatchSize < uRemainingBytes ? uBatchSize : uRemainingBytes;
+                uCurrentBatchSize = uCurrentBatchSize < uMappedBytes ? uCurrentBatchSize : uMappedBytes;
+
+                destinationStream.Write(pBatch, 0, uCurrentBatchSize);
+                m_uPositionPointer += uCurrentBatchSize;
+                uRemainingBytes -= uCurrentBatchSize;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Sends the modified pages of the mapped memory to the file and waits for the operation to complete.
+    /// </summary>
+    /// <remarks>
+    /// The current user must have writing permissions on the file in case some bytes are needed to be written.
+    /// </remarks>
+    void Flush();
+
+    /// <summary>
+    /// Moves the internal pointer to a prior position.
+    /// </summary>
+    /// <param name="uAmount">[IN] The number of bytes to move back the internal pointer's position. If it is already at the first position, it does nothing.</param>
+    void MoveBackward(const pointer_uint_q uAmount);
+
+    /// <summary>
+    /// Moves the internal pointer to a posterior position.
+    /// </summary>
+    /// <param name="uAmount">[IN] The number of bytes to move forward the internal pointer's position. If it is already at the latest position, it does nothing.</param>
+    void MoveForward(const pointer_uint_q uAmount);
+
+    /// <summary>
+    /// Opens or creates a file stream and maps its content into memory.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer's position is set to zero.<br/>
+    /// The file stream must not be already opened.<br/>
+    /// If the current user has no writing permissions on the file, it will be opened as read-only.
+    /// </remarks>
+    /// <param name="filePath">[IN] The path of a file in the file system. It must neither be empty nor contain invalid characters.</param>
+    /// <param name="eOpenMode">[IN] The way the file will be opened.</param>
+    /// <param name="uWindowSize">[Optional][IN] The maximum number of bytes of the file that are mapped at a time. It must be greater than zero.</param>
+    /// <returns>
+    /// An error code representing the result of the operation. If nothing unexpected occurred, it returns Success.
+    /// </returns>
+    EQFileSystemError Open(const QPath &filePath, const EQFileOpenMode &eOpenMode, const pointer_uint_q uWindowSize=QMappedFileStream::_DEFAULT_WINDOW_SIZE);
+
+    /// <summary>
+    /// Closes the file stream.
+    /// </summary>
+    /// <remarks>
+    /// The Flush method is called before the stream is closed. The file is truncated to the length of the stream.
+    /// </remarks>
+    void Close();
+
+private:
+
+    /// <summary>
+    /// Resizes the file so it can store a given number of bytes, reserving more space than necessary depending on the reallocation factor.
+    /// </summary>
+    /// <remarks>
+    /// The current window is unmapped.
+    /// </remarks>
+    /// <param name="uBytes">[IN] The number of bytes the file has to be able to store. It should be greater than the
+    /// current size of the file.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    bool _ResizeByFactor(const pointer_uint_q uBytes);
+
+    /// <summary>
+    /// Maps the window of the file that contains a given position, unless it is already mapped.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position the window must contain.</param>
+    /// <param name="uMappedBytes">[OUT] The number of mapped bytes from the position to the end of the window. It is zero if the position could not be mapped.</param>
+    /// <returns>
+    /// A pointer to the mapped byte at the position. Returns null if the position is beyond the size of the file or if the window could not be mapped.
+    /// </returns>
+    u8_q* _MapWindow(const pointer_uint_q uPosition, pointer_uint_q &uMappedBytes);
+
+    /// <summary>
+    /// Unmaps the current window, if any.
+    /// </summary>
+    void _UnmapWindow();
+
+    /// <summary>
+    /// The platform-specific implementation of the mapping operation.
+    /// </summary>
+    /// <param name="handle">[IN] The operating system file handle.</param>
+    /// <param name="uOffset">[IN] The position of the first byte of the file to map. It must be a multiple of the allocation granularity.</param>
+    /// <param name="uSize">[IN] The number of bytes of the file to map, starting at the offset. It must be greater than zero.</param>
+    /// <param name="bIsWritingAllowed">[IN] Indicates whether the mapped memory can be written.</param>
+    /// <param name="filePath">[IN] The path to the file.</param>
+    /// <returns>
+    /// A pointer to the mapped content of the file if the operation succeed; Null otherwise.
+    /// </returns>
+    static void* _MapPlatformImplementation(const QMappedFileStream::NativeHandle &handle, const pointer_uint_q uOffset, const pointer_uint_q uSize, const bool bIsWritingAllowed, const QPath &filePath);
+    
+    /// <summary>
+    /// The platform-specific implementation of the unmapping operation.
+    /// </summary>
+    /// <param name="pMappedFile">[IN] The pointer to the mapped content of the file.</param>
+    /// <param name="uSize">[IN] The number of mapped bytes.</param>
+    /// <param name="filePath">[IN] The path to the file.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    static bool _UnmapPlatformImplementation(void* pMappedFile, const pointer_uint_q uSize, const QPath &filePath);
+    
+    /// <summary>
+    /// The platform-specific implementation of the flushing operation.
+    /// </summary>
+    /// <param name="pMappedFile">[IN] The pointer to the mapped content of the file. If it is null, only the file is flushed.</param>
+    /// <param name="uSize">[IN] The number of mapped bytes.</param>
+    /// <param name="handle">[IN] The operating system file handle.</param>
+    /// <param name="filePath">[IN] The path to the file.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    static bool _FlushPlatformImplementation(void* pMappedFile, const pointer_uint_q uSize, const QMappedFileStream::NativeHandle &handle, const QPath &filePath);
+    
+    /// <summary>
+    /// The platform-specific implementation of the resizing operation.
+    /// </summary>
+    /// <param name="handle">[IN] The operating system file handle. The file must not be mapped.</param>
+    /// <param name="uSize">[IN] The new size of the file, in bytes.</param>
+    /// <param name="filePath">[IN] The path to the file.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    static bool _ResizePlatformImplementation(const QMappedFileStream::NativeHandle &handle, const pointer_uint_q uSize, const QPath &filePath);
+    
+    /// <summary>
+    /// The platform-specific implementation of the Open operation.
+    /// </summary>
+    /// <param name="filePath">[IN] The path to the file.</param>
+    /// <param name="eOpenMode">[IN] The way the operating system will open the file.</param>
+    /// <param name="bIsWritingAllowed">[IN] Indicates whether the current user has enough permissions to open the file.</param>
+    /// <param name="handle">[OUT] The operating system file handle.</param>
+    /// <param name="eErrorInfo">[OUT] The result of the operation.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    static bool _OpenPlatformImplementation(const QPath &filePath, const EQFileOpenMode &eOpenMode, const bool bIsWritingAllowed, QMappedFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo);
+    
+    /// <summary>
+    /// The platform-specific implementation of the Close operation.
+    /// </summary>
+    /// <param name="handle">[IN] The operating system file handle.</param>
+    /// <param name="filePath">[IN] The path to the file.</param>
+    /// <returns>
+    /// True if the operation succeed; False otherwise.
+    /// </returns>
+    static bool _ClosePlatformImplementation(const QMappedFileStream::NativeHandle &handle, const QPath &filePath);
+
+    /// <summary>
+    /// The platform-specific implementation of the query of the allocation granularity.
+    /// </summary>
+    /// <returns>
+    /// The number of bytes mapped windows must be aligned to.
+    /// </returns>
+    static pointer_uint_q _GetAllocationGranularityPlatformImplementation();
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the length of the stream, in bytes.
+    /// </summary>
+    /// <returns>
+    /// The number of bytes contained in the stream.
+    /// </returns>
+    pointer_uint_q GetLength() const;
+
+    /// <summary>
+    /// Gets the position of the internal pointer in the stream.
+    /// </summary>
+    /// <returns>
+    /// The byte number to which the internal pointer is pointing to.
+    /// </returns>
+    pointer_uint_q GetPosition() const;
+
+    /// <summary>
+    /// Sets the position of the internal pointer.
+    /// </summary>
+    /// <param name="uPosition">[IN] The new position of the internal pointer. It must be lower than or equal to the length of the stream 
+    /// or it will not be set.</param>
+    void SetPosition(const pointer_uint_q uPosition);
+
+    /// <summary>
+    /// Gets the path of the file.
+    /// </summary>
+    /// <returns>
+    /// The path of the file that is being read/written.
+    /// </returns>
+    QPath GetPath() const;
+
+    /// <summary>
+    /// Indicates whether the file is open or not.
+    /// </summary>
+    /// <returns>
+    /// True if the file is open; False otherwise.
+    /// </returns>
+    bool IsOpen() const;
+    
+    /// <summary>
+    /// Gets the native handle generated by the operating system.
+    /// </summary>
+    /// <returns>
+    /// A handle as the native type for the current operating system.
+    /// </returns>
+    QMappedFileStream::NativeHandle GetNativeHandle() const;
+
+    /// <summary>
+    /// Gets a pointer to the mapped content of the file at the current position of the internal pointer.
+    /// </summary>
+    /// <remarks>
+    /// It allows reading the content of the file without copying it. If the current position is not in the mapped window, the window that contains it is mapped.<br/>
+    /// The pointer is valid until the file is closed, the stream grows or another window is mapped. Only the number of bytes returned by GetAccessibleBytes can be accessed through it.<br/>
+    /// The memory must not be written if the file was opened as read-only.
+    /// </remarks>
+    /// <returns>
+    /// A pointer to the byte the internal pointer points to. If the internal pointer is at the end of the stream, it returns null.
+    /// </returns>
+    void* GetCurrentPointer();
+
+    /// <summary>
+    /// Gets the number of bytes that can be accessed through the pointer returned by GetCurrentPointer.
+    /// </summary>
+    /// <returns>
+    /// The number of bytes of the stream from the current position to the end of the mapped window. If the current position is not in the mapped window, it returns zero.
+    /// </returns>
+    pointer_uint_q GetAccessibleBytes() const;
+
+    /// <summary>
+    /// Gets the maximum number of bytes of the file that are mapped at a time.
+    /// </summary>
+    /// <returns>
+    /// The maximum size of the mapped window, which is a multiple of the allocation granularity of the operating system.
+    /// </returns>
+    pointer_uint_q GetWindowSize() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The path of the file.
+    /// </summary>
+    QPath m_path;
+
+    /// <summary>
+    /// The address where the current window of the file is mapped. It is null when nothing is mapped.
+    /// </summary>
+    void* m_pMappedFile;
+
+    /// <summary>
+    /// The position, in the file, of the first byte of the current window.
+    /// </summary>
+    pointer_uint_q m_uWindowOffset;
+
+    /// <summary>
+    /// The number of bytes of the current window.
+    /// </summary>
+    pointer_uint_q m_uMappedSize;
+
+    /// <summary>
+    /// The maximum number of bytes of a window.
+    /// </summary>
+    pointer_uint_q m_uWindowSize;
+
+    /// <summary>
+    /// The number of bytes windows must be aligned to.
+    /// </summary>
+    pointer_uint_q m_uAllocationGranularity;
+
+    /// <summary>
+    /// The actual size of the file while it is open. It may be greater than the length of the stream.
+    /// </summary>
+    pointer_uint_q m_uReservedSize;
+
+    /// <summary>
+    /// The length of the stream, in bytes.
+    /// </summary>
+    pointer_uint_q m_uFileSize;
+
+    /// <summary>
+    /// A native handle for the file in the local file system.
+    /// </summary>
+    QMappedFileStream::NativeHandle m_nativeHandle;
+
+    /// <summary>
+    /// The position of the internal reading/writing pointer.
+    /// </summary>
+    pointer_uint_q m_uPositionPointer;
+
+    /// <summary>
+    /// Indicates whether the file is open or not.
+    /// </summary>
+    bool m_bIsOpen;
+
+    /// <summary>
+    /// Indicates whether there are modified bytes that have not been flushed yet.
+    /// </summary>
+    bool m_bIsWritePending;
+
+    /// <summary>
+    /// Indicates whether the user has permissions to write to the file or not.
+    /// </summary>
+    bool m_bWritingIsAllowed;
+};
+
+} //namespace FileSystem
+} //namespace IO
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QMAPPEDFILESTREAM__
@@ -30,6 +30,7 @@
 #include "QBaseMatrix3x3.h"
 #include "QBaseMatrix3x4.h"
 #include "StringsDefinitions.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
 
@@ -428,4 +429,6 @@ public:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QMatrix3x3)
+
 #endif // __QMATRIX3X3__
@@ -32,6 +32,7 @@
 #include "QBaseMatrix4x4.h"
 #include "QBaseMatrix4x3.h"
 #include "StringsDefinitions.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
 
@@ -334,5 +335,7 @@ public:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QMatrix3x4)
+
 #endif // __QMATRIX3X4__
 
@@ -32,6 +32,7 @@
 #include "QBaseMatrix3x4.h"
 #include "QBaseMatrix4x4.h"
 #include "StringsDefinitions.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
 
@@ -381,5 +382,7 @@ public:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QMatrix4x3)
+
 #endif // __QMATRIX4X3__
 
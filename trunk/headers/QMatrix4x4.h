@@ -30,6 +30,7 @@
 #include "QBaseMatrix4x4.h"
 #include "QBaseMatrix4x3.h"
 #include "StringsDefinitions.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
 
@@ -435,4 +436,6 @@ public:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QMatrix4x4)
+
 #endif // __QMATRIX4X4__
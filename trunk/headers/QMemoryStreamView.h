@@ -0,0 +1,426 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QMEMORYSTREAMVIEW__
+#define __QMEMORYSTREAMVIEW__
+
+#include "SystemDefinitions.h"
+
+#include "DataTypesDefinitions.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include <cstring>
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace IO
+{
+
+/// <summary>
+/// Represents a stream of data stored in an external memory buffer, which is neither copied nor owned by the stream.
+/// </summary>
+/// <remarks>
+/// It keeps an internal pointer to a position of the buffer, which allows reading or writing a group of bytes from there forward.<br/>
+/// The internal pointer can be moved back and forth as necessary, and it will be moved automatically after every read / write operation.<br/>
+/// Views may be read-only, when they are created from a constant buffer, or writable; writable views have a fixed capacity, the size of the buffer, 
+/// and cannot grow beyond it. The buffer must exist as long as the view, or any view obtained from it, is used.<br/>
+/// Copying a view or getting a slice of it does not copy the content of the buffer, both views share the same memory.
+/// </remarks>
+class QMemoryStreamView
+{
+    
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The default size (in bytes) of the batches used in the copy operation.
+    /// </summary>
+    static const pointer_uint_q _COPY_BATCH_SIZE = 4096U; // 4096 bytes is apparently the most common cluster size in a file system. It should be tuned to improve performance
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that creates a read-only view of an external buffer.
+    /// </summary>
+    /// <remarks>
+    /// The length and the capacity of the stream will equal the size of the buffer.<br/>
+    /// The internal pointer's position is set to zero.
+    /// </remarks>
+    /// <param name="pBuffer">[IN] An external buffer, which will not be copied. It must not be null.</param>
+    /// <param name="uBufferSize">[IN] The size, in bytes, of the external buffer. It must not equal zero.</param>
+    QMemoryStreamView(const void* pBuffer, const pointer_uint_q uBufferSize) : m_pBuffer(scast_q(ccast_q(pBuffer, void*), u8_q*)),
+                                                                               m_uCapacity(uBufferSize),
+                                                                               m_uLength(uBufferSize),
+                                                                               m_uPositionPointer(0),
+                                                                               m_bIsReadOnly(true)
+    {
+        QE_ASSERT_ERROR(pBuffer != null_q, "The buffer cannot be null.");
+        QE_ASSERT_ERROR(uBufferSize != 0, "The buffer size cannot be zero.");
+    }
+
+    /// <summary>
+    /// Constructor that creates a writable view of an external buffer, whose capacity is fixed.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer's position is set to zero.
+    /// </remarks>
+    /// <param name="pBuffer">[IN] An external buffer, which will not be copied. It must not be null.</param>
+    /// <param name="uBufferSize">[IN] The size, in bytes, of the external buffer, which is the capacity of the stream. It must not equal zero.</param>
+    /// <param name="uLength">[IN] The number of bytes of the buffer, from the beginning, that already contain data. Zero means that 
+    /// the stream is empty. It must be lower than or equal to the size of the buffer.</param>
+    QMemoryStreamView(void* pBuffer, const pointer_uint_q uBufferSize, const pointer_uint_q uLength) : m_pBuffer(scast_q(pBuffer, u8_q*)),
+                                                                                                       m_uCapacity(uBufferSize),
+                                                                                                       m_uLength(uLength),
+                                                                                                       m_uPositionPointer(0),
+                                                                                                       m_bIsReadOnly(false)
+    {
+        QE_ASSERT_ERROR(pBuffer != null_q, "The buffer cannot be null.");
+        QE_ASSERT_ERROR(uBufferSize != 0, "The buffer size cannot be zero.");
+        QE_ASSERT_ERROR(uLength <= uBufferSize, "The length of the stream cannot be greater than the size of the buffer.");
+    }
+
+    /// <summary>
+    /// Copy constructor that creates a view of the same buffer another view refers to.
+    /// </summary>
+    /// <remarks>
+    /// The content of the buffer is not copied. The internal pointer's position is copied too.
+    /// </remarks>
+    /// <param name="stream">[IN] The input view to be copied.</param>
+    QMemoryStreamView(const QMemoryStreamView &stream) : m_pBuffer(stream.m_pBuffer),
+                                                         m_uCapacity(stream.m_uCapacity),
+                                                         m_uLength(stream.m_uLength),
+                                                         m_uPositionPointer(stream.m_uPositionPointer),
+                                                         m_bIsReadOnly(stream.m_bIsReadOnly)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Assignment operator that makes the view refer to the same buffer another view refers to.
+    /// </summary>
+    /// <remarks>
+    /// The content of the buffer is not copied. The internal pointer's position is copied too.
+    /// </remarks>
+    /// <param name="stream">[IN] The input view to be copied.</param>
+    /// <returns>
+    /// A reference to the resident view.
+    /// </returns>
+    QMemoryStreamView& operator=(const QMemoryStreamView &stream)
+    {
+        m_pBuffer = stream.m_pBuffer;
+        m_uCapacity = stream.m_uCapacity;
+        m_uLength = stream.m_uLength;
+        m_uPositionPointer = stream.m_uPositionPointer;
+        m_bIsReadOnly = stream.m_bIsReadOnly;
+        return *this;
+    }
+
+    /// <summary>
+    /// Reads a group of bytes from the stream and copies them to an output buffer.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer is moved forward by the number of bytes read, after the operation. If the number of bytes
+    /// to read from the current position exceed the stream's limits, only the available bytes will be copied and the pointer will be moved to the lastest valid position.
+    /// </remarks>
+    /// <param name="pOutput">[IN] The output buffer where bytes are to be copied. Is must not be null.</param>
+    /// <param name="uOutputOffset">[IN] The offset, in bytes, from where to start writing to the output buffer.</param>
+    /// <param name="uOutputSize">[IN] The number of bytes to be read. It must not equal zero.</param>
+    void Read(void* pOutput, const pointer_uint_q uOutputOffset, const pointer_uint_q uOutputSize)
+    {
+        QE_ASSERT_ERROR(uOutputSize > 0, "The output size must not equal zero.");
+        QE_ASSERT_ERROR(pOutput != null_q, "The output buffer cannot be null.");
+        QE_ASSERT_WARNING(m_uPositionPointer + uOutputSize <= m_uLength, "Attempting to read from outside of the buffer.");
+
+        const pointer_uint_q AVAILABLE_BYTES = m_uLength - m_uPositionPointer;
+        const pointer_uint_q BYTES_TO_READ = uOutputSize > AVAILABLE_BYTES ? AVAILABLE_BYTES : uOutputSize;
+
+        memcpy(scast_q(pOutput, u8_q*) + uOutputOffset, m_pBuffer + m_uPositionPointer, BYTES_TO_READ);
+
+        m_uPositionPointer += BYTES_TO_READ;
+    }
+
+    /// <summary>
+    /// Copies a group of bytes from an input buffer to the stream.
+    /// </summary>
+    /// <remarks>
+    /// The internal pointer is moved forward by the number of bytes written, after the operation.<br/>
+    /// The stream cannot grow beyond the size of the buffer; if there is not enough free space, only the bytes that fit will be written.<br/>
+    /// If the position of the internal pointer is not set to the end of the stream, the stream will be partially overwritten.<br/>
+    /// The stream must not be read-only.
+    /// </remarks>
+    /// <param name="pInput">[IN] The input buffer from which bytes are to be copied. Is must not be null.</param>
+    /// <param name="uInputOffset">[IN] The offset, in bytes, from where to start reading from the input buffer.</param>
+    /// <param name="uInputSize">[IN] The number of bytes to be written. It must not equal zero.</param>
+    void Write(const void* pInput, const pointer_uint_q uInputOffset, const pointer_uint_q uInputSize)
+    {
+        QE_ASSERT_ERROR(uInputSize > 0, "The input size must not equal zero.");
+        QE_ASSERT_ERROR(pInput != null_q, "The input buffer cannot be null.");
+        QE_ASSERT_ERROR(!m_bIsReadOnly, "It is not possible to write to a read-only stream.");
+        QE_ASSERT_WARNING(m_uPositionPointer + uInputSize <= m_uCapacity, "Attempting to write outside of the buffer.");
+
+        if(!m_bIsReadOnly)
+        {
+            const pointer_uint_q FREE_BYTES = m_uCapacity - m_uPositionPointer;
+            const pointer_uint_q BYTES_TO_WRITE = uInputSize > FREE_BYTES ? FREE_BYTES : uInputSize;
+
+            memcpy(m_pBuffer + m_uPositionPointer, scast_q(pInput, const u8_q*) + uInputOffset, BYTES_TO_WRITE);
+
+            m_uPositionPointer += BYTES_TO_WRITE;
+
+            if(m_uPositionPointer > m_uLength)
+                m_uLength = m_uPositionPointer;
+        }
+    }
+    
+    /// <summary>
+    /// Copies the content of the stream to another stream of any other kind.
+    /// </summary>
+    /// <remarks>
+    /// Bytes are written to the destination stream sequentially as batches of an arbitrary size, directly from the external buffer, starting at the specified offset.<br/>
+    /// The internal pointer of both streams is moved forward by the number of bytes copied.<br/>
+    /// The destination stream will grow as more memory is required to store new data, if it can.<br/>
+    /// The Flush method will not be called during this operation.
+    /// </remarks>
+    /// <typeparam name="StreamT">The type of the destination stream.</typeparam>
+    /// <param name="destinationStream">[OUT] The destination stream to which the content will be copied.</param>
+    /// <param name="uSourceOffset">[IN] The offset, in bytes, from where to start reading from the source stream (zero means the first position). 
+    /// It must be lower than the length of the source stream.</param>
+    /// <param name="uDestinationOffset">[IN] The offset, in bytes, from where to start writing to the destination stream (zero means the first position). 
+    /// It must be lower than or equal to the length of the destination stream.</param>
+    /// <param name="uNumberOfBytes">[IN] The number of bytes to copy. It must be lower than the length of the source stream minus the source offset.</param>
+    /// <param name="uBatchSize">[IN] The size, in bytes, of every copied batch. It must be greater than zero. It may affect the performance of the operation.</param>
+    template<class StreamT>
+    void CopyTo(StreamT &destinationStream, const pointer_uint_q uSourceOffset, const pointer_uint_q uDestinationOffset, 
+                                            const pointer_uint_q uNumberOfBytes, const pointer_uint_q uBatchSize=QMemoryStreamView::_COPY_BATCH_SIZE)
+    {
+        QE_ASSERT_ERROR(uBatchSize > 0, "The number of bytes per batch must be greater than zero.");
+        QE_ASSERT_ERROR(uSourceOffset < this->GetLength(), "The offset of the source stream is out of bounds.");
+        QE_ASSERT_ERROR(uDestinationOffset <= destinationStream.GetLength(), "The offset of the destination stream is out of bounds.");
+        QE_ASSERT_ERROR(uSourceOffset + uNumberOfBytes <= this->GetLength(), "The number of bytes to copy from the source, starting at the given offset, exceeds the limits of the stream.");
+
+        // If offsets point to valid positions
+        if(uSourceOffset < this->GetLength() && uDestinationOffset <= destinationStream.GetLength())
+        {
+            // The stream is copied batch by batch, with no intermediate buffer
+            const pointer_uint_q NUMBER_OF_BATCHES = uNumberOfBytes / uBatchSize;
+
+            destinationStream.SetPosition(uDestinationOffset);
+
+            for(pointer_uint_q i = 0; i < NUMBER_OF_BATCHES; ++i)
+                destinationStream.Write(m_pBuffer, uSourceOffset + i * uBatchSize, uBatchSize);
+
+            const pointer_uint_q REST_OF_BYTES = uNumberOfBytes % uBatchSize;
+
+            if(REST_OF_BYTES != 0)
+                destinationStream.Write(m_pBuffer, uSourceOffset + NUMBER_OF_BATCHES * uBatchSize, REST_OF_BYTES);
+
+            this->SetPosition(uSourceOffset + uNumberOfBytes);
+        }
+    }
+
+    /// <summary>
+    /// Does nothing, bytes are written directly to the external buffer.
+    /// </summary>
+    void Flush()
+    {
+        // It does nothing
+    }
+    
+    /// <summary>
+    /// Moves the internal pointer to a prior position.
+    /// </summary>
+    /// <param name="uAmount">[IN] The number of bytes to move back the internal pointer's position. If it is already at the first position, it does nothing.</param>
+    void MoveBackward(const pointer_uint_q uAmount)
+    {
+        QE_ASSERT_WARNING(uAmount <= m_uPositionPointer, "It is not possible to move backward the specified amount, it would be out of bounds.");
+
+        if(uAmount <= m_uPositionPointer)
+            m_uPositionPointer -= uAmount;
+    }
+        
+    /// <summary>
+    /// Moves the internal pointer to a posterior position.
+    /// </summary>
+    /// <param name="uAmount">[IN] The number of bytes to move forward the internal pointer's position. If it is already at the latest position, it does nothing.</param>
+    void MoveForward(const pointer_uint_q uAmount)
+    {
+        QE_ASSERT_WARNING(m_uPositionPointer + uAmount <= m_uLength, "It is not possible to move forward the specified amount, it would be out of bounds.");
+
+        if(m_uPositionPointer + uAmount <= m_uLength)
+            m_uPositionPointer += uAmount;
+    }
+
+    /// <summary>
+    /// Gets a view of a part of the stream, which refers to the same buffer.
+    /// </summary>
+    /// <remarks>
+    /// The content of the buffer is not copied. The slice is read-only if the resident view is read-only; otherwise, its capacity equals its length.<br/>
+    /// The internal pointer's position of the slice is set to zero.
+    /// </remarks>
+    /// <param name="uOffset">[IN] The position of the first byte of the slice in the stream. It must be lower than the length of the stream.</param>
+    /// <param name="uLength">[IN] The number of bytes of the slice. It must not equal zero and, along with the offset, it must not exceed the length of the stream.</param>
+    /// <returns>
+    /// The view of the part of the stream.
+    /// </returns>
+    QMemoryStreamView Slice(const pointer_uint_q uOffset, const pointer_uint_q uLength) const
+    {
+        QE_ASSERT_ERROR(uOffset < m_uLength, "The offset of the slice is out of bounds.");
+        QE_ASSERT_ERROR(uOffset + uLength <= m_uLength, "The length of the slice, starting at the given offset, exceeds the limits of the stream.");
+
+        return m_bIsReadOnly ? QMemoryStreamView(scast_q(m_pBuffer + uOffset, const void*), uLength) :
+                               QMemoryStreamView(scast_q(m_pBuffer + uOffset, void*), uLength, uLength);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Gets the length of the stream, in bytes.
+    /// </summary>
+    /// <returns>
+    /// The number of bytes contained in the stream.
+    /// </returns>
+    pointer_uint_q GetLength() const
+    {
+        return m_uLength;
+    }
+    
+    /// <summary>
+    /// Gets the capacity of the stream, which is the size of the external buffer.
+    /// </summary>
+    /// <returns>
+    /// The maximum number of bytes the stream can contain.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_uCapacity;
+    }
+    
+    /// <summary>
+    /// Gets the position of the internal pointer in the stream.
+    /// </summary>
+    /// <returns>
+    /// The byte number to which the internal pointer is pointing to.
+    /// </returns>
+    pointer_uint_q GetPosition() const
+    {
+        return m_uPositionPointer;
+    }
+    
+    /// <summary>
+    /// Sets the position of the internal pointer.
+    /// </summary>
+    /// <param name="uPosition">[IN] The new position of the internal pointer. It must be lower than or equal to the length of the stream 
+    /// or it will not be set.</param>
+    void SetPosition(const pointer_uint_q uPosition)
+    {
+        QE_ASSERT_ERROR(uPosition <= m_uLength, "The input position is invalid, it is out of bounds.");
+
+        if(uPosition <= m_uLength)
+            m_uPositionPointer = uPosition;
+    }
+
+    /// <summary>
+    /// Gets a pointer to the position of the external buffer the internal pointer points to.
+    /// </summary>
+    /// <remarks>
+    /// The content of a read-only stream must not be modified through this pointer.
+    /// </remarks>
+    /// <returns>
+    /// A pointer to the current position.
+    /// </returns>
+    void* GetCurrentPointer() const
+    {
+        return m_pBuffer + m_uPositionPointer;
+    }
+
+    /// <summary>
+    /// Indicates whether the stream can be written or not.
+    /// </summary>
+    /// <returns>
+    /// True if the stream was created from a constant buffer and cannot be written; False otherwise.
+    /// </returns>
+    bool IsReadOnly() const
+    {
+        return m_bIsReadOnly;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The external buffer.
+    /// </summary>
+    u8_q* m_pBuffer;
+
+    /// <summary>
+    /// The size of the external buffer.
+    /// </summary>
+    pointer_uint_q m_uCapacity;
+
+    /// <summary>
+    /// The number of bytes of the external buffer that contain data.
+    /// </summary>
+    pointer_uint_q m_uLength;
+
+    /// <summary>
+    /// The current position of the internal pointer.
+    /// </summary>
+    pointer_uint_q m_uPositionPointer;
+
+    /// <summary>
+    /// Indicates whether the stream can be written or not.
+    /// </summary>
+    bool m_bIsReadOnly;
+};
+
+
+} //namespace IO
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QMEMORYSTREAMVIEW__
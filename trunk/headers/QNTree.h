@@ -37,8 +37,13 @@
 #include "EQTreeTraversalOrder.h"
 #include "EQIterationDirection.h"
 #include "SQInteger.h"
+#include "QArrayFixed.h"
+#include "SQBinarySerializer.h"
+#include "QStringUnicodeSerialization.h"
+#include "QBufferedBinaryWriter.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
 using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
 
 namespace Kinesis
@@ -2683,6 +2688,128 @@ public:
         memcpy(pElementB, arBytes,   sizeof(T));
     }
 
+    /// <summary>
+    /// Writes the elements of the tree to a binary writer.
+    /// </summary>
+    /// <remarks>
+    /// The structure of the tree is written first, as the position of the parent of every node in depth-first pre-order, followed by the elements 
+    /// in the same order. Elements are not stored contiguously, so they are buffered and sent to the writer in blocks.
+    /// </remarks>
+    /// <typeparam name="WriterT">The type of the binary writer. It must provide a WriteBytes method and the left shift operator, like QBinaryStreamWriter does.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer to which the tree will be written.</param>
+    template<class WriterT>
+    void Serialize(WriterT &writer) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+        using Kinesis::QuimeraEngine::Common::DataTypes::QBufferedBinaryWriter;
+
+        static const u64_q NO_PARENT = scast_q(-1, u64_q);
+
+        const pointer_uint_q COUNT = this->GetCount();
+        const u64_q MAXIMUM_CHILDREN = MAX_CHILDREN == QNTree::NO_MAXIMUM_CHILDREN ? NO_PARENT : scast_q(MAX_CHILDREN, u64_q);
+
+        SQBinarySerializer::WriteHeader(writer, SQBinarySerializer::GetElementSize<T>(), COUNT);
+        writer << MAXIMUM_CHILDREN;
+
+        if(COUNT > 0)
+        {
+            QBufferedBinaryWriter<WriterT> bufferedWriter(writer);
+
+            // The position of every node in pre-order, indexed by its position in the internal buffer
+            QArrayFixed<pointer_uint_q> arPreOrderPositions(this->GetCapacity(), 0);
+            pointer_uint_q uPreOrderPosition = 0;
+
+            for(typename QNTree::QConstNTreeIterator it = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder); !it.IsEnd(); ++it, ++uPreOrderPosition)
+            {
+                const pointer_uint_q POSITION = it.GetInternalPosition();
+                const pointer_uint_q PARENT_POSITION = m_pNodeBasePointer[POSITION].GetParent();
+
+                bufferedWriter << (PARENT_POSITION == QNTree::END_POSITION_FORWARD ? NO_PARENT : scast_q(arPreOrderPositions[PARENT_POSITION], u64_q));
+                arPreOrderPositions[POSITION] = uPreOrderPosition;
+            }
+
+            for(typename QNTree::QConstNTreeIterator it = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder); !it.IsEnd(); ++it)
+                SQBinarySerializer::Write(bufferedWriter, &*it, 1U);
+        }
+    }
+
+    /// <summary>
+    /// Replaces the content of the tree with the nodes read from a binary reader.
+    /// </summary>
+    /// <remarks>
+    /// The nodes are built and the elements are read directly into the memory of the tree, in depth-first pre-order, which is only reallocated if its 
+    /// capacity is not enough. Trivially copyable elements (see QSerializationTraits) are read with only one call to the reader and no constructor is 
+    /// called; the rest of elements are default-constructed before being deserialized.<br/>
+    /// The destructor of every existing element will be called.
+    /// </remarks>
+    /// <typeparam name="ReaderT">The type of the binary reader. It must provide a ReadBytes method and the right shift operator, like QBinaryStreamReader does.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the tree will be read. It must have been written by the Serialize method, by a tree whose 
+    /// maximum number of children per node is not greater than the resident tree's.</param>
+    template<class ReaderT>
+    void Deserialize(ReaderT &reader)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+
+        static const u64_q NO_PARENT = scast_q(-1, u64_q);
+
+        const pointer_uint_q COUNT = SQBinarySerializer::ReadHeader(reader, SQBinarySerializer::GetElementSize<T>());
+        u64_q uMaximumChildren = 0;
+        reader >> uMaximumChildren;
+
+        QE_ASSERT_ERROR(MAX_CHILDREN == QNTree::NO_MAXIMUM_CHILDREN || (uMaximumChildren != NO_PARENT && uMaximumChildren <= scast_q(MAX_CHILDREN, u64_q)), 
+                        "The maximum number of children per node of the serialized tree is greater than the resident tree's.");
+
+        this->Clear();
+
+        // Once the allocators are emptied, they return the blocks in the same order they occupy in the buffer
+        m_elementAllocator.Clear();
+        m_nodeAllocator.Clear();
+        this->Reserve(COUNT);
+
+        if(COUNT > 0)
+        {
+            QArrayFixed<u64_q> arParentPositions(COUNT, 0);
+            SQBinarySerializer::Read(reader, &arParentPositions[0], COUNT);
+
+            // The last child added to every node, so the next child is linked to it
+            QArrayFixed<pointer_uint_q> arLastChildren(COUNT, scast_q(QNTree::END_POSITION_FORWARD, pointer_uint_q));
+
+            // Every node occupies the position of the buffer that corresponds to its position in pre-order, so parents are always created before their children
+            for(pointer_uint_q i = 0; i < COUNT; ++i)
+            {
+                m_elementAllocator.Allocate();
+                QNTree::QNode* pNode = new(m_nodeAllocator.Allocate()) QNTree::QNode(QNTree::END_POSITION_FORWARD, QNTree::END_POSITION_FORWARD, QNTree::END_POSITION_FORWARD, QNTree::END_POSITION_FORWARD);
+
+                if(arParentPositions[i] != NO_PARENT)
+                {
+                    const pointer_uint_q PARENT_POSITION = scast_q(arParentPositions[i], pointer_uint_q);
+
+                    QE_ASSERT_ERROR(PARENT_POSITION < i, "The serialized structure of the tree is not valid.");
+
+                    const pointer_uint_q PREVIOUS_POSITION = arLastChildren[PARENT_POSITION];
+                    pNode->SetParent(PARENT_POSITION);
+
+                    if(PREVIOUS_POSITION == QNTree::END_POSITION_FORWARD)
+                    {
+                        m_pNodeBasePointer[PARENT_POSITION].SetFirstChild(i);
+                    }
+                    else
+                    {
+                        m_pNodeBasePointer[PREVIOUS_POSITION].SetNext(i);
+                        pNode->SetPrevious(PREVIOUS_POSITION);
+                    }
+
+                    arLastChildren[PARENT_POSITION] = i;
+                }
+            }
+
+            m_uRoot = 0;
+
+            SQBinarySerializer::Construct(m_pElementBasePointer, COUNT);
+            SQBinarySerializer::Read(reader, m_pElementBasePointer, COUNT);
+        }
+    }
+
 private:
 
     /// <summary>
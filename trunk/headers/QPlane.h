@@ -32,6 +32,7 @@
 
 #include "EQIntersections.h"
 #include "EQSpaceRelation.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
 
@@ -1079,4 +1080,6 @@ private:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QPlane)
+
 #endif // __QPLANE__
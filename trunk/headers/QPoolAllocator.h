@@ -166,6 +166,15 @@ public:
     /// <param name="pNewLocation">[IN] The new memory address where the new block will be reserved. It must not be null, or no reallocation will be done.</param>
     void Reallocate(const pointer_uint_q uNewSize, const void* pNewLocation);
 
+    /// <summary>
+    /// Exchanges the memory chunks, the allocated blocks and the configuration of the allocator with those of another allocator.
+    /// </summary>
+    /// <remarks>
+    /// No block is copied, so the addresses of the allocated blocks do not change, although they will belong to the other allocator.
+    /// </remarks>
+    /// <param name="poolAllocator">[IN/OUT] The allocator to exchange the memory with. It must not be the resident allocator.</param>
+    void Swap(QPoolAllocator &poolAllocator);
+
 
 private:
 
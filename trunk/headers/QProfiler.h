@@ -0,0 +1,427 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QPROFILER__
+#define __QPROFILER__
+
+#include <boost/atomic.hpp>
+#include <boost/thread/tss.hpp>
+
+#include "SystemDefinitions.h"
+#include "QStopwatch.h"
+#include "QArrayDynamic.h"
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( push )
+    #pragma warning( disable: 4251 ) // This warning occurs when using a template specialization as attribute
+#endif
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Diagnosis
+{
+
+/// <summary>
+/// Measures the time spent in scopes of code executed by every thread in a single process, and exports the measurements 
+/// as a Chrome trace (which can be loaded in chrome://tracing) or as a summary report.
+/// </summary>
+/// <remarks>
+/// It is a singleton.<br/>
+/// It is thread-safe. Every thread stores its samples in its own ring buffer, which keeps only the most recent samples, so 
+/// recording samples does not require any synchronization. Ring buffers are registered in a lock-free list the first time a thread 
+/// records a sample, and are reused by other threads when the thread that used them finishes, discarding its samples.<br/>
+/// Samples are not usually recorded directly but by using the QE_PROFILE_SCOPE and QE_PROFILE_FUNCTION macros.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QProfiler
+{
+    // INTERNAL CLASSES
+    // ---------------
+public:
+
+    /// <summary>
+    /// The time spent in a scope of code by a thread.
+    /// </summary>
+    struct QSample
+    {
+        /// <summary>
+        /// The name of the scope. It must exist while the profiler is used.
+        /// </summary>
+        const char* m_szName;
+
+        /// <summary>
+        /// The instant the scope was entered, in nanoseconds since the profiler was created.
+        /// </summary>
+        Kinesis::QuimeraEngine::Common::DataTypes::u64_q m_uStart;
+
+        /// <summary>
+        /// The instant the scope was left, in nanoseconds since the profiler was created.
+        /// </summary>
+        Kinesis::QuimeraEngine::Common::DataTypes::u64_q m_uEnd;
+
+        /// <summary>
+        /// The number of scopes that contained the scope when it was entered.
+        /// </summary>
+        Kinesis::QuimeraEngine::Common::DataTypes::u32_q m_uDepth;
+    };
+
+protected:
+
+    /// <summary>
+    /// A node of the list of ring buffers registered by threads.
+    /// </summary>
+    struct QThreadSamples
+    {
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        QThreadSamples() : m_arSamples(new QSample[QProfiler::SAMPLES_PER_THREAD]),
+                           m_uSampleCount(0),
+                           m_uFirstSample(0),
+                           m_uThreadIndex(0),
+                           m_uCurrentDepth(0),
+                           m_bInUse(true),
+                           m_pNext(null_q)
+        {
+        }
+
+        /// <summary>
+        /// Destructor. It frees the ring buffer.
+        /// </summary>
+        ~QThreadSamples()
+        {
+            delete[] m_arSamples;
+        }
+
+        /// <summary>
+        /// The ring buffer where the thread stores its samples.
+        /// </summary>
+        QSample* m_arSamples;
+
+        /// <summary>
+        /// The number of samples recorded by the thread since the ring buffer was assigned to it. The sample at the position 
+        /// m_uSampleCount % SAMPLES_PER_THREAD will be the next to be overwritten.
+        /// </summary>
+        boost::atomic<Kinesis::QuimeraEngine::Common::DataTypes::u64_q> m_uSampleCount;
+
+        /// <summary>
+        /// The number of recorded samples that were discarded when the profiler was cleared.
+        /// </summary>
+        boost::atomic<Kinesis::QuimeraEngine::Common::DataTypes::u64_q> m_uFirstSample;
+
+        /// <summary>
+        /// A number that identifies the thread that uses the ring buffer in the exported traces. It changes when another thread reuses the ring buffer.
+        /// </summary>
+        boost::atomic<Kinesis::QuimeraEngine::Common::DataTypes::u32_q> m_uThreadIndex;
+
+        /// <summary>
+        /// The number of scopes the thread is currently in. It is only accessed by the thread.
+        /// </summary>
+        Kinesis::QuimeraEngine::Common::DataTypes::u32_q m_uCurrentDepth;
+
+        /// <summary>
+        /// Indicates whether the node belongs to a running thread. Otherwise, it can be reused by another thread.
+        /// </summary>
+        boost::atomic<bool> m_bInUse;
+
+        /// <summary>
+        /// The next node of the list. It does not change once the node has been added to the list.
+        /// </summary>
+        QThreadSamples* m_pNext;
+    };
+
+    /// <summary>
+    /// The accumulated measurements of a scope, used to build the summary report.
+    /// </summary>
+    struct QScopeSummary
+    {
+        /// <summary>
+        /// The name of the scope.
+        /// </summary>
+        const char* m_szName;
+
+        /// <summary>
+        /// The position of the summary of the scope that contains this scope, in the hierarchical summary.
+        /// </summary>
+        pointer_uint_q m_uParent;
+
+        /// <summary>
+        /// The number of times the scope was executed.
+        /// </summary>
+        Kinesis::QuimeraEngine::Common::DataTypes::u64_q m_uCalls;
+
+        /// <summary>
+        /// The time spent in the scope, including the time spent in the scopes it contains, in nanoseconds.
+        /// </summary>
+        Kinesis::QuimeraEngine::Common::DataTypes::u64_q m_uTotalTime;
+
+        /// <summary>
+        /// The time spent in the scope, excluding the time spent in the scopes it contains, in nanoseconds.
+        /// </summary>
+        Kinesis::QuimeraEngine::Common::DataTypes::u64_q m_uSelfTime;
+
+        /// <summary>
+        /// The longest time spent in the scope in a single execution, in nanoseconds.
+        /// </summary>
+        Kinesis::QuimeraEngine::Common::DataTypes::u64_q m_uMaximumTime;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The size of the ring buffer of every thread. When it is full, the oldest samples are overwritten. It is a power of two.<br/>
+    /// Since the thread may be overwriting a sample while they are exported, only the last SAMPLES_PER_THREAD - 1 samples are exported.
+    /// </summary>
+    static const Kinesis::QuimeraEngine::Common::DataTypes::u32_q SAMPLES_PER_THREAD;
+
+protected:
+
+    /// <summary>
+    /// The value that represents a summary without parent, which belongs to a scope not contained in any other.
+    /// </summary>
+    static const pointer_uint_q NO_PARENT;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    QProfiler();
+
+
+    // DESTRUCTOR
+    // ---------------
+private:
+
+    /// <summary>
+    /// Destructor. It frees the ring buffers registered by all the threads.
+    /// </summary>
+    /// <remarks>
+    /// No thread can record samples once the profiler has been destroyed.
+    /// </remarks>
+    ~QProfiler();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the instance of the profiler.
+    /// </summary>
+    /// <returns>
+    /// A unique instance of the profiler.
+    /// </returns>
+    static QProfiler* Get();
+
+    /// <summary>
+    /// Notifies the profiler that the current thread has entered a scope.
+    /// </summary>
+    /// <returns>
+    /// The instant the scope was entered, to be passed to EndSample.
+    /// </returns>
+    Kinesis::QuimeraEngine::Common::DataTypes::u64_q BeginSample();
+
+    /// <summary>
+    /// Notifies the profiler that the current thread has left the last scope it entered, recording a sample in its ring buffer.
+    /// </summary>
+    /// <param name="szName">[IN] The name of the scope. It must not be null. It must exist while the profiler is used; string literals are recommended.</param>
+    /// <param name="uStart">[IN] The instant returned by BeginSample when the scope was entered.</param>
+    void EndSample(const char* szName, const Kinesis::QuimeraEngine::Common::DataTypes::u64_q uStart);
+
+    /// <summary>
+    /// Discards the samples recorded by all the threads until now.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Generates a Chrome trace that contains the samples of all the threads, in the JSON format of trace events.
+    /// </summary>
+    /// <remarks>
+    /// Every sample is a complete event whose time stamp and duration are expressed in microseconds. Every thread is identified by a 
+    /// different number, even if it reuses the ring buffer of a finished thread.<br/>
+    /// Threads can keep recording samples meanwhile; the samples they overwrite during the export are not included.
+    /// </remarks>
+    /// <returns>
+    /// The Chrome trace, which can be saved to a file and loaded in chrome://tracing.
+    /// </returns>
+    Kinesis::QuimeraEngine::Common::DataTypes::string_q ExportToChromeTrace() const;
+
+    /// <summary>
+    /// Generates a report that summarizes the samples of all the threads.
+    /// </summary>
+    /// <remarks>
+    /// The report is composed of two parts. The flat profile lists every scope, ordered by the time spent in it excluding the scopes it contains. 
+    /// The hierarchical profile lists the scopes as a tree, where every scope is indented under the scope that contains it.<br/>
+    /// For every scope, it shows the number of times it was executed, the time spent in it, including and excluding the scopes it contains, 
+    /// and the longest time spent in a single execution. Times are expressed in nanoseconds.<br/>
+    /// Scopes with the same name are merged, even if they belong to different threads.
+    /// </remarks>
+    /// <returns>
+    /// The report, in plain text.
+    /// </returns>
+    Kinesis::QuimeraEngine::Common::DataTypes::string_q GetSummary() const;
+
+protected:
+
+    /// <summary>
+    /// Gets the ring buffer of the current thread, registering it the first time the thread calls this method.
+    /// </summary>
+    /// <returns>
+    /// The ring buffer of the current thread.
+    /// </returns>
+    QThreadSamples* GetCurrentThreadSamples();
+
+    /// <summary>
+    /// Assigns a ring buffer to the current thread, reusing one that belonged to a finished thread or adding a new one to the list
+    /// of registered ring buffers.
+    /// </summary>
+    /// <returns>
+    /// The ring buffer of the current thread, which is empty.
+    /// </returns>
+    QThreadSamples* RegisterCurrentThread();
+
+    /// <summary>
+    /// Marks a registered ring buffer as not used, so other threads can reuse it.
+    /// </summary>
+    /// <remarks>
+    /// It is called when the thread that registered the ring buffer finishes.
+    /// </remarks>
+    /// <param name="pThreadSamples">[IN] The node of the list of registered ring buffers that belongs to the thread.</param>
+    static void ReleaseThreadSamples(QThreadSamples* pThreadSamples);
+
+    /// <summary>
+    /// Copies the samples stored in the ring buffer of a thread, from the oldest to the most recent.
+    /// </summary>
+    /// <param name="threadSamples">[IN] The ring buffer of a thread.</param>
+    /// <param name="arSamples">[OUT] The array where the samples will be added.</param>
+    static void CopySamples(const QThreadSamples &threadSamples, 
+                            Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic<QSample> &arSamples);
+
+    /// <summary>
+    /// Adds the samples of a thread to the summaries of the scopes, both the flat and the hierarchical ones.
+    /// </summary>
+    /// <param name="arSamples">[IN] The samples of a thread, from the oldest to the most recent.</param>
+    /// <param name="arFlatSummaries">[IN/OUT] The summaries of the scopes without taking into account which scopes contain them.</param>
+    /// <param name="arHierarchicalSummaries">[IN/OUT] The summaries of the scopes for every different scope that contains them.</param>
+    static void AddToSummaries(const Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic<QSample> &arSamples, 
+                               Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic<QScopeSummary> &arFlatSummaries, 
+                               Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic<QScopeSummary> &arHierarchicalSummaries);
+
+    /// <summary>
+    /// Adds the measurements of a sample to the summary of a scope, creating it if it does not exist.
+    /// </summary>
+    /// <param name="sample">[IN] The sample whose measurements are to be added.</param>
+    /// <param name="uSelfTime">[IN] The time spent in the scope of the sample excluding the scopes it contains, in nanoseconds.</param>
+    /// <param name="uParent">[IN] The position of the summary of the scope that contains the sample, or NO_PARENT.</param>
+    /// <param name="arSummaries">[IN/OUT] The summaries where to search for the summary of the scope.</param>
+    /// <returns>
+    /// The position of the summary of the scope.
+    /// </returns>
+    static pointer_uint_q AddToSummary(const QSample &sample, 
+                                       const Kinesis::QuimeraEngine::Common::DataTypes::u64_q uSelfTime, 
+                                       const pointer_uint_q uParent, 
+                                       Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic<QScopeSummary> &arSummaries);
+
+    /// <summary>
+    /// Writes the summaries of the scopes contained in a scope, and of the scopes they contain, as lines of the hierarchical profile.
+    /// </summary>
+    /// <param name="arSummaries">[IN] The summaries of the scopes for every different scope that contains them.</param>
+    /// <param name="uParent">[IN] The position of the summary of the containing scope, or NO_PARENT to write the whole tree.</param>
+    /// <param name="uIndentation">[IN] The number of levels to indent the lines.</param>
+    /// <param name="strOutput">[IN/OUT] The string where the lines will be appended.</param>
+    static void AppendHierarchicalSummaries(const Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic<QScopeSummary> &arSummaries, 
+                                            const pointer_uint_q uParent, 
+                                            const unsigned int uIndentation, 
+                                            Kinesis::QuimeraEngine::Common::DataTypes::string_q &strOutput);
+
+    /// <summary>
+    /// Writes the measurements of a scope as a line of the summary report.
+    /// </summary>
+    /// <param name="summary">[IN] The summary of the scope.</param>
+    /// <param name="strOutput">[IN/OUT] The string where the line will be appended.</param>
+    static void AppendSummary(const QScopeSummary &summary, Kinesis::QuimeraEngine::Common::DataTypes::string_q &strOutput);
+
+    /// <summary>
+    /// Writes an amount of nanoseconds as microseconds with three decimals, as expected by Chrome traces.
+    /// </summary>
+    /// <param name="uNanoseconds">[IN] The amount of nanoseconds.</param>
+    /// <param name="strOutput">[IN/OUT] The string where the number will be appended.</param>
+    static void AppendMicroseconds(const Kinesis::QuimeraEngine::Common::DataTypes::u64_q uNanoseconds, Kinesis::QuimeraEngine::Common::DataTypes::string_q &strOutput);
+
+    /// <summary>
+    /// Writes text as a JSON string, enclosed in quotation marks and escaping the characters that cannot appear in it.
+    /// </summary>
+    /// <param name="szText">[IN] The null-terminated text.</param>
+    /// <param name="strOutput">[IN/OUT] The string where the JSON string will be appended.</param>
+    static void AppendJsonString(const char* szText, Kinesis::QuimeraEngine::Common::DataTypes::string_q &strOutput);
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The first node of the list of ring buffers registered by threads. Nodes are never removed from the list.
+    /// </summary>
+    boost::atomic<QThreadSamples*> m_pRegisteredThreadSamples;
+
+    /// <summary>
+    /// The node of the list that belongs to every thread, which is released when the thread finishes.
+    /// </summary>
+    boost::thread_specific_ptr<QThreadSamples> m_currentThreadSamples;
+
+    /// <summary>
+    /// The number of threads that have recorded samples, used to identify them.
+    /// </summary>
+    boost::atomic<Kinesis::QuimeraEngine::Common::DataTypes::u32_q> m_uThreadCount;
+
+    /// <summary>
+    /// The stopwatch that measures the time since the profiler was created, which is the reference of all the samples.
+    /// </summary>
+    Kinesis::QuimeraEngine::System::Timing::QStopwatch m_stopwatch;
+};
+
+} //namespace Diagnosis
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( pop )
+#endif
+
+#endif // __QPROFILER__
@@ -39,9 +39,14 @@
 #include "QVector3.h"
 #include "QVector4.h"
 #include "QTransformationMatrix.h"
+#include "QSoAPointBuffer.h"
+#include "SQVF32.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQVF32;
 
 
 namespace Kinesis
@@ -511,6 +516,226 @@ public:
                 this->Intersection(hexahedron.C, hexahedron.D, hexahedron.F, hexahedron.G));
     }
 
+    /// <summary>
+    /// Calculates the intersection between the ray and the provided triangle, obtaining the distance from the origin of the ray
+    /// to the intersection point and the barycentric coordinates of that point.
+    /// </summary>
+    /// <remarks>
+    /// The intersection is calculated directly from the vertices of the triangle (Moller-Trumbore algorithm), without building the
+    /// plane that contains it, so it is much faster than the methods that return the intersection point. Both faces of the triangle are checked.<br/>
+    /// The intersection point can be obtained as \f$ P = O + t \cdot D \f$ or as \f$ P = (1 - u - v) \cdot A + u \cdot B + v \cdot C \f$.<br/>
+    /// Unlike the other intersection methods, when the ray and the triangle are coplanar it is considered that they do not intersect.
+    /// There is no intersection either when the direction of the ray is null or the vertices of the triangle are aligned.
+    /// </remarks>
+    /// <param name="triangle">[IN] The triangle whose intersection with the ray will be checked.</param>
+    /// <param name="fDistance">[OUT] The distance \f$ t \f$ from the origin of the ray to the intersection point, measured in units of the direction vector.
+    /// It is not modified if there is no intersection.</param>
+    /// <param name="fU">[OUT] The barycentric coordinate \f$ u \f$ of the intersection point, which is the weight of the vertex B.
+    /// It is not modified if there is no intersection.</param>
+    /// <param name="fV">[OUT] The barycentric coordinate \f$ v \f$ of the intersection point, which is the weight of the vertex C.
+    /// It is not modified if there is no intersection.</param>
+    /// <returns>
+    /// True if the ray intersects the triangle; False otherwise.
+    /// </returns>
+    bool Intersection(const QBaseTriangle<VectorT> &triangle, float_q &fDistance, float_q &fU, float_q &fV) const
+    {
+        const QVector3 EDGE_AB(triangle.B.x - triangle.A.x, triangle.B.y - triangle.A.y, triangle.B.z - triangle.A.z);
+        const QVector3 EDGE_AC(triangle.C.x - triangle.A.x, triangle.C.y - triangle.A.y, triangle.C.z - triangle.A.z);
+
+        const QVector3 DIRECTION_CROSS_AC = this->Direction.CrossProduct(EDGE_AC);
+        const float_q DETERMINANT = EDGE_AB.DotProduct(DIRECTION_CROSS_AC);
+
+        // The ray is parallel to the plane of the triangle, or the triangle is degenerate
+        if( SQFloat::IsZero(DETERMINANT) )
+            return false;
+
+        const float_q INVERSE_DETERMINANT = SQFloat::_1 / DETERMINANT;
+        const QVector3 A_TO_ORIGIN(this->Origin.x - triangle.A.x, this->Origin.y - triangle.A.y, this->Origin.z - triangle.A.z);
+
+        const float_q U = A_TO_ORIGIN.DotProduct(DIRECTION_CROSS_AC) * INVERSE_DETERMINANT;
+
+        if( SQFloat::IsNegative(U) )
+            return false;
+
+        const QVector3 ORIGIN_CROSS_AB = A_TO_ORIGIN.CrossProduct(EDGE_AB);
+        const float_q V = this->Direction.DotProduct(ORIGIN_CROSS_AB) * INVERSE_DETERMINANT;
+
+        if( SQFloat::IsNegative(V) || SQFloat::IsGreaterThan(U + V, SQFloat::_1) )
+            return false;
+
+        const float_q DISTANCE = EDGE_AC.DotProduct(ORIGIN_CROSS_AB) * INVERSE_DETERMINANT;
+
+        // The triangle is behind the origin of the ray
+        if( SQFloat::IsNegative(DISTANCE) )
+            return false;
+
+        fDistance = DISTANCE;
+        fU = U;
+        fV = V;
+        return true;
+    }
+
+    /// <summary>
+    /// Calculates the intersections between the ray and a set of triangles whose vertices are stored as structures of arrays, obtaining
+    /// the distance and the barycentric coordinates of every intersection.
+    /// </summary>
+    /// <remarks>
+    /// Every triangle is checked the same way as when using the method that receives only one triangle and returns the distance.
+    /// When math vectorization is enabled, 4 triangles are checked at once.<br/>
+    /// The vertices of the triangle at a given position are the points at the same position in every buffer.
+    /// </remarks>
+    /// <param name="verticesA">[IN] The vertex A of every triangle.</param>
+    /// <param name="verticesB">[IN] The vertex B of every triangle. It must contain as many points as the buffer of vertices A.</param>
+    /// <param name="verticesC">[IN] The vertex C of every triangle. It must contain as many points as the buffer of vertices A.</param>
+    /// <param name="arDistances">[OUT] An array, with as many elements as triangles, where the distance from the origin of the ray to every
+    /// intersection point will be stored. The distance of the triangles that are not intersected is set to -1. It must not be null.</param>
+    /// <param name="arU">[OUT] An array, with as many elements as triangles, where the barycentric coordinate u of every intersection point
+    /// will be stored. It is set to zero for the triangles that are not intersected. It can be null.</param>
+    /// <param name="arV">[OUT] An array, with as many elements as triangles, where the barycentric coordinate v of every intersection point
+    /// will be stored. It is set to zero for the triangles that are not intersected. It can be null.</param>
+    /// <returns>
+    /// The number of triangles intersected by the ray.
+    /// </returns>
+    unsigned int Intersection(const QSoAPointBuffer &verticesA, const QSoAPointBuffer &verticesB, const QSoAPointBuffer &verticesC,
+                              float_q* arDistances, float_q* arU, float_q* arV) const
+    {
+        QE_ASSERT_ERROR( arDistances != null_q, "The output array of distances must not be null" );
+        QE_ASSERT_ERROR( verticesB.GetCount() == verticesA.GetCount() && verticesC.GetCount() == verticesA.GetCount(), "All the buffers must contain the same number of points" );
+
+        const unsigned int TRIANGLE_COUNT = verticesA.GetCount();
+        unsigned int uIntersections = 0;
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+        const vf32_q ORIGIN[]    = { SQVF32::Fill(this->Origin.x), SQVF32::Fill(this->Origin.y), SQVF32::Fill(this->Origin.z) };
+        const vf32_q DIRECTION[] = { SQVF32::Fill(this->Direction.x), SQVF32::Fill(this->Direction.y), SQVF32::Fill(this->Direction.z) };
+
+        // Padding points of the buffers are processed too, but their results are discarded
+        for(unsigned int i = 0; i < TRIANGLE_COUNT; i += QSoAPointBuffer::POINTS_PER_BLOCK)
+        {
+            const vf32_q VERTEX_A[] = { SQVF32::LoadAligned(verticesA.GetX() + i), SQVF32::LoadAligned(verticesA.GetY() + i), SQVF32::LoadAligned(verticesA.GetZ() + i) };
+            const vf32_q EDGE_AB[]  = { SQVF32::Subtract(SQVF32::LoadAligned(verticesB.GetX() + i), VERTEX_A[0]),
+                                        SQVF32::Subtract(SQVF32::LoadAligned(verticesB.GetY() + i), VERTEX_A[1]),
+                                        SQVF32::Subtract(SQVF32::LoadAligned(verticesB.GetZ() + i), VERTEX_A[2]) };
+            const vf32_q EDGE_AC[]  = { SQVF32::Subtract(SQVF32::LoadAligned(verticesC.GetX() + i), VERTEX_A[0]),
+                                        SQVF32::Subtract(SQVF32::LoadAligned(verticesC.GetY() + i), VERTEX_A[1]),
+                                        SQVF32::Subtract(SQVF32::LoadAligned(verticesC.GetZ() + i), VERTEX_A[2]) };
+
+            vf32_q vfDistance, vfU, vfV;
+            const u32_q HIT_MASK = QRay3D<VectorT>::IntersectionSoA(ORIGIN, DIRECTION, VERTEX_A, EDGE_AB, EDGE_AC, vfDistance, vfU, vfV);
+
+            uIntersections += QRay3D<VectorT>::StoreIntersectionBlock(HIT_MASK, vfDistance, vfU, vfV, TRIANGLE_COUNT - i, arDistances + i,
+                                                                     arU == null_q ? null_q : arU + i,
+                                                                     arV == null_q ? null_q : arV + i);
+        }
+#else
+        const QRay3D<QVector3> RAY(QVector3(this->Origin.x, this->Origin.y, this->Origin.z), this->Direction);
+
+        for(unsigned int i = 0; i < TRIANGLE_COUNT; ++i)
+        {
+            float_q fDistance = -SQFloat::_1;
+            float_q fU = SQFloat::_0;
+            float_q fV = SQFloat::_0;
+
+            if( RAY.Intersection(QBaseTriangle<QVector3>(verticesA.GetPoint(i), verticesB.GetPoint(i), verticesC.GetPoint(i)), fDistance, fU, fV) )
+                ++uIntersections;
+
+            arDistances[i] = fDistance;
+
+            if(arU != null_q)
+                arU[i] = fU;
+
+            if(arV != null_q)
+                arV[i] = fV;
+        }
+#endif
+
+        return uIntersections;
+    }
+
+    /// <summary>
+    /// Calculates the intersections between a set of rays and the provided triangle, obtaining the distance and the barycentric coordinates
+    /// of every intersection.
+    /// </summary>
+    /// <remarks>
+    /// Every ray is checked the same way as when using the method that receives only one triangle and returns the distance.
+    /// When math vectorization is enabled, rays are checked in packets of 4.
+    /// </remarks>
+    /// <param name="arRays">[IN] The rays whose intersection with the triangle will be checked. It must not be null.</param>
+    /// <param name="uRays">[IN] The number of rays in the array.</param>
+    /// <param name="triangle">[IN] The triangle whose intersection with the rays will be checked.</param>
+    /// <param name="arDistances">[OUT] An array, with as many elements as rays, where the distance from the origin of every ray to its
+    /// intersection point will be stored. The distance of the rays that do not intersect is set to -1. It must not be null.</param>
+    /// <param name="arU">[OUT] An array, with as many elements as rays, where the barycentric coordinate u of every intersection point
+    /// will be stored. It is set to zero for the rays that do not intersect. It can be null.</param>
+    /// <param name="arV">[OUT] An array, with as many elements as rays, where the barycentric coordinate v of every intersection point
+    /// will be stored. It is set to zero for the rays that do not intersect. It can be null.</param>
+    /// <returns>
+    /// The number of rays that intersect the triangle.
+    /// </returns>
+    static unsigned int Intersection(const QRay3D<VectorT>* arRays, const unsigned int uRays, const QBaseTriangle<VectorT> &triangle,
+                                     float_q* arDistances, float_q* arU, float_q* arV)
+    {
+        QE_ASSERT_ERROR( arRays != null_q, "The input array of rays must not be null" );
+        QE_ASSERT_ERROR( arDistances != null_q, "The output array of distances must not be null" );
+
+        unsigned int uIntersections = 0;
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+        static const unsigned int RAYS_PER_PACKET = 4U;
+
+        const vf32_q VERTEX_A[] = { SQVF32::Fill(triangle.A.x), SQVF32::Fill(triangle.A.y), SQVF32::Fill(triangle.A.z) };
+        const vf32_q EDGE_AB[]  = { SQVF32::Fill(triangle.B.x - triangle.A.x), SQVF32::Fill(triangle.B.y - triangle.A.y), SQVF32::Fill(triangle.B.z - triangle.A.z) };
+        const vf32_q EDGE_AC[]  = { SQVF32::Fill(triangle.C.x - triangle.A.x), SQVF32::Fill(triangle.C.y - triangle.A.y), SQVF32::Fill(triangle.C.z - triangle.A.z) };
+
+        for(unsigned int i = 0; i < uRays; i += RAYS_PER_PACKET)
+        {
+            // The rays are transposed into a packet; the last ray is repeated to fill the incomplete packet at the end
+            float_q arComponents[6][RAYS_PER_PACKET];
+
+            for(unsigned int j = 0; j < RAYS_PER_PACKET; ++j)
+            {
+                const QRay3D<VectorT> &RAY = arRays[i + j < uRays ? i + j : uRays - 1U];
+                arComponents[0][j] = RAY.Origin.x;
+                arComponents[1][j] = RAY.Origin.y;
+                arComponents[2][j] = RAY.Origin.z;
+                arComponents[3][j] = RAY.Direction.x;
+                arComponents[4][j] = RAY.Direction.y;
+                arComponents[5][j] = RAY.Direction.z;
+            }
+
+            const vf32_q ORIGIN[]    = { SQVF32::Load(arComponents[0]), SQVF32::Load(arComponents[1]), SQVF32::Load(arComponents[2]) };
+            const vf32_q DIRECTION[] = { SQVF32::Load(arComponents[3]), SQVF32::Load(arComponents[4]), SQVF32::Load(arComponents[5]) };
+
+            vf32_q vfDistance, vfU, vfV;
+            const u32_q HIT_MASK = QRay3D<VectorT>::IntersectionSoA(ORIGIN, DIRECTION, VERTEX_A, EDGE_AB, EDGE_AC, vfDistance, vfU, vfV);
+
+            uIntersections += QRay3D<VectorT>::StoreIntersectionBlock(HIT_MASK, vfDistance, vfU, vfV, uRays - i, arDistances + i,
+                                                                     arU == null_q ? null_q : arU + i,
+                                                                     arV == null_q ? null_q : arV + i);
+        }
+#else
+        for(unsigned int i = 0; i < uRays; ++i)
+        {
+            float_q fDistance = -SQFloat::_1;
+            float_q fU = SQFloat::_0;
+            float_q fV = SQFloat::_0;
+
+            if( arRays[i].Intersection(triangle, fDistance, fU, fV) )
+                ++uIntersections;
+
+            arDistances[i] = fDistance;
+
+            if(arU != null_q)
+                arU[i] = fU;
+
+            if(arV != null_q)
+                arV[i] = fV;
+        }
+#endif
+
+        return uIntersections;
+    }
+
 
     /// <summary>
     /// Computes the intersection point between resident and provided ray.
@@ -2831,6 +3056,144 @@ private:
                                     .Normalize();
         return auxRay;
     }
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+
+    /// <summary>
+    /// Calculates the intersections between 4 rays and 4 triangles at once, each ray with the triangle at the same position in the packs,
+    /// using the same algorithm as the method that receives only one triangle and returns the distance.
+    /// </summary>
+    /// <param name="arOrigin">[IN] The X, Y and Z components of the origin of the rays, in that order.</param>
+    /// <param name="arDirection">[IN] The X, Y and Z components of the direction of the rays, in that order.</param>
+    /// <param name="arVertexA">[IN] The X, Y and Z components of the vertex A of the triangles, in that order.</param>
+    /// <param name="arEdgeAB">[IN] The X, Y and Z components of the vectors from the vertex A to the vertex B of the triangles, in that order.</param>
+    /// <param name="arEdgeAC">[IN] The X, Y and Z components of the vectors from the vertex A to the vertex C of the triangles, in that order.</param>
+    /// <param name="vfDistance">[OUT] The distance to every intersection point, or -1 where there is no intersection.</param>
+    /// <param name="vfU">[OUT] The barycentric coordinate u of every intersection point, or zero where there is no intersection.</param>
+    /// <param name="vfV">[OUT] The barycentric coordinate v of every intersection point, or zero where there is no intersection.</param>
+    /// <returns>
+    /// A mask whose 4 lowest bits are set when the corresponding ray and triangle intersect; the first component corresponds to the lowest bit.
+    /// </returns>
+    static u32_q IntersectionSoA(const vf32_q* arOrigin, const vf32_q* arDirection, const vf32_q* arVertexA, const vf32_q* arEdgeAB, const vf32_q* arEdgeAC,
+                                 vf32_q &vfDistance, vf32_q &vfU, vf32_q &vfV)
+    {
+        const vf32_q ZERO = SQVF32::Fill(SQFloat::_0);
+        const vf32_q ONE = SQVF32::Fill(SQFloat::_1);
+        const vf32_q EPSILON = SQVF32::Fill(SQFloat::Epsilon);
+        const vf32_q MINUS_EPSILON = SQVF32::Fill(-SQFloat::Epsilon);
+
+        // Products and sums are not fused so results match the scalar version
+        const vf32_q DIRECTION_CROSS_AC_X = SQVF32::Subtract(SQVF32::Multiply(arDirection[1], arEdgeAC[2]), SQVF32::Multiply(arDirection[2], arEdgeAC[1]));
+        const vf32_q DIRECTION_CROSS_AC_Y = SQVF32::Subtract(SQVF32::Multiply(arDirection[2], arEdgeAC[0]), SQVF32::Multiply(arDirection[0], arEdgeAC[2]));
+        const vf32_q DIRECTION_CROSS_AC_Z = SQVF32::Subtract(SQVF32::Multiply(arDirection[0], arEdgeAC[1]), SQVF32::Multiply(arDirection[1], arEdgeAC[0]));
+
+        const vf32_q DETERMINANT = SQVF32::Add(SQVF32::Add(SQVF32::Multiply(arEdgeAB[0], DIRECTION_CROSS_AC_X),
+                                                           SQVF32::Multiply(arEdgeAB[1], DIRECTION_CROSS_AC_Y)),
+                                                           SQVF32::Multiply(arEdgeAB[2], DIRECTION_CROSS_AC_Z));
+
+        // Components whose determinant is zero get infinite or undefined values, they are discarded by the mask
+        const vf32_q INVERSE_DETERMINANT = SQVF32::Divide(ONE, DETERMINANT);
+
+        const vf32_q A_TO_ORIGIN_X = SQVF32::Subtract(arOrigin[0], arVertexA[0]);
+        const vf32_q A_TO_ORIGIN_Y = SQVF32::Subtract(arOrigin[1], arVertexA[1]);
+        const vf32_q A_TO_ORIGIN_Z = SQVF32::Subtract(arOrigin[2], arVertexA[2]);
+
+        const vf32_q U = SQVF32::Multiply(SQVF32::Add(SQVF32::Add(SQVF32::Multiply(A_TO_ORIGIN_X, DIRECTION_CROSS_AC_X),
+                                                                  SQVF32::Multiply(A_TO_ORIGIN_Y, DIRECTION_CROSS_AC_Y)),
+                                                                  SQVF32::Multiply(A_TO_ORIGIN_Z, DIRECTION_CROSS_AC_Z)),
+                                          INVERSE_DETERMINANT);
+
+        const vf32_q ORIGIN_CROSS_AB_X = SQVF32::Subtract(SQVF32::Multiply(A_TO_ORIGIN_Y, arEdgeAB[2]), SQVF32::Multiply(A_TO_ORIGIN_Z, arEdgeAB[1]));
+        const vf32_q ORIGIN_CROSS_AB_Y = SQVF32::Subtract(SQVF32::Multiply(A_TO_ORIGIN_Z, arEdgeAB[0]), SQVF32::Multiply(A_TO_ORIGIN_X, arEdgeAB[2]));
+        const vf32_q ORIGIN_CROSS_AB_Z = SQVF32::Subtract(SQVF32::Multiply(A_TO_ORIGIN_X, arEdgeAB[1]), SQVF32::Multiply(A_TO_ORIGIN_Y, arEdgeAB[0]));
+
+        const vf32_q V = SQVF32::Multiply(SQVF32::Add(SQVF32::Add(SQVF32::Multiply(arDirection[0], ORIGIN_CROSS_AB_X),
+                                                                  SQVF32::Multiply(arDirection[1], ORIGIN_CROSS_AB_Y)),
+                                                                  SQVF32::Multiply(arDirection[2], ORIGIN_CROSS_AB_Z)),
+                                          INVERSE_DETERMINANT);
+
+        const vf32_q DISTANCE = SQVF32::Multiply(SQVF32::Add(SQVF32::Add(SQVF32::Multiply(arEdgeAC[0], ORIGIN_CROSS_AB_X),
+                                                                         SQVF32::Multiply(arEdgeAC[1], ORIGIN_CROSS_AB_Y)),
+                                                                         SQVF32::Multiply(arEdgeAC[2], ORIGIN_CROSS_AB_Z)),
+                                                 INVERSE_DETERMINANT);
+
+        // The same tolerances as in the scalar version are used
+        vf32_q vfHits = SQVF32::Or(SQVF32::CompareGreater(DETERMINANT, EPSILON), SQVF32::CompareLess(DETERMINANT, MINUS_EPSILON));
+        vfHits = SQVF32::And(vfHits, SQVF32::CompareGreaterOrEquals(U, MINUS_EPSILON));
+        vfHits = SQVF32::And(vfHits, SQVF32::CompareGreaterOrEquals(V, MINUS_EPSILON));
+        vfHits = SQVF32::And(vfHits, SQVF32::CompareLessOrEquals(SQVF32::Subtract(SQVF32::Add(U, V), ONE), EPSILON));
+        vfHits = SQVF32::And(vfHits, SQVF32::CompareGreaterOrEquals(DISTANCE, MINUS_EPSILON));
+
+        vfDistance = SQVF32::Select(vfHits, DISTANCE, SQVF32::Fill(-SQFloat::_1));
+        vfU = SQVF32::Select(vfHits, U, ZERO);
+        vfV = SQVF32::Select(vfHits, V, ZERO);
+
+        return SQVF32::ExtractMask(vfHits);
+    }
+
+    /// <summary>
+    /// Copies the results of the intersection of a packet to the output arrays, discarding the components that exceed the end of the arrays.
+    /// </summary>
+    /// <param name="uHitMask">[IN] The mask returned when calculating the intersections.</param>
+    /// <param name="vfDistance">[IN] The distances to the intersection points.</param>
+    /// <param name="vfU">[IN] The barycentric coordinates u of the intersection points.</param>
+    /// <param name="vfV">[IN] The barycentric coordinates v of the intersection points.</param>
+    /// <param name="uRemaining">[IN] The number of elements from the current position to the end of the output arrays.</param>
+    /// <param name="arDistances">[OUT] The output array of distances, at the current position.</param>
+    /// <param name="arU">[OUT] The output array of barycentric coordinates u, at the current position. It can be null.</param>
+    /// <param name="arV">[OUT] The output array of barycentric coordinates v, at the current position. It can be null.</param>
+    /// <returns>
+    /// The number of intersections among the components copied.
+    /// </returns>
+    static unsigned int StoreIntersectionBlock(const u32_q uHitMask, const vf32_q &vfDistance, const vf32_q &vfU, const vf32_q &vfV, const unsigned int uRemaining,
+                                               float_q* arDistances, float_q* arU, float_q* arV)
+    {
+        static const unsigned int COMPONENTS_PER_PACK = 4U;
+
+        u32_q uValidHits = uHitMask;
+
+        if(uRemaining >= COMPONENTS_PER_PACK)
+        {
+            SQVF32::Store(vfDistance, arDistances);
+
+            if(arU != null_q)
+                SQVF32::Store(vfU, arU);
+
+            if(arV != null_q)
+                SQVF32::Store(vfV, arV);
+        }
+        else
+        {
+            float_q arPackDistances[COMPONENTS_PER_PACK];
+            float_q arPackU[COMPONENTS_PER_PACK];
+            float_q arPackV[COMPONENTS_PER_PACK];
+            SQVF32::Store(vfDistance, arPackDistances);
+            SQVF32::Store(vfU, arPackU);
+            SQVF32::Store(vfV, arPackV);
+
+            for(unsigned int i = 0; i < uRemaining; ++i)
+            {
+                arDistances[i] = arPackDistances[i];
+
+                if(arU != null_q)
+                    arU[i] = arPackU[i];
+
+                if(arV != null_q)
+                    arV[i] = arPackV[i];
+            }
+
+            uValidHits &= (1U << uRemaining) - 1U;
+        }
+
+        unsigned int uHits = 0;
+
+        for(; uValidHits != 0; uValidHits &= uValidHits - 1U)
+            ++uHits;
+
+        return uHits;
+    }
+
+#endif // QE_MATH_VECTORIZATION_ENABLED
 };
 
 
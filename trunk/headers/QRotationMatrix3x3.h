@@ -28,6 +28,7 @@
 #define __QROTATIONMATRIX3X3__
 
 #include "QMatrix3x3.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 
@@ -361,4 +362,6 @@ private:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QRotationMatrix3x3)
+
 #endif // __QROTATIONMATRIX3X3__
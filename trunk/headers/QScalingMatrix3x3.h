@@ -28,6 +28,7 @@
 #define __QSCALINGMATRIX3X3__
 
 #include "QMatrix3x3.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 
@@ -315,4 +316,6 @@ private:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QScalingMatrix3x3)
+
 #endif // __QSCALINGMATRIX3X3__
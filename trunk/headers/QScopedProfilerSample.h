@@ -0,0 +1,90 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QSCOPEDPROFILERSAMPLE__
+#define __QSCOPEDPROFILERSAMPLE__
+
+#include "SystemDefinitions.h"
+#include "DataTypesDefinitions.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Diagnosis
+{
+
+/// <summary>
+/// Measures the time spent in a scope of code through the profiler. It is intended to be instanced at the very beginning of a scope so it notifies 
+/// the profiler that the scope has been entered; when the control flow leaves the scope and the instance is destroyed, a sample is recorded.
+/// </summary>
+class QE_LAYER_SYSTEM_SYMBOLS QScopedProfilerSample
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the name of the scope to be measured.
+    /// </summary>
+    /// <param name="szName">[IN] The name of the scope. It must not be null. It must exist while the profiler is used; string literals are recommended.</param>
+    explicit QScopedProfilerSample(const char* szName);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It records the sample of the scope in the profiler.
+    /// </summary>
+    ~QScopedProfilerSample();
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The name of the scope.
+    /// </summary>
+    const char* m_szName;
+
+    /// <summary>
+    /// The instant the scope was entered.
+    /// </summary>
+    Kinesis::QuimeraEngine::Common::DataTypes::u64_q m_uStart;
+};
+
+} //namespace Diagnosis
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QSCOPEDPROFILERSAMPLE__
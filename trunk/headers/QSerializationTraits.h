@@ -0,0 +1,106 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QSERIALIZATIONTRAITS__
+#define __QSERIALIZATIONTRAITS__
+
+#include "CommonDefinitions.h"
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_enum.hpp>
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+
+/// <summary>
+/// Describes how the instances of a type are written to and read from binary streams by SQBinarySerializer.
+/// </summary>
+/// <remarks>
+/// Only arithmetic and enumeration types are considered trivially copyable by default, which means that their instances are written and read as a plain 
+/// sequence of bytes, as QBinaryStreamWriter and QBinaryStreamReader do, and contiguous sequences of them are written and read at once.<br/>
+/// Classes whose instances can be copied byte by byte (like vectors or matrices) must opt in using QE_DECLARE_TRIVIALLY_COPYABLE or 
+/// QE_DECLARE_TRIVIALLY_COPYABLE_TEMPLATE. Any other type is not trivially copyable, 
+/// so it must be default-constructible and provide two methods with the following signature:<br/>
+/// template&lt;class WriterT&gt; void Serialize(WriterT &amp;writer) const;<br/>
+/// template&lt;class ReaderT&gt; void Deserialize(ReaderT &amp;reader);
+/// </remarks>
+/// <typeparam name="T">The type whose serialization is described.</typeparam>
+template<class T>
+class QSerializationTraits
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Indicates whether the instances of the type can be written and read as a plain sequence of bytes.
+    /// </summary>
+    static const bool IS_TRIVIALLY_COPYABLE = boost::is_arithmetic<T>::value || boost::is_enum<T>::value;
+
+};
+
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+
+/// <summary>
+/// Declares that the instances of a class are trivially copyable (see QSerializationTraits). It must be used in the global namespace.
+/// </summary>
+/// <param name="Type">The fully qualified name of the class.</param>
+#define QE_DECLARE_TRIVIALLY_COPYABLE(Type)                                                          \
+            namespace Kinesis { namespace QuimeraEngine { namespace Common { namespace DataTypes {  \
+                template<>                                                                           \
+                class QSerializationTraits< Type >                                                   \
+                {                                                                                    \
+                public:                                                                              \
+                    static const bool IS_TRIVIALLY_COPYABLE = true;                                  \
+                };                                                                                   \
+            } } } }
+
+/// <summary>
+/// Declares that the instances of every specialization of a class template with one type parameter are trivially copyable (see QSerializationTraits). 
+/// It must be used in the global namespace.
+/// </summary>
+/// <param name="Template">The fully qualified name of the class template.</param>
+#define QE_DECLARE_TRIVIALLY_COPYABLE_TEMPLATE(Template)                                             \
+            namespace Kinesis { namespace QuimeraEngine { namespace Common { namespace DataTypes {  \
+                template<class T>                                                                    \
+                class QSerializationTraits< Template<T> >                                            \
+                {                                                                                    \
+                public:                                                                              \
+                    static const bool IS_TRIVIALLY_COPYABLE = true;                                  \
+                };                                                                                   \
+            } } } }
+
+#endif // __QSERIALIZATIONTRAITS__
@@ -0,0 +1,257 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QSOAPOINTBUFFER__
+#define __QSOAPOINTBUFFER__
+
+#include "ToolsDefinitions.h"
+#include "QAlignment.h"
+#include "QBaseVector3.h"
+#include "QVector3.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Math
+{
+
+/// <summary>
+/// Container of 3D points stored as a structure of arrays, this is, the X, Y and Z components of all the points are
+/// kept in three separate contiguous streams instead of being interleaved.
+/// </summary>
+/// <remarks>
+/// This layout allows SQPoint to transform 4 points per instruction when math vectorization is enabled, which is the
+/// recommended way of transforming big point clouds. Use SQPoint::ConvertToSoA and SQPoint::ConvertToAoS to exchange data
+/// with arrays of QVector3 or QVector4.<br/>
+/// Every stream starts at a 16 bytes boundary and its length is rounded up to a multiple of 4 points; the padding components 
+/// are initialized to zero and may be modified by the transformations, so they must not be used.<br/>
+/// Instances of this class cannot be copied.
+/// </remarks>
+class QE_LAYER_TOOLS_SYMBOLS QSoAPointBuffer
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The alignment of the memory address of every component stream, in bytes.
+    /// </summary>
+    static const QAlignment STREAM_ALIGNMENT;
+
+    /// <summary>
+    /// The number of points processed at once by vectorized operations. The length of every stream is a multiple of this value.
+    /// </summary>
+    static const unsigned int POINTS_PER_BLOCK;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the number of points to store. All the components are initialized to zero.
+    /// </summary>
+    /// <param name="uCount">[IN] The number of points in the buffer. It can be zero.</param>
+    explicit QSoAPointBuffer(const unsigned int uCount);
+
+private:
+
+    // Disabled.
+    QSoAPointBuffer(const QSoAPointBuffer &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It frees the memory occupied by the streams.
+    /// </summary>
+    ~QSoAPointBuffer();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Disabled.
+    QSoAPointBuffer& operator=(const QSoAPointBuffer &);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets a copy of a point of the buffer.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position of the point in the buffer. It must be lower than the number of points.</param>
+    /// <returns>
+    /// The point at the given position.
+    /// </returns>
+    QVector3 GetPoint(const unsigned int uIndex) const;
+
+    /// <summary>
+    /// Replaces a point of the buffer.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position of the point in the buffer. It must be lower than the number of points.</param>
+    /// <param name="vPoint">[IN] The new value of the point.</param>
+    void SetPoint(const unsigned int uIndex, const QBaseVector3 &vPoint);
+
+    /// <summary>
+    /// Gets the number of points stored in the buffer.
+    /// </summary>
+    /// <returns>
+    /// The number of points.
+    /// </returns>
+    inline unsigned int GetCount() const
+    {
+        return m_uCount;
+    }
+
+    /// <summary>
+    /// Gets the length of every stream, which is the number of points rounded up to a multiple of POINTS_PER_BLOCK.
+    /// </summary>
+    /// <returns>
+    /// The length of the streams, in number of components.
+    /// </returns>
+    inline unsigned int GetStreamLength() const
+    {
+        return m_uStreamLength;
+    }
+
+    /// <summary>
+    /// Gets the stream that contains the X component of all the points.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first X component. It is aligned to STREAM_ALIGNMENT bytes.
+    /// </returns>
+    inline float_q* GetX()
+    {
+        return m_arX;
+    }
+
+    /// <summary>
+    /// Gets the stream that contains the X component of all the points.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first X component. It is aligned to STREAM_ALIGNMENT bytes.
+    /// </returns>
+    inline const float_q* GetX() const
+    {
+        return m_arX;
+    }
+
+    /// <summary>
+    /// Gets the stream that contains the Y component of all the points.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first Y component. It is aligned to STREAM_ALIGNMENT bytes.
+    /// </returns>
+    inline float_q* GetY()
+    {
+        return m_arY;
+    }
+
+    /// <summary>
+    /// Gets the stream that contains the Y component of all the points.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first Y component. It is aligned to STREAM_ALIGNMENT bytes.
+    /// </returns>
+    inline const float_q* GetY() const
+    {
+        return m_arY;
+    }
+
+    /// <summary>
+    /// Gets the stream that contains the Z component of all the points.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first Z component. It is aligned to STREAM_ALIGNMENT bytes.
+    /// </returns>
+    inline float_q* GetZ()
+    {
+        return m_arZ;
+    }
+
+    /// <summary>
+    /// Gets the stream that contains the Z component of all the points.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first Z component. It is aligned to STREAM_ALIGNMENT bytes.
+    /// </returns>
+    inline const float_q* GetZ() const
+    {
+        return m_arZ;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The number of points stored in the buffer.
+    /// </summary>
+    unsigned int m_uCount;
+
+    /// <summary>
+    /// The length of every stream, including the padding.
+    /// </summary>
+    unsigned int m_uStreamLength;
+
+    /// <summary>
+    /// The X components. The three streams share the same memory block, which begins with this stream.
+    /// </summary>
+    float_q* m_arX;
+
+    /// <summary>
+    /// The Y components.
+    /// </summary>
+    float_q* m_arY;
+
+    /// <summary>
+    /// The Z components.
+    /// </summary>
+    float_q* m_arZ;
+
+};
+
+} //namespace Math
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QSOAPOINTBUFFER__
@@ -28,6 +28,7 @@
 #define __QSPACECONVERSIONMATRIX__
 
 #include "QMatrix4x4.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 
@@ -270,4 +271,6 @@ private:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QSpaceConversionMatrix)
+
 #endif // __QSPACECONVERSIONMATRIX__
@@ -37,6 +37,9 @@
 #include <unicode/numfmt.h>
 #include <sstream>
 #include <math.h>
+#include <boost/atomic.hpp>
+#include <boost/thread/tss.hpp>
+#include <boost/thread/once.hpp>
 
 #include "QCharUnicode.h"
 #include "QArrayResult.h"
@@ -61,7 +64,7 @@ namespace DataTypes
 /// <remarks>
 /// Internally, characters are encoded in UTF-16. This may change in the future.<br/>
 /// Instances of this class are mutable, this means, the same instance can take different values during its lifecycle.<br/>
-/// Instances of this class are not thread-safe.
+/// Instances of this class can be read from several threads at the same time, but they must not be modified while other threads are using them.
 /// </remarks>
 class QE_LAYER_COMMON_SYMBOLS QStringUnicode
 {
@@ -436,6 +439,91 @@ public:
 
     }; // QCharIterator
 
+private:
+
+    /// <summary>
+    /// ICU objects that cannot be used by several threads at the same time (converters, collators and number formatters). Every thread owns 
+    /// an instance of this class, which is created the first time the thread needs any of them and destroyed when the thread ends.
+    /// </summary>
+    /// <remarks>
+    /// Every object is created the first time it is requested.
+    /// </remarks>
+    class QThreadICUObjects
+    {
+        // CONSTANTS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The number of text encodings for which a converter can be created.
+        /// </summary>
+        static const unsigned int CONVERTERS_COUNT = 9U;
+
+
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        QThreadICUObjects();
+
+    private:
+
+        // Hidden
+        QThreadICUObjects(const QThreadICUObjects&);
+
+
+        // DESTRUCTOR
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Destructor that releases all the ICU objects.
+        /// </summary>
+        ~QThreadICUObjects();
+
+
+        // METHODS
+        // ---------------
+    private:
+
+        // Hidden
+        QThreadICUObjects& operator=(const QThreadICUObjects&);
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Converters for every text encoding. The position of every converter is chosen by QStringUnicode::_GetConverter.
+        /// </summary>
+        UConverter* m_arConverters[QThreadICUObjects::CONVERTERS_COUNT];
+
+        /// <summary>
+        /// Collator used for canonical case-sensitive comparisons.
+        /// </summary>
+        icu::Collator* m_pCanonicalCaseSensitiveCollator;
+
+        /// <summary>
+        /// Collator used for canonical case-insensitive comparisons.
+        /// </summary>
+        icu::Collator* m_pCanonicalCaseInsensitiveCollator;
+
+        /// <summary>
+        /// Number formatter configured to parse integer values.
+        /// </summary>
+        icu::NumberFormat* m_pIntegerFormatter;
+
+        /// <summary>
+        /// Number formatter configured to parse floating point values.
+        /// </summary>
+        icu::NumberFormat* m_pFloatFormatter;
+
+    }; // QThreadICUObjects
+
 
     // CONSTANTS
     // ---------------
@@ -461,6 +549,14 @@ public:
     /// </summary>
     static const unsigned int END_POSITION_BACKWARD = -2;
 
+private:
+
+    /// <summary>
+    /// The number of code points between two consecutive entries of the index of code units. Strings whose length is lower or equal than this value
+    /// never build such index.
+    /// </summary>
+    static const unsigned int _CODE_UNIT_INDEX_INTERVAL;
+
 
     // CONSTRUCTORS
     // ---------------
@@ -533,6 +629,16 @@ public:
     /// </remarks>
     /// <param name="szCharacters">[IN] The input sequence of characters. It must not be null.</param>
     QStringUnicode(const wchar_t* szCharacters);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~QStringUnicode();
     
 
     // METHODS
@@ -1418,6 +1524,31 @@ public:
         return strResult;
     }
 
+    /// <summary>
+    /// Writes the string to a binary writer.
+    /// </summary>
+    /// <remarks>
+    /// The text is written in UTF-16, with the local machine's endianness, with only one call to the writer.<br/>
+    /// This method is defined in QStringUnicodeSerialization.h, which must be included to use it.
+    /// </remarks>
+    /// <typeparam name="WriterT">The type of the binary writer. It must provide a WriteBytes method and the left shift operator, like QBinaryStreamWriter does.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer to which the string will be written.</param>
+    template<class WriterT>
+    void Serialize(WriterT &writer) const;
+
+    /// <summary>
+    /// Replaces the content of the string with a string read from a binary reader.
+    /// </summary>
+    /// <remarks>
+    /// The text is read directly into the internal buffer of the string, with only one call to the reader. The length of the string is calculated 
+    /// from the read text, so it is correct even if the length written in the stream is not.<br/>
+    /// This method is defined in QStringUnicodeSerialization.h, which must be included to use it.
+    /// </remarks>
+    /// <typeparam name="ReaderT">The type of the binary reader. It must provide a ReadBytes method and the right shift operator, like QBinaryStreamReader does.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the string will be read. The string must have been written by the Serialize method.</param>
+    template<class ReaderT>
+    void Deserialize(ReaderT &reader);
+
 private:
 
     /// <summary>
@@ -1442,9 +1573,30 @@ private:
     /// <param name="search">[OUT] The resultant search object.</param>
     static void _ConfigureSearch(const EQComparisonType &eComparisonType, icu::StringSearch &search);
 
+    /// <summary>
+    /// Gets the ICU objects owned by the calling thread, creating them if they do not exist yet.
+    /// </summary>
+    /// <remarks>
+    /// The objects are destroyed automatically when the thread ends.
+    /// </remarks>
+    /// <returns>
+    /// The ICU objects of the calling thread.
+    /// </returns>
+    static QThreadICUObjects* _GetThreadICUObjects();
+
+    /// <summary>
+    /// Creates the thread-local storage that holds the ICU objects of every thread. It is called only once.
+    /// </summary>
+    static void _CreateThreadICUObjectsStorage();
+
+protected:
+
     /// <summary>
     /// Gets an ICU number formatter configured to parse integer values.
     /// </summary>
+    /// <remarks>
+    /// Every thread has its own instance.
+    /// </remarks>
     /// <returns>
     /// A number formatter ready to be used.
     /// </returns>
@@ -1453,6 +1605,9 @@ private:
     /// <summary>
     /// Gets an ICU number formatter configured to parse floating point values.
     /// </summary>
+    /// <remarks>
+    /// Every thread has its own instance.
+    /// </remarks>
     /// <returns>
     /// A number formatter ready to be used.
     /// </returns>
@@ -1461,6 +1616,9 @@ private:
     /// <summary>
     /// Gets an ICU converter for a given text encoding.
     /// </summary>
+    /// <remarks>
+    /// Every thread has its own instance.
+    /// </remarks>
     /// <param name="eEncoding">[IN] The text encoding to which the converter will convert.</param>
     /// <returns>
     /// A converter ready to be used.
@@ -1479,12 +1637,61 @@ private:
     /// <summary>
     /// Gets an ICU collator instance for a comparison type.
     /// </summary>
+    /// <remarks>
+    /// Every thread has its own instance.
+    /// </remarks>
     /// <param name="eComparisonType">[IN] The comparison type on which the collation algorithm will be based.</param>
     /// <returns>
     /// An object that applies the chosen collation algorithm to Unicode strings.
     /// </returns>
     static const icu::Collator* _GetCollator(const EQComparisonType &eComparisonType);
 
+private:
+
+    /// <summary>
+    /// Calculates the position, in code units, of the character that occupies a given position in the string.
+    /// </summary>
+    /// <remarks>
+    /// When the string does not contain supplementary characters, both positions are the same and no calculation is performed. Otherwise, the index 
+    /// of code units is built, if it does not exist yet, and the position is obtained by advancing from the closest entry of the index.
+    /// </remarks>
+    /// <param name="uCodePointIndex">[IN] The position of the character, in code points. If it is greater than or equal to the length of the 
+    /// string, the number of code units of the string is returned.</param>
+    /// <returns>
+    /// The position of the first code unit of the character.
+    /// </returns>
+    int32_t _GetCodeUnitIndex(const unsigned int uCodePointIndex) const;
+
+    /// <summary>
+    /// Calculates the position, in code points, of the character that contains a given code unit.
+    /// </summary>
+    /// <remarks>
+    /// When the string does not contain supplementary characters, both positions are the same and no calculation is performed. Otherwise, the index 
+    /// of code units is built, if it does not exist yet, and the position is obtained by counting from the closest entry of the index.
+    /// </remarks>
+    /// <param name="nCodeUnitIndex">[IN] The position of the code unit. It must be lower than or equal to the number of code units of the string.</param>
+    /// <returns>
+    /// The position of the character, in code points.
+    /// </returns>
+    unsigned int _GetCodePointIndex(const int32_t nCodeUnitIndex) const;
+
+    /// <summary>
+    /// Creates the index of code units, which stores the position of the first code unit of one of every N characters of the string.
+    /// </summary>
+    /// <remarks>
+    /// The index is filled before it is published, so several threads can build it at the same time; only the first one to finish 
+    /// stores it and the others destroy their copy.
+    /// </remarks>
+    /// <returns>
+    /// The index of code units stored in the string.
+    /// </returns>
+    const int32_t* _BuildCodeUnitIndex() const;
+
+    /// <summary>
+    /// Destroys the index of code units. It must be called every time the content of the string changes.
+    /// </summary>
+    void _ResetCodeUnitIndex();
+
 
     // PROPERTIES
     // ---------------
@@ -1557,6 +1764,26 @@ private:
     /// The string's length, in code points. It's necessary to store this value separately because calling countChar32 implies traversing the full string every time.
     /// </summary>
     unsigned int m_uLength;
+    
+    /// <summary>
+    /// Index that stores the position, in code units, of one of every N characters of the string (N is defined by _CODE_UNIT_INDEX_INTERVAL), used 
+    /// to find characters by their position without traversing the string from the beginning. It is only created, when needed, if the string contains 
+    /// supplementary characters (whose position in code points does not match their position in code units) and is destroyed every time the string changes.
+    /// Since it is created by constant methods, it is published atomically so the string can be accessed by position from several threads at the same time.
+    /// </summary>
+    mutable boost::atomic<int32_t*> m_arCodeUnitIndex;
+
+    /// <summary>
+    /// The thread-local storage that holds the ICU objects of every thread, which are destroyed when the thread ends. It is created the first time 
+    /// any thread needs its ICU objects and it is never destroyed, so strings can still be used while static objects are being destroyed.
+    /// </summary>
+    static boost::thread_specific_ptr<QThreadICUObjects>* sm_pThreadICUObjects;
+
+    /// <summary>
+    /// Flag that guarantees that the thread-local storage of the ICU objects is created only once, even if several threads need it at the same time.
+    /// Unlike function-local static variables, it is initialized before any code runs.
+    /// </summary>
+    static boost::once_flag sm_threadICUObjectsStorageCreation;
 
 };
 
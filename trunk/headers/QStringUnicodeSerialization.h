@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QSTRINGUNICODESERIALIZATION__
+#define __QSTRINGUNICODESERIALIZATION__
+
+// The serialization methods of the string class are defined in this file instead of in the header of the class, since the serializer
+// depends on the string class being complete
+
+#include "QStringUnicode.h"
+#include "SQBinarySerializer.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+
+template<class WriterT>
+void QStringUnicode::Serialize(WriterT &writer) const
+{
+    const pointer_uint_q CODE_UNITS = scast_q(m_strString.length(), pointer_uint_q);
+
+    SQBinarySerializer::WriteHeader(writer, SQBinarySerializer::GetElementSize<u16_q>(), CODE_UNITS);
+
+    // The length in code points is part of the format, although it is calculated again when reading
+    writer << scast_q(m_uLength, u32_q);
+
+    SQBinarySerializer::Write(writer, rcast_q(m_strString.getBuffer(), const u16_q*), CODE_UNITS);
+}
+
+template<class ReaderT>
+void QStringUnicode::Deserialize(ReaderT &reader)
+{
+    const pointer_uint_q CODE_UNITS = SQBinarySerializer::ReadHeader(reader, SQBinarySerializer::GetElementSize<u16_q>());
+
+    // The written length is ignored since the index of code units depends on it, and a corrupt or malicious stream could break it
+    u32_q uWrittenLength = 0;
+    reader >> uWrittenLength;
+
+    UChar* pBuffer = m_strString.getBuffer(scast_q(CODE_UNITS, int32_t));
+    SQBinarySerializer::Read(reader, rcast_q(pBuffer, u16_q*), CODE_UNITS);
+    m_strString.releaseBuffer(scast_q(CODE_UNITS, int32_t));
+
+    m_uLength = scast_q(m_strString.countChar32(), unsigned int);
+    this->_ResetCodeUnitIndex();
+}
+
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QSTRINGUNICODESERIALIZATION__
@@ -0,0 +1,581 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QTASKSCHEDULER__
+#define __QTASKSCHEDULER__
+
+#include "SystemDefinitions.h"
+#include "QDelegate.h"
+#include "QMutex.h"
+#include "QConditionVariable.h"
+#include "QScopedExclusiveLock.h"
+#include "QThread.h"
+
+#include <boost/atomic.hpp>
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( push )
+    #pragma warning( disable: 4251 ) // This warning occurs when using a template specialization as attribute
+#endif
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Executes tasks using a fixed set of worker threads that balance the work among them by stealing tasks from each other.
+/// </summary>
+/// <remarks>
+/// A task is a function that receives no parameters and belongs to a group, which is used to wait for a set of tasks to finish.
+/// Tasks can depend on other tasks; a task does not start until all the tasks it depends on (its predecessors) have finished.<br/>
+/// Every worker thread has its own queue of tasks. The tasks created by a worker thread are added to its queue, from which it takes
+/// the most recent one first. When the queue is empty, the worker thread steals the oldest task from another queue. Tasks created
+/// by threads that are not workers are added to a queue shared by all those threads.<br/>
+/// Every queue is protected by its own mutex and the counters of tasks are atomic, so threads only share a mutex to sleep when 
+/// there is nothing to do and to wake up other threads.<br/>
+/// The threads that wait for a group also execute tasks while they wait, so tasks can wait for other tasks without blocking a
+/// worker thread.<br/>
+/// This class is thread-safe.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QTaskScheduler
+{
+    // INTERNAL CLASSES
+    // ---------------
+public:
+
+    class QTask;
+
+    /// <summary>
+    /// A set of tasks that can be waited for.
+    /// </summary>
+    /// <remarks>
+    /// A group must not be destroyed while it has pending tasks.
+    /// </remarks>
+    class QE_LAYER_SYSTEM_SYMBOLS QTaskGroup
+    {
+        friend class QTaskScheduler;
+
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        QTaskGroup();
+
+    private:
+
+        // Hidden
+        QTaskGroup(const QTaskGroup&);
+
+
+        // METHODS
+        // ---------------
+    private:
+
+        // Hidden
+        QTaskGroup& operator=(const QTaskGroup&);
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The number of tasks of the group that have been created and have not finished yet.
+        /// </summary>
+        boost::atomic<unsigned int> m_uPendingTasks;
+    };
+
+private:
+
+    /// <summary>
+    /// A node of the list of tasks that have to be notified when a task finishes.
+    /// </summary>
+    struct QContinuation
+    {
+        /// <summary>
+        /// The task that depends on the task that owns the list.
+        /// </summary>
+        QTask* m_pTask;
+
+        /// <summary>
+        /// The next node of the list.
+        /// </summary>
+        QContinuation* m_pNext;
+    };
+
+    /// <summary>
+    /// A double-ended queue of tasks protected by its own mutex.
+    /// </summary>
+    /// <remarks>
+    /// The owner of the queue adds and removes tasks at the back, whereas other threads steal tasks from the front.
+    /// </remarks>
+    class QTaskQueue
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        QTaskQueue();
+
+    private:
+
+        // Hidden
+        QTaskQueue(const QTaskQueue&);
+
+
+        // DESTRUCTOR
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        ~QTaskQueue();
+
+
+        // METHODS
+        // ---------------
+    private:
+
+        // Hidden
+        QTaskQueue& operator=(const QTaskQueue&);
+
+    public:
+
+        /// <summary>
+        /// Adds a task at the back of the queue. The capacity of the queue is doubled when it is full.
+        /// </summary>
+        /// <param name="pTask">[IN] The task to add.</param>
+        void PushBack(QTask* pTask);
+
+        /// <summary>
+        /// Removes the task at the back of the queue, the most recently added.
+        /// </summary>
+        /// <returns>
+        /// The removed task, or null if the queue is empty.
+        /// </returns>
+        QTask* PopBack();
+
+        /// <summary>
+        /// Removes the task at the front of the queue, the least recently added.
+        /// </summary>
+        /// <returns>
+        /// The removed task, or null if the queue is empty.
+        /// </returns>
+        QTask* PopFront();
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The initial number of tasks the queue can store.
+        /// </summary>
+        static const unsigned int INITIAL_CAPACITY;
+
+        /// <summary>
+        /// Mutex that protects the content of the queue.
+        /// </summary>
+        QMutex m_mutex;
+
+        /// <summary>
+        /// A circular buffer that contains the tasks.
+        /// </summary>
+        QTask** m_arTasks;
+
+        /// <summary>
+        /// The number of tasks the buffer can store.
+        /// </summary>
+        unsigned int m_uCapacity;
+
+        /// <summary>
+        /// The position of the task at the front of the queue in the buffer.
+        /// </summary>
+        unsigned int m_uFirst;
+
+        /// <summary>
+        /// The number of tasks in the queue.
+        /// </summary>
+        unsigned int m_uCount;
+    };
+
+    /// <summary>
+    /// A range of iterations of a parallel loop, which is processed by one task.
+    /// </summary>
+    class QParallelForRange
+    {
+    public:
+
+        /// <summary>
+        /// Calls the body of the loop with the range.
+        /// </summary>
+        void Execute();
+
+        /// <summary>
+        /// The function that processes a range of iterations.
+        /// </summary>
+        Kinesis::QuimeraEngine::Common::QDelegate<void (const unsigned int, const unsigned int)> m_body;
+
+        /// <summary>
+        /// The first iteration of the range.
+        /// </summary>
+        unsigned int m_uFirst;
+
+        /// <summary>
+        /// The iteration after the last iteration of the range.
+        /// </summary>
+        unsigned int m_uLast;
+    };
+
+    /// <summary>
+    /// Identifies the worker thread that executes the code. Every thread stores its own instance in thread-local storage.
+    /// </summary>
+    struct QWorkerIdentity
+    {
+        /// <summary>
+        /// The scheduler the worker thread belongs to, or null if the thread is not a worker.
+        /// </summary>
+        const QTaskScheduler* m_pScheduler;
+
+        /// <summary>
+        /// The index of the queue owned by the worker thread.
+        /// </summary>
+        unsigned int m_uQueue;
+    };
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the number of worker threads to create. Threads start waiting for tasks immediately.
+    /// </summary>
+    /// <param name="uWorkerCount">[IN] The number of worker threads. If it is zero, tasks are only executed by the threads that
+    /// wait for groups.</param>
+    explicit QTaskScheduler(const unsigned int uWorkerCount);
+
+private:
+
+    // Hidden
+    QTaskScheduler(const QTaskScheduler&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It waits for all the worker threads to finish.
+    /// </summary>
+    /// <remarks>
+    /// It must not be called while there are pending tasks, all the groups must have been waited for.
+    /// </remarks>
+    ~QTaskScheduler();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    QTaskScheduler& operator=(const QTaskScheduler&);
+
+public:
+
+    /// <summary>
+    /// Creates a task that will not be executed until it is submitted.
+    /// </summary>
+    /// <remarks>
+    /// The task is counted as pending in its group from this moment, so every created task must be submitted eventually or
+    /// waiting for its group will never finish.<br/>
+    /// Use this method, instead of Run, when the task depends on other tasks.
+    /// </remarks>
+    /// <param name="function">[IN] The function to be executed by the task. It must not be null.</param>
+    /// <param name="group">[IN/OUT] The group the task belongs to.</param>
+    /// <returns>
+    /// The created task, which has to be passed to Submit.
+    /// </returns>
+    QTask* CreateTask(const Kinesis::QuimeraEngine::Common::QDelegate<void ()> function, QTaskGroup &group);
+
+    /// <summary>
+    /// Makes a task wait for another task to finish before it starts.
+    /// </summary>
+    /// <remarks>
+    /// Neither of the tasks can have been submitted yet.
+    /// </remarks>
+    /// <param name="pTask">[IN] The task that has to finish first. It must not be null.</param>
+    /// <param name="pContinuation">[IN] The task that will start when the other task finishes. It must not be null.</param>
+    void AddContinuation(QTask* pTask, QTask* pContinuation);
+
+    /// <summary>
+    /// Allows a task to be executed, which will occur as soon as all the tasks it depends on have finished.
+    /// </summary>
+    /// <remarks>
+    /// The task must not be used after calling this method.
+    /// </remarks>
+    /// <param name="pTask">[IN] The task to submit. It must not be null and must not have been submitted already.</param>
+    void Submit(QTask* pTask);
+
+    /// <summary>
+    /// Creates and submits a task that does not depend on other tasks.
+    /// </summary>
+    /// <param name="function">[IN] The function to be executed by the task. It must not be null.</param>
+    /// <param name="group">[IN/OUT] The group the task belongs to.</param>
+    void Run(const Kinesis::QuimeraEngine::Common::QDelegate<void ()> function, QTaskGroup &group);
+
+    /// <summary>
+    /// Waits for all the tasks of a group to finish, executing pending tasks meanwhile.
+    /// </summary>
+    /// <remarks>
+    /// The tasks executed by the calling thread may belong to other groups.
+    /// </remarks>
+    /// <param name="group">[IN/OUT] The group to wait for.</param>
+    void Wait(QTaskGroup &group);
+
+    /// <summary>
+    /// Divides a range of iterations into smaller ranges, processes every range in a different task and waits for all of them
+    /// to finish.
+    /// </summary>
+    /// <remarks>
+    /// It can be called from inside a task.
+    /// </remarks>
+    /// <param name="uFirst">[IN] The first iteration.</param>
+    /// <param name="uLast">[IN] The iteration after the last iteration. If it is not greater than the first iteration,
+    /// nothing is done.</param>
+    /// <param name="body">[IN] The function that processes every range. It receives the first iteration of the range and the
+    /// iteration after the last one. It must not be null.</param>
+    /// <param name="uGrainSize">[Optional][IN] The maximum number of iterations of every range. If it is zero, the iterations are
+    /// distributed in four ranges per thread.</param>
+    void ParallelFor(const unsigned int uFirst,
+                     const unsigned int uLast,
+                     const Kinesis::QuimeraEngine::Common::QDelegate<void (const unsigned int, const unsigned int)> body,
+                     const unsigned int uGrainSize=0);
+
+private:
+
+    /// <summary>
+    /// The function executed by every worker thread, which executes tasks until the scheduler is destroyed.
+    /// </summary>
+    /// <param name="uQueue">[IN] The index of the queue owned by the worker thread.</param>
+    void WorkerLoop(const unsigned int uQueue);
+
+    /// <summary>
+    /// Gets a task from the queue of the calling thread or, if it is empty, steals one from another queue.
+    /// </summary>
+    /// <param name="uQueue">[IN] The index of the queue of the calling thread.</param>
+    /// <returns>
+    /// A task, or null if all the queues are empty.
+    /// </returns>
+    QTask* TakeTask(const unsigned int uQueue);
+
+    /// <summary>
+    /// Executes a task and releases the tasks that depend on it and the waiting threads, if any.
+    /// </summary>
+    /// <param name="pTask">[IN] The task to execute, which is destroyed afterwards.</param>
+    /// <param name="uQueue">[IN] The index of the queue of the calling thread, where the released tasks are added.</param>
+    void ExecuteTask(QTask* pTask, const unsigned int uQueue);
+
+    /// <summary>
+    /// Wakes up sleeping threads so they execute recently added tasks.
+    /// </summary>
+    /// <remarks>
+    /// It must be called after adding the tasks to a queue. The mutex of the scheduler is only locked if there are sleeping threads.
+    /// </remarks>
+    /// <param name="uNewTasks">[IN] The number of tasks that have been added.</param>
+    void WakeUpThreads(const unsigned int uNewTasks);
+
+    /// <summary>
+    /// Gets the index of the queue where the calling thread adds the tasks it creates.
+    /// </summary>
+    /// <returns>
+    /// The index of the queue of the worker thread or, if the calling thread is not a worker of this scheduler, the index of the shared queue.
+    /// </returns>
+    unsigned int GetCurrentQueue() const;
+
+    /// <summary>
+    /// Gets the identity of the calling thread as a worker, which is stored in thread-local storage.
+    /// </summary>
+    /// <returns>
+    /// The identity of the calling thread. Its scheduler is null if the thread is not a worker.
+    /// </returns>
+    static QWorkerIdentity& GetCurrentWorkerIdentity();
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of worker threads.
+    /// </summary>
+    /// <returns>
+    /// The number of worker threads, which does not include the threads that wait for groups.
+    /// </returns>
+    unsigned int GetWorkerCount() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The worker threads.
+    /// </summary>
+    QThread** m_arWorkers;
+
+    /// <summary>
+    /// The number of worker threads.
+    /// </summary>
+    unsigned int m_uWorkerCount;
+
+    /// <summary>
+    /// The queues of tasks. There is one per worker thread plus, at the end, one shared by the rest of threads.
+    /// </summary>
+    QTaskQueue* m_arQueues;
+
+    /// <summary>
+    /// Mutex used along with the condition variables to put threads to sleep and wake them up.
+    /// </summary>
+    QMutex m_mutex;
+
+    /// <summary>
+    /// Condition used to wake the worker threads up when tasks are added or the scheduler is being destroyed.
+    /// </summary>
+    QConditionVariable m_taskAvailable;
+
+    /// <summary>
+    /// Condition used to wake up the threads that wait for groups, when a group finishes or tasks are added.
+    /// </summary>
+    QConditionVariable m_taskFinished;
+
+    /// <summary>
+    /// The number of worker threads waiting for tasks. Threads increment it before checking the queues for the last time, so the 
+    /// threads that add tasks know whether they have to notify them.
+    /// </summary>
+    boost::atomic<unsigned int> m_uSleepingWorkers;
+
+    /// <summary>
+    /// The number of threads waiting for a group to finish. Threads increment it before checking the group for the last time, so the 
+    /// threads that finish tasks know whether they have to notify them.
+    /// </summary>
+    boost::atomic<unsigned int> m_uSleepingWaiters;
+
+    /// <summary>
+    /// Indicates whether the worker threads have to finish.
+    /// </summary>
+    boost::atomic<bool> m_bStopRequested;
+
+};
+
+
+/// <summary>
+/// A task that has been created and has not finished yet. Its content can only be accessed by the scheduler.
+/// </summary>
+/// <remarks>
+/// Tasks are destroyed by the scheduler when they finish, so a pointer to a task must not be used once the task has
+/// been submitted.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QTaskScheduler::QTask
+{
+    friend class QTaskScheduler;
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    /// <summary>
+    /// Constructor that receives the function and the group of the task.
+    /// </summary>
+    /// <param name="function">[IN] The function to be executed by the task.</param>
+    /// <param name="group">[IN] The group the task belongs to.</param>
+    QTask(const Kinesis::QuimeraEngine::Common::QDelegate<void ()> function, QTaskGroup &group);
+
+    // Hidden
+    QTask(const QTask&);
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    QTask& operator=(const QTask&);
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The function to be executed.
+    /// </summary>
+    Kinesis::QuimeraEngine::Common::QDelegate<void ()> m_function;
+
+    /// <summary>
+    /// The group the task belongs to.
+    /// </summary>
+    QTaskGroup* m_pGroup;
+
+    /// <summary>
+    /// The list of tasks that depend on this task.
+    /// </summary>
+    QContinuation* m_pContinuations;
+
+    /// <summary>
+    /// The number of tasks this task depends on that have not finished yet, plus one while the task has not been submitted.
+    /// </summary>
+    boost::atomic<unsigned int> m_uPendingDependencies;
+
+    /// <summary>
+    /// Indicates whether the task has been submitted.
+    /// </summary>
+    bool m_bSubmitted;
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( pop )
+#endif
+
+#endif // __QTASKSCHEDULER__
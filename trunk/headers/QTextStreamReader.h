@@ -34,6 +34,8 @@
 #include "StringsDefinitions.h"
 #include "SQInteger.h"
 
+#include <cstring>
+
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
 
@@ -87,6 +89,16 @@ protected:
     /// The size of a character when using UTF32 encoding, in bytes.
     /// </summary>
     static const pointer_uint_q _CHAR_SIZE_UTF32;
+    
+    /// <summary>
+    /// The minimum size of the batches of bytes read when searching for new line separators in ASCII, ISO-8859-1 and UTF8 texts, in bytes.
+    /// </summary>
+    static const pointer_uint_q _LINE_BATCH_SIZE_MINIMUM;
+    
+    /// <summary>
+    /// The maximum size of the batches of bytes read when searching for new line separators in ASCII, ISO-8859-1 and UTF8 texts, in bytes.
+    /// </summary>
+    static const pointer_uint_q _LINE_BATCH_SIZE_MAXIMUM;
 
 
     // CONSTRUCTORS
@@ -110,7 +122,10 @@ public:
                                          m_eEncoding(Kinesis::QuimeraEngine::Common::DataTypes::EQTextEncoding::E_UTF8),
                                          m_eNewLine(EQNewLineCharacters::E_LF),
                                          m_strNewLine(QTextStreamReader::_NEWLINE_LF),
-                                         m_uCharSize(QTextStreamReader::_CHAR_SIZE_ISO88591_ASCII_UTF8)
+                                         m_uCharSize(QTextStreamReader::_CHAR_SIZE_ISO88591_ASCII_UTF8),
+                                         m_arLineBuffer(null_q),
+                                         m_uLineBufferSize(0),
+                                         m_uLineBatchSize(QTextStreamReader::_LINE_BATCH_SIZE_MINIMUM)
     {
         m_eEncoding = this->_DetectEncoding(stream);
         m_uCharSize = this->_GetCharSizeForEncoding(m_eEncoding);
@@ -131,7 +146,10 @@ public:
                                                                                 m_eEncoding(eStreamEncoding),
                                                                                 m_eNewLine(EQNewLineCharacters::E_LF),
                                                                                 m_strNewLine(QTextStreamReader::_NEWLINE_LF),
-                                                                                m_uCharSize(_GetCharSizeForEncoding(eStreamEncoding))
+                                                                                m_uCharSize(_GetCharSizeForEncoding(eStreamEncoding)),
+                                                                                m_arLineBuffer(null_q),
+                                                                                m_uLineBufferSize(0),
+                                                                                m_uLineBatchSize(QTextStreamReader::_LINE_BATCH_SIZE_MINIMUM)
     {
         this->SetNewLineSeparator(m_eNewLine);
     }
@@ -144,6 +162,20 @@ private:
     QTextStreamReader(const QTextStreamReader&);
 
 
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor that releases the internal buffer used for reading lines.
+    /// </summary>
+    ~QTextStreamReader()
+    {
+        if(m_arLineBuffer != null_q)
+            delete[] m_arLineBuffer;
+    }
+
+
     // METHODS
     // ---------------
 private:
@@ -277,10 +309,119 @@ public:
     /// <param name="strOutput">[OUT] The output string to which the read characters will be appended.</param>
     void ReadLine(string_q &strOutput)
     {
-        using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+        QE_ASSERT_ERROR(m_stream.GetPosition() != m_stream.GetLength(), "The end of the stream was already reached.");
+
+        if(m_uCharSize == QTextStreamReader::_CHAR_SIZE_ISO88591_ASCII_UTF8)
+            this->_ReadLineSingleByteCodeUnits(strOutput);
+        else
+            this->_ReadLineMultipleByteCodeUnits(strOutput);
+    }
+    
+private:
+    
+    /// <summary>
+    /// Reads a line of a text whose encoding uses code units of 1 byte (ASCII, ISO-8859-1 and UTF8), searching for the new line separator
+    /// directly in the bytes of the stream.
+    /// </summary>
+    /// <remarks>
+    /// In UTF8, the bytes of the new line characters never appear as part of other characters, so the text does not need to be decoded to find the
+    /// separator. The bytes of the line are accumulated in an internal buffer and are decoded only once, when the separator is found.<br/>
+    /// The size of the batches adapts to the length of the lines: it is doubled every time a batch does not contain the separator and halved when 
+    /// lines are much shorter than the batch.
+    /// </remarks>
+    /// <param name="strOutput">[OUT] The output string to which the read characters will be appended.</param>
+    void _ReadLineSingleByteCodeUnits(string_q &strOutput)
+    {
         using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
 
-        QE_ASSERT_ERROR(m_stream.GetPosition() != m_stream.GetLength(), "The end of the stream was already reached.");
+        const i8_q SEPARATOR_LAST_BYTE = m_eNewLine == EQNewLineCharacters::E_CR ? '\r' : '\n';
+        const pointer_uint_q SEPARATOR_LENGTH = m_strNewLine.GetLength();
+        const pointer_uint_q REMAINING_BYTES = m_stream.GetLength() - m_stream.GetPosition();
+
+        const i8_q* pSeparator = null_q;
+        pointer_uint_q uReadBytes = 0;
+
+        // Reads batch by batch until either the separator or the end of the stream is found
+        while(pSeparator == null_q && uReadBytes < REMAINING_BYTES)
+        {
+            const pointer_uint_q BATCH_SIZE = REMAINING_BYTES - uReadBytes < m_uLineBatchSize ? REMAINING_BYTES - uReadBytes : m_uLineBatchSize;
+
+            this->_ReserveLineBuffer(uReadBytes + BATCH_SIZE);
+            m_stream.Read(m_arLineBuffer, uReadBytes, BATCH_SIZE);
+
+            const i8_q* pSearchPosition = m_arLineBuffer + uReadBytes;
+            const i8_q* pBatchEnd = pSearchPosition + BATCH_SIZE;
+            uReadBytes += BATCH_SIZE;
+
+            while(pSeparator == null_q && pSearchPosition != pBatchEnd)
+            {
+                const i8_q* pFoundByte = scast_q(memchr(pSearchPosition, SEPARATOR_LAST_BYTE, pBatchEnd - pSearchPosition), const i8_q*);
+
+                // The LF of a CRLF separator must be preceded by a CR, which may have been read in the previous batch
+                if(pFoundByte == null_q)
+                    pSearchPosition = pBatchEnd;
+                else if(m_eNewLine != EQNewLineCharacters::E_CRLF || (pFoundByte != m_arLineBuffer && *(pFoundByte - 1) == '\r'))
+                    pSeparator = pFoundByte + 1 - SEPARATOR_LENGTH;
+                else
+                    pSearchPosition = pFoundByte + 1;
+            }
+
+            if(pSeparator == null_q && m_uLineBatchSize < QTextStreamReader::_LINE_BATCH_SIZE_MAXIMUM)
+                m_uLineBatchSize *= 2U;
+        }
+
+        pointer_uint_q uLineLength = uReadBytes;
+
+        if(pSeparator != null_q)
+        {
+            uLineLength = pSeparator - m_arLineBuffer;
+            m_stream.MoveBackward(uReadBytes - uLineLength - SEPARATOR_LENGTH); // Moves the pointer to the position after the separator
+
+            if(uLineLength + SEPARATOR_LENGTH < m_uLineBatchSize / 4U && m_uLineBatchSize > QTextStreamReader::_LINE_BATCH_SIZE_MINIMUM)
+                m_uLineBatchSize /= 2U;
+        }
+
+        if(uLineLength > 0)
+            strOutput.Append(string_q(m_arLineBuffer, uLineLength, m_eEncoding));
+    }
+    
+    /// <summary>
+    /// Makes sure that the internal buffer used for reading lines can store, at least, a given amount of bytes, keeping its content.
+    /// </summary>
+    /// <param name="uSize">[IN] The minimum size of the buffer, in bytes.</param>
+    void _ReserveLineBuffer(const pointer_uint_q uSize)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+
+        if(uSize > m_uLineBufferSize)
+        {
+            pointer_uint_q uNewSize = m_uLineBufferSize == 0 ? QTextStreamReader::_LINE_BATCH_SIZE_MINIMUM : m_uLineBufferSize;
+
+            while(uNewSize < uSize)
+                uNewSize *= 2U;
+
+            i8_q* arNewLineBuffer = new i8_q[uNewSize];
+
+            if(m_arLineBuffer != null_q)
+            {
+                memcpy(arNewLineBuffer, m_arLineBuffer, m_uLineBufferSize);
+                delete[] m_arLineBuffer;
+            }
+
+            m_arLineBuffer = arNewLineBuffer;
+            m_uLineBufferSize = uNewSize;
+        }
+    }
+    
+    /// <summary>
+    /// Reads a line of a text whose encoding uses code units of more than 1 byte (UTF16 and UTF32), searching for the new line separator
+    /// in the decoded text.
+    /// </summary>
+    /// <param name="strOutput">[OUT] The output string to which the read characters will be appended.</param>
+    void _ReadLineMultipleByteCodeUnits(string_q &strOutput)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+        using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
 
         // Trying with blocks of 256 bytes
         static const pointer_uint_q BATCH_SIZE = 256U;
@@ -586,6 +727,21 @@ protected:
     /// The character size depending on the text encoding.
     /// </summary>
     pointer_uint_q m_uCharSize;
+    
+    /// <summary>
+    /// The buffer where the bytes of a line are accumulated before they are decoded. It grows when a line does not fit in it.
+    /// </summary>
+    Kinesis::QuimeraEngine::Common::DataTypes::i8_q* m_arLineBuffer;
+    
+    /// <summary>
+    /// The size of the buffer where the bytes of a line are accumulated, in bytes.
+    /// </summary>
+    pointer_uint_q m_uLineBufferSize;
+    
+    /// <summary>
+    /// The size of the next batch of bytes to read when searching for new line separators, in bytes. It adapts to the length of the lines.
+    /// </summary>
+    pointer_uint_q m_uLineBatchSize;
 
 };
 
@@ -610,6 +766,12 @@ const pointer_uint_q QTextStreamReader<StreamT>::_CHAR_SIZE_UTF16 = 2U;
 template<class StreamT>
 const pointer_uint_q QTextStreamReader<StreamT>::_CHAR_SIZE_UTF32 = 4U;
 
+template<class StreamT>
+const pointer_uint_q QTextStreamReader<StreamT>::_LINE_BATCH_SIZE_MINIMUM = 256U;
+
+template<class StreamT>
+const pointer_uint_q QTextStreamReader<StreamT>::_LINE_BATCH_SIZE_MAXIMUM = 65536U;
+
 
 } //namespace IO
 } //namespace System
@@ -0,0 +1,277 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QTHREADLOCALPOOLALLOCATOR__
+#define __QTHREADLOCALPOOLALLOCATOR__
+
+#include <boost/thread/tss.hpp>
+
+#include "SystemDefinitions.h"
+#include "QLockFreePoolAllocator.h"
+#include "QMutex.h"
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( push )
+    #pragma warning( disable: 4251 ) // This warning occurs when using a template specialization as attribute
+#endif
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Front-end of a lock-free pool allocator that keeps a cache of free blocks for every thread, so most allocations and
+/// deallocations do not access the shared pool.
+/// </summary>
+/// <remarks>
+/// When the cache of a thread is empty, half of its capacity is filled with blocks taken from the shared pool at once; when
+/// it is full, half of its blocks are returned to the shared pool at once. Blocks can be deallocated by a different thread than
+/// the one that allocated them.<br/>
+/// The blocks cached by a thread are returned to the shared pool when the thread finishes, when it calls ReleaseCache or when
+/// the allocator is destroyed. The allocator can be destroyed while the threads that used it are still running, as long as none of
+/// them uses it anymore; the shared pool must exist until the allocator is destroyed.<br/>
+/// This class is thread-safe.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QThreadLocalPoolAllocator
+{
+    // INTERNAL CLASSES
+    // ---------------
+private:
+
+    struct QThreadCache;
+
+    /// <summary>
+    /// The list of the caches of all the threads that used an allocator.
+    /// </summary>
+    /// <remarks>
+    /// It is shared by the allocator and its caches, and it is destroyed along with the last of them, since threads may finish after the
+    /// allocator has been destroyed.
+    /// </remarks>
+    struct QCacheRegistry
+    {
+        /// <summary>
+        /// Protects the list of caches and the pointer to the shared pool.
+        /// </summary>
+        QMutex m_mutex;
+
+        /// <summary>
+        /// The pool where the blocks are returned. It is null once the allocator has been destroyed.
+        /// </summary>
+        QLockFreePoolAllocator* m_pSharedPool;
+
+        /// <summary>
+        /// The first cache of the list. It is null when there are no caches.
+        /// </summary>
+        QThreadCache* m_pFirstCache;
+    };
+
+    /// <summary>
+    /// The free blocks kept by a thread.
+    /// </summary>
+    struct QThreadCache
+    {
+        /// <summary>
+        /// The registry the cache belongs to.
+        /// </summary>
+        QCacheRegistry* m_pRegistry;
+
+        /// <summary>
+        /// The cached blocks.
+        /// </summary>
+        void** m_arBlocks;
+
+        /// <summary>
+        /// The number of cached blocks.
+        /// </summary>
+        unsigned int m_uCount;
+
+        /// <summary>
+        /// The previous cache in the list of the registry.
+        /// </summary>
+        QThreadCache* m_pPrevious;
+
+        /// <summary>
+        /// The next cache in the list of the registry.
+        /// </summary>
+        QThreadCache* m_pNext;
+    };
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the shared pool and the capacity of the cache of every thread.
+    /// </summary>
+    /// <param name="sharedPool">[IN] The pool from which blocks are obtained. It must exist while the allocator is used.</param>
+    /// <param name="uCacheCapacity">[Optional][IN] The maximum number of blocks every thread keeps. It must be greater than one.</param>
+    explicit QThreadLocalPoolAllocator(QLockFreePoolAllocator &sharedPool, const unsigned int uCacheCapacity=64U);
+
+private:
+
+    // Hidden
+    QThreadLocalPoolAllocator(const QThreadLocalPoolAllocator &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It returns the blocks cached by all the threads to the shared pool.
+    /// </summary>
+    /// <remarks>
+    /// No thread can use the allocator while it is being destroyed.
+    /// </remarks>
+    ~QThreadLocalPoolAllocator();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Allocates a block and returns its address.
+    /// </summary>
+    /// <returns>
+    /// Pointer to the allocated memory block. Returns null if both the cache of the calling thread and the shared pool are empty.
+    /// </returns>
+    void* Allocate();
+
+    /// <summary>
+    /// Deallocates the block passed in the parameter, keeping it in the cache of the calling thread.
+    /// </summary>
+    /// <param name="pBlock">[IN] Pointer to a block previously allocated by this allocator or by the shared pool. It must not be null.</param>
+    void Deallocate(const void* pBlock);
+
+    /// <summary>
+    /// Returns all the blocks cached by the calling thread to the shared pool.
+    /// </summary>
+    void ReleaseCache();
+
+private:
+
+    // Hidden
+    QThreadLocalPoolAllocator& operator=(const QThreadLocalPoolAllocator &);
+
+    /// <summary>
+    /// Gets the cache of the calling thread, creating it if it does not exist.
+    /// </summary>
+    /// <returns>
+    /// The cache of the calling thread.
+    /// </returns>
+    QThreadCache* GetThreadCache();
+
+    /// <summary>
+    /// Gets the cache of the calling thread, if it exists.
+    /// </summary>
+    /// <returns>
+    /// The cache of the calling thread. Returns null if the calling thread has not used the allocator.
+    /// </returns>
+    QThreadCache* FindThreadCache() const;
+
+    /// <summary>
+    /// Returns the blocks of a cache to its shared pool, if the allocator still exists, and destroys it.
+    /// </summary>
+    /// <remarks>
+    /// It is called when a thread finishes. It destroys the registry too if the cache is the last one and the allocator has been destroyed.
+    /// </remarks>
+    /// <param name="pCache">[IN] The cache to destroy.</param>
+    static void DestroyThreadCache(QThreadCache* pCache);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the shared pool from which blocks are obtained.
+    /// </summary>
+    /// <returns>
+    /// The shared pool.
+    /// </returns>
+    QLockFreePoolAllocator& GetSharedPool() const;
+
+    /// <summary>
+    /// Gets the maximum number of blocks every thread keeps.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the cache of every thread.
+    /// </returns>
+    unsigned int GetCacheCapacity() const;
+
+    /// <summary>
+    /// Gets the number of free blocks kept by the calling thread.
+    /// </summary>
+    /// <returns>
+    /// The number of blocks in the cache of the calling thread.
+    /// </returns>
+    unsigned int GetCachedBlockCount() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The pool from which blocks are obtained.
+    /// </summary>
+    QLockFreePoolAllocator& m_sharedPool;
+
+    /// <summary>
+    /// The maximum number of blocks every thread keeps.
+    /// </summary>
+    unsigned int m_uCacheCapacity;
+
+    /// <summary>
+    /// The list of the caches of all the threads.
+    /// </summary>
+    QCacheRegistry* m_pRegistry;
+
+    /// <summary>
+    /// The cache of every thread.
+    /// </summary>
+    boost::thread_specific_ptr<QThreadCache> m_threadCache;
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#ifdef QE_COMPILER_MSVC
+    #pragma warning( pop )
+#endif
+
+#endif // __QTHREADLOCALPOOLALLOCATOR__
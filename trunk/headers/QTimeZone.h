@@ -170,6 +170,18 @@ public:
     /// </summary>
     static const QTimeZone* UTC;
 
+private:
+
+    /// <summary>
+    /// The first year whose DST period is calculated when the time zone is created.
+    /// </summary>
+    static const int _FIRST_CACHED_DST_YEAR = 1916;
+
+    /// <summary>
+    /// The last year whose DST period is calculated when the time zone is created.
+    /// </summary>
+    static const int _LAST_CACHED_DST_YEAR = 2100;
+
     
     // CONSTRUCTORS
     // ---------------
@@ -199,6 +211,16 @@ private:
     QTimeZone(const QTimeZone &timeZone);
 
 
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~QTimeZone();
+
+
     // METHODS
     // ---------------
 public:
@@ -207,6 +229,10 @@ public:
     /// Given a date and a time, it calculates the final offset to be applied to the UTC time in order to get
     /// the local time that corresponds to the time zone.
     /// </summary>
+    /// <remarks>
+    /// The DST periods of the years between 1916 and 2100 are calculated only once, when the time zone is created, so
+    /// the offset of any date in that range is obtained without consulting the DST rules.
+    /// </remarks>
     /// <param name="dateTime">[IN] The date and time for which to calculate the offset. Its time zone does not affect the result. 
     /// It must not be undefined.</param>
     /// <param name="offset">[OUT] The final offset to apply to the UTC time.</param>
@@ -219,6 +245,12 @@ private:
     // Hidden
     QTimeZone& operator=(const QTimeZone &timeZone);
 
+    /// <summary>
+    /// Calculates the DST periods of all the years between _FIRST_CACHED_DST_YEAR and _LAST_CACHED_DST_YEAR, and the
+    /// final offset to apply when DST is active.
+    /// </summary>
+    void _CalculateDstPeriods();
+
 
     // PROPERTIES
     // ---------------
@@ -306,6 +338,28 @@ private:
     /// Indicates whether the time zone may be affected by the DST adjustment or not. True if there is DST information; False otherwise.
     /// </summary>
     bool m_bHasDstOffset;
+
+    /// <summary>
+    /// The first instant the DST is active in every year from _FIRST_CACHED_DST_YEAR to _LAST_CACHED_DST_YEAR. It is null
+    /// if the time zone is not affected by the DST adjustment.
+    /// </summary>
+    QDateTime* m_arDstStartInYear;
+
+    /// <summary>
+    /// The first instant the DST is not active in every year from _FIRST_CACHED_DST_YEAR to _LAST_CACHED_DST_YEAR. It is
+    /// null if the time zone is not affected by the DST adjustment.
+    /// </summary>
+    QDateTime* m_arDstEndInYear;
+
+    /// <summary>
+    /// The final offset to apply to the UTC time when DST is active, which combines the time zone offset and the DST offset.
+    /// </summary>
+    QTimeSpan m_offsetWithDst;
+
+    /// <summary>
+    /// The sign of the final offset to apply when DST is active. True if it is negative, False otherwise.
+    /// </summary>
+    bool m_bOffsetWithDstIsNegative;
 };
 
 } //namespace Time
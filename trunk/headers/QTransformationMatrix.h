@@ -36,6 +36,8 @@
 #include "QMatrix4x3.h"
 #include "QMatrix4x4.h"
 #include "QTranslationMatrix.h"
+#include "SQMatrixSIMD.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
@@ -515,6 +517,11 @@ public:
         // The results will be wrong when the determinant equals zero
         QE_ASSERT_WARNING( this->GetDeterminant() != SQFloat::_0, "Matrices whose determinant equals zero do not have inverse, this will produce a division by zero" );
 
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+        MatrixT aux;
+        SQMatrixSIMD::InvertTransformation(*this, aux);
+        return aux;
+#else
         // Gets the inverse of the Determinant.
         const float_q INV_DET = SQFloat::_1 / this->GetDeterminant();
 
@@ -558,6 +565,7 @@ public:
                                    fT * this->ij[3][0] - fU * this->ij[3][1] - fE * this->ij[3][2] );
 
         return aux;
+#endif
     }
 
     /// <summary>
@@ -892,6 +900,9 @@ private:
     template <class MatrixParamT>
     void ProductOperatorImp(const QTransformationMatrix<MatrixParamT> &matrix, QTransformationMatrix<MatrixT> &outMatrix) const
     {
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+        SQMatrixSIMD::MultiplyTransformations(*this, matrix, outMatrix);
+#else
         outMatrix = *this;
 
         outMatrix.ij[0][0] = this->ij[0][0] * matrix.ij[0][0] + this->ij[0][1] * matrix.ij[1][0] + this->ij[0][2] * matrix.ij[2][0];
@@ -909,6 +920,7 @@ private:
         outMatrix.ij[3][0] = this->ij[3][0] * matrix.ij[0][0] + this->ij[3][1] * matrix.ij[1][0] + this->ij[3][2] * matrix.ij[2][0] + matrix.ij[3][0];
         outMatrix.ij[3][1] = this->ij[3][0] * matrix.ij[0][1] + this->ij[3][1] * matrix.ij[1][1] + this->ij[3][2] * matrix.ij[2][1] + matrix.ij[3][1];
         outMatrix.ij[3][2] = this->ij[3][0] * matrix.ij[0][2] + this->ij[3][1] * matrix.ij[1][2] + this->ij[3][2] * matrix.ij[2][2] + matrix.ij[3][2];
+#endif
     }
 
     /// <summary>
@@ -942,6 +954,9 @@ private:
     template <class MatrixParamT>
     void ProductAssignationOperatorImp(const QTransformationMatrix<MatrixParamT> &matrix)
     {
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+        SQMatrixSIMD::MultiplyTransformations(*this, matrix, *this);
+#else
         QTransformationMatrix<MatrixT> aux;
 
         aux = *this;
@@ -963,6 +978,7 @@ private:
         aux.ij[3][2] = this->ij[3][0] * matrix.ij[0][2] + this->ij[3][1] * matrix.ij[1][2] + this->ij[3][2] * matrix.ij[2][2] + matrix.ij[3][2];
 
         *this = aux;
+#endif
     }
 
     /// <summary>
@@ -1140,5 +1156,7 @@ Kinesis::QuimeraEngine::Tools::Math::QTransformationMatrix<MatrixT> operator*(co
 } //namespace Tools
 } //namespace QuimeraEngine
 } //namespace Kinesis
+
+QE_DECLARE_TRIVIALLY_COPYABLE_TEMPLATE(Kinesis::QuimeraEngine::Tools::Math::QTransformationMatrix)
     
 #endif // __QTRANSFORMATIONMATRIX__
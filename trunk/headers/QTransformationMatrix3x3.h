@@ -28,6 +28,7 @@
 #define __QTRANSFORMATIONMATRIX3X3__
 
 #include "QMatrix3x3.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 
@@ -191,4 +192,6 @@ private:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QTransformationMatrix3x3)
+
 #endif // __QTRANSFORMATIONMATRIX3x3__
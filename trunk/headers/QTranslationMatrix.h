@@ -35,6 +35,7 @@
 #include "QTransformationMatrix.h"
 #include "QMatrix4x3.h"
 #include "QMatrix4x4.h"
+#include "QSerializationTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
@@ -490,4 +491,6 @@ template class QE_LAYER_TOOLS_SYMBOLS QTranslationMatrix<Kinesis::QuimeraEngine:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE_TEMPLATE(Kinesis::QuimeraEngine::Tools::Math::QTranslationMatrix)
+
 #endif // __QTRANSLATIONMATRIX__
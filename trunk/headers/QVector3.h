@@ -29,6 +29,7 @@
 
 #include "QBaseVector3.h"
 #include "StringsDefinitions.h"
+#include "QSerializationTraits.h"
 
 
 using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
@@ -691,4 +692,6 @@ private:
 } //namespace QuimeraEngine
 } //namespace Kinesis
 
+QE_DECLARE_TRIVIALLY_COPYABLE(Kinesis::QuimeraEngine::Tools::Math::QVector3)
+
 #endif // __QVECTOR3__
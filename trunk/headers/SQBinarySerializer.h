@@ -0,0 +1,273 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQBINARYSERIALIZER__
+#define __SQBINARYSERIALIZER__
+
+#include "CommonDefinitions.h"
+#include "DataTypesDefinitions.h"
+#include "Assertions.h"
+#include "QSerializationTraits.h"
+#include "QStringUnicode.h"
+#include <new>
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+
+/// <summary>
+/// Writes and reads sequences of elements of any type to and from binary streams, in the format shared by strings and containers.
+/// </summary>
+/// <remarks>
+/// Every serialized object starts with a header that contains the version of the format, the size of the elements (zero if they are not trivially copyable) 
+/// and the number of elements.<br/>
+/// Trivially copyable elements (see QSerializationTraits) stored contiguously are written and read with only one call to the stream; other elements 
+/// are written and read one by one, using their Serialize and Deserialize methods.<br/>
+/// Writers must provide a WriteBytes method and the left shift operator, like QBinaryStreamWriter does. Readers must provide a ReadBytes method and 
+/// the right shift operator, like QBinaryStreamReader does.
+/// </remarks>
+class SQBinarySerializer
+{
+    // INTERNAL CLASSES
+    // ---------------
+private:
+
+    /// <summary>
+    /// Writes and reads elements depending on whether they are trivially copyable or not.
+    /// </summary>
+    /// <typeparam name="IsTriviallyCopyableT">Indicates whether the elements are trivially copyable.</typeparam>
+    template<bool IsTriviallyCopyableT>
+    class QElementSerializer;
+
+
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The version of the format written by the serializer. It increases every time the format changes.
+    /// </summary>
+    static const u32_q FORMAT_VERSION = 1U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQBinarySerializer();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Writes the header that precedes the elements of a serialized object.
+    /// </summary>
+    /// <typeparam name="WriterT">The type of the binary writer.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer to which the header will be written.</param>
+    /// <param name="uElementSize">[IN] The size of every element, as returned by GetElementSize.</param>
+    /// <param name="uCount">[IN] The number of elements that will be written after the header.</param>
+    template<class WriterT>
+    static void WriteHeader(WriterT &writer, const u32_q uElementSize, const pointer_uint_q uCount)
+    {
+        writer << scast_q(SQBinarySerializer::FORMAT_VERSION, u32_q);
+        writer << uElementSize;
+        writer << scast_q(uCount, u64_q);
+    }
+
+    /// <summary>
+    /// Reads the header that precedes the elements of a serialized object.
+    /// </summary>
+    /// <typeparam name="ReaderT">The type of the binary reader.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the header will be read.</param>
+    /// <param name="uElementSize">[IN] The expected size of every element, as returned by GetElementSize. It must be equal to the size that was written.</param>
+    /// <returns>
+    /// The number of elements that follow the header.
+    /// </returns>
+    template<class ReaderT>
+    static pointer_uint_q ReadHeader(ReaderT &reader, const u32_q uElementSize)
+    {
+        u32_q uVersion = 0;
+        u32_q uWrittenElementSize = 0;
+        u64_q uCount = 0;
+        reader >> uVersion;
+        reader >> uWrittenElementSize;
+        reader >> uCount;
+
+        QE_ASSERT_ERROR(uVersion > 0 && uVersion <= SQBinarySerializer::FORMAT_VERSION, "The version of the serialized data is not supported.");
+        QE_ASSERT_ERROR(uWrittenElementSize == uElementSize, "The serialized elements do not match the type of the elements to be read.");
+
+        return scast_q(uCount, pointer_uint_q);
+    }
+
+    /// <summary>
+    /// Writes a sequence of contiguous elements.
+    /// </summary>
+    /// <typeparam name="T">The type of the elements.</typeparam>
+    /// <typeparam name="WriterT">The type of the binary writer.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer to which the elements will be written.</param>
+    /// <param name="arElements">[IN] The elements to write. It must not be null if the number of elements is greater than zero.</param>
+    /// <param name="uCount">[IN] The number of elements to write.</param>
+    template<class T, class WriterT>
+    static void Write(WriterT &writer, const T* arElements, const pointer_uint_q uCount)
+    {
+        QE_ASSERT_ERROR(arElements != null_q || uCount == 0, "The input array cannot be null.");
+
+        SQBinarySerializer::QElementSerializer<QSerializationTraits<T>::IS_TRIVIALLY_COPYABLE>::Write(writer, arElements, uCount);
+    }
+
+    /// <summary>
+    /// Reads a sequence of contiguous elements.
+    /// </summary>
+    /// <remarks>
+    /// The elements must have been prepared with the Construct method.
+    /// </remarks>
+    /// <typeparam name="T">The type of the elements.</typeparam>
+    /// <typeparam name="ReaderT">The type of the binary reader.</typeparam>
+    /// <param name="reader">[IN/OUT] The reader from which the elements will be read.</param>
+    /// <param name="arElements">[OUT] The elements to be filled. It must not be null if the number of elements is greater than zero.</param>
+    /// <param name="uCount">[IN] The number of elements to read.</param>
+    template<class T, class ReaderT>
+    static void Read(ReaderT &reader, T* arElements, const pointer_uint_q uCount)
+    {
+        QE_ASSERT_ERROR(arElements != null_q || uCount == 0, "The output array cannot be null.");
+
+        SQBinarySerializer::QElementSerializer<QSerializationTraits<T>::IS_TRIVIALLY_COPYABLE>::Read(reader, arElements, uCount);
+    }
+
+    /// <summary>
+    /// Prepares a sequence of uninitialized elements in memory before reading them.
+    /// </summary>
+    /// <remarks>
+    /// Trivially copyable elements are not constructed since all their bytes will be overwritten. The default constructor is called for the rest of elements.
+    /// </remarks>
+    /// <typeparam name="T">The type of the elements.</typeparam>
+    /// <param name="arElements">[IN/OUT] The memory where the elements will be constructed. It must not be null if the number of elements is greater than zero.</param>
+    /// <param name="uCount">[IN] The number of elements to construct.</param>
+    template<class T>
+    static void Construct(T* arElements, const pointer_uint_q uCount)
+    {
+        QE_ASSERT_ERROR(arElements != null_q || uCount == 0, "The input array cannot be null.");
+
+        SQBinarySerializer::QElementSerializer<QSerializationTraits<T>::IS_TRIVIALLY_COPYABLE>::Construct(arElements, uCount);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the size of the elements of a type as it is written in the header of serialized objects.
+    /// </summary>
+    /// <typeparam name="T">The type of the elements.</typeparam>
+    /// <returns>
+    /// The size of the type, in bytes, if it is trivially copyable; zero otherwise. It is also the minimum number of bytes every element occupies once written.
+    /// </returns>
+    template<class T>
+    static u32_q GetElementSize()
+    {
+        return QSerializationTraits<T>::IS_TRIVIALLY_COPYABLE ? scast_q(sizeof(T), u32_q) : 0;
+    }
+
+};
+
+
+// INTERNAL CLASSES
+// ------------------
+
+/// <summary>
+/// Writes and reads trivially copyable elements, copying all their bytes at once.
+/// </summary>
+template<>
+class SQBinarySerializer::QElementSerializer<true>
+{
+public:
+
+    template<class T, class WriterT>
+    static void Write(WriterT &writer, const T* arElements, const pointer_uint_q uCount)
+    {
+        if(uCount > 0)
+            writer.WriteBytes(arElements, uCount * sizeof(T));
+    }
+
+    template<class T, class ReaderT>
+    static void Read(ReaderT &reader, T* arElements, const pointer_uint_q uCount)
+    {
+        if(uCount > 0)
+            reader.ReadBytes(arElements, uCount * sizeof(T));
+    }
+
+    template<class T>
+    static void Construct(T*, const pointer_uint_q)
+    {
+    }
+};
+
+/// <summary>
+/// Writes and reads elements that are not trivially copyable, one by one, using their own methods.
+/// </summary>
+template<>
+class SQBinarySerializer::QElementSerializer<false>
+{
+public:
+
+    template<class T, class WriterT>
+    static void Write(WriterT &writer, const T* arElements, const pointer_uint_q uCount)
+    {
+        for(pointer_uint_q i = 0; i < uCount; ++i)
+            arElements[i].Serialize(writer);
+    }
+
+    template<class T, class ReaderT>
+    static void Read(ReaderT &reader, T* arElements, const pointer_uint_q uCount)
+    {
+        for(pointer_uint_q i = 0; i < uCount; ++i)
+            arElements[i].Deserialize(reader);
+    }
+
+    template<class T>
+    static void Construct(T* arElements, const pointer_uint_q uCount)
+    {
+        for(pointer_uint_q i = 0; i < uCount; ++i)
+            new(&arElements[i]) T();
+    }
+};
+
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQBINARYSERIALIZER__
@@ -80,6 +80,23 @@ public:
         return input % uBucketsInTable;
     }
 
+    /// <summary>
+    /// Generates a hash from an integer value, which does not depend on the number of buckets of any table.
+    /// </summary>
+    /// <remarks>
+    /// It just converts the input value to an unsigned integer of the size of a pointer.
+    /// </remarks>
+    /// <typeparam name="IntegerT">The integer type of the input value.</typeparam>
+    /// <param name="input">[IN] An integer value.</param>
+    /// <returns>
+    /// A hash that can take any value of the range of the pointer-sized unsigned integers.
+    /// </returns>
+    template<class IntegerT>
+    static Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q GenerateHash(const IntegerT input)
+    {
+        return scast_q(input, Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q);
+    }
+
 };
 
 } //namespace Containers
@@ -0,0 +1,241 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __SQMATRIXSIMD__
+#define __SQMATRIXSIMD__
+
+#include "MathDefinitions.h"
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+
+#include "ToolsDefinitions.h"
+#include "SQVF32.h"
+#include "QBaseMatrix4x4.h"
+#include "QBaseMatrix4x3.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Math
+{
+
+/// <summary>
+/// Helper class that implements the most expensive matrix operations using SIMD instructions, processing a whole row
+/// of a matrix at once.
+/// </summary>
+/// <remarks>
+/// It is only available when math vectorization is enabled in the engine configuration and simple precission is used (see
+/// QE_MATH_VECTORIZATION_ENABLED). Matrix classes use it internally so it is not necessary to call it directly.<br/>
+/// Matrices are not required to be aligned in memory. The output matrix can be the same instance as any of the input matrices.
+/// </remarks>
+class QE_LAYER_TOOLS_SYMBOLS SQMatrixSIMD
+{
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    /// <summary>
+    /// Default constructor (hidden).
+    /// </summary>
+    SQMatrixSIMD();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Multiplies two 4x4 matrices, following matrices product rules.
+    /// </summary>
+    /// <param name="left">[IN] The matrix at the left side of the product.</param>
+    /// <param name="right">[IN] The matrix at the right side of the product.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void Multiply(const QBaseMatrix4x4 &left, const QBaseMatrix4x4 &right, QBaseMatrix4x4 &output);
+
+    /// <summary>
+    /// Multiplies a 4x4 matrix by a 4x3 matrix, following matrices product rules.
+    /// </summary>
+    /// <param name="left">[IN] The matrix at the left side of the product.</param>
+    /// <param name="right">[IN] The matrix at the right side of the product.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void Multiply(const QBaseMatrix4x4 &left, const QBaseMatrix4x3 &right, QBaseMatrix4x3 &output);
+
+    /// <summary>
+    /// Multiplies two transformation matrices, assuming that the fourth column of both is (0, 0, 0, 1).
+    /// </summary>
+    /// <remarks>
+    /// The fourth column of the resultant matrix is copied from the left matrix.
+    /// </remarks>
+    /// <param name="left">[IN] The matrix at the left side of the product.</param>
+    /// <param name="right">[IN] The matrix at the right side of the product.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void MultiplyTransformations(const QBaseMatrix4x4 &left, const QBaseMatrix4x4 &right, QBaseMatrix4x4 &output);
+
+    /// <summary>
+    /// Multiplies two transformation matrices, assuming that the fourth column of both is (0, 0, 0, 1).
+    /// </summary>
+    /// <remarks>
+    /// The fourth column of the resultant matrix is copied from the left matrix.
+    /// </remarks>
+    /// <param name="left">[IN] The matrix at the left side of the product.</param>
+    /// <param name="right">[IN] The matrix at the right side of the product.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void MultiplyTransformations(const QBaseMatrix4x4 &left, const QBaseMatrix4x3 &right, QBaseMatrix4x4 &output);
+
+    /// <summary>
+    /// Multiplies two transformation matrices, assuming that the fourth column of both is (0, 0, 0, 1).
+    /// </summary>
+    /// <param name="left">[IN] The matrix at the left side of the product.</param>
+    /// <param name="right">[IN] The matrix at the right side of the product.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void MultiplyTransformations(const QBaseMatrix4x3 &left, const QBaseMatrix4x4 &right, QBaseMatrix4x3 &output);
+
+    /// <summary>
+    /// Multiplies two transformation matrices, assuming that the fourth column of both is (0, 0, 0, 1).
+    /// </summary>
+    /// <param name="left">[IN] The matrix at the left side of the product.</param>
+    /// <param name="right">[IN] The matrix at the right side of the product.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void MultiplyTransformations(const QBaseMatrix4x3 &left, const QBaseMatrix4x3 &right, QBaseMatrix4x3 &output);
+
+    /// <summary>
+    /// Calculates the transpose of a 4x4 matrix.
+    /// </summary>
+    /// <param name="matrix">[IN] The matrix to be transposed.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void Transpose(const QBaseMatrix4x4 &matrix, QBaseMatrix4x4 &output);
+
+    /// <summary>
+    /// Calculates the inverse of a 4x4 matrix.
+    /// </summary>
+    /// <remarks>
+    /// The matrix is split into four 2x2 blocks, whose adjugates and determinants are used to calculate the inverse. 
+    /// If the determinant of the matrix equals zero, the result is undefined.
+    /// </remarks>
+    /// <param name="matrix">[IN] The matrix to be inverted.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void Invert(const QBaseMatrix4x4 &matrix, QBaseMatrix4x4 &output);
+
+    /// <summary>
+    /// Calculates the inverse of a transformation matrix, assuming that its fourth column is (0, 0, 0, 1).
+    /// </summary>
+    /// <remarks>
+    /// The 3x3 upper-left block is inverted using the cross products of its rows and the translation is transformed by the result.
+    /// The fourth column of the resultant matrix is copied from the input matrix. If the determinant of the matrix equals zero, 
+    /// the result is undefined.
+    /// </remarks>
+    /// <param name="matrix">[IN] The matrix to be inverted.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void InvertTransformation(const QBaseMatrix4x4 &matrix, QBaseMatrix4x4 &output);
+
+    /// <summary>
+    /// Calculates the inverse of a transformation matrix, assuming that its fourth column is (0, 0, 0, 1).
+    /// </summary>
+    /// <remarks>
+    /// The 3x3 upper-left block is inverted using the cross products of its rows and the translation is transformed by the result.
+    /// If the determinant of the matrix equals zero, the result is undefined.
+    /// </remarks>
+    /// <param name="matrix">[IN] The matrix to be inverted.</param>
+    /// <param name="output">[OUT] The resultant matrix.</param>
+    static void InvertTransformation(const QBaseMatrix4x3 &matrix, QBaseMatrix4x3 &output);
+
+private:
+
+    /// <summary>
+    /// Loads the 4 rows of a 4x3 matrix. The fourth component of every pack is undefined, except for the last row, where it equals zero.
+    /// </summary>
+    /// <param name="matrix">[IN] The matrix whose rows are to be loaded.</param>
+    /// <param name="arRows">[OUT] The 4 loaded rows.</param>
+    static void LoadRows(const QBaseMatrix4x3 &matrix, vf32_q* arRows);
+
+    /// <summary>
+    /// Stores the first 3 components of 4 packs into the rows of a 4x3 matrix.
+    /// </summary>
+    /// <param name="arRows">[IN] The 4 rows to be stored.</param>
+    /// <param name="matrix">[OUT] The matrix whose rows will be overwritten.</param>
+    static void StoreRows(const vf32_q* arRows, QBaseMatrix4x3 &matrix);
+
+    /// <summary>
+    /// Multiplies two 2x2 matrices, stored in row-major order in packs.
+    /// </summary>
+    /// <param name="vfLeft">[IN] The matrix at the left side of the product.</param>
+    /// <param name="vfRight">[IN] The matrix at the right side of the product.</param>
+    /// <returns>
+    /// The resultant matrix.
+    /// </returns>
+    static vf32_q Multiply2x2(const vf32_q vfLeft, const vf32_q vfRight);
+
+    /// <summary>
+    /// Multiplies the adjugate of a 2x2 matrix by another 2x2 matrix, both stored in row-major order in packs.
+    /// </summary>
+    /// <param name="vfLeft">[IN] The matrix whose adjugate is at the left side of the product.</param>
+    /// <param name="vfRight">[IN] The matrix at the right side of the product.</param>
+    /// <returns>
+    /// The resultant matrix.
+    /// </returns>
+    static vf32_q MultiplyAdjugate2x2ByMatrix2x2(const vf32_q vfLeft, const vf32_q vfRight);
+
+    /// <summary>
+    /// Multiplies a 2x2 matrix by the adjugate of another 2x2 matrix, both stored in row-major order in packs.
+    /// </summary>
+    /// <param name="vfLeft">[IN] The matrix at the left side of the product.</param>
+    /// <param name="vfRight">[IN] The matrix whose adjugate is at the right side of the product.</param>
+    /// <returns>
+    /// The resultant matrix.
+    /// </returns>
+    static vf32_q MultiplyMatrix2x2ByAdjugate2x2(const vf32_q vfLeft, const vf32_q vfRight);
+
+    /// <summary>
+    /// Calculates the product of two transformation matrices, given their rows. The fourth component of the result is undefined.
+    /// </summary>
+    /// <param name="arLeftRows">[IN] The 4 rows of the left matrix.</param>
+    /// <param name="arRightRows">[IN] The 4 rows of the right matrix.</param>
+    /// <param name="arOutputRows">[OUT] The 4 rows of the resultant matrix.</param>
+    static void MultiplyTransformationRows(const vf32_q* arLeftRows, const vf32_q* arRightRows, vf32_q* arOutputRows);
+
+    /// <summary>
+    /// Calculates the inverse of a transformation matrix, given its rows. The fourth component of the result is undefined.
+    /// </summary>
+    /// <param name="arRows">[IN] The 4 rows of the matrix.</param>
+    /// <param name="arOutputRows">[OUT] The 4 rows of the resultant matrix.</param>
+    static void InvertTransformationRows(const vf32_q* arRows, vf32_q* arOutputRows);
+};
+
+} //namespace Math
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // QE_MATH_VECTORIZATION_ENABLED
+
+#endif // __SQMATRIXSIMD__
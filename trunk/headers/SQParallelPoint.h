@@ -0,0 +1,491 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __SQPARALLELPOINT__
+#define __SQPARALLELPOINT__
+
+#include "SystemDefinitions.h"
+#include "SQPoint.h"
+#include "QTaskScheduler.h"
+#include "QDelegate.h"
+
+using Kinesis::QuimeraEngine::Tools::Math::QBaseVector3;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Tools::Math::QVector4;
+using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x3;
+using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x4;
+using Kinesis::QuimeraEngine::Tools::Math::QQuaternion;
+using Kinesis::QuimeraEngine::Tools::Math::QRotationMatrix3x3;
+using Kinesis::QuimeraEngine::Tools::Math::QScalingMatrix3x3;
+using Kinesis::QuimeraEngine::Tools::Math::QTranslationMatrix;
+using Kinesis::QuimeraEngine::Tools::Math::QTransformationMatrix;
+using Kinesis::QuimeraEngine::Tools::Math::QSpaceConversionMatrix;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Helper class that transforms big arrays of points (3D or 4D) using several threads at the same time.
+/// </summary>
+/// <remarks>
+/// The array is split into contiguous partitions whose size is a multiple of the number of points that fit in a cache line 
+/// (assuming the array starts at a cache line boundary), so two threads never write to the same cache line. Every point is 
+/// transformed by the same function SQPoint uses, hence the result does not depend on the number of partitions nor on 
+/// which thread processes each of them.<br/>
+/// Partitions are processed by the tasks of a parallel loop of QTaskScheduler, so these methods can be called from inside a task.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS SQParallelPoint
+{
+    // INTERNAL CLASSES
+    // ---------------
+private:
+
+    /// <summary>
+    /// Job that applies an operation of SQPoint to one partition of an array of points.
+    /// </summary>
+    /// <typeparam name="TransformationT">The type of the transformation passed to the operation.</typeparam>
+    /// <typeparam name="VectorT">Allowed types: QVector3, QVector4.</typeparam>
+    template<class TransformationT, class VectorT>
+    class QPointPartitionJob
+    {
+    public:
+
+        /// <summary>
+        /// The signature of the operation of SQPoint to be applied.
+        /// </summary>
+        typedef void (*OperationFunction)(const TransformationT&, VectorT*, const unsigned int);
+
+        /// <summary>
+        /// Constructor that receives the operation and its arguments, and calculates the size of the partitions.
+        /// </summary>
+        /// <param name="pOperation">[IN] The operation of SQPoint to be applied.</param>
+        /// <param name="transformation">[IN] The transformation to be passed to the operation.</param>
+        /// <param name="arPoints">[IN/OUT] Array of points that will be transformed.</param>
+        /// <param name="uElements">[IN] Number of elements in the array.</param>
+        /// <param name="uMaxPartitions">[IN] The maximum number of partitions. It must be greater than zero.</param>
+        QPointPartitionJob(const OperationFunction pOperation, const TransformationT &transformation, VectorT* arPoints, 
+                           const unsigned int uElements, const unsigned int uMaxPartitions) :
+                                                                        m_pOperation(pOperation),
+                                                                        m_pTransformation(&transformation),
+                                                                        m_arPoints(arPoints),
+                                                                        m_uElements(uElements)
+        {
+            // Minimum number of points whose size is a multiple of the cache line size
+            unsigned int uPointsPerCacheLine = 1U;
+
+            while((uPointsPerCacheLine * sizeof(VectorT)) % SQParallelPoint::CACHE_LINE_SIZE != 0)
+                ++uPointsPerCacheLine;
+
+            m_uPartitionSize = (uElements + uMaxPartitions - 1U) / uMaxPartitions;
+            m_uPartitionSize = (m_uPartitionSize + uPointsPerCacheLine - 1U) / uPointsPerCacheLine * uPointsPerCacheLine;
+            m_uPartitionCount = uElements == 0 ? 0 : (uElements + m_uPartitionSize - 1U) / m_uPartitionSize;
+        }
+
+        /// <summary>
+        /// Applies the operation to the points of a range of consecutive partitions.
+        /// </summary>
+        /// <param name="uFirstPartition">[IN] The index of the first partition of the range.</param>
+        /// <param name="uLastPartition">[IN] The index of the partition after the last partition of the range.</param>
+        void Execute(const unsigned int uFirstPartition, const unsigned int uLastPartition)
+        {
+            const unsigned int FIRST_POINT = uFirstPartition * m_uPartitionSize;
+            const unsigned int LAST_POINT = uLastPartition * m_uPartitionSize < m_uElements ? uLastPartition * m_uPartitionSize : m_uElements;
+
+            m_pOperation(*m_pTransformation, m_arPoints + FIRST_POINT, LAST_POINT - FIRST_POINT);
+        }
+
+        /// <summary>
+        /// Gets the number of partitions into which the array has been split.
+        /// </summary>
+        /// <returns>
+        /// The number of partitions. It is zero if the array is empty.
+        /// </returns>
+        unsigned int GetPartitionCount() const
+        {
+            return m_uPartitionCount;
+        }
+
+    private:
+
+        /// <summary>
+        /// The operation to be applied.
+        /// </summary>
+        OperationFunction m_pOperation;
+
+        /// <summary>
+        /// The transformation to be passed to the operation.
+        /// </summary>
+        const TransformationT* m_pTransformation;
+
+        /// <summary>
+        /// The array of points.
+        /// </summary>
+        VectorT* m_arPoints;
+
+        /// <summary>
+        /// The number of points in the array.
+        /// </summary>
+        unsigned int m_uElements;
+
+        /// <summary>
+        /// The number of points in every partition but, maybe, the last one.
+        /// </summary>
+        unsigned int m_uPartitionSize;
+
+        /// <summary>
+        /// The number of partitions.
+        /// </summary>
+        unsigned int m_uPartitionCount;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The size of a cache line, in bytes, used to calculate the size of the partitions.
+    /// </summary>
+    static const unsigned int CACHE_LINE_SIZE;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    SQParallelPoint() { }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Translates 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Translate with the whole array.
+    /// </remarks>
+    /// <param name="vTranslation">[IN] 3D Vector type that contains the translation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be translated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Translate(const QBaseVector3 &vTranslation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Translates 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Translate with the whole array.
+    /// </remarks>
+    /// <param name="vTranslation">[IN] 3D Vector type that contains the translation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be translated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Translate(const QBaseVector3 &vTranslation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Translates 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Translate with the whole array.
+    /// </remarks>
+    /// <param name="translation">[IN] 4x3 translation matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be translated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Translate(const QTranslationMatrix<QMatrix4x3> &translation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Translates 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Translate with the whole array.
+    /// </remarks>
+    /// <param name="translation">[IN] 4x3 translation matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be translated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Translate(const QTranslationMatrix<QMatrix4x3> &translation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Translates 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Translate with the whole array.
+    /// </remarks>
+    /// <param name="translation">[IN] 4x4 translation matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be translated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Translate(const QTranslationMatrix<QMatrix4x4> &translation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Translates 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Translate with the whole array.
+    /// </remarks>
+    /// <param name="translation">[IN] 4x4 translation matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be translated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Translate(const QTranslationMatrix<QMatrix4x4> &translation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Rotates 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Rotate with the whole array.
+    /// </remarks>
+    /// <param name="qRotation">[IN] Quaternion that contains the rotation to be done.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be rotated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Rotate(const QQuaternion &qRotation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Rotates 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Rotate with the whole array.
+    /// </remarks>
+    /// <param name="qRotation">[IN] Quaternion that contains the rotation to be done.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be rotated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Rotate(const QQuaternion &qRotation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Rotates 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Rotate with the whole array.
+    /// </remarks>
+    /// <param name="rotation">[IN] Rotation matrix that contains the rotation to be done.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be rotated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Rotate(const QRotationMatrix3x3 &rotation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Rotates 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Rotate with the whole array.
+    /// </remarks>
+    /// <param name="rotation">[IN] Rotation matrix that contains the rotation to be done.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be rotated. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Rotate(const QRotationMatrix3x3 &rotation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Scales 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Scale with the whole array.
+    /// </remarks>
+    /// <param name="vScale">[IN] 3D Vector type that contains the scale to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be scaled. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Scale(const QBaseVector3 &vScale, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Scales 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Scale with the whole array.
+    /// </remarks>
+    /// <param name="vScale">[IN] 3D Vector type that contains the scale to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be scaled. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Scale(const QBaseVector3 &vScale, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Scales 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Scale with the whole array.
+    /// </remarks>
+    /// <param name="scale">[IN] Scale matrix that contains the scale to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be scaled. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Scale(const QScalingMatrix3x3 &scale, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Scales 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Scale with the whole array.
+    /// </remarks>
+    /// <param name="scale">[IN] Scale matrix that contains the scale to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be scaled. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Scale(const QScalingMatrix3x3 &scale, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Transforms 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Transform with the whole array.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x3 matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be transformed. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Transform(const QTransformationMatrix<QMatrix4x3> &transformation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Transforms 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Transform with the whole array.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x3 matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be transformed. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Transform(const QTransformationMatrix<QMatrix4x3> &transformation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Transforms 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Transform with the whole array.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x4 matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be transformed. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Transform(const QTransformationMatrix<QMatrix4x4> &transformation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Transforms 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Transform with the whole array.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x4 matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be transformed. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Transform(const QTransformationMatrix<QMatrix4x4> &transformation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Transforms 3D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Transform with the whole array.
+    /// </remarks>
+    /// <param name="spaceConversion">[IN] Space conversion matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 3D points that will be transformed. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Transform(const QSpaceConversionMatrix &spaceConversion, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+    /// <summary>
+    /// Transforms 4D points in parallel, splitting the array into partitions that are processed by the worker threads of a task scheduler.
+    /// </summary>
+    /// <remarks>
+    /// The result is exactly the same as calling SQPoint::Transform with the whole array.
+    /// </remarks>
+    /// <param name="spaceConversion">[IN] Space conversion matrix that contains the transformation to be applied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will be transformed. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[Optional][IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    static void Transform(const QSpaceConversionMatrix &spaceConversion, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions=0);
+
+private:
+
+    /// <summary>
+    /// Splits an array of points into partitions and applies an operation of SQPoint to all of them using the worker threads of a task scheduler.
+    /// </summary>
+    /// <typeparam name="TransformationT">The type of the transformation passed to the operation.</typeparam>
+    /// <typeparam name="VectorT">Allowed types: QVector3, QVector4.</typeparam>
+    /// <param name="pOperation">[IN] The operation of SQPoint to be applied.</param>
+    /// <param name="transformation">[IN] The transformation to be passed to the operation.</param>
+    /// <param name="arPoints">[IN/OUT] Array of points that will be transformed. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array.</param>
+    /// <param name="scheduler">[IN] The scheduler whose worker threads will process the partitions, along with the calling thread.</param>
+    /// <param name="uPartitions">[IN] The maximum number of partitions. If it is zero, the number of worker threads plus one is used.</param>
+    template<class TransformationT, class VectorT>
+    static void ExecuteInParallel(const typename QPointPartitionJob<TransformationT, VectorT>::OperationFunction pOperation, 
+                                  const TransformationT &transformation, VectorT* arPoints, const unsigned int uElements, 
+                                  QTaskScheduler &scheduler, const unsigned int uPartitions)
+    {
+        // Checks that the point array is not null
+        QE_ASSERT_ERROR( arPoints != null_q, "Input array must not be null" );
+
+        const unsigned int MAX_PARTITIONS = uPartitions == 0 ? scheduler.GetWorkerCount() + 1U : uPartitions;
+
+        // Every task of the loop processes one partition
+        QPointPartitionJob<TransformationT, VectorT> job(pOperation, transformation, arPoints, uElements, MAX_PARTITIONS);
+        scheduler.ParallelFor(0, 
+                              job.GetPartitionCount(), 
+                              Kinesis::QuimeraEngine::Common::QDelegate<void (const unsigned int, const unsigned int)>(&job, &QPointPartitionJob<TransformationT, VectorT>::Execute), 
+                              1U);
+    }
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQPARALLELPOINT__
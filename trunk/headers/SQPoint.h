@@ -32,6 +32,7 @@
 #include "QRotationMatrix3x3.h"
 #include "QScalingMatrix3x3.h"
 #include "QSpaceConversionMatrix.h"
+#include "QSoAPointBuffer.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 
@@ -647,8 +648,308 @@ public:
     static void TransformWithPivot(const QTransformationMatrix<QMatrix4x4> &transformation, const QBaseVector4 &vPivot, QVector4* arPoints,
                                           const unsigned int uElements);
 
+    // STRUCTURE OF ARRAYS
+
+    /// <summary>
+    /// Copies 3D points to a buffer that stores them as a structure of arrays.
+    /// </summary>
+    /// <param name="arPoints">[IN] Array of 3D points to be copied. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array. It must not be greater than the number of points in the buffer.</param>
+    /// <param name="points">[OUT] Buffer that will receive the points, from the first position on. Remaining points are not modified.</param>
+    static void ConvertToSoA(const QVector3* arPoints, const unsigned int uElements, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Copies 4D points to a buffer that stores them as a structure of arrays.
+    /// </summary>
+    /// <remarks>
+    /// The W component of the points is discarded.
+    /// </remarks>
+    /// <param name="arPoints">[IN] Array of 4D points to be copied. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in the array. It must not be greater than the number of points in the buffer.</param>
+    /// <param name="points">[OUT] Buffer that will receive the points, from the first position on. Remaining points are not modified.</param>
+    static void ConvertToSoA(const QVector4* arPoints, const unsigned int uElements, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Copies all the points stored in a buffer to an array of 3D points.
+    /// </summary>
+    /// <param name="points">[IN] Buffer whose points will be copied.</param>
+    /// <param name="arPoints">[OUT] Array of 3D points that will receive the points. It must be able to store as many points as the buffer contains. 
+    /// If it is null, the behavior is undefined.</param>
+    static void ConvertToAoS(const QSoAPointBuffer &points, QVector3* arPoints);
+
+    /// <summary>
+    /// Copies all the points stored in a buffer to an array of 4D points.
+    /// </summary>
+    /// <remarks>
+    /// The W component of the output points is not modified.
+    /// </remarks>
+    /// <param name="points">[IN] Buffer whose points will be copied.</param>
+    /// <param name="arPoints">[IN/OUT] Array of 4D points that will receive the points. It must be able to store as many points as the buffer contains. 
+    /// If it is null, the behavior is undefined.</param>
+    static void ConvertToAoS(const QSoAPointBuffer &points, QVector4* arPoints);
+
+    /// <summary>
+    /// Translates the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// Translation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="vTranslation">[IN] 3D Vector type that contains the translation to be applied.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be translated.</param>
+    static void Translate(const QBaseVector3 &vTranslation, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Translates the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// Translation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="fTranslationX">[IN] Floating point value that contains the translation to be applied on X component.</param>
+    /// <param name="fTranslationY">[IN] Floating point value that contains the translation to be applied on Y component.</param>
+    /// <param name="fTranslationZ">[IN] Floating point value that contains the translation to be applied on Z component.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be translated.</param>
+    static void Translate(const float_q fTranslationX, const float_q fTranslationY, const float_q fTranslationZ, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Translates the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// Translation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="translation">[IN] 4x3 translation matrix that contains the transformation to be applied.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be translated.</param>
+    static void Translate(const QTranslationMatrix<QMatrix4x3> &translation, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Translates the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// Translation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="translation">[IN] 4x4 translation matrix that contains the transformation to be applied.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be translated.</param>
+    static void Translate(const QTranslationMatrix<QMatrix4x4> &translation, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Rotates the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// Rotation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="qRotation">[IN] Quaternion that contains the rotation to be done.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be rotated.</param>
+    static void Rotate(const QQuaternion &qRotation, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Rotates the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// Rotation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="rotation">[IN] Rotation matrix that contains the rotation to be done.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be rotated.</param>
+    static void Rotate(const QRotationMatrix3x3 &rotation, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Scales the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// Scale will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="vScale">[IN] 3D Vector type that contains the scale to be applied.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be scaled.</param>
+    static void Scale(const QBaseVector3 &vScale, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Scales the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// Scale will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="fScaleX">[IN] Scalar value that contains the scale to be applied on X component.</param>
+    /// <param name="fScaleY">[IN] Scalar value that contains the scale to be applied on Y component.</param>
+    /// <param name="fScaleZ">[IN] Scalar value that contains the scale to be applied on Z component.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be scaled.</param>
+    static void Scale(const float_q fScaleX, const float_q fScaleY, const float_q fScaleZ, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Scales the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// Scale will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="scale">[IN] Scale matrix that contains the scale to be applied.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be scaled.</param>
+    static void Scale(const QScalingMatrix3x3 &scale, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Transforms the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// The transformation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x3 matrix that contains the transformation to be applied.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be transformed.</param>
+    static void Transform(const QTransformationMatrix<QMatrix4x3> &transformation, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Transforms the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// The transformation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x4 matrix that contains the transformation to be applied.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be transformed.</param>
+    static void Transform(const QTransformationMatrix<QMatrix4x4> &transformation, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Transforms the points of a buffer.
+    /// </summary>
+    /// <remarks>
+    /// The transformation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="spaceConversion">[IN] Space conversion matrix that contains the transformation to be applied.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be transformed.</param>
+    static void Transform(const QSpaceConversionMatrix &spaceConversion, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Rotates the points of a buffer, using the provided pivot as the center of transformation.
+    /// </summary>
+    /// <remarks>
+    /// Rotation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="qRotation">[IN] Quaternion that contains the rotation to be done.</param>
+    /// <param name="vPivot">[IN] Point that acts as pivot.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be rotated.</param>
+    static void RotateWithPivot(const QQuaternion &qRotation, const QBaseVector3 &vPivot, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Rotates the points of a buffer, using the provided pivot as the center of transformation.
+    /// </summary>
+    /// <remarks>
+    /// Rotation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="rotation">[IN] Rotation matrix that contains the rotation to be done.</param>
+    /// <param name="vPivot">[IN] Point that acts as pivot.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be rotated.</param>
+    static void RotateWithPivot(const QRotationMatrix3x3 &rotation, const QBaseVector3 &vPivot, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Scales the points of a buffer, using the provided pivot as the center of transformation.
+    /// </summary>
+    /// <remarks>
+    /// Scale will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="vScale">[IN] 3D Vector type that contains the scale to be applied.</param>
+    /// <param name="vPivot">[IN] Point that acts as pivot.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be scaled.</param>
+    static void ScaleWithPivot(const QBaseVector3 &vScale, const QBaseVector3 &vPivot, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Scales the points of a buffer, using the provided pivot as the center of transformation.
+    /// </summary>
+    /// <remarks>
+    /// Scale will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="fScaleX">[IN] Scalar value that contains the scale to be applied on X component.</param>
+    /// <param name="fScaleY">[IN] Scalar value that contains the scale to be applied on Y component.</param>
+    /// <param name="fScaleZ">[IN] Scalar value that contains the scale to be applied on Z component.</param>
+    /// <param name="vPivot">[IN] Point that acts as pivot.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be scaled.</param>
+    static void ScaleWithPivot(const float_q fScaleX, const float_q fScaleY, const float_q fScaleZ, const QBaseVector3 &vPivot, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Scales the points of a buffer, using the provided pivot as the center of transformation.
+    /// </summary>
+    /// <remarks>
+    /// Scale will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="scale">[IN] Scale matrix that contains the scale to be applied.</param>
+    /// <param name="vPivot">[IN] Point that acts as pivot.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be scaled.</param>
+    static void ScaleWithPivot(const QScalingMatrix3x3 &scale, const QBaseVector3 &vPivot, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Transforms the points of a buffer, using the provided pivot as the center of transformation.
+    /// </summary>
+    /// <remarks>
+    /// The transformation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x3 matrix that contains the transformation to be applied.</param>
+    /// <param name="vPivot">[IN] Point that acts as pivot.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be transformed.</param>
+    static void TransformWithPivot(const QTransformationMatrix<QMatrix4x3> &transformation, const QBaseVector3 &vPivot, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Transforms the points of a buffer, using the provided pivot as the center of transformation.
+    /// </summary>
+    /// <remarks>
+    /// The transformation will be applied to all points in the buffer.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x4 matrix that contains the transformation to be applied.</param>
+    /// <param name="vPivot">[IN] Point that acts as pivot.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be transformed.</param>
+    static void TransformWithPivot(const QTransformationMatrix<QMatrix4x4> &transformation, const QBaseVector3 &vPivot, QSoAPointBuffer &points);
+
 private:
 
+    /// <summary>
+    /// Translates all the points of a buffer, 4 at a time when math vectorization is enabled.
+    /// </summary>
+    /// <param name="fTranslationX">[IN] The translation to be applied on X component.</param>
+    /// <param name="fTranslationY">[IN] The translation to be applied on Y component.</param>
+    /// <param name="fTranslationZ">[IN] The translation to be applied on Z component.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be translated.</param>
+    static void TranslateSoA(const float_q fTranslationX, const float_q fTranslationY, const float_q fTranslationZ, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Scales all the points of a buffer, 4 at a time when math vectorization is enabled.
+    /// </summary>
+    /// <param name="fScaleX">[IN] The scale to be applied on X component.</param>
+    /// <param name="fScaleY">[IN] The scale to be applied on Y component.</param>
+    /// <param name="fScaleZ">[IN] The scale to be applied on Z component.</param>
+    /// <param name="pPivot">[IN] Point that acts as pivot. If it is null, no pivot is used.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be scaled.</param>
+    static void ScaleSoA(const float_q fScaleX, const float_q fScaleY, const float_q fScaleZ, const QBaseVector3* pPivot, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Rotates all the points of a buffer using a quaternion, 4 at a time when math vectorization is enabled.
+    /// </summary>
+    /// <remarks>
+    /// The result is calculated in the same way as QVector3::Transform does, expanding both quaternion products.
+    /// </remarks>
+    /// <param name="qRotation">[IN] Quaternion that contains the rotation to be done.</param>
+    /// <param name="pPivot">[IN] Point that acts as pivot. If it is null, no pivot is used.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be rotated.</param>
+    static void RotateSoA(const QQuaternion &qRotation, const QBaseVector3* pPivot, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Multiplies all the points of a buffer by a 3x3 matrix and then adds a translation, 4 at a time when math vectorization is enabled.
+    /// </summary>
+    /// <param name="matrix">[IN] The 3x3 matrix, which may contain a rotation and a scale.</param>
+    /// <param name="pTranslation">[IN] The translation to be added after the product. If it is null, no translation is applied.</param>
+    /// <param name="pPivot">[IN] Point that acts as pivot. If it is null, no pivot is used.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be transformed.</param>
+    static void TransformSoA(const QBaseMatrix3x3 &matrix, const QBaseVector3* pTranslation, const QBaseVector3* pPivot, QSoAPointBuffer &points);
+
+    /// <summary>
+    /// Transforms all the points of a buffer using the rotation, scale and translation stored in a 4x3 or 4x4 matrix.
+    /// </summary>
+    /// <typeparam name="MatrixT">Allowed types: QTransformationMatrix<QMatrix4x3>, QTransformationMatrix<QMatrix4x4>, QSpaceConversionMatrix.</typeparam>
+    /// <param name="transformation">[IN] The matrix that contains the transformation to be applied. Its fourth column, if any, is ignored.</param>
+    /// <param name="pPivot">[IN] Point that acts as pivot. If it is null, no pivot is used.</param>
+    /// <param name="points">[IN/OUT] Buffer whose points will be transformed.</param>
+    template <class MatrixT>
+    static void TransformSoA(const MatrixT &transformation, const QBaseVector3* pPivot, QSoAPointBuffer &points)
+    {
+        const QBaseMatrix3x3 MATRIX(transformation.ij[0][0], transformation.ij[0][1], transformation.ij[0][2],
+                                    transformation.ij[1][0], transformation.ij[1][1], transformation.ij[1][2],
+                                    transformation.ij[2][0], transformation.ij[2][1], transformation.ij[2][2]);
+        const QBaseVector3 TRANSLATION(transformation.ij[3][0], transformation.ij[3][1], transformation.ij[3][2]);
+
+        SQPoint::TransformSoA(MATRIX, &TRANSLATION, pPivot, points);
+    }
+
     /// <summary>
     /// Translates 3D or 4D points.
     /// </summary>
@@ -73,6 +73,18 @@ public:
     static Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q GenerateHashKey(const Kinesis::QuimeraEngine::Common::DataTypes::string_q &strInput, 
                                                                                      const Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q uBucketsInTable);
 
+    /// <summary>
+    /// Generates a hash from a string, which does not depend on the number of buckets of any table.
+    /// </summary>
+    /// <remarks>
+    /// It implements the Jenkins' one-at-a-time hash function.
+    /// </remarks>
+    /// <param name="strInput">[IN] A string value. It can be empty.</param>
+    /// <returns>
+    /// A hash that can take any value of the range of the pointer-sized unsigned integers.
+    /// </returns>
+    static Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q GenerateHash(const Kinesis::QuimeraEngine::Common::DataTypes::string_q &strInput);
+
 };
 
 } //namespace Containers
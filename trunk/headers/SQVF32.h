@@ -27,10 +27,22 @@
 #ifndef __SQVF32__
 #define __SQVF32__
 
+#include <emmintrin.h> // SSE2 intrinsics
+
+#ifdef QE_SIMD_SSE41
+    #include <smmintrin.h> // SSE 4.1 intrinsics
+#endif
+
+#ifdef QE_SIMD_FMA
+    #include <immintrin.h> // FMA intrinsics
+#endif
+
 #include "SQFloat.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::f32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
 
 
 namespace Kinesis
@@ -46,7 +58,10 @@ namespace DataTypes
 /// Helper class that offers functionality related to 4 x 32-bits floating point variables packs.
 /// </summary>
 /// <remarks>
-/// This kind of packs are used in SIMD operations.
+/// This kind of packs are used in SIMD operations.<br/>
+/// Arithmetic, comparison and permutation operations are defined inline so they are translated into single SSE instructions 
+/// (or short sequences of them) at the call site. In all of them, the "first" component is the one stored in the lowest 32 bits 
+/// of the pack, as in <see cref="Pack"/>.
 /// </remarks>
 class QE_LAYER_COMMON_SYMBOLS SQVF32
 {
@@ -97,6 +112,476 @@ public:
     /// <param name="fFourth">[OUT] Fourth value in the packet.</param>
     static void Unpack(const vf32_q pack, float_q &fFirst, float_q &fSecond, float_q &fThird, float_q &fFourth);
 
+    /// <summary>
+    /// Creates a pack whose four components are equal to a given value.
+    /// </summary>
+    /// <param name="fValue">[IN] The value to be copied into every component.</param>
+    /// <returns>
+    /// The package containing four copies of the value.
+    /// </returns>
+    static vf32_q Fill(const float_q fValue)
+    {
+        return _mm_set1_ps(scast_q(fValue, f32_q));
+    }
+
+    /// <summary>
+    /// Loads four consecutive 32-bits floating point values from memory into a pack.
+    /// </summary>
+    /// <remarks>
+    /// The address does not need to be aligned.
+    /// </remarks>
+    /// <param name="arValues">[IN] The address of the first of the four values. It must not be null.</param>
+    /// <returns>
+    /// The package containing the four values, the one at the lowest address being the first.
+    /// </returns>
+    static vf32_q Load(const f32_q* arValues)
+    {
+        return _mm_loadu_ps(arValues);
+    }
+
+    /// <summary>
+    /// Loads four consecutive 32-bits floating point values from a 16-bytes aligned address into a pack.
+    /// </summary>
+    /// <remarks>
+    /// This is faster than <see cref="Load"/> but the address must be aligned to a 16 bytes boundary, otherwise the behavior is undefined.
+    /// </remarks>
+    /// <param name="arValues">[IN] The aligned address of the first of the four values. It must not be null.</param>
+    /// <returns>
+    /// The package containing the four values, the one at the lowest address being the first.
+    /// </returns>
+    static vf32_q LoadAligned(const f32_q* arValues)
+    {
+        return _mm_load_ps(arValues);
+    }
+
+    /// <summary>
+    /// Loads three consecutive 32-bits floating point values from memory into a pack. The fourth component is set to zero.
+    /// </summary>
+    /// <remarks>
+    /// The address does not need to be aligned. Only the memory occupied by the three values is read, so it is safe to use 
+    /// at the end of a buffer.
+    /// </remarks>
+    /// <param name="arValues">[IN] The address of the first of the three values. It must not be null.</param>
+    /// <returns>
+    /// The package containing the three values, the one at the lowest address being the first.
+    /// </returns>
+    static vf32_q Load3(const f32_q* arValues)
+    {
+        return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), rcast_q(arValues, const __m64*)), _mm_load_ss(arValues + 2));
+    }
+
+    /// <summary>
+    /// Stores the four components of a pack into consecutive memory positions.
+    /// </summary>
+    /// <remarks>
+    /// The address does not need to be aligned.
+    /// </remarks>
+    /// <param name="pack">[IN] The package containing four 32-bits floating point values.</param>
+    /// <param name="arOutput">[OUT] The address where the first component will be written. It must not be null.</param>
+    static void Store(const vf32_q pack, f32_q* arOutput)
+    {
+        _mm_storeu_ps(arOutput, pack);
+    }
+
+    /// <summary>
+    /// Stores the four components of a pack into consecutive memory positions, starting at a 16-bytes aligned address.
+    /// </summary>
+    /// <remarks>
+    /// This is faster than <see cref="Store"/> but the address must be aligned to a 16 bytes boundary, otherwise the behavior is undefined.
+    /// </remarks>
+    /// <param name="pack">[IN] The package containing four 32-bits floating point values.</param>
+    /// <param name="arOutput">[OUT] The aligned address where the first component will be written. It must not be null.</param>
+    static void StoreAligned(const vf32_q pack, f32_q* arOutput)
+    {
+        _mm_store_ps(arOutput, pack);
+    }
+
+    /// <summary>
+    /// Stores the first three components of a pack into consecutive memory positions. The fourth component is ignored.
+    /// </summary>
+    /// <remarks>
+    /// The address does not need to be aligned. Only the memory occupied by the three values is written.
+    /// </remarks>
+    /// <param name="pack">[IN] The package containing four 32-bits floating point values.</param>
+    /// <param name="arOutput">[OUT] The address where the first component will be written. It must not be null.</param>
+    static void Store3(const vf32_q pack, f32_q* arOutput)
+    {
+        _mm_storel_pi(rcast_q(arOutput, __m64*), pack);
+        _mm_store_ss(arOutput + 2, _mm_movehl_ps(pack, pack));
+    }
+
+    /// <summary>
+    /// Adds two packs, component by component.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A pack whose components are the sum of the components of both operands.
+    /// </returns>
+    static vf32_q Add(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_add_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Subtracts a pack from another, component by component.
+    /// </summary>
+    /// <param name="vf1">[IN] The minuend.</param>
+    /// <param name="vf2">[IN] The subtrahend.</param>
+    /// <returns>
+    /// A pack whose components are the difference between the components of both operands.
+    /// </returns>
+    static vf32_q Subtract(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_sub_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Multiplies two packs, component by component.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A pack whose components are the product of the components of both operands.
+    /// </returns>
+    static vf32_q Multiply(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_mul_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Divides a pack by another, component by component.
+    /// </summary>
+    /// <param name="vf1">[IN] The dividend.</param>
+    /// <param name="vf2">[IN] The divisor. Components equal to zero produce infinite or NaN values.</param>
+    /// <returns>
+    /// A pack whose components are the quotient of the components of both operands.
+    /// </returns>
+    static vf32_q Divide(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_div_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Multiplies two packs and adds a third one to the result, component by component.
+    /// </summary>
+    /// <remarks>
+    /// When FMA instructions are available (QE_SIMD_FMA), the operation is fused and the intermediate product is not rounded, 
+    /// so the result may differ in the last bit from the one obtained by calling <see cref="Multiply"/> and <see cref="Add"/>.
+    /// </remarks>
+    /// <param name="vf1">[IN] The first factor.</param>
+    /// <param name="vf2">[IN] The second factor.</param>
+    /// <param name="vf3">[IN] The addend.</param>
+    /// <returns>
+    /// A pack whose components are calculated as (vf1 * vf2) + vf3.
+    /// </returns>
+    static vf32_q MultiplyAdd(const vf32_q vf1, const vf32_q vf2, const vf32_q vf3)
+    {
+    #ifdef QE_SIMD_FMA
+        return _mm_fmadd_ps(vf1, vf2, vf3);
+    #else
+        return _mm_add_ps(_mm_mul_ps(vf1, vf2), vf3);
+    #endif
+    }
+
+    /// <summary>
+    /// Calculates the dot product of two packs, taking into account their four components.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A pack whose four components are equal to the dot product.
+    /// </returns>
+    static vf32_q DotProduct4(const vf32_q vf1, const vf32_q vf2)
+    {
+    #ifdef QE_SIMD_SSE41
+        return _mm_dp_ps(vf1, vf2, 0xFF);
+    #else
+        // [x*x', y*y', z*z', w*w'] -> [x+y, x+y, z+w, z+w] -> [x+y+z+w, ...]
+        const vf32_q vfProduct = _mm_mul_ps(vf1, vf2);
+        const vf32_q vfPairs   = _mm_add_ps(vfProduct, _mm_shuffle_ps(vfProduct, vfProduct, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_add_ps(vfPairs, _mm_shuffle_ps(vfPairs, vfPairs, _MM_SHUFFLE(1, 0, 3, 2)));
+    #endif
+    }
+
+    /// <summary>
+    /// Calculates the dot product of two packs, taking into account only their first three components.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand. The fourth component is ignored.</param>
+    /// <param name="vf2">[IN] The second operand. The fourth component is ignored.</param>
+    /// <returns>
+    /// A pack whose four components are equal to the dot product.
+    /// </returns>
+    static vf32_q DotProduct3(const vf32_q vf1, const vf32_q vf2)
+    {
+    #ifdef QE_SIMD_SSE41
+        return _mm_dp_ps(vf1, vf2, 0x7F);
+    #else
+        const vf32_q vfProduct = _mm_mul_ps(vf1, vf2);
+        const vf32_q vfSum = _mm_add_ps(_mm_add_ps(vfProduct, 
+                                                   _mm_shuffle_ps(vfProduct, vfProduct, _MM_SHUFFLE(1, 1, 1, 1))),
+                                        _mm_shuffle_ps(vfProduct, vfProduct, _MM_SHUFFLE(2, 2, 2, 2)));
+        return _mm_shuffle_ps(vfSum, vfSum, _MM_SHUFFLE(0, 0, 0, 0));
+    #endif
+    }
+
+    /// <summary>
+    /// Builds a pack by choosing two components of a pack and two components of another.
+    /// </summary>
+    /// <remarks>
+    /// Template parameters are the indices [0-3] of the components to be copied. Since they are resolved at compile time, 
+    /// the operation is translated into a single instruction.
+    /// </remarks>
+    /// <typeparam name="uFirst">The index of the component of the first pack to be copied to the first component of the result.</typeparam>
+    /// <typeparam name="uSecond">The index of the component of the first pack to be copied to the second component of the result.</typeparam>
+    /// <typeparam name="uThird">The index of the component of the second pack to be copied to the third component of the result.</typeparam>
+    /// <typeparam name="uFourth">The index of the component of the second pack to be copied to the fourth component of the result.</typeparam>
+    /// <param name="vf1">[IN] The pack that provides the first and second components.</param>
+    /// <param name="vf2">[IN] The pack that provides the third and fourth components.</param>
+    /// <returns>
+    /// The resultant pack.
+    /// </returns>
+    template<u32_q uFirst, u32_q uSecond, u32_q uThird, u32_q uFourth>
+    static vf32_q Shuffle(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_shuffle_ps(vf1, vf2, _MM_SHUFFLE(uFourth, uThird, uSecond, uFirst));
+    }
+
+    /// <summary>
+    /// Rearranges the components of a pack.
+    /// </summary>
+    /// <remarks>
+    /// Template parameters are the indices [0-3] of the components to be copied. Since they are resolved at compile time, 
+    /// the operation is translated into a single instruction.
+    /// </remarks>
+    /// <typeparam name="uFirst">The index of the component to be copied to the first component of the result.</typeparam>
+    /// <typeparam name="uSecond">The index of the component to be copied to the second component of the result.</typeparam>
+    /// <typeparam name="uThird">The index of the component to be copied to the third component of the result.</typeparam>
+    /// <typeparam name="uFourth">The index of the component to be copied to the fourth component of the result.</typeparam>
+    /// <param name="pack">[IN] The pack whose components are to be rearranged.</param>
+    /// <returns>
+    /// The resultant pack.
+    /// </returns>
+    template<u32_q uFirst, u32_q uSecond, u32_q uThird, u32_q uFourth>
+    static vf32_q Shuffle(const vf32_q pack)
+    {
+        return _mm_shuffle_ps(pack, pack, _MM_SHUFFLE(uFourth, uThird, uSecond, uFirst));
+    }
+
+    /// <summary>
+    /// Obtains the minimum of two packs, component by component.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A pack whose components are the lowest of each pair of components. If any of them is NaN, the component of the second operand is returned.
+    /// </returns>
+    static vf32_q Min(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_min_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Obtains the maximum of two packs, component by component.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A pack whose components are the greatest of each pair of components. If any of them is NaN, the component of the second operand is returned.
+    /// </returns>
+    static vf32_q Max(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_max_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Calculates the square root of every component of a pack.
+    /// </summary>
+    /// <param name="pack">[IN] The pack whose components' square roots are to be calculated. Negative components produce NaN.</param>
+    /// <returns>
+    /// A pack that contains the square roots.
+    /// </returns>
+    static vf32_q Sqrt(const vf32_q pack)
+    {
+        return _mm_sqrt_ps(pack);
+    }
+
+    /// <summary>
+    /// Calculates a fast approximation of the reciprocal of the square root of every component of a pack.
+    /// </summary>
+    /// <remarks>
+    /// The maximum relative error is 1.5 * 2^-12.
+    /// </remarks>
+    /// <param name="pack">[IN] The pack whose components are to be used. Components equal to zero produce infinite values.</param>
+    /// <returns>
+    /// A pack that contains the approximated values of 1 / sqrt(x).
+    /// </returns>
+    static vf32_q ReciprocalSqrtEstimate(const vf32_q pack)
+    {
+        return _mm_rsqrt_ps(pack);
+    }
+
+    /// <summary>
+    /// Calculates the reciprocal of the square root of every component of a pack.
+    /// </summary>
+    /// <remarks>
+    /// The estimation obtained by <see cref="ReciprocalSqrtEstimate"/> is refined with one Newton-Raphson iteration, which makes 
+    /// it almost as precise as calculating 1 / sqrt(x) and still faster.
+    /// </remarks>
+    /// <param name="pack">[IN] The pack whose components are to be used. Components equal to zero produce NaN.</param>
+    /// <returns>
+    /// A pack that contains the values of 1 / sqrt(x).
+    /// </returns>
+    static vf32_q ReciprocalSqrt(const vf32_q pack)
+    {
+        // y' = y * (1.5 - 0.5 * x * y * y)
+        const vf32_q vfEstimation = _mm_rsqrt_ps(pack);
+        const vf32_q vfHalfX = _mm_mul_ps(pack, _mm_set1_ps(0.5f));
+        const vf32_q vfCorrection = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(vfHalfX, _mm_mul_ps(vfEstimation, vfEstimation)));
+        return _mm_mul_ps(vfEstimation, vfCorrection);
+    }
+
+    /// <summary>
+    /// Checks whether the components of a pack are equal to the components of another.
+    /// </summary>
+    /// <remarks>
+    /// Comparisons are exact, no tolerance is used.
+    /// </remarks>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A mask whose components have all their bits set when the comparison is true and all their bits cleared otherwise.
+    /// </returns>
+    static vf32_q CompareEqual(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_cmpeq_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Checks whether the components of a pack are not equal to the components of another.
+    /// </summary>
+    /// <remarks>
+    /// Comparisons are exact, no tolerance is used.
+    /// </remarks>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A mask whose components have all their bits set when the comparison is true and all their bits cleared otherwise.
+    /// </returns>
+    static vf32_q CompareNotEqual(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_cmpneq_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Checks whether the components of a pack are less than the components of another.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A mask whose components have all their bits set when the comparison is true and all their bits cleared otherwise.
+    /// </returns>
+    static vf32_q CompareLess(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_cmplt_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Checks whether the components of a pack are less than or equal to the components of another.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A mask whose components have all their bits set when the comparison is true and all their bits cleared otherwise.
+    /// </returns>
+    static vf32_q CompareLessOrEquals(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_cmple_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Checks whether the components of a pack are greater than the components of another.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A mask whose components have all their bits set when the comparison is true and all their bits cleared otherwise.
+    /// </returns>
+    static vf32_q CompareGreater(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_cmpgt_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Checks whether the components of a pack are greater than or equal to the components of another.
+    /// </summary>
+    /// <param name="vf1">[IN] The first operand.</param>
+    /// <param name="vf2">[IN] The second operand.</param>
+    /// <returns>
+    /// A mask whose components have all their bits set when the comparison is true and all their bits cleared otherwise.
+    /// </returns>
+    static vf32_q CompareGreaterOrEquals(const vf32_q vf1, const vf32_q vf2)
+    {
+        return _mm_cmpge_ps(vf1, vf2);
+    }
+
+    /// <summary>
+    /// Combines two masks, as returned by comparison methods, so the result is set only where both of them are set.
+    /// </summary>
+    /// <param name="vfMask1">[IN] The first mask.</param>
+    /// <param name="vfMask2">[IN] The second mask.</param>
+    /// <returns>
+    /// The bitwise AND of both masks.
+    /// </returns>
+    static vf32_q And(const vf32_q vfMask1, const vf32_q vfMask2)
+    {
+        return _mm_and_ps(vfMask1, vfMask2);
+    }
+
+    /// <summary>
+    /// Combines two masks, as returned by comparison methods, so the result is set where any of them is set.
+    /// </summary>
+    /// <param name="vfMask1">[IN] The first mask.</param>
+    /// <param name="vfMask2">[IN] The second mask.</param>
+    /// <returns>
+    /// The bitwise OR of both masks.
+    /// </returns>
+    static vf32_q Or(const vf32_q vfMask1, const vf32_q vfMask2)
+    {
+        return _mm_or_ps(vfMask1, vfMask2);
+    }
+
+    /// <summary>
+    /// Builds a pack by choosing, component by component, between the components of two packs depending on a mask.
+    /// </summary>
+    /// <param name="vfMask">[IN] A mask, as returned by comparison methods, whose components have either all their bits set or all their bits cleared.</param>
+    /// <param name="vfIfTrue">[IN] The pack whose components are selected where the mask has its bits set.</param>
+    /// <param name="vfIfFalse">[IN] The pack whose components are selected where the mask has its bits cleared.</param>
+    /// <returns>
+    /// The resultant pack.
+    /// </returns>
+    static vf32_q Select(const vf32_q vfMask, const vf32_q vfIfTrue, const vf32_q vfIfFalse)
+    {
+    #ifdef QE_SIMD_SSE41
+        return _mm_blendv_ps(vfIfFalse, vfIfTrue, vfMask);
+    #else
+        return _mm_or_ps(_mm_and_ps(vfMask, vfIfTrue), _mm_andnot_ps(vfMask, vfIfFalse));
+    #endif
+    }
+
+    /// <summary>
+    /// Compresses a mask, as returned by comparison methods, into an integer.
+    /// </summary>
+    /// <param name="vfMask">[IN] A mask whose components have either all their bits set or all their bits cleared.</param>
+    /// <returns>
+    /// An integer whose 4 lowest bits are set when the corresponding component of the mask is set; the first component corresponds to the lowest bit. 
+    /// For example, 0 means that no component is set and 15 that all of them are.
+    /// </returns>
+    static u32_q ExtractMask(const vf32_q vfMask)
+    {
+        return scast_q(_mm_movemask_ps(vfMask), u32_q);
+    }
+
 };
 
 } //namespace DataTypes
@@ -0,0 +1,868 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "QAsynchronousFileStream.h"
+
+#include "SQFile.h"
+#include "EQTextEncoding.h"
+#include "QScopedExclusiveLock.h"
+#include "QDelegate.h"
+#include <cstring>
+
+#if defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <errno.h>
+#endif
+
+#if defined(QE_OS_MAC)
+    typedef int error_t; // It exists on Linux but not on MacOSX
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace IO
+{
+namespace FileSystem
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QAsynchronousFileStream::QAsynchronousFileStream(const pointer_uint_q uBufferSize, const unsigned int uBufferCount) :
+                                                                                        m_path(string_q::GetEmpty()),
+                                                                                        m_pBufferMemory(null_q),
+                                                                                        m_arBuffers(null_q),
+                                                                                        m_uBufferSize(uBufferSize),
+                                                                                        m_uBufferCount(uBufferCount),
+                                                                                        m_pCurrentBuffer(null_q),
+                                                                                        m_uUseCounter(0),
+                                                                                        m_uFileSize(0),
+                                                                                        m_uPositionPointer(0),
+                                                                                        m_bIsOpen(false),
+                                                                                        m_bWritingIsAllowed(false),
+                                                                                        m_pBackgroundThread(null_q),
+                                                                                        m_bStopRequested(false),
+                                                                                        m_eBackgroundError(EQFileSystemError::E_Success)
+{
+    QE_ASSERT_ERROR(uBufferSize > 0, "The size of the buffers must not equal zero.");
+    QE_ASSERT_ERROR(uBufferCount >= 2U, "There must be at least 2 buffers.");
+
+    m_pBufferMemory = new u8_q[uBufferSize * uBufferCount];
+    m_arBuffers = new QWindowBuffer[uBufferCount];
+
+    for(unsigned int i = 0; i < uBufferCount; ++i)
+        m_arBuffers[i].m_pData = m_pBufferMemory + i * uBufferSize;
+}
+
+QAsynchronousFileStream::QAsynchronousFileStream(const QPath &filePath, const EQFileOpenMode &eOpenMode, const pointer_uint_q uBufferSize, const unsigned int uBufferCount, EQFileSystemError &eErrorInfo) :
+                                                                                        m_path(filePath),
+                                                                                        m_pBufferMemory(null_q),
+                                                                                        m_arBuffers(null_q),
+                                                                                        m_uBufferSize(uBufferSize),
+                                                                                        m_uBufferCount(uBufferCount),
+                                                                                        m_pCurrentBuffer(null_q),
+                                                                                        m_uUseCounter(0),
+                                                                                        m_uFileSize(0),
+                                                                                        m_uPositionPointer(0),
+                                                                                        m_bIsOpen(false),
+                                                                                        m_bWritingIsAllowed(false),
+                                                                                        m_pBackgroundThread(null_q),
+                                                                                        m_bStopRequested(false),
+                                                                                        m_eBackgroundError(EQFileSystemError::E_Success)
+{
+    QE_ASSERT_ERROR(uBufferSize > 0, "The size of the buffers must not equal zero.");
+    QE_ASSERT_ERROR(uBufferCount >= 2U, "There must be at least 2 buffers.");
+
+    m_pBufferMemory = new u8_q[uBufferSize * uBufferCount];
+    m_arBuffers = new QWindowBuffer[uBufferCount];
+
+    for(unsigned int i = 0; i < uBufferCount; ++i)
+        m_arBuffers[i].m_pData = m_pBufferMemory + i * uBufferSize;
+
+    eErrorInfo = this->Open(filePath, eOpenMode);
+}
+    
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QAsynchronousFileStream::~QAsynchronousFileStream()
+{
+    if(m_bIsOpen)
+    {
+        this->Close();
+    }
+
+    delete[] m_arBuffers;
+    delete[] m_pBufferMemory;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void QAsynchronousFileStream::Read(void* pOutput, const pointer_uint_q uOutputOffset, const pointer_uint_q uOutputSize)
+{
+    QE_ASSERT_ERROR(uOutputSize > 0, "The output size must not equal zero.");
+    QE_ASSERT_ERROR(pOutput != null_q, "The output buffer cannot be null.");
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file must be opened before reading.");
+
+    const pointer_uint_q FUTURE_POSITION_POINTER = m_uPositionPointer + uOutputSize;
+
+    QE_ASSERT_WARNING(FUTURE_POSITION_POINTER <= m_uFileSize, "Attempting to read from outside of the file.");
+
+    // If the output size is greater than the remaining bytes, it is fixed so the next read position does not exceed the end of the file
+    pointer_uint_q uRemainingBytes = FUTURE_POSITION_POINTER > m_uFileSize ? m_uFileSize - m_uPositionPointer :
+                                                                             uOutputSize;
+
+    u8_q* pOutputPosition = scast_q(pOutput, u8_q*) + uOutputOffset;
+
+    // The bytes are copied window by window
+    while(uRemainingBytes > 0)
+    {
+        const pointer_uint_q POSITION_IN_WINDOW = m_uPositionPointer % m_uBufferSize;
+        QWindowBuffer* pBuffer = this->_AcquireBuffer(m_uPositionPointer / m_uBufferSize, false);
+
+        const pointer_uint_q BYTES_IN_WINDOW = pBuffer->m_uValidBytes - POSITION_IN_WINDOW;
+        const pointer_uint_q BYTES_TO_COPY = uRemainingBytes < BYTES_IN_WINDOW ? uRemainingBytes : 
+                                                                                 BYTES_IN_WINDOW;
+
+        memcpy(pOutputPosition, pBuffer->m_pData + POSITION_IN_WINDOW, BYTES_TO_COPY);
+
+        pOutputPosition += BYTES_TO_COPY;
+        m_uPositionPointer += BYTES_TO_COPY;
+        uRemainingBytes -= BYTES_TO_COPY;
+    }
+}
+
+void QAsynchronousFileStream::Write(const void* pInput, const pointer_uint_q uInputOffset, const pointer_uint_q uInputSize)
+{
+    QE_ASSERT_ERROR(uInputSize > 0, "The input size must not equal zero.");
+    QE_ASSERT_ERROR(pInput != null_q, "The input buffer cannot be null.");
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file must be opened before writing.");
+    QE_ASSERT_ERROR(m_bWritingIsAllowed, "It is not possible to write to the file, it is read-only.");
+
+    const u8_q* pInputPosition = scast_q(pInput, const u8_q*) + uInputOffset;
+    pointer_uint_q uRemainingBytes = uInputSize;
+
+    // The bytes are copied window by window; the buffers of the windows that are left behind are written in the background
+    while(uRemainingBytes > 0)
+    {
+        const pointer_uint_q POSITION_IN_WINDOW = m_uPositionPointer % m_uBufferSize;
+        QWindowBuffer* pBuffer = this->_AcquireBuffer(m_uPositionPointer / m_uBufferSize, true);
+
+        const pointer_uint_q FREE_BYTES_IN_WINDOW = m_uBufferSize - POSITION_IN_WINDOW;
+        const pointer_uint_q BYTES_TO_COPY = uRemainingBytes < FREE_BYTES_IN_WINDOW ? uRemainingBytes : 
+                                                                                      FREE_BYTES_IN_WINDOW;
+
+        memcpy(pBuffer->m_pData + POSITION_IN_WINDOW, pInputPosition, BYTES_TO_COPY);
+
+        pBuffer->m_uValidBytes = POSITION_IN_WINDOW + BYTES_TO_COPY > pBuffer->m_uValidBytes ? POSITION_IN_WINDOW + BYTES_TO_COPY :
+                                                                                               pBuffer->m_uValidBytes;
+        pInputPosition += BYTES_TO_COPY;
+        m_uPositionPointer += BYTES_TO_COPY;
+        uRemainingBytes -= BYTES_TO_COPY;
+    }
+
+    m_uFileSize = m_uPositionPointer > m_uFileSize ? m_uPositionPointer :
+                                                     m_uFileSize;
+}
+
+EQFileSystemError QAsynchronousFileStream::Flush()
+{
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file is not open.");
+
+    QScopedExclusiveLock<> lock(m_mutex);
+
+    for(unsigned int i = 0; i < m_uBufferCount; ++i)
+    {
+        if(m_arBuffers[i].m_uState == QAsynchronousFileStream::_BUFFER_DIRTY)
+        {
+            QE_ASSERT_ERROR(m_bWritingIsAllowed, "It is not possible to write to the file, it is read-only.");
+            this->_RequestWrite(&m_arBuffers[i]);
+        }
+    }
+
+    // The current buffer has to be acquired again since its state may have changed
+    m_pCurrentBuffer = null_q;
+
+    bool bWritesArePending = true;
+
+    while(bWritesArePending)
+    {
+        bWritesArePending = false;
+
+        for(unsigned int i = 0; i < m_uBufferCount && !bWritesArePending; ++i)
+            bWritesArePending = m_arBuffers[i].m_uState == QAsynchronousFileStream::_BUFFER_PENDING_WRITE || 
+                                m_arBuffers[i].m_uState == QAsynchronousFileStream::_BUFFER_WRITING;
+
+        if(bWritesArePending)
+            m_bufferCompleted.Wait(lock);
+    }
+
+    // Errors that occurred in the background are reported only once
+    const EQFileSystemError BACKGROUND_ERROR = m_eBackgroundError;
+    m_eBackgroundError = EQFileSystemError::E_Success;
+
+    QE_ASSERT_WARNING(BACKGROUND_ERROR == EQFileSystemError::E_Success, string_q("An unexpected error occurred when the background thread accessed the file \"") + m_path.GetAbsolutePath() + "\". The error was: " + BACKGROUND_ERROR.ToString() + ".");
+
+    return BACKGROUND_ERROR;
+}
+
+void QAsynchronousFileStream::MoveBackward(const pointer_uint_q uAmount)
+{
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file is not open.");
+    QE_ASSERT_WARNING(m_uPositionPointer >= uAmount, "It is not possible to move backward the specified amount, it would be out of bounds.");
+
+    m_uPositionPointer = m_uPositionPointer < uAmount ? 0 :
+                                                        m_uPositionPointer - uAmount;
+}
+
+void QAsynchronousFileStream::MoveForward(const pointer_uint_q uAmount)
+{
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file is not open.");
+    QE_ASSERT_WARNING(m_uPositionPointer + uAmount <= m_uFileSize, "It is not possible to move forward the specified amount, it would be out of bounds.");
+
+    m_uPositionPointer = m_uPositionPointer + uAmount > m_uFileSize ? m_uFileSize :
+                                                                      m_uPositionPointer + uAmount;
+}
+
+EQFileSystemError QAsynchronousFileStream::Open(const QPath &filePath, const EQFileOpenMode &eOpenMode)
+{
+    QE_ASSERT_ERROR(m_bIsOpen != true, "The file stream is already open.");
+
+    EQFileSystemError eErrorInfo = EQFileSystemError::E_Unknown;
+    const bool FILE_EXISTS = SQFile::Exists(filePath, eErrorInfo);
+
+    if((FILE_EXISTS && (eOpenMode == EQFileOpenMode::E_Append || eOpenMode == EQFileOpenMode::E_Open)) ||
+       (!FILE_EXISTS && eOpenMode == EQFileOpenMode::E_Create)                                         ||
+       eOpenMode == EQFileOpenMode::E_CreateOrOverwrite                                                || 
+       eOpenMode == EQFileOpenMode::E_OpenOrCreate)
+    {
+        u64_q uFileSize = 0;
+
+        if(FILE_EXISTS)
+        {
+            QFileInfo fileInfo = SQFile::GetFileInfo(filePath, eErrorInfo);
+            uFileSize = eOpenMode == EQFileOpenMode::E_CreateOrOverwrite ? 0 : 
+                                                                           fileInfo.GetSize();
+            m_bWritingIsAllowed = !fileInfo.IsReadOnly();
+            
+            QE_ASSERT_ERROR(!(fileInfo.IsReadOnly() && eOpenMode == EQFileOpenMode::E_CreateOrOverwrite), string_q("The current user does not have permissions to overwrite the file \"") + filePath.GetAbsolutePath() + "\".");
+        }
+        else
+        {
+            m_bWritingIsAllowed = true;
+        }
+
+        QE_ASSERT_WARNING(uFileSize <= pointer_uint_q(-1), "The the file is too large, this class cannot access file offsets over 2^32 - 1 when it is compiled for x86 architecture.");
+
+        if(uFileSize > pointer_uint_q(-1))
+        {
+            eErrorInfo = EQFileSystemError::E_FileIsTooLarge;
+        }
+        else if(QAsynchronousFileStream::_OpenPlatformImplementation(filePath, eOpenMode, m_bWritingIsAllowed, m_nativeHandle, eErrorInfo))
+        {
+            m_path = filePath;
+            m_uFileSize = scast_q(uFileSize, pointer_uint_q);
+            m_uPositionPointer = eOpenMode == EQFileOpenMode::E_Append ? m_uFileSize :
+                                                                         0;
+            m_pCurrentBuffer = null_q;
+            m_uUseCounter = 0;
+
+            for(unsigned int i = 0; i < m_uBufferCount; ++i)
+            {
+                m_arBuffers[i].m_uState = QAsynchronousFileStream::_BUFFER_EMPTY;
+                m_arBuffers[i].m_uLastUse = 0;
+                m_arBuffers[i].m_eResult = EQFileSystemError::E_Success;
+            }
+
+            m_bStopRequested = false;
+            m_eBackgroundError = EQFileSystemError::E_Success;
+            m_pBackgroundThread = new QThread(QDelegate<void ()>(this, &QAsynchronousFileStream::_BackgroundThreadLoop));
+            m_bIsOpen = true;
+            eErrorInfo = EQFileSystemError::E_Success;
+        }
+    }
+    else if(FILE_EXISTS && eOpenMode == EQFileOpenMode::E_Create)
+    {
+        eErrorInfo = EQFileSystemError::E_AlreadyExists;
+    }
+    else
+    {
+        eErrorInfo = EQFileSystemError::E_DoesNotExist;
+    }
+
+    return eErrorInfo;
+}
+
+void QAsynchronousFileStream::Close()
+{
+    QE_ASSERT_WARNING(m_bIsOpen == true, "The file was already closed.");
+
+    if(m_bIsOpen)
+    {
+        this->Flush();
+
+        {
+            QScopedExclusiveLock<> lock(m_mutex);
+            m_bStopRequested = true;
+            m_bufferRequested.NotifyAll();
+        }
+
+        m_pBackgroundThread->Join();
+        delete m_pBackgroundThread;
+        m_pBackgroundThread = null_q;
+
+        bool bOperationSuccessful = QAsynchronousFileStream::_ClosePlatformImplementation(m_nativeHandle, m_path);
+
+        if(bOperationSuccessful)
+        {
+            m_bIsOpen = false;
+        }
+    }
+}
+
+QAsynchronousFileStream::QWindowBuffer* QAsynchronousFileStream::_AcquireBuffer(const pointer_uint_q uWindow, const bool bIsForWriting)
+{
+    // When the window is the same as in the previous operation, no synchronization is necessary since the background thread does not
+    // change the state of clean or dirty buffers
+    if(m_pCurrentBuffer != null_q && m_pCurrentBuffer->m_uWindow == uWindow && (!bIsForWriting || m_pCurrentBuffer->m_uState == QAsynchronousFileStream::_BUFFER_DIRTY))
+        return m_pCurrentBuffer;
+
+    QScopedExclusiveLock<> lock(m_mutex);
+
+    // Write-behind: The previous buffer is written in the background while the caller uses another one
+    if(m_pCurrentBuffer != null_q && m_pCurrentBuffer->m_uWindow != uWindow && m_pCurrentBuffer->m_uState == QAsynchronousFileStream::_BUFFER_DIRTY)
+        this->_RequestWrite(m_pCurrentBuffer);
+
+    m_pCurrentBuffer = null_q;
+
+    QWindowBuffer* pBuffer = this->_FindBuffer(uWindow);
+
+    // If no buffer stores the window, the least recently used buffer that has no pending bytes is replaced, waiting for one if necessary
+    while(pBuffer == null_q)
+    {
+        pBuffer = this->_FindReplaceableBuffer();
+
+        if(pBuffer != null_q)
+        {
+            this->_AssignWindow(pBuffer, uWindow);
+        }
+        else
+        {
+            for(unsigned int i = 0; i < m_uBufferCount; ++i)
+            {
+                if(m_arBuffers[i].m_uState == QAsynchronousFileStream::_BUFFER_DIRTY)
+                    this->_RequestWrite(&m_arBuffers[i]);
+            }
+
+            m_bufferCompleted.Wait(lock);
+        }
+    }
+
+    // Waits for the background thread to finish loading or writing the buffer
+    while(pBuffer->m_uState != QAsynchronousFileStream::_BUFFER_CLEAN && pBuffer->m_uState != QAsynchronousFileStream::_BUFFER_DIRTY)
+        m_bufferCompleted.Wait(lock);
+
+    QE_ASSERT_ERROR(pBuffer->m_eResult == EQFileSystemError::E_Success, string_q("An unexpected error occurred when the background thread accessed the file \"") + m_path.GetAbsolutePath() + "\". The error was: " + EQFileSystemError(pBuffer->m_eResult).ToString() + ".");
+    pBuffer->m_eResult = EQFileSystemError::E_Success;
+
+    if(bIsForWriting)
+        pBuffer->m_uState = QAsynchronousFileStream::_BUFFER_DIRTY;
+
+    pBuffer->m_uLastUse = ++m_uUseCounter;
+    m_pCurrentBuffer = pBuffer;
+
+    // Read-ahead: The next window is loaded in the background if it belongs to the stream and a buffer can be replaced without waiting
+    const pointer_uint_q NEXT_WINDOW = uWindow + 1U;
+
+    if(!bIsForWriting && NEXT_WINDOW * m_uBufferSize < m_uFileSize && this->_FindBuffer(NEXT_WINDOW) == null_q)
+    {
+        QWindowBuffer* pNextBuffer = this->_FindReplaceableBuffer();
+
+        if(pNextBuffer != null_q)
+            this->_AssignWindow(pNextBuffer, NEXT_WINDOW);
+    }
+
+    return pBuffer;
+}
+
+QAsynchronousFileStream::QWindowBuffer* QAsynchronousFileStream::_FindBuffer(const pointer_uint_q uWindow) const
+{
+    QWindowBuffer* pBuffer = null_q;
+
+    for(unsigned int i = 0; i < m_uBufferCount && pBuffer == null_q; ++i)
+    {
+        if(m_arBuffers[i].m_uState != QAsynchronousFileStream::_BUFFER_EMPTY && m_arBuffers[i].m_uWindow == uWindow)
+            pBuffer = &m_arBuffers[i];
+    }
+
+    return pBuffer;
+}
+
+QAsynchronousFileStream::QWindowBuffer* QAsynchronousFileStream::_FindReplaceableBuffer() const
+{
+    QWindowBuffer* pBuffer = null_q;
+
+    for(unsigned int i = 0; i < m_uBufferCount; ++i)
+    {
+        const bool IS_REPLACEABLE = (m_arBuffers[i].m_uState == QAsynchronousFileStream::_BUFFER_EMPTY || 
+                                     m_arBuffers[i].m_uState == QAsynchronousFileStream::_BUFFER_CLEAN) &&
+                                    &m_arBuffers[i] != m_pCurrentBuffer;
+
+        if(IS_REPLACEABLE && (pBuffer == null_q || m_arBuffers[i].m_uLastUse < pBuffer->m_uLastUse))
+            pBuffer = &m_arBuffers[i];
+    }
+
+    return pBuffer;
+}
+
+void QAsynchronousFileStream::_AssignWindow(QWindowBuffer* pBuffer, const pointer_uint_q uWindow)
+{
+    const pointer_uint_q WINDOW_START = uWindow * m_uBufferSize;
+
+    pBuffer->m_uWindow = uWindow;
+    pBuffer->m_uLastUse = ++m_uUseCounter;
+    pBuffer->m_eResult = EQFileSystemError::E_Success;
+
+    // Windows that are not stored in any buffer contain the same bytes as the file
+    if(WINDOW_START < m_uFileSize)
+    {
+        const pointer_uint_q BYTES_IN_WINDOW = m_uFileSize - WINDOW_START;
+        pBuffer->m_uValidBytes = BYTES_IN_WINDOW < m_uBufferSize ? BYTES_IN_WINDOW : 
+                                                                   m_uBufferSize;
+        pBuffer->m_uState = QAsynchronousFileStream::_BUFFER_PENDING_LOAD;
+        m_bufferRequested.NotifyOne();
+    }
+    else
+    {
+        pBuffer->m_uValidBytes = 0;
+        pBuffer->m_uState = QAsynchronousFileStream::_BUFFER_CLEAN;
+    }
+}
+
+void QAsynchronousFileStream::_RequestWrite(QWindowBuffer* pBuffer)
+{
+    pBuffer->m_uState = QAsynchronousFileStream::_BUFFER_PENDING_WRITE;
+    pBuffer->m_eResult = EQFileSystemError::E_Success;
+    m_bufferRequested.NotifyOne();
+}
+
+void QAsynchronousFileStream::_BackgroundThreadLoop()
+{
+    QScopedExclusiveLock<> lock(m_mutex);
+
+    bool bFinished = false;
+
+    while(!bFinished)
+    {
+        QWindowBuffer* pBuffer = null_q;
+
+        // Loads are processed before writes since the stream is more likely to be waiting for them
+        for(unsigned int i = 0; i < m_uBufferCount && pBuffer == null_q; ++i)
+        {
+            if(m_arBuffers[i].m_uState == QAsynchronousFileStream::_BUFFER_PENDING_LOAD)
+                pBuffer = &m_arBuffers[i];
+        }
+
+        for(unsigned int i = 0; i < m_uBufferCount && pBuffer == null_q; ++i)
+        {
+            if(m_arBuffers[i].m_uState == QAsynchronousFileStream::_BUFFER_PENDING_WRITE)
+                pBuffer = &m_arBuffers[i];
+        }
+
+        if(pBuffer != null_q)
+        {
+            const bool IS_LOAD = pBuffer->m_uState == QAsynchronousFileStream::_BUFFER_PENDING_LOAD;
+            const pointer_uint_q FILE_OFFSET = pBuffer->m_uWindow * m_uBufferSize;
+            const pointer_uint_q NUMBER_OF_BYTES = pBuffer->m_uValidBytes;
+
+            pBuffer->m_uState = IS_LOAD ? QAsynchronousFileStream::_BUFFER_LOADING : 
+                                          QAsynchronousFileStream::_BUFFER_WRITING;
+
+            // The stream does not access the buffer while it is being loaded or written
+            lock.Unlock();
+
+            EQFileSystemError eResult = EQFileSystemError::E_Success;
+            bool bOperationSuccessful = IS_LOAD ? QAsynchronousFileStream::_ReadPlatformImplementation(pBuffer->m_pData, NUMBER_OF_BYTES, FILE_OFFSET, m_nativeHandle, eResult) :
+                                                  QAsynchronousFileStream::_WritePlatformImplementation(pBuffer->m_pData, NUMBER_OF_BYTES, FILE_OFFSET, m_nativeHandle, eResult);
+
+            // A window that could not be loaded must not expose the bytes of the window the buffer stored before
+            if(!bOperationSuccessful && IS_LOAD)
+                memset(pBuffer->m_pData, 0, NUMBER_OF_BYTES);
+
+            lock.Lock();
+
+            // Failures are kept so they are reported to the thread that uses the stream
+            if(!bOperationSuccessful && m_eBackgroundError == EQFileSystemError::E_Success)
+                m_eBackgroundError = eResult;
+
+            pBuffer->m_eResult = eResult;
+            pBuffer->m_uState = QAsynchronousFileStream::_BUFFER_CLEAN;
+            m_bufferCompleted.NotifyAll();
+        }
+        else if(m_bStopRequested)
+        {
+            bFinished = true;
+        }
+        else
+        {
+            m_bufferRequested.Wait(lock);
+        }
+    }
+}
+
+#if defined(QE_OS_WINDOWS)
+
+bool QAsynchronousFileStream::_ReadPlatformImplementation(u8_q* pOutputBuffer, const pointer_uint_q uNumberOfBytes, const pointer_uint_q uFileOffset, const QAsynchronousFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo)
+{
+    bool bSuccess = true;
+
+    OVERLAPPED offsets;
+    memset(&offsets, 0, sizeof(OVERLAPPED)); // The structure MUST be zero-initialized
+
+    // Sets the offset from where to start reading
+    const u64_q FILE_OFFSET = uFileOffset;
+    offsets.Offset = scast_q(FILE_OFFSET & 0xFFFFFFFFU, DWORD);
+    offsets.OffsetHigh = scast_q(FILE_OFFSET >> 32U, DWORD);
+
+    static const BOOL READ_OPERATION_FAILED = 0;
+    BOOL uReadFileResult = ::ReadFile(handle, pOutputBuffer, uNumberOfBytes, NULL, &offsets);
+
+    if(uReadFileResult == READ_OPERATION_FAILED)
+    {
+        bSuccess = false;
+        eErrorInfo = EQFileSystemError::E_Unknown;
+    }
+
+    return bSuccess;
+}
+
+bool QAsynchronousFileStream::_WritePlatformImplementation(const void* pInputBuffer, const pointer_uint_q uNumberOfBytes, const pointer_uint_q uFileOffset, const QAsynchronousFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo)
+{
+    bool bSuccess = true;
+
+    OVERLAPPED offsets;
+    memset(&offsets, 0, sizeof(OVERLAPPED)); // The structure MUST be zero-initialized
+
+    // Sets the offset from where to start reading
+    const u64_q FILE_OFFSET = uFileOffset;
+    offsets.Offset = scast_q(FILE_OFFSET & 0xFFFFFFFFU, DWORD);
+    offsets.OffsetHigh = scast_q(FILE_OFFSET >> 32U, DWORD);
+
+    static const BOOL WRITE_OPERATION_FAILED = 0;
+    BOOL uWriteFileResult = ::WriteFile(handle, pInputBuffer, uNumberOfBytes, NULL, &offsets);
+
+    if(uWriteFileResult == WRITE_OPERATION_FAILED)
+    {
+        bSuccess = false;
+            
+        DWORD uWriteFileLastError = ::GetLastError();
+
+        if(uWriteFileLastError == ERROR_DISK_FULL || uWriteFileLastError == ERROR_HANDLE_DISK_FULL)
+            eErrorInfo = EQFileSystemError::E_NoSpaceInDevice;
+        else if(uWriteFileLastError == ERROR_ACCESS_DENIED)
+            eErrorInfo = EQFileSystemError::E_NoPermissions;
+        else
+            eErrorInfo = EQFileSystemError::E_Unknown;
+    }
+
+    return bSuccess;
+}
+
+bool QAsynchronousFileStream::_OpenPlatformImplementation(const QPath &filePath, const EQFileOpenMode &eOpenMode, const bool bIsWritingAllowed, QAsynchronousFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo)
+{
+    bool bSuccess = true;
+
+    using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+    using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+
+    QArrayResult<i8_q> arPath = filePath.ToString().ToBytes(string_q::GetLocalEncodingUTF16());
+    const wchar_t* szPath = rcast_q(arPath.Get(), wchar_t*);
+    DWORD uAccess = bIsWritingAllowed ? GENERIC_READ | GENERIC_WRITE : 
+                                        GENERIC_READ;
+    DWORD uOpenMode = 0;
+
+    switch(eOpenMode)
+    {
+    case EQFileOpenMode::E_Append:
+    case EQFileOpenMode::E_Open:
+        uOpenMode = OPEN_EXISTING;
+        break;
+    case EQFileOpenMode::E_Create:
+        uOpenMode = CREATE_NEW;
+        break;
+    case EQFileOpenMode::E_CreateOrOverwrite:
+        uOpenMode = CREATE_ALWAYS;
+        break;
+    case EQFileOpenMode::E_OpenOrCreate:
+        uOpenMode = OPEN_ALWAYS;
+        break;
+    default:
+        break;
+    }
+
+    handle = ::CreateFileW(szPath, uAccess, FILE_SHARE_READ, NULL, uOpenMode, FILE_FLAG_RANDOM_ACCESS, NULL);
+
+    const bool FILE_OPENED_SUCCESSFULLY = handle != INVALID_HANDLE_VALUE;
+
+    if(!FILE_OPENED_SUCCESSFULLY)
+    {
+        bSuccess = false;
+        DWORD uCreateFileWLastError = ::GetLastError();
+        QE_ASSERT_ERROR(handle != INVALID_HANDLE_VALUE, string_q("An unexpected error occurred when opening the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(uCreateFileWLastError) + ".");
+
+        if(uCreateFileWLastError == ERROR_ACCESS_DENIED)
+            eErrorInfo = EQFileSystemError::E_NoPermissions;
+        else
+            eErrorInfo = EQFileSystemError::E_Unknown;
+    }
+
+    return bSuccess;
+}
+
+bool QAsynchronousFileStream::_ClosePlatformImplementation(const QAsynchronousFileStream::NativeHandle &handle, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+    static const BOOL CLOSE_OPERATION_FAILED = 0;
+    BOOL uCloseHandleResult = ::CloseHandle(handle);
+
+    if(uCloseHandleResult == CLOSE_OPERATION_FAILED)
+    {
+        bSuccess = false;
+        DWORD uCloseHandleLastError = ::GetLastError();
+        QE_ASSERT_ERROR(uCloseHandleResult != 0, string_q("An unexpected error occurred when closing the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(uCloseHandleLastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+
+bool QAsynchronousFileStream::_ReadPlatformImplementation(u8_q* pOutputBuffer, const pointer_uint_q uNumberOfBytes, const pointer_uint_q uFileOffset, const QAsynchronousFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo)
+{
+    bool bSuccess = true;
+
+    ssize_t nResult = pread(handle, pOutputBuffer, uNumberOfBytes, uFileOffset);
+        
+    if(nResult < 0)
+    {
+        bSuccess = false;
+        eErrorInfo = EQFileSystemError::E_Unknown;
+    }
+
+    return bSuccess;
+}
+
+bool QAsynchronousFileStream::_WritePlatformImplementation(const void* pInputBuffer, const pointer_uint_q uNumberOfBytes, const pointer_uint_q uFileOffset, const QAsynchronousFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo)
+{
+    bool bSuccess = true;
+
+    ssize_t nResult = pwrite(handle, pInputBuffer, uNumberOfBytes, uFileOffset);
+        
+    if(nResult < 0)
+    {
+        bSuccess = false;
+        error_t lastError = errno;
+
+        if(lastError == ENOSPC)
+            eErrorInfo = EQFileSystemError::E_NoSpaceInDevice;
+        else if(lastError == EFBIG)
+            eErrorInfo = EQFileSystemError::E_FileIsTooLarge;
+        else
+            eErrorInfo = EQFileSystemError::E_Unknown;
+    }
+
+    return bSuccess;
+}
+
+bool QAsynchronousFileStream::_OpenPlatformImplementation(const QPath &filePath, const EQFileOpenMode &eOpenMode, const bool bIsWritingAllowed, QAsynchronousFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo)
+{
+    bool bSuccess = true;
+
+    using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+    using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+    using Kinesis::QuimeraEngine::Common::DataTypes::EQTextEncoding;
+
+    QArrayResult<i8_q> szPath = filePath.ToString().ToBytes(EQTextEncoding::E_UTF8);
+        
+    int nAccess = bIsWritingAllowed ? O_RDWR: 
+                                      O_RDONLY;
+    int nPermissions = S_IRWXU; // Read, write and execution permissions for the owner
+    int nOpenMode = 0;
+
+    switch(eOpenMode)
+    {
+    case EQFileOpenMode::E_Append:
+    case EQFileOpenMode::E_Open:
+        nOpenMode = 0;
+        break;
+    case EQFileOpenMode::E_Create:
+        nOpenMode = O_CREAT | O_EXCL;
+        break;
+    case EQFileOpenMode::E_CreateOrOverwrite:
+        nOpenMode = O_CREAT | O_TRUNC;
+        break;
+    case EQFileOpenMode::E_OpenOrCreate:
+        nOpenMode = O_CREAT;
+        break;
+    default:
+        break;
+    }
+        
+    handle = open(szPath.Get(), nAccess | nOpenMode, nPermissions);
+
+    const bool FILE_OPENED_SUCCESSFULLY = handle >= 0;
+        
+    if(!FILE_OPENED_SUCCESSFULLY)
+    {
+        bSuccess = false;
+        error_t lastError = errno;
+        QE_ASSERT_ERROR(handle >= 0, string_q("An unexpected error occurred when opening the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(lastError) + ".");
+            
+        if(lastError == EACCES)
+            eErrorInfo = EQFileSystemError::E_NoPermissions;
+        else
+            eErrorInfo = EQFileSystemError::E_Unknown;
+    }
+
+    return bSuccess;
+}
+
+bool QAsynchronousFileStream::_ClosePlatformImplementation(const QAsynchronousFileStream::NativeHandle &handle, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+    int nResult = close(handle);
+
+    if(nResult < 0)
+    {
+        bSuccess = false;
+        error_t lastError = errno;
+        QE_ASSERT_ERROR(nResult >= 0, string_q("An unexpected error occurred when closing the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(lastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+#endif
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+pointer_uint_q QAsynchronousFileStream::GetLength() const
+{
+    QE_ASSERT_WARNING(m_bIsOpen == true, "The file is not open.");
+
+    return m_uFileSize;
+}
+
+pointer_uint_q QAsynchronousFileStream::GetPosition() const
+{
+    return m_uPositionPointer;
+}
+
+void QAsynchronousFileStream::SetPosition(const pointer_uint_q uPosition)
+{
+    QE_ASSERT_WARNING(m_bIsOpen == true, "The file is not open.");
+    QE_ASSERT_WARNING(uPosition <= m_uFileSize, "It is not possible to set the specified position, it would be out of bounds.");
+
+    if(uPosition <= m_uFileSize)
+        m_uPositionPointer = uPosition;
+}
+
+QPath QAsynchronousFileStream::GetPath() const
+{
+    return m_path;
+}
+
+bool QAsynchronousFileStream::IsOpen() const
+{
+    return m_bIsOpen;
+}
+
+QAsynchronousFileStream::NativeHandle QAsynchronousFileStream::GetNativeHandle() const
+{
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file is not open.");
+
+    return m_nativeHandle;
+}
+
+pointer_uint_q QAsynchronousFileStream::GetBufferSize() const
+{
+    return m_uBufferSize;
+}
+
+unsigned int QAsynchronousFileStream::GetBufferCount() const
+{
+    return m_uBufferCount;
+}
+
+
+} //namespace FileSystem
+} //namespace IO
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -31,11 +31,9 @@
 #include "QScopedSharedLock.h"
 
 using Kinesis::QuimeraEngine::System::Threading::SQThisThread;
-using Kinesis::QuimeraEngine::System::Threading::QThread;
 using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
 using Kinesis::QuimeraEngine::System::Threading::QSharedMutex;
 using Kinesis::QuimeraEngine::System::Threading::QScopedSharedLock;
-using Kinesis::QuimeraEngine::Tools::Containers::QDictionary;
 
 #ifdef GetPrinter // On Windows, the API maps the GetPrinter definition to either GetPrinterA or GetPrinterW function names, which prevents the GetPrinter method from being declared
     #undef GetPrinter
@@ -62,7 +60,9 @@ namespace Diagnosis
 //##################                                                       ##################
 //##################=======================================================##################
 
-QCallStackTracer::QCallStackTracer() : m_pPrinter((QAbstractCallStackTracePrinter*)null_q)
+QCallStackTracer::QCallStackTracer() : m_pRegisteredCallStackTraces(null_q),
+                                       m_currentRegisteredCallStackTrace(&QCallStackTracer::ReleaseCallStackTrace),
+                                       m_pPrinter((QAbstractCallStackTracePrinter*)null_q)
 {
 }
 
@@ -85,69 +85,90 @@ QCallStackTracer* QCallStackTracer::Get()
 
 void QCallStackTracer::AddTrace(const QCallTrace &trace)
 {
-    QThread::Id threadId = SQThisThread::GetId();
-
-    // ---------- Critical section -----------
-    {
-        QScopedExclusiveLock<QSharedMutex> exclusiveLock(m_callStackTracesMutex);
-
-        CallStackTraceContainer::ConstIterator itCallStackTrace = m_callStackTraces.PositionOfKey(threadId);
+    this->GetCurrentCallStackTrace()->Push(trace);
+}
 
-        const bool CALLSTACKTRACE_DOES_NOT_EXIST = itCallStackTrace.IsEnd();
+void QCallStackTracer::RemoveLastTrace()
+{
+    this->GetCurrentCallStackTrace()->Pop();
+}
 
-        if(CALLSTACKTRACE_DOES_NOT_EXIST)
-        {
-            // Creates a new call stack trace
-            QCallStackTrace* pNewCallStackTrace = new QCallStackTrace(SQThisThread::ToString());
-            itCallStackTrace = m_callStackTraces.Add(threadId, pNewCallStackTrace);
-        }
+void QCallStackTracer::Dump()
+{
+    boost::shared_ptr<QAbstractCallStackTracePrinter> pPrinter = this->GetPrinter();
 
-        itCallStackTrace->GetValue()->Push(trace);
+    if(pPrinter != null_q)
+    {
+        const QCallStackTrace* pCallStackTrace = this->GetCurrentCallStackTrace();
 
-    } // --------- Critical section ----------
+        if(pCallStackTrace->GetCount() > 0)
+            pPrinter->PrintCallStackTrace(*pCallStackTrace);
+    }
 }
 
-void QCallStackTracer::RemoveLastTrace()
+QCallStackTrace* QCallStackTracer::GetCurrentCallStackTrace()
 {
-    QThread::Id threadId = SQThisThread::GetId();
+    QCallStackTrace* pCurrentCallStackTrace = QCallStackTracer::GetCachedCallStackTrace();
 
-    // ---------- Critical section -----------
-    {
-        QScopedExclusiveLock<QSharedMutex> exclusiveLock(m_callStackTracesMutex);
-        CallStackTraceContainer::ConstIterator itCallStackTrace = m_callStackTraces.PositionOfKey(threadId);
-        itCallStackTrace->GetValue()->Pop();
+    // Only the first call of every thread accesses the list of registered call stack traces
+    if(pCurrentCallStackTrace == null_q)
+        pCurrentCallStackTrace = this->RegisterCurrentThread();
 
-        // If there are no more traces in the call stack of the current thread, the stack is completely removed
-        if(itCallStackTrace->GetValue()->GetCount() == 0)
-            m_callStackTraces.Remove(itCallStackTrace);
-
-    } // --------- Critical section ----------
+    return pCurrentCallStackTrace;
 }
 
-void QCallStackTracer::Dump()
+QCallStackTrace*& QCallStackTracer::GetCachedCallStackTrace()
 {
-    if(m_pPrinter != null_q)
-    {
-        QThread::Id threadId = SQThisThread::GetId();
+    static threadlocal_q QCallStackTrace* pCachedCallStackTrace = null_q;
 
-        // ---------- Critical section -----------
-        {
-            QScopedSharedLock<QSharedMutex> sharedLock(m_callStackTracesMutex);
+    return pCachedCallStackTrace;
+}
 
-            CallStackTraceContainer::ConstIterator itCallStackTrace = m_callStackTraces.PositionOfKey(threadId);
-            const bool CALLSTACKTRACE_EXISTS = !itCallStackTrace.IsEnd();
+QCallStackTrace* QCallStackTracer::RegisterCurrentThread()
+{
+    QRegisteredCallStackTrace* pRegisteredCallStackTrace = m_pRegisteredCallStackTraces.load(boost::memory_order_acquire);
+    bool bReused = false;
+
+    // Searches for a call stack trace whose thread has finished
+    while(pRegisteredCallStackTrace != null_q && !bReused)
+    {
+        bool bInUse = false;
+        bReused = pRegisteredCallStackTrace->m_bInUse.compare_exchange_strong(bInUse, true, boost::memory_order_acquire);
 
-            if(CALLSTACKTRACE_EXISTS)
-                m_pPrinter->PrintCallStackTrace(*itCallStackTrace->GetValue());
+        if(!bReused)
+            pRegisteredCallStackTrace = pRegisteredCallStackTrace->m_pNext;
+    }
 
-        } // --------- Critical section ----------
+    if(bReused)
+    {
+        // The previous call stack trace is replaced because it stores the Id of the finished thread
+        delete pRegisteredCallStackTrace->m_pCallStackTrace;
+        pRegisteredCallStackTrace->m_pCallStackTrace = new QCallStackTrace(SQThisThread::ToString());
     }
     else
     {
-        static const string_q NO_TRACES_MESSAGE1("There are no call stack traces for the current thread (");
-        static const string_q NO_TRACES_MESSAGE2(").");
-        m_pPrinter->PrintString(NO_TRACES_MESSAGE1 + SQThisThread::ToString() + NO_TRACES_MESSAGE2);
+        pRegisteredCallStackTrace = new QRegisteredCallStackTrace();
+        pRegisteredCallStackTrace->m_pCallStackTrace = new QCallStackTrace(SQThisThread::ToString());
+        pRegisteredCallStackTrace->m_pNext = m_pRegisteredCallStackTraces.load(boost::memory_order_relaxed);
+
+        // The node is added at the beginning of the list; if another thread added a node meanwhile, the next node is updated and it is tried again
+        while(!m_pRegisteredCallStackTraces.compare_exchange_weak(pRegisteredCallStackTrace->m_pNext,
+                                                                  pRegisteredCallStackTrace,
+                                                                  boost::memory_order_release,
+                                                                  boost::memory_order_relaxed));
     }
+
+    m_currentRegisteredCallStackTrace.reset(pRegisteredCallStackTrace);
+    QCallStackTracer::GetCachedCallStackTrace() = pRegisteredCallStackTrace->m_pCallStackTrace;
+
+    return pRegisteredCallStackTrace->m_pCallStackTrace;
+}
+
+void QCallStackTracer::ReleaseCallStackTrace(QRegisteredCallStackTrace* pRegisteredCallStackTrace)
+{
+    // The thread must not use the call stack trace anymore, since another thread may reuse it from now on
+    QCallStackTracer::GetCachedCallStackTrace() = null_q;
+    pRegisteredCallStackTrace->m_bInUse.store(false, boost::memory_order_release);
 }
 
 
@@ -205,6 +205,7 @@ void QStringUnicode::QCharIterator::SetChar(const QCharUnicode &newCharacter)
     {
         // Changes the string
         ccast_q(m_pString, string_q*)->m_strString.setCharAt(m_iterator.getIndex(), newCharacter.GetCodePoint());
+        ccast_q(m_pString, string_q*)->_ResetCodeUnitIndex();
 
         // Updates the iterator
         const i32_q CURRENT_INDEX = m_iterator.getIndex();
@@ -79,7 +79,7 @@ QStringUnicode::QConstCharIterator::QConstCharIterator(const QStringUnicode &str
 {
     if(uInitialPosition < m_pString->GetLength())
     {
-        m_iterator.move32(uInitialPosition, icu::CharacterIterator::kStart);
+        m_iterator.setIndex(m_pString->_GetCodeUnitIndex(uInitialPosition));
     }
     else
     {
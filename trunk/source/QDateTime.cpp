@@ -443,82 +443,21 @@ QDateTime::QDateTime(const QDateTime &dateTime, const QTimeZone* pTimeZone) : m_
 
 QDateTime::QDateTime(const string_q &strTimestamp)
 {
-    static const char_q DATE_SEPARATOR = '-';
-    static const char_q TIME_START_SEPARATOR = 'T';
-    static const char_q POSITIVE_SIGN = '+';
-    static const char_q NEGATIVE_SIGN = '-';
-
-    QE_ASSERT_ERROR(!strTimestamp.IsEmpty(), "The input timestamp must not be empty.");
-    QE_ASSERT_ERROR(strTimestamp.IndexOf(" ", EQComparisonType::E_BinaryCaseSensitive) == string_q::PATTERN_NOT_FOUND, "The input timestamp must not contain whitespaces.");
-
-    i32_q nYear, nOffsetHours;
-    u32_q uMonth, uDay, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, uOffsetMinutes;
-
-    int nTimePosition = strTimestamp.IndexOf(TIME_START_SEPARATOR, EQComparisonType::E_BinaryCaseSensitive);
-
-    if(nTimePosition != string_q::PATTERN_NOT_FOUND)
-    {
-        // The timestamp combines Date and Time
-
-        this->_ParseTimestampCompleteDate(strTimestamp, scast_q(nTimePosition, u32_q), nYear, uMonth, uDay);
-        this->_ParseTimestampCompleteTime(strTimestamp, scast_q(nTimePosition, u32_q), uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, nOffsetHours, uOffsetMinutes);
-
-        // The date and time is constructed
-        *this = QDateTime(nYear, uMonth, uDay, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, QTimeZone::UTC);
-
-        this->_ApplyOffsetToTimestamp(nOffsetHours, uOffsetMinutes, uHour, uMinute, *this);
-    }
-    else
-    {
-        // The timestamp contains either Date or Time information only
-
-        if(strTimestamp[0] == POSITIVE_SIGN || strTimestamp[0] == NEGATIVE_SIGN)
-        {
-            // It is preceeded by a sign, so it must be a date
-
-            const int SEPARATOR_POSITION = strTimestamp.IndexOf(DATE_SEPARATOR, 1, EQComparisonType::E_BinaryCaseSensitive); // Starts from 1 to skip the sign
+    this->_ParseTimestamp(strTimestamp.GetInternalBuffer(), strTimestamp.GetLength());
+}
 
-            if(SEPARATOR_POSITION != string_q::PATTERN_NOT_FOUND)
-                this->_ParseTimestampIncompleteDateWithSeparators(strTimestamp, SEPARATOR_POSITION, nYear, uMonth, uDay);
-            else
-                this->_ParseTimestampIncompleteDateWithoutSeparators(strTimestamp, nYear, uMonth, uDay);
+QDateTime::QDateTime(const i8_q* arTimestamp, const unsigned int uLength)
+{
+    QE_ASSERT_ERROR(arTimestamp != null_q, "The input timestamp must not be null.");
 
-            *this = QDateTime(nYear, uMonth, uDay, QTimeZone::UTC);
-        }
-        else
-        {
-            // It is not preceded by a sign, so it may be either a date or a time
+    this->_ParseTimestamp(arTimestamp, uLength);
+}
 
-            const int FIRST_SEPARATOR_POSITION = strTimestamp.IndexOf(DATE_SEPARATOR, EQComparisonType::E_BinaryCaseSensitive);
+QDateTime::QDateTime(const u16_q* arTimestamp, const unsigned int uLength)
+{
+    QE_ASSERT_ERROR(arTimestamp != null_q, "The input timestamp must not be null.");
 
-            if(FIRST_SEPARATOR_POSITION != string_q::PATTERN_NOT_FOUND)
-            {
-                const int SECOND_SEPARATOR_POSITION = strTimestamp.IndexOf(DATE_SEPARATOR, FIRST_SEPARATOR_POSITION + 1U, EQComparisonType::E_BinaryCaseSensitive);
-
-                if(SECOND_SEPARATOR_POSITION != string_q::PATTERN_NOT_FOUND)
-                {
-                    // It contains 2 hyphens, it must be a date
-                    this->_ParseTimestampIncompleteDateWithSeparators(strTimestamp, FIRST_SEPARATOR_POSITION, nYear, uMonth, uDay);
-                    *this = QDateTime(nYear, uMonth, uDay, QTimeZone::UTC);
-                }
-                else
-                {
-                    // It is interpreted as time by default, even if it does not contain colons (the hyphen is considered a minus sign of the time offset instead of a date seprator)
-
-                    this->_ParseTimestampIncompleteTime(strTimestamp, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, nOffsetHours, uOffsetMinutes);
-                    *this = QDateTime(uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, QTimeZone::UTC);
-                    this->_ApplyOffsetToTimestampWithoutAffectingDate(nOffsetHours, uOffsetMinutes, uHour, uMinute, *this);
-                }
-            }
-            else
-            {
-                // It is interpreted as time by default, even if it does not contain colons
-                this->_ParseTimestampIncompleteTime(strTimestamp, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, nOffsetHours, uOffsetMinutes);
-                *this = QDateTime(uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, QTimeZone::UTC);
-                this->_ApplyOffsetToTimestampWithoutAffectingDate(nOffsetHours, uOffsetMinutes, uHour, uMinute, *this);
-            }
-        }
-    }
+    this->_ParseTimestamp(arTimestamp, uLength);
 }
 
 
@@ -686,237 +625,48 @@ const QDateTime& QDateTime::GetUndefinedDate()
 
 string_q QDateTime::ToString() const
 {
-    // Output format samples: +YYYYY-MM-DDThh:mm:ss.uuuuuuu+hh:mm
-    //                        -YYYY-MM-DDThh:mm:ss.uuuuuuuZ
-    //                        +YYYY-MM-DDThh:mm:ss-hh:mm
-
-    static const string_q TIME_SEPARATOR = ":";
-    static const string_q DATE_SEPARATOR = "-";
-    static const string_q TIME_START_SEPARATOR = "T";
-    static const string_q POSITIVE_SIGN = "+";
-    static const string_q NEGATIVE_SIGN = "-";
-    static const string_q ZULU_TIME = "Z";
-    static const string_q ZERO_STRING = "0";
-
-    QE_ASSERT_ERROR(!this->IsUndefined(), "Undefined date/times cannot be represented as string");
-
-    string_q strTimestamp;
-    if(this->IsNegative())
-        strTimestamp.Append(NEGATIVE_SIGN);
-    else
-        strTimestamp.Append(POSITIVE_SIGN);
-
-    unsigned int uYear;
-    unsigned int uMonth;
-    unsigned int uDay;
-    unsigned int uHour;
-    unsigned int uMinute;
-    unsigned int uSecond;
-    unsigned int uMillisecond;
-    unsigned int uMicrosecond;
-    unsigned int uHundredOfNanosecond;
-
-    this->Decompose(uYear, uMonth, uDay, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond);
-
-    // Negative years are adjusted so the year 1 BC, or -1, is represented by "-0000" in timestamps
-    uYear = this->IsNegative() ? uYear - 1U : uYear;
-
-    const string_q& YEAR_STRING = string_q::FromInteger(uYear);
-
-    // Padding with zeroes
-    const unsigned int YEAR_STRING_LENGTH = YEAR_STRING.GetLength();
-
-    if(YEAR_STRING_LENGTH < 4U) // YYYYY is allowed, but padding is applied only when width is lower than 4 cyphers
-    {
-        for(unsigned int i = 0; i < 4U - YEAR_STRING_LENGTH; ++i)
-            strTimestamp.Append(ZERO_STRING);
-    }
-
-    strTimestamp.Append(YEAR_STRING);
-    strTimestamp.Append(DATE_SEPARATOR);
-
-    // Padding with zeroes
-    const unsigned int FIRST_NUMBER_WITH_2_CYPHERS = 10U;
-
-    if(uMonth < FIRST_NUMBER_WITH_2_CYPHERS) // Less than 2 cyphers
-        strTimestamp.Append(ZERO_STRING);
-
-    strTimestamp.Append(string_q::FromInteger(uMonth));
-    strTimestamp.Append(DATE_SEPARATOR);
-
-    // Padding with zeroes
-    if(uDay < FIRST_NUMBER_WITH_2_CYPHERS) // Less than 2 cyphers
-        strTimestamp.Append(ZERO_STRING);
-
-    strTimestamp.Append(string_q::FromInteger(uDay));
-    strTimestamp.Append(TIME_START_SEPARATOR);
-
-    // Padding with zeroes
-    if(uHour < FIRST_NUMBER_WITH_2_CYPHERS) // Less than 2 cyphers
-        strTimestamp.Append(ZERO_STRING);
-
-    strTimestamp.Append(string_q::FromInteger(uHour));
-    strTimestamp.Append(TIME_SEPARATOR);
-
-    // Padding with zeroes
-    if(uMinute < FIRST_NUMBER_WITH_2_CYPHERS) // Less than 2 cyphers
-        strTimestamp.Append(ZERO_STRING);
-
-    strTimestamp.Append(string_q::FromInteger(uMinute));
-    strTimestamp.Append(TIME_SEPARATOR);
-
-    // Padding with zeroes
-    if(uSecond < FIRST_NUMBER_WITH_2_CYPHERS) // Less than 2 cyphers
-        strTimestamp.Append(ZERO_STRING);
-
-    strTimestamp.Append(string_q::FromInteger(uSecond));
-    
-    // Converts milliseconds, microseconds and nanoseconds to a fraction of second
-    this->_SecondFractionToString(uMillisecond, uMicrosecond, uHundredOfNanosecond, strTimestamp);
+    i8_q arTimestamp[QDateTime::TIMESTAMP_MAXIMUM_LENGTH];
+    const unsigned int TIMESTAMP_LENGTH = this->_FormatTimestamp(arTimestamp);
 
-    // Adds the time offset
-    if(m_pTimeZone == null_q)
-    {
-        strTimestamp.Append(ZULU_TIME);
-    }
-    else
-    {
-        QTimeSpan offset(0);
-        bool bIsNegative = false;
-        m_pTimeZone->CalculateOffset(*this, offset, bIsNegative);
-
-        if(bIsNegative)
-            strTimestamp.Append(NEGATIVE_SIGN);
-        else
-            strTimestamp.Append(POSITIVE_SIGN);
-
-        static const unsigned int MINUTES_PER_HOUR = 60;
-        const unsigned int OFFSET_HOURS = offset.GetHours();
-        const unsigned int OFFSET_MINUTES = offset.GetMinutes() % MINUTES_PER_HOUR;
-
-        // Padding with zeroes
-        if(OFFSET_HOURS < FIRST_NUMBER_WITH_2_CYPHERS) // Less than 2 cyphers
-            strTimestamp.Append(ZERO_STRING);
-
-        strTimestamp.Append(string_q::FromInteger(OFFSET_HOURS));
-        strTimestamp.Append(TIME_SEPARATOR);
-
-        // Padding with zeroes
-        if(OFFSET_MINUTES < FIRST_NUMBER_WITH_2_CYPHERS) // Less than 2 cyphers
-            strTimestamp.Append(ZERO_STRING);
-
-        strTimestamp.Append(string_q::FromInteger(OFFSET_MINUTES));
-    }
-
-    return strTimestamp;
+    return string_q(arTimestamp, scast_q(TIMESTAMP_LENGTH, int));
 }
 
-void QDateTime::_SecondFractionToString(const unsigned int uMillisecond, const unsigned int uMicrosecond, const unsigned int uHundredOfNanosecond, string_q &strTimestamp) const
+unsigned int QDateTime::ToString(i8_q* arTimestamp) const
 {
-    static const string_q SECOND_FRACTION_SEPARATOR1 = ".";
-    static const string_q ZERO_STRING = "0";
-    static const string_q THREE_ZERO_STRING = "000";
-    static const string_q SIX_ZERO_STRING = "000000";
-    bool bHasFraction = false;
-
-    if(uMillisecond > 0)
-    {
-        // Has milliseconds
-        bHasFraction = true;
-        strTimestamp.Append(SECOND_FRACTION_SEPARATOR1);
-
-        const string_q& strMillisecond = string_q::FromInteger(uMillisecond);
-
-        const unsigned int MILLISECOND_LENGTH = strMillisecond.GetLength();
-
-        for(unsigned int i = 0; i < 3U - MILLISECOND_LENGTH; ++i)
-            strTimestamp.Append(ZERO_STRING);
+    QE_ASSERT_ERROR(arTimestamp != null_q, "The output array must not be null.");
 
-        strTimestamp.Append(strMillisecond);
-
-        if(uMicrosecond > 0)
-        {
-            // Has milliseconds and microseconds
-            const string_q& strMicrosecond = string_q::FromInteger(uMicrosecond);
+    return this->_FormatTimestamp(arTimestamp);
+}
 
-            const unsigned int MICROSECOND_LENGTH = strMicrosecond.GetLength();
+unsigned int QDateTime::ToString(u16_q* arTimestamp) const
+{
+    QE_ASSERT_ERROR(arTimestamp != null_q, "The output array must not be null.");
 
-            for(unsigned int i = 0; i < 3U - MICROSECOND_LENGTH; ++i)
-                strTimestamp.Append(ZERO_STRING);
+    return this->_FormatTimestamp(arTimestamp);
+}
 
-            strTimestamp.Append(strMicrosecond);
+void QDateTime::ParseTimestamps(const i8_q* const* arTimestamps, const unsigned int* arLengths, const unsigned int uCount, QDateTime* arDateTimes)
+{
+    QE_ASSERT_ERROR(arTimestamps != null_q, "The input list of timestamps must not be null.");
+    QE_ASSERT_ERROR(arLengths != null_q, "The input list of lengths must not be null.");
+    QE_ASSERT_ERROR(arDateTimes != null_q, "The output array must not be null.");
 
-            if(uHundredOfNanosecond > 0)
-            {
-                // Has milliseconds, microseconds and hundreds of nanoseconds
-                strTimestamp.Append(string_q::FromInteger(uHundredOfNanosecond));
-            }
-        }
-        else
-        {
-            if(uHundredOfNanosecond > 0)
-            {
-                // Has milliseconds and hundreds of nanoseconds, no microseconds
-                strTimestamp.Append(THREE_ZERO_STRING);
-                strTimestamp.Append(string_q::FromInteger(uHundredOfNanosecond));
-            }
-        }
-    }
-    else
+    for(unsigned int i = 0; i < uCount; ++i)
     {
-        if(uMicrosecond > 0)
-        {
-            // Has microseconds, no milliseconds
-            bHasFraction = true;
-            strTimestamp.Append(SECOND_FRACTION_SEPARATOR1);
-            strTimestamp.Append(THREE_ZERO_STRING);
-
-            const string_q& strMicrosecond = string_q::FromInteger(uMicrosecond);
-
-            const unsigned int MICROSECOND_LENGTH = strMicrosecond.GetLength();
-
-            for(unsigned int i = 0; i < 3U - MICROSECOND_LENGTH; ++i)
-                strTimestamp.Append(ZERO_STRING);
+        QE_ASSERT_ERROR(arTimestamps[i] != null_q, "The input timestamps must not be null.");
 
-            strTimestamp.Append(strMicrosecond);
-
-            if(uHundredOfNanosecond > 0)
-            {
-                // Has microseconds and hundreds of nanoseconds, no milliseconds
-                strTimestamp.Append(string_q::FromInteger(uHundredOfNanosecond));
-            }
-        }
-        else
-        {
-            if(uHundredOfNanosecond > 0)
-            {
-                // Has hundreds of nanoseconds, no milliseconds, no microseconds
-                bHasFraction = true;
-                strTimestamp.Append(SECOND_FRACTION_SEPARATOR1);
-                strTimestamp.Append(SIX_ZERO_STRING);
-                strTimestamp.Append(string_q::FromInteger(uHundredOfNanosecond));
-            }
-        }
+        arDateTimes[i]._ParseTimestamp(arTimestamps[i], arLengths[i]);
     }
+}
 
-    if(bHasFraction)
-    {
-        // Removes last zeroes
-        static const char_q CHARACTER_ZERO = '0';
-        unsigned int uNumberOfZeroesToRemove = 0;
-
-        string_q::QConstCharIterator it = strTimestamp.GetConstCharIterator();
-        it.MoveLast();
-
-        while(!it.IsEnd() && it.GetChar() == CHARACTER_ZERO)
-        {
-            --it;
-            ++uNumberOfZeroesToRemove ;
-        }
+void QDateTime::FormatTimestamps(const QDateTime* arDateTimes, const unsigned int uCount, i8_q* arTimestamps, unsigned int* arLengths)
+{
+    QE_ASSERT_ERROR(arDateTimes != null_q, "The input list of date/time instances must not be null.");
+    QE_ASSERT_ERROR(arTimestamps != null_q, "The output array must not be null.");
+    QE_ASSERT_ERROR(arLengths != null_q, "The output array of lengths must not be null.");
 
-        if(uNumberOfZeroesToRemove > 0)
-            strTimestamp = strTimestamp.Substring(0, strTimestamp.GetLength() - 1U - uNumberOfZeroesToRemove);
-    }
+    for(unsigned int i = 0; i < uCount; ++i)
+        arLengths[i] = arDateTimes[i]._FormatTimestamp(arTimestamps + i * QDateTime::TIMESTAMP_MAXIMUM_LENGTH);
 }
 
 void QDateTime::Decompose(unsigned int &uYear, unsigned int &uMonth, unsigned int &uDay, unsigned int &uHour, unsigned int &uMinute, unsigned int &uSecond, 
@@ -924,6 +674,17 @@ void QDateTime::Decompose(unsigned int &uYear, unsigned int &uMonth, unsigned in
 {
     QE_ASSERT_ERROR(!this->IsUndefined(), "The date / time is undefined");
 
+    // Adds the time zone offset
+    QTimeSpan localTimeInstant = m_pTimeZone == null_q ? m_instant :
+                                                         this->_GetInstantWithAddedTimeZoneOffset(m_instant, m_pTimeZone);
+
+    QDateTime::_DecomposeInstant(localTimeInstant, uYear, uMonth, uDay, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond);
+}
+
+void QDateTime::DecomposeDate(unsigned int &uYear, unsigned int &uMonth, unsigned int &uDay) const
+{
+    QE_ASSERT_ERROR(!this->IsUndefined(), "The date is undefined");
+
     // Adds the time zone offset
     QTimeSpan localTimeInstant = m_pTimeZone == null_q ? m_instant :
                                                          this->_GetInstantWithAddedTimeZoneOffset(m_instant, m_pTimeZone);
@@ -1051,12 +812,6 @@ void QDateTime::Decompose(unsigned int &uYear, unsigned int &uMonth, unsigned in
         // Shourcut, it is the first instant of the year
         uMonth = 1;
         uDay = 1;
-        uHour = 0;
-        uMinute = 0;
-        uSecond = 0;
-        uMillisecond = 0;
-        uMicrosecond = 0;
-        uHundredOfNanosecond = 0;
     }
     else
     {
@@ -1086,29 +841,12 @@ void QDateTime::Decompose(unsigned int &uYear, unsigned int &uMonth, unsigned in
         
         uMonth = uMonthCounter;
         uDay = scast_q(uDaysInLastYear, unsigned int) + 1;
-
-        u64_q uHoursInLastDay = uHnsInLastYear % _HNS_PER_DAY;
-        uHour = scast_q(uHoursInLastDay / _HNS_PER_HOUR, unsigned int);
-
-        u64_q uMinutesInLastHour = uHoursInLastDay % _HNS_PER_HOUR;
-        uMinute = scast_q(uMinutesInLastHour / _HNS_PER_MINUTE, unsigned int);
-
-        u64_q uSecondsInLastMinute = uMinutesInLastHour % _HNS_PER_MINUTE;
-        uSecond = scast_q(uSecondsInLastMinute / _HNS_PER_SECOND, unsigned int);
-
-        u64_q uMillisecondsInLastSecond = uSecondsInLastMinute % _HNS_PER_SECOND;
-        uMillisecond = scast_q(uMillisecondsInLastSecond / _HNS_PER_MILLISECOND, unsigned int);
-
-        u64_q uMicrosecondsInLastMillisecond = uMillisecondsInLastSecond % _HNS_PER_MILLISECOND;
-        uMicrosecond = scast_q(uMicrosecondsInLastMillisecond / _HNS_PER_MICROSECOND, unsigned int);
-
-        uHundredOfNanosecond = scast_q(uMicrosecondsInLastMillisecond % _HNS_PER_MICROSECOND, unsigned int);
     }
 }
 
-void QDateTime::DecomposeDate(unsigned int &uYear, unsigned int &uMonth, unsigned int &uDay) const
+void QDateTime::DecomposeTime(unsigned int &uHour, unsigned int &uMinute, unsigned int &uSecond) const
 {
-    QE_ASSERT_ERROR(!this->IsUndefined(), "The date is undefined");
+    QE_ASSERT_ERROR(!this->IsUndefined(), "The time is undefined");
 
     // Adds the time zone offset
     QTimeSpan localTimeInstant = m_pTimeZone == null_q ? m_instant :
@@ -1230,13 +968,12 @@ void QDateTime::DecomposeDate(unsigned int &uYear, unsigned int &uMonth, unsigne
         }
     }
 
-    uYear = scast_q(uYearProvisional, unsigned int);
-
     if(uHnsInLastYear == 0)
     {
         // Shourcut, it is the first instant of the year
-        uMonth = 1;
-        uDay = 1;
+        uHour = 0;
+        uMinute = 0;
+        uSecond = 0;
     }
     else
     {
@@ -1248,28 +985,20 @@ void QDateTime::DecomposeDate(unsigned int &uYear, unsigned int &uMonth, unsigne
             else
                 uHnsInLastYear = QDateTime::_HNS_PER_YEAR - uHnsInLastYear;
         }
+        
+        u64_q uHoursInLastDay = uHnsInLastYear % _HNS_PER_DAY;
+        uHour = scast_q(uHoursInLastDay / _HNS_PER_HOUR, unsigned int);
 
-        u64_q uDaysInLastYear = uHnsInLastYear / QDateTime::_HNS_PER_DAY;
-
-        static const unsigned int FIRST_MONTH_OF_THE_YEAR = 1;
-        static const unsigned int LAST_MONTH_OF_THE_YEAR  = 12;
-
-        unsigned int uMonthCounter = FIRST_MONTH_OF_THE_YEAR;
+        u64_q uMinutesInLastHour = uHoursInLastDay % _HNS_PER_HOUR;
+        uMinute = scast_q(uMinutesInLastHour / _HNS_PER_MINUTE, unsigned int);
 
-        // For every month in the year, we subtract its number of days while the days in the current month
-        // are lower than or equal to the remaining days
-        while(uMonthCounter <= LAST_MONTH_OF_THE_YEAR && QDateTime::GetDaysInMonth(uMonthCounter, scast_q(uYearProvisional, int)) <= uDaysInLastYear)
-        {
-            uDaysInLastYear -= QDateTime::GetDaysInMonth(uMonthCounter, scast_q(uYearProvisional, int));
-            uMonthCounter++;
-        }
-        
-        uMonth = uMonthCounter;
-        uDay = scast_q(uDaysInLastYear, unsigned int) + 1;
+        u64_q uSecondsInLastMinute = uMinutesInLastHour % _HNS_PER_MINUTE;
+        uSecond = scast_q(uSecondsInLastMinute / _HNS_PER_SECOND, unsigned int);
     }
 }
 
-void QDateTime::DecomposeTime(unsigned int &uHour, unsigned int &uMinute, unsigned int &uSecond) const
+void QDateTime::DecomposeTime(unsigned int &uHour, unsigned int &uMinute, unsigned int &uSecond, unsigned int &uMillisecond, 
+                              unsigned int &uMicrosecond, unsigned int &uHundredOfNanosecond) const
 {
     QE_ASSERT_ERROR(!this->IsUndefined(), "The time is undefined");
 
@@ -1399,6 +1128,9 @@ void QDateTime::DecomposeTime(unsigned int &uHour, unsigned int &uMinute, unsign
         uHour = 0;
         uMinute = 0;
         uSecond = 0;
+        uMillisecond = 0;
+        uMicrosecond = 0;
+        uHundredOfNanosecond = 0;
     }
     else
     {
@@ -1410,7 +1142,7 @@ void QDateTime::DecomposeTime(unsigned int &uHour, unsigned int &uMinute, unsign
             else
                 uHnsInLastYear = QDateTime::_HNS_PER_YEAR - uHnsInLastYear;
         }
-        
+
         u64_q uHoursInLastDay = uHnsInLastYear % _HNS_PER_DAY;
         uHour = scast_q(uHoursInLastDay / _HNS_PER_HOUR, unsigned int);
 
@@ -1419,18 +1151,21 @@ void QDateTime::DecomposeTime(unsigned int &uHour, unsigned int &uMinute, unsign
 
         u64_q uSecondsInLastMinute = uMinutesInLastHour % _HNS_PER_MINUTE;
         uSecond = scast_q(uSecondsInLastMinute / _HNS_PER_SECOND, unsigned int);
+
+        u64_q uMillisecondsInLastSecond = uSecondsInLastMinute % _HNS_PER_SECOND;
+        uMillisecond = scast_q(uMillisecondsInLastSecond / _HNS_PER_MILLISECOND, unsigned int);
+
+        u64_q uMicrosecondsInLastMillisecond = uMillisecondsInLastSecond % _HNS_PER_MILLISECOND;
+        uMicrosecond = scast_q(uMicrosecondsInLastMillisecond / _HNS_PER_MICROSECOND, unsigned int);
+
+        uHundredOfNanosecond = scast_q(uMicrosecondsInLastMillisecond % _HNS_PER_MICROSECOND, unsigned int);
     }
 }
 
-void QDateTime::DecomposeTime(unsigned int &uHour, unsigned int &uMinute, unsigned int &uSecond, unsigned int &uMillisecond, 
-                              unsigned int &uMicrosecond, unsigned int &uHundredOfNanosecond) const
+void QDateTime::_DecomposeInstant(const QTimeSpan &localTimeInstant, unsigned int &uYear, unsigned int &uMonth, unsigned int &uDay, 
+                                  unsigned int &uHour, unsigned int &uMinute, unsigned int &uSecond, 
+                                  unsigned int &uMillisecond, unsigned int &uMicrosecond, unsigned int &uHundredOfNanosecond)
 {
-    QE_ASSERT_ERROR(!this->IsUndefined(), "The time is undefined");
-
-    // Adds the time zone offset
-    QTimeSpan localTimeInstant = m_pTimeZone == null_q ? m_instant :
-                                                         this->_GetInstantWithAddedTimeZoneOffset(m_instant, m_pTimeZone);
-
     const u64_q HNS_IN_INSTANT = localTimeInstant.GetHundredsOfNanoseconds();
 
     const bool IS_NEGATIVE_DATE = HNS_IN_INSTANT < QDateTime::_HALF_VALUE;
@@ -1547,9 +1282,13 @@ void QDateTime::DecomposeTime(unsigned int &uHour, unsigned int &uMinute, unsign
         }
     }
 
+    uYear = scast_q(uYearProvisional, unsigned int);
+
     if(uHnsInLastYear == 0)
     {
         // Shourcut, it is the first instant of the year
+        uMonth = 1;
+        uDay = 1;
         uHour = 0;
         uMinute = 0;
         uSecond = 0;
@@ -1568,6 +1307,24 @@ void QDateTime::DecomposeTime(unsigned int &uHour, unsigned int &uMinute, unsign
                 uHnsInLastYear = QDateTime::_HNS_PER_YEAR - uHnsInLastYear;
         }
 
+        u64_q uDaysInLastYear = uHnsInLastYear / QDateTime::_HNS_PER_DAY;
+
+        static const unsigned int FIRST_MONTH_OF_THE_YEAR = 1;
+        static const unsigned int LAST_MONTH_OF_THE_YEAR  = 12;
+
+        unsigned int uMonthCounter = FIRST_MONTH_OF_THE_YEAR;
+
+        // For every month in the year, we subtract its number of days while the days in the current month
+        // are lower than or equal to the remaining days
+        while(uMonthCounter <= LAST_MONTH_OF_THE_YEAR && QDateTime::GetDaysInMonth(uMonthCounter, scast_q(uYearProvisional, int)) <= uDaysInLastYear)
+        {
+            uDaysInLastYear -= QDateTime::GetDaysInMonth(uMonthCounter, scast_q(uYearProvisional, int));
+            uMonthCounter++;
+        }
+        
+        uMonth = uMonthCounter;
+        uDay = scast_q(uDaysInLastYear, unsigned int) + 1;
+
         u64_q uHoursInLastDay = uHnsInLastYear % _HNS_PER_DAY;
         uHour = scast_q(uHoursInLastDay / _HNS_PER_HOUR, unsigned int);
 
@@ -1630,35 +1387,137 @@ QTimeSpan QDateTime::_GetInstantWithAddedTimeZoneOffset(const QTimeSpan &instant
 }
 
 
-void QDateTime::_ParseTimestampCompleteDate(const string_q &strTimestamp, const u32_q uTPosition, i32_q &nYear, u32_q &uMonth, u32_q &uDay) const
+template<class CharT>
+void QDateTime::_ParseTimestamp(const CharT* arTimestamp, const unsigned int uLength)
+{
+    static const char DATE_SEPARATOR = '-';
+    static const char TIME_START_SEPARATOR = 'T';
+    static const char POSITIVE_SIGN = '+';
+    static const char NEGATIVE_SIGN = '-';
+    static const char WHITESPACE = ' ';
+
+    QE_ASSERT_ERROR(uLength > 0, "The input timestamp must not be empty.");
+    QE_ASSERT_ERROR(QDateTime::_FindCharacter(arTimestamp, 0, uLength, WHITESPACE) == uLength, "The input timestamp must not contain whitespaces.");
+
+    i32_q nYear, nOffsetHours;
+    u32_q uMonth, uDay, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, uOffsetMinutes;
+
+    const u32_q TIME_POSITION = QDateTime::_FindCharacter(arTimestamp, 0, uLength, TIME_START_SEPARATOR);
+
+    if(TIME_POSITION != uLength)
+    {
+        // The timestamp combines Date and Time
+
+        QDateTime::_ParseTimestampCompleteDate(arTimestamp, TIME_POSITION, nYear, uMonth, uDay);
+        QDateTime::_ParseTimestampCompleteTime(arTimestamp, uLength, TIME_POSITION, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, nOffsetHours, uOffsetMinutes);
+
+        // The date and time is constructed
+        *this = QDateTime(nYear, uMonth, uDay, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, QTimeZone::UTC);
+
+        this->_ApplyOffsetToTimestamp(nOffsetHours, uOffsetMinutes, uHour, uMinute, *this);
+    }
+    else
+    {
+        // The timestamp contains either Date or Time information only
+
+        if(arTimestamp[0] == POSITIVE_SIGN || arTimestamp[0] == NEGATIVE_SIGN)
+        {
+            // It is preceeded by a sign, so it must be a date
+
+            const u32_q SEPARATOR_POSITION = QDateTime::_FindCharacter(arTimestamp, 1U, uLength, DATE_SEPARATOR); // Starts from 1 to skip the sign
+
+            if(SEPARATOR_POSITION != uLength)
+                QDateTime::_ParseTimestampIncompleteDateWithSeparators(arTimestamp, uLength, SEPARATOR_POSITION, nYear, uMonth, uDay);
+            else
+                QDateTime::_ParseTimestampIncompleteDateWithoutSeparators(arTimestamp, uLength, nYear, uMonth, uDay);
+
+            *this = QDateTime(nYear, uMonth, uDay, QTimeZone::UTC);
+        }
+        else
+        {
+            // It is not preceded by a sign, so it may be either a date or a time
+
+            const u32_q FIRST_SEPARATOR_POSITION = QDateTime::_FindCharacter(arTimestamp, 0, uLength, DATE_SEPARATOR);
+            const u32_q SECOND_SEPARATOR_POSITION = FIRST_SEPARATOR_POSITION == uLength ? uLength :
+                                                                                          QDateTime::_FindCharacter(arTimestamp, FIRST_SEPARATOR_POSITION + 1U, uLength, DATE_SEPARATOR);
+
+            if(SECOND_SEPARATOR_POSITION != uLength)
+            {
+                // It contains 2 hyphens, it must be a date
+                QDateTime::_ParseTimestampIncompleteDateWithSeparators(arTimestamp, uLength, FIRST_SEPARATOR_POSITION, nYear, uMonth, uDay);
+                *this = QDateTime(nYear, uMonth, uDay, QTimeZone::UTC);
+            }
+            else
+            {
+                // It is interpreted as time by default, even if it does not contain colons (if there is a hyphen, it is considered a minus sign of the time offset instead of a date seprator)
+                QDateTime::_ParseTimestampIncompleteTime(arTimestamp, uLength, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, nOffsetHours, uOffsetMinutes);
+                *this = QDateTime(uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond, QTimeZone::UTC);
+                this->_ApplyOffsetToTimestampWithoutAffectingDate(nOffsetHours, uOffsetMinutes, uHour, uMinute, *this);
+            }
+        }
+    }
+}
+
+template<class CharT>
+unsigned int QDateTime::_FindCharacter(const CharT* arTimestamp, const unsigned int uStart, const unsigned int uEnd, const char cCharacter)
+{
+    unsigned int uPosition = uStart;
+
+    while(uPosition < uEnd && arTimestamp[uPosition] != scast_q(cCharacter, CharT))
+        ++uPosition;
+
+    return uPosition < uEnd ? uPosition : uEnd;
+}
+
+template<class CharT>
+i64_q QDateTime::_ParseInteger(const CharT* arTimestamp, const unsigned int uStart, const unsigned int uEnd, const unsigned int uLimit)
 {
-    static const char_q DATE_SEPARATOR = '-';
+    static const char POSITIVE_SIGN = '+';
+    static const char NEGATIVE_SIGN = '-';
+    static const char CHARACTER_ZERO = '0';
+    static const char CHARACTER_NINE = '9';
+
+    const unsigned int END_POSITION = uEnd < uLimit ? uEnd : uLimit;
+    unsigned int uPosition = uStart;
+    bool bIsNegative = false;
+
+    if(uPosition < END_POSITION && (arTimestamp[uPosition] == POSITIVE_SIGN || arTimestamp[uPosition] == NEGATIVE_SIGN))
+    {
+        bIsNegative = arTimestamp[uPosition] == NEGATIVE_SIGN;
+        ++uPosition;
+    }
+
+    i64_q nResult = 0;
 
-    // Gets the Date part only
-    const string_q& DATE_PART = strTimestamp.Substring(0, uTPosition - 1);
+    while(uPosition < END_POSITION && arTimestamp[uPosition] >= CHARACTER_ZERO && arTimestamp[uPosition] <= CHARACTER_NINE)
+    {
+        nResult = nResult * 10 + scast_q(arTimestamp[uPosition] - CHARACTER_ZERO, i64_q);
+        ++uPosition;
+    }
 
-    const int FIRST_SEPARATOR_POSITION = DATE_PART.IndexOf(DATE_SEPARATOR, 1U, EQComparisonType::E_BinaryCaseSensitive); // Starts from 1 because it may have a "-" sign at the beginning
+    return bIsNegative ? -nResult : nResult;
+}
 
-    if(FIRST_SEPARATOR_POSITION != string_q::PATTERN_NOT_FOUND)
+template<class CharT>
+void QDateTime::_ParseTimestampCompleteDate(const CharT* arTimestamp, const u32_q uTPosition, i32_q &nYear, u32_q &uMonth, u32_q &uDay)
+{
+    static const char DATE_SEPARATOR = '-';
+
+    const u32_q FIRST_SEPARATOR_POSITION = QDateTime::_FindCharacter(arTimestamp, 1U, uTPosition, DATE_SEPARATOR); // Starts from 1 because it may have a "-" sign at the beginning
+
+    if(FIRST_SEPARATOR_POSITION != uTPosition)
     {
         // The date uses separators (YYYYY-MM-DD)
-        const string_q& YEAR_PART  = DATE_PART.Substring(0,                            FIRST_SEPARATOR_POSITION - 1);
-        const string_q& MONTH_PART = DATE_PART.Substring(FIRST_SEPARATOR_POSITION + 1, FIRST_SEPARATOR_POSITION + 2);
-        const string_q& DAY_PART   = DATE_PART.Substring(FIRST_SEPARATOR_POSITION + 4, FIRST_SEPARATOR_POSITION + 5);
-        nYear  = scast_q(YEAR_PART.ToInteger(),  i32_q);
-        uMonth = scast_q(MONTH_PART.ToInteger(), u32_q);
-        uDay   = scast_q(DAY_PART.ToInteger(),   u32_q);
+        nYear  = scast_q(QDateTime::_ParseInteger(arTimestamp, 0,                            FIRST_SEPARATOR_POSITION,      uTPosition), i32_q);
+        uMonth = scast_q(QDateTime::_ParseInteger(arTimestamp, FIRST_SEPARATOR_POSITION + 1U, FIRST_SEPARATOR_POSITION + 3U, uTPosition), u32_q);
+        uDay   = scast_q(QDateTime::_ParseInteger(arTimestamp, FIRST_SEPARATOR_POSITION + 4U, FIRST_SEPARATOR_POSITION + 6U, uTPosition), u32_q);
     }
     else
     {
         // The date does not use separators (YYYYYMMDD)
-        unsigned int uLength = DATE_PART.GetLength();
-        const string_q& DAY_PART   = DATE_PART.Substring(uLength - 2U, uLength - 1U);
-        const string_q& MONTH_PART = DATE_PART.Substring(uLength - 4U, uLength - 3U);
-        const string_q& YEAR_PART  = DATE_PART.Substring(0,            uLength - 5U);
-        nYear  = scast_q(YEAR_PART.ToInteger(),  i32_q);
-        uMonth = scast_q(MONTH_PART.ToInteger(), u32_q);
-        uDay   = scast_q(DAY_PART.ToInteger(),   u32_q);
+        nYear  = scast_q(QDateTime::_ParseInteger(arTimestamp, 0,               uTPosition - 4U, uTPosition), i32_q);
+        uMonth = scast_q(QDateTime::_ParseInteger(arTimestamp, uTPosition - 4U, uTPosition - 2U, uTPosition), u32_q);
+        uDay   = scast_q(QDateTime::_ParseInteger(arTimestamp, uTPosition - 2U, uTPosition,      uTPosition), u32_q);
     }
 
     // -0000 represents the year 1 BC, or -1, so it must be adjusted
@@ -1666,65 +1525,52 @@ void QDateTime::_ParseTimestampCompleteDate(const string_q &strTimestamp, const
         nYear -= 1;
 }
 
-void QDateTime::_ParseTimestampCompleteTime(const string_q &strTimestamp, const u32_q uTPosition, u32_q &uHour, u32_q &uMinute, u32_q &uSecond, u32_q &uMillisecond, u32_q &uMicrosecond, u32_q &uHundredOfNanosecond, i32_q &nOffsetHours, u32_q& uOffsetMinutes) const
+template<class CharT>
+void QDateTime::_ParseTimestampCompleteTime(const CharT* arTimestamp, const u32_q uLength, const u32_q uTPosition, u32_q &uHour, u32_q &uMinute, u32_q &uSecond, u32_q &uMillisecond, 
+                                            u32_q &uMicrosecond, u32_q &uHundredOfNanosecond, i32_q &nOffsetHours, u32_q& uOffsetMinutes)
 {
-    static const char_q SECOND_FRACTION_SEPARATOR1 = '.';
-    static const char_q SECOND_FRACTION_SEPARATOR2 = ',';
-    static const char_q POSITIVE_SIGN = '+';
-    static const char_q NEGATIVE_SIGN = '-';
-    static const char_q ZULU_TIME = 'Z';
-
-    const unsigned int FIRST_TIME_POSITION = uTPosition + 1U;
+    static const char SECOND_FRACTION_SEPARATOR1 = '.';
+    static const char SECOND_FRACTION_SEPARATOR2 = ',';
+    static const char POSITIVE_SIGN = '+';
+    static const char NEGATIVE_SIGN = '-';
+    static const char ZULU_TIME = 'Z';
 
-    const string_q& TIME_PART = strTimestamp.Substring(FIRST_TIME_POSITION, strTimestamp.GetLength());
+    const u32_q FIRST_TIME_POSITION = uTPosition + 1U;
 
     // Searches for a comma or a dot that indicate the presence of a second fraction
-    int nFractionSeparatorPosition = TIME_PART.IndexOf(SECOND_FRACTION_SEPARATOR1, EQComparisonType::E_BinaryCaseSensitive);
-    if(nFractionSeparatorPosition == string_q::PATTERN_NOT_FOUND)
-    {
-        nFractionSeparatorPosition = TIME_PART.IndexOf(SECOND_FRACTION_SEPARATOR2, EQComparisonType::E_BinaryCaseSensitive);
-    }
+    u32_q uFractionSeparatorPosition = QDateTime::_FindCharacter(arTimestamp, FIRST_TIME_POSITION, uLength, SECOND_FRACTION_SEPARATOR1);
+
+    if(uFractionSeparatorPosition == uLength)
+        uFractionSeparatorPosition = QDateTime::_FindCharacter(arTimestamp, FIRST_TIME_POSITION, uLength, SECOND_FRACTION_SEPARATOR2);
+
+    // Searches for a positive or a negative sign
+    u32_q uSignPosition = QDateTime::_FindCharacter(arTimestamp, FIRST_TIME_POSITION, uLength, POSITIVE_SIGN);
+
+    if(uSignPosition == uLength)
+        uSignPosition = QDateTime::_FindCharacter(arTimestamp, FIRST_TIME_POSITION, uLength, NEGATIVE_SIGN);
+
+    // If Z exists, the last position of the time part is one position before
+    const u32_q TIME_END_POSITION = arTimestamp[uLength - 1U] == ZULU_TIME ? uLength - 1U : uLength;
 
-    if(nFractionSeparatorPosition != string_q::PATTERN_NOT_FOUND)
+    if(uFractionSeparatorPosition != uLength)
     {
         // Contains a fraction
 
-        const string_q& TIME_WITHOUT_FRACTION = TIME_PART.Substring(0, nFractionSeparatorPosition - 1);
-        this->_ParseTimestampCompleteTimePart(TIME_WITHOUT_FRACTION, uHour, uMinute, uSecond);
+        QDateTime::_ParseTimestampCompleteTimePart(arTimestamp, FIRST_TIME_POSITION, uFractionSeparatorPosition, uHour, uMinute, uSecond);
 
-        // Searches for a positive or a negative sign
-        int nSignPosition = TIME_PART.IndexOf(POSITIVE_SIGN, EQComparisonType::E_BinaryCaseSensitive);
-        if(nSignPosition == string_q::PATTERN_NOT_FOUND)
-        {
-            nSignPosition = TIME_PART.IndexOf(NEGATIVE_SIGN, EQComparisonType::E_BinaryCaseSensitive);
-        }
-
-        if(nSignPosition != string_q::PATTERN_NOT_FOUND)
+        if(uSignPosition != uLength)
         {
             // Contains a positive or negative sign
-
-            const string_q& TIME_FRACTION = TIME_PART.Substring(nFractionSeparatorPosition + 1, nSignPosition - 1);
-            this->_ParseTimestampTimeFraction(TIME_FRACTION, uMillisecond, uMicrosecond, uHundredOfNanosecond);
-            const string_q& TIME_OFFSET = TIME_PART.Substring(nSignPosition, TIME_PART.GetLength() - 1U);
-            this->_ParseTimestampTimeOffset(TIME_OFFSET, nOffsetHours, uOffsetMinutes);
+            QDateTime::_ParseTimestampTimeFraction(arTimestamp, uFractionSeparatorPosition + 1U, uSignPosition, uMillisecond, uMicrosecond, uHundredOfNanosecond);
+            QDateTime::_ParseTimestampTimeOffset(arTimestamp, uSignPosition, uLength, nOffsetHours, uOffsetMinutes);
         }
         else
         {
             // Does not contain a positive or negative sign
-
             nOffsetHours   = 0;
             uOffsetMinutes = 0;
 
-            // Searches for a Z at the end
-            unsigned int uLastPosition = TIME_PART.GetLength() - 1U;
-            const string_q& LAST_CHAR = TIME_PART[uLastPosition];
-
-            // If Z exists, the last position of the time part is one position before
-            if(LAST_CHAR == ZULU_TIME)
-                --uLastPosition;
-
-            const string_q& TIME_FRACTION = TIME_PART.Substring(nFractionSeparatorPosition + 1, uLastPosition);
-            this->_ParseTimestampTimeFraction(TIME_FRACTION, uMillisecond, uMicrosecond, uHundredOfNanosecond);
+            QDateTime::_ParseTimestampTimeFraction(arTimestamp, uFractionSeparatorPosition + 1U, TIME_END_POSITION, uMillisecond, uMicrosecond, uHundredOfNanosecond);
         }
     }
     else
@@ -1734,21 +1580,11 @@ void QDateTime::_ParseTimestampCompleteTime(const string_q &strTimestamp, const
         uMicrosecond = 0;
         uHundredOfNanosecond = 0;
 
-        // Searches for a positive or a negative sign
-        int nSignPosition = TIME_PART.IndexOf(POSITIVE_SIGN, EQComparisonType::E_BinaryCaseSensitive);
-        if(nSignPosition == string_q::PATTERN_NOT_FOUND)
-        {
-            nSignPosition = TIME_PART.IndexOf(NEGATIVE_SIGN, EQComparisonType::E_BinaryCaseSensitive);
-        }
-
-        if(nSignPosition != string_q::PATTERN_NOT_FOUND)
+        if(uSignPosition != uLength)
         {
             // Contains a positive or negative sign
-            const string_q& TIME_WITHOUT_OFFSET = TIME_PART.Substring(0, nSignPosition - 1);
-            this->_ParseTimestampCompleteTimePart(TIME_WITHOUT_OFFSET, uHour, uMinute, uSecond);
-
-            const string_q& TIME_OFFSET = TIME_PART.Substring(nSignPosition, TIME_PART.GetLength() - 1U);
-            this->_ParseTimestampTimeOffset(TIME_OFFSET, nOffsetHours, uOffsetMinutes);
+            QDateTime::_ParseTimestampCompleteTimePart(arTimestamp, FIRST_TIME_POSITION, uSignPosition, uHour, uMinute, uSecond);
+            QDateTime::_ParseTimestampTimeOffset(arTimestamp, uSignPosition, uLength, nOffsetHours, uOffsetMinutes);
         }
         else
         {
@@ -1756,57 +1592,41 @@ void QDateTime::_ParseTimestampCompleteTime(const string_q &strTimestamp, const
             nOffsetHours   = 0;
             uOffsetMinutes = 0;
 
-            // Searches for a Z at the end
-            unsigned int uLastPosition = TIME_PART.GetLength() - 1U;
-            const string_q& LAST_CHAR = TIME_PART.Substring(uLastPosition, uLastPosition);
-
-            // If Z exists, the last position of the time part is one position before
-            if(LAST_CHAR == ZULU_TIME)
-                --uLastPosition;
-
-            this->_ParseTimestampCompleteTimePart(TIME_PART.Substring(0, uLastPosition), uHour, uMinute, uSecond);
+            QDateTime::_ParseTimestampCompleteTimePart(arTimestamp, FIRST_TIME_POSITION, TIME_END_POSITION, uHour, uMinute, uSecond);
         }
     }
 }
 
-void QDateTime::_ParseTimestampCompleteTimePart(const string_q& strTimeWithoutFraction, u32_q& uHour, u32_q& uMinute, u32_q& uSecond) const
+template<class CharT>
+void QDateTime::_ParseTimestampCompleteTimePart(const CharT* arTimestamp, const u32_q uStart, const u32_q uEnd, u32_q& uHour, u32_q& uMinute, u32_q& uSecond)
 {
-    static const char_q TIME_SEPARATOR = ':';
+    static const char TIME_SEPARATOR = ':';
 
     // Calculates the separator space to be skipped in the next operation, depending on whether it exists or not
-    u32_q uSeparatorSpace = 0;
-
-    if(strTimeWithoutFraction.IndexOf(TIME_SEPARATOR, EQComparisonType::E_BinaryCaseSensitive) != string_q::PATTERN_NOT_FOUND)
-        uSeparatorSpace = 1U;
+    const u32_q SEPARATOR_SPACE = QDateTime::_FindCharacter(arTimestamp, uStart, uEnd, TIME_SEPARATOR) != uEnd ? 1U : 0;
 
-    const string_q& HOUR   = strTimeWithoutFraction.Substring(0, 1U);
-    const string_q& MINUTE = strTimeWithoutFraction.Substring(2U + uSeparatorSpace, 3U + uSeparatorSpace);
-    const string_q& SECOND = strTimeWithoutFraction.Substring(4U + uSeparatorSpace * 2U, 5U + uSeparatorSpace * 2U);
-
-    uHour   = scast_q(HOUR.ToInteger(),   u32_q);
-    uMinute = scast_q(MINUTE.ToInteger(), u32_q);
-    uSecond = scast_q(SECOND.ToInteger(), u32_q);
+    uHour   = scast_q(QDateTime::_ParseInteger(arTimestamp, uStart,                             uStart + 2U,                        uEnd), u32_q);
+    uMinute = scast_q(QDateTime::_ParseInteger(arTimestamp, uStart + 2U + SEPARATOR_SPACE,      uStart + 4U + SEPARATOR_SPACE,      uEnd), u32_q);
+    uSecond = scast_q(QDateTime::_ParseInteger(arTimestamp, uStart + 4U + SEPARATOR_SPACE * 2U, uStart + 6U + SEPARATOR_SPACE * 2U, uEnd), u32_q);
 
     // 24 is allowed in a timestamp, but not as a valid hour in this class
-    if(uHour == 24)
+    if(uHour == 24U)
         uHour = 0;
 }
 
-void QDateTime::_ParseTimestampTimeOffset(const string_q& strTimeOffset, i32_q& nOffsetHours, u32_q& uOffsetMinutes) const
+template<class CharT>
+void QDateTime::_ParseTimestampTimeOffset(const CharT* arTimestamp, const u32_q uStart, const u32_q uEnd, i32_q& nOffsetHours, u32_q& uOffsetMinutes)
 {
-    static const string_q TIME_SEPARATOR = ":";
+    static const char TIME_SEPARATOR = ':';
 
-    const string_q& HOURS = strTimeOffset.Substring(0, 2);
-    nOffsetHours = scast_q(HOURS.ToInteger(), u32_q);
+    // The sign is included
+    nOffsetHours = scast_q(QDateTime::_ParseInteger(arTimestamp, uStart, uStart + 3U, uEnd), i32_q);
 
     // If the length is greater than 3, that means that it contains more than the hour part (hh:)
-    if(strTimeOffset.GetLength() > 3)
+    if(uEnd - uStart > 3U)
     {
-        const int SEPARATOR_POSITION = strTimeOffset.IndexOf(TIME_SEPARATOR, EQComparisonType::E_BinaryCaseSensitive);
-        const u32_q SEPARATOR_WIDTH = SEPARATOR_POSITION != string_q::PATTERN_NOT_FOUND ? 1 : 0;
-
-        const string_q& MINUTES = strTimeOffset.Substring(3U + SEPARATOR_WIDTH, 4 + SEPARATOR_WIDTH);
-        uOffsetMinutes = scast_q(MINUTES.ToInteger(), u32_q);
+        const u32_q SEPARATOR_WIDTH = QDateTime::_FindCharacter(arTimestamp, uStart, uEnd, TIME_SEPARATOR) != uEnd ? 1U : 0;
+        uOffsetMinutes = scast_q(QDateTime::_ParseInteger(arTimestamp, uStart + 3U + SEPARATOR_WIDTH, uStart + 5U + SEPARATOR_WIDTH, uEnd), u32_q);
     }
     else
     {
@@ -1814,24 +1634,26 @@ void QDateTime::_ParseTimestampTimeOffset(const string_q& strTimeOffset, i32_q&
     }
 }
 
-void QDateTime::_ParseTimestampTimeFraction(const string_q& strTimeFraction, u32_q& uMillisecond, u32_q& uMicrosecond, u32_q& uHundredOfNanosecond) const
+template<class CharT>
+void QDateTime::_ParseTimestampTimeFraction(const CharT* arTimestamp, const u32_q uStart, const u32_q uEnd, u32_q& uMillisecond, u32_q& uMicrosecond, u32_q& uHundredOfNanosecond)
 {
-    static const double MAXIMUM_FRACTION_LENGTH = 7.0; // 3 numbers for milliseconds, 3 numbers for microseconds and 1 number for hundreds of nanoseconds
-    const double FRACTION_LENGTH = scast_q(strTimeFraction.GetLength(), double);
-    // Decimals must be multiplied by 10 N times depending on how many cyphers are there, regarding the maximum, which is set for hundreds of nanoseconds
-    // For example: .0132 --> 0132 * 10^3 = 132000 hundreds of nanoseconds, where N = 3 because 7(max) - 4(length) = 3
-    const unsigned int DECIMAL_OFFSET = scast_q(powl(10.0, MAXIMUM_FRACTION_LENGTH - FRACTION_LENGTH), unsigned int);
+    static const u32_q MAXIMUM_FRACTION_LENGTH = 7U; // 3 numbers for milliseconds, 3 numbers for microseconds and 1 number for hundreds of nanoseconds
+    static const u32_q DECIMAL_OFFSETS[] = { 10000000U, 1000000U, 100000U, 10000U, 1000U, 100U, 10U, 1U };
+
+    const u32_q FRACTION_LENGTH = uEnd > uStart ? uEnd - uStart : 0;
 
-    unsigned int uHundredsOfNanoseconds = 0;
+    u32_q uHundredsOfNanoseconds = 0;
 
     if(FRACTION_LENGTH > MAXIMUM_FRACTION_LENGTH)
     {
-        uHundredsOfNanoseconds = scast_q(strTimeFraction.Substring(0, scast_q(MAXIMUM_FRACTION_LENGTH, unsigned int) - 1U).ToInteger(), unsigned int);
+        uHundredsOfNanoseconds = scast_q(QDateTime::_ParseInteger(arTimestamp, uStart, uStart + MAXIMUM_FRACTION_LENGTH, uEnd), u32_q);
     }
     else
     {
-        uHundredsOfNanoseconds = scast_q(strTimeFraction.ToInteger(), unsigned int);
-        uHundredsOfNanoseconds *= DECIMAL_OFFSET;
+        // Decimals must be multiplied by 10 N times depending on how many cyphers are there, regarding the maximum, which is set for hundreds of nanoseconds
+        // For example: .0132 --> 0132 * 10^3 = 132000 hundreds of nanoseconds, where N = 3 because 7(max) - 4(length) = 3
+        uHundredsOfNanoseconds = scast_q(QDateTime::_ParseInteger(arTimestamp, uStart, uEnd, uEnd), u32_q);
+        uHundredsOfNanoseconds *= DECIMAL_OFFSETS[FRACTION_LENGTH];
     }
 
     uMillisecond = uHundredsOfNanoseconds / QDateTime::_HNS_PER_MILLISECOND;
@@ -1839,50 +1661,41 @@ void QDateTime::_ParseTimestampTimeFraction(const string_q& strTimeFraction, u32
     uHundredOfNanosecond = (uHundredsOfNanoseconds % QDateTime::_HNS_PER_MICROSECOND);
 }
 
-void QDateTime::_ParseTimestampIncompleteDateWithSeparators(const string_q &strTimestamp, const u32_q uFirstSeparatorPosition, i32_q &nYear, u32_q &uMonth, u32_q &uDay) const
+template<class CharT>
+void QDateTime::_ParseTimestampIncompleteDateWithSeparators(const CharT* arTimestamp, const u32_q uLength, const u32_q uFirstSeparatorPosition, i32_q &nYear, u32_q &uMonth, u32_q &uDay)
 {
     static const u32_q FIRST_DAY_NUMBER = 1;
     static const u32_q SEPARATOR_WIDTH = 1;
-    const string_q& YEAR = strTimestamp.Substring(0, uFirstSeparatorPosition - 1U);
-    const string_q& MONTH = strTimestamp.Substring(uFirstSeparatorPosition + SEPARATOR_WIDTH, uFirstSeparatorPosition + 2U * SEPARATOR_WIDTH);
-    nYear  = scast_q(YEAR.ToInteger(), i32_q);
-    uMonth = scast_q(MONTH.ToInteger(), u32_q);
 
-    if(strTimestamp.GetLength() > uFirstSeparatorPosition + 2U * SEPARATOR_WIDTH)
-    {
-        const string_q& DAY = strTimestamp.Substring(uFirstSeparatorPosition + 4U);
-        uDay = scast_q(DAY.ToInteger(), u32_q);
-    }
+    nYear  = scast_q(QDateTime::_ParseInteger(arTimestamp, 0, uFirstSeparatorPosition, uLength), i32_q);
+    uMonth = scast_q(QDateTime::_ParseInteger(arTimestamp, uFirstSeparatorPosition + SEPARATOR_WIDTH, uFirstSeparatorPosition + 3U * SEPARATOR_WIDTH, uLength), u32_q);
+
+    if(uLength > uFirstSeparatorPosition + 2U * SEPARATOR_WIDTH)
+        uDay = scast_q(QDateTime::_ParseInteger(arTimestamp, uFirstSeparatorPosition + 4U, uLength, uLength), u32_q);
     else
-    {
         uDay = FIRST_DAY_NUMBER;
-    }
 
     // -0000 represents the year 1 BC, or -1, so it must be adjusted
     if(nYear <= 0)
         nYear -= 1;
 }
 
-void QDateTime::_ParseTimestampIncompleteDateWithoutSeparators(const string_q &strTimestamp, i32_q &nYear, u32_q &uMonth, u32_q &uDay) const
+template<class CharT>
+void QDateTime::_ParseTimestampIncompleteDateWithoutSeparators(const CharT* arTimestamp, const u32_q uLength, i32_q &nYear, u32_q &uMonth, u32_q &uDay)
 {
     static const u32_q FIRST_MONTH_NUMBER = 1;
     static const u32_q FIRST_DAY_NUMBER = 1;
     static const u32_q MAXIMUM_YEAR_SIZE_INCLUDING_SIGN = 6; // +YYYYY
 
-    if(strTimestamp.GetLength() > MAXIMUM_YEAR_SIZE_INCLUDING_SIGN)
+    if(uLength > MAXIMUM_YEAR_SIZE_INCLUDING_SIGN)
     {
-        const u32_q LAST_POSITION = strTimestamp.GetLength() - 1U;
-        const string_q& DAY = strTimestamp.Substring(LAST_POSITION - 1U, LAST_POSITION);
-        const string_q& MONTH = strTimestamp.Substring(LAST_POSITION - 3U, LAST_POSITION - 2U);
-        const string_q& YEAR = strTimestamp.Substring(0, LAST_POSITION - 4U);
-
-        nYear  = scast_q(YEAR.ToInteger(), i32_q);
-        uMonth = scast_q(MONTH.ToInteger(), u32_q);
-        uDay   = scast_q(DAY.ToInteger(), u32_q);
+        nYear  = scast_q(QDateTime::_ParseInteger(arTimestamp, 0,            uLength - 4U, uLength), i32_q);
+        uMonth = scast_q(QDateTime::_ParseInteger(arTimestamp, uLength - 4U, uLength - 2U, uLength), u32_q);
+        uDay   = scast_q(QDateTime::_ParseInteger(arTimestamp, uLength - 2U, uLength,      uLength), u32_q);
     }
     else
     {
-        nYear  = scast_q(strTimestamp.ToInteger(), i32_q);
+        nYear  = scast_q(QDateTime::_ParseInteger(arTimestamp, 0, uLength, uLength), i32_q);
         uMonth = FIRST_MONTH_NUMBER;
         uDay   = FIRST_DAY_NUMBER;
     }
@@ -1892,43 +1705,43 @@ void QDateTime::_ParseTimestampIncompleteDateWithoutSeparators(const string_q &s
         nYear -= 1;
 }
 
-void QDateTime::_ParseTimestampIncompleteTime(const string_q &strTimestamp, u32_q &uHour, u32_q &uMinute, u32_q &uSecond, u32_q &uMillisecond, 
-                                             u32_q &uMicrosecond, u32_q &uHundredOfNanosecond, i32_q &nOffsetHours, u32_q& uOffsetMinutes) const
+template<class CharT>
+void QDateTime::_ParseTimestampIncompleteTime(const CharT* arTimestamp, const u32_q uLength, u32_q &uHour, u32_q &uMinute, u32_q &uSecond, u32_q &uMillisecond, u32_q &uMicrosecond, 
+                                              u32_q &uHundredOfNanosecond, i32_q &nOffsetHours, u32_q& uOffsetMinutes)
 {
-    static const string_q SECOND_FRACTION_SEPARATOR1 = ".";
-    static const string_q SECOND_FRACTION_SEPARATOR2 = ",";
-    static const string_q POSITIVE_SIGN = "+";
-    static const string_q NEGATIVE_SIGN = "-";
-    static const char_q ZULU_TIME = 'Z';
+    static const char SECOND_FRACTION_SEPARATOR1 = '.';
+    static const char SECOND_FRACTION_SEPARATOR2 = ',';
+    static const char POSITIVE_SIGN = '+';
+    static const char NEGATIVE_SIGN = '-';
+    static const char ZULU_TIME = 'Z';
 
-    const u32_q TIME_LENGTH = strTimestamp.GetLength();
-
-    if(TIME_LENGTH > 2)
+    if(uLength > 2U)
     {
         // There are more parts besides the hour
 
-        int nFractionSeparator = strTimestamp.IndexOf(SECOND_FRACTION_SEPARATOR1, EQComparisonType::E_BinaryCaseSensitive);
-        if(nFractionSeparator == string_q::PATTERN_NOT_FOUND)
-            nFractionSeparator = strTimestamp.IndexOf(SECOND_FRACTION_SEPARATOR2, EQComparisonType::E_BinaryCaseSensitive);
+        u32_q uFractionSeparatorPosition = QDateTime::_FindCharacter(arTimestamp, 0, uLength, SECOND_FRACTION_SEPARATOR1);
+
+        if(uFractionSeparatorPosition == uLength)
+            uFractionSeparatorPosition = QDateTime::_FindCharacter(arTimestamp, 0, uLength, SECOND_FRACTION_SEPARATOR2);
+
+        u32_q uSignPosition = QDateTime::_FindCharacter(arTimestamp, 0, uLength, POSITIVE_SIGN);
 
-        if(nFractionSeparator != string_q::PATTERN_NOT_FOUND)
+        if(uSignPosition == uLength)
+            uSignPosition = QDateTime::_FindCharacter(arTimestamp, 0, uLength, NEGATIVE_SIGN);
+
+        // If Z exists, the last position of the time is one position before
+        const u32_q TIME_END_POSITION = arTimestamp[uLength - 1U] == ZULU_TIME ? uLength - 1U : uLength;
+
+        if(uFractionSeparatorPosition != uLength)
         {
             // Contains a fraction
-            const string_q& TIME_WITHOUT_FRACTION = strTimestamp.Substring(0, nFractionSeparator - 1U);
-            this->_ParseTimestampIncompleteTimePart(TIME_WITHOUT_FRACTION, uHour, uMinute, uSecond);
+            QDateTime::_ParseTimestampIncompleteTimePart(arTimestamp, uFractionSeparatorPosition, uHour, uMinute, uSecond);
 
-            int nSignPosition = strTimestamp.IndexOf(POSITIVE_SIGN, EQComparisonType::E_BinaryCaseSensitive);
-            if(nSignPosition == string_q::PATTERN_NOT_FOUND)
-                nSignPosition = strTimestamp.IndexOf(NEGATIVE_SIGN, EQComparisonType::E_BinaryCaseSensitive);
-
-            if(nSignPosition != string_q::PATTERN_NOT_FOUND)
+            if(uSignPosition != uLength)
             {
                 // Contains an offset
-
-                const string_q& TIME_FRACTION = strTimestamp.Substring(nFractionSeparator + 1U, nSignPosition - 1U);
-                this->_ParseTimestampTimeFraction(TIME_FRACTION, uMillisecond, uMicrosecond, uHundredOfNanosecond);
-                const string_q& TIME_OFFSET = strTimestamp.Substring(nSignPosition, TIME_LENGTH - 1U);
-                this->_ParseTimestampTimeOffset(TIME_OFFSET, nOffsetHours, uOffsetMinutes);
+                QDateTime::_ParseTimestampTimeFraction(arTimestamp, uFractionSeparatorPosition + 1U, uSignPosition, uMillisecond, uMicrosecond, uHundredOfNanosecond);
+                QDateTime::_ParseTimestampTimeOffset(arTimestamp, uSignPosition, uLength, nOffsetHours, uOffsetMinutes);
             }
             else
             {
@@ -1936,26 +1749,18 @@ void QDateTime::_ParseTimestampIncompleteTime(const string_q &strTimestamp, u32_
                 nOffsetHours   = 0;
                 uOffsetMinutes = 0;
 
-                const u32_q Z_WIDTH = strTimestamp[TIME_LENGTH - 1U] == ZULU_TIME ? 1 : 0;
-                const string_q& TIME_FRACTION = strTimestamp.Substring(nFractionSeparator + 1U, TIME_LENGTH - 1U - Z_WIDTH);
-                this->_ParseTimestampTimeFraction(TIME_FRACTION, uMillisecond, uMicrosecond, uHundredOfNanosecond);
+                QDateTime::_ParseTimestampTimeFraction(arTimestamp, uFractionSeparatorPosition + 1U, TIME_END_POSITION, uMillisecond, uMicrosecond, uHundredOfNanosecond);
             }
         }
         else
         {
             // Does not contain a fraction
 
-            int nSignPosition = strTimestamp.IndexOf(POSITIVE_SIGN, EQComparisonType::E_BinaryCaseSensitive);
-            if(nSignPosition == string_q::PATTERN_NOT_FOUND)
-                nSignPosition = strTimestamp.IndexOf(NEGATIVE_SIGN, EQComparisonType::E_BinaryCaseSensitive);
-
-            if(nSignPosition != string_q::PATTERN_NOT_FOUND)
+            if(uSignPosition != uLength)
             {
                 // Contains an offset
-                const string_q& TIME_WITHOUT_OFFSET = strTimestamp.Substring(0, nSignPosition - 1U);
-                this->_ParseTimestampIncompleteTimePart(TIME_WITHOUT_OFFSET, uHour, uMinute, uSecond);
-                const string_q& TIME_OFFSET = strTimestamp.Substring(nSignPosition, TIME_LENGTH - 1U);
-                this->_ParseTimestampTimeOffset(TIME_OFFSET, nOffsetHours, uOffsetMinutes);
+                QDateTime::_ParseTimestampIncompleteTimePart(arTimestamp, uSignPosition, uHour, uMinute, uSecond);
+                QDateTime::_ParseTimestampTimeOffset(arTimestamp, uSignPosition, uLength, nOffsetHours, uOffsetMinutes);
             }
             else
             {
@@ -1963,10 +1768,7 @@ void QDateTime::_ParseTimestampIncompleteTime(const string_q &strTimestamp, u32_
                 nOffsetHours   = 0;
                 uOffsetMinutes = 0;
 
-                const u32_q Z_WIDTH = strTimestamp[TIME_LENGTH - 1U] == ZULU_TIME ? 1 : 0;
-
-                const string_q& TIME_WITHOUT_Z = strTimestamp.Substring(0, TIME_LENGTH - 1U - Z_WIDTH);
-                this->_ParseTimestampIncompleteTimePart(TIME_WITHOUT_Z, uHour, uMinute, uSecond);
+                QDateTime::_ParseTimestampIncompleteTimePart(arTimestamp, TIME_END_POSITION, uHour, uMinute, uSecond);
             }
 
             uMillisecond = 0;
@@ -1977,11 +1779,10 @@ void QDateTime::_ParseTimestampIncompleteTime(const string_q &strTimestamp, u32_
     else
     {
         // There is information about the hour only
-        const string_q& HOUR = strTimestamp.Substring(0, 1);
-        uHour = scast_q(HOUR.ToInteger(), u32_q);
+        uHour = scast_q(QDateTime::_ParseInteger(arTimestamp, 0, 2U, uLength), u32_q);
 
         // 24 is allowed in a timestamp, but not as a valid hour in this class
-        if(uHour == 24)
+        if(uHour == 24U)
             uHour = 0;
 
         uMinute = 0;
@@ -1994,54 +1795,32 @@ void QDateTime::_ParseTimestampIncompleteTime(const string_q &strTimestamp, u32_
     }
 }
 
-void QDateTime::_ParseTimestampIncompleteTimePart(const string_q& strTimeWithoutFraction, u32_q& uHour, u32_q& uMinute, u32_q& uSecond) const
+template<class CharT>
+void QDateTime::_ParseTimestampIncompleteTimePart(const CharT* arTimestamp, const u32_q uEnd, u32_q& uHour, u32_q& uMinute, u32_q& uSecond)
 {
-    static const string_q TIME_SEPARATOR = ":";
-
-    const u32_q TIME_LENGTH = strTimeWithoutFraction.GetLength();
-    const i32_q FISRT_SEPARATOR_POSITION = strTimeWithoutFraction.IndexOf(TIME_SEPARATOR, EQComparisonType::E_BinaryCaseSensitive);
+    static const char TIME_SEPARATOR = ':';
 
-    const string_q& HOUR = strTimeWithoutFraction.Substring(0, 1);
-    uHour = scast_q(HOUR.ToInteger(), u32_q);
+    uHour = scast_q(QDateTime::_ParseInteger(arTimestamp, 0, 2U, uEnd), u32_q);
 
     // 24:00 is allowed in a timestamp, but not as a valid hour in this class
     if(uHour == 24U)
         uHour = 0;
 
-    if(FISRT_SEPARATOR_POSITION != string_q::PATTERN_NOT_FOUND)
+    if(QDateTime::_FindCharacter(arTimestamp, 0, uEnd, TIME_SEPARATOR) != uEnd)
     {
         // It uses separators
-
-        const string_q& MINUTE = strTimeWithoutFraction.Substring(3U, 4U);
-        uMinute = scast_q(MINUTE.ToInteger(), u32_q);
+        uMinute = scast_q(QDateTime::_ParseInteger(arTimestamp, 3U, 5U, uEnd), u32_q);
 
         // If the length is greater than 5 (hh:mm), it contains information about the second
-        if(TIME_LENGTH > 5U)
-        {
-            const string_q& SECOND = strTimeWithoutFraction.Substring(6U, 7U);
-            uSecond = scast_q(SECOND.ToInteger(), u32_q);
-        }
-        else
-        {
-            uSecond = 0;
-        }
+        uSecond = uEnd > 5U ? scast_q(QDateTime::_ParseInteger(arTimestamp, 6U, 8U, uEnd), u32_q) : 0;
     }
-    else if(TIME_LENGTH > 2U) // If the length is greater than 2 (hh), it contains information about the minute
+    else if(uEnd > 2U) // If the length is greater than 2 (hh), it contains information about the minute
     {
         // It does not use separators and has minutes
+        uMinute = scast_q(QDateTime::_ParseInteger(arTimestamp, 2U, 4U, uEnd), u32_q);
 
-        const string_q& MINUTE = strTimeWithoutFraction.Substring(2U, 3U);
-        uMinute = scast_q(MINUTE.ToInteger(), u32_q);
-
-        if(TIME_LENGTH > 4U)// If the length is greater than 4 (hhmm), it contains information about the second
-        {
-            const string_q& SECOND = strTimeWithoutFraction.Substring(4U, 5U);
-            uSecond = scast_q(SECOND.ToInteger(), u32_q);
-        }
-        else
-        {
-            uSecond = 0;
-        }
+        // If the length is greater than 4 (hhmm), it contains information about the second
+        uSecond = uEnd > 4U ? scast_q(QDateTime::_ParseInteger(arTimestamp, 4U, 6U, uEnd), u32_q) : 0;
     }
     else
     {
@@ -2090,6 +1869,128 @@ void QDateTime::_ApplyOffsetToTimestamp(const i32_q nOffsetHours, const u32_q uO
         dateTime -= offset;
 }
 
+template<class CharT>
+unsigned int QDateTime::_FormatTimestamp(CharT* arTimestamp) const
+{
+    // Output format samples: +YYYYY-MM-DDThh:mm:ss.uuuuuuu+hh:mm
+    //                        -YYYY-MM-DDThh:mm:ss.uuuuuuuZ
+    //                        +YYYY-MM-DDThh:mm:ss-hh:mm
+
+    static const char TIME_SEPARATOR = ':';
+    static const char DATE_SEPARATOR = '-';
+    static const char TIME_START_SEPARATOR = 'T';
+    static const char SECOND_FRACTION_SEPARATOR = '.';
+    static const char POSITIVE_SIGN = '+';
+    static const char NEGATIVE_SIGN = '-';
+    static const char ZULU_TIME = 'Z';
+    static const unsigned int FIRST_YEAR_WITH_5_CYPHERS = 10000U;
+    static const unsigned int FRACTION_LENGTH = 7U;
+    static const unsigned int MINUTES_PER_HOUR = 60U;
+
+    QE_ASSERT_ERROR(!this->IsUndefined(), "Undefined date/times cannot be represented as string");
+
+    // The offset is calculated only once, since it is used both to get the local time and to be written in the timestamp
+    QTimeSpan localTimeInstant = m_instant;
+    QTimeSpan offset(0);
+    bool bOffsetIsNegative = false;
+
+    if(m_pTimeZone != null_q)
+    {
+        QDateTime utcDateTime;
+        utcDateTime.m_instant = m_instant;
+        m_pTimeZone->CalculateOffset(utcDateTime, offset, bOffsetIsNegative);
+
+        if(bOffsetIsNegative)
+            localTimeInstant -= offset;
+        else
+            localTimeInstant += offset;
+    }
+
+    const bool IS_NEGATIVE_DATE = localTimeInstant.GetHundredsOfNanoseconds() < QDateTime::_HALF_VALUE;
+
+    unsigned int uYear;
+    unsigned int uMonth;
+    unsigned int uDay;
+    unsigned int uHour;
+    unsigned int uMinute;
+    unsigned int uSecond;
+    unsigned int uMillisecond;
+    unsigned int uMicrosecond;
+    unsigned int uHundredOfNanosecond;
+
+    QDateTime::_DecomposeInstant(localTimeInstant, uYear, uMonth, uDay, uHour, uMinute, uSecond, uMillisecond, uMicrosecond, uHundredOfNanosecond);
+
+    CharT* pCurrentPosition = arTimestamp;
+
+    *pCurrentPosition++ = IS_NEGATIVE_DATE ? NEGATIVE_SIGN : POSITIVE_SIGN;
+
+    // Negative years are adjusted so the year 1 BC, or -1, is represented by "-0000" in timestamps
+    if(IS_NEGATIVE_DATE)
+        --uYear;
+
+    // YYYYY is allowed, but padding is applied only when width is lower than 4 cyphers
+    pCurrentPosition = QDateTime::_WriteDigits(uYear, uYear < FIRST_YEAR_WITH_5_CYPHERS ? 4U : 5U, pCurrentPosition);
+    *pCurrentPosition++ = DATE_SEPARATOR;
+    pCurrentPosition = QDateTime::_WriteDigits(uMonth, 2U, pCurrentPosition);
+    *pCurrentPosition++ = DATE_SEPARATOR;
+    pCurrentPosition = QDateTime::_WriteDigits(uDay, 2U, pCurrentPosition);
+    *pCurrentPosition++ = TIME_START_SEPARATOR;
+    pCurrentPosition = QDateTime::_WriteDigits(uHour, 2U, pCurrentPosition);
+    *pCurrentPosition++ = TIME_SEPARATOR;
+    pCurrentPosition = QDateTime::_WriteDigits(uMinute, 2U, pCurrentPosition);
+    *pCurrentPosition++ = TIME_SEPARATOR;
+    pCurrentPosition = QDateTime::_WriteDigits(uSecond, 2U, pCurrentPosition);
+
+    // Converts milliseconds, microseconds and nanoseconds to a fraction of second, without the zeroes on the right
+    unsigned int uFraction = uMillisecond * 10000U + uMicrosecond * 10U + uHundredOfNanosecond;
+
+    if(uFraction > 0)
+    {
+        unsigned int uFractionLength = FRACTION_LENGTH;
+
+        while(uFraction % 10U == 0)
+        {
+            uFraction /= 10U;
+            --uFractionLength;
+        }
+
+        *pCurrentPosition++ = SECOND_FRACTION_SEPARATOR;
+        pCurrentPosition = QDateTime::_WriteDigits(uFraction, uFractionLength, pCurrentPosition);
+    }
+
+    // Adds the time offset
+    if(m_pTimeZone == null_q)
+    {
+        *pCurrentPosition++ = ZULU_TIME;
+    }
+    else
+    {
+        *pCurrentPosition++ = bOffsetIsNegative ? NEGATIVE_SIGN : POSITIVE_SIGN;
+        pCurrentPosition = QDateTime::_WriteDigits(scast_q(offset.GetHours(), unsigned int), 2U, pCurrentPosition);
+        *pCurrentPosition++ = TIME_SEPARATOR;
+        pCurrentPosition = QDateTime::_WriteDigits(scast_q(offset.GetMinutes() % MINUTES_PER_HOUR, unsigned int), 2U, pCurrentPosition);
+    }
+
+    return scast_q(pCurrentPosition - arTimestamp, unsigned int);
+}
+
+template<class CharT>
+CharT* QDateTime::_WriteDigits(const unsigned int uValue, const unsigned int uDigits, CharT* arTimestamp)
+{
+    static const char CHARACTER_ZERO = '0';
+
+    unsigned int uRemainingValue = uValue;
+
+    // Digits are written from right to left
+    for(unsigned int i = uDigits; i > 0; --i)
+    {
+        arTimestamp[i - 1U] = scast_q(CHARACTER_ZERO + uRemainingValue % 10U, CharT);
+        uRemainingValue /= 10U;
+    }
+
+    return arTimestamp + uDigits;
+}
+
 
 //##################=======================================================##################
 //##################             ____________________________              ##################
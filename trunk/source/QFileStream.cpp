@@ -391,19 +391,9 @@ bool QFileStream::_ReadPlatformImplementation(u8_q* pOutputBuffer, const pointer
     memset(&offsets, 0, sizeof(OVERLAPPED)); // The structure MUST be zero-initialized
 
     // Sets the offset from where to start reading
-#if QE_OS_WINDOWS == 32
-        offsets.Offset = uFileOffset;
-        offsets.OffsetHigh = 0;
-#elif QE_OS_WINDOWS == 64
-        const u32_q* pPosition = rcast_q(&uFileOffset, const u32_q*);
-    #if QE_ENDIANNESS == QE_ENDIANNESS_LITTLEENDIAN
-        offsets.Offset = pPosition[1];
-        offsets.OffsetHigh = pPosition[0];
-    #elif QE_ENDIANNESS == QE_ENDIANNESS_BIGENDIAN
-        offsets.Offset = pPosition[0];
-        offsets.OffsetHigh = pPosition[1];
-    #endif
-#endif
+    const u64_q FILE_OFFSET = uFileOffset;
+    offsets.Offset = scast_q(FILE_OFFSET & 0xFFFFFFFFU, DWORD);
+    offsets.OffsetHigh = scast_q(FILE_OFFSET >> 32U, DWORD);
 
     static const BOOL READ_OPERATION_FAILED = 0;
     BOOL uReadFileResult = ::ReadFile(handle, pOutputBuffer, uNumberOfBytes, NULL, &offsets);
@@ -426,19 +416,9 @@ bool QFileStream::_WritePlatformImplementation(const void* pInputBuffer, const p
     memset(&offsets, 0, sizeof(OVERLAPPED)); // The structure MUST be zero-initialized
 
     // Sets the offset from where to start reading
-#if QE_OS_WINDOWS == 32
-        offsets.Offset = uFileOffset;
-        offsets.OffsetHigh = 0;
-#elif QE_OS_WINDOWS == 64
-        const u32_q* pPosition = rcast_q(&uFileOffset, const u32_q*);
-    #if QE_ENDIANNESS == QE_ENDIANNESS_LITTLEENDIAN
-        offsets.Offset = pPosition[1];
-        offsets.OffsetHigh = pPosition[0];
-    #elif QE_ENDIANNESS == QE_ENDIANNESS_BIGENDIAN
-        offsets.Offset = pPosition[0];
-        offsets.OffsetHigh = pPosition[1];
-    #endif
-#endif
+    const u64_q FILE_OFFSET = uFileOffset;
+    offsets.Offset = scast_q(FILE_OFFSET & 0xFFFFFFFFU, DWORD);
+    offsets.OffsetHigh = scast_q(FILE_OFFSET >> 32U, DWORD);
 
     static const BOOL WRITE_OPERATION_FAILED = 0;
     BOOL uWriteFileResult = ::WriteFile(handle, pInputBuffer, uNumberOfBytes, NULL, &offsets);
@@ -0,0 +1,374 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "QFrustum.h"
+
+#include "Assertions.h"
+#include "MathDefinitions.h"
+#include "SQFloat.h"
+#include "QSpaceConversionMatrix.h"
+#include "QSoAPointBuffer.h"
+#include "SQVF32.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQVF32;
+using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Math
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const unsigned int QFrustum::PLANE_COUNT = 6;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QFrustum::QFrustum(const QBasePlane &leftPlane, const QBasePlane &rightPlane, const QBasePlane &bottomPlane, 
+                   const QBasePlane &topPlane, const QBasePlane &nearPlane, const QBasePlane &farPlane)
+{
+    m_arPlanes[0] = QPlane(leftPlane).Normalize();
+    m_arPlanes[1] = QPlane(rightPlane).Normalize();
+    m_arPlanes[2] = QPlane(bottomPlane).Normalize();
+    m_arPlanes[3] = QPlane(topPlane).Normalize();
+    m_arPlanes[4] = QPlane(nearPlane).Normalize();
+    m_arPlanes[5] = QPlane(farPlane).Normalize();
+}
+
+QFrustum::QFrustum(const QSpaceConversionMatrix &viewProjection)
+{
+    // Once transformed, a visible point (x, y, z, w) satisfies -w <= x <= w, -w <= y <= w and 0 <= z <= w; since every transformed
+    // component is the dot product of the point and a column of the matrix, every inequality is a plane made of columns
+    const float_q (&M)[4][4] = viewProjection.ij;
+
+    m_arPlanes[0] = QPlane(M[0][3] + M[0][0], M[1][3] + M[1][0], M[2][3] + M[2][0], M[3][3] + M[3][0]).Normalize();
+    m_arPlanes[1] = QPlane(M[0][3] - M[0][0], M[1][3] - M[1][0], M[2][3] - M[2][0], M[3][3] - M[3][0]).Normalize();
+    m_arPlanes[2] = QPlane(M[0][3] + M[0][1], M[1][3] + M[1][1], M[2][3] + M[2][1], M[3][3] + M[3][1]).Normalize();
+    m_arPlanes[3] = QPlane(M[0][3] - M[0][1], M[1][3] - M[1][1], M[2][3] - M[2][1], M[3][3] - M[3][1]).Normalize();
+    m_arPlanes[4] = QPlane(M[0][2], M[1][2], M[2][2], M[3][2]).Normalize();
+    m_arPlanes[5] = QPlane(M[0][3] - M[0][2], M[1][3] - M[1][2], M[2][3] - M[2][2], M[3][3] - M[3][2]).Normalize();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+bool QFrustum::IsVisible(const QBaseOrb<QVector3> &orb) const
+{
+    // Exact comparisons are used everywhere so the result is the same as the one obtained by FindVisible
+    for(unsigned int i = 0; i < PLANE_COUNT; ++i)
+    {
+        const QPlane &PLANE = m_arPlanes[i];
+
+        if(PLANE.a * orb.Center.x + PLANE.b * orb.Center.y + PLANE.c * orb.Center.z + PLANE.d < -orb.Radius)
+            return false;
+    }
+
+    return true;
+}
+
+bool QFrustum::IsVisible(const QBaseHexahedron<QVector3> &hexahedron) const
+{
+    const QVector3* VERTICES[] = { &hexahedron.A, &hexahedron.B, &hexahedron.C, &hexahedron.D, 
+                                   &hexahedron.E, &hexahedron.F, &hexahedron.G, &hexahedron.H };
+
+    for(unsigned int i = 0; i < PLANE_COUNT; ++i)
+    {
+        const QPlane &PLANE = m_arPlanes[i];
+        bool bAllVerticesOutside = true;
+
+        for(unsigned int j = 0; j < 8U && bAllVerticesOutside; ++j)
+            bAllVerticesOutside = PLANE.a * VERTICES[j]->x + PLANE.b * VERTICES[j]->y + PLANE.c * VERTICES[j]->z + PLANE.d < SQFloat::_0;
+
+        if(bAllVerticesOutside)
+            return false;
+    }
+
+    return true;
+}
+
+unsigned int QFrustum::FindVisible(const QSoAPointBuffer &centers, const float_q* arRadii, unsigned int* arVisibleIndices) const
+{
+    const unsigned int COUNT = centers.GetCount();
+
+    QE_ASSERT_ERROR(null_q != arRadii || COUNT == 0, "The input array of radii cannot be null");
+    QE_ASSERT_ERROR(null_q != arVisibleIndices || COUNT == 0, "The output array cannot be null");
+
+    const float_q* arX = centers.GetX();
+    const float_q* arY = centers.GetY();
+    const float_q* arZ = centers.GetZ();
+    unsigned int uVisible = 0;
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    vf32_q arPlaneA[6];
+    vf32_q arPlaneB[6];
+    vf32_q arPlaneC[6];
+    vf32_q arPlaneD[6];
+
+    for(unsigned int i = 0; i < PLANE_COUNT; ++i)
+    {
+        arPlaneA[i] = SQVF32::Fill(m_arPlanes[i].a);
+        arPlaneB[i] = SQVF32::Fill(m_arPlanes[i].b);
+        arPlaneC[i] = SQVF32::Fill(m_arPlanes[i].c);
+        arPlaneD[i] = SQVF32::Fill(m_arPlanes[i].d);
+    }
+
+    const vf32_q ZERO = SQVF32::Fill(SQFloat::_0);
+
+    for(unsigned int i = 0; i < COUNT; i += QSoAPointBuffer::POINTS_PER_BLOCK)
+    {
+        const unsigned int BLOCK_SIZE = COUNT - i < QSoAPointBuffer::POINTS_PER_BLOCK ? COUNT - i : QSoAPointBuffer::POINTS_PER_BLOCK;
+
+        // Unlike the centers, the radii are not padded, so the last block is completed with zeros
+        float_q arLastRadii[4] = { SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_0 };
+        const float_q* arBlockRadii = arRadii + i;
+
+        if(BLOCK_SIZE < QSoAPointBuffer::POINTS_PER_BLOCK)
+        {
+            for(unsigned int j = 0; j < BLOCK_SIZE; ++j)
+                arLastRadii[j] = arRadii[i + j];
+
+            arBlockRadii = arLastRadii;
+        }
+
+        const vf32_q X = SQVF32::LoadAligned(arX + i);
+        const vf32_q Y = SQVF32::LoadAligned(arY + i);
+        const vf32_q Z = SQVF32::LoadAligned(arZ + i);
+        const vf32_q NEGATIVE_RADIUS = SQVF32::Subtract(ZERO, SQVF32::Load(arBlockRadii));
+        vf32_q vfIsVisible = SQVF32::CompareEqual(ZERO, ZERO);
+
+        // The remaining planes are skipped when the 4 objects are already known to be outside
+        for(unsigned int j = 0; j < PLANE_COUNT && SQVF32::ExtractMask(vfIsVisible) != 0; ++j)
+        {
+            const vf32_q DISTANCE = SQVF32::Add(SQVF32::Add(SQVF32::Add(SQVF32::Multiply(arPlaneA[j], X), SQVF32::Multiply(arPlaneB[j], Y)), 
+                                                            SQVF32::Multiply(arPlaneC[j], Z)), 
+                                                arPlaneD[j]);
+            vfIsVisible = SQVF32::And(vfIsVisible, SQVF32::CompareGreaterOrEquals(DISTANCE, NEGATIVE_RADIUS));
+        }
+
+        const u32_q VISIBLE_MASK = SQVF32::ExtractMask(vfIsVisible);
+
+        // The index is always written but only counted if the object is visible, which avoids a branch per object
+        for(unsigned int j = 0; j < BLOCK_SIZE; ++j)
+        {
+            arVisibleIndices[uVisible] = i + j;
+            uVisible += (VISIBLE_MASK >> j) & 1U;
+        }
+    }
+#else
+    for(unsigned int i = 0; i < COUNT; ++i)
+    {
+        bool bIsVisible = true;
+
+        for(unsigned int j = 0; j < PLANE_COUNT && bIsVisible; ++j)
+        {
+            const QPlane &PLANE = m_arPlanes[j];
+            bIsVisible = PLANE.a * arX[i] + PLANE.b * arY[i] + PLANE.c * arZ[i] + PLANE.d >= -arRadii[i];
+        }
+
+        if(bIsVisible)
+        {
+            arVisibleIndices[uVisible] = i;
+            ++uVisible;
+        }
+    }
+#endif
+
+    return uVisible;
+}
+
+unsigned int QFrustum::FindVisible(const QSoAPointBuffer &centers, const QSoAPointBuffer &halfSizes, unsigned int* arVisibleIndices) const
+{
+    const unsigned int COUNT = centers.GetCount();
+
+    QE_ASSERT_ERROR(halfSizes.GetCount() == COUNT, "There must be as many sizes as centers");
+    QE_ASSERT_ERROR(null_q != arVisibleIndices || COUNT == 0, "The output array cannot be null");
+
+    const float_q* arX = centers.GetX();
+    const float_q* arY = centers.GetY();
+    const float_q* arZ = centers.GetZ();
+    const float_q* arHalfSizeX = halfSizes.GetX();
+    const float_q* arHalfSizeY = halfSizes.GetY();
+    const float_q* arHalfSizeZ = halfSizes.GetZ();
+    unsigned int uVisible = 0;
+
+    // A box is outside when its center is farther from the plane than the projection of its half sizes onto the normal of the plane, 
+    // which is calculated with the absolute values of the components of the normal
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    vf32_q arPlaneA[6];
+    vf32_q arPlaneB[6];
+    vf32_q arPlaneC[6];
+    vf32_q arPlaneD[6];
+    vf32_q arAbsoluteA[6];
+    vf32_q arAbsoluteB[6];
+    vf32_q arAbsoluteC[6];
+
+    for(unsigned int i = 0; i < PLANE_COUNT; ++i)
+    {
+        arPlaneA[i] = SQVF32::Fill(m_arPlanes[i].a);
+        arPlaneB[i] = SQVF32::Fill(m_arPlanes[i].b);
+        arPlaneC[i] = SQVF32::Fill(m_arPlanes[i].c);
+        arPlaneD[i] = SQVF32::Fill(m_arPlanes[i].d);
+        arAbsoluteA[i] = SQVF32::Fill(SQFloat::Abs(m_arPlanes[i].a));
+        arAbsoluteB[i] = SQVF32::Fill(SQFloat::Abs(m_arPlanes[i].b));
+        arAbsoluteC[i] = SQVF32::Fill(SQFloat::Abs(m_arPlanes[i].c));
+    }
+
+    const vf32_q ZERO = SQVF32::Fill(SQFloat::_0);
+
+    for(unsigned int i = 0; i < COUNT; i += QSoAPointBuffer::POINTS_PER_BLOCK)
+    {
+        const unsigned int BLOCK_SIZE = COUNT - i < QSoAPointBuffer::POINTS_PER_BLOCK ? COUNT - i : QSoAPointBuffer::POINTS_PER_BLOCK;
+
+        const vf32_q X = SQVF32::LoadAligned(arX + i);
+        const vf32_q Y = SQVF32::LoadAligned(arY + i);
+        const vf32_q Z = SQVF32::LoadAligned(arZ + i);
+        const vf32_q HALF_SIZE_X = SQVF32::LoadAligned(arHalfSizeX + i);
+        const vf32_q HALF_SIZE_Y = SQVF32::LoadAligned(arHalfSizeY + i);
+        const vf32_q HALF_SIZE_Z = SQVF32::LoadAligned(arHalfSizeZ + i);
+        vf32_q vfIsVisible = SQVF32::CompareEqual(ZERO, ZERO);
+
+        // The remaining planes are skipped when the 4 objects are already known to be outside
+        for(unsigned int j = 0; j < PLANE_COUNT && SQVF32::ExtractMask(vfIsVisible) != 0; ++j)
+        {
+            const vf32_q DISTANCE = SQVF32::Add(SQVF32::Add(SQVF32::Add(SQVF32::Multiply(arPlaneA[j], X), SQVF32::Multiply(arPlaneB[j], Y)), 
+                                                            SQVF32::Multiply(arPlaneC[j], Z)), 
+                                                arPlaneD[j]);
+            const vf32_q EXTENT = SQVF32::Add(SQVF32::Add(SQVF32::Multiply(arAbsoluteA[j], HALF_SIZE_X), SQVF32::Multiply(arAbsoluteB[j], HALF_SIZE_Y)), 
+                                              SQVF32::Multiply(arAbsoluteC[j], HALF_SIZE_Z));
+            vfIsVisible = SQVF32::And(vfIsVisible, SQVF32::CompareGreaterOrEquals(SQVF32::Add(DISTANCE, EXTENT), ZERO));
+        }
+
+        const u32_q VISIBLE_MASK = SQVF32::ExtractMask(vfIsVisible);
+
+        // The index is always written but only counted if the object is visible, which avoids a branch per object
+        for(unsigned int j = 0; j < BLOCK_SIZE; ++j)
+        {
+            arVisibleIndices[uVisible] = i + j;
+            uVisible += (VISIBLE_MASK >> j) & 1U;
+        }
+    }
+#else
+    QPlane arAbsolutePlanes[6];
+
+    for(unsigned int i = 0; i < PLANE_COUNT; ++i)
+        arAbsolutePlanes[i] = QPlane(SQFloat::Abs(m_arPlanes[i].a), SQFloat::Abs(m_arPlanes[i].b), SQFloat::Abs(m_arPlanes[i].c), SQFloat::_0);
+
+    for(unsigned int i = 0; i < COUNT; ++i)
+    {
+        bool bIsVisible = true;
+
+        for(unsigned int j = 0; j < PLANE_COUNT && bIsVisible; ++j)
+        {
+            const QPlane &PLANE = m_arPlanes[j];
+            const QPlane &ABSOLUTE_PLANE = arAbsolutePlanes[j];
+            const float_q DISTANCE = PLANE.a * arX[i] + PLANE.b * arY[i] + PLANE.c * arZ[i] + PLANE.d;
+            const float_q EXTENT = ABSOLUTE_PLANE.a * arHalfSizeX[i] + ABSOLUTE_PLANE.b * arHalfSizeY[i] + ABSOLUTE_PLANE.c * arHalfSizeZ[i];
+            bIsVisible = DISTANCE + EXTENT >= SQFloat::_0;
+        }
+
+        if(bIsVisible)
+        {
+            arVisibleIndices[uVisible] = i;
+            ++uVisible;
+        }
+    }
+#endif
+
+    return uVisible;
+}
+
+unsigned int QFrustum::FindVisible(const QBaseHexahedron<QVector3>* arHexahedra, const unsigned int uCount, unsigned int* arVisibleIndices) const
+{
+    QE_ASSERT_ERROR(null_q != arHexahedra || uCount == 0, "The input array of hexahedra cannot be null");
+    QE_ASSERT_ERROR(null_q != arVisibleIndices || uCount == 0, "The output array cannot be null");
+
+    unsigned int uVisible = 0;
+
+    for(unsigned int i = 0; i < uCount; ++i)
+    {
+        if(this->IsVisible(arHexahedra[i]))
+        {
+            arVisibleIndices[uVisible] = i;
+            ++uVisible;
+        }
+    }
+
+    return uVisible;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const QPlane& QFrustum::GetPlane(const unsigned int uIndex) const
+{
+    QE_ASSERT_ERROR(uIndex < PLANE_COUNT, "The index of the plane must be lower than the number of planes");
+
+    return m_arPlanes[uIndex];
+}
+
+
+} //namespace Math
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
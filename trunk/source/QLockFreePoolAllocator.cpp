@@ -0,0 +1,303 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "QLockFreePoolAllocator.h"
+
+#include "AllocationOperators.h"
+#include "Assertions.h"
+
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const u32_q QLockFreePoolAllocator::END_OF_LIST = 0xFFFFFFFFU;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QLockFreePoolAllocator::QLockFreePoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment) :
+                                                            m_uFreeListHead(0),
+                                                            m_uAllocatedBlocks(0),
+                                                            m_arNextFreeBlocks(null_q),
+                                                            m_pFirst(null_q),
+                                                            m_uBlockSize(uBlockSize),
+                                                            m_uPoolSize(uSize),
+                                                            m_uBlockCount(0),
+                                                            m_alignment(alignment)
+{
+    QE_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
+    QE_ASSERT_ERROR( uSize >= uBlockSize, "The size of the pool must be greater than or equal to the size of a block" );
+
+    m_uBlockCount = uSize / uBlockSize;
+
+    QE_ASSERT_ERROR( m_uBlockCount < END_OF_LIST, "The pool cannot contain so many blocks" );
+
+    m_pFirst = operator new(m_uPoolSize, alignment);
+    QE_ASSERT_ERROR( null_q != m_pFirst, "Pointer to allocated memory is null" );
+
+    m_arNextFreeBlocks = new boost::atomic<u32_q>[m_uBlockCount];
+
+    this->Clear();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QLockFreePoolAllocator::~QLockFreePoolAllocator()
+{
+    operator delete(m_pFirst, m_alignment);
+    delete[] m_arNextFreeBlocks;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void* QLockFreePoolAllocator::Allocate()
+{
+    u64_q uHead = m_uFreeListHead.load(boost::memory_order_acquire);
+    u32_q uFirstBlock = scast_q(uHead, u32_q);
+
+    // If the head changed since it was read, the next block may be wrong; the exchange fails and uHead receives the current head
+    while(uFirstBlock != END_OF_LIST &&
+          !m_uFreeListHead.compare_exchange_weak(uHead,
+                                                 ((uHead >> 32U) + 1U) << 32U | m_arNextFreeBlocks[uFirstBlock].load(boost::memory_order_relaxed),
+                                                 boost::memory_order_acquire,
+                                                 boost::memory_order_acquire))
+    {
+        uFirstBlock = scast_q(uHead, u32_q);
+    }
+
+    if(uFirstBlock == END_OF_LIST)
+        return null_q;
+
+    m_uAllocatedBlocks.fetch_add(1U, boost::memory_order_relaxed);
+
+    return rcast_q(rcast_q(m_pFirst, pointer_uint_q) + uFirstBlock * m_uBlockSize, void*);
+}
+
+void QLockFreePoolAllocator::Deallocate(const void* pBlock)
+{
+    QE_ASSERT_ERROR( null_q != pBlock, "Pointer to block to deallocate cannot be null" );
+
+    const u32_q BLOCK_INDEX = this->GetBlockIndex(pBlock);
+    this->PushFreeBlocks(BLOCK_INDEX, BLOCK_INDEX);
+
+    m_uAllocatedBlocks.fetch_sub(1U, boost::memory_order_relaxed);
+}
+
+unsigned int QLockFreePoolAllocator::AllocateBatch(void** arBlocks, const unsigned int uCount)
+{
+    QE_ASSERT_ERROR( null_q != arBlocks, "The output array cannot be null" );
+
+    if(uCount == 0)
+        return 0;
+
+    u64_q uHead = m_uFreeListHead.load(boost::memory_order_acquire);
+    unsigned int uAllocated = 0;
+    bool bExchanged = false;
+
+    do
+    {
+        // The chain is read before replacing the head; since the counter of the head changes with every modification, the exchange
+        // only succeeds if nobody else modified the list meanwhile, so the indices read are valid even if other threads wrote them
+        u32_q uBlock = scast_q(uHead, u32_q);
+        uAllocated = 0;
+
+        if(uBlock == END_OF_LIST)
+            return 0;
+
+        while(uBlock != END_OF_LIST && uAllocated < uCount)
+        {
+            // The index may be garbage if the list is being modified; the exchange will fail in that case
+            if(uBlock >= m_uBlockCount)
+                break;
+
+            arBlocks[uAllocated] = rcast_q(rcast_q(m_pFirst, pointer_uint_q) + uBlock * m_uBlockSize, void*);
+            ++uAllocated;
+            uBlock = m_arNextFreeBlocks[uBlock].load(boost::memory_order_relaxed);
+        }
+
+        bExchanged = m_uFreeListHead.compare_exchange_weak(uHead,
+                                                           ((uHead >> 32U) + 1U) << 32U | uBlock,
+                                                           boost::memory_order_acquire,
+                                                           boost::memory_order_acquire);
+    }
+    while(!bExchanged);
+
+    m_uAllocatedBlocks.fetch_add(uAllocated, boost::memory_order_relaxed);
+
+    return uAllocated;
+}
+
+void QLockFreePoolAllocator::DeallocateBatch(void* const* arBlocks, const unsigned int uCount)
+{
+    QE_ASSERT_ERROR( null_q != arBlocks, "The input array cannot be null" );
+
+    if(uCount == 0)
+        return;
+
+    // The blocks are linked among them before adding them to the list, so only one exchange is necessary
+    const u32_q FIRST_BLOCK = this->GetBlockIndex(arBlocks[0]);
+    u32_q uLastBlock = FIRST_BLOCK;
+
+    for(unsigned int i = 1U; i < uCount; ++i)
+    {
+        const u32_q BLOCK = this->GetBlockIndex(arBlocks[i]);
+        m_arNextFreeBlocks[uLastBlock].store(BLOCK, boost::memory_order_relaxed);
+        uLastBlock = BLOCK;
+    }
+
+    this->PushFreeBlocks(FIRST_BLOCK, uLastBlock);
+
+    m_uAllocatedBlocks.fetch_sub(uCount, boost::memory_order_relaxed);
+}
+
+void QLockFreePoolAllocator::Clear()
+{
+    // Every block points to the next block as a linked list of free blocks to allocate
+    for(pointer_uint_q i = 0; i < m_uBlockCount - 1U; ++i)
+        m_arNextFreeBlocks[i].store(scast_q(i + 1U, u32_q), boost::memory_order_relaxed);
+
+    m_arNextFreeBlocks[m_uBlockCount - 1U].store(END_OF_LIST, boost::memory_order_relaxed);
+
+    // The counter of the head is kept so threads that read it before clearing cannot replace it
+    const u64_q HEAD = m_uFreeListHead.load(boost::memory_order_relaxed);
+    m_uFreeListHead.store(((HEAD >> 32U) + 1U) << 32U, boost::memory_order_release);
+    m_uAllocatedBlocks.store(0, boost::memory_order_release);
+}
+
+u32_q QLockFreePoolAllocator::GetBlockIndex(const void* pBlock) const
+{
+    const pointer_uint_q OFFSET = rcast_q(pBlock, pointer_uint_q) - rcast_q(m_pFirst, pointer_uint_q);
+
+    QE_ASSERT_ERROR( rcast_q(pBlock, pointer_uint_q) >= rcast_q(m_pFirst, pointer_uint_q) && OFFSET < m_uBlockCount * m_uBlockSize, "Pointer to block to deallocate must be an address provided by this pool allocator" );
+    QE_ASSERT_ERROR( OFFSET % m_uBlockSize == 0, "Pointer to block to deallocate must point to the beginning of a block" );
+
+    return scast_q(OFFSET / m_uBlockSize, u32_q);
+}
+
+void QLockFreePoolAllocator::PushFreeBlocks(const u32_q uFirstBlock, const u32_q uLastBlock)
+{
+    u64_q uHead = m_uFreeListHead.load(boost::memory_order_relaxed);
+
+    do
+    {
+        m_arNextFreeBlocks[uLastBlock].store(scast_q(uHead, u32_q), boost::memory_order_relaxed);
+    }
+    while(!m_uFreeListHead.compare_exchange_weak(uHead,
+                                                 ((uHead >> 32U) + 1U) << 32U | uFirstBlock,
+                                                 boost::memory_order_release,
+                                                 boost::memory_order_relaxed));
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+pointer_uint_q QLockFreePoolAllocator::GetPoolSize() const
+{
+    return m_uPoolSize;
+}
+
+pointer_uint_q QLockFreePoolAllocator::GetBlockSize() const
+{
+    return m_uBlockSize;
+}
+
+pointer_uint_q QLockFreePoolAllocator::GetBlockCount() const
+{
+    return m_uBlockCount;
+}
+
+bool QLockFreePoolAllocator::CanAllocate() const
+{
+    return scast_q(m_uFreeListHead.load(boost::memory_order_relaxed), u32_q) != END_OF_LIST;
+}
+
+pointer_uint_q QLockFreePoolAllocator::GetAllocatedBytes() const
+{
+    return m_uAllocatedBlocks.load(boost::memory_order_relaxed) * m_uBlockSize;
+}
+
+void* QLockFreePoolAllocator::GetPointer() const
+{
+    return m_pFirst;
+}
+
+QAlignment QLockFreePoolAllocator::GetAlignment() const
+{
+    return m_alignment;
+}
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -0,0 +1,826 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "QMappedFileStream.h"
+
+#include "SQFile.h"
+#include "EQTextEncoding.h"
+#include <cstring>
+
+#if defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+    #include <sys/stat.h>
+    #include <sys/mman.h>
+    #include <fcntl.h>
+    #include <errno.h>
+#endif
+
+#if defined(QE_OS_MAC)
+    typedef int error_t; // It exists on Linux but not on MacOSX
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace IO
+{
+namespace FileSystem
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+float QMappedFileStream::_REALLOCATION_FACTOR = 1.5f;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QMappedFileStream::QMappedFileStream() : m_path(string_q::GetEmpty()),
+                                         m_pMappedFile(null_q),
+                                         m_uWindowOffset(0),
+                                         m_uMappedSize(0),
+                                         m_uWindowSize(0),
+                                         m_uAllocationGranularity(0),
+                                         m_uReservedSize(0),
+                                         m_uFileSize(0),
+                                         m_uPositionPointer(0),
+                                         m_bIsOpen(false),
+                                         m_bIsWritePending(false),
+                                         m_bWritingIsAllowed(false)
+{
+}
+
+QMappedFileStream::QMappedFileStream(const QPath &filePath, const EQFileOpenMode &eOpenMode, EQFileSystemError &eErrorInfo, const pointer_uint_q uWindowSize) : 
+                                                                                      m_path(filePath),
+                                                                                      m_pMappedFile(null_q),
+                                                                                      m_uWindowOffset(0),
+                                                                                      m_uMappedSize(0),
+                                                                                      m_uWindowSize(0),
+                                                                                      m_uAllocationGranularity(0),
+                                                                                      m_uReservedSize(0),
+                                                                                      m_uFileSize(0),
+                                                                                      m_uPositionPointer(0),
+                                                                                      m_bIsOpen(false),
+                                                                                      m_bIsWritePending(false),
+                                                                                      m_bWritingIsAllowed(false)
+{
+    eErrorInfo = this->Open(filePath, eOpenMode, uWindowSize);
+}
+    
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QMappedFileStream::~QMappedFileStream()
+{
+    if(m_bIsOpen)
+    {
+        this->Close();
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void QMappedFileStream::Read(void* pOutput, const pointer_uint_q uOutputOffset, const pointer_uint_q uOutputSize)
+{
+    QE_ASSERT_ERROR(uOutputSize > 0, "The output size must not equal zero.");
+    QE_ASSERT_ERROR(pOutput != null_q, "The output buffer cannot be null.");
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file must be opened before reading.");
+
+    const pointer_uint_q FUTURE_POSITION_POINTER = m_uPositionPointer + uOutputSize;
+
+    QE_ASSERT_WARNING(FUTURE_POSITION_POINTER <= m_uFileSize, "Attempting to read from outside of the file.");
+
+    // If the output size is greater than the remaining bytes, it is fixed so the next read position does not exceed the end of the file
+    const pointer_uint_q CLAMPED_OUTPUT_SIZE = FUTURE_POSITION_POINTER > m_uFileSize ? m_uFileSize - m_uPositionPointer :
+                                                                                       uOutputSize;
+
+    pointer_uint_q uReadBytes = 0;
+
+    // The bytes are copied directly from the mapped memory, window by window; the operating system loads the pages on demand
+    while(uReadBytes < CLAMPED_OUTPUT_SIZE)
+    {
+        pointer_uint_q uMappedBytes = 0;
+        const u8_q* pSource = this->_MapWindow(m_uPositionPointer, uMappedBytes);
+
+        if(pSource == null_q)
+            break;
+
+        const pointer_uint_q BYTES_TO_COPY = CLAMPED_OUTPUT_SIZE - uReadBytes < uMappedBytes ? CLAMPED_OUTPUT_SIZE - uReadBytes : 
+                                                                                               uMappedBytes;
+        memcpy(scast_q(pOutput, u8_q*) + uOutputOffset + uReadBytes, pSource, BYTES_TO_COPY);
+        m_uPositionPointer += BYTES_TO_COPY;
+        uReadBytes += BYTES_TO_COPY;
+    }
+}
+
+void QMappedFileStream::Write(const void* pInput, const pointer_uint_q uInputOffset, const pointer_uint_q uInputSize)
+{
+    QE_ASSERT_ERROR(uInputSize > 0, "The input size must not equal zero.");
+    QE_ASSERT_ERROR(pInput != null_q, "The input buffer cannot be null.");
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file must be opened before writing.");
+    QE_ASSERT_ERROR(m_bWritingIsAllowed, "It is not possible to write to the file, it is read-only.");
+
+    const pointer_uint_q FUTURE_POSITION_POINTER = m_uPositionPointer + uInputSize;
+    bool bOperationSuccessful = true;
+
+    // If there is not enough space in the file for storing the input bytes, the file is extended
+    if(FUTURE_POSITION_POINTER > m_uReservedSize)
+        bOperationSuccessful = this->_ResizeByFactor(FUTURE_POSITION_POINTER);
+
+    if(bOperationSuccessful)
+    {
+        pointer_uint_q uWrittenBytes = 0;
+
+        while(uWrittenBytes < uInputSize)
+        {
+            pointer_uint_q uMappedBytes = 0;
+            u8_q* pDestination = this->_MapWindow(m_uPositionPointer, uMappedBytes);
+
+            if(pDestination == null_q)
+                break;
+
+            const pointer_uint_q BYTES_TO_COPY = uInputSize - uWrittenBytes < uMappedBytes ? uInputSize - uWrittenBytes : 
+                                                                                             uMappedBytes;
+            memcpy(pDestination, scast_q(pInput, const u8_q*) + uInputOffset + uWrittenBytes, BYTES_TO_COPY);
+            m_bIsWritePending = true;
+            m_uPositionPointer += BYTES_TO_COPY;
+            uWrittenBytes += BYTES_TO_COPY;
+        }
+
+        m_uFileSize = m_uPositionPointer > m_uFileSize ? m_uPositionPointer :
+                                                         m_uFileSize;
+    }
+}
+
+void QMappedFileStream::Flush()
+{
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file is not open.");
+    QE_ASSERT_ERROR(!m_bIsWritePending || m_bWritingIsAllowed, "It is not possible to write to the file, it is read-only.");
+
+    // The modified pages of the windows that were unmapped are flushed along with the file
+    if(m_bIsWritePending)
+    {
+        bool bOperationSuccessful = QMappedFileStream::_FlushPlatformImplementation(m_pMappedFile, m_uMappedSize, m_nativeHandle, m_path);
+
+        if(bOperationSuccessful)
+            m_bIsWritePending = false;
+    }
+}
+
+void QMappedFileStream::MoveBackward(const pointer_uint_q uAmount)
+{
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file is not open.");
+    QE_ASSERT_WARNING(m_uPositionPointer >= uAmount, "It is not possible to move backward the specified amount, it would be out of bounds.");
+
+    m_uPositionPointer = m_uPositionPointer < uAmount ? 0 :
+                                                        m_uPositionPointer - uAmount;
+}
+
+void QMappedFileStream::MoveForward(const pointer_uint_q uAmount)
+{
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file is not open.");
+    QE_ASSERT_WARNING(m_uPositionPointer + uAmount <= m_uFileSize, "It is not possible to move forward the specified amount, it would be out of bounds.");
+
+    m_uPositionPointer = m_uPositionPointer + uAmount > m_uFileSize ? m_uFileSize :
+                                                                      m_uPositionPointer + uAmount;
+}
+
+EQFileSystemError QMappedFileStream::Open(const QPath &filePath, const EQFileOpenMode &eOpenMode, const pointer_uint_q uWindowSize)
+{
+    QE_ASSERT_ERROR(m_bIsOpen != true, "The file stream is already open.");
+    QE_ASSERT_ERROR(uWindowSize > 0, "The size of the window must be greater than zero.");
+
+    EQFileSystemError eErrorInfo = EQFileSystemError::E_Unknown;
+    const bool FILE_EXISTS = SQFile::Exists(filePath, eErrorInfo);
+
+    if((FILE_EXISTS && (eOpenMode == EQFileOpenMode::E_Append || eOpenMode == EQFileOpenMode::E_Open)) ||
+       (!FILE_EXISTS && eOpenMode == EQFileOpenMode::E_Create)                                         ||
+       eOpenMode == EQFileOpenMode::E_CreateOrOverwrite                                                || 
+       eOpenMode == EQFileOpenMode::E_OpenOrCreate)
+    {
+        u64_q uFileSize = 0;
+
+        if(FILE_EXISTS)
+        {
+            QFileInfo fileInfo = SQFile::GetFileInfo(filePath, eErrorInfo);
+            uFileSize = eOpenMode == EQFileOpenMode::E_CreateOrOverwrite ? 0 : 
+                                                                           fileInfo.GetSize();
+            m_bWritingIsAllowed = !fileInfo.IsReadOnly();
+            
+            QE_ASSERT_ERROR(!(fileInfo.IsReadOnly() && eOpenMode == EQFileOpenMode::E_CreateOrOverwrite), string_q("The current user does not have permissions to overwrite the file \"") + filePath.GetAbsolutePath() + "\".");
+        }
+        else
+        {
+            m_bWritingIsAllowed = true;
+        }
+
+        QE_ASSERT_WARNING(uFileSize <= pointer_uint_q(-1), "The the file is too large, this class cannot access file offsets over 2^32 - 1 when it is compiled for x86 architecture.");
+
+        if(uFileSize > pointer_uint_q(-1))
+        {
+            eErrorInfo = EQFileSystemError::E_FileIsTooLarge;
+        }
+        else if(QMappedFileStream::_OpenPlatformImplementation(filePath, eOpenMode, m_bWritingIsAllowed, m_nativeHandle, eErrorInfo))
+        {
+            m_path = filePath;
+            m_uFileSize = scast_q(uFileSize, pointer_uint_q);
+            m_uReservedSize = m_uFileSize;
+            m_uWindowOffset = 0;
+            m_uMappedSize = 0;
+            m_pMappedFile = null_q;
+            m_bIsWritePending = false;
+            eErrorInfo = EQFileSystemError::E_Success;
+
+            // Windows start at multiples of the allocation granularity, so their size is rounded up to a multiple of it too
+            m_uAllocationGranularity = QMappedFileStream::_GetAllocationGranularityPlatformImplementation();
+            m_uWindowSize = uWindowSize == 0 ? m_uAllocationGranularity :
+                                               ((uWindowSize - 1U) / m_uAllocationGranularity + 1U) * m_uAllocationGranularity;
+
+            // Empty files cannot be mapped; they will be mapped when something is written
+            pointer_uint_q uMappedBytes = 0;
+
+            if(m_uFileSize > 0 && this->_MapWindow(0, uMappedBytes) == null_q)
+                eErrorInfo = EQFileSystemError::E_Unknown;
+
+            if(eErrorInfo == EQFileSystemError::E_Success)
+            {
+                m_bIsOpen = true;
+                m_uPositionPointer = eOpenMode == EQFileOpenMode::E_Append ? m_uFileSize :
+                                                                             0;
+            }
+            else
+            {
+                QMappedFileStream::_ClosePlatformImplementation(m_nativeHandle, m_path);
+                m_uFileSize = 0;
+                m_uReservedSize = 0;
+            }
+        }
+    }
+    else if(FILE_EXISTS && eOpenMode == EQFileOpenMode::E_Create)
+    {
+        eErrorInfo = EQFileSystemError::E_AlreadyExists;
+    }
+    else
+    {
+        eErrorInfo = EQFileSystemError::E_DoesNotExist;
+    }
+
+    return eErrorInfo;
+}
+
+void QMappedFileStream::Close()
+{
+    QE_ASSERT_WARNING(m_bIsOpen == true, "The file was already closed.");
+
+    if(m_bIsOpen)
+    {
+        if(m_bIsWritePending)
+            this->Flush();
+
+        this->_UnmapWindow();
+
+        // The space reserved when the stream grew is removed from the file
+        if(m_uReservedSize != m_uFileSize)
+            QMappedFileStream::_ResizePlatformImplementation(m_nativeHandle, m_uFileSize, m_path);
+
+        m_uReservedSize = 0;
+
+        bool bOperationSuccessful = QMappedFileStream::_ClosePlatformImplementation(m_nativeHandle, m_path);
+
+        if(bOperationSuccessful)
+        {
+            m_bIsOpen = false;
+        }
+    }
+}
+
+bool QMappedFileStream::_ResizeByFactor(const pointer_uint_q uBytes)
+{
+    const pointer_uint_q FACTORED_SIZE = scast_q(scast_q(uBytes, float) * QMappedFileStream::_REALLOCATION_FACTOR, pointer_uint_q);
+    const pointer_uint_q FINAL_SIZE = FACTORED_SIZE < uBytes ? uBytes : FACTORED_SIZE;
+
+    // Files cannot be resized while they are mapped on some systems; the window will be mapped again when it is accessed
+    this->_UnmapWindow();
+
+    if(QMappedFileStream::_ResizePlatformImplementation(m_nativeHandle, FINAL_SIZE, m_path))
+        m_uReservedSize = FINAL_SIZE;
+
+    return m_uReservedSize >= uBytes;
+}
+
+u8_q* QMappedFileStream::_MapWindow(const pointer_uint_q uPosition, pointer_uint_q &uMappedBytes)
+{
+    const bool IS_POSITION_MAPPED = m_pMappedFile != null_q && uPosition >= m_uWindowOffset && uPosition - m_uWindowOffset < m_uMappedSize;
+
+    if(!IS_POSITION_MAPPED && uPosition < m_uReservedSize)
+    {
+        this->_UnmapWindow();
+
+        const pointer_uint_q WINDOW_OFFSET = uPosition - uPosition % m_uAllocationGranularity;
+        const pointer_uint_q WINDOW_SIZE = m_uReservedSize - WINDOW_OFFSET < m_uWindowSize ? m_uReservedSize - WINDOW_OFFSET :
+                                                                                             m_uWindowSize;
+
+        m_pMappedFile = QMappedFileStream::_MapPlatformImplementation(m_nativeHandle, WINDOW_OFFSET, WINDOW_SIZE, m_bWritingIsAllowed, m_path);
+
+        if(m_pMappedFile != null_q)
+        {
+            m_uWindowOffset = WINDOW_OFFSET;
+            m_uMappedSize = WINDOW_SIZE;
+        }
+    }
+
+    u8_q* pPosition = null_q;
+    uMappedBytes = 0;
+
+    if(m_pMappedFile != null_q && uPosition >= m_uWindowOffset && uPosition - m_uWindowOffset < m_uMappedSize)
+    {
+        pPosition = scast_q(m_pMappedFile, u8_q*) + (uPosition - m_uWindowOffset);
+        uMappedBytes = m_uMappedSize - (uPosition - m_uWindowOffset);
+    }
+
+    return pPosition;
+}
+
+void QMappedFileStream::_UnmapWindow()
+{
+    if(m_pMappedFile != null_q)
+    {
+        QMappedFileStream::_UnmapPlatformImplementation(m_pMappedFile, m_uMappedSize, m_path);
+        m_pMappedFile = null_q;
+        m_uWindowOffset = 0;
+        m_uMappedSize = 0;
+    }
+}
+
+#if defined(QE_OS_WINDOWS)
+
+void* QMappedFileStream::_MapPlatformImplementation(const QMappedFileStream::NativeHandle &handle, const pointer_uint_q uOffset, const pointer_uint_q uSize, const bool bIsWritingAllowed, const QPath &filePath)
+{
+    const u64_q OFFSET = uOffset;
+    DWORD uProtection = bIsWritingAllowed ? PAGE_READWRITE : 
+                                            PAGE_READONLY;
+    DWORD uAccess = bIsWritingAllowed ? FILE_MAP_WRITE : 
+                                        FILE_MAP_READ;
+    void* pMappedFile = null_q;
+
+    // The mapping object covers the whole file; only the window is mapped into the address space
+    HANDLE mappingHandle = ::CreateFileMappingW(handle, NULL, uProtection, 0, 0, NULL);
+
+    if(mappingHandle == NULL)
+    {
+        DWORD uCreateFileMappingWLastError = ::GetLastError();
+        QE_ASSERT_ERROR(mappingHandle != NULL, string_q("An unexpected error occurred when mapping the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(uCreateFileMappingWLastError) + ".");
+    }
+    else
+    {
+        pMappedFile = ::MapViewOfFile(mappingHandle, uAccess, scast_q(OFFSET >> 32U, DWORD), scast_q(OFFSET & 0xFFFFFFFFU, DWORD), uSize);
+
+        if(pMappedFile == NULL)
+        {
+            DWORD uMapViewOfFileLastError = ::GetLastError();
+            QE_ASSERT_ERROR(pMappedFile != NULL, string_q("An unexpected error occurred when mapping the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(uMapViewOfFileLastError) + ".");
+        }
+
+        // The view keeps a reference to the mapping object, which is destroyed when the view is unmapped
+        ::CloseHandle(mappingHandle);
+    }
+
+    return pMappedFile;
+}
+
+bool QMappedFileStream::_UnmapPlatformImplementation(void* pMappedFile, const pointer_uint_q uSize, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+    static const BOOL UNMAP_OPERATION_FAILED = 0;
+    BOOL uUnmapViewOfFileResult = ::UnmapViewOfFile(pMappedFile);
+
+    if(uUnmapViewOfFileResult == UNMAP_OPERATION_FAILED)
+    {
+        bSuccess = false;
+        DWORD uUnmapViewOfFileLastError = ::GetLastError();
+        QE_ASSERT_ERROR(uUnmapViewOfFileResult != UNMAP_OPERATION_FAILED, string_q("An unexpected error occurred when unmapping the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(uUnmapViewOfFileLastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+bool QMappedFileStream::_FlushPlatformImplementation(void* pMappedFile, const pointer_uint_q uSize, const QMappedFileStream::NativeHandle &handle, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+    // FlushViewOfFile does not wait for the data to be written to the device, FlushFileBuffers does
+    static const BOOL FLUSH_OPERATION_FAILED = 0;
+    BOOL uFlushResult = pMappedFile == null_q ? TRUE : 
+                                                ::FlushViewOfFile(pMappedFile, uSize);
+
+    if(uFlushResult != FLUSH_OPERATION_FAILED)
+        uFlushResult = ::FlushFileBuffers(handle);
+
+    if(uFlushResult == FLUSH_OPERATION_FAILED)
+    {
+        bSuccess = false;
+        DWORD uFlushLastError = ::GetLastError();
+        QE_ASSERT_WARNING(uFlushResult != FLUSH_OPERATION_FAILED, string_q("An unexpected error occurred when writing to the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(uFlushLastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+bool QMappedFileStream::_ResizePlatformImplementation(const QMappedFileStream::NativeHandle &handle, const pointer_uint_q uSize, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+    LARGE_INTEGER newSize;
+    newSize.QuadPart = uSize;
+
+    static const BOOL RESIZE_OPERATION_FAILED = 0;
+    BOOL uResizeResult = ::SetFilePointerEx(handle, newSize, NULL, FILE_BEGIN);
+
+    if(uResizeResult != RESIZE_OPERATION_FAILED)
+        uResizeResult = ::SetEndOfFile(handle);
+
+    if(uResizeResult == RESIZE_OPERATION_FAILED)
+    {
+        bSuccess = false;
+        DWORD uResizeLastError = ::GetLastError();
+        QE_ASSERT_WARNING(uResizeResult != RESIZE_OPERATION_FAILED, string_q("An unexpected error occurred when resizing the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(uResizeLastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+bool QMappedFileStream::_OpenPlatformImplementation(const QPath &filePath, const EQFileOpenMode &eOpenMode, const bool bIsWritingAllowed, QMappedFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo)
+{
+    bool bSuccess = true;
+
+    using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+    using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+
+    QArrayResult<i8_q> arPath = filePath.ToString().ToBytes(string_q::GetLocalEncodingUTF16());
+    const wchar_t* szPath = rcast_q(arPath.Get(), wchar_t*);
+    DWORD uAccess = bIsWritingAllowed ? GENERIC_READ | GENERIC_WRITE : 
+                                        GENERIC_READ;
+    DWORD uOpenMode = 0;
+
+    switch(eOpenMode)
+    {
+    case EQFileOpenMode::E_Append:
+    case EQFileOpenMode::E_Open:
+        uOpenMode = OPEN_EXISTING;
+        break;
+    case EQFileOpenMode::E_Create:
+        uOpenMode = CREATE_NEW;
+        break;
+    case EQFileOpenMode::E_CreateOrOverwrite:
+        uOpenMode = CREATE_ALWAYS;
+        break;
+    case EQFileOpenMode::E_OpenOrCreate:
+        uOpenMode = OPEN_ALWAYS;
+        break;
+    default:
+        break;
+    }
+
+    handle = ::CreateFileW(szPath, uAccess, FILE_SHARE_READ, NULL, uOpenMode, FILE_FLAG_RANDOM_ACCESS, NULL);
+
+    const bool FILE_OPENED_SUCCESSFULLY = handle != INVALID_HANDLE_VALUE;
+
+    if(!FILE_OPENED_SUCCESSFULLY)
+    {
+        bSuccess = false;
+        DWORD uCreateFileWLastError = ::GetLastError();
+        QE_ASSERT_ERROR(handle != INVALID_HANDLE_VALUE, string_q("An unexpected error occurred when opening the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(uCreateFileWLastError) + ".");
+
+        if(uCreateFileWLastError == ERROR_ACCESS_DENIED)
+            eErrorInfo = EQFileSystemError::E_NoPermissions;
+        else
+            eErrorInfo = EQFileSystemError::E_Unknown;
+    }
+
+    return bSuccess;
+}
+
+bool QMappedFileStream::_ClosePlatformImplementation(const QMappedFileStream::NativeHandle &handle, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+    static const BOOL CLOSE_OPERATION_FAILED = 0;
+    BOOL uCloseHandleResult = ::CloseHandle(handle);
+
+    if(uCloseHandleResult == CLOSE_OPERATION_FAILED)
+    {
+        bSuccess = false;
+        DWORD uCloseHandleLastError = ::GetLastError();
+        QE_ASSERT_ERROR(uCloseHandleResult != 0, string_q("An unexpected error occurred when closing the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(uCloseHandleLastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+pointer_uint_q QMappedFileStream::_GetAllocationGranularityPlatformImplementation()
+{
+    SYSTEM_INFO systemInfo;
+    ::GetSystemInfo(&systemInfo);
+
+    return systemInfo.dwAllocationGranularity;
+}
+
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+
+void* QMappedFileStream::_MapPlatformImplementation(const QMappedFileStream::NativeHandle &handle, const pointer_uint_q uOffset, const pointer_uint_q uSize, const bool bIsWritingAllowed, const QPath &filePath)
+{
+    int nProtection = bIsWritingAllowed ? PROT_READ | PROT_WRITE : 
+                                          PROT_READ;
+
+#if defined(QE_OS_LINUX)
+    // The 64-bits version is necessary to map offsets over 2 GB on 32-bits systems
+    void* pMappedFile = mmap64(null_q, uSize, nProtection, MAP_SHARED, handle, scast_q(uOffset, off64_t));
+#else
+    void* pMappedFile = mmap(null_q, uSize, nProtection, MAP_SHARED, handle, scast_q(uOffset, off_t));
+#endif
+
+    if(pMappedFile == MAP_FAILED)
+    {
+        pMappedFile = null_q;
+        error_t lastError = errno;
+        QE_ASSERT_ERROR(pMappedFile != null_q, string_q("An unexpected error occurred when mapping the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(lastError) + ".");
+    }
+
+    return pMappedFile;
+}
+
+bool QMappedFileStream::_UnmapPlatformImplementation(void* pMappedFile, const pointer_uint_q uSize, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+    int nResult = munmap(pMappedFile, uSize);
+
+    if(nResult < 0)
+    {
+        bSuccess = false;
+        error_t lastError = errno;
+        QE_ASSERT_ERROR(nResult >= 0, string_q("An unexpected error occurred when unmapping the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(lastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+bool QMappedFileStream::_FlushPlatformImplementation(void* pMappedFile, const pointer_uint_q uSize, const QMappedFileStream::NativeHandle &handle, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+    int nResult = pMappedFile == null_q ? 0 : 
+                                          msync(pMappedFile, uSize, MS_SYNC);
+
+    // The pages of the windows that were unmapped are written by the operating system; the file is synchronized to wait for them
+    if(nResult >= 0)
+        nResult = fsync(handle);
+
+    if(nResult < 0)
+    {
+        bSuccess = false;
+        error_t lastError = errno;
+        QE_ASSERT_WARNING(nResult >= 0, string_q("An unexpected error occurred when writing to the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(lastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+bool QMappedFileStream::_ResizePlatformImplementation(const QMappedFileStream::NativeHandle &handle, const pointer_uint_q uSize, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+#if defined(QE_OS_LINUX)
+    int nResult = ftruncate64(handle, scast_q(uSize, off64_t));
+#else
+    int nResult = ftruncate(handle, scast_q(uSize, off_t));
+#endif
+
+    if(nResult < 0)
+    {
+        bSuccess = false;
+        error_t lastError = errno;
+        QE_ASSERT_WARNING(nResult >= 0, string_q("An unexpected error occurred when resizing the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(lastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+bool QMappedFileStream::_OpenPlatformImplementation(const QPath &filePath, const EQFileOpenMode &eOpenMode, const bool bIsWritingAllowed, QMappedFileStream::NativeHandle &handle, EQFileSystemError &eErrorInfo)
+{
+    bool bSuccess = true;
+
+    using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+    using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+    using Kinesis::QuimeraEngine::Common::DataTypes::EQTextEncoding;
+
+    QArrayResult<i8_q> szPath = filePath.ToString().ToBytes(EQTextEncoding::E_UTF8);
+        
+    int nAccess = bIsWritingAllowed ? O_RDWR: 
+                                      O_RDONLY;
+
+#if defined(QE_OS_LINUX)
+    nAccess |= O_LARGEFILE; // Files over 2 GB cannot be opened on 32-bits systems otherwise
+#endif
+    int nPermissions = S_IRWXU; // Read, write and execution permissions for the owner
+    int nOpenMode = 0;
+
+    switch(eOpenMode)
+    {
+    case EQFileOpenMode::E_Append:
+    case EQFileOpenMode::E_Open:
+        nOpenMode = 0;
+        break;
+    case EQFileOpenMode::E_Create:
+        nOpenMode = O_CREAT | O_EXCL;
+        break;
+    case EQFileOpenMode::E_CreateOrOverwrite:
+        nOpenMode = O_CREAT | O_TRUNC;
+        break;
+    case EQFileOpenMode::E_OpenOrCreate:
+        nOpenMode = O_CREAT;
+        break;
+    default:
+        break;
+    }
+        
+    handle = open(szPath.Get(), nAccess | nOpenMode, nPermissions);
+
+    const bool FILE_OPENED_SUCCESSFULLY = handle >= 0;
+        
+    if(!FILE_OPENED_SUCCESSFULLY)
+    {
+        bSuccess = false;
+        error_t lastError = errno;
+        QE_ASSERT_ERROR(handle >= 0, string_q("An unexpected error occurred when opening the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(lastError) + ".");
+            
+        if(lastError == EACCES)
+            eErrorInfo = EQFileSystemError::E_NoPermissions;
+        else
+            eErrorInfo = EQFileSystemError::E_Unknown;
+    }
+
+    return bSuccess;
+}
+
+bool QMappedFileStream::_ClosePlatformImplementation(const QMappedFileStream::NativeHandle &handle, const QPath &filePath)
+{
+    bool bSuccess = true;
+
+    int nResult = close(handle);
+
+    if(nResult < 0)
+    {
+        bSuccess = false;
+        error_t lastError = errno;
+        QE_ASSERT_ERROR(nResult >= 0, string_q("An unexpected error occurred when closing the file \"") + filePath.GetAbsolutePath() + "\". The error code was: " + string_q::FromInteger(lastError) + ".");
+    }
+
+    return bSuccess;
+}
+
+pointer_uint_q QMappedFileStream::_GetAllocationGranularityPlatformImplementation()
+{
+    return scast_q(sysconf(_SC_PAGESIZE), pointer_uint_q);
+}
+
+#endif
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+pointer_uint_q QMappedFileStream::GetLength() const
+{
+    QE_ASSERT_WARNING(m_bIsOpen == true, "The file is not open.");
+
+    return m_uFileSize;
+}
+
+pointer_uint_q QMappedFileStream::GetPosition() const
+{
+    return m_uPositionPointer;
+}
+
+void QMappedFileStream::SetPosition(const pointer_uint_q uPosition)
+{
+    QE_ASSERT_WARNING(m_bIsOpen == true, "The file is not open.");
+    QE_ASSERT_WARNING(uPosition <= m_uFileSize, "It is not possible to set the specified position, it would be out of bounds.");
+
+    if(uPosition <= m_uFileSize)
+        m_uPositionPointer = uPosition;
+}
+
+QPath QMappedFileStream::GetPath() const
+{
+    return m_path;
+}
+
+bool QMappedFileStream::IsOpen() const
+{
+    return m_bIsOpen;
+}
+
+QMappedFileStream::NativeHandle QMappedFileStream::GetNativeHandle() const
+{
+    QE_ASSERT_ERROR(m_bIsOpen == true, "The file is not open.");
+
+    return m_nativeHandle;
+}
+
+void* QMappedFileStream::GetCurrentPointer()
+{
+    QE_ASSERT_WARNING(m_bIsOpen == true, "The file is not open.");
+
+    pointer_uint_q uMappedBytes = 0;
+
+    return m_uPositionPointer < m_uFileSize ? this->_MapWindow(m_uPositionPointer, uMappedBytes) :
+                                              null_q;
+}
+
+pointer_uint_q QMappedFileStream::GetAccessibleBytes() const
+{
+    const bool IS_POSITION_MAPPED = m_pMappedFile != null_q && m_uPositionPointer >= m_uWindowOffset && m_uPositionPointer - m_uWindowOffset < m_uMappedSize;
+    const pointer_uint_q WINDOW_END = m_uWindowOffset + m_uMappedSize;
+
+    // The window may include space reserved beyond the end of the stream
+    return !IS_POSITION_MAPPED       ? 0 :
+           WINDOW_END < m_uFileSize ? WINDOW_END - m_uPositionPointer :
+                                      m_uFileSize - m_uPositionPointer;
+}
+
+pointer_uint_q QMappedFileStream::GetWindowSize() const
+{
+    return m_uWindowSize;
+}
+
+
+} //namespace FileSystem
+} //namespace IO
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -29,6 +29,7 @@
 #include "Assertions.h"
 #include "SQAngle.h"
 #include "SQFloat.h"
+#include "SQMatrixSIMD.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
 
@@ -146,6 +147,11 @@ QMatrix4x4 operator*(const float_q fScalar, const QMatrix4x4 &matrix)
 
 QMatrix4x4 QMatrix4x4::operator*(const QBaseMatrix4x4 &matrix) const
 {
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    QMatrix4x4 aux;
+    SQMatrixSIMD::Multiply(*this, matrix, aux);
+    return aux;
+#else
     QMatrix4x4 aux;
 
     aux.ij[0][0] = this->ij[0][0] * matrix.ij[0][0] + this->ij[0][1] * matrix.ij[1][0] + this->ij[0][2] * matrix.ij[2][0] + this->ij[0][3] * matrix.ij[3][0];
@@ -169,10 +175,16 @@ QMatrix4x4 QMatrix4x4::operator*(const QBaseMatrix4x4 &matrix) const
     aux.ij[3][3] = this->ij[3][0] * matrix.ij[0][3] + this->ij[3][1] * matrix.ij[1][3] + this->ij[3][2] * matrix.ij[2][3] + this->ij[3][3] * matrix.ij[3][3];
 
     return aux;
+#endif
 }
 
 QBaseMatrix4x3 QMatrix4x4::operator*(const QBaseMatrix4x3 &matrix) const
 {
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    QBaseMatrix4x3 aux;
+    SQMatrixSIMD::Multiply(*this, matrix, aux);
+    return aux;
+#else
     QBaseMatrix4x3 aux;
 
     aux.ij[0][0] = this->ij[0][0] * matrix.ij[0][0] + this->ij[0][1] * matrix.ij[1][0] + this->ij[0][2] * matrix.ij[2][0] + this->ij[0][3] * matrix.ij[3][0];
@@ -192,6 +204,7 @@ QBaseMatrix4x3 QMatrix4x4::operator*(const QBaseMatrix4x3 &matrix) const
     aux.ij[3][2] = this->ij[3][0] * matrix.ij[0][2] + this->ij[3][1] * matrix.ij[1][2] + this->ij[3][2] * matrix.ij[2][2] + this->ij[3][3] * matrix.ij[3][2];
 
     return aux;
+#endif
 }
 
 QMatrix4x4 QMatrix4x4::operator/(const float_q fScalar) const
@@ -273,6 +286,10 @@ QMatrix4x4 QMatrix4x4::operator-(const QBaseMatrix4x4 &matrix) const
 
 QMatrix4x4& QMatrix4x4::operator*=(const QBaseMatrix4x4 &matrix)
 {
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    SQMatrixSIMD::Multiply(*this, matrix, *this);
+    return *this;
+#else
     QMatrix4x4 aux;
 
     aux.ij[0][0] = this->ij[0][0] * matrix.ij[0][0] + this->ij[0][1] * matrix.ij[1][0] + this->ij[0][2] * matrix.ij[2][0] + this->ij[0][3] * matrix.ij[3][0];
@@ -298,6 +315,7 @@ QMatrix4x4& QMatrix4x4::operator*=(const QBaseMatrix4x4 &matrix)
     *this = aux;
 
     return *this;
+#endif
 }
 
 QMatrix4x4& QMatrix4x4::operator*=(const float_q fScalar)
@@ -402,10 +420,16 @@ void QMatrix4x4::ResetToIdentity()
 
 QMatrix4x4 QMatrix4x4::Transpose() const
 {
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    QMatrix4x4 aux;
+    SQMatrixSIMD::Transpose(*this, aux);
+    return aux;
+#else
     return QMatrix4x4(this->ij[0][0], this->ij[1][0], this->ij[2][0], this->ij[3][0],
                       this->ij[0][1], this->ij[1][1], this->ij[2][1], this->ij[3][1],
                       this->ij[0][2], this->ij[1][2], this->ij[2][2], this->ij[3][2],
                       this->ij[0][3], this->ij[1][3], this->ij[2][3], this->ij[3][3]);
+#endif
 }
 
 bool QMatrix4x4::IsZero() const
@@ -477,11 +501,16 @@ float_q QMatrix4x4::GetDeterminant() const
 
 QMatrix4x4 QMatrix4x4::Invert() const
 {
-    // Based on http://www.cg.info.hiroshima-cu.ac.jp/~miyazaki/knowledge/teche23.html
-
     // The results will be wrong when the determinant equals zero
     QE_ASSERT_WARNING( this->GetDeterminant() != SQFloat::_0, "Matrices whose determinant equals zero do not have inverse" );
 
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    QMatrix4x4 aux;
+    SQMatrixSIMD::Invert(*this, aux);
+    return aux;
+#else
+    // Based on http://www.cg.info.hiroshima-cu.ac.jp/~miyazaki/knowledge/teche23.html
+
     // Gets the inverse of the Determinant.
     const float_q fInvDet = SQFloat::_1 / this->GetDeterminant();
 
@@ -544,6 +573,7 @@ QMatrix4x4 QMatrix4x4::Invert() const
                                   fA * this->ij[3][2] - fQ * this->ij[3][0] - fX * this->ij[3][1] ),
                        fInvDet * (fA * this->ij[2][2] + fQ * this->ij[2][0] + fX * this->ij[2][1] -
                                   fU * this->ij[2][1] - fE * this->ij[2][2] - fT * this->ij[2][0] ));
+#endif
 }
 
 bool QMatrix4x4::HasInverse() const
@@ -309,6 +309,47 @@ void QPoolAllocator::Reallocate(const pointer_uint_q uNewSize, const void* pNewL
     }
 }
 
+void QPoolAllocator::Swap(QPoolAllocator &poolAllocator)
+{
+    QE_ASSERT_ERROR(&poolAllocator != this, "The input allocator must not be the resident allocator.");
+
+    void** ppFreeBlocks = m_ppFreeBlocks;
+    void** ppNextFreeBlock = m_ppNextFreeBlock;
+    void* pFirst = m_pFirst;
+    const pointer_uint_q uBlockSize = m_uBlockSize;
+    const pointer_uint_q uPoolSize = m_uPoolSize;
+    const pointer_uint_q uSize = m_uSize;
+    const pointer_uint_q uAllocatedBytes = m_uAllocatedBytes;
+    const QAlignment uAlignment = m_uAlignment;
+    void* pAllocatedMemory = m_pAllocatedMemory;
+    const pointer_uint_q uBlocksCount = m_uBlocksCount;
+    const bool bNeedDestroyMemoryChunk = m_bNeedDestroyMemoryChunk;
+
+    m_ppFreeBlocks = poolAllocator.m_ppFreeBlocks;
+    m_ppNextFreeBlock = poolAllocator.m_ppNextFreeBlock;
+    m_pFirst = poolAllocator.m_pFirst;
+    m_uBlockSize = poolAllocator.m_uBlockSize;
+    m_uPoolSize = poolAllocator.m_uPoolSize;
+    m_uSize = poolAllocator.m_uSize;
+    m_uAllocatedBytes = poolAllocator.m_uAllocatedBytes;
+    m_uAlignment = poolAllocator.m_uAlignment;
+    m_pAllocatedMemory = poolAllocator.m_pAllocatedMemory;
+    m_uBlocksCount = poolAllocator.m_uBlocksCount;
+    m_bNeedDestroyMemoryChunk = poolAllocator.m_bNeedDestroyMemoryChunk;
+
+    poolAllocator.m_ppFreeBlocks = ppFreeBlocks;
+    poolAllocator.m_ppNextFreeBlock = ppNextFreeBlock;
+    poolAllocator.m_pFirst = pFirst;
+    poolAllocator.m_uBlockSize = uBlockSize;
+    poolAllocator.m_uPoolSize = uPoolSize;
+    poolAllocator.m_uSize = uSize;
+    poolAllocator.m_uAllocatedBytes = uAllocatedBytes;
+    poolAllocator.m_uAlignment = uAlignment;
+    poolAllocator.m_pAllocatedMemory = pAllocatedMemory;
+    poolAllocator.m_uBlocksCount = uBlocksCount;
+    poolAllocator.m_bNeedDestroyMemoryChunk = bNeedDestroyMemoryChunk;
+}
+
 void QPoolAllocator::AllocateFreeBlocksList()
 {
     m_ppFreeBlocks = (void**) operator new(m_uBlocksCount * sizeof(void**));
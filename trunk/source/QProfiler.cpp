@@ -0,0 +1,519 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "QProfiler.h"
+
+#include <cstring>
+
+#include "Assertions.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Diagnosis
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const u32_q QProfiler::SAMPLES_PER_THREAD = 16384U;
+const pointer_uint_q QProfiler::NO_PARENT = -1;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QProfiler::QProfiler() : m_pRegisteredThreadSamples(null_q),
+                         m_currentThreadSamples(&QProfiler::ReleaseThreadSamples),
+                         m_uThreadCount(0)
+{
+    m_stopwatch.Set();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QProfiler::~QProfiler()
+{
+    // The node of the current thread is about to be freed, so it must not be released when the thread-specific pointer is destroyed
+    m_currentThreadSamples.release();
+
+    QThreadSamples* pThreadSamples = m_pRegisteredThreadSamples.load(boost::memory_order_acquire);
+
+    while(pThreadSamples != null_q)
+    {
+        QThreadSamples* pNextThreadSamples = pThreadSamples->m_pNext;
+        delete pThreadSamples;
+        pThreadSamples = pNextThreadSamples;
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QProfiler* QProfiler::Get()
+{
+    static QProfiler profilerInstance;
+
+    return &profilerInstance;
+}
+
+u64_q QProfiler::BeginSample()
+{
+    ++this->GetCurrentThreadSamples()->m_uCurrentDepth;
+
+    return m_stopwatch.GetElapsedTimeAsInteger();
+}
+
+void QProfiler::EndSample(const char* szName, const u64_q uStart)
+{
+    QE_ASSERT_ERROR(szName != null_q, "The name of the scope must not be null.");
+
+    const u64_q END = m_stopwatch.GetElapsedTimeAsInteger();
+    QThreadSamples* pThreadSamples = this->GetCurrentThreadSamples();
+
+    QE_ASSERT_ERROR(pThreadSamples->m_uCurrentDepth > 0, "A sample cannot end before it begins.");
+
+    --pThreadSamples->m_uCurrentDepth;
+
+    // Only this thread writes the ring buffer, the count is published after the sample is written so readers do not see it half written
+    const u64_q SAMPLE_COUNT = pThreadSamples->m_uSampleCount.load(boost::memory_order_relaxed);
+    QSample &sample = pThreadSamples->m_arSamples[SAMPLE_COUNT & (SAMPLES_PER_THREAD - 1U)];
+    sample.m_szName = szName;
+    sample.m_uStart = uStart;
+    sample.m_uEnd = END;
+    sample.m_uDepth = pThreadSamples->m_uCurrentDepth;
+
+    pThreadSamples->m_uSampleCount.store(SAMPLE_COUNT + 1U, boost::memory_order_release);
+}
+
+void QProfiler::Clear()
+{
+    QThreadSamples* pThreadSamples = m_pRegisteredThreadSamples.load(boost::memory_order_acquire);
+
+    while(pThreadSamples != null_q)
+    {
+        pThreadSamples->m_uFirstSample.store(pThreadSamples->m_uSampleCount.load(boost::memory_order_acquire), boost::memory_order_relaxed);
+        pThreadSamples = pThreadSamples->m_pNext;
+    }
+}
+
+string_q QProfiler::ExportToChromeTrace() const
+{
+    string_q strTrace("{\"traceEvents\":[");
+    bool bIsFirstEvent = true;
+    QArrayDynamic<QSample> arSamples;
+
+    const QThreadSamples* pThreadSamples = m_pRegisteredThreadSamples.load(boost::memory_order_acquire);
+
+    while(pThreadSamples != null_q)
+    {
+        arSamples.Clear();
+        QProfiler::CopySamples(*pThreadSamples, arSamples);
+
+        if(!arSamples.IsEmpty())
+        {
+            const u32_q THREAD_INDEX = pThreadSamples->m_uThreadIndex.load(boost::memory_order_relaxed);
+
+            // Metadata event that names the thread
+            strTrace.Append(bIsFirstEvent ? "\n" : ",\n");
+            strTrace.Append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+            strTrace.Append(THREAD_INDEX);
+            strTrace.Append(",\"args\":{\"name\":\"Thread ");
+            strTrace.Append(THREAD_INDEX);
+            strTrace.Append("\"}}");
+            bIsFirstEvent = false;
+
+            const pointer_uint_q SAMPLE_COUNT = arSamples.GetCount();
+
+            for(pointer_uint_q i = 0; i < SAMPLE_COUNT; ++i)
+            {
+                strTrace.Append(",\n{\"name\":");
+                QProfiler::AppendJsonString(arSamples[i].m_szName, strTrace);
+                strTrace.Append(",\"cat\":\"QE\",\"ph\":\"X\",\"ts\":");
+                QProfiler::AppendMicroseconds(arSamples[i].m_uStart, strTrace);
+                strTrace.Append(",\"dur\":");
+                QProfiler::AppendMicroseconds(arSamples[i].m_uEnd - arSamples[i].m_uStart, strTrace);
+                strTrace.Append(",\"pid\":1,\"tid\":");
+                strTrace.Append(THREAD_INDEX);
+                strTrace.Append("}");
+            }
+        }
+
+        pThreadSamples = pThreadSamples->m_pNext;
+    }
+
+    strTrace.Append("\n],\"displayTimeUnit\":\"ns\"}");
+
+    return strTrace;
+}
+
+string_q QProfiler::GetSummary() const
+{
+    QArrayDynamic<QSample> arSamples;
+    QArrayDynamic<QScopeSummary> arFlatSummaries;
+    QArrayDynamic<QScopeSummary> arHierarchicalSummaries;
+
+    const QThreadSamples* pThreadSamples = m_pRegisteredThreadSamples.load(boost::memory_order_acquire);
+
+    while(pThreadSamples != null_q)
+    {
+        arSamples.Clear();
+        QProfiler::CopySamples(*pThreadSamples, arSamples);
+        QProfiler::AddToSummaries(arSamples, arFlatSummaries, arHierarchicalSummaries);
+        pThreadSamples = pThreadSamples->m_pNext;
+    }
+
+    // The flat summaries are sorted by self time, in descending order
+    const pointer_uint_q SUMMARY_COUNT = arFlatSummaries.GetCount();
+
+    for(pointer_uint_q i = 1U; i < SUMMARY_COUNT; ++i)
+        for(pointer_uint_q j = i; j > 0 && arFlatSummaries[j - 1U].m_uSelfTime < arFlatSummaries[j].m_uSelfTime; --j)
+            arFlatSummaries.Swap(j - 1U, j);
+
+    string_q strSummary("Flat profile\n");
+
+    for(pointer_uint_q i = 0; i < SUMMARY_COUNT; ++i)
+        QProfiler::AppendSummary(arFlatSummaries[i], strSummary);
+
+    strSummary.Append("\nHierarchical profile\n");
+    QProfiler::AppendHierarchicalSummaries(arHierarchicalSummaries, NO_PARENT, 0, strSummary);
+
+    return strSummary;
+}
+
+QProfiler::QThreadSamples* QProfiler::GetCurrentThreadSamples()
+{
+    // Only the first call of every thread accesses the list of registered ring buffers
+    static threadlocal_q QThreadSamples* pCurrentThreadSamples = null_q;
+
+    if(pCurrentThreadSamples == null_q)
+        pCurrentThreadSamples = this->RegisterCurrentThread();
+
+    return pCurrentThreadSamples;
+}
+
+QProfiler::QThreadSamples* QProfiler::RegisterCurrentThread()
+{
+    QThreadSamples* pThreadSamples = m_pRegisteredThreadSamples.load(boost::memory_order_acquire);
+    bool bReused = false;
+
+    // Searches for a ring buffer whose thread has finished
+    while(pThreadSamples != null_q && !bReused)
+    {
+        bool bInUse = false;
+        bReused = pThreadSamples->m_bInUse.compare_exchange_strong(bInUse, true, boost::memory_order_acquire);
+
+        if(!bReused)
+            pThreadSamples = pThreadSamples->m_pNext;
+    }
+
+    if(bReused)
+    {
+        // The samples of the finished thread are discarded and the current thread is identified by a new number
+        pThreadSamples->m_uFirstSample.store(pThreadSamples->m_uSampleCount.load(boost::memory_order_relaxed), boost::memory_order_relaxed);
+        pThreadSamples->m_uThreadIndex.store(m_uThreadCount.fetch_add(1U, boost::memory_order_relaxed), boost::memory_order_relaxed);
+        pThreadSamples->m_uCurrentDepth = 0;
+    }
+    else
+    {
+        pThreadSamples = new QThreadSamples();
+        pThreadSamples->m_uThreadIndex.store(m_uThreadCount.fetch_add(1U, boost::memory_order_relaxed), boost::memory_order_relaxed);
+        pThreadSamples->m_pNext = m_pRegisteredThreadSamples.load(boost::memory_order_relaxed);
+
+        // The node is added at the beginning of the list; if another thread added a node meanwhile, the next node is updated and it is tried again
+        while(!m_pRegisteredThreadSamples.compare_exchange_weak(pThreadSamples->m_pNext,
+                                                                pThreadSamples,
+                                                                boost::memory_order_release,
+                                                                boost::memory_order_relaxed));
+    }
+
+    m_currentThreadSamples.reset(pThreadSamples);
+
+    return pThreadSamples;
+}
+
+void QProfiler::ReleaseThreadSamples(QThreadSamples* pThreadSamples)
+{
+    pThreadSamples->m_bInUse.store(false, boost::memory_order_release);
+}
+
+void QProfiler::CopySamples(const QThreadSamples &threadSamples, QArrayDynamic<QSample> &arSamples)
+{
+    const u64_q SAMPLE_COUNT = threadSamples.m_uSampleCount.load(boost::memory_order_acquire);
+    const u64_q FIRST_SAMPLE = threadSamples.m_uFirstSample.load(boost::memory_order_relaxed);
+    const u64_q OLDEST_SAMPLE = SAMPLE_COUNT > SAMPLES_PER_THREAD ? SAMPLE_COUNT - SAMPLES_PER_THREAD : 0;
+    const u64_q FIRST_COPIED_SAMPLE = FIRST_SAMPLE > OLDEST_SAMPLE ? FIRST_SAMPLE : OLDEST_SAMPLE;
+
+    if(FIRST_COPIED_SAMPLE >= SAMPLE_COUNT)
+        return;
+
+    const pointer_uint_q INITIAL_COUNT = arSamples.GetCount();
+    arSamples.Reserve(INITIAL_COUNT + scast_q(SAMPLE_COUNT - FIRST_COPIED_SAMPLE, pointer_uint_q));
+
+    for(u64_q i = FIRST_COPIED_SAMPLE; i < SAMPLE_COUNT; ++i)
+        arSamples.Add(threadSamples.m_arSamples[i & (SAMPLES_PER_THREAD - 1U)]);
+
+    // The thread may have overwritten some of the copied samples meanwhile, including the one it may be writing now
+    boost::atomic_thread_fence(boost::memory_order_acquire);
+    const u64_q CURRENT_SAMPLE_COUNT = threadSamples.m_uSampleCount.load(boost::memory_order_relaxed);
+    const u64_q OLDEST_VALID_SAMPLE = CURRENT_SAMPLE_COUNT + 1U > SAMPLES_PER_THREAD ? CURRENT_SAMPLE_COUNT + 1U - SAMPLES_PER_THREAD : 0;
+
+    if(OLDEST_VALID_SAMPLE > FIRST_COPIED_SAMPLE)
+    {
+        const u64_q OVERWRITTEN_SAMPLES = OLDEST_VALID_SAMPLE - FIRST_COPIED_SAMPLE;
+        const pointer_uint_q COPIED_SAMPLES = scast_q(SAMPLE_COUNT - FIRST_COPIED_SAMPLE, pointer_uint_q);
+
+        if(OVERWRITTEN_SAMPLES >= COPIED_SAMPLES)
+            arSamples.RemoveRange(INITIAL_COUNT, arSamples.GetCount() - 1U);
+        else
+            arSamples.RemoveRange(INITIAL_COUNT, INITIAL_COUNT + scast_q(OVERWRITTEN_SAMPLES, pointer_uint_q) - 1U);
+    }
+}
+
+void QProfiler::AddToSummaries(const QArrayDynamic<QSample> &arSamples, 
+                               QArrayDynamic<QScopeSummary> &arFlatSummaries, 
+                               QArrayDynamic<QScopeSummary> &arHierarchicalSummaries)
+{
+    const pointer_uint_q SAMPLE_COUNT = arSamples.GetCount();
+
+    if(SAMPLE_COUNT == 0)
+        return;
+
+    QArrayDynamic<pointer_uint_q> arParents(SAMPLE_COUNT);
+    QArrayDynamic<u64_q> arSelfTimes(SAMPLE_COUNT);
+    QArrayDynamic<pointer_uint_q> arSamplesWithoutParent;
+
+    // Samples are recorded when scopes end, so the samples of the contained scopes are always before the sample of the
+    // scope that contains them, and they are the ones that are deeper and have not been assigned a parent yet
+    for(pointer_uint_q i = 0; i < SAMPLE_COUNT; ++i)
+    {
+        u64_q uContainedTime = 0;
+
+        while(!arSamplesWithoutParent.IsEmpty() && arSamples[*arSamplesWithoutParent.GetLast()].m_uDepth > arSamples[i].m_uDepth)
+        {
+            const pointer_uint_q CONTAINED_SAMPLE = *arSamplesWithoutParent.GetLast();
+            arParents[CONTAINED_SAMPLE] = i;
+            uContainedTime += arSamples[CONTAINED_SAMPLE].m_uEnd - arSamples[CONTAINED_SAMPLE].m_uStart;
+            arSamplesWithoutParent.Remove(arSamplesWithoutParent.GetCount() - 1U);
+        }
+
+        const u64_q TOTAL_TIME = arSamples[i].m_uEnd - arSamples[i].m_uStart;
+        arParents.Add(NO_PARENT);
+        arSelfTimes.Add(TOTAL_TIME > uContainedTime ? TOTAL_TIME - uContainedTime : 0);
+        arSamplesWithoutParent.Add(i);
+    }
+
+    // Samples are traversed backwards so the summary of the containing scope exists before the summaries of the contained scopes
+    QArrayDynamic<pointer_uint_q> arSummaryPositions(SAMPLE_COUNT);
+
+    for(pointer_uint_q i = 0; i < SAMPLE_COUNT; ++i)
+        arSummaryPositions.Add(NO_PARENT);
+
+    for(pointer_uint_q i = SAMPLE_COUNT; i > 0; --i)
+    {
+        const pointer_uint_q SAMPLE = i - 1U;
+        const pointer_uint_q PARENT_SUMMARY = arParents[SAMPLE] == NO_PARENT ? NO_PARENT : arSummaryPositions[arParents[SAMPLE]];
+
+        arSummaryPositions[SAMPLE] = QProfiler::AddToSummary(arSamples[SAMPLE], arSelfTimes[SAMPLE], PARENT_SUMMARY, arHierarchicalSummaries);
+        QProfiler::AddToSummary(arSamples[SAMPLE], arSelfTimes[SAMPLE], NO_PARENT, arFlatSummaries);
+    }
+}
+
+pointer_uint_q QProfiler::AddToSummary(const QSample &sample, const u64_q uSelfTime, const pointer_uint_q uParent, QArrayDynamic<QScopeSummary> &arSummaries)
+{
+    const pointer_uint_q SUMMARY_COUNT = arSummaries.GetCount();
+    pointer_uint_q uSummary = 0;
+
+    while(uSummary < SUMMARY_COUNT &&
+          (arSummaries[uSummary].m_uParent != uParent || 
+           (arSummaries[uSummary].m_szName != sample.m_szName && strcmp(arSummaries[uSummary].m_szName, sample.m_szName) != 0)))
+        ++uSummary;
+
+    if(uSummary == SUMMARY_COUNT)
+    {
+        QScopeSummary newSummary;
+        newSummary.m_szName = sample.m_szName;
+        newSummary.m_uParent = uParent;
+        newSummary.m_uCalls = 0;
+        newSummary.m_uTotalTime = 0;
+        newSummary.m_uSelfTime = 0;
+        newSummary.m_uMaximumTime = 0;
+        arSummaries.Add(newSummary);
+    }
+
+    const u64_q TOTAL_TIME = sample.m_uEnd - sample.m_uStart;
+    QScopeSummary &summary = arSummaries[uSummary];
+    ++summary.m_uCalls;
+    summary.m_uTotalTime += TOTAL_TIME;
+    summary.m_uSelfTime += uSelfTime;
+
+    if(TOTAL_TIME > summary.m_uMaximumTime)
+        summary.m_uMaximumTime = TOTAL_TIME;
+
+    return uSummary;
+}
+
+void QProfiler::AppendHierarchicalSummaries(const QArrayDynamic<QScopeSummary> &arSummaries, 
+                                            const pointer_uint_q uParent, 
+                                            const unsigned int uIndentation, 
+                                            string_q &strOutput)
+{
+    const pointer_uint_q SUMMARY_COUNT = arSummaries.GetCount();
+    QArrayDynamic<pointer_uint_q> arChildren;
+
+    for(pointer_uint_q i = 0; i < SUMMARY_COUNT; ++i)
+        if(arSummaries[i].m_uParent == uParent)
+            arChildren.Add(i);
+
+    // The contained scopes are sorted by total time, in descending order
+    const pointer_uint_q CHILD_COUNT = arChildren.GetCount();
+
+    for(pointer_uint_q i = 1U; i < CHILD_COUNT; ++i)
+        for(pointer_uint_q j = i; j > 0 && arSummaries[arChildren[j - 1U]].m_uTotalTime < arSummaries[arChildren[j]].m_uTotalTime; --j)
+            arChildren.Swap(j - 1U, j);
+
+    for(pointer_uint_q i = 0; i < CHILD_COUNT; ++i)
+    {
+        for(unsigned int j = 0; j < uIndentation; ++j)
+            strOutput.Append("  ");
+
+        QProfiler::AppendSummary(arSummaries[arChildren[i]], strOutput);
+        QProfiler::AppendHierarchicalSummaries(arSummaries, arChildren[i], uIndentation + 1U, strOutput);
+    }
+}
+
+void QProfiler::AppendSummary(const QScopeSummary &summary, string_q &strOutput)
+{
+    strOutput.Append(summary.m_szName);
+    strOutput.Append(" | calls: ");
+    strOutput.Append(summary.m_uCalls);
+    strOutput.Append(" | total: ");
+    strOutput.Append(summary.m_uTotalTime);
+    strOutput.Append(" ns | self: ");
+    strOutput.Append(summary.m_uSelfTime);
+    strOutput.Append(" ns | max: ");
+    strOutput.Append(summary.m_uMaximumTime);
+    strOutput.Append(" ns\n");
+}
+
+void QProfiler::AppendMicroseconds(const u64_q uNanoseconds, string_q &strOutput)
+{
+    static const u64_q NANOSECONDS_IN_MICROSECOND = 1000ULL;
+
+    const u64_q FRACTION = uNanoseconds % NANOSECONDS_IN_MICROSECOND;
+
+    strOutput.Append(uNanoseconds / NANOSECONDS_IN_MICROSECOND);
+    strOutput.Append(FRACTION < 10U ? ".00" : FRACTION < 100U ? ".0" : ".");
+    strOutput.Append(FRACTION);
+}
+
+void QProfiler::AppendJsonString(const char* szText, string_q &strOutput)
+{
+    static const char* HEXADECIMAL_DIGITS = "0123456789abcdef";
+
+    strOutput.Append("\"");
+
+    // Characters are written in blocks between the characters that have to be escaped
+    char szBlock[64];
+    unsigned int uBlockLength = 0;
+
+    for(const char* pCharacter = szText; *pCharacter != '\0'; ++pCharacter)
+    {
+        const unsigned char CHARACTER = scast_q(*pCharacter, unsigned char);
+        const bool IS_ESCAPED = CHARACTER == '"' || CHARACTER == '\\' || CHARACTER < 0x20U;
+
+        if(IS_ESCAPED || uBlockLength == sizeof(szBlock) - 7U)
+        {
+            szBlock[uBlockLength] = '\0';
+            strOutput.Append(szBlock);
+            uBlockLength = 0;
+        }
+
+        if(CHARACTER == '"' || CHARACTER == '\\')
+        {
+            szBlock[uBlockLength++] = '\\';
+            szBlock[uBlockLength++] = *pCharacter;
+        }
+        else if(CHARACTER < 0x20U)
+        {
+            szBlock[uBlockLength++] = '\\';
+            szBlock[uBlockLength++] = 'u';
+            szBlock[uBlockLength++] = '0';
+            szBlock[uBlockLength++] = '0';
+            szBlock[uBlockLength++] = HEXADECIMAL_DIGITS[CHARACTER >> 4U];
+            szBlock[uBlockLength++] = HEXADECIMAL_DIGITS[CHARACTER & 0xFU];
+        }
+        else
+        {
+            szBlock[uBlockLength++] = *pCharacter;
+        }
+    }
+
+    szBlock[uBlockLength] = '\0';
+    strOutput.Append(szBlock);
+    strOutput.Append("\"");
+}
+
+} //namespace Diagnosis
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -0,0 +1,131 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "QSoAPointBuffer.h"
+
+#include <cstring>
+#include "AllocationOperators.h"
+#include "Assertions.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Math
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const QAlignment QSoAPointBuffer::STREAM_ALIGNMENT(16);
+const unsigned int QSoAPointBuffer::POINTS_PER_BLOCK = 4;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QSoAPointBuffer::QSoAPointBuffer(const unsigned int uCount) : m_uCount(uCount)
+{
+    // The length of the streams is rounded up to a multiple of the block size so vectorized loops do not need to process
+    // the last points separately. An empty buffer reserves one block anyway, since the allocator does not accept zero sizes
+    m_uStreamLength = (uCount + POINTS_PER_BLOCK - 1U) & ~(POINTS_PER_BLOCK - 1U);
+
+    if(m_uStreamLength == 0)
+        m_uStreamLength = POINTS_PER_BLOCK;
+
+    // The stream length is a multiple of 4 so, as long as the first stream is aligned to 16 bytes, the other two are too
+    const pointer_uint_q STREAM_SIZE = m_uStreamLength * sizeof(float_q);
+    m_arX = scast_q(operator new(STREAM_SIZE * 3U, STREAM_ALIGNMENT), float_q*);
+    m_arY = m_arX + m_uStreamLength;
+    m_arZ = m_arY + m_uStreamLength;
+
+    memset(m_arX, 0, STREAM_SIZE * 3U);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QSoAPointBuffer::~QSoAPointBuffer()
+{
+    operator delete(m_arX, STREAM_ALIGNMENT);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QVector3 QSoAPointBuffer::GetPoint(const unsigned int uIndex) const
+{
+    QE_ASSERT_ERROR( uIndex < m_uCount, "The index is out of bounds" );
+
+    return QVector3(m_arX[uIndex], m_arY[uIndex], m_arZ[uIndex]);
+}
+
+void QSoAPointBuffer::SetPoint(const unsigned int uIndex, const QBaseVector3 &vPoint)
+{
+    QE_ASSERT_ERROR( uIndex < m_uCount, "The index is out of bounds" );
+
+    m_arX[uIndex] = vPoint.x;
+    m_arY[uIndex] = vPoint.y;
+    m_arZ[uIndex] = vPoint.z;
+}
+
+
+} //namespace Math
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -199,6 +199,9 @@ void* QStackAllocator::Allocate(const pointer_uint_q uSize, const QAlignment& al
     if(this->CanAllocate(uSize, alignment))
     {
         // STEP 1) Prerrequisites.
+        //         The header of the block placed on top of the stack, if any, is the previous header of the new block.
+        QBlockHeader* pLastBlock = m_uAllocatedBytes == 0 ? null_q : 
+                                                            scast_q(m_pPrevious, QBlockHeader*);
         m_pPrevious = m_pTop;
 
         // STEP 2) Compute the alignment offset, if it proceeds.
@@ -206,8 +209,7 @@ void* QStackAllocator::Allocate(const pointer_uint_q uSize, const QAlignment& al
 
         // STEP 3) Create a Block Header.
         //         (** using the so-called 'placement new operator' **).
-        QBlockHeader* pLastBlock = scast_q(m_pPrevious, QBlockHeader*);
-        pointer_uint_q uOffsetToPreviousBlock = pLastBlock != null_q ? 
+        pointer_uint_q uOffsetToPreviousBlock = pLastBlock == null_q ? 
                                                                       0 : 
                                                                       pLastBlock->GetAllocatedBlockSize() + pLastBlock->GetAlignmentOffset() + sizeof(QBlockHeader);
 
@@ -63,6 +63,9 @@ namespace DataTypes
 
 const int QStringUnicode::LENGTH_NULL_TERMINATED = -1;
 const int QStringUnicode::PATTERN_NOT_FOUND = -1;
+const unsigned int QStringUnicode::_CODE_UNIT_INDEX_INTERVAL = 32U;
+boost::thread_specific_ptr<QStringUnicode::QThreadICUObjects>* QStringUnicode::sm_pThreadICUObjects = null_q;
+boost::once_flag QStringUnicode::sm_threadICUObjectsStorageCreation = BOOST_ONCE_INIT;
 
 
 //##################=======================================================##################
@@ -75,12 +78,14 @@ const int QStringUnicode::PATTERN_NOT_FOUND = -1;
 //##################=======================================================##################
 
 QStringUnicode::QStringUnicode() : m_strString(),
-                                   m_uLength(0)
+                                   m_uLength(0),
+                                   m_arCodeUnitIndex(null_q)
 {
 }
 
 QStringUnicode::QStringUnicode(const QStringUnicode &strString) : m_strString(strString.m_strString),
-                                                                  m_uLength(strString.GetLength())
+                                                                  m_uLength(strString.GetLength()),
+                                                                  m_arCodeUnitIndex(null_q)
 {
 }
 
@@ -104,7 +109,7 @@ QStringUnicode::QStringUnicode(const i8_q* arBytes, const int nLength)
 
 QStringUnicode::QStringUnicode(const i8_q* arBytes,
                                const int nLength,
-                               const EQTextEncoding &eEncoding)
+                               const EQTextEncoding &eEncoding) : m_arCodeUnitIndex(null_q)
 {
     // Only ASCII and ISO 8859-1 encodings can be used along with null-terminated strings' length calculation
     QE_ASSERT_ERROR(((eEncoding == EQTextEncoding::E_ASCII || eEncoding == EQTextEncoding::E_ISO88591) &&
@@ -125,7 +130,8 @@ QStringUnicode::QStringUnicode(const i8_q* arBytes,
 }
 
 QStringUnicode::QStringUnicode(const QCharUnicode &character) : m_strString(UChar32(character.GetCodePoint())),
-                                                                m_uLength(1U)
+                                                                m_uLength(1U),
+                                                                m_arCodeUnitIndex(null_q)
 {
 }
 
@@ -147,6 +153,21 @@ QStringUnicode::QStringUnicode(const wchar_t* szCharacters)
 }
 
 
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QStringUnicode::~QStringUnicode()
+{
+    delete[] m_arCodeUnitIndex.load(boost::memory_order_relaxed);
+}
+
+
 //##################=======================================================##################
 //##################             ____________________________              ##################
 //##################            |                            |             ##################
@@ -162,6 +183,7 @@ QStringUnicode& QStringUnicode::operator=(const QStringUnicode &strString)
     //               In the future we should look for a solution, if there is any.
     m_strString = strString.m_strString;
     m_uLength = strString.GetLength();
+    this->_ResetCodeUnitIndex();
     return *this;
 }
 
@@ -337,7 +359,7 @@ QCharUnicode QStringUnicode::operator[](const unsigned int uIndex) const
     // Index out of bounds: The index must be lower than the length of the string
     QE_ASSERT_ERROR(!this->IsEmpty() && uIndex < this->GetLength(), "Index out of bounds: The index must be lower than the length of the string");
     
-    return QStringUnicode::QConstCharIterator(*this, uIndex).GetChar();
+    return QCharUnicode(m_strString.char32At(this->_GetCodeUnitIndex(uIndex)));
 }
 
 QStringUnicode QStringUnicode::Substring(const unsigned int uStartPosition) const
@@ -542,52 +564,67 @@ QArrayResult<i8_q> QStringUnicode::ToBytes(const EQTextEncoding &eEncoding) cons
 UConverter* QStringUnicode::_GetConverter(const EQTextEncoding &eEncoding)
 {
     // About ICU converters: http://userguide.icu-project.org/conversion/converters
-    static UErrorCode errorCode = U_ZERO_ERROR;
-    static UConverter* const ASCII_CONVERTER    = ucnv_open("US-ASCII",    &errorCode);
-    static UConverter* const ISO88591_CONVERTER = ucnv_open("ISO-8859-1",  &errorCode);
-    static UConverter* const UTF8_CONVERTER     = ucnv_open("UTF8",        &errorCode);
-    static UConverter* const UTF16_CONVERTER    = ucnv_open("UTF16",       &errorCode);
-    static UConverter* const UTF32_CONVERTER    = ucnv_open("UTF32",       &errorCode);
-    static UConverter* const UTF16BE_CONVERTER  = ucnv_open("UTF16BE",     &errorCode);
-    static UConverter* const UTF16LE_CONVERTER  = ucnv_open("UTF16LE",     &errorCode);
-    static UConverter* const UTF32BE_CONVERTER  = ucnv_open("UTF32BE",     &errorCode);
-    static UConverter* const UTF32LE_CONVERTER  = ucnv_open("UTF32LE",     &errorCode);
-
-    UConverter* pConverter = null_q;
+    unsigned int uConverterIndex = 0;
+    const char* szConverterName = null_q;
 
     switch(eEncoding)
     {
     case EQTextEncoding::E_ASCII:
-        pConverter = ASCII_CONVERTER;
+        uConverterIndex = 0;
+        szConverterName = "US-ASCII";
         break;
     case EQTextEncoding::E_ISO88591:
-        pConverter = ISO88591_CONVERTER;
+        uConverterIndex = 1U;
+        szConverterName = "ISO-8859-1";
         break;
     case EQTextEncoding::E_UTF8:
-        pConverter = UTF8_CONVERTER;
+        uConverterIndex = 2U;
+        szConverterName = "UTF8";
         break;
     case EQTextEncoding::E_UTF16:
-        pConverter = UTF16_CONVERTER;
+        uConverterIndex = 3U;
+        szConverterName = "UTF16";
         break;
     case EQTextEncoding::E_UTF32:
-        pConverter = UTF32_CONVERTER;
+        uConverterIndex = 4U;
+        szConverterName = "UTF32";
         break;
     case EQTextEncoding::E_UTF16BE:
-        pConverter = UTF16BE_CONVERTER;
+        uConverterIndex = 5U;
+        szConverterName = "UTF16BE";
         break;
     case EQTextEncoding::E_UTF16LE:
-        pConverter = UTF16LE_CONVERTER;
+        uConverterIndex = 6U;
+        szConverterName = "UTF16LE";
         break;
     case EQTextEncoding::E_UTF32BE:
-        pConverter = UTF32BE_CONVERTER;
+        uConverterIndex = 7U;
+        szConverterName = "UTF32BE";
         break;
     case EQTextEncoding::E_UTF32LE:
-        pConverter = UTF32LE_CONVERTER;
+        uConverterIndex = 8U;
+        szConverterName = "UTF32LE";
         break;
     default:
         break;
     }
 
+    UConverter* pConverter = null_q;
+
+    if(szConverterName != null_q)
+    {
+        QThreadICUObjects* pThreadICUObjects = QStringUnicode::_GetThreadICUObjects();
+        pConverter = pThreadICUObjects->m_arConverters[uConverterIndex];
+
+        if(pConverter == null_q)
+        {
+            UErrorCode errorCode = U_ZERO_ERROR;
+            pConverter = ucnv_open(szConverterName, &errorCode);
+            QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An unexpected error ocurred when creating an ICU converter");
+            pThreadICUObjects->m_arConverters[uConverterIndex] = pConverter;
+        }
+    }
+
     return pConverter;
 }
 
@@ -597,6 +634,7 @@ QStringUnicode QStringUnicode::ToLowerCase() const
     // Use English as locale.
     const Locale &en = Locale::getEnglish();
     strLowerCase.m_strString.toLower(en);
+    strLowerCase.m_uLength = scast_q(strLowerCase.m_strString.countChar32(), unsigned int);
     return strLowerCase;
 }
 
@@ -606,6 +644,7 @@ QStringUnicode QStringUnicode::ToUpperCase() const
     // Use English as locale.
     const Locale &en = Locale::getEnglish();
     strUpperCase.m_strString.toUpper(en);
+    strUpperCase.m_uLength = scast_q(strUpperCase.m_strString.countChar32(), unsigned int);
     return strUpperCase;
 }
 
@@ -636,6 +675,7 @@ void QStringUnicode::Normalize(const EQNormalizationForm &eNormalizationForm)
         {
             m_strString = strNormalized;
             m_uLength = scast_q(strNormalized.countChar32(), unsigned int);;
+            this->_ResetCodeUnitIndex();
         }
     }
 }
@@ -704,40 +744,47 @@ int QStringUnicode::CompareTo(const QStringUnicode &strInputString, const EQComp
 const icu::Collator* QStringUnicode::_GetCollator(const EQComparisonType &eComparisonType)
 {
     // Information of interest: http://userguide.icu-project.org/collation/architecture
-    static bool bInitialized = false;
-    static UErrorCode errorCode = U_ZERO_ERROR;
-    // By default, the collation is English
-    static icu::Collator* CANONICAL_CASESENSITIVE_COLLATOR = icu::Collator::createInstance(icu::Locale::getEnglish(), errorCode);
-    static icu::Collator* CANONICAL_CASEINSENSITIVE_COLLATOR = icu::Collator::createInstance(icu::Locale::getEnglish(), errorCode);
-
-    QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when getting the collator");
-
-    if(!bInitialized)
-    {
-        CANONICAL_CASESENSITIVE_COLLATOR->setStrength(icu::Collator::TERTIARY);
-        CANONICAL_CASESENSITIVE_COLLATOR->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, errorCode);
-        QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when calling setAttribute");
-        CANONICAL_CASESENSITIVE_COLLATOR->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_NON_IGNORABLE, errorCode);
-        QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when calling setAttribute");
-
-        CANONICAL_CASEINSENSITIVE_COLLATOR->setStrength(icu::Collator::SECONDARY); // Secondary: No tertiary checking, no case comparison
-        CANONICAL_CASEINSENSITIVE_COLLATOR->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, errorCode);
-        QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when calling setAttribute");
-        CANONICAL_CASEINSENSITIVE_COLLATOR->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_NON_IGNORABLE, errorCode);
-        QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when calling setAttribute");
-
-        bInitialized = true;
-    }
-
+    QThreadICUObjects* pThreadICUObjects = QStringUnicode::_GetThreadICUObjects();
     icu::Collator* pCollator = null_q;
+    UErrorCode errorCode = U_ZERO_ERROR;
 
     switch(eComparisonType)
     {
     case EQComparisonType::E_CanonicalCaseInsensitive:
-        pCollator = CANONICAL_CASEINSENSITIVE_COLLATOR;
+        if(pThreadICUObjects->m_pCanonicalCaseInsensitiveCollator == null_q)
+        {
+            // By default, the collation is English
+            pCollator = icu::Collator::createInstance(icu::Locale::getEnglish(), errorCode);
+            QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when getting the collator");
+
+            pCollator->setStrength(icu::Collator::SECONDARY); // Secondary: No tertiary checking, no case comparison
+            pCollator->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, errorCode);
+            QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when calling setAttribute");
+            pCollator->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_NON_IGNORABLE, errorCode);
+            QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when calling setAttribute");
+
+            pThreadICUObjects->m_pCanonicalCaseInsensitiveCollator = pCollator;
+        }
+
+        pCollator = pThreadICUObjects->m_pCanonicalCaseInsensitiveCollator;
         break;
     case EQComparisonType::E_CanonicalCaseSensitive:
-        pCollator = CANONICAL_CASESENSITIVE_COLLATOR;
+        if(pThreadICUObjects->m_pCanonicalCaseSensitiveCollator == null_q)
+        {
+            // By default, the collation is English
+            pCollator = icu::Collator::createInstance(icu::Locale::getEnglish(), errorCode);
+            QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when getting the collator");
+
+            pCollator->setStrength(icu::Collator::TERTIARY);
+            pCollator->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, errorCode);
+            QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when calling setAttribute");
+            pCollator->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_NON_IGNORABLE, errorCode);
+            QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An error occurred when calling setAttribute");
+
+            pThreadICUObjects->m_pCanonicalCaseSensitiveCollator = pCollator;
+        }
+
+        pCollator = pThreadICUObjects->m_pCanonicalCaseSensitiveCollator;
         break;
     //case EQComparisonType::E_CompatibilityCaseInsensitive:
     //case EQComparisonType::E_CompatibilityCaseSensitive:
@@ -750,6 +797,116 @@ const icu::Collator* QStringUnicode::_GetCollator(const EQComparisonType &eCompa
     return pCollator;
 }
 
+int32_t QStringUnicode::_GetCodeUnitIndex(const unsigned int uCodePointIndex) const
+{
+    int32_t nCodeUnitIndex = 0;
+
+    if(uCodePointIndex >= m_uLength)
+    {
+        nCodeUnitIndex = m_strString.length();
+    }
+    else if(m_uLength == scast_q(m_strString.length(), unsigned int))
+    {
+        // There are no supplementary characters, every character occupies 1 code unit
+        nCodeUnitIndex = scast_q(uCodePointIndex, int32_t);
+    }
+    else if(m_uLength <= QStringUnicode::_CODE_UNIT_INDEX_INTERVAL)
+    {
+        nCodeUnitIndex = m_strString.moveIndex32(0, uCodePointIndex);
+    }
+    else
+    {
+        const int32_t* arCodeUnitIndex = m_arCodeUnitIndex.load(boost::memory_order_acquire);
+
+        if(arCodeUnitIndex == null_q)
+            arCodeUnitIndex = this->_BuildCodeUnitIndex();
+
+        const int32_t CLOSEST_CODE_UNIT_INDEX = arCodeUnitIndex[uCodePointIndex / QStringUnicode::_CODE_UNIT_INDEX_INTERVAL];
+        nCodeUnitIndex = m_strString.moveIndex32(CLOSEST_CODE_UNIT_INDEX, uCodePointIndex % QStringUnicode::_CODE_UNIT_INDEX_INTERVAL);
+    }
+
+    return nCodeUnitIndex;
+}
+
+unsigned int QStringUnicode::_GetCodePointIndex(const int32_t nCodeUnitIndex) const
+{
+    unsigned int uCodePointIndex = 0;
+
+    if(m_uLength == scast_q(m_strString.length(), unsigned int))
+    {
+        // There are no supplementary characters, every character occupies 1 code unit
+        uCodePointIndex = scast_q(nCodeUnitIndex, unsigned int);
+    }
+    else if(m_uLength <= QStringUnicode::_CODE_UNIT_INDEX_INTERVAL)
+    {
+        uCodePointIndex = scast_q(m_strString.countChar32(0, nCodeUnitIndex), unsigned int);
+    }
+    else
+    {
+        const int32_t* arCodeUnitIndex = m_arCodeUnitIndex.load(boost::memory_order_acquire);
+
+        if(arCodeUnitIndex == null_q)
+            arCodeUnitIndex = this->_BuildCodeUnitIndex();
+
+        // Binary search of the last entry of the index that is not greater than the code unit
+        unsigned int uFirstEntry = 0;
+        unsigned int uLastEntry = (m_uLength - 1U) / QStringUnicode::_CODE_UNIT_INDEX_INTERVAL;
+
+        while(uFirstEntry < uLastEntry)
+        {
+            const unsigned int MIDDLE_ENTRY = uFirstEntry + (uLastEntry - uFirstEntry + 1U) / 2U;
+
+            if(arCodeUnitIndex[MIDDLE_ENTRY] <= nCodeUnitIndex)
+                uFirstEntry = MIDDLE_ENTRY;
+            else
+                uLastEntry = MIDDLE_ENTRY - 1U;
+        }
+
+        const int32_t CLOSEST_CODE_UNIT_INDEX = arCodeUnitIndex[uFirstEntry];
+        uCodePointIndex = uFirstEntry * QStringUnicode::_CODE_UNIT_INDEX_INTERVAL + 
+                          scast_q(m_strString.countChar32(CLOSEST_CODE_UNIT_INDEX, nCodeUnitIndex - CLOSEST_CODE_UNIT_INDEX), unsigned int);
+    }
+
+    return uCodePointIndex;
+}
+
+const int32_t* QStringUnicode::_BuildCodeUnitIndex() const
+{
+    const unsigned int ENTRIES_COUNT = (m_uLength - 1U) / QStringUnicode::_CODE_UNIT_INDEX_INTERVAL + 1U;
+    const UChar* pBuffer = m_strString.getBuffer();
+    const int32_t CODE_UNITS_COUNT = m_strString.length();
+
+    int32_t* arCodeUnitIndex = new int32_t[ENTRIES_COUNT];
+
+    int32_t nCodeUnitIndex = 0;
+    unsigned int uCodePointIndex = 0;
+
+    while(nCodeUnitIndex < CODE_UNITS_COUNT && uCodePointIndex < m_uLength)
+    {
+        if(uCodePointIndex % QStringUnicode::_CODE_UNIT_INDEX_INTERVAL == 0)
+            arCodeUnitIndex[uCodePointIndex / QStringUnicode::_CODE_UNIT_INDEX_INTERVAL] = nCodeUnitIndex;
+
+        U16_FWD_1(pBuffer, nCodeUnitIndex, CODE_UNITS_COUNT);
+        ++uCodePointIndex;
+    }
+
+    // If another thread published its index meanwhile, that one is used and this one is discarded
+    int32_t* pPublishedIndex = null_q;
+
+    if(!m_arCodeUnitIndex.compare_exchange_strong(pPublishedIndex, arCodeUnitIndex, boost::memory_order_acq_rel, boost::memory_order_acquire))
+    {
+        delete[] arCodeUnitIndex;
+        arCodeUnitIndex = pPublishedIndex;
+    }
+
+    return arCodeUnitIndex;
+}
+
+void QStringUnicode::_ResetCodeUnitIndex()
+{
+    delete[] m_arCodeUnitIndex.exchange(null_q, boost::memory_order_relaxed);
+}
+
 int QStringUnicode::IndexOf(const QStringUnicode &strPattern, const EQComparisonType::EnumType &eComparisonType) const
 {
     int32_t nPosition = QStringUnicode::PATTERN_NOT_FOUND;
@@ -789,7 +946,7 @@ int QStringUnicode::IndexOf(const QStringUnicode &strPattern, const EQComparison
     }
 
     if(nPosition != QStringUnicode::PATTERN_NOT_FOUND)
-        nPosition = m_strString.countChar32(0, nPosition);
+        nPosition = this->_GetCodePointIndex(nPosition);
 
     return nPosition;
 }
@@ -875,7 +1032,7 @@ int QStringUnicode::IndexOf(const QStringUnicode &strPattern, const unsigned int
     }
 
     if(nPosition != QStringUnicode::PATTERN_NOT_FOUND)
-        nPosition = m_strString.countChar32(0, nPosition);
+        nPosition = this->_GetCodePointIndex(nPosition);
 
     return nPosition;
 }
@@ -919,7 +1076,7 @@ int QStringUnicode::LastIndexOf(const QStringUnicode &strPattern, const EQCompar
     }
 
     if(nPosition != QStringUnicode::PATTERN_NOT_FOUND)
-        nPosition = m_strString.countChar32(0, nPosition);
+        nPosition = this->_GetCodePointIndex(nPosition);
 
     return nPosition;
 }
@@ -969,7 +1126,7 @@ int QStringUnicode::LastIndexOf(const QStringUnicode &strPattern, const unsigned
     }
 
     if(nPosition != QStringUnicode::PATTERN_NOT_FOUND)
-        nPosition = m_strString.countChar32(0, nPosition);
+        nPosition = this->_GetCodePointIndex(nPosition);
 
     return nPosition;
 }
@@ -1040,6 +1197,7 @@ void QStringUnicode::Replace(const QStringUnicode &strSearchedPattern, const QSt
             this->_ReplaceCanonical(strSearchedPattern, strReplacement, eComparisonType);
 
         m_uLength = scast_q(m_strString.countChar32(), unsigned int);;
+        this->_ResetCodeUnitIndex();
     }
 }
 
@@ -1104,6 +1262,7 @@ void QStringUnicode::Append(const QStringUnicode &strStringToAppend)
 {
     m_strString.append(strStringToAppend.m_strString);
     m_uLength += strStringToAppend.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const char* szStringToAppend)
@@ -1116,6 +1275,7 @@ void QStringUnicode::Append(const u8_q uInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const i8_q nInteger)
@@ -1123,6 +1283,7 @@ void QStringUnicode::Append(const i8_q nInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const u16_q uInteger)
@@ -1130,6 +1291,7 @@ void QStringUnicode::Append(const u16_q uInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const i16_q nInteger)
@@ -1137,6 +1299,7 @@ void QStringUnicode::Append(const i16_q nInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const u32_q uInteger)
@@ -1144,6 +1307,7 @@ void QStringUnicode::Append(const u32_q uInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const i32_q nInteger)
@@ -1151,6 +1315,7 @@ void QStringUnicode::Append(const i32_q nInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const u64_q uInteger)
@@ -1158,6 +1323,7 @@ void QStringUnicode::Append(const u64_q uInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const i64_q nInteger)
@@ -1165,6 +1331,7 @@ void QStringUnicode::Append(const i64_q nInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const bool bBoolean)
@@ -1172,6 +1339,7 @@ void QStringUnicode::Append(const bool bBoolean)
     QStringUnicode strBoolean = QStringUnicode::FromBoolean(bBoolean);
     m_strString.append(strBoolean.m_strString);
     m_uLength += strBoolean.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const f32_q fFloat)
@@ -1179,6 +1347,7 @@ void QStringUnicode::Append(const f32_q fFloat)
     QStringUnicode strFloat = QStringUnicode::FromFloat(fFloat);
     m_strString.append(strFloat.m_strString);
     m_uLength += strFloat.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const f64_q fFloat)
@@ -1186,6 +1355,7 @@ void QStringUnicode::Append(const f64_q fFloat)
     QStringUnicode strFloat = QStringUnicode::FromFloat(fFloat);
     m_strString.append(strFloat.m_strString);
     m_uLength += strFloat.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 void QStringUnicode::Append(const vf32_q vfVector)
@@ -1193,6 +1363,7 @@ void QStringUnicode::Append(const vf32_q vfVector)
     QStringUnicode strVectorFloat = QStringUnicode::FromVF32(vfVector);
     m_strString.append(strVectorFloat.m_strString);
     m_uLength += strVectorFloat.GetLength();
+    this->_ResetCodeUnitIndex();
 }
 
 QArrayResult<QStringUnicode> QStringUnicode::Split(const QStringUnicode &strSeparator) const
@@ -1344,19 +1515,51 @@ f64_q QStringUnicode::ToFloat() const
 
 const icu::NumberFormat* QStringUnicode::_GetIntegerFormatter()
 {
-    static UErrorCode errorCode = U_ZERO_ERROR;
-    static icu::NumberFormat* pNumberFormatter = icu::NumberFormat::createInstance(icu::Locale::getEnglish(), UNUM_DECIMAL, errorCode);
-    pNumberFormatter->setParseIntegerOnly(TRUE);
-    QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An unexpected error ocurred when creating an ICU number formatter");
-    return pNumberFormatter;
+    QThreadICUObjects* pThreadICUObjects = QStringUnicode::_GetThreadICUObjects();
+
+    if(pThreadICUObjects->m_pIntegerFormatter == null_q)
+    {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        pThreadICUObjects->m_pIntegerFormatter = icu::NumberFormat::createInstance(icu::Locale::getEnglish(), UNUM_DECIMAL, errorCode);
+        QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An unexpected error ocurred when creating an ICU number formatter");
+        pThreadICUObjects->m_pIntegerFormatter->setParseIntegerOnly(TRUE);
+    }
+
+    return pThreadICUObjects->m_pIntegerFormatter;
 }
 
 const icu::NumberFormat* QStringUnicode::_GetFloatFormatter()
 {
-    static UErrorCode errorCode = U_ZERO_ERROR;
-    static const icu::NumberFormat* pNumberFormatter = icu::DecimalFormat::createInstance(icu::Locale::getEnglish(), UNUM_SCIENTIFIC, errorCode);
-    QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An unexpected error ocurred when creating an ICU number formatter");
-    return pNumberFormatter;
+    QThreadICUObjects* pThreadICUObjects = QStringUnicode::_GetThreadICUObjects();
+
+    if(pThreadICUObjects->m_pFloatFormatter == null_q)
+    {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        pThreadICUObjects->m_pFloatFormatter = icu::DecimalFormat::createInstance(icu::Locale::getEnglish(), UNUM_SCIENTIFIC, errorCode);
+        QE_ASSERT_ERROR(U_SUCCESS(errorCode), "An unexpected error ocurred when creating an ICU number formatter");
+    }
+
+    return pThreadICUObjects->m_pFloatFormatter;
+}
+
+QStringUnicode::QThreadICUObjects* QStringUnicode::_GetThreadICUObjects()
+{
+    boost::call_once(sm_threadICUObjectsStorageCreation, &QStringUnicode::_CreateThreadICUObjectsStorage);
+
+    QThreadICUObjects* pThreadICUObjects = sm_pThreadICUObjects->get();
+
+    if(pThreadICUObjects == null_q)
+    {
+        pThreadICUObjects = new QThreadICUObjects();
+        sm_pThreadICUObjects->reset(pThreadICUObjects);
+    }
+
+    return pThreadICUObjects;
+}
+
+void QStringUnicode::_CreateThreadICUObjectsStorage()
+{
+    sm_pThreadICUObjects = new boost::thread_specific_ptr<QThreadICUObjects>();
 }
 
 template<>
@@ -0,0 +1,452 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "QTaskScheduler.h"
+
+using Kinesis::QuimeraEngine::Common::QDelegate;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const unsigned int QTaskScheduler::QTaskQueue::INITIAL_CAPACITY = 64U;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QTaskScheduler::QTaskScheduler(const unsigned int uWorkerCount) : m_arWorkers(null_q),
+                                                                  m_uWorkerCount(uWorkerCount),
+                                                                  m_arQueues(new QTaskQueue[uWorkerCount + 1U]),
+                                                                  m_uSleepingWorkers(0),
+                                                                  m_uSleepingWaiters(0),
+                                                                  m_bStopRequested(false)
+{
+    if(uWorkerCount > 0)
+    {
+        m_arWorkers = new QThread*[uWorkerCount];
+
+        for(unsigned int i = 0; i < uWorkerCount; ++i)
+            m_arWorkers[i] = new QThread(QDelegate<void (const unsigned int)>(this, &QTaskScheduler::WorkerLoop), i);
+    }
+}
+
+QTaskScheduler::QTaskGroup::QTaskGroup() : m_uPendingTasks(0)
+{
+}
+
+QTaskScheduler::QTask::QTask(const QDelegate<void ()> function, QTaskGroup &group) : m_function(function),
+                                                                                   m_pGroup(&group),
+                                                                                   m_pContinuations(null_q),
+                                                                                   m_uPendingDependencies(1U),
+                                                                                   m_bSubmitted(false)
+{
+}
+
+QTaskScheduler::QTaskQueue::QTaskQueue() : m_arTasks(new QTask*[QTaskQueue::INITIAL_CAPACITY]),
+                                           m_uCapacity(QTaskQueue::INITIAL_CAPACITY),
+                                           m_uFirst(0),
+                                           m_uCount(0)
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QTaskScheduler::~QTaskScheduler()
+{
+    {
+        // Worker threads check the flag while they own the mutex before sleeping, so none of them can miss the notification
+        QScopedExclusiveLock<> lock(m_mutex);
+        m_bStopRequested.store(true);
+        m_taskAvailable.NotifyAll();
+    }
+
+    for(unsigned int i = 0; i < m_uWorkerCount; ++i)
+    {
+        m_arWorkers[i]->Join();
+        delete m_arWorkers[i];
+    }
+
+    delete[] m_arWorkers;
+    delete[] m_arQueues;
+}
+
+QTaskScheduler::QTaskQueue::~QTaskQueue()
+{
+    delete[] m_arTasks;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QTaskScheduler::QTask* QTaskScheduler::CreateTask(const QDelegate<void ()> function, QTaskGroup &group)
+{
+    QE_ASSERT_ERROR(!function.IsNull(), "The input function cannot be null.");
+
+    group.m_uPendingTasks.fetch_add(1U, boost::memory_order_relaxed);
+
+    return new QTask(function, group);
+}
+
+void QTaskScheduler::AddContinuation(QTask* pTask, QTask* pContinuation)
+{
+    QE_ASSERT_ERROR(pTask != null_q, "The input task cannot be null.");
+    QE_ASSERT_ERROR(pContinuation != null_q, "The input continuation cannot be null.");
+    QE_ASSERT_ERROR(pTask != pContinuation, "A task cannot be a continuation of itself.");
+    QE_ASSERT_ERROR(!pTask->m_bSubmitted, "The input task has already been submitted.");
+    QE_ASSERT_ERROR(!pContinuation->m_bSubmitted, "The input continuation has already been submitted.");
+
+    // The list of the task is not shared yet, only the thread that submits it can modify it
+    QContinuation* pNode = new QContinuation;
+    pNode->m_pTask = pContinuation;
+    pNode->m_pNext = pTask->m_pContinuations;
+    pTask->m_pContinuations = pNode;
+
+    pContinuation->m_uPendingDependencies.fetch_add(1U, boost::memory_order_relaxed);
+}
+
+void QTaskScheduler::Submit(QTask* pTask)
+{
+    QE_ASSERT_ERROR(pTask != null_q, "The input task cannot be null.");
+    QE_ASSERT_ERROR(!pTask->m_bSubmitted, "The input task has already been submitted.");
+
+    pTask->m_bSubmitted = true;
+
+    // The last predecessor to finish may be releasing the task at the same time, only the one that sets the counter to zero queues it
+    if(pTask->m_uPendingDependencies.fetch_sub(1U, boost::memory_order_acq_rel) == 1U)
+    {
+        m_arQueues[this->GetCurrentQueue()].PushBack(pTask);
+        this->WakeUpThreads(1U);
+    }
+}
+
+void QTaskScheduler::Run(const QDelegate<void ()> function, QTaskGroup &group)
+{
+    this->Submit(this->CreateTask(function, group));
+}
+
+void QTaskScheduler::Wait(QTaskGroup &group)
+{
+    const unsigned int QUEUE = this->GetCurrentQueue();
+
+    while(group.m_uPendingTasks.load() > 0)
+    {
+        // The calling thread works too instead of just waiting
+        QTask* pTask = this->TakeTask(QUEUE);
+
+        if(pTask == null_q)
+        {
+            QScopedExclusiveLock<> lock(m_mutex);
+            ++m_uSleepingWaiters;
+
+            // The group and the queues are checked again after announcing that the thread is going to sleep, so the threads 
+            // that finish or add tasks meanwhile will notify it
+            pTask = this->TakeTask(QUEUE);
+
+            if(pTask == null_q && group.m_uPendingTasks.load() > 0)
+                m_taskFinished.Wait(lock);
+
+            --m_uSleepingWaiters;
+        }
+
+        if(pTask != null_q)
+            this->ExecuteTask(pTask, QUEUE);
+    }
+}
+
+void QTaskScheduler::ParallelFor(const unsigned int uFirst,
+                                 const unsigned int uLast,
+                                 const QDelegate<void (const unsigned int, const unsigned int)> body,
+                                 const unsigned int uGrainSize)
+{
+    QE_ASSERT_ERROR(!body.IsNull(), "The input body cannot be null.");
+
+    if(uLast <= uFirst)
+        return;
+
+    static const unsigned int RANGES_PER_THREAD = 4U;
+
+    const unsigned int ITERATIONS = uLast - uFirst;
+    unsigned int uRangeSize = uGrainSize;
+
+    if(uRangeSize == 0)
+    {
+        const unsigned int MAX_RANGES = (m_uWorkerCount + 1U) * RANGES_PER_THREAD;
+        uRangeSize = (ITERATIONS + MAX_RANGES - 1U) / MAX_RANGES;
+    }
+
+    const unsigned int RANGE_COUNT = (ITERATIONS + uRangeSize - 1U) / uRangeSize;
+    const unsigned int QUEUE = this->GetCurrentQueue();
+
+    QParallelForRange* arRanges = new QParallelForRange[RANGE_COUNT];
+    QTaskGroup group;
+    group.m_uPendingTasks.store(RANGE_COUNT, boost::memory_order_relaxed);
+
+    // Ranges are added in reverse order so the calling thread starts with the first one while other threads steal the last ones
+    for(unsigned int i = RANGE_COUNT; i > 0; --i)
+    {
+        QParallelForRange &range = arRanges[i - 1U];
+        range.m_body = body;
+        range.m_uFirst = uFirst + (i - 1U) * uRangeSize;
+        range.m_uLast = i == RANGE_COUNT ? uLast : range.m_uFirst + uRangeSize;
+
+        QTask* pTask = new QTask(QDelegate<void ()>(&range, &QParallelForRange::Execute), group);
+        pTask->m_bSubmitted = true;
+        pTask->m_uPendingDependencies.store(0, boost::memory_order_relaxed);
+        m_arQueues[QUEUE].PushBack(pTask);
+    }
+
+    this->WakeUpThreads(RANGE_COUNT);
+    this->Wait(group);
+
+    delete[] arRanges;
+}
+
+void QTaskScheduler::WorkerLoop(const unsigned int uQueue)
+{
+    QWorkerIdentity &currentWorker = QTaskScheduler::GetCurrentWorkerIdentity();
+    currentWorker.m_pScheduler = this;
+    currentWorker.m_uQueue = uQueue;
+
+    while(!m_bStopRequested.load(boost::memory_order_acquire))
+    {
+        QTask* pTask = this->TakeTask(uQueue);
+
+        if(pTask == null_q)
+        {
+            QScopedExclusiveLock<> lock(m_mutex);
+            ++m_uSleepingWorkers;
+
+            // The queues are checked again after announcing that the thread is going to sleep, so the threads that add tasks 
+            // meanwhile will notify it
+            pTask = this->TakeTask(uQueue);
+
+            if(pTask == null_q && !m_bStopRequested.load(boost::memory_order_relaxed))
+                m_taskAvailable.Wait(lock);
+
+            --m_uSleepingWorkers;
+        }
+
+        if(pTask != null_q)
+            this->ExecuteTask(pTask, uQueue);
+    }
+}
+
+QTaskScheduler::QTask* QTaskScheduler::TakeTask(const unsigned int uQueue)
+{
+    const unsigned int QUEUE_COUNT = m_uWorkerCount + 1U;
+
+    QTask* pTask = m_arQueues[uQueue].PopBack();
+
+    for(unsigned int i = 1U; pTask == null_q && i < QUEUE_COUNT; ++i)
+        pTask = m_arQueues[(uQueue + i) % QUEUE_COUNT].PopFront();
+
+    return pTask;
+}
+
+void QTaskScheduler::ExecuteTask(QTask* pTask, const unsigned int uQueue)
+{
+    pTask->m_function();
+
+    QContinuation* pContinuation = pTask->m_pContinuations;
+    unsigned int uReleasedTasks = 0;
+
+    while(pContinuation != null_q)
+    {
+        if(pContinuation->m_pTask->m_uPendingDependencies.fetch_sub(1U, boost::memory_order_acq_rel) == 1U)
+        {
+            m_arQueues[uQueue].PushBack(pContinuation->m_pTask);
+            ++uReleasedTasks;
+        }
+
+        QContinuation* pNext = pContinuation->m_pNext;
+        delete pContinuation;
+        pContinuation = pNext;
+    }
+
+    if(uReleasedTasks > 0)
+        this->WakeUpThreads(uReleasedTasks);
+
+    QTaskGroup* pGroup = pTask->m_pGroup;
+    delete pTask;
+
+    // The group may be destroyed as soon as its counter reaches zero, so it must not be used after decrementing it
+    if(pGroup->m_uPendingTasks.fetch_sub(1U) == 1U && m_uSleepingWaiters.load() > 0)
+    {
+        QScopedExclusiveLock<> lock(m_mutex);
+        m_taskFinished.NotifyAll();
+    }
+}
+
+void QTaskScheduler::WakeUpThreads(const unsigned int uNewTasks)
+{
+    // Sleeping threads increment the counters before checking the queues for the last time and keep the mutex until they sleep,
+    // so either they find the new tasks or they are notified here
+    if(m_uSleepingWorkers.load() > 0)
+    {
+        QScopedExclusiveLock<> lock(m_mutex);
+
+        if(uNewTasks == 1U)
+            m_taskAvailable.NotifyOne();
+        else
+            m_taskAvailable.NotifyAll();
+    }
+    else if(m_uSleepingWaiters.load() > 0)
+    {
+        // Threads that wait for groups are only woken up when there is no worker to execute the tasks
+        QScopedExclusiveLock<> lock(m_mutex);
+        m_taskFinished.NotifyAll();
+    }
+}
+
+unsigned int QTaskScheduler::GetCurrentQueue() const
+{
+    const QWorkerIdentity &CURRENT_WORKER = QTaskScheduler::GetCurrentWorkerIdentity();
+
+    return CURRENT_WORKER.m_pScheduler == this ? CURRENT_WORKER.m_uQueue : m_uWorkerCount;
+}
+
+QTaskScheduler::QWorkerIdentity& QTaskScheduler::GetCurrentWorkerIdentity()
+{
+    static threadlocal_q QWorkerIdentity currentWorker = { null_q, 0 };
+
+    return currentWorker;
+}
+
+void QTaskScheduler::QTaskQueue::PushBack(QTask* pTask)
+{
+    QScopedExclusiveLock<> lock(m_mutex);
+
+    if(m_uCount == m_uCapacity)
+    {
+        QTask** arNewTasks = new QTask*[m_uCapacity * 2U];
+
+        for(unsigned int i = 0; i < m_uCount; ++i)
+            arNewTasks[i] = m_arTasks[(m_uFirst + i) % m_uCapacity];
+
+        delete[] m_arTasks;
+        m_arTasks = arNewTasks;
+        m_uCapacity *= 2U;
+        m_uFirst = 0;
+    }
+
+    m_arTasks[(m_uFirst + m_uCount) % m_uCapacity] = pTask;
+    ++m_uCount;
+}
+
+QTaskScheduler::QTask* QTaskScheduler::QTaskQueue::PopBack()
+{
+    QScopedExclusiveLock<> lock(m_mutex);
+
+    QTask* pTask = null_q;
+
+    if(m_uCount > 0)
+    {
+        --m_uCount;
+        pTask = m_arTasks[(m_uFirst + m_uCount) % m_uCapacity];
+    }
+
+    return pTask;
+}
+
+QTaskScheduler::QTask* QTaskScheduler::QTaskQueue::PopFront()
+{
+    QScopedExclusiveLock<> lock(m_mutex);
+
+    QTask* pTask = null_q;
+
+    if(m_uCount > 0)
+    {
+        pTask = m_arTasks[m_uFirst];
+        m_uFirst = (m_uFirst + 1U) % m_uCapacity;
+        --m_uCount;
+    }
+
+    return pTask;
+}
+
+void QTaskScheduler::QParallelForRange::Execute()
+{
+    m_body(m_uFirst, m_uLast);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+unsigned int QTaskScheduler::GetWorkerCount() const
+{
+    return m_uWorkerCount;
+}
+
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -0,0 +1,86 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "QStringUnicode.h"
+
+#include <unicode/ucnv.h>
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QStringUnicode::QThreadICUObjects::QThreadICUObjects() : m_pCanonicalCaseSensitiveCollator(null_q),
+                                                         m_pCanonicalCaseInsensitiveCollator(null_q),
+                                                         m_pIntegerFormatter(null_q),
+                                                         m_pFloatFormatter(null_q)
+{
+    for(unsigned int i = 0; i < QThreadICUObjects::CONVERTERS_COUNT; ++i)
+        m_arConverters[i] = null_q;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QStringUnicode::QThreadICUObjects::~QThreadICUObjects()
+{
+    for(unsigned int i = 0; i < QThreadICUObjects::CONVERTERS_COUNT; ++i)
+    {
+        if(m_arConverters[i] != null_q)
+            ucnv_close(m_arConverters[i]);
+    }
+
+    delete m_pCanonicalCaseSensitiveCollator;
+    delete m_pCanonicalCaseInsensitiveCollator;
+    delete m_pIntegerFormatter;
+    delete m_pFloatFormatter;
+}
+
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
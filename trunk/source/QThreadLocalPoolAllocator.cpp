@@ -0,0 +1,253 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "QThreadLocalPoolAllocator.h"
+
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "QScopedExclusiveLock.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QThreadLocalPoolAllocator::QThreadLocalPoolAllocator(QLockFreePoolAllocator &sharedPool, const unsigned int uCacheCapacity) :
+                                                                                    m_sharedPool(sharedPool),
+                                                                                    m_uCacheCapacity(uCacheCapacity),
+                                                                                    m_pRegistry(new QCacheRegistry()),
+                                                                                    m_threadCache(&QThreadLocalPoolAllocator::DestroyThreadCache)
+{
+    QE_ASSERT_ERROR( uCacheCapacity > 1U, "The capacity of the cache must be greater than one" );
+
+    m_pRegistry->m_pSharedPool = &sharedPool;
+    m_pRegistry->m_pFirstCache = null_q;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QThreadLocalPoolAllocator::~QThreadLocalPoolAllocator()
+{
+    // The destructor of thread_specific_ptr only destroys the cache of the calling thread; the caches of other threads are destroyed
+    // when they finish, so their blocks are returned now and they are detached from the shared pool
+    if(this->FindThreadCache() != null_q)
+        m_threadCache.reset();
+
+    bool bIsRegistryUnused = false;
+
+    {
+        QScopedExclusiveLock<> lock(m_pRegistry->m_mutex);
+
+        for(QThreadCache* pCache = m_pRegistry->m_pFirstCache; pCache != null_q; pCache = pCache->m_pNext)
+        {
+            m_sharedPool.DeallocateBatch(pCache->m_arBlocks, pCache->m_uCount);
+            pCache->m_uCount = 0;
+        }
+
+        m_pRegistry->m_pSharedPool = null_q;
+        bIsRegistryUnused = m_pRegistry->m_pFirstCache == null_q;
+    }
+
+    if(bIsRegistryUnused)
+        delete m_pRegistry;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void* QThreadLocalPoolAllocator::Allocate()
+{
+    QThreadCache* pCache = this->GetThreadCache();
+
+    if(pCache->m_uCount == 0)
+    {
+        pCache->m_uCount = m_sharedPool.AllocateBatch(pCache->m_arBlocks, m_uCacheCapacity / 2U);
+
+        if(pCache->m_uCount == 0)
+            return null_q;
+    }
+
+    --pCache->m_uCount;
+    return pCache->m_arBlocks[pCache->m_uCount];
+}
+
+void QThreadLocalPoolAllocator::Deallocate(const void* pBlock)
+{
+    QE_ASSERT_ERROR( null_q != pBlock, "Pointer to block to deallocate cannot be null" );
+
+    QThreadCache* pCache = this->GetThreadCache();
+
+    if(pCache->m_uCount == m_uCacheCapacity)
+    {
+        // The oldest half is returned, the most recently used blocks are more likely to be in the processor cache
+        const unsigned int RETURNED_BLOCKS = m_uCacheCapacity / 2U;
+        m_sharedPool.DeallocateBatch(pCache->m_arBlocks, RETURNED_BLOCKS);
+
+        pCache->m_uCount -= RETURNED_BLOCKS;
+
+        for(unsigned int i = 0; i < pCache->m_uCount; ++i)
+            pCache->m_arBlocks[i] = pCache->m_arBlocks[RETURNED_BLOCKS + i];
+    }
+
+    pCache->m_arBlocks[pCache->m_uCount] = ccast_q(pBlock, void*);
+    ++pCache->m_uCount;
+}
+
+void QThreadLocalPoolAllocator::ReleaseCache()
+{
+    QThreadCache* pCache = this->FindThreadCache();
+
+    if(pCache != null_q)
+    {
+        m_sharedPool.DeallocateBatch(pCache->m_arBlocks, pCache->m_uCount);
+        pCache->m_uCount = 0;
+    }
+}
+
+QThreadLocalPoolAllocator::QThreadCache* QThreadLocalPoolAllocator::GetThreadCache()
+{
+    QThreadCache* pCache = m_threadCache.get();
+
+    // The cache may belong to a destroyed allocator that occupied the same address
+    if(pCache == null_q || pCache->m_pRegistry != m_pRegistry)
+    {
+        pCache = new QThreadCache();
+        pCache->m_pRegistry = m_pRegistry;
+        pCache->m_arBlocks = new void*[m_uCacheCapacity];
+        pCache->m_uCount = 0;
+        pCache->m_pPrevious = null_q;
+
+        {
+            QScopedExclusiveLock<> lock(m_pRegistry->m_mutex);
+            pCache->m_pNext = m_pRegistry->m_pFirstCache;
+
+            if(m_pRegistry->m_pFirstCache != null_q)
+                m_pRegistry->m_pFirstCache->m_pPrevious = pCache;
+
+            m_pRegistry->m_pFirstCache = pCache;
+        }
+
+        m_threadCache.reset(pCache);
+    }
+
+    return pCache;
+}
+
+QThreadLocalPoolAllocator::QThreadCache* QThreadLocalPoolAllocator::FindThreadCache() const
+{
+    QThreadCache* pCache = m_threadCache.get();
+    return pCache == null_q || pCache->m_pRegistry != m_pRegistry ? null_q : pCache;
+}
+
+void QThreadLocalPoolAllocator::DestroyThreadCache(QThreadCache* pCache)
+{
+    QCacheRegistry* pRegistry = pCache->m_pRegistry;
+    bool bIsRegistryUnused = false;
+
+    {
+        QScopedExclusiveLock<> lock(pRegistry->m_mutex);
+
+        if(pRegistry->m_pSharedPool != null_q)
+            pRegistry->m_pSharedPool->DeallocateBatch(pCache->m_arBlocks, pCache->m_uCount);
+
+        if(pCache->m_pPrevious != null_q)
+            pCache->m_pPrevious->m_pNext = pCache->m_pNext;
+        else
+            pRegistry->m_pFirstCache = pCache->m_pNext;
+
+        if(pCache->m_pNext != null_q)
+            pCache->m_pNext->m_pPrevious = pCache->m_pPrevious;
+
+        bIsRegistryUnused = pRegistry->m_pSharedPool == null_q && pRegistry->m_pFirstCache == null_q;
+    }
+
+    delete[] pCache->m_arBlocks;
+    delete pCache;
+
+    if(bIsRegistryUnused)
+        delete pRegistry;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QLockFreePoolAllocator& QThreadLocalPoolAllocator::GetSharedPool() const
+{
+    return m_sharedPool;
+}
+
+unsigned int QThreadLocalPoolAllocator::GetCacheCapacity() const
+{
+    return m_uCacheCapacity;
+}
+
+unsigned int QThreadLocalPoolAllocator::GetCachedBlockCount() const
+{
+    const QThreadCache* pCache = this->FindThreadCache();
+    return pCache == null_q ? 0 : pCache->m_uCount;
+}
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -68,8 +68,30 @@ QTimeZone::QTimeZone(const string_q &strId, const string_q &strName,
             m_dstInformation(dstInformation),
             m_timeZoneOffset(timeZoneOffset),
             m_bTzOffsetIsNegative(bIsTimeZoneOffsetNegative),
-            m_bHasDstOffset(bHasDstOffset)
+            m_bHasDstOffset(bHasDstOffset),
+            m_arDstStartInYear(null_q),
+            m_arDstEndInYear(null_q),
+            m_offsetWithDst(timeZoneOffset),
+            m_bOffsetWithDstIsNegative(bIsTimeZoneOffsetNegative)
 {
+    if(m_bHasDstOffset)
+        this->_CalculateDstPeriods();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QTimeZone::~QTimeZone()
+{
+    delete[] m_arDstStartInYear;
+    delete[] m_arDstEndInYear;
 }
 
 
@@ -92,53 +114,79 @@ void QTimeZone::CalculateOffset(const QDateTime &dateTime, QTimeSpan &offset, bo
 
     QE_ASSERT_ERROR(dateTime != QDateTime::GetUndefinedDate(), "The input date is undefined");
 
-    QTimeSpan dstOffset(0);
-
-    offset = m_timeZoneOffset;
-
     if(m_bHasDstOffset && dateTime >= FIRST_DATETIME_WITH_DST && dateTime < MAXIMUM_DATETIME_WITH_DST)
     {
-        QDateTime startDateTime = m_dstInformation.GetStartInYear(dateTime.GetYear());
-        QDateTime endDateTime = m_dstInformation.GetEndInYear(dateTime.GetYear());
+        const int YEAR = scast_q(dateTime.GetYear(), int);
+        bool bIsDstActive = false;
 
-        if(dateTime >= startDateTime && dateTime < endDateTime)
+        if(YEAR >= QTimeZone::_FIRST_CACHED_DST_YEAR && YEAR <= QTimeZone::_LAST_CACHED_DST_YEAR)
         {
-            if(!m_bTzOffsetIsNegative && !m_dstInformation.IsOffsetNegative())
-            {
-                // Both offsets are positive, they are summed
-                offset += m_dstInformation.GetOffset();
-                bIsNegative = false;
-            }
-            else if(m_bTzOffsetIsNegative && m_dstInformation.IsOffsetNegative())
-            {
-                // Both are negative, they are summed
-                offset += m_dstInformation.GetOffset();
-                bIsNegative = true;
-            }
-            else if(m_timeZoneOffset >= m_dstInformation.GetOffset())
-            {
-                // Time zone offset is bigger or equals the DST offset, the result is the difference
-                offset -= m_dstInformation.GetOffset();
-                bIsNegative = m_bTzOffsetIsNegative;
-            }
-            else
-            {
-                // Time zone offset is smaller than the DST offset, the result is the difference
-                offset = m_dstInformation.GetOffset() - offset;
-                bIsNegative = m_dstInformation.IsOffsetNegative();
-            }
+            // The DST period of the year was calculated when the time zone was created
+            const int YEAR_INDEX = YEAR - QTimeZone::_FIRST_CACHED_DST_YEAR;
+            bIsDstActive = dateTime >= m_arDstStartInYear[YEAR_INDEX] && dateTime < m_arDstEndInYear[YEAR_INDEX];
         }
         else
         {
+            bIsDstActive = dateTime >= m_dstInformation.GetStartInYear(YEAR) && dateTime < m_dstInformation.GetEndInYear(YEAR);
+        }
+
+        if(bIsDstActive)
+        {
+            offset = m_offsetWithDst;
+            bIsNegative = m_bOffsetWithDstIsNegative;
+        }
+        else
+        {
+            offset = m_timeZoneOffset;
             bIsNegative = m_bTzOffsetIsNegative;
         }
     }
     else
     {
+        offset = m_timeZoneOffset;
         bIsNegative = m_bTzOffsetIsNegative;
     }
 }
 
+void QTimeZone::_CalculateDstPeriods()
+{
+    static const int CACHED_YEARS_COUNT = QTimeZone::_LAST_CACHED_DST_YEAR - QTimeZone::_FIRST_CACHED_DST_YEAR + 1;
+
+    m_arDstStartInYear = new QDateTime[CACHED_YEARS_COUNT];
+    m_arDstEndInYear = new QDateTime[CACHED_YEARS_COUNT];
+
+    for(int i = 0; i < CACHED_YEARS_COUNT; ++i)
+    {
+        m_arDstStartInYear[i] = m_dstInformation.GetStartInYear(QTimeZone::_FIRST_CACHED_DST_YEAR + i);
+        m_arDstEndInYear[i] = m_dstInformation.GetEndInYear(QTimeZone::_FIRST_CACHED_DST_YEAR + i);
+    }
+
+    if(!m_bTzOffsetIsNegative && !m_dstInformation.IsOffsetNegative())
+    {
+        // Both offsets are positive, they are summed
+        m_offsetWithDst = m_timeZoneOffset + m_dstInformation.GetOffset();
+        m_bOffsetWithDstIsNegative = false;
+    }
+    else if(m_bTzOffsetIsNegative && m_dstInformation.IsOffsetNegative())
+    {
+        // Both are negative, they are summed
+        m_offsetWithDst = m_timeZoneOffset + m_dstInformation.GetOffset();
+        m_bOffsetWithDstIsNegative = true;
+    }
+    else if(m_timeZoneOffset >= m_dstInformation.GetOffset())
+    {
+        // Time zone offset is bigger or equals the DST offset, the result is the difference
+        m_offsetWithDst = m_timeZoneOffset - m_dstInformation.GetOffset();
+        m_bOffsetWithDstIsNegative = m_bTzOffsetIsNegative;
+    }
+    else
+    {
+        // Time zone offset is smaller than the DST offset, the result is the difference
+        m_offsetWithDst = m_dstInformation.GetOffset() - m_timeZoneOffset;
+        m_bOffsetWithDstIsNegative = m_dstInformation.IsOffsetNegative();
+    }
+}
+
 
 //##################=======================================================##################
 //##################             ____________________________              ##################
@@ -0,0 +1,353 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "SQMatrixSIMD.h"
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+
+using Kinesis::QuimeraEngine::Common::DataTypes::SQVF32;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Math
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void SQMatrixSIMD::Multiply(const QBaseMatrix4x4 &left, const QBaseMatrix4x4 &right, QBaseMatrix4x4 &output)
+{
+    // All the rows of the right matrix are loaded before writing, so the output can be any of the operands
+    const vf32_q RIGHT_ROW0 = SQVF32::Load(right.ij[0]);
+    const vf32_q RIGHT_ROW1 = SQVF32::Load(right.ij[1]);
+    const vf32_q RIGHT_ROW2 = SQVF32::Load(right.ij[2]);
+    const vf32_q RIGHT_ROW3 = SQVF32::Load(right.ij[3]);
+
+    for(unsigned int i = 0; i < 4; ++i)
+    {
+        const vf32_q LEFT_ROW = SQVF32::Load(left.ij[i]);
+
+        // Every row of the result is a linear combination of the rows of the right matrix
+        vf32_q vfResult = SQVF32::Multiply(SQVF32::Shuffle<0, 0, 0, 0>(LEFT_ROW), RIGHT_ROW0);
+        vfResult = SQVF32::MultiplyAdd(SQVF32::Shuffle<1, 1, 1, 1>(LEFT_ROW), RIGHT_ROW1, vfResult);
+        vfResult = SQVF32::MultiplyAdd(SQVF32::Shuffle<2, 2, 2, 2>(LEFT_ROW), RIGHT_ROW2, vfResult);
+        vfResult = SQVF32::MultiplyAdd(SQVF32::Shuffle<3, 3, 3, 3>(LEFT_ROW), RIGHT_ROW3, vfResult);
+
+        SQVF32::Store(vfResult, output.ij[i]);
+    }
+}
+
+void SQMatrixSIMD::Multiply(const QBaseMatrix4x4 &left, const QBaseMatrix4x3 &right, QBaseMatrix4x3 &output)
+{
+    vf32_q arRightRows[4];
+    SQMatrixSIMD::LoadRows(right, arRightRows);
+
+    vf32_q arResultRows[4];
+
+    for(unsigned int i = 0; i < 4; ++i)
+    {
+        const vf32_q LEFT_ROW = SQVF32::Load(left.ij[i]);
+
+        arResultRows[i] = SQVF32::Multiply(SQVF32::Shuffle<0, 0, 0, 0>(LEFT_ROW), arRightRows[0]);
+        arResultRows[i] = SQVF32::MultiplyAdd(SQVF32::Shuffle<1, 1, 1, 1>(LEFT_ROW), arRightRows[1], arResultRows[i]);
+        arResultRows[i] = SQVF32::MultiplyAdd(SQVF32::Shuffle<2, 2, 2, 2>(LEFT_ROW), arRightRows[2], arResultRows[i]);
+        arResultRows[i] = SQVF32::MultiplyAdd(SQVF32::Shuffle<3, 3, 3, 3>(LEFT_ROW), arRightRows[3], arResultRows[i]);
+    }
+
+    SQMatrixSIMD::StoreRows(arResultRows, output);
+}
+
+void SQMatrixSIMD::MultiplyTransformations(const QBaseMatrix4x4 &left, const QBaseMatrix4x4 &right, QBaseMatrix4x4 &output)
+{
+    vf32_q arLeftRows[4];
+    vf32_q arRightRows[4];
+    vf32_q arResultRows[4];
+
+    for(unsigned int i = 0; i < 4; ++i)
+    {
+        arLeftRows[i] = SQVF32::Load(left.ij[i]);
+        arRightRows[i] = SQVF32::Load(right.ij[i]);
+    }
+
+    SQMatrixSIMD::MultiplyTransformationRows(arLeftRows, arRightRows, arResultRows);
+
+    // The fourth column is kept as is in the left matrix
+    const vf32_q FOURTH_COMPONENT_MASK = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+    for(unsigned int i = 0; i < 4; ++i)
+        SQVF32::Store(SQVF32::Select(FOURTH_COMPONENT_MASK, arLeftRows[i], arResultRows[i]), output.ij[i]);
+}
+
+void SQMatrixSIMD::MultiplyTransformations(const QBaseMatrix4x4 &left, const QBaseMatrix4x3 &right, QBaseMatrix4x4 &output)
+{
+    vf32_q arLeftRows[4];
+    vf32_q arRightRows[4];
+    vf32_q arResultRows[4];
+
+    for(unsigned int i = 0; i < 4; ++i)
+        arLeftRows[i] = SQVF32::Load(left.ij[i]);
+
+    SQMatrixSIMD::LoadRows(right, arRightRows);
+    SQMatrixSIMD::MultiplyTransformationRows(arLeftRows, arRightRows, arResultRows);
+
+    // The fourth column is kept as is in the left matrix
+    const vf32_q FOURTH_COMPONENT_MASK = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+    for(unsigned int i = 0; i < 4; ++i)
+        SQVF32::Store(SQVF32::Select(FOURTH_COMPONENT_MASK, arLeftRows[i], arResultRows[i]), output.ij[i]);
+}
+
+void SQMatrixSIMD::MultiplyTransformations(const QBaseMatrix4x3 &left, const QBaseMatrix4x4 &right, QBaseMatrix4x3 &output)
+{
+    vf32_q arLeftRows[4];
+    vf32_q arRightRows[4];
+    vf32_q arResultRows[4];
+
+    SQMatrixSIMD::LoadRows(left, arLeftRows);
+
+    for(unsigned int i = 0; i < 4; ++i)
+        arRightRows[i] = SQVF32::Load(right.ij[i]);
+
+    SQMatrixSIMD::MultiplyTransformationRows(arLeftRows, arRightRows, arResultRows);
+    SQMatrixSIMD::StoreRows(arResultRows, output);
+}
+
+void SQMatrixSIMD::MultiplyTransformations(const QBaseMatrix4x3 &left, const QBaseMatrix4x3 &right, QBaseMatrix4x3 &output)
+{
+    vf32_q arLeftRows[4];
+    vf32_q arRightRows[4];
+    vf32_q arResultRows[4];
+
+    SQMatrixSIMD::LoadRows(left, arLeftRows);
+    SQMatrixSIMD::LoadRows(right, arRightRows);
+    SQMatrixSIMD::MultiplyTransformationRows(arLeftRows, arRightRows, arResultRows);
+    SQMatrixSIMD::StoreRows(arResultRows, output);
+}
+
+void SQMatrixSIMD::Transpose(const QBaseMatrix4x4 &matrix, QBaseMatrix4x4 &output)
+{
+    vf32_q vfRow0 = SQVF32::Load(matrix.ij[0]);
+    vf32_q vfRow1 = SQVF32::Load(matrix.ij[1]);
+    vf32_q vfRow2 = SQVF32::Load(matrix.ij[2]);
+    vf32_q vfRow3 = SQVF32::Load(matrix.ij[3]);
+
+    _MM_TRANSPOSE4_PS(vfRow0, vfRow1, vfRow2, vfRow3);
+
+    SQVF32::Store(vfRow0, output.ij[0]);
+    SQVF32::Store(vfRow1, output.ij[1]);
+    SQVF32::Store(vfRow2, output.ij[2]);
+    SQVF32::Store(vfRow3, output.ij[3]);
+}
+
+void SQMatrixSIMD::Invert(const QBaseMatrix4x4 &matrix, QBaseMatrix4x4 &output)
+{
+    // The matrix is split into four 2x2 blocks:
+    //
+    //     | A B |
+    // M = |     |
+    //     | C D |
+    //
+    // The inverse is calculated as (being X# the adjugate of X and |X| its determinant):
+    //
+    //               | |D|A - B(D#C)     (|B|C - D(A#B)#)# |#
+    // M^-1 = 1/|M|  |                                     |
+    //               | (|C|B - A(D#C)#)# |A|D - C(A#B)     |
+    //
+    // where |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+
+    const vf32_q ROW0 = SQVF32::Load(matrix.ij[0]);
+    const vf32_q ROW1 = SQVF32::Load(matrix.ij[1]);
+    const vf32_q ROW2 = SQVF32::Load(matrix.ij[2]);
+    const vf32_q ROW3 = SQVF32::Load(matrix.ij[3]);
+
+    // Blocks, in row-major order
+    const vf32_q A = SQVF32::Shuffle<0, 1, 0, 1>(ROW0, ROW1);
+    const vf32_q B = SQVF32::Shuffle<2, 3, 2, 3>(ROW0, ROW1);
+    const vf32_q C = SQVF32::Shuffle<0, 1, 0, 1>(ROW2, ROW3);
+    const vf32_q D = SQVF32::Shuffle<2, 3, 2, 3>(ROW2, ROW3);
+
+    // Determinants of the blocks (|A|, |B|, |C|, |D|)
+    const vf32_q BLOCK_DETERMINANTS = SQVF32::Subtract(SQVF32::Multiply(SQVF32::Shuffle<0, 2, 0, 2>(ROW0, ROW2), SQVF32::Shuffle<1, 3, 1, 3>(ROW1, ROW3)),
+                                                       SQVF32::Multiply(SQVF32::Shuffle<1, 3, 1, 3>(ROW0, ROW2), SQVF32::Shuffle<0, 2, 0, 2>(ROW1, ROW3)));
+    const vf32_q DET_A = SQVF32::Shuffle<0, 0, 0, 0>(BLOCK_DETERMINANTS);
+    const vf32_q DET_B = SQVF32::Shuffle<1, 1, 1, 1>(BLOCK_DETERMINANTS);
+    const vf32_q DET_C = SQVF32::Shuffle<2, 2, 2, 2>(BLOCK_DETERMINANTS);
+    const vf32_q DET_D = SQVF32::Shuffle<3, 3, 3, 3>(BLOCK_DETERMINANTS);
+
+    // D#C and A#B
+    const vf32_q ADJD_C = SQMatrixSIMD::MultiplyAdjugate2x2ByMatrix2x2(D, C);
+    const vf32_q ADJA_B = SQMatrixSIMD::MultiplyAdjugate2x2ByMatrix2x2(A, B);
+
+    // Adjugates of the blocks of the inverse
+    vf32_q vfX = SQVF32::Subtract(SQVF32::Multiply(DET_D, A), SQMatrixSIMD::Multiply2x2(B, ADJD_C));
+    vf32_q vfW = SQVF32::Subtract(SQVF32::Multiply(DET_A, D), SQMatrixSIMD::Multiply2x2(C, ADJA_B));
+    vf32_q vfY = SQVF32::Subtract(SQVF32::Multiply(DET_B, C), SQMatrixSIMD::MultiplyMatrix2x2ByAdjugate2x2(D, ADJA_B));
+    vf32_q vfZ = SQVF32::Subtract(SQVF32::Multiply(DET_C, B), SQMatrixSIMD::MultiplyMatrix2x2ByAdjugate2x2(A, ADJD_C));
+
+    // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+    const vf32_q TRACE = SQVF32::DotProduct4(ADJA_B, SQVF32::Shuffle<0, 2, 1, 3>(ADJD_C));
+    const vf32_q DETERMINANT = SQVF32::Subtract(SQVF32::MultiplyAdd(DET_A, DET_D, SQVF32::Multiply(DET_B, DET_C)), TRACE);
+
+    // The signs of the adjugates are applied at the same time the determinant is divided
+    vf32_q vfSignedInvDeterminant;
+    SQVF32::Pack(SQFloat::_1, -SQFloat::_1, -SQFloat::_1, SQFloat::_1, vfSignedInvDeterminant);
+    vfSignedInvDeterminant = SQVF32::Divide(vfSignedInvDeterminant, DETERMINANT);
+
+    vfX = SQVF32::Multiply(vfX, vfSignedInvDeterminant);
+    vfY = SQVF32::Multiply(vfY, vfSignedInvDeterminant);
+    vfZ = SQVF32::Multiply(vfZ, vfSignedInvDeterminant);
+    vfW = SQVF32::Multiply(vfW, vfSignedInvDeterminant);
+
+    // The components of the adjugates are rearranged while composing the rows
+    SQVF32::Store(SQVF32::Shuffle<3, 1, 3, 1>(vfX, vfY), output.ij[0]);
+    SQVF32::Store(SQVF32::Shuffle<2, 0, 2, 0>(vfX, vfY), output.ij[1]);
+    SQVF32::Store(SQVF32::Shuffle<3, 1, 3, 1>(vfZ, vfW), output.ij[2]);
+    SQVF32::Store(SQVF32::Shuffle<2, 0, 2, 0>(vfZ, vfW), output.ij[3]);
+}
+
+void SQMatrixSIMD::InvertTransformation(const QBaseMatrix4x4 &matrix, QBaseMatrix4x4 &output)
+{
+    vf32_q arRows[4];
+    vf32_q arResultRows[4];
+
+    for(unsigned int i = 0; i < 4; ++i)
+        arRows[i] = SQVF32::Load(matrix.ij[i]);
+
+    SQMatrixSIMD::InvertTransformationRows(arRows, arResultRows);
+
+    // The fourth column is kept as is in the input matrix
+    const vf32_q FOURTH_COMPONENT_MASK = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+    for(unsigned int i = 0; i < 4; ++i)
+        SQVF32::Store(SQVF32::Select(FOURTH_COMPONENT_MASK, arRows[i], arResultRows[i]), output.ij[i]);
+}
+
+void SQMatrixSIMD::InvertTransformation(const QBaseMatrix4x3 &matrix, QBaseMatrix4x3 &output)
+{
+    vf32_q arRows[4];
+    vf32_q arResultRows[4];
+
+    SQMatrixSIMD::LoadRows(matrix, arRows);
+    SQMatrixSIMD::InvertTransformationRows(arRows, arResultRows);
+    SQMatrixSIMD::StoreRows(arResultRows, output);
+}
+
+void SQMatrixSIMD::LoadRows(const QBaseMatrix4x3 &matrix, vf32_q* arRows)
+{
+    // The first 3 rows can be read as 4 values since they are followed by more elements of the matrix
+    arRows[0] = SQVF32::Load(matrix.ij[0]);
+    arRows[1] = SQVF32::Load(matrix.ij[1]);
+    arRows[2] = SQVF32::Load(matrix.ij[2]);
+    arRows[3] = SQVF32::Load3(matrix.ij[3]);
+}
+
+void SQMatrixSIMD::StoreRows(const vf32_q* arRows, QBaseMatrix4x3 &matrix)
+{
+    SQVF32::Store3(arRows[0], matrix.ij[0]);
+    SQVF32::Store3(arRows[1], matrix.ij[1]);
+    SQVF32::Store3(arRows[2], matrix.ij[2]);
+    SQVF32::Store3(arRows[3], matrix.ij[3]);
+}
+
+vf32_q SQMatrixSIMD::Multiply2x2(const vf32_q vfLeft, const vf32_q vfRight)
+{
+    return SQVF32::MultiplyAdd(vfLeft, 
+                               SQVF32::Shuffle<0, 3, 0, 3>(vfRight), 
+                               SQVF32::Multiply(SQVF32::Shuffle<1, 0, 3, 2>(vfLeft), SQVF32::Shuffle<2, 1, 2, 1>(vfRight)));
+}
+
+vf32_q SQMatrixSIMD::MultiplyAdjugate2x2ByMatrix2x2(const vf32_q vfLeft, const vf32_q vfRight)
+{
+    return SQVF32::Subtract(SQVF32::Multiply(SQVF32::Shuffle<3, 3, 0, 0>(vfLeft), vfRight),
+                            SQVF32::Multiply(SQVF32::Shuffle<1, 1, 2, 2>(vfLeft), SQVF32::Shuffle<2, 3, 0, 1>(vfRight)));
+}
+
+vf32_q SQMatrixSIMD::MultiplyMatrix2x2ByAdjugate2x2(const vf32_q vfLeft, const vf32_q vfRight)
+{
+    return SQVF32::Subtract(SQVF32::Multiply(vfLeft, SQVF32::Shuffle<3, 0, 3, 0>(vfRight)),
+                            SQVF32::Multiply(SQVF32::Shuffle<1, 0, 3, 2>(vfLeft), SQVF32::Shuffle<2, 1, 2, 1>(vfRight)));
+}
+
+void SQMatrixSIMD::MultiplyTransformationRows(const vf32_q* arLeftRows, const vf32_q* arRightRows, vf32_q* arOutputRows)
+{
+    // The fourth column of both matrices is assumed to be (0, 0, 0, 1), so the fourth row of the right matrix
+    // only takes part in the calculation of the fourth row of the result
+    for(unsigned int i = 0; i < 4; ++i)
+    {
+        arOutputRows[i] = SQVF32::Multiply(SQVF32::Shuffle<0, 0, 0, 0>(arLeftRows[i]), arRightRows[0]);
+        arOutputRows[i] = SQVF32::MultiplyAdd(SQVF32::Shuffle<1, 1, 1, 1>(arLeftRows[i]), arRightRows[1], arOutputRows[i]);
+        arOutputRows[i] = SQVF32::MultiplyAdd(SQVF32::Shuffle<2, 2, 2, 2>(arLeftRows[i]), arRightRows[2], arOutputRows[i]);
+    }
+
+    arOutputRows[3] = SQVF32::Add(arOutputRows[3], arRightRows[3]);
+}
+
+void SQMatrixSIMD::InvertTransformationRows(const vf32_q* arRows, vf32_q* arOutputRows)
+{
+    // The cofactors of the 3x3 block are the cross products of its rows; the inverse is formed by their transposes
+    // divided by the determinant, which is the dot product of the first row and its cofactors
+    vf32_q vfCofactors0 = SQVF32::Subtract(SQVF32::Multiply(SQVF32::Shuffle<1, 2, 0, 3>(arRows[1]), SQVF32::Shuffle<2, 0, 1, 3>(arRows[2])),
+                                           SQVF32::Multiply(SQVF32::Shuffle<2, 0, 1, 3>(arRows[1]), SQVF32::Shuffle<1, 2, 0, 3>(arRows[2])));
+    vf32_q vfCofactors1 = SQVF32::Subtract(SQVF32::Multiply(SQVF32::Shuffle<1, 2, 0, 3>(arRows[2]), SQVF32::Shuffle<2, 0, 1, 3>(arRows[0])),
+                                           SQVF32::Multiply(SQVF32::Shuffle<2, 0, 1, 3>(arRows[2]), SQVF32::Shuffle<1, 2, 0, 3>(arRows[0])));
+    vf32_q vfCofactors2 = SQVF32::Subtract(SQVF32::Multiply(SQVF32::Shuffle<1, 2, 0, 3>(arRows[0]), SQVF32::Shuffle<2, 0, 1, 3>(arRows[1])),
+                                           SQVF32::Multiply(SQVF32::Shuffle<2, 0, 1, 3>(arRows[0]), SQVF32::Shuffle<1, 2, 0, 3>(arRows[1])));
+    vf32_q vfZero = _mm_setzero_ps();
+
+    const vf32_q INV_DETERMINANT = SQVF32::Divide(SQVF32::Fill(SQFloat::_1), SQVF32::DotProduct3(arRows[0], vfCofactors0));
+
+    _MM_TRANSPOSE4_PS(vfCofactors0, vfCofactors1, vfCofactors2, vfZero);
+
+    // The translation is transformed by the transposed cofactors and negated; it is divided by the determinant afterwards,
+    // along with the other rows, to reduce the accumulated rounding error
+    vf32_q vfTranslation = SQVF32::Multiply(SQVF32::Shuffle<0, 0, 0, 0>(arRows[3]), vfCofactors0);
+    vfTranslation = SQVF32::MultiplyAdd(SQVF32::Shuffle<1, 1, 1, 1>(arRows[3]), vfCofactors1, vfTranslation);
+    vfTranslation = SQVF32::MultiplyAdd(SQVF32::Shuffle<2, 2, 2, 2>(arRows[3]), vfCofactors2, vfTranslation);
+
+    arOutputRows[0] = SQVF32::Multiply(vfCofactors0, INV_DETERMINANT);
+    arOutputRows[1] = SQVF32::Multiply(vfCofactors1, INV_DETERMINANT);
+    arOutputRows[2] = SQVF32::Multiply(vfCofactors2, INV_DETERMINANT);
+    arOutputRows[3] = SQVF32::Multiply(SQVF32::Subtract(_mm_setzero_ps(), vfTranslation), INV_DETERMINANT);
+}
+
+} //namespace Math
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // QE_MATH_VECTORIZATION_ENABLED
@@ -0,0 +1,174 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "SQParallelPoint.h"
+
+#include "QVector3.h"
+#include "QVector4.h"
+#include "QMatrix4x3.h"
+#include "QMatrix4x4.h"
+#include "QTranslationMatrix.h"
+#include "QTransformationMatrix.h"
+
+using Kinesis::QuimeraEngine::Tools::Math::SQPoint;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const unsigned int SQParallelPoint::CACHE_LINE_SIZE = 64U;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void SQParallelPoint::Translate(const QBaseVector3 &vTranslation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QBaseVector3, QVector3>(&SQPoint::Translate, vTranslation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Translate(const QBaseVector3 &vTranslation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QBaseVector3, QVector4>(&SQPoint::Translate, vTranslation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Translate(const QTranslationMatrix<QMatrix4x3> &translation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QTranslationMatrix<QMatrix4x3>, QVector3>(&SQPoint::Translate, translation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Translate(const QTranslationMatrix<QMatrix4x3> &translation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QTranslationMatrix<QMatrix4x3>, QVector4>(&SQPoint::Translate, translation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Translate(const QTranslationMatrix<QMatrix4x4> &translation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QTranslationMatrix<QMatrix4x4>, QVector3>(&SQPoint::Translate, translation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Translate(const QTranslationMatrix<QMatrix4x4> &translation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QTranslationMatrix<QMatrix4x4>, QVector4>(&SQPoint::Translate, translation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Rotate(const QQuaternion &qRotation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QQuaternion, QVector3>(&SQPoint::Rotate, qRotation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Rotate(const QQuaternion &qRotation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QQuaternion, QVector4>(&SQPoint::Rotate, qRotation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Rotate(const QRotationMatrix3x3 &rotation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QRotationMatrix3x3, QVector3>(&SQPoint::Rotate, rotation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Rotate(const QRotationMatrix3x3 &rotation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QRotationMatrix3x3, QVector4>(&SQPoint::Rotate, rotation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Scale(const QBaseVector3 &vScale, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QBaseVector3, QVector3>(&SQPoint::Scale, vScale, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Scale(const QBaseVector3 &vScale, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QBaseVector3, QVector4>(&SQPoint::Scale, vScale, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Scale(const QScalingMatrix3x3 &scale, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QScalingMatrix3x3, QVector3>(&SQPoint::Scale, scale, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Scale(const QScalingMatrix3x3 &scale, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QScalingMatrix3x3, QVector4>(&SQPoint::Scale, scale, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Transform(const QTransformationMatrix<QMatrix4x3> &transformation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QTransformationMatrix<QMatrix4x3>, QVector3>(&SQPoint::Transform, transformation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Transform(const QTransformationMatrix<QMatrix4x3> &transformation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QTransformationMatrix<QMatrix4x3>, QVector4>(&SQPoint::Transform, transformation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Transform(const QTransformationMatrix<QMatrix4x4> &transformation, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QTransformationMatrix<QMatrix4x4>, QVector3>(&SQPoint::Transform, transformation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Transform(const QTransformationMatrix<QMatrix4x4> &transformation, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QTransformationMatrix<QMatrix4x4>, QVector4>(&SQPoint::Transform, transformation, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Transform(const QSpaceConversionMatrix &spaceConversion, QVector3* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QSpaceConversionMatrix, QVector3>(&SQPoint::Transform, spaceConversion, arPoints, uElements, scheduler, uPartitions);
+}
+
+void SQParallelPoint::Transform(const QSpaceConversionMatrix &spaceConversion, QVector4* arPoints, const unsigned int uElements, QTaskScheduler &scheduler, const unsigned int uPartitions)
+{
+    SQParallelPoint::ExecuteInParallel<QSpaceConversionMatrix, QVector4>(&SQPoint::Transform, spaceConversion, arPoints, uElements, scheduler, uPartitions);
+}
+
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -36,6 +36,11 @@
 #include "QTransformationMatrix.h"
 #include "QTranslationMatrix.h"
 #include "QSpaceConversionMatrix.h"
+#include "QSoAPointBuffer.h"
+#include "SQVF32.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::SQVF32;
+using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
 
 
 namespace Kinesis
@@ -673,6 +678,491 @@ void SQPoint::TransformWithPivot(const QTransformationMatrix<QMatrix4x4> &transf
     }
 }
 
+void SQPoint::ConvertToSoA(const QVector3* arPoints, const unsigned int uElements, QSoAPointBuffer &points)
+{
+    // Checks that the point array is not null
+    QE_ASSERT_ERROR( arPoints != null_q, "Input array must not be null" );
+    QE_ASSERT_ERROR( uElements <= points.GetCount(), "The buffer is not big enough to store all the points" );
+
+    float_q* arX = points.GetX();
+    float_q* arY = points.GetY();
+    float_q* arZ = points.GetZ();
+
+    for(unsigned int i = 0; i < uElements; ++i)
+    {
+        arX[i] = arPoints[i].x;
+        arY[i] = arPoints[i].y;
+        arZ[i] = arPoints[i].z;
+    }
+}
+
+void SQPoint::ConvertToSoA(const QVector4* arPoints, const unsigned int uElements, QSoAPointBuffer &points)
+{
+    // Checks that the point array is not null
+    QE_ASSERT_ERROR( arPoints != null_q, "Input array must not be null" );
+    QE_ASSERT_ERROR( uElements <= points.GetCount(), "The buffer is not big enough to store all the points" );
+
+    float_q* arX = points.GetX();
+    float_q* arY = points.GetY();
+    float_q* arZ = points.GetZ();
+
+    for(unsigned int i = 0; i < uElements; ++i)
+    {
+        arX[i] = arPoints[i].x;
+        arY[i] = arPoints[i].y;
+        arZ[i] = arPoints[i].z;
+    }
+}
+
+void SQPoint::ConvertToAoS(const QSoAPointBuffer &points, QVector3* arPoints)
+{
+    // Checks that the point array is not null
+    QE_ASSERT_ERROR( arPoints != null_q, "Output array must not be null" );
+
+    const float_q* arX = points.GetX();
+    const float_q* arY = points.GetY();
+    const float_q* arZ = points.GetZ();
+
+    for(unsigned int i = 0; i < points.GetCount(); ++i)
+    {
+        arPoints[i].x = arX[i];
+        arPoints[i].y = arY[i];
+        arPoints[i].z = arZ[i];
+    }
+}
+
+void SQPoint::ConvertToAoS(const QSoAPointBuffer &points, QVector4* arPoints)
+{
+    // Checks that the point array is not null
+    QE_ASSERT_ERROR( arPoints != null_q, "Output array must not be null" );
+
+    const float_q* arX = points.GetX();
+    const float_q* arY = points.GetY();
+    const float_q* arZ = points.GetZ();
+
+    for(unsigned int i = 0; i < points.GetCount(); ++i)
+    {
+        arPoints[i].x = arX[i];
+        arPoints[i].y = arY[i];
+        arPoints[i].z = arZ[i];
+    }
+}
+
+void SQPoint::Translate(const QBaseVector3 &vTranslation, QSoAPointBuffer &points)
+{
+    SQPoint::TranslateSoA(vTranslation.x, vTranslation.y, vTranslation.z, points);
+}
+
+void SQPoint::Translate(const float_q fTranslationX, const float_q fTranslationY, const float_q fTranslationZ, QSoAPointBuffer &points)
+{
+    SQPoint::TranslateSoA(fTranslationX, fTranslationY, fTranslationZ, points);
+}
+
+void SQPoint::Translate(const QTranslationMatrix<QMatrix4x3> &translation, QSoAPointBuffer &points)
+{
+    SQPoint::TranslateSoA(translation.ij[3][0], translation.ij[3][1], translation.ij[3][2], points);
+}
+
+void SQPoint::Translate(const QTranslationMatrix<QMatrix4x4> &translation, QSoAPointBuffer &points)
+{
+    SQPoint::TranslateSoA(translation.ij[3][0], translation.ij[3][1], translation.ij[3][2], points);
+}
+
+void SQPoint::Rotate(const QQuaternion &qRotation, QSoAPointBuffer &points)
+{
+    SQPoint::RotateSoA(qRotation, null_q, points);
+}
+
+void SQPoint::Rotate(const QRotationMatrix3x3 &rotation, QSoAPointBuffer &points)
+{
+    SQPoint::TransformSoA(rotation, null_q, null_q, points);
+}
+
+void SQPoint::Scale(const QBaseVector3 &vScale, QSoAPointBuffer &points)
+{
+    SQPoint::ScaleSoA(vScale.x, vScale.y, vScale.z, null_q, points);
+}
+
+void SQPoint::Scale(const float_q fScaleX, const float_q fScaleY, const float_q fScaleZ, QSoAPointBuffer &points)
+{
+    SQPoint::ScaleSoA(fScaleX, fScaleY, fScaleZ, null_q, points);
+}
+
+void SQPoint::Scale(const QScalingMatrix3x3 &scale, QSoAPointBuffer &points)
+{
+    SQPoint::ScaleSoA(scale.ij[0][0], scale.ij[1][1], scale.ij[2][2], null_q, points);
+}
+
+void SQPoint::Transform(const QTransformationMatrix<QMatrix4x3> &transformation, QSoAPointBuffer &points)
+{
+    SQPoint::TransformSoA(transformation, null_q, points);
+}
+
+void SQPoint::Transform(const QTransformationMatrix<QMatrix4x4> &transformation, QSoAPointBuffer &points)
+{
+    SQPoint::TransformSoA(transformation, null_q, points);
+}
+
+void SQPoint::Transform(const QSpaceConversionMatrix &spaceConversion, QSoAPointBuffer &points)
+{
+    SQPoint::TransformSoA(spaceConversion, null_q, points);
+}
+
+void SQPoint::RotateWithPivot(const QQuaternion &qRotation, const QBaseVector3 &vPivot, QSoAPointBuffer &points)
+{
+    SQPoint::RotateSoA(qRotation, &vPivot, points);
+}
+
+void SQPoint::RotateWithPivot(const QRotationMatrix3x3 &rotation, const QBaseVector3 &vPivot, QSoAPointBuffer &points)
+{
+    SQPoint::TransformSoA(rotation, null_q, &vPivot, points);
+}
+
+void SQPoint::ScaleWithPivot(const QBaseVector3 &vScale, const QBaseVector3 &vPivot, QSoAPointBuffer &points)
+{
+    SQPoint::ScaleSoA(vScale.x, vScale.y, vScale.z, &vPivot, points);
+}
+
+void SQPoint::ScaleWithPivot(const float_q fScaleX, const float_q fScaleY, const float_q fScaleZ, const QBaseVector3 &vPivot, QSoAPointBuffer &points)
+{
+    SQPoint::ScaleSoA(fScaleX, fScaleY, fScaleZ, &vPivot, points);
+}
+
+void SQPoint::ScaleWithPivot(const QScalingMatrix3x3 &scale, const QBaseVector3 &vPivot, QSoAPointBuffer &points)
+{
+    SQPoint::ScaleSoA(scale.ij[0][0], scale.ij[1][1], scale.ij[2][2], &vPivot, points);
+}
+
+void SQPoint::TransformWithPivot(const QTransformationMatrix<QMatrix4x3> &transformation, const QBaseVector3 &vPivot, QSoAPointBuffer &points)
+{
+    SQPoint::TransformSoA(transformation, &vPivot, points);
+}
+
+void SQPoint::TransformWithPivot(const QTransformationMatrix<QMatrix4x4> &transformation, const QBaseVector3 &vPivot, QSoAPointBuffer &points)
+{
+    SQPoint::TransformSoA(transformation, &vPivot, points);
+}
+
+void SQPoint::TranslateSoA(const float_q fTranslationX, const float_q fTranslationY, const float_q fTranslationZ, QSoAPointBuffer &points)
+{
+    float_q* arX = points.GetX();
+    float_q* arY = points.GetY();
+    float_q* arZ = points.GetZ();
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    const vf32_q TRANSLATION_X = SQVF32::Fill(fTranslationX);
+    const vf32_q TRANSLATION_Y = SQVF32::Fill(fTranslationY);
+    const vf32_q TRANSLATION_Z = SQVF32::Fill(fTranslationZ);
+
+    // Padding points are processed too, so there is no remainder
+    for(unsigned int i = 0; i < points.GetStreamLength(); i += QSoAPointBuffer::POINTS_PER_BLOCK)
+    {
+        SQVF32::StoreAligned(SQVF32::Add(SQVF32::LoadAligned(arX + i), TRANSLATION_X), arX + i);
+        SQVF32::StoreAligned(SQVF32::Add(SQVF32::LoadAligned(arY + i), TRANSLATION_Y), arY + i);
+        SQVF32::StoreAligned(SQVF32::Add(SQVF32::LoadAligned(arZ + i), TRANSLATION_Z), arZ + i);
+    }
+#else
+    for(unsigned int i = 0; i < points.GetCount(); ++i)
+    {
+        arX[i] += fTranslationX;
+        arY[i] += fTranslationY;
+        arZ[i] += fTranslationZ;
+    }
+#endif
+}
+
+void SQPoint::ScaleSoA(const float_q fScaleX, const float_q fScaleY, const float_q fScaleZ, const QBaseVector3* pPivot, QSoAPointBuffer &points)
+{
+    float_q* arX = points.GetX();
+    float_q* arY = points.GetY();
+    float_q* arZ = points.GetZ();
+
+    const bool USE_PIVOT = pPivot != null_q;
+    const QBaseVector3 PIVOT = USE_PIVOT ? *pPivot : QBaseVector3();
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    const vf32_q SCALE_X = SQVF32::Fill(fScaleX);
+    const vf32_q SCALE_Y = SQVF32::Fill(fScaleY);
+    const vf32_q SCALE_Z = SQVF32::Fill(fScaleZ);
+    const vf32_q PIVOT_X = SQVF32::Fill(PIVOT.x);
+    const vf32_q PIVOT_Y = SQVF32::Fill(PIVOT.y);
+    const vf32_q PIVOT_Z = SQVF32::Fill(PIVOT.z);
+
+    // Padding points are processed too, so there is no remainder
+    for(unsigned int i = 0; i < points.GetStreamLength(); i += QSoAPointBuffer::POINTS_PER_BLOCK)
+    {
+        vf32_q vfX = SQVF32::LoadAligned(arX + i);
+        vf32_q vfY = SQVF32::LoadAligned(arY + i);
+        vf32_q vfZ = SQVF32::LoadAligned(arZ + i);
+
+        if(USE_PIVOT)
+        {
+            vfX = SQVF32::Subtract(vfX, PIVOT_X);
+            vfY = SQVF32::Subtract(vfY, PIVOT_Y);
+            vfZ = SQVF32::Subtract(vfZ, PIVOT_Z);
+        }
+
+        vfX = SQVF32::Multiply(vfX, SCALE_X);
+        vfY = SQVF32::Multiply(vfY, SCALE_Y);
+        vfZ = SQVF32::Multiply(vfZ, SCALE_Z);
+
+        if(USE_PIVOT)
+        {
+            vfX = SQVF32::Add(vfX, PIVOT_X);
+            vfY = SQVF32::Add(vfY, PIVOT_Y);
+            vfZ = SQVF32::Add(vfZ, PIVOT_Z);
+        }
+
+        SQVF32::StoreAligned(vfX, arX + i);
+        SQVF32::StoreAligned(vfY, arY + i);
+        SQVF32::StoreAligned(vfZ, arZ + i);
+    }
+#else
+    for(unsigned int i = 0; i < points.GetCount(); ++i)
+    {
+        float_q fX = arX[i];
+        float_q fY = arY[i];
+        float_q fZ = arZ[i];
+
+        if(USE_PIVOT)
+        {
+            fX -= PIVOT.x;
+            fY -= PIVOT.y;
+            fZ -= PIVOT.z;
+        }
+
+        fX *= fScaleX;
+        fY *= fScaleY;
+        fZ *= fScaleZ;
+
+        if(USE_PIVOT)
+        {
+            fX += PIVOT.x;
+            fY += PIVOT.y;
+            fZ += PIVOT.z;
+        }
+
+        arX[i] = fX;
+        arY[i] = fY;
+        arZ[i] = fZ;
+    }
+#endif
+}
+
+void SQPoint::RotateSoA(const QQuaternion &qRotation, const QBaseVector3* pPivot, QSoAPointBuffer &points)
+{
+    // The operations are the same as in QVector3::Transform(QQuaternion), qRotation * (x, y, z, 0) * qRotation.Conjugate(),
+    // skipping the products by the zero W component so the results are the same
+
+    float_q* arX = points.GetX();
+    float_q* arY = points.GetY();
+    float_q* arZ = points.GetZ();
+
+    const bool USE_PIVOT = pPivot != null_q;
+    const QBaseVector3 PIVOT = USE_PIVOT ? *pPivot : QBaseVector3();
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    const vf32_q QX = SQVF32::Fill(qRotation.x);
+    const vf32_q QY = SQVF32::Fill(qRotation.y);
+    const vf32_q QZ = SQVF32::Fill(qRotation.z);
+    const vf32_q QW = SQVF32::Fill(qRotation.w);
+    const vf32_q CONJUGATE_X = SQVF32::Fill(-qRotation.x);
+    const vf32_q CONJUGATE_Y = SQVF32::Fill(-qRotation.y);
+    const vf32_q CONJUGATE_Z = SQVF32::Fill(-qRotation.z);
+    const vf32_q PIVOT_X = SQVF32::Fill(PIVOT.x);
+    const vf32_q PIVOT_Y = SQVF32::Fill(PIVOT.y);
+    const vf32_q PIVOT_Z = SQVF32::Fill(PIVOT.z);
+
+    // Padding points are processed too, so there is no remainder
+    for(unsigned int i = 0; i < points.GetStreamLength(); i += QSoAPointBuffer::POINTS_PER_BLOCK)
+    {
+        vf32_q vfX = SQVF32::LoadAligned(arX + i);
+        vf32_q vfY = SQVF32::LoadAligned(arY + i);
+        vf32_q vfZ = SQVF32::LoadAligned(arZ + i);
+
+        if(USE_PIVOT)
+        {
+            vfX = SQVF32::Subtract(vfX, PIVOT_X);
+            vfY = SQVF32::Subtract(vfY, PIVOT_Y);
+            vfZ = SQVF32::Subtract(vfZ, PIVOT_Z);
+        }
+
+        // qRotation * (x, y, z, 0)
+        const vf32_q PRODUCT_X = SQVF32::Subtract(SQVF32::Add(SQVF32::Multiply(vfX, QW), SQVF32::Multiply(vfY, QZ)), SQVF32::Multiply(vfZ, QY));
+        const vf32_q PRODUCT_Y = SQVF32::Subtract(SQVF32::Add(SQVF32::Multiply(vfY, QW), SQVF32::Multiply(vfZ, QX)), SQVF32::Multiply(vfX, QZ));
+        const vf32_q PRODUCT_Z = SQVF32::Subtract(SQVF32::Add(SQVF32::Multiply(vfZ, QW), SQVF32::Multiply(vfX, QY)), SQVF32::Multiply(vfY, QX));
+        const vf32_q PRODUCT_W = SQVF32::Subtract(SQVF32::Subtract(SQVF32::Multiply(vfX, CONJUGATE_X), SQVF32::Multiply(vfY, QY)), SQVF32::Multiply(vfZ, QZ));
+
+        // (qRotation * (x, y, z, 0)) * qRotation.Conjugate()
+        vfX = SQVF32::Subtract(SQVF32::Add(SQVF32::Add(SQVF32::Multiply(QW, PRODUCT_X), SQVF32::Multiply(CONJUGATE_X, PRODUCT_W)), 
+                                           SQVF32::Multiply(CONJUGATE_Y, PRODUCT_Z)), 
+                               SQVF32::Multiply(CONJUGATE_Z, PRODUCT_Y));
+        vfY = SQVF32::Subtract(SQVF32::Add(SQVF32::Add(SQVF32::Multiply(QW, PRODUCT_Y), SQVF32::Multiply(CONJUGATE_Y, PRODUCT_W)), 
+                                           SQVF32::Multiply(CONJUGATE_Z, PRODUCT_X)), 
+                               SQVF32::Multiply(CONJUGATE_X, PRODUCT_Z));
+        vfZ = SQVF32::Subtract(SQVF32::Add(SQVF32::Add(SQVF32::Multiply(QW, PRODUCT_Z), SQVF32::Multiply(CONJUGATE_Z, PRODUCT_W)), 
+                                           SQVF32::Multiply(CONJUGATE_X, PRODUCT_Y)), 
+                               SQVF32::Multiply(CONJUGATE_Y, PRODUCT_X));
+
+        if(USE_PIVOT)
+        {
+            vfX = SQVF32::Add(vfX, PIVOT_X);
+            vfY = SQVF32::Add(vfY, PIVOT_Y);
+            vfZ = SQVF32::Add(vfZ, PIVOT_Z);
+        }
+
+        SQVF32::StoreAligned(vfX, arX + i);
+        SQVF32::StoreAligned(vfY, arY + i);
+        SQVF32::StoreAligned(vfZ, arZ + i);
+    }
+#else
+    const float_q CONJUGATE_X = -qRotation.x;
+    const float_q CONJUGATE_Y = -qRotation.y;
+    const float_q CONJUGATE_Z = -qRotation.z;
+
+    for(unsigned int i = 0; i < points.GetCount(); ++i)
+    {
+        float_q fX = arX[i];
+        float_q fY = arY[i];
+        float_q fZ = arZ[i];
+
+        if(USE_PIVOT)
+        {
+            fX -= PIVOT.x;
+            fY -= PIVOT.y;
+            fZ -= PIVOT.z;
+        }
+
+        // qRotation * (x, y, z, 0)
+        const float_q PRODUCT_X = fX * qRotation.w + fY * qRotation.z - fZ * qRotation.y;
+        const float_q PRODUCT_Y = fY * qRotation.w + fZ * qRotation.x - fX * qRotation.z;
+        const float_q PRODUCT_Z = fZ * qRotation.w + fX * qRotation.y - fY * qRotation.x;
+        const float_q PRODUCT_W = fX * CONJUGATE_X - fY * qRotation.y - fZ * qRotation.z;
+
+        // (qRotation * (x, y, z, 0)) * qRotation.Conjugate()
+        fX = qRotation.w * PRODUCT_X + CONJUGATE_X * PRODUCT_W + CONJUGATE_Y * PRODUCT_Z - CONJUGATE_Z * PRODUCT_Y;
+        fY = qRotation.w * PRODUCT_Y + CONJUGATE_Y * PRODUCT_W + CONJUGATE_Z * PRODUCT_X - CONJUGATE_X * PRODUCT_Z;
+        fZ = qRotation.w * PRODUCT_Z + CONJUGATE_Z * PRODUCT_W + CONJUGATE_X * PRODUCT_Y - CONJUGATE_Y * PRODUCT_X;
+
+        if(USE_PIVOT)
+        {
+            fX += PIVOT.x;
+            fY += PIVOT.y;
+            fZ += PIVOT.z;
+        }
+
+        arX[i] = fX;
+        arY[i] = fY;
+        arZ[i] = fZ;
+    }
+#endif
+}
+
+void SQPoint::TransformSoA(const QBaseMatrix3x3 &matrix, const QBaseVector3* pTranslation, const QBaseVector3* pPivot, QSoAPointBuffer &points)
+{
+    float_q* arX = points.GetX();
+    float_q* arY = points.GetY();
+    float_q* arZ = points.GetZ();
+
+    const bool USE_TRANSLATION = pTranslation != null_q;
+    const QBaseVector3 TRANSLATION = USE_TRANSLATION ? *pTranslation : QBaseVector3();
+    const bool USE_PIVOT = pPivot != null_q;
+    const QBaseVector3 PIVOT = USE_PIVOT ? *pPivot : QBaseVector3();
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+    const vf32_q M00 = SQVF32::Fill(matrix.ij[0][0]);
+    const vf32_q M01 = SQVF32::Fill(matrix.ij[0][1]);
+    const vf32_q M02 = SQVF32::Fill(matrix.ij[0][2]);
+    const vf32_q M10 = SQVF32::Fill(matrix.ij[1][0]);
+    const vf32_q M11 = SQVF32::Fill(matrix.ij[1][1]);
+    const vf32_q M12 = SQVF32::Fill(matrix.ij[1][2]);
+    const vf32_q M20 = SQVF32::Fill(matrix.ij[2][0]);
+    const vf32_q M21 = SQVF32::Fill(matrix.ij[2][1]);
+    const vf32_q M22 = SQVF32::Fill(matrix.ij[2][2]);
+    const vf32_q TRANSLATION_X = SQVF32::Fill(TRANSLATION.x);
+    const vf32_q TRANSLATION_Y = SQVF32::Fill(TRANSLATION.y);
+    const vf32_q TRANSLATION_Z = SQVF32::Fill(TRANSLATION.z);
+    const vf32_q PIVOT_X = SQVF32::Fill(PIVOT.x);
+    const vf32_q PIVOT_Y = SQVF32::Fill(PIVOT.y);
+    const vf32_q PIVOT_Z = SQVF32::Fill(PIVOT.z);
+
+    // Padding points are processed too, so there is no remainder
+    for(unsigned int i = 0; i < points.GetStreamLength(); i += QSoAPointBuffer::POINTS_PER_BLOCK)
+    {
+        vf32_q vfX = SQVF32::LoadAligned(arX + i);
+        vf32_q vfY = SQVF32::LoadAligned(arY + i);
+        vf32_q vfZ = SQVF32::LoadAligned(arZ + i);
+
+        if(USE_PIVOT)
+        {
+            vfX = SQVF32::Subtract(vfX, PIVOT_X);
+            vfY = SQVF32::Subtract(vfY, PIVOT_Y);
+            vfZ = SQVF32::Subtract(vfZ, PIVOT_Z);
+        }
+
+        // Products and sums are not fused so the rounding is the same as in the scalar version
+        vf32_q vfResultX = SQVF32::Add(SQVF32::Add(SQVF32::Multiply(vfX, M00), SQVF32::Multiply(vfY, M10)), SQVF32::Multiply(vfZ, M20));
+        vf32_q vfResultY = SQVF32::Add(SQVF32::Add(SQVF32::Multiply(vfX, M01), SQVF32::Multiply(vfY, M11)), SQVF32::Multiply(vfZ, M21));
+        vf32_q vfResultZ = SQVF32::Add(SQVF32::Add(SQVF32::Multiply(vfX, M02), SQVF32::Multiply(vfY, M12)), SQVF32::Multiply(vfZ, M22));
+
+        if(USE_TRANSLATION)
+        {
+            vfResultX = SQVF32::Add(vfResultX, TRANSLATION_X);
+            vfResultY = SQVF32::Add(vfResultY, TRANSLATION_Y);
+            vfResultZ = SQVF32::Add(vfResultZ, TRANSLATION_Z);
+        }
+
+        if(USE_PIVOT)
+        {
+            vfResultX = SQVF32::Add(vfResultX, PIVOT_X);
+            vfResultY = SQVF32::Add(vfResultY, PIVOT_Y);
+            vfResultZ = SQVF32::Add(vfResultZ, PIVOT_Z);
+        }
+
+        SQVF32::StoreAligned(vfResultX, arX + i);
+        SQVF32::StoreAligned(vfResultY, arY + i);
+        SQVF32::StoreAligned(vfResultZ, arZ + i);
+    }
+#else
+    for(unsigned int i = 0; i < points.GetCount(); ++i)
+    {
+        float_q fX = arX[i];
+        float_q fY = arY[i];
+        float_q fZ = arZ[i];
+
+        if(USE_PIVOT)
+        {
+            fX -= PIVOT.x;
+            fY -= PIVOT.y;
+            fZ -= PIVOT.z;
+        }
+
+        float_q fResultX = fX * matrix.ij[0][0] + fY * matrix.ij[1][0] + fZ * matrix.ij[2][0];
+        float_q fResultY = fX * matrix.ij[0][1] + fY * matrix.ij[1][1] + fZ * matrix.ij[2][1];
+        float_q fResultZ = fX * matrix.ij[0][2] + fY * matrix.ij[1][2] + fZ * matrix.ij[2][2];
+
+        if(USE_TRANSLATION)
+        {
+            fResultX += TRANSLATION.x;
+            fResultY += TRANSLATION.y;
+            fResultZ += TRANSLATION.z;
+        }
+
+        if(USE_PIVOT)
+        {
+            fResultX += PIVOT.x;
+            fResultY += PIVOT.y;
+            fResultZ += PIVOT.z;
+        }
+
+        arX[i] = fResultX;
+        arY[i] = fResultY;
+        arZ[i] = fResultZ;
+    }
+#endif
+}
+
+
 } //namespace Math
 } //namespace Tools
 } //namespace QuimeraEngine
@@ -53,10 +53,15 @@ namespace Containers
 
 pointer_uint_q SQStringHashProvider::GenerateHashKey(const string_q &strInput, const pointer_uint_q uBucketsInTable)
 {
-    // See: http://www.burtleburtle.net/bob/hash/doobs.html
-
     QE_ASSERT_ERROR(uBucketsInTable > 0, "The input number of buckets must be greater than zero.");
 
+    return SQStringHashProvider::GenerateHash(strInput) % uBucketsInTable;
+}
+
+pointer_uint_q SQStringHashProvider::GenerateHash(const string_q &strInput)
+{
+    // See: http://www.burtleburtle.net/bob/hash/doobs.html
+
     pointer_uint_q uHashKey = 0;
 
     const u16_q* arCharacters = strInput.GetInternalBuffer();
@@ -73,7 +78,7 @@ pointer_uint_q SQStringHashProvider::GenerateHashKey(const string_q &strInput, c
     uHashKey ^= (uHashKey >> 11U);
     uHashKey += (uHashKey << 15U);
 
-    return uHashKey % uBucketsInTable;
+    return uHashKey;
 }
 
 
@@ -72,7 +72,7 @@ string_q SQThisThread::ToString()
 #if defined(QE_OS_WINDOWS)
     typedef DWORD IdInteger;
 #elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
-    typedef pid_t IdInteger;
+    typedef pointer_uint_q IdInteger; // The Id is the value of a pthread_t, which has the size of a pointer
 #endif
 
     static const string_q STRING_PART1 = "Thread(";
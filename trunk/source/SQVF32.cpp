@@ -46,59 +46,19 @@ namespace DataTypes
 
 void SQVF32::Pack(const float_q fFirst, const float_q fSecond, const float_q fThird, const float_q fFourth, vf32_q &pack)
 {
-    #define QE_4BYTES_SIZE 4 // We are working with a 32-bits floats pack
-
-    #if QE_FLOAT_SIZE != QE_4BYTES_SIZE
-        // Types are different so we need to use known-size types and then invoke
-        // implicit casting when copying to auxiliar variables.
-        f32_q f_1 = scast_q(fFirst, f32_q);
-        f32_q f_2 = scast_q(fSecond, f32_q);
-        f32_q f_3 = scast_q(fThird, f32_q);
-        f32_q f_4 = scast_q(fFourth, f32_q);
-    #else
-        // Types are the same, no casting is needed so we only use references to maintain names used below
-        const f32_q& f_1 = fFirst;
-        const f32_q& f_2 = fSecond;
-        const f32_q& f_3 = fThird;
-        const f32_q& f_4 = fFourth;
-    #endif
-
-    pack.m128_f32[0] = f_1;
-    pack.m128_f32[1] = f_2;
-    pack.m128_f32[2] = f_3;
-    pack.m128_f32[3] = f_4;
+    // Note: _mm_set_ps receives the components from the highest to the lowest
+    pack = _mm_set_ps(scast_q(fFourth, f32_q), scast_q(fThird, f32_q), scast_q(fSecond, f32_q), scast_q(fFirst, f32_q));
 }
 
 void SQVF32::Unpack(const vf32_q pack, float_q &fFirst, float_q &fSecond, float_q &fThird, float_q &fFourth)
 {
-    #define QE_4BYTES_SIZE 4 // We are working with a 32-bits floats pack
-
-    #if QE_FLOAT_SIZE != QE_4BYTES_SIZE
-        // Types are different so we need to use known-size types and then invoke
-        // implicit casting when copying to auxiliar variables.
-        f32_q f_1 = scast_q(SQFloat::_0, f32_q);
-        f32_q f_2 = scast_q(SQFloat::_0, f32_q);
-        f32_q f_3 = scast_q(SQFloat::_0, f32_q);
-        f32_q f_4 = scast_q(SQFloat::_0, f32_q);
-    #else
-        // Types are the same, no casting is needed so we only use references to maintain names used below
-        f32_q& f_1 = fFirst;
-        f32_q& f_2 = fSecond;
-        f32_q& f_3 = fThird;
-        f32_q& f_4 = fFourth;
-    #endif
-
-    f_1 = pack.m128_f32[0];
-    f_2 = pack.m128_f32[1];
-    f_3 = pack.m128_f32[2];
-    f_4 = pack.m128_f32[3];
+    f32_q arComponents[4];
+    _mm_storeu_ps(arComponents, pack);
 
-    #if QE_FLOAT_SIZE != QE_4BYTES_SIZE
-        fFirst  = scast_q(f_1, float_q);
-        fSecond = scast_q(f_2, float_q);
-        fThird  = scast_q(f_3, float_q);
-        fFourth = scast_q(f_4, float_q);
-    #endif
+    fFirst  = scast_q(arComponents[0], float_q);
+    fSecond = scast_q(arComponents[1], float_q);
+    fThird  = scast_q(arComponents[2], float_q);
+    fFourth = scast_q(arComponents[3], float_q);
 }
 
 
@@ -0,0 +1,123 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QLinearAllocator.h"
+
+using Kinesis::QuimeraEngine::Common::Memory::QLinearAllocator;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Functor measured in the performance tests of QLinearAllocator, which fills a buffer with objects of different sizes and discards all of them at once, as frame allocators do
+class QLinearAllocatorPerformanceTestClass
+{
+public:
+
+    static const unsigned int ALLOCATION_COUNT = 4096U;
+
+    // The sizes of the allocations are repeated cyclically
+    static pointer_uint_q GetAllocationSize(const unsigned int uAllocation)
+    {
+        static const pointer_uint_q SIZES[] = { 16U, 48U, 24U, 96U, 8U, 64U, 32U, 128U };
+        return SIZES[uAllocation % (sizeof(SIZES) / sizeof(SIZES[0]))];
+    }
+
+    static pointer_uint_q GetTotalSize()
+    {
+        pointer_uint_q uTotalSize = 0;
+
+        for(unsigned int i = 0; i < ALLOCATION_COUNT; ++i)
+            uTotalSize += QLinearAllocatorPerformanceTestClass::GetAllocationSize(i);
+
+        return uTotalSize;
+    }
+
+    QLinearAllocatorPerformanceTestClass(QLinearAllocator* pAllocator) : m_pAllocator(pAllocator),
+                                                                         m_uChecksum(0)
+    {
+    }
+
+    // When no allocator is provided, the default heap is used and every block has to be freed separately
+    void operator()()
+    {
+        for(unsigned int i = 0; i < ALLOCATION_COUNT; ++i)
+        {
+            const pointer_uint_q SIZE = QLinearAllocatorPerformanceTestClass::GetAllocationSize(i);
+            m_arBlocks[i] = m_pAllocator == null_q ? operator new(SIZE) : m_pAllocator->Allocate(SIZE);
+            *scast_q(m_arBlocks[i], u32_q*) = i;
+        }
+
+        for(unsigned int i = 0; i < ALLOCATION_COUNT; ++i)
+            m_uChecksum += *scast_q(m_arBlocks[i], u32_q*);
+
+        if(m_pAllocator == null_q)
+        {
+            for(unsigned int i = 0; i < ALLOCATION_COUNT; ++i)
+                operator delete(m_arBlocks[i]);
+        }
+        else
+        {
+            m_pAllocator->Clear();
+        }
+    }
+
+    QLinearAllocator* m_pAllocator;
+    u64_q m_uChecksum;
+    void* m_arBlocks[ALLOCATION_COUNT];
+};
+
+
+QTEST_SUITE_BEGIN( QLinearAllocator_TestSuite )
+
+/// <summary>
+/// Compares the time spent allocating blocks of different sizes and clearing the linear allocator with the time spent using the default heap.
+/// </summary>
+QTEST_CASE ( AllocateAndClear_IsComparedToDefaultHeap_Test )
+{
+    // [Preparation]
+    QLinearAllocator linearAllocator(QLinearAllocatorPerformanceTestClass::GetTotalSize(), QAlignment(4U));
+    QLinearAllocatorPerformanceTestClass linearTest(&linearAllocator);
+    QLinearAllocatorPerformanceTestClass heapTest(null_q);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("QLinearAllocator, 4096 blocks of 8 to 128 bytes", linearTest);
+    QPerformanceMeasurement::Measure("Default heap, 4096 blocks of 8 to 128 bytes", heapTest);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(linearTest.m_uChecksum, heapTest.m_uChecksum);
+    BOOST_CHECK_EQUAL(linearAllocator.GetAllocatedBytes(), 0U);
+}
+
+// End - Test Suite: QLinearAllocator
+QTEST_SUITE_END()
@@ -0,0 +1,134 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QPoolAllocator.h"
+
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Allocates blocks using the default heap, which is what the pool allocator replaces
+class QHeapBlockAllocator
+{
+public:
+
+    QHeapBlockAllocator(const pointer_uint_q uBlockSize) : m_uBlockSize(uBlockSize)
+    {
+    }
+
+    void* Allocate()
+    {
+        return operator new(m_uBlockSize);
+    }
+
+    void Deallocate(const void* pBlock)
+    {
+        operator delete(ccast_q(pBlock, void*));
+    }
+
+private:
+
+    pointer_uint_q m_uBlockSize;
+};
+
+// Functor measured in the performance tests of QPoolAllocator
+template<class AllocatorT>
+class QPoolAllocatorPerformanceTestClass
+{
+public:
+
+    static const unsigned int BLOCK_COUNT = 4096U;
+    static const pointer_uint_q BLOCK_SIZE = 64U;
+
+    QPoolAllocatorPerformanceTestClass(AllocatorT &allocator) : m_allocator(allocator),
+                                                                m_uChecksum(0)
+    {
+    }
+
+    // Allocates all the blocks and then deallocates them in an order different from the allocation order, as the elements of a container do
+    void operator()()
+    {
+        for(unsigned int i = 0; i < BLOCK_COUNT; ++i)
+        {
+            m_arBlocks[i] = m_allocator.Allocate();
+            *scast_q(m_arBlocks[i], u32_q*) = i;
+        }
+
+        for(unsigned int i = 0; i < BLOCK_COUNT; i += 2U)
+        {
+            m_uChecksum += *scast_q(m_arBlocks[i], u32_q*);
+            m_allocator.Deallocate(m_arBlocks[i]);
+        }
+
+        for(unsigned int i = 1U; i < BLOCK_COUNT; i += 2U)
+        {
+            m_uChecksum += *scast_q(m_arBlocks[i], u32_q*);
+            m_allocator.Deallocate(m_arBlocks[i]);
+        }
+    }
+
+    AllocatorT &m_allocator;
+    u64_q m_uChecksum;
+    void* m_arBlocks[BLOCK_COUNT];
+};
+
+
+QTEST_SUITE_BEGIN( QPoolAllocator_TestSuite )
+
+/// <summary>
+/// Compares the time spent allocating and deallocating blocks using the pool allocator with the time spent using the default heap.
+/// </summary>
+QTEST_CASE ( AllocateAndDeallocate_IsComparedToDefaultHeap_Test )
+{
+    typedef QPoolAllocatorPerformanceTestClass<QPoolAllocator> PoolTestType;
+    typedef QPoolAllocatorPerformanceTestClass<QHeapBlockAllocator> HeapTestType;
+
+    // [Preparation]
+    QPoolAllocator poolAllocator(PoolTestType::BLOCK_COUNT * PoolTestType::BLOCK_SIZE, PoolTestType::BLOCK_SIZE, QAlignment(16U));
+    QHeapBlockAllocator heapAllocator(PoolTestType::BLOCK_SIZE);
+    PoolTestType poolTest(poolAllocator);
+    HeapTestType heapTest(heapAllocator);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("QPoolAllocator, 4096 blocks of 64 bytes", poolTest);
+    QPerformanceMeasurement::Measure("Default heap, 4096 blocks of 64 bytes", heapTest);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(poolTest.m_uChecksum, heapTest.m_uChecksum);
+    BOOST_CHECK_EQUAL(poolAllocator.GetAllocatedBytes(), 0U);
+}
+
+// End - Test Suite: QPoolAllocator
+QTEST_SUITE_END()
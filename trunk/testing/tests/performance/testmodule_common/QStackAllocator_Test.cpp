@@ -0,0 +1,121 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QStackAllocator.h"
+
+using Kinesis::QuimeraEngine::Common::Memory::QStackAllocator;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Functor measured in the performance tests of QStackAllocator, which allocates blocks in a scope and releases them in reverse order when leaving it, as temporary buffers of algorithms do
+class QStackAllocatorPerformanceTestClass
+{
+public:
+
+    static const unsigned int DEPTH = 16U;
+    static const unsigned int ROUNDS = 256U;
+    static const pointer_uint_q BLOCK_SIZE = 48U;
+
+    QStackAllocatorPerformanceTestClass(QStackAllocator* pAllocator) : m_pAllocator(pAllocator),
+                                                                       m_uChecksum(0)
+    {
+    }
+
+    // When no allocator is provided, the default heap is used
+    void operator()()
+    {
+        void* arBlocks[DEPTH];
+
+        for(unsigned int uRound = 0; uRound < ROUNDS; ++uRound)
+        {
+            if(m_pAllocator == null_q)
+            {
+                for(unsigned int i = 0; i < DEPTH; ++i)
+                {
+                    arBlocks[i] = operator new(BLOCK_SIZE);
+                    *scast_q(arBlocks[i], u32_q*) = i;
+                }
+
+                for(unsigned int i = DEPTH; i > 0; --i)
+                {
+                    m_uChecksum += *scast_q(arBlocks[i - 1U], u32_q*);
+                    operator delete(arBlocks[i - 1U]);
+                }
+            }
+            else
+            {
+                for(unsigned int i = 0; i < DEPTH; ++i)
+                {
+                    arBlocks[i] = m_pAllocator->Allocate(BLOCK_SIZE);
+                    *scast_q(arBlocks[i], u32_q*) = i;
+                }
+
+                for(unsigned int i = DEPTH; i > 0; --i)
+                {
+                    m_uChecksum += *scast_q(arBlocks[i - 1U], u32_q*);
+                    m_pAllocator->Deallocate();
+                }
+            }
+        }
+    }
+
+    QStackAllocator* m_pAllocator;
+    u64_q m_uChecksum;
+};
+
+
+QTEST_SUITE_BEGIN( QStackAllocator_TestSuite )
+
+/// <summary>
+/// Compares the time spent allocating and deallocating blocks in LIFO order using the stack allocator with the time spent using the default heap.
+/// </summary>
+QTEST_CASE ( AllocateAndDeallocate_IsComparedToDefaultHeap_Test )
+{
+    // [Preparation]
+    QStackAllocator stackAllocator(QStackAllocatorPerformanceTestClass::DEPTH * QStackAllocatorPerformanceTestClass::BLOCK_SIZE * 4U, QAlignment(4U));
+    QStackAllocatorPerformanceTestClass stackTest(&stackAllocator);
+    QStackAllocatorPerformanceTestClass heapTest(null_q);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("QStackAllocator, 256 scopes of 16 blocks of 48 bytes", stackTest);
+    QPerformanceMeasurement::Measure("Default heap, 256 scopes of 16 blocks of 48 bytes", heapTest);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stackTest.m_uChecksum, heapTest.m_uChecksum);
+    BOOST_CHECK_EQUAL(stackAllocator.GetAllocatedBytes(), 0U);
+}
+
+// End - Test Suite: QStackAllocator
+QTEST_SUITE_END()
@@ -0,0 +1,279 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QStringUnicode.h"
+
+#include "QArrayResult.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::QStringUnicode;
+using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+using Kinesis::QuimeraEngine::Common::DataTypes::EQTextEncoding;
+using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::i32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Base class of the functors measured in the performance tests of QStringUnicode, which stores a text that contains non-ASCII characters
+class QStringUnicodePerformanceTestClass
+{
+public:
+
+    static const unsigned int TEXT_REPETITIONS = 100U;
+
+    QStringUnicodePerformanceTestClass() : m_uChecksum(0)
+    {
+        for(unsigned int i = 0; i < TEXT_REPETITIONS; ++i)
+        {
+            m_strText.Append(QStringUnicode("The quick brown fox jumps over the lazy dog, "));
+            m_strText.Append(QStringUnicode(L"\x00C9l vi\x00F1\x00F3 a la ciudad de S\x00E3o Paulo; "));
+            m_strText.Append(i);
+            m_strText.Append(QStringUnicode(". "));
+        }
+    }
+
+    QStringUnicode m_strText;
+    u64_q m_uChecksum;
+};
+
+// Appends integers and small strings to an empty string
+class QStringUnicodeAppendPerformanceTestClass : public QStringUnicodePerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        QStringUnicode strResult;
+
+        for(u32_q i = 0; i < 1000U; ++i)
+        {
+            strResult.Append(i);
+            strResult.Append(", ");
+        }
+
+        m_uChecksum += strResult.GetLength();
+    }
+};
+
+// Searches for a pattern that is at the end of the text
+class QStringUnicodeIndexOfPerformanceTestClass : public QStringUnicodePerformanceTestClass
+{
+public:
+
+    QStringUnicodeIndexOfPerformanceTestClass(const EQComparisonType &eComparisonType) : m_strPattern("PAULO; 99"),
+                                                                                         m_eComparisonType(eComparisonType)
+    {
+    }
+
+    void operator()()
+    {
+        m_uChecksum += m_strText.IndexOf(m_strPattern, m_eComparisonType);
+    }
+
+    QStringUnicode m_strPattern;
+    EQComparisonType m_eComparisonType;
+};
+
+// Encodes the text and decodes the result
+class QStringUnicodeToBytesPerformanceTestClass : public QStringUnicodePerformanceTestClass
+{
+public:
+
+    QStringUnicodeToBytesPerformanceTestClass(const EQTextEncoding &eEncoding) : m_eEncoding(eEncoding)
+    {
+    }
+
+    void operator()()
+    {
+        QArrayResult<i8_q> arBytes = m_strText.ToBytes(m_eEncoding);
+        QStringUnicode strDecoded(arBytes.Get(), scast_q(arBytes.GetSize(), int), m_eEncoding);
+        m_uChecksum += strDecoded.GetLength();
+    }
+
+    EQTextEncoding m_eEncoding;
+};
+
+// Compares the text to a copy whose last character is different
+class QStringUnicodeCompareToPerformanceTestClass : public QStringUnicodePerformanceTestClass
+{
+public:
+
+    QStringUnicodeCompareToPerformanceTestClass(const EQComparisonType &eComparisonType) : m_eComparisonType(eComparisonType)
+    {
+        m_strOther = m_strText.Substring(0, m_strText.GetLength() - 2U);
+        m_strOther.Append("!");
+    }
+
+    void operator()()
+    {
+        if(m_strText.CompareTo(m_strOther, m_eComparisonType) < 0)
+            ++m_uChecksum;
+    }
+
+    QStringUnicode m_strOther;
+    EQComparisonType m_eComparisonType;
+};
+
+// Splits the text into sentences
+class QStringUnicodeSplitPerformanceTestClass : public QStringUnicodePerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        QArrayResult<QStringUnicode> arParts = m_strText.Split(". ");
+        m_uChecksum += arParts.GetCount();
+    }
+};
+
+// Converts integers to strings and parses them
+class QStringUnicodeToIntegerPerformanceTestClass : public QStringUnicodePerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(i32_q i = -500; i < 500; ++i)
+        {
+            QStringUnicode strNumber;
+            strNumber.Append(i * 7919);
+            m_uChecksum += scast_q(strNumber.ToInteger(), u64_q);
+        }
+    }
+};
+
+
+QTEST_SUITE_BEGIN( QStringUnicode_TestSuite )
+
+/// <summary>
+/// Measures the time spent appending integers and strings.
+/// </summary>
+QTEST_CASE ( Append_IsMeasured_Test )
+{
+    // [Preparation]
+    QStringUnicodeAppendPerformanceTestClass test;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Append, 1000 integers and 1000 strings", test);
+
+    // [Verification]
+    BOOST_CHECK(test.m_uChecksum > 0);
+}
+
+/// <summary>
+/// Compares the time spent searching for a pattern using binary and canonical comparisons.
+/// </summary>
+QTEST_CASE ( IndexOf_IsComparedForBinaryAndCanonicalComparisons_Test )
+{
+    // [Preparation]
+    QStringUnicodeIndexOfPerformanceTestClass binaryTest(EQComparisonType::E_BinaryCaseInsensitive);
+    QStringUnicodeIndexOfPerformanceTestClass canonicalTest(EQComparisonType::E_CanonicalCaseInsensitive);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("IndexOf, binary case insensitive", binaryTest);
+    QPerformanceMeasurement::Measure("IndexOf, canonical case insensitive", canonicalTest);
+
+    // [Verification]
+    BOOST_CHECK(binaryTest.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(binaryTest.m_uChecksum, canonicalTest.m_uChecksum);
+}
+
+/// <summary>
+/// Compares the time spent encoding and decoding the text using UTF-8 and UTF-16.
+/// </summary>
+QTEST_CASE ( ToBytes_IsComparedForUTF8AndUTF16_Test )
+{
+    // [Preparation]
+    QStringUnicodeToBytesPerformanceTestClass utf8Test(EQTextEncoding::E_UTF8);
+    QStringUnicodeToBytesPerformanceTestClass utf16Test(EQTextEncoding::E_UTF16LE);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("ToBytes and constructor, UTF-8", utf8Test);
+    QPerformanceMeasurement::Measure("ToBytes and constructor, UTF-16 LE", utf16Test);
+
+    // [Verification]
+    BOOST_CHECK(utf8Test.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(utf8Test.m_uChecksum, utf16Test.m_uChecksum);
+}
+
+/// <summary>
+/// Compares the time spent comparing strings using binary and canonical comparisons.
+/// </summary>
+QTEST_CASE ( CompareTo_IsComparedForBinaryAndCanonicalComparisons_Test )
+{
+    // [Preparation]
+    QStringUnicodeCompareToPerformanceTestClass binaryTest(EQComparisonType::E_BinaryCaseSensitive);
+    QStringUnicodeCompareToPerformanceTestClass canonicalTest(EQComparisonType::E_CanonicalCaseSensitive);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("CompareTo, binary case sensitive", binaryTest);
+    QPerformanceMeasurement::Measure("CompareTo, canonical case sensitive", canonicalTest);
+
+    // [Verification]
+    BOOST_CHECK(binaryTest.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(binaryTest.m_uChecksum, canonicalTest.m_uChecksum);
+}
+
+/// <summary>
+/// Measures the time spent splitting the text into parts.
+/// </summary>
+QTEST_CASE ( Split_IsMeasured_Test )
+{
+    // [Preparation]
+    QStringUnicodeSplitPerformanceTestClass test;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Split, 200 parts", test);
+
+    // [Verification]
+    BOOST_CHECK(test.m_uChecksum > 0);
+}
+
+/// <summary>
+/// Measures the time spent converting integers to strings and parsing them back.
+/// </summary>
+QTEST_CASE ( ToInteger_IsMeasured_Test )
+{
+    // [Preparation]
+    QStringUnicodeToIntegerPerformanceTestClass test;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Append and ToInteger, 1000 integers", test);
+
+    // [Verification]
+    BOOST_CHECK(test.m_uChecksum != 0);
+}
+
+// End - Test Suite: QStringUnicode
+QTEST_SUITE_END()
@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QBinaryStreamWriter.h"
+
+#include "QBinaryStreamReader.h"
+#include "QMemoryStream.h"
+
+using Kinesis::QuimeraEngine::System::IO::QBinaryStreamWriter;
+using Kinesis::QuimeraEngine::System::IO::QBinaryStreamReader;
+using Kinesis::QuimeraEngine::System::IO::QMemoryStream;
+using Kinesis::QuimeraEngine::Common::DataTypes::u16_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::f32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Functor measured in the performance tests of QBinaryStreamWriter, which serializes a set of records and deserializes them, either field by field or as a block of bytes
+class QBinaryStreamWriterPerformanceTestClass
+{
+public:
+
+    struct QRecord
+    {
+        u32_q m_uIdentifier;
+        f32_q m_fValue;
+        u16_q m_uFlags;
+    };
+
+    static const unsigned int RECORD_COUNT = 10000U;
+
+    QBinaryStreamWriterPerformanceTestClass(const bool bWriteBlocks) : m_bWriteBlocks(bWriteBlocks),
+                                                                       m_uChecksum(0)
+    {
+        for(unsigned int i = 0; i < RECORD_COUNT; ++i)
+        {
+            m_arRecords[i].m_uIdentifier = i;
+            m_arRecords[i].m_fValue = scast_q(i, f32_q) * 0.5f;
+            m_arRecords[i].m_uFlags = scast_q(i & 0xFFU, u16_q);
+        }
+    }
+
+    void operator()()
+    {
+        QMemoryStream<> stream(RECORD_COUNT * sizeof(QRecord));
+        QBinaryStreamWriter< QMemoryStream<> > writer(stream);
+
+        if(m_bWriteBlocks)
+        {
+            writer.WriteBytes(m_arRecords, sizeof(m_arRecords));
+        }
+        else
+        {
+            for(unsigned int i = 0; i < RECORD_COUNT; ++i)
+                writer << m_arRecords[i].m_uIdentifier << m_arRecords[i].m_fValue << m_arRecords[i].m_uFlags;
+        }
+
+        stream.SetPosition(0);
+        QBinaryStreamReader< QMemoryStream<> > reader(stream);
+
+        if(m_bWriteBlocks)
+        {
+            reader.ReadBytes(m_arOutput, sizeof(m_arOutput));
+        }
+        else
+        {
+            for(unsigned int i = 0; i < RECORD_COUNT; ++i)
+                reader >> m_arOutput[i].m_uIdentifier >> m_arOutput[i].m_fValue >> m_arOutput[i].m_uFlags;
+        }
+
+        for(unsigned int i = 0; i < RECORD_COUNT; ++i)
+            m_uChecksum += m_arOutput[i].m_uIdentifier + m_arOutput[i].m_uFlags;
+    }
+
+    bool m_bWriteBlocks;
+    u64_q m_uChecksum;
+    QRecord m_arRecords[RECORD_COUNT];
+    QRecord m_arOutput[RECORD_COUNT];
+};
+
+
+QTEST_SUITE_BEGIN( QBinaryStreamWriter_TestSuite )
+
+/// <summary>
+/// Compares the time spent writing and reading records field by field with the time spent doing it as a single block of bytes.
+/// </summary>
+QTEST_CASE ( WriteAndRead_AreComparedForFieldsAndBlocks_Test )
+{
+    typedef QBinaryStreamWriterPerformanceTestClass TestType;
+
+    // [Preparation]
+    TestType* pFieldsTest = new TestType(false);
+    TestType* pBlocksTest = new TestType(true);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("QBinaryStreamWriter and QBinaryStreamReader, 10000 records, field by field", *pFieldsTest);
+    QPerformanceMeasurement::Measure("QBinaryStreamWriter and QBinaryStreamReader, 10000 records, one block", *pBlocksTest);
+
+    // [Verification]
+    BOOST_CHECK(pFieldsTest->m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(pFieldsTest->m_uChecksum, pBlocksTest->m_uChecksum);
+
+    // [Cleaning]
+    delete pFieldsTest;
+    delete pBlocksTest;
+}
+
+// End - Test Suite: QBinaryStreamWriter
+QTEST_SUITE_END()
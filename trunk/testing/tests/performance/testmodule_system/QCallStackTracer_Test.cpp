@@ -0,0 +1,236 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include <sstream>
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QCallStackTracer.h"
+
+#include "QCallStackTrace.h"
+#include "QCallTrace.h"
+#include "QArgumentTrace.h"
+#include "QDictionary.h"
+#include "QSharedMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "QThread.h"
+#include "SQThisThread.h"
+
+using Kinesis::QuimeraEngine::System::Diagnosis::QCallStackTracer;
+using Kinesis::QuimeraEngine::System::Diagnosis::QCallStackTrace;
+using Kinesis::QuimeraEngine::System::Diagnosis::QCallTrace;
+using Kinesis::QuimeraEngine::System::Diagnosis::QArgumentTrace;
+using Kinesis::QuimeraEngine::System::Threading::QSharedMutex;
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::System::Threading::SQThisThread;
+using Kinesis::QuimeraEngine::Tools::Containers::QDictionary;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Stores the call stack traces as QCallStackTracer did before they were stored per thread: in a dictionary indexed by thread
+// Id that is protected by a mutex
+class QLockedCallStackTracer
+{
+public:
+
+    typedef QDictionary<QThread::Id, QCallStackTrace*> CallStackTraceContainer;
+
+    void AddTrace(const QCallTrace &trace)
+    {
+        QThread::Id threadId = SQThisThread::GetId();
+        QScopedExclusiveLock<QSharedMutex> exclusiveLock(m_callStackTracesMutex);
+
+        CallStackTraceContainer::ConstIterator itCallStackTrace = m_callStackTraces.PositionOfKey(threadId);
+
+        if(itCallStackTrace.IsEnd())
+            itCallStackTrace = m_callStackTraces.Add(threadId, new QCallStackTrace(SQThisThread::ToString()));
+
+        itCallStackTrace->GetValue()->Push(trace);
+    }
+
+    void RemoveLastTrace()
+    {
+        QThread::Id threadId = SQThisThread::GetId();
+        QScopedExclusiveLock<QSharedMutex> exclusiveLock(m_callStackTracesMutex);
+
+        CallStackTraceContainer::ConstIterator itCallStackTrace = m_callStackTraces.PositionOfKey(threadId);
+        itCallStackTrace->GetValue()->Pop();
+
+        if(itCallStackTrace->GetValue()->GetCount() == 0)
+        {
+            delete itCallStackTrace->GetValue();
+            m_callStackTraces.Remove(itCallStackTrace);
+        }
+    }
+
+private:
+
+    CallStackTraceContainer m_callStackTraces;
+    QSharedMutex m_callStackTracesMutex;
+};
+
+// Class whose method is executed by every thread in the performance tests of QCallStackTracer
+template<class TracerT>
+class QCallStackTracerPerformanceTestClass
+{
+public:
+
+    static const unsigned int CALL_DEPTH = 8U;
+    static const unsigned int ITERATIONS = 5000U;
+
+    TracerT* m_pTracer;
+
+    QCallStackTracerPerformanceTestClass() : m_pTracer(null_q)
+    {
+    }
+
+    // Simulates traced functions that call other traced functions
+    void TraceCalls()
+    {
+        int nArgument = 5;
+        QArgumentTrace arArgumentTraces[] = { QArgumentTrace(nArgument) };
+        QCallTrace trace("void function(int i)", arArgumentTraces, 1U);
+
+        for(unsigned int uIteration = 0; uIteration < ITERATIONS; ++uIteration)
+        {
+            for(unsigned int i = 0; i < CALL_DEPTH; ++i)
+                m_pTracer->AddTrace(trace);
+
+            for(unsigned int i = 0; i < CALL_DEPTH; ++i)
+                m_pTracer->RemoveLastTrace();
+        }
+    }
+
+};
+
+// Functor measured in the performance tests of QCallStackTracer, which makes a number of threads trace calls at the same time
+template<class TracerT>
+class QCallStackTracerPerformanceTestRun
+{
+public:
+
+    typedef QCallStackTracerPerformanceTestClass<TracerT> ThreadTestType;
+
+    QCallStackTracerPerformanceTestRun(TracerT &tracer, const unsigned int uThreads) : m_tracer(tracer),
+                                                                                      m_uThreads(uThreads),
+                                                                                      m_uTracedCalls(0)
+    {
+    }
+
+    void operator()()
+    {
+        ThreadTestType* arTests = new ThreadTestType[m_uThreads];
+        QThread** arThreads = new QThread*[m_uThreads];
+
+        for(unsigned int i = 0; i < m_uThreads; ++i)
+        {
+            arTests[i].m_pTracer = &m_tracer;
+            arThreads[i] = new QThread(QDelegate<void ()>(&arTests[i], &ThreadTestType::TraceCalls));
+        }
+
+        for(unsigned int i = 0; i < m_uThreads; ++i)
+            arThreads[i]->Join();
+
+        for(unsigned int i = 0; i < m_uThreads; ++i)
+            delete arThreads[i];
+
+        delete[] arThreads;
+        delete[] arTests;
+
+        m_uTracedCalls += scast_q(m_uThreads, u64_q) * ThreadTestType::ITERATIONS * ThreadTestType::CALL_DEPTH;
+    }
+
+    TracerT &m_tracer;
+    unsigned int m_uThreads;
+    u64_q m_uTracedCalls;
+};
+
+// Measures both tracers with the same number of threads
+void QCallStackTracerPerformanceTest_Compare(const unsigned int uThreads)
+{
+    typedef QCallStackTracerPerformanceTestClass<QLockedCallStackTracer> LockedTestType;
+
+    // [Preparation]
+    QLockedCallStackTracer lockedTracer;
+    QCallStackTracerPerformanceTestRun<QLockedCallStackTracer> lockedTest(lockedTracer, uThreads);
+    QCallStackTracerPerformanceTestRun<QCallStackTracer> threadLocalTest(*QCallStackTracer::Get(), uThreads);
+    std::ostringstream callsDescription;
+    callsDescription << ", " << uThreads << " threads, " << LockedTestType::ITERATIONS << " times " << LockedTestType::CALL_DEPTH << " nested calls";
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Dictionary protected by a mutex" + callsDescription.str(), lockedTest);
+    QPerformanceMeasurement::Measure("QCallStackTracer" + callsDescription.str(), threadLocalTest);
+
+    // [Verification]
+    BOOST_CHECK(threadLocalTest.m_uTracedCalls > 0);
+    BOOST_CHECK_EQUAL(lockedTest.m_uTracedCalls, threadLocalTest.m_uTracedCalls);
+}
+
+
+
+QTEST_SUITE_BEGIN( QCallStackTracer_TestSuite )
+
+/// <summary>
+/// Compares the time spent adding and removing traces by 1 thread with the time spent when traces were stored in a dictionary protected by a mutex.
+/// </summary>
+QTEST_CASE ( AddTrace_IsComparedToDictionaryWithMutexWhenUsedBy1Thread_Test )
+{
+    QCallStackTracerPerformanceTest_Compare(1U);
+}
+
+/// <summary>
+/// Compares the time spent adding and removing traces by 2 threads with the time spent when traces were stored in a dictionary protected by a mutex.
+/// </summary>
+QTEST_CASE ( AddTrace_IsComparedToDictionaryWithMutexWhenUsedBy2Threads_Test )
+{
+    QCallStackTracerPerformanceTest_Compare(2U);
+}
+
+/// <summary>
+/// Compares the time spent adding and removing traces by 4 threads with the time spent when traces were stored in a dictionary protected by a mutex.
+/// </summary>
+QTEST_CASE ( AddTrace_IsComparedToDictionaryWithMutexWhenUsedBy4Threads_Test )
+{
+    QCallStackTracerPerformanceTest_Compare(4U);
+}
+
+/// <summary>
+/// Compares the time spent adding and removing traces by 8 threads with the time spent when traces were stored in a dictionary protected by a mutex.
+/// </summary>
+QTEST_CASE ( AddTrace_IsComparedToDictionaryWithMutexWhenUsedBy8Threads_Test )
+{
+    QCallStackTracerPerformanceTest_Compare(8U);
+}
+
+// End - Test Suite: QCallStackTracer
+QTEST_SUITE_END()
@@ -0,0 +1,244 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include <sstream>
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QLockFreePoolAllocator.h"
+
+#include "QThreadLocalPoolAllocator.h"
+#include "QPoolAllocator.h"
+#include "QMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "QThread.h"
+
+using Kinesis::QuimeraEngine::System::Threading::QLockFreePoolAllocator;
+using Kinesis::QuimeraEngine::System::Threading::QThreadLocalPoolAllocator;
+using Kinesis::QuimeraEngine::System::Threading::QMutex;
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Wraps a QPoolAllocator whose methods are protected by a mutex, which is how it had to be shared among threads
+class QLockedPoolAllocator
+{
+public:
+
+    QLockedPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment) : m_allocator(uSize, uBlockSize, alignment)
+    {
+    }
+
+    void* Allocate()
+    {
+        QScopedExclusiveLock<QMutex> lock(m_mutex);
+        return m_allocator.Allocate();
+    }
+
+    void Deallocate(const void* pBlock)
+    {
+        QScopedExclusiveLock<QMutex> lock(m_mutex);
+        m_allocator.Deallocate(pBlock);
+    }
+
+private:
+
+    QPoolAllocator m_allocator;
+    QMutex m_mutex;
+};
+
+// Class whose method is executed by every thread in the performance tests of QLockFreePoolAllocator
+template<class AllocatorT>
+class QLockFreePoolAllocatorPerformanceTestClass
+{
+public:
+
+    static const unsigned int BLOCKS_PER_BURST = 32U;
+    static const unsigned int BURSTS = 2000U;
+    static const pointer_uint_q BLOCK_SIZE = 32U;
+
+    AllocatorT* m_pAllocator;
+    unsigned int m_uFailedAllocations;
+
+    QLockFreePoolAllocatorPerformanceTestClass() : m_pAllocator(null_q),
+                                                   m_uFailedAllocations(0)
+    {
+    }
+
+    // Allocates and deallocates blocks in bursts, as a container that is filled and emptied does
+    void AllocateAndDeallocate()
+    {
+        void* arBlocks[BLOCKS_PER_BURST];
+
+        for(unsigned int uBurst = 0; uBurst < BURSTS; ++uBurst)
+        {
+            for(unsigned int i = 0; i < BLOCKS_PER_BURST; ++i)
+            {
+                arBlocks[i] = m_pAllocator->Allocate();
+
+                if(arBlocks[i] == null_q)
+                    ++m_uFailedAllocations;
+                else
+                    *scast_q(arBlocks[i], u32_q*) = i;
+            }
+
+            for(unsigned int i = 0; i < BLOCKS_PER_BURST; ++i)
+                if(arBlocks[i] != null_q)
+                    m_pAllocator->Deallocate(arBlocks[i]);
+        }
+    }
+
+};
+
+// Functor measured in the performance tests of QLockFreePoolAllocator, which makes a number of threads allocate and deallocate blocks at the same time
+template<class AllocatorT>
+class QLockFreePoolAllocatorPerformanceTestRun
+{
+public:
+
+    typedef QLockFreePoolAllocatorPerformanceTestClass<AllocatorT> ThreadTestType;
+
+    QLockFreePoolAllocatorPerformanceTestRun(AllocatorT &allocator, const unsigned int uThreads) : m_allocator(allocator),
+                                                                                                  m_uThreads(uThreads),
+                                                                                                  m_uFailedAllocations(0)
+    {
+    }
+
+    void operator()()
+    {
+        ThreadTestType* arTests = new ThreadTestType[m_uThreads];
+        QThread** arThreads = new QThread*[m_uThreads];
+
+        for(unsigned int i = 0; i < m_uThreads; ++i)
+        {
+            arTests[i].m_pAllocator = &m_allocator;
+            arThreads[i] = new QThread(QDelegate<void ()>(&arTests[i], &ThreadTestType::AllocateAndDeallocate));
+        }
+
+        for(unsigned int i = 0; i < m_uThreads; ++i)
+            arThreads[i]->Join();
+
+        for(unsigned int i = 0; i < m_uThreads; ++i)
+        {
+            m_uFailedAllocations += arTests[i].m_uFailedAllocations;
+            delete arThreads[i];
+        }
+
+        delete[] arThreads;
+        delete[] arTests;
+    }
+
+    AllocatorT &m_allocator;
+    unsigned int m_uThreads;
+    unsigned int m_uFailedAllocations;
+};
+
+// Measures the three allocators with the same number of threads
+void QLockFreePoolAllocatorPerformanceTest_Compare(const unsigned int uThreads)
+{
+    typedef QLockFreePoolAllocatorPerformanceTestClass<QLockedPoolAllocator> LockedTestType;
+
+    // [Preparation]
+    const unsigned int CACHE_CAPACITY = 64U;
+    const pointer_uint_q POOL_SIZE = uThreads * (LockedTestType::BLOCKS_PER_BURST + CACHE_CAPACITY) * LockedTestType::BLOCK_SIZE;
+    QLockedPoolAllocator lockedAllocator(POOL_SIZE, LockedTestType::BLOCK_SIZE, QAlignment(16U));
+    QLockFreePoolAllocator lockFreeAllocator(POOL_SIZE, LockedTestType::BLOCK_SIZE, QAlignment(16U));
+    QLockFreePoolAllocator sharedPool(POOL_SIZE, LockedTestType::BLOCK_SIZE, QAlignment(16U));
+    QThreadLocalPoolAllocator threadLocalAllocator(sharedPool, CACHE_CAPACITY);
+    QLockFreePoolAllocatorPerformanceTestRun<QLockedPoolAllocator> lockedTest(lockedAllocator, uThreads);
+    QLockFreePoolAllocatorPerformanceTestRun<QLockFreePoolAllocator> lockFreeTest(lockFreeAllocator, uThreads);
+    QLockFreePoolAllocatorPerformanceTestRun<QThreadLocalPoolAllocator> threadLocalTest(threadLocalAllocator, uThreads);
+    std::ostringstream burstsDescription;
+    burstsDescription << ", " << uThreads << " threads, " << LockedTestType::BURSTS << " bursts of " << LockedTestType::BLOCKS_PER_BURST << " blocks";
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("QPoolAllocator with mutex" + burstsDescription.str(), lockedTest);
+    QPerformanceMeasurement::Measure("QLockFreePoolAllocator" + burstsDescription.str(), lockFreeTest);
+    QPerformanceMeasurement::Measure("QThreadLocalPoolAllocator" + burstsDescription.str(), threadLocalTest);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(lockedTest.m_uFailedAllocations, 0U);
+    BOOST_CHECK_EQUAL(lockFreeTest.m_uFailedAllocations, 0U);
+    BOOST_CHECK_EQUAL(threadLocalTest.m_uFailedAllocations, 0U);
+    BOOST_CHECK_EQUAL(lockFreeAllocator.GetAllocatedBytes(), 0U);
+    BOOST_CHECK_EQUAL(sharedPool.GetAllocatedBytes(), 0U);
+}
+
+
+
+QTEST_SUITE_BEGIN( QLockFreePoolAllocator_TestSuite )
+
+/// <summary>
+/// Compares the time spent allocating and deallocating blocks by 1 thread using the lock-free allocators with the time spent using a pool protected by a mutex.
+/// </summary>
+QTEST_CASE ( Allocate_IsComparedToPoolWithMutexWhenUsedBy1Thread_Test )
+{
+    QLockFreePoolAllocatorPerformanceTest_Compare(1U);
+}
+
+/// <summary>
+/// Compares the time spent allocating and deallocating blocks by 2 threads using the lock-free allocators with the time spent using a pool protected by a mutex.
+/// </summary>
+QTEST_CASE ( Allocate_IsComparedToPoolWithMutexWhenUsedBy2Threads_Test )
+{
+    QLockFreePoolAllocatorPerformanceTest_Compare(2U);
+}
+
+/// <summary>
+/// Compares the time spent allocating and deallocating blocks by 4 threads using the lock-free allocators with the time spent using a pool protected by a mutex.
+/// </summary>
+QTEST_CASE ( Allocate_IsComparedToPoolWithMutexWhenUsedBy4Threads_Test )
+{
+    QLockFreePoolAllocatorPerformanceTest_Compare(4U);
+}
+
+/// <summary>
+/// Compares the time spent allocating and deallocating blocks by 8 threads using the lock-free allocators with the time spent using a pool protected by a mutex.
+/// </summary>
+QTEST_CASE ( Allocate_IsComparedToPoolWithMutexWhenUsedBy8Threads_Test )
+{
+    QLockFreePoolAllocatorPerformanceTest_Compare(8U);
+}
+
+/// <summary>
+/// Compares the time spent allocating and deallocating blocks by 16 threads using the lock-free allocators with the time spent using a pool protected by a mutex.
+/// </summary>
+QTEST_CASE ( Allocate_IsComparedToPoolWithMutexWhenUsedBy16Threads_Test )
+{
+    QLockFreePoolAllocatorPerformanceTest_Compare(16U);
+}
+
+// End - Test Suite: QLockFreePoolAllocator
+QTEST_SUITE_END()
@@ -0,0 +1,129 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QMemoryStream.h"
+
+#include "QMemoryStreamView.h"
+
+using Kinesis::QuimeraEngine::System::IO::QMemoryStream;
+using Kinesis::QuimeraEngine::System::IO::QMemoryStreamView;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Functor measured in the performance tests of QMemoryStream, which writes a buffer in small chunks to a stream and reads it back
+template<class StreamT>
+class QMemoryStreamPerformanceTestClass
+{
+public:
+
+    static const pointer_uint_q DATA_SIZE = 65536U;
+    static const pointer_uint_q CHUNK_SIZE = 64U;
+
+    QMemoryStreamPerformanceTestClass(const pointer_uint_q uInitialCapacity) : m_uInitialCapacity(uInitialCapacity),
+                                                                               m_uChecksum(0)
+    {
+        for(pointer_uint_q i = 0; i < DATA_SIZE; ++i)
+            m_arData[i] = scast_q(i * 31U, u8_q);
+    }
+
+    void operator()()
+    {
+        StreamT stream = this->CreateStream();
+
+        for(pointer_uint_q uOffset = 0; uOffset < DATA_SIZE; uOffset += CHUNK_SIZE)
+            stream.Write(m_arData, uOffset, CHUNK_SIZE);
+
+        stream.SetPosition(0);
+
+        for(pointer_uint_q uOffset = 0; uOffset < DATA_SIZE; uOffset += CHUNK_SIZE)
+            stream.Read(m_arOutput, uOffset, CHUNK_SIZE);
+
+        m_uChecksum += m_arOutput[DATA_SIZE - 1U] + stream.GetLength();
+    }
+
+    StreamT CreateStream();
+
+    pointer_uint_q m_uInitialCapacity;
+    u64_q m_uChecksum;
+    u8_q m_arData[DATA_SIZE];
+    u8_q m_arOutput[DATA_SIZE];
+    u8_q m_arViewBuffer[DATA_SIZE];
+};
+
+template<>
+QMemoryStream<> QMemoryStreamPerformanceTestClass< QMemoryStream<> >::CreateStream()
+{
+    return QMemoryStream<>(m_uInitialCapacity);
+}
+
+template<>
+QMemoryStreamView QMemoryStreamPerformanceTestClass<QMemoryStreamView>::CreateStream()
+{
+    return QMemoryStreamView(m_arViewBuffer, DATA_SIZE, 0);
+}
+
+
+QTEST_SUITE_BEGIN( QMemoryStream_TestSuite )
+
+/// <summary>
+/// Compares the time spent writing and reading chunks when the stream grows, when its capacity is enough and when it is a view of an external buffer.
+/// </summary>
+QTEST_CASE ( WriteAndRead_AreComparedForGrowingPreallocatedAndViewStreams_Test )
+{
+    typedef QMemoryStreamPerformanceTestClass< QMemoryStream<> > StreamTestType;
+    typedef QMemoryStreamPerformanceTestClass<QMemoryStreamView> ViewTestType;
+
+    // [Preparation]
+    StreamTestType* pGrowingTest = new StreamTestType(256U);
+    StreamTestType* pPreallocatedTest = new StreamTestType(StreamTestType::DATA_SIZE);
+    ViewTestType* pViewTest = new ViewTestType(ViewTestType::DATA_SIZE);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("QMemoryStream, 64 KB in chunks of 64 bytes, growing from 256 bytes", *pGrowingTest);
+    QPerformanceMeasurement::Measure("QMemoryStream, 64 KB in chunks of 64 bytes, preallocated", *pPreallocatedTest);
+    QPerformanceMeasurement::Measure("QMemoryStreamView, 64 KB in chunks of 64 bytes", *pViewTest);
+
+    // [Verification]
+    BOOST_CHECK(pGrowingTest->m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(pGrowingTest->m_uChecksum, pPreallocatedTest->m_uChecksum);
+    BOOST_CHECK_EQUAL(pGrowingTest->m_uChecksum, pViewTest->m_uChecksum);
+
+    // [Cleaning]
+    delete pGrowingTest;
+    delete pPreallocatedTest;
+    delete pViewTest;
+}
+
+// End - Test Suite: QMemoryStream
+QTEST_SUITE_END()
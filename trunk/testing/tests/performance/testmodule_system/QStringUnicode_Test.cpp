@@ -0,0 +1,214 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include <sstream>
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QStringUnicode.h"
+
+#include "QArrayResult.h"
+#include "QMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "QThread.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::QStringUnicode;
+using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+using Kinesis::QuimeraEngine::Common::DataTypes::EQTextEncoding;
+using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+using Kinesis::QuimeraEngine::System::Threading::QMutex;
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Class whose method is executed by every thread in the performance tests of QStringUnicode; it encodes and compares strings, 
+// which use the ICU converters and collators of the calling thread
+class QStringUnicodePerformanceTestClass
+{
+public:
+
+    static const unsigned int ITERATIONS = 10000U;
+
+    // When not null, every operation is protected by this mutex, as it was necessary when the ICU objects were shared by all the threads
+    QMutex* m_pMutex;
+
+    // The sum of the number of bytes obtained by every encoding
+    unsigned int m_uEncodedBytes;
+
+    // The number of comparisons that found both strings equal
+    unsigned int m_uEqualComparisons;
+
+    QStringUnicodePerformanceTestClass() : m_pMutex(null_q),
+                                           m_uEncodedBytes(0),
+                                           m_uEqualComparisons(0)
+    {
+    }
+
+    // Encodes a string in UTF8 and compares it to another string using a canonical comparison, repeatedly
+    void EncodeAndCompare()
+    {
+        const QStringUnicode STRING1("The quick brown fox jumps over the lazy dog");
+        const QStringUnicode STRING2("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG");
+
+        for(unsigned int i = 0; i < ITERATIONS; ++i)
+        {
+            if(m_pMutex != null_q)
+            {
+                QScopedExclusiveLock<QMutex> lock(*m_pMutex);
+                this->EncodeAndCompare(STRING1, STRING2);
+            }
+            else
+            {
+                this->EncodeAndCompare(STRING1, STRING2);
+            }
+        }
+    }
+
+private:
+
+    // Encodes the first string in UTF8 and compares it to the second one, keeping the results
+    void EncodeAndCompare(const QStringUnicode &strString1, const QStringUnicode &strString2)
+    {
+        QArrayResult<i8_q> arBytes = strString1.ToBytes(EQTextEncoding::E_UTF8);
+        m_uEncodedBytes += scast_q(arBytes.GetCount(), unsigned int);
+
+        if(strString1.CompareTo(strString2, EQComparisonType::E_CanonicalCaseInsensitive) == 0)
+            ++m_uEqualComparisons;
+    }
+};
+
+// Functor measured in the performance tests of QStringUnicode, which makes a number of threads encode and compare strings at the same time
+class QStringUnicodePerformanceTestRun
+{
+public:
+
+    QStringUnicodePerformanceTestRun(QMutex* pMutex, const unsigned int uThreads) : m_pMutex(pMutex),
+                                                                                    m_uThreads(uThreads),
+                                                                                    m_uComparisons(0),
+                                                                                    m_uEncodedBytes(0),
+                                                                                    m_uEqualComparisons(0)
+    {
+    }
+
+    void operator()()
+    {
+        QStringUnicodePerformanceTestClass* arTests = new QStringUnicodePerformanceTestClass[m_uThreads];
+        QThread** arThreads = new QThread*[m_uThreads];
+
+        for(unsigned int i = 0; i < m_uThreads; ++i)
+        {
+            arTests[i].m_pMutex = m_pMutex;
+            arThreads[i] = new QThread(QDelegate<void ()>(&arTests[i], &QStringUnicodePerformanceTestClass::EncodeAndCompare));
+        }
+
+        for(unsigned int i = 0; i < m_uThreads; ++i)
+            arThreads[i]->Join();
+
+        for(unsigned int i = 0; i < m_uThreads; ++i)
+        {
+            m_uComparisons += QStringUnicodePerformanceTestClass::ITERATIONS;
+            m_uEncodedBytes += arTests[i].m_uEncodedBytes;
+            m_uEqualComparisons += arTests[i].m_uEqualComparisons;
+            delete arThreads[i];
+        }
+
+        delete[] arThreads;
+        delete[] arTests;
+    }
+
+    QMutex* m_pMutex;
+    unsigned int m_uThreads;
+    unsigned int m_uComparisons;
+    unsigned int m_uEncodedBytes;
+    unsigned int m_uEqualComparisons;
+};
+
+// Measures both approaches with the same number of threads
+void QStringUnicodePerformanceTest_Compare(const unsigned int uThreads)
+{
+    // [Preparation]
+    QMutex mutex;
+    QStringUnicodePerformanceTestRun lockedTest(&mutex, uThreads);
+    QStringUnicodePerformanceTestRun perThreadTest(null_q, uThreads);
+    std::ostringstream operationsDescription;
+    operationsDescription << ", " << uThreads << " threads, " << QStringUnicodePerformanceTestClass::ITERATIONS << " ToBytes + CompareTo per thread";
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("ICU objects protected by a mutex" + operationsDescription.str(), lockedTest);
+    QPerformanceMeasurement::Measure("ICU objects per thread" + operationsDescription.str(), perThreadTest);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(perThreadTest.m_uEncodedBytes, lockedTest.m_uEncodedBytes);
+    BOOST_CHECK_EQUAL(perThreadTest.m_uEqualComparisons, lockedTest.m_uEqualComparisons);
+    BOOST_CHECK_EQUAL(perThreadTest.m_uEqualComparisons, perThreadTest.m_uComparisons);
+    BOOST_CHECK_EQUAL(lockedTest.m_uEqualComparisons, lockedTest.m_uComparisons);
+}
+
+
+
+QTEST_SUITE_BEGIN( QStringUnicode_TestSuite )
+
+/// <summary>
+/// Compares the time spent encoding and comparing strings by 1 thread with the time spent when every operation is protected by a mutex.
+/// </summary>
+QTEST_CASE ( ToBytesAndCompareTo_IsComparedToUsingMutexWhenUsedBy1Thread_Test )
+{
+    QStringUnicodePerformanceTest_Compare(1U);
+}
+
+/// <summary>
+/// Compares the time spent encoding and comparing strings by 2 threads with the time spent when every operation is protected by a mutex.
+/// </summary>
+QTEST_CASE ( ToBytesAndCompareTo_IsComparedToUsingMutexWhenUsedBy2Threads_Test )
+{
+    QStringUnicodePerformanceTest_Compare(2U);
+}
+
+/// <summary>
+/// Compares the time spent encoding and comparing strings by 4 threads with the time spent when every operation is protected by a mutex.
+/// </summary>
+QTEST_CASE ( ToBytesAndCompareTo_IsComparedToUsingMutexWhenUsedBy4Threads_Test )
+{
+    QStringUnicodePerformanceTest_Compare(4U);
+}
+
+/// <summary>
+/// Compares the time spent encoding and comparing strings by 8 threads with the time spent when every operation is protected by a mutex.
+/// </summary>
+QTEST_CASE ( ToBytesAndCompareTo_IsComparedToUsingMutexWhenUsedBy8Threads_Test )
+{
+    QStringUnicodePerformanceTest_Compare(8U);
+}
+
+// End - Test Suite: QStringUnicode
+QTEST_SUITE_END()
@@ -0,0 +1,305 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QTaskScheduler.h"
+
+#include "QThread.h"
+
+using Kinesis::QuimeraEngine::System::Threading::QTaskScheduler;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Class whose methods are used as tasks in the performance tests of QTaskScheduler
+class QTaskSchedulerPerformanceTestClass
+{
+public:
+
+    static const unsigned int ITERATIONS_PER_TASK = 1000U;
+
+    u32_q m_uResult;
+
+    QTaskSchedulerPerformanceTestClass() : m_uResult(0)
+    {
+    }
+
+    // A small amount of work, similar to the jobs that used to be executed in their own thread
+    void Work()
+    {
+        u32_q uValue = m_uResult;
+
+        for(unsigned int i = 0; i < ITERATIONS_PER_TASK; ++i)
+            uValue = uValue * 1664525U + 1013904223U;
+
+        m_uResult = uValue;
+    }
+};
+
+// Class whose method is used as the body of parallel loops in the performance tests of QTaskScheduler
+class QTaskSchedulerPerformanceTestLoop
+{
+public:
+
+    static const unsigned int ITERATIONS = 16U;
+
+    QTaskSchedulerPerformanceTestClass m_arTasks[ITERATIONS];
+
+    // Every iteration executes one task
+    void Execute(const unsigned int uFirst, const unsigned int uLast)
+    {
+        for(unsigned int i = uFirst; i < uLast; ++i)
+            m_arTasks[i].Work();
+    }
+};
+
+// Functor measured in the performance tests of QTaskScheduler, which executes every task in its own thread, creating the threads in batches
+class QTaskSchedulerPerformanceTestThreads
+{
+public:
+
+    QTaskSchedulerPerformanceTestThreads(QTaskSchedulerPerformanceTestClass* arTasks, const unsigned int uTasks, const unsigned int uThreadsPerBatch, const unsigned int uRounds) : 
+                                                                                                                    m_arTasks(arTasks),
+                                                                                                                    m_uTasks(uTasks),
+                                                                                                                    m_uThreadsPerBatch(uThreadsPerBatch),
+                                                                                                                    m_uRounds(uRounds)
+    {
+    }
+
+    void operator()()
+    {
+        QThread** arThreads = new QThread*[m_uThreadsPerBatch];
+
+        for(unsigned int uRound = 0; uRound < m_uRounds; ++uRound)
+        {
+            for(unsigned int uFirstTask = 0; uFirstTask < m_uTasks; uFirstTask += m_uThreadsPerBatch)
+            {
+                unsigned int uThreads = 0;
+
+                for(; uThreads < m_uThreadsPerBatch && uFirstTask + uThreads < m_uTasks; ++uThreads)
+                    arThreads[uThreads] = new QThread(QDelegate<void ()>(&m_arTasks[uFirstTask + uThreads], &QTaskSchedulerPerformanceTestClass::Work));
+
+                for(unsigned int i = 0; i < uThreads; ++i)
+                {
+                    arThreads[i]->Join();
+                    delete arThreads[i];
+                }
+            }
+        }
+
+        delete[] arThreads;
+    }
+
+    QTaskSchedulerPerformanceTestClass* m_arTasks;
+    unsigned int m_uTasks;
+    unsigned int m_uThreadsPerBatch;
+    unsigned int m_uRounds;
+};
+
+// Functor measured in the performance tests of QTaskScheduler, which executes independent tasks in the scheduler
+class QTaskSchedulerPerformanceTestRun
+{
+public:
+
+    QTaskSchedulerPerformanceTestRun(QTaskScheduler &scheduler, QTaskSchedulerPerformanceTestClass* arTasks, const unsigned int uTasks) : 
+                                                                                                                    m_scheduler(scheduler),
+                                                                                                                    m_arTasks(arTasks),
+                                                                                                                    m_uTasks(uTasks)
+    {
+    }
+
+    void operator()()
+    {
+        QTaskScheduler::QTaskGroup group;
+
+        for(unsigned int i = 0; i < m_uTasks; ++i)
+            m_scheduler.Run(QDelegate<void ()>(&m_arTasks[i], &QTaskSchedulerPerformanceTestClass::Work), group);
+
+        m_scheduler.Wait(group);
+    }
+
+    QTaskScheduler &m_scheduler;
+    QTaskSchedulerPerformanceTestClass* m_arTasks;
+    unsigned int m_uTasks;
+};
+
+// Functor measured in the performance tests of QTaskScheduler, which executes in the scheduler a chain of tasks where every task is the continuation of the previous one
+class QTaskSchedulerPerformanceTestContinuations
+{
+public:
+
+    QTaskSchedulerPerformanceTestContinuations(QTaskScheduler &scheduler, QTaskSchedulerPerformanceTestClass* arTasks, const unsigned int uTasks) : 
+                                                                                                                    m_scheduler(scheduler),
+                                                                                                                    m_arTasks(arTasks),
+                                                                                                                    m_uTasks(uTasks)
+    {
+    }
+
+    void operator()()
+    {
+        QTaskScheduler::QTaskGroup group;
+        QTaskScheduler::QTask** arTasks = new QTaskScheduler::QTask*[m_uTasks];
+
+        for(unsigned int i = 0; i < m_uTasks; ++i)
+            arTasks[i] = m_scheduler.CreateTask(QDelegate<void ()>(&m_arTasks[i], &QTaskSchedulerPerformanceTestClass::Work), group);
+
+        for(unsigned int i = 1U; i < m_uTasks; ++i)
+            m_scheduler.AddContinuation(arTasks[i - 1U], arTasks[i]);
+
+        for(unsigned int i = m_uTasks; i > 0; --i)
+            m_scheduler.Submit(arTasks[i - 1U]);
+
+        m_scheduler.Wait(group);
+
+        delete[] arTasks;
+    }
+
+    QTaskScheduler &m_scheduler;
+    QTaskSchedulerPerformanceTestClass* m_arTasks;
+    unsigned int m_uTasks;
+};
+
+// Functor measured in the performance tests of QTaskScheduler, which executes a parallel loop in the scheduler several times
+class QTaskSchedulerPerformanceTestParallelFor
+{
+public:
+
+    QTaskSchedulerPerformanceTestParallelFor(QTaskScheduler &scheduler, QTaskSchedulerPerformanceTestLoop &body, const unsigned int uLoops) : 
+                                                                                                                    m_scheduler(scheduler),
+                                                                                                                    m_body(body),
+                                                                                                                    m_uLoops(uLoops)
+    {
+    }
+
+    void operator()()
+    {
+        for(unsigned int uLoop = 0; uLoop < m_uLoops; ++uLoop)
+            m_scheduler.ParallelFor(0, QTaskSchedulerPerformanceTestLoop::ITERATIONS, QDelegate<void (const unsigned int, const unsigned int)>(&m_body, &QTaskSchedulerPerformanceTestLoop::Execute), 1U);
+    }
+
+    QTaskScheduler &m_scheduler;
+    QTaskSchedulerPerformanceTestLoop &m_body;
+    unsigned int m_uLoops;
+};
+
+
+
+QTEST_SUITE_BEGIN( QTaskScheduler_TestSuite )
+
+/// <summary>
+/// Compares the time spent executing a set of small tasks in the scheduler with the time spent creating a thread for every task.
+/// </summary>
+QTEST_CASE ( Run_IsComparedToCreatingOneThreadPerTask_Test )
+{
+    // [Preparation]
+    const unsigned int TASKS = 1000U;
+    const unsigned int WORKERS = 3U;
+    QTaskSchedulerPerformanceTestClass* arThreadTasks = new QTaskSchedulerPerformanceTestClass[TASKS];
+    QTaskSchedulerPerformanceTestClass* arSchedulerTasks = new QTaskSchedulerPerformanceTestClass[TASKS];
+    QTaskScheduler scheduler(WORKERS);
+
+    // Threads are created in batches, as many as the scheduler uses at the same time
+    QTaskSchedulerPerformanceTestThreads threadsTest(arThreadTasks, TASKS, WORKERS + 1U, 1U);
+    QTaskSchedulerPerformanceTestRun schedulerTest(scheduler, arSchedulerTasks, TASKS);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("One thread per task, 1000 tasks in batches of 4 threads", threadsTest);
+    QPerformanceMeasurement::Measure("QTaskScheduler::Run, 1000 tasks, 3 workers", schedulerTest);
+
+    // [Verification]
+    for(unsigned int i = 0; i < TASKS; ++i)
+        BOOST_CHECK_EQUAL(arSchedulerTasks[i].m_uResult, arThreadTasks[i].m_uResult);
+
+    // [Cleaning]
+    delete[] arThreadTasks;
+    delete[] arSchedulerTasks;
+}
+
+/// <summary>
+/// Compares the time spent executing a set of small tasks that depend on the previous one, in the scheduler and creating a thread
+/// for every task once the previous thread has finished.
+/// </summary>
+QTEST_CASE ( AddContinuation_IsComparedToCreatingOneThreadPerTask_Test )
+{
+    // [Preparation]
+    const unsigned int TASKS = 200U;
+    QTaskSchedulerPerformanceTestClass* arThreadTasks = new QTaskSchedulerPerformanceTestClass[TASKS];
+    QTaskSchedulerPerformanceTestClass* arSchedulerTasks = new QTaskSchedulerPerformanceTestClass[TASKS];
+    QTaskScheduler scheduler(3U);
+
+    QTaskSchedulerPerformanceTestThreads threadsTest(arThreadTasks, TASKS, 1U, 1U);
+    QTaskSchedulerPerformanceTestContinuations schedulerTest(scheduler, arSchedulerTasks, TASKS);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("One thread per task, chain of 200 tasks", threadsTest);
+    QPerformanceMeasurement::Measure("QTaskScheduler::AddContinuation, chain of 200 tasks, 3 workers", schedulerTest);
+
+    // [Verification]
+    for(unsigned int i = 0; i < TASKS; ++i)
+        BOOST_CHECK_EQUAL(arSchedulerTasks[i].m_uResult, arThreadTasks[i].m_uResult);
+
+    // [Cleaning]
+    delete[] arThreadTasks;
+    delete[] arSchedulerTasks;
+}
+
+/// <summary>
+/// Compares the time spent executing a parallel loop in the scheduler with the time spent creating a thread for every range of iterations.
+/// </summary>
+QTEST_CASE ( ParallelFor_IsComparedToCreatingOneThreadPerRange_Test )
+{
+    // [Preparation]
+    const unsigned int LOOPS = 100U;
+    const unsigned int WORKERS = 3U;
+    const unsigned int RANGES = QTaskSchedulerPerformanceTestLoop::ITERATIONS;
+    QTaskSchedulerPerformanceTestClass* arThreadTasks = new QTaskSchedulerPerformanceTestClass[RANGES];
+    QTaskScheduler scheduler(WORKERS);
+    QTaskSchedulerPerformanceTestLoop body;
+
+    QTaskSchedulerPerformanceTestThreads threadsTest(arThreadTasks, RANGES, RANGES, LOOPS);
+    QTaskSchedulerPerformanceTestParallelFor schedulerTest(scheduler, body, LOOPS);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("One thread per range, 100 loops of 16 ranges", threadsTest);
+    QPerformanceMeasurement::Measure("QTaskScheduler::ParallelFor, 100 loops of 16 ranges, 3 workers", schedulerTest);
+
+    // [Verification]
+    for(unsigned int i = 0; i < RANGES; ++i)
+        BOOST_CHECK_EQUAL(body.m_arTasks[i].m_uResult, arThreadTasks[i].m_uResult);
+
+    // [Cleaning]
+    delete[] arThreadTasks;
+}
+
+// End - Test Suite: QTaskScheduler
+QTEST_SUITE_END()
@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QArrayDynamic.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Functor measured in the performance tests of QArrayDynamic, which fills an array and traverses it
+class QArrayDynamicPerformanceTestClass
+{
+public:
+
+    static const u32_q ELEMENT_COUNT = 10000U;
+
+    QArrayDynamicPerformanceTestClass(const bool bReserve) : m_bReserve(bReserve),
+                                                             m_uChecksum(0)
+    {
+    }
+
+    void operator()()
+    {
+        QArrayDynamic<u32_q> arElements;
+
+        if(m_bReserve)
+            arElements.Reserve(ELEMENT_COUNT);
+
+        for(u32_q i = 0; i < ELEMENT_COUNT; ++i)
+            arElements.Add(i);
+
+        for(QArrayDynamic<u32_q>::QConstArrayIterator it = arElements.GetFirst(); !it.IsEnd(); ++it)
+            m_uChecksum += *it;
+    }
+
+    bool m_bReserve;
+    u64_q m_uChecksum;
+};
+
+// Functor measured in the performance tests of QArrayDynamic, which inserts and removes elements at the beginning of an array
+class QArrayDynamicInsertPerformanceTestClass
+{
+public:
+
+    static const u32_q ELEMENT_COUNT = 1000U;
+
+    QArrayDynamicInsertPerformanceTestClass() : m_uChecksum(0)
+    {
+    }
+
+    void operator()()
+    {
+        QArrayDynamic<u32_q> arElements(ELEMENT_COUNT);
+
+        // Insert needs an existing position
+        arElements.Add(0);
+
+        for(u32_q i = 1U; i < ELEMENT_COUNT; ++i)
+            arElements.Insert(i, 0);
+
+        while(!arElements.IsEmpty())
+        {
+            m_uChecksum += arElements[0];
+            arElements.Remove(0);
+        }
+    }
+
+    u64_q m_uChecksum;
+};
+
+
+QTEST_SUITE_BEGIN( QArrayDynamic_TestSuite )
+
+/// <summary>
+/// Compares the time spent adding elements when the capacity is reserved beforehand with the time spent when the array grows.
+/// </summary>
+QTEST_CASE ( Add_IsComparedWithAndWithoutReservingCapacity_Test )
+{
+    // [Preparation]
+    QArrayDynamicPerformanceTestClass growingTest(false);
+    QArrayDynamicPerformanceTestClass reservedTest(true);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Add and traversal, 10000 elements, growing", growingTest);
+    QPerformanceMeasurement::Measure("Add and traversal, 10000 elements, reserved", reservedTest);
+
+    // [Verification]
+    BOOST_CHECK(growingTest.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(growingTest.m_uChecksum, reservedTest.m_uChecksum);
+}
+
+/// <summary>
+/// Measures the time spent inserting and removing elements at the beginning of the array, which moves all the other elements.
+/// </summary>
+QTEST_CASE ( InsertAndRemove_IsMeasuredAtTheBeginning_Test )
+{
+    // [Preparation]
+    QArrayDynamicInsertPerformanceTestClass test;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Insert and Remove at the beginning, 1000 elements", test);
+
+    // [Verification]
+    BOOST_CHECK(test.m_uChecksum > 0);
+}
+
+// End - Test Suite: QArrayDynamic
+QTEST_SUITE_END()
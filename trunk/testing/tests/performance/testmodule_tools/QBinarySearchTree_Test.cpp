@@ -0,0 +1,244 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QBinarySearchTree.h"
+
+#include "QKeyValuePair.h"
+#include "SQKeyValuePairComparator.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QBinarySearchTree;
+using Kinesis::QuimeraEngine::Tools::Containers::QKeyValuePair;
+using Kinesis::QuimeraEngine::Tools::Containers::SQKeyValuePairComparator;
+using Kinesis::QuimeraEngine::Tools::Containers::EQTreeTraversalOrder;
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Class that generates the streams of keys used in the performance tests of QBinarySearchTree
+class QBinarySearchTreePerformanceTestHelper
+{
+public:
+
+    // The tree used by QDictionary, which keeps itself balanced
+    typedef QBinarySearchTree<QKeyValuePair<u32_q, u32_q>, QPoolAllocator, SQKeyValuePairComparator<u32_q, u32_q>, true> BalancedTreeType;
+
+    // The tree QDictionary used before it kept itself balanced
+    typedef QBinarySearchTree<QKeyValuePair<u32_q, u32_q>, QPoolAllocator, SQKeyValuePairComparator<u32_q, u32_q>, false> UnbalancedTreeType;
+
+    static const unsigned int KEY_COUNT = 5000U;
+
+    static void GenerateSortedKeys(u32_q* arKeys)
+    {
+        for(unsigned int i = 0; i < KEY_COUNT; ++i)
+            arKeys[i] = i;
+    }
+
+    static void GenerateReverseSortedKeys(u32_q* arKeys)
+    {
+        for(unsigned int i = 0; i < KEY_COUNT; ++i)
+            arKeys[i] = KEY_COUNT - 1U - i;
+    }
+
+    // The sorted keys are shuffled using a fixed seed so all the executions are comparable
+    static void GenerateRandomKeys(u32_q* arKeys)
+    {
+        QBinarySearchTreePerformanceTestHelper::GenerateSortedKeys(arKeys);
+
+        u32_q uSeed = 12345U;
+
+        for(unsigned int i = KEY_COUNT - 1U; i > 0; --i)
+        {
+            uSeed = uSeed * 1664525U + 1013904223U;
+            const unsigned int SWAP_POSITION = (uSeed >> 8U) % (i + 1U);
+            const u32_q SWAP_KEY = arKeys[i];
+            arKeys[i] = arKeys[SWAP_POSITION];
+            arKeys[SWAP_POSITION] = SWAP_KEY;
+        }
+    }
+};
+
+// Functor measured in the performance tests of QBinarySearchTree::Add, which fills an empty tree with all the keys
+template<class TreeT>
+class QBinarySearchTreePerformanceTestAdd
+{
+public:
+
+    QBinarySearchTreePerformanceTestAdd(const u32_q* arKeys) : m_arKeys(arKeys),
+                                                               m_uCount(0)
+    {
+    }
+
+    void operator()()
+    {
+        TreeT tree(QBinarySearchTreePerformanceTestHelper::KEY_COUNT);
+
+        for(unsigned int i = 0; i < QBinarySearchTreePerformanceTestHelper::KEY_COUNT; ++i)
+            tree.Add(QKeyValuePair<u32_q, u32_q>(m_arKeys[i], i), EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+        m_uCount = tree.GetCount();
+    }
+
+    const u32_q* m_arKeys;
+    pointer_uint_q m_uCount;
+};
+
+// Functor measured in the performance tests of QBinarySearchTree::PositionOf, which searches for all the keys in a tree that
+// is filled only once, when the functor is created
+// The keys are searched for in the same order they were added, as the dictionary does when getting values
+template<class TreeT>
+class QBinarySearchTreePerformanceTestPositionOf
+{
+public:
+
+    QBinarySearchTreePerformanceTestPositionOf(const u32_q* arKeys) : m_arKeys(arKeys),
+                                                                      m_tree(QBinarySearchTreePerformanceTestHelper::KEY_COUNT),
+                                                                      m_uChecksum(0)
+    {
+        for(unsigned int i = 0; i < QBinarySearchTreePerformanceTestHelper::KEY_COUNT; ++i)
+            m_tree.Add(QKeyValuePair<u32_q, u32_q>(m_arKeys[i], i), EQTreeTraversalOrder::E_DepthFirstInOrder);
+    }
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < QBinarySearchTreePerformanceTestHelper::KEY_COUNT; ++i)
+            m_uChecksum += m_tree.PositionOf(QKeyValuePair<u32_q, u32_q>(m_arKeys[i], 0), EQTreeTraversalOrder::E_DepthFirstInOrder)->GetValue();
+    }
+
+    const u32_q* m_arKeys;
+    TreeT m_tree;
+    u64_q m_uChecksum;
+};
+
+// Measures Add in both trees with the same stream of keys
+void QBinarySearchTreePerformanceTest_CompareAdd(const u32_q* arKeys, const std::string &strKeysDescription)
+{
+    // [Preparation]
+    QBinarySearchTreePerformanceTestAdd<QBinarySearchTreePerformanceTestHelper::UnbalancedTreeType> unbalancedTest(arKeys);
+    QBinarySearchTreePerformanceTestAdd<QBinarySearchTreePerformanceTestHelper::BalancedTreeType> balancedTest(arKeys);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Add, unbalanced tree, 5000 " + strKeysDescription, unbalancedTest);
+    QPerformanceMeasurement::Measure("Add, balanced tree, 5000 " + strKeysDescription, balancedTest);
+
+    // [Verification]
+    BOOST_CHECK(balancedTest.m_uCount > 0);
+    BOOST_CHECK_EQUAL(balancedTest.m_uCount, unbalancedTest.m_uCount);
+}
+
+// Measures PositionOf in both trees with the same stream of keys
+void QBinarySearchTreePerformanceTest_ComparePositionOf(const u32_q* arKeys, const std::string &strKeysDescription)
+{
+    // [Preparation]
+    QBinarySearchTreePerformanceTestPositionOf<QBinarySearchTreePerformanceTestHelper::UnbalancedTreeType> unbalancedTest(arKeys);
+    QBinarySearchTreePerformanceTestPositionOf<QBinarySearchTreePerformanceTestHelper::BalancedTreeType> balancedTest(arKeys);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("PositionOf, unbalanced tree, 5000 " + strKeysDescription, unbalancedTest);
+    QPerformanceMeasurement::Measure("PositionOf, balanced tree, 5000 " + strKeysDescription, balancedTest);
+
+    // [Verification]
+    BOOST_CHECK(balancedTest.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(balancedTest.m_uChecksum, unbalancedTest.m_uChecksum);
+}
+
+
+QTEST_SUITE_BEGIN( QBinarySearchTree_TestSuite )
+
+/// <summary>
+/// Compares the time spent adding sorted keys to the balanced tree with the time spent adding them to an unbalanced tree.
+/// </summary>
+QTEST_CASE ( Add_IsComparedToUnbalancedTreeWhenKeysAreSorted_Test )
+{
+    u32_q arKeys[QBinarySearchTreePerformanceTestHelper::KEY_COUNT];
+    QBinarySearchTreePerformanceTestHelper::GenerateSortedKeys(arKeys);
+    QBinarySearchTreePerformanceTest_CompareAdd(arKeys, "sorted keys");
+}
+
+/// <summary>
+/// Compares the time spent adding reverse sorted keys to the balanced tree with the time spent adding them to an unbalanced tree.
+/// </summary>
+QTEST_CASE ( Add_IsComparedToUnbalancedTreeWhenKeysAreReverseSorted_Test )
+{
+    u32_q arKeys[QBinarySearchTreePerformanceTestHelper::KEY_COUNT];
+    QBinarySearchTreePerformanceTestHelper::GenerateReverseSortedKeys(arKeys);
+    QBinarySearchTreePerformanceTest_CompareAdd(arKeys, "reverse sorted keys");
+}
+
+/// <summary>
+/// Compares the time spent adding random keys to the balanced tree with the time spent adding them to an unbalanced tree.
+/// </summary>
+/// <remarks>
+/// Random keys produce a fairly balanced tree anyway, so the only purpose of this test is to measure the cost of keeping it balanced.
+/// </remarks>
+QTEST_CASE ( Add_IsComparedToUnbalancedTreeWhenKeysAreRandom_Test )
+{
+    u32_q arKeys[QBinarySearchTreePerformanceTestHelper::KEY_COUNT];
+    QBinarySearchTreePerformanceTestHelper::GenerateRandomKeys(arKeys);
+    QBinarySearchTreePerformanceTest_CompareAdd(arKeys, "random keys");
+}
+
+/// <summary>
+/// Compares the time spent searching for sorted keys in the balanced tree with the time spent searching for them in an unbalanced tree.
+/// </summary>
+QTEST_CASE ( PositionOf_IsComparedToUnbalancedTreeWhenKeysAreSorted_Test )
+{
+    u32_q arKeys[QBinarySearchTreePerformanceTestHelper::KEY_COUNT];
+    QBinarySearchTreePerformanceTestHelper::GenerateSortedKeys(arKeys);
+    QBinarySearchTreePerformanceTest_ComparePositionOf(arKeys, "sorted keys");
+}
+
+/// <summary>
+/// Compares the time spent searching for reverse sorted keys in the balanced tree with the time spent searching for them in an unbalanced tree.
+/// </summary>
+QTEST_CASE ( PositionOf_IsComparedToUnbalancedTreeWhenKeysAreReverseSorted_Test )
+{
+    u32_q arKeys[QBinarySearchTreePerformanceTestHelper::KEY_COUNT];
+    QBinarySearchTreePerformanceTestHelper::GenerateReverseSortedKeys(arKeys);
+    QBinarySearchTreePerformanceTest_ComparePositionOf(arKeys, "reverse sorted keys");
+}
+
+/// <summary>
+/// Compares the time spent searching for random keys in the balanced tree with the time spent searching for them in an unbalanced tree.
+/// </summary>
+/// <remarks>
+/// Random keys produce a fairly balanced tree anyway, so the only purpose of this test is to measure the cost of keeping it balanced.
+/// </remarks>
+QTEST_CASE ( PositionOf_IsComparedToUnbalancedTreeWhenKeysAreRandom_Test )
+{
+    u32_q arKeys[QBinarySearchTreePerformanceTestHelper::KEY_COUNT];
+    QBinarySearchTreePerformanceTestHelper::GenerateRandomKeys(arKeys);
+    QBinarySearchTreePerformanceTest_ComparePositionOf(arKeys, "random keys");
+}
+
+// End - Test Suite: QBinarySearchTree
+QTEST_SUITE_END()
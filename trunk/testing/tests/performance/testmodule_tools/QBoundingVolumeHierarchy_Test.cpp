@@ -0,0 +1,226 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QBoundingVolumeHierarchy.h"
+
+#include "QRay3D.h"
+#include "SQFloat.h"
+
+using Kinesis::QuimeraEngine::Tools::Math::QBoundingVolumeHierarchy;
+using Kinesis::QuimeraEngine::Tools::Math::QRay3D;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Base class of the functors measured in the performance tests of QBoundingVolumeHierarchy, which stores a grid of triangles in the 
+// plane Z = 0, the hierarchy built from them and a set of oblique rays that point to the grid
+class QBoundingVolumeHierarchyPerformanceTestClass
+{
+public:
+
+    static const unsigned int TRIANGLE_COUNT = 16384U;
+    static const unsigned int RAY_COUNT = 256U;
+    static const unsigned int GRID_WIDTH = 128U;
+
+    QBoundingVolumeHierarchyPerformanceTestClass() : m_pHierarchy(null_q),
+                                                     m_uIntersections(0)
+    {
+        for(unsigned int i = 0; i < TRIANGLE_COUNT; ++i)
+        {
+            const float_q X = scast_q(i % GRID_WIDTH, float_q);
+            const float_q Y = scast_q(i / GRID_WIDTH, float_q);
+            m_arTriangles[i] = QBaseTriangle<QVector3>(QVector3(X, Y, SQFloat::_0), QVector3(X + SQFloat::_1, Y, SQFloat::_0), QVector3(X, Y + SQFloat::_1, SQFloat::_0));
+        }
+
+        for(unsigned int i = 0; i < RAY_COUNT; ++i)
+        {
+            const float_q POSITION = scast_q(i % GRID_WIDTH, float_q) + SQFloat::_0_25;
+            m_arRays[i] = QRay3D<QVector3>(QVector3(POSITION, POSITION, SQFloat::_10), QVector3(SQFloat::_1, -SQFloat::_1, -SQFloat::_10).Normalize());
+        }
+
+        m_pHierarchy = new QBoundingVolumeHierarchy< QBaseTriangle<QVector3> >(m_arTriangles, TRIANGLE_COUNT);
+    }
+
+    ~QBoundingVolumeHierarchyPerformanceTestClass()
+    {
+        delete m_pHierarchy;
+    }
+
+    QBaseTriangle<QVector3> m_arTriangles[TRIANGLE_COUNT];
+    QRay3D<QVector3> m_arRays[RAY_COUNT];
+    QBoundingVolumeHierarchy< QBaseTriangle<QVector3> >* m_pHierarchy;
+    unsigned int m_uIntersections;
+};
+
+// Searches for the closest triangle hit by every ray, checking all the triangles
+class QBoundingVolumeHierarchyBruteForcePerformanceTestClass : public QBoundingVolumeHierarchyPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(unsigned int uRay = 0; uRay < RAY_COUNT; ++uRay)
+        {
+            float_q fClosestDistance = SQFloat::MaxFloat_Q;
+            float_q fDistance, fU, fV;
+
+            for(unsigned int i = 0; i < TRIANGLE_COUNT; ++i)
+            {
+                if(m_arRays[uRay].Intersection(m_arTriangles[i], fDistance, fU, fV) && fDistance < fClosestDistance)
+                    fClosestDistance = fDistance;
+            }
+
+            m_uIntersections += fClosestDistance != SQFloat::MaxFloat_Q ? 1U : 0;
+        }
+    }
+};
+
+// Searches for the closest triangle hit by every ray using the hierarchy
+class QBoundingVolumeHierarchyClosestIntersectionPerformanceTestClass : public QBoundingVolumeHierarchyPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        unsigned int uPrimitive = 0;
+        float_q fDistance = SQFloat::_0;
+
+        for(unsigned int uRay = 0; uRay < RAY_COUNT; ++uRay)
+            m_uIntersections += m_pHierarchy->FindClosestIntersection(m_arRays[uRay], uPrimitive, fDistance) ? 1U : 0;
+    }
+};
+
+// Builds a new hierarchy from all the triangles
+class QBoundingVolumeHierarchyBuildPerformanceTestClass : public QBoundingVolumeHierarchyPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        QBoundingVolumeHierarchy< QBaseTriangle<QVector3> > hierarchy(m_arTriangles, TRIANGLE_COUNT);
+        m_uIntersections += hierarchy.GetNodeCount();
+    }
+};
+
+// Updates the bounding boxes of the hierarchy without changing its structure
+class QBoundingVolumeHierarchyRefitPerformanceTestClass : public QBoundingVolumeHierarchyPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        m_pHierarchy->Refit(m_arTriangles);
+        m_uIntersections += m_pHierarchy->GetNodeCount();
+    }
+};
+
+
+QTEST_SUITE_BEGIN( QBoundingVolumeHierarchy_TestSuite )
+
+/// <summary>
+/// Measures the time spent searching for the closest triangle hit by many rays without a hierarchy, as a reference.
+/// </summary>
+QTEST_CASE ( FindClosestIntersection_IsMeasuredWhenCheckingEveryTriangle_Test )
+{
+    // [Preparation]
+    QBoundingVolumeHierarchyBruteForcePerformanceTestClass* pTest = new QBoundingVolumeHierarchyBruteForcePerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Closest intersection checking every triangle, 256 rays x 16384 triangles", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uIntersections != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+/// <summary>
+/// Measures the time spent searching for the closest triangle hit by many rays using the hierarchy.
+/// </summary>
+QTEST_CASE ( FindClosestIntersection_IsMeasuredWhenUsingHierarchy_Test )
+{
+    // [Preparation]
+    QBoundingVolumeHierarchyClosestIntersectionPerformanceTestClass* pTest = new QBoundingVolumeHierarchyClosestIntersectionPerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Closest intersection using the hierarchy, 256 rays x 16384 triangles", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uIntersections != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+/// <summary>
+/// Measures the time spent building a hierarchy.
+/// </summary>
+QTEST_CASE ( Constructor_IsMeasured_Test )
+{
+    // [Preparation]
+    QBoundingVolumeHierarchyBuildPerformanceTestClass* pTest = new QBoundingVolumeHierarchyBuildPerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Build, 16384 triangles", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uIntersections != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+/// <summary>
+/// Measures the time spent refitting a hierarchy.
+/// </summary>
+QTEST_CASE ( Refit_IsMeasured_Test )
+{
+    // [Preparation]
+    QBoundingVolumeHierarchyRefitPerformanceTestClass* pTest = new QBoundingVolumeHierarchyRefitPerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Refit, 16384 triangles", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uIntersections != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+// End - Test Suite: QBoundingVolumeHierarchy
+QTEST_SUITE_END()
@@ -0,0 +1,176 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QDateTime.h"
+
+#include "QTimeSpan.h"
+
+using Kinesis::QuimeraEngine::Tools::Time::QDateTime;
+using Kinesis::QuimeraEngine::Tools::Time::QTimeSpan;
+using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Base class of the functors measured in the performance tests of QDateTime, which stores a set of dates and their timestamps
+class QDateTimePerformanceTestClass
+{
+public:
+
+    static const unsigned int DATETIME_COUNT = 500U;
+
+    QDateTimePerformanceTestClass() : m_uChecksum(0)
+    {
+        const QTimeSpan INCREMENT(1, 17, 3, 12, 345, 678, 9);
+        QDateTime dateTime(1999, 12, 31, 23, 0, 0, 0, 0, 0, null_q);
+
+        for(unsigned int i = 0; i < DATETIME_COUNT; ++i)
+        {
+            m_arDateTimes[i] = dateTime;
+            m_arTimestampLengths[i] = dateTime.ToString(&m_arTimestamps[i * QDateTime::TIMESTAMP_MAXIMUM_LENGTH]);
+            m_arTimestampPointers[i] = &m_arTimestamps[i * QDateTime::TIMESTAMP_MAXIMUM_LENGTH];
+            dateTime += INCREMENT;
+        }
+    }
+
+    QDateTime m_arDateTimes[DATETIME_COUNT];
+    i8_q m_arTimestamps[DATETIME_COUNT * QDateTime::TIMESTAMP_MAXIMUM_LENGTH];
+    const i8_q* m_arTimestampPointers[DATETIME_COUNT];
+    unsigned int m_arTimestampLengths[DATETIME_COUNT];
+    u64_q m_uChecksum;
+};
+
+// Writes the timestamps either to strings or to a buffer
+class QDateTimeToStringPerformanceTestClass : public QDateTimePerformanceTestClass
+{
+public:
+
+    QDateTimeToStringPerformanceTestClass(const bool bUseBuffer) : m_bUseBuffer(bUseBuffer)
+    {
+    }
+
+    void operator()()
+    {
+        if(m_bUseBuffer)
+        {
+            i8_q arOutput[DATETIME_COUNT * QDateTime::TIMESTAMP_MAXIMUM_LENGTH];
+            unsigned int arLengths[DATETIME_COUNT];
+            QDateTime::FormatTimestamps(m_arDateTimes, DATETIME_COUNT, arOutput, arLengths);
+
+            for(unsigned int i = 0; i < DATETIME_COUNT; ++i)
+                m_uChecksum += arLengths[i];
+        }
+        else
+        {
+            for(unsigned int i = 0; i < DATETIME_COUNT; ++i)
+                m_uChecksum += m_arDateTimes[i].ToString().GetLength();
+        }
+    }
+
+    bool m_bUseBuffer;
+};
+
+// Parses the timestamps either from strings or from a buffer
+class QDateTimeParsePerformanceTestClass : public QDateTimePerformanceTestClass
+{
+public:
+
+    QDateTimeParsePerformanceTestClass(const bool bUseBuffer) : m_bUseBuffer(bUseBuffer)
+    {
+        for(unsigned int i = 0; i < DATETIME_COUNT; ++i)
+            m_arStrings[i] = string_q(m_arTimestampPointers[i], scast_q(m_arTimestampLengths[i], int));
+    }
+
+    void operator()()
+    {
+        if(m_bUseBuffer)
+        {
+            QDateTime::ParseTimestamps(m_arTimestampPointers, m_arTimestampLengths, DATETIME_COUNT, m_arParsed);
+        }
+        else
+        {
+            for(unsigned int i = 0; i < DATETIME_COUNT; ++i)
+                m_arParsed[i] = QDateTime(m_arStrings[i]);
+        }
+
+        for(unsigned int i = 0; i < DATETIME_COUNT; ++i)
+            m_uChecksum += m_arParsed[i] == m_arDateTimes[i] ? 1U : 0;
+    }
+
+    bool m_bUseBuffer;
+    string_q m_arStrings[DATETIME_COUNT];
+    QDateTime m_arParsed[DATETIME_COUNT];
+};
+
+
+QTEST_SUITE_BEGIN( QDateTime_TestSuite )
+
+/// <summary>
+/// Compares the time spent writing timestamps to strings with the time spent writing them to a buffer.
+/// </summary>
+QTEST_CASE ( ToString_IsComparedToFormatTimestamps_Test )
+{
+    // [Preparation]
+    QDateTimeToStringPerformanceTestClass stringTest(false);
+    QDateTimeToStringPerformanceTestClass bufferTest(true);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("ToString, 500 timestamps", stringTest);
+    QPerformanceMeasurement::Measure("FormatTimestamps, 500 timestamps", bufferTest);
+
+    // [Verification]
+    BOOST_CHECK(stringTest.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(stringTest.m_uChecksum, bufferTest.m_uChecksum);
+}
+
+/// <summary>
+/// Compares the time spent parsing timestamps stored in strings with the time spent parsing them from a buffer.
+/// </summary>
+QTEST_CASE ( Constructor_IsComparedToParseTimestamps_Test )
+{
+    // [Preparation]
+    QDateTimeParsePerformanceTestClass stringTest(false);
+    QDateTimeParsePerformanceTestClass bufferTest(true);
+    const u64_q EXPECTED_CHECKSUM = (QPerformanceMeasurement::DEFAULT_WARM_UPS + QPerformanceMeasurement::DEFAULT_REPETITIONS) * QDateTimePerformanceTestClass::DATETIME_COUNT;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Constructor from string_q, 500 timestamps", stringTest);
+    QPerformanceMeasurement::Measure("ParseTimestamps, 500 timestamps", bufferTest);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stringTest.m_uChecksum, EXPECTED_CHECKSUM);
+    BOOST_CHECK_EQUAL(bufferTest.m_uChecksum, EXPECTED_CHECKSUM);
+}
+
+// End - Test Suite: QDateTime
+QTEST_SUITE_END()
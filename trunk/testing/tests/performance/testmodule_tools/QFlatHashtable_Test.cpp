@@ -0,0 +1,218 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QFlatHashtable.h"
+
+#include "QHashtable.h"
+#include "QDictionary.h"
+#include "SQStringHashProvider.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QFlatHashtable;
+using Kinesis::QuimeraEngine::Tools::Containers::QHashtable;
+using Kinesis::QuimeraEngine::Tools::Containers::QDictionary;
+using Kinesis::QuimeraEngine::Tools::Containers::SQIntegerHashProvider;
+using Kinesis::QuimeraEngine::Tools::Containers::SQStringHashProvider;
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Class that generates the keys used in the performance tests of QFlatHashtable
+class QFlatHashtablePerformanceTestHelper
+{
+public:
+
+    static const unsigned int KEY_COUNT = 20000U;
+
+    // The keys are pseudo-random numbers generated using a fixed seed so all the executions are comparable
+    static void GenerateIntegerKeys(u32_q* arKeys)
+    {
+        u32_q uSeed = 12345U;
+
+        for(unsigned int i = 0; i < KEY_COUNT; ++i)
+        {
+            uSeed = uSeed * 1664525U + 1013904223U;
+            // The index is added to the high bits so keys never repeat
+            arKeys[i] = (uSeed & 0xFFFF0000U) ^ i;
+        }
+    }
+
+    static void GenerateStringKeys(string_q* arKeys)
+    {
+        u32_q arIntegerKeys[KEY_COUNT];
+        QFlatHashtablePerformanceTestHelper::GenerateIntegerKeys(arIntegerKeys);
+
+        for(unsigned int i = 0; i < KEY_COUNT; ++i)
+            arKeys[i] = string_q("key_") + string_q::FromInteger(arIntegerKeys[i]);
+    }
+};
+
+// Functor measured in the performance tests of GetValue, which searches for all the keys in a container that is filled only once,
+// when the functor is created
+// The same interface is shared by the three containers, so the lookup loop is identical for all of them
+template<class ContainerT, class KeyT>
+class QFlatHashtablePerformanceTestGetValue
+{
+public:
+
+    QFlatHashtablePerformanceTestGetValue(ContainerT &container, const KeyT* arKeys) : m_container(container),
+                                                                                      m_arKeys(arKeys),
+                                                                                      m_uChecksum(0)
+    {
+        for(unsigned int i = 0; i < QFlatHashtablePerformanceTestHelper::KEY_COUNT; ++i)
+            m_container.Add(m_arKeys[i], i);
+    }
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < QFlatHashtablePerformanceTestHelper::KEY_COUNT; ++i)
+            m_uChecksum += m_container.GetValue(m_arKeys[i]);
+    }
+
+    ContainerT &m_container;
+    const KeyT* m_arKeys;
+    u64_q m_uChecksum;
+};
+
+// Functor measured in the performance tests of ContainsKey, which searches for all the keys in a container that is filled only once,
+// when the functor is created, with half of them
+template<class ContainerT, class KeyT>
+class QFlatHashtablePerformanceTestContainsKey
+{
+public:
+
+    QFlatHashtablePerformanceTestContainsKey(ContainerT &container, const KeyT* arKeys) : m_container(container),
+                                                                                         m_arKeys(arKeys),
+                                                                                         m_uFoundCount(0)
+    {
+        for(unsigned int i = 0; i < QFlatHashtablePerformanceTestHelper::KEY_COUNT; i += 2U)
+            m_container.Add(m_arKeys[i], i);
+    }
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < QFlatHashtablePerformanceTestHelper::KEY_COUNT; ++i)
+            m_uFoundCount += m_container.ContainsKey(m_arKeys[i]) ? 1U : 0;
+    }
+
+    ContainerT &m_container;
+    const KeyT* m_arKeys;
+    u64_q m_uFoundCount;
+};
+
+
+QTEST_SUITE_BEGIN( QFlatHashtable_TestSuite )
+
+/// <summary>
+/// Compares the time spent getting values by integer key from the flat hashtable with the time spent by QHashtable and QDictionary.
+/// </summary>
+QTEST_CASE ( GetValue_IsComparedToHashtableAndDictionaryWhenKeysAreIntegers_Test )
+{
+    // [Preparation]
+    u32_q arKeys[QFlatHashtablePerformanceTestHelper::KEY_COUNT];
+    QFlatHashtablePerformanceTestHelper::GenerateIntegerKeys(arKeys);
+    QFlatHashtable<u32_q, u32_q> flatHashtable(QFlatHashtablePerformanceTestHelper::KEY_COUNT);
+    QHashtable<u32_q, u32_q> hashtable(QFlatHashtablePerformanceTestHelper::KEY_COUNT, 1U);
+    QDictionary<u32_q, u32_q> dictionary(QFlatHashtablePerformanceTestHelper::KEY_COUNT);
+    QFlatHashtablePerformanceTestGetValue<QFlatHashtable<u32_q, u32_q>, u32_q> flatHashtableTest(flatHashtable, arKeys);
+    QFlatHashtablePerformanceTestGetValue<QHashtable<u32_q, u32_q>, u32_q> hashtableTest(hashtable, arKeys);
+    QFlatHashtablePerformanceTestGetValue<QDictionary<u32_q, u32_q>, u32_q> dictionaryTest(dictionary, arKeys);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("GetValue, QFlatHashtable, 20000 integer keys", flatHashtableTest);
+    QPerformanceMeasurement::Measure("GetValue, QHashtable, 20000 integer keys", hashtableTest);
+    QPerformanceMeasurement::Measure("GetValue, QDictionary, 20000 integer keys", dictionaryTest);
+
+    // [Verification]
+    BOOST_CHECK(flatHashtableTest.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(flatHashtableTest.m_uChecksum, hashtableTest.m_uChecksum);
+    BOOST_CHECK_EQUAL(flatHashtableTest.m_uChecksum, dictionaryTest.m_uChecksum);
+}
+
+/// <summary>
+/// Compares the time spent getting values by string key from the flat hashtable with the time spent by QHashtable and QDictionary.
+/// </summary>
+QTEST_CASE ( GetValue_IsComparedToHashtableAndDictionaryWhenKeysAreStrings_Test )
+{
+    // [Preparation]
+    string_q* arKeys = new string_q[QFlatHashtablePerformanceTestHelper::KEY_COUNT];
+    QFlatHashtablePerformanceTestHelper::GenerateStringKeys(arKeys);
+    QFlatHashtable<string_q, u32_q, SQStringHashProvider> flatHashtable(QFlatHashtablePerformanceTestHelper::KEY_COUNT);
+    QHashtable<string_q, u32_q, SQStringHashProvider> hashtable(QFlatHashtablePerformanceTestHelper::KEY_COUNT, 1U);
+    QDictionary<string_q, u32_q> dictionary(QFlatHashtablePerformanceTestHelper::KEY_COUNT);
+    QFlatHashtablePerformanceTestGetValue<QFlatHashtable<string_q, u32_q, SQStringHashProvider>, string_q> flatHashtableTest(flatHashtable, arKeys);
+    QFlatHashtablePerformanceTestGetValue<QHashtable<string_q, u32_q, SQStringHashProvider>, string_q> hashtableTest(hashtable, arKeys);
+    QFlatHashtablePerformanceTestGetValue<QDictionary<string_q, u32_q>, string_q> dictionaryTest(dictionary, arKeys);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("GetValue, QFlatHashtable, 20000 string keys", flatHashtableTest);
+    QPerformanceMeasurement::Measure("GetValue, QHashtable, 20000 string keys", hashtableTest);
+    QPerformanceMeasurement::Measure("GetValue, QDictionary, 20000 string keys", dictionaryTest);
+
+    // [Verification]
+    BOOST_CHECK(flatHashtableTest.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(flatHashtableTest.m_uChecksum, hashtableTest.m_uChecksum);
+    BOOST_CHECK_EQUAL(flatHashtableTest.m_uChecksum, dictionaryTest.m_uChecksum);
+
+    // [Cleaning]
+    delete[] arKeys;
+}
+
+/// <summary>
+/// Compares the time spent searching for integer keys, half of which do not exist, in the flat hashtable with the time spent by QHashtable and QDictionary.
+/// </summary>
+QTEST_CASE ( ContainsKey_IsComparedToHashtableAndDictionaryWhenHalfOfTheKeysDoNotExist_Test )
+{
+    // [Preparation]
+    u32_q arKeys[QFlatHashtablePerformanceTestHelper::KEY_COUNT];
+    QFlatHashtablePerformanceTestHelper::GenerateIntegerKeys(arKeys);
+    QFlatHashtable<u32_q, u32_q> flatHashtable(QFlatHashtablePerformanceTestHelper::KEY_COUNT);
+    QHashtable<u32_q, u32_q> hashtable(QFlatHashtablePerformanceTestHelper::KEY_COUNT, 1U);
+    QDictionary<u32_q, u32_q> dictionary(QFlatHashtablePerformanceTestHelper::KEY_COUNT);
+    QFlatHashtablePerformanceTestContainsKey<QFlatHashtable<u32_q, u32_q>, u32_q> flatHashtableTest(flatHashtable, arKeys);
+    QFlatHashtablePerformanceTestContainsKey<QHashtable<u32_q, u32_q>, u32_q> hashtableTest(hashtable, arKeys);
+    QFlatHashtablePerformanceTestContainsKey<QDictionary<u32_q, u32_q>, u32_q> dictionaryTest(dictionary, arKeys);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("ContainsKey, QFlatHashtable, 20000 integer keys, half of them missing", flatHashtableTest);
+    QPerformanceMeasurement::Measure("ContainsKey, QHashtable, 20000 integer keys, half of them missing", hashtableTest);
+    QPerformanceMeasurement::Measure("ContainsKey, QDictionary, 20000 integer keys, half of them missing", dictionaryTest);
+
+    // [Verification]
+    BOOST_CHECK(flatHashtableTest.m_uFoundCount > 0);
+    BOOST_CHECK_EQUAL(flatHashtableTest.m_uFoundCount, hashtableTest.m_uFoundCount);
+    BOOST_CHECK_EQUAL(flatHashtableTest.m_uFoundCount, dictionaryTest.m_uFoundCount);
+}
+
+// End - Test Suite: QFlatHashtable
+QTEST_SUITE_END()
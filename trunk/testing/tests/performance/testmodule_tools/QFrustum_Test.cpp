@@ -0,0 +1,200 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QFrustum.h"
+
+#include "QSoAPointBuffer.h"
+#include "QBaseOrb.h"
+#include "SQFloat.h"
+
+using Kinesis::QuimeraEngine::Tools::Math::QFrustum;
+using Kinesis::QuimeraEngine::Tools::Math::QPlane;
+using Kinesis::QuimeraEngine::Tools::Math::QSoAPointBuffer;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseOrb;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Base class of the functors measured in the performance tests of QFrustum, which stores a frustum of 90 degrees that looks along
+// the Z axis and a grid of objects around it, about a fourth of which are visible
+class QFrustumPerformanceTestClass
+{
+public:
+
+    static const unsigned int OBJECT_COUNT = 131072U;
+    static const unsigned int GRID_WIDTH = 64U;
+
+    QFrustumPerformanceTestClass() : m_frustum(QPlane(SQFloat::_1, SQFloat::_0, SQFloat::_1, SQFloat::_0),
+                                               QPlane(-SQFloat::_1, SQFloat::_0, SQFloat::_1, SQFloat::_0),
+                                               QPlane(SQFloat::_0, SQFloat::_1, SQFloat::_1, SQFloat::_0),
+                                               QPlane(SQFloat::_0, -SQFloat::_1, SQFloat::_1, SQFloat::_0),
+                                               QPlane(SQFloat::_0, SQFloat::_0, SQFloat::_1, -SQFloat::_1),
+                                               QPlane(SQFloat::_0, SQFloat::_0, -SQFloat::_1, scast_q(100, float_q))),
+                                     m_centers(OBJECT_COUNT),
+                                     m_halfSizes(OBJECT_COUNT),
+                                     m_arRadii(new float_q[OBJECT_COUNT]),
+                                     m_arOrbs(new QBaseOrb<QVector3>[OBJECT_COUNT]),
+                                     m_arVisibleIndices(new unsigned int[OBJECT_COUNT]),
+                                     m_uVisibleObjects(0)
+    {
+        const float_q HALF_GRID_WIDTH = scast_q(GRID_WIDTH / 2U, float_q);
+
+        for(unsigned int i = 0; i < OBJECT_COUNT; ++i)
+        {
+            const QVector3 CENTER(scast_q(i % GRID_WIDTH, float_q) - HALF_GRID_WIDTH, 
+                                  scast_q((i / GRID_WIDTH) % GRID_WIDTH, float_q) - HALF_GRID_WIDTH, 
+                                  scast_q(i / (GRID_WIDTH * GRID_WIDTH), float_q) * SQFloat::_4 - SQFloat::_10);
+            m_arRadii[i] = SQFloat::_0_5;
+            m_arOrbs[i] = QBaseOrb<QVector3>(CENTER, m_arRadii[i]);
+            m_centers.SetPoint(i, CENTER);
+            m_halfSizes.SetPoint(i, QVector3(SQFloat::_0_5, SQFloat::_0_5, SQFloat::_0_5));
+        }
+    }
+
+    ~QFrustumPerformanceTestClass()
+    {
+        delete[] m_arRadii;
+        delete[] m_arOrbs;
+        delete[] m_arVisibleIndices;
+    }
+
+    QFrustum m_frustum;
+    QSoAPointBuffer m_centers;
+    QSoAPointBuffer m_halfSizes;
+    float_q* m_arRadii;
+    QBaseOrb<QVector3>* m_arOrbs;
+    unsigned int* m_arVisibleIndices;
+    unsigned int m_uVisibleObjects;
+};
+
+// Checks the orbs one by one
+class QFrustumIsVisiblePerformanceTestClass : public QFrustumPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < OBJECT_COUNT; ++i)
+        {
+            if(m_frustum.IsVisible(m_arOrbs[i]))
+            {
+                m_arVisibleIndices[m_uVisibleObjects % OBJECT_COUNT] = i;
+                ++m_uVisibleObjects;
+            }
+        }
+    }
+};
+
+// Checks all the orbs at once, stored as a buffer of centers and an array of radii
+class QFrustumFindVisibleOrbsPerformanceTestClass : public QFrustumPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        m_uVisibleObjects += m_frustum.FindVisible(m_centers, m_arRadii, m_arVisibleIndices);
+    }
+};
+
+// Checks all the boxes at once, stored as buffers of centers and half sizes
+class QFrustumFindVisibleBoxesPerformanceTestClass : public QFrustumPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        m_uVisibleObjects += m_frustum.FindVisible(m_centers, m_halfSizes, m_arVisibleIndices);
+    }
+};
+
+
+QTEST_SUITE_BEGIN( QFrustum_TestSuite )
+
+/// <summary>
+/// Measures the time spent checking the visibility of many orbs one by one, as a reference.
+/// </summary>
+QTEST_CASE ( IsVisible_IsMeasuredWhenCheckingEveryOrb_Test )
+{
+    // [Preparation]
+    QFrustumIsVisiblePerformanceTestClass* pTest = new QFrustumIsVisiblePerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Visibility checking every orb, 131072 orbs", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uVisibleObjects != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+/// <summary>
+/// Measures the time spent searching for the visible orbs among many orbs stored in buffers.
+/// </summary>
+QTEST_CASE ( FindVisible1_IsMeasured_Test )
+{
+    // [Preparation]
+    QFrustumFindVisibleOrbsPerformanceTestClass* pTest = new QFrustumFindVisibleOrbsPerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Visible orbs in buffers, 131072 orbs", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uVisibleObjects != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+/// <summary>
+/// Measures the time spent searching for the visible boxes among many boxes stored in buffers.
+/// </summary>
+QTEST_CASE ( FindVisible2_IsMeasured_Test )
+{
+    // [Preparation]
+    QFrustumFindVisibleBoxesPerformanceTestClass* pTest = new QFrustumFindVisibleBoxesPerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Visible boxes in buffers, 131072 boxes", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uVisibleObjects != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+// End - Test Suite: QFrustum
+QTEST_SUITE_END()
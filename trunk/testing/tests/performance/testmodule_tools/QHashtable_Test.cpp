@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QHashtable.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QHashtable;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Functor measured in the performance tests of QHashtable, which adds pseudo-random keys, searches for all of them and removes them
+class QHashtablePerformanceTestClass
+{
+public:
+
+    static const u32_q KEY_COUNT = 5000U;
+
+    QHashtablePerformanceTestClass(const pointer_uint_q uInitialBuckets) : m_uInitialBuckets(uInitialBuckets),
+                                                                           m_uChecksum(0)
+    {
+        // The keys are generated using a fixed seed so all the executions are comparable
+        u32_q uSeed = 12345U;
+
+        for(u32_q i = 0; i < KEY_COUNT; ++i)
+        {
+            uSeed = uSeed * 1103515245U + 12345U;
+            m_arKeys[i] = (uSeed >> 8U) * KEY_COUNT + i;
+        }
+    }
+
+    void operator()()
+    {
+        QHashtable<u32_q, u32_q> hashtable(m_uInitialBuckets, 2U);
+
+        for(u32_q i = 0; i < KEY_COUNT; ++i)
+            hashtable.Add(m_arKeys[i], i);
+
+        for(u32_q i = 0; i < KEY_COUNT; ++i)
+            m_uChecksum += hashtable.GetValue(m_arKeys[i]);
+
+        for(u32_q i = 0; i < KEY_COUNT; i += 2U)
+            hashtable.Remove(m_arKeys[i]);
+
+        m_uChecksum += hashtable.GetCount();
+    }
+
+    pointer_uint_q m_uInitialBuckets;
+    u64_q m_uChecksum;
+    u32_q m_arKeys[KEY_COUNT];
+};
+
+
+QTEST_SUITE_BEGIN( QHashtable_TestSuite )
+
+/// <summary>
+/// Compares the time spent adding, searching for and removing keys when the table has enough buckets with the time spent when it has to be rehashed.
+/// </summary>
+QTEST_CASE ( AddGetValueAndRemove_AreComparedWithAndWithoutRehashing_Test )
+{
+    // [Preparation]
+    QHashtablePerformanceTestClass rehashingTest(8U);
+    QHashtablePerformanceTestClass preallocatedTest(QHashtablePerformanceTestClass::KEY_COUNT);
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Add, GetValue and Remove, 5000 keys, growing from 8 buckets", rehashingTest);
+    QPerformanceMeasurement::Measure("Add, GetValue and Remove, 5000 keys, 5000 buckets", preallocatedTest);
+
+    // [Verification]
+    BOOST_CHECK(rehashingTest.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(rehashingTest.m_uChecksum, preallocatedTest.m_uChecksum);
+}
+
+// End - Test Suite: QHashtable
+QTEST_SUITE_END()
@@ -0,0 +1,95 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QList.h"
+
+#include "QArrayDynamic.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Functor measured in the performance tests of QList, which inserts elements at the beginning and in the middle of a container and traverses it
+template<class ContainerT>
+class QListPerformanceTestClass
+{
+public:
+
+    static const u32_q ELEMENT_COUNT = 2000U;
+
+    QListPerformanceTestClass() : m_uChecksum(0)
+    {
+    }
+
+    void operator()()
+    {
+        ContainerT elements(ELEMENT_COUNT);
+
+        for(u32_q i = 0; i < ELEMENT_COUNT / 2U; ++i)
+            elements.Add(i);
+
+        for(u32_q i = 0; i < ELEMENT_COUNT / 2U; ++i)
+            elements.Insert(i, elements.GetFirst());
+
+        for(typename ContainerT::ConstIterator it = elements.GetFirst(); !it.IsEnd(); ++it)
+            m_uChecksum += *it;
+    }
+
+    u64_q m_uChecksum;
+};
+
+
+QTEST_SUITE_BEGIN( QList_TestSuite )
+
+/// <summary>
+/// Compares the time spent inserting elements at the beginning of a list with the time spent doing the same in a dynamic array.
+/// </summary>
+QTEST_CASE ( Insert_IsComparedToDynamicArray_Test )
+{
+    // [Preparation]
+    QListPerformanceTestClass< QList<u32_q> > listTest;
+    QListPerformanceTestClass< QArrayDynamic<u32_q> > arrayTest;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("QList, Add and Insert at the beginning, 2000 elements", listTest);
+    QPerformanceMeasurement::Measure("QArrayDynamic, Add and Insert at the beginning, 2000 elements", arrayTest);
+
+    // [Verification]
+    BOOST_CHECK(listTest.m_uChecksum > 0);
+    BOOST_CHECK_EQUAL(listTest.m_uChecksum, arrayTest.m_uChecksum);
+}
+
+// End - Test Suite: QList
+QTEST_SUITE_END()
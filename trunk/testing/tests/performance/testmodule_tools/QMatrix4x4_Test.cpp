@@ -0,0 +1,152 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QMatrix4x4.h"
+
+#include "SQFloat.h"
+
+using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x4;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Base class of the functors measured in the performance tests of QMatrix4x4, which stores a set of invertible matrices
+class QMatrix4x4PerformanceTestClass
+{
+public:
+
+    static const unsigned int MATRIX_COUNT = 1000U;
+
+    QMatrix4x4PerformanceTestClass() : m_fChecksum(SQFloat::_0)
+    {
+        for(unsigned int i = 0; i < MATRIX_COUNT; ++i)
+        {
+            const float_q VALUE = scast_q(i % 17U, float_q);
+            m_arMatrices[i] = QMatrix4x4(SQFloat::_2 + VALUE, SQFloat::_1,            SQFloat::_0,            SQFloat::_0,
+                                         SQFloat::_0,         SQFloat::_3,            VALUE,                  SQFloat::_0,
+                                         SQFloat::_1,         SQFloat::_0,            SQFloat::_4 + VALUE,    SQFloat::_0,
+                                         VALUE,               SQFloat::_2,            SQFloat::_1,            SQFloat::_1);
+        }
+    }
+
+    QMatrix4x4 m_arMatrices[MATRIX_COUNT];
+    float_q m_fChecksum;
+};
+
+// Multiplies every matrix by the next one
+class QMatrix4x4ProductPerformanceTestClass : public QMatrix4x4PerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < MATRIX_COUNT - 1U; ++i)
+            m_fChecksum += (m_arMatrices[i] * m_arMatrices[i + 1U]).ij[3][3];
+    }
+};
+
+// Inverts every matrix
+class QMatrix4x4InvertPerformanceTestClass : public QMatrix4x4PerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < MATRIX_COUNT; ++i)
+            m_fChecksum += m_arMatrices[i].Invert().ij[0][0];
+    }
+};
+
+// Calculates the determinant of every matrix
+class QMatrix4x4DeterminantPerformanceTestClass : public QMatrix4x4PerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < MATRIX_COUNT; ++i)
+            m_fChecksum += m_arMatrices[i].GetDeterminant();
+    }
+};
+
+
+QTEST_SUITE_BEGIN( QMatrix4x4_TestSuite )
+
+/// <summary>
+/// Measures the time spent multiplying matrices.
+/// </summary>
+QTEST_CASE ( OperatorProduct_IsMeasured_Test )
+{
+    // [Preparation]
+    QMatrix4x4ProductPerformanceTestClass test;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("operator*, 999 products", test);
+
+    // [Verification]
+    BOOST_CHECK(test.m_fChecksum != SQFloat::_0);
+}
+
+/// <summary>
+/// Measures the time spent inverting matrices.
+/// </summary>
+QTEST_CASE ( Invert_IsMeasured_Test )
+{
+    // [Preparation]
+    QMatrix4x4InvertPerformanceTestClass test;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Invert, 1000 matrices", test);
+
+    // [Verification]
+    BOOST_CHECK(test.m_fChecksum != SQFloat::_0);
+}
+
+/// <summary>
+/// Measures the time spent calculating determinants.
+/// </summary>
+QTEST_CASE ( GetDeterminant_IsMeasured_Test )
+{
+    // [Preparation]
+    QMatrix4x4DeterminantPerformanceTestClass test;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("GetDeterminant, 1000 matrices", test);
+
+    // [Verification]
+    BOOST_CHECK(test.m_fChecksum != SQFloat::_0);
+}
+
+// End - Test Suite: QMatrix4x4
+QTEST_SUITE_END()
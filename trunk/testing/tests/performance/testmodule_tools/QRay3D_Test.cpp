@@ -0,0 +1,247 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QRay3D.h"
+
+#include "QSoAPointBuffer.h"
+#include "SQFloat.h"
+
+using Kinesis::QuimeraEngine::Tools::Math::QRay3D;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Tools::Math::QSoAPointBuffer;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Base class of the functors measured in the performance tests of QRay3D, which stores a grid of triangles in the plane Z = 0,
+// both as an array and as a structure of arrays, and a set of rays that point to it
+class QRay3DPerformanceTestClass
+{
+public:
+
+    static const unsigned int TRIANGLE_COUNT = 4096U;
+    static const unsigned int RAY_COUNT = 4096U;
+    static const unsigned int GRID_WIDTH = 64U;
+
+    QRay3DPerformanceTestClass() : m_verticesA(TRIANGLE_COUNT),
+                                   m_verticesB(TRIANGLE_COUNT),
+                                   m_verticesC(TRIANGLE_COUNT),
+                                   m_uIntersections(0)
+    {
+        for(unsigned int i = 0; i < TRIANGLE_COUNT; ++i)
+        {
+            const float_q X = scast_q(i % GRID_WIDTH, float_q);
+            const float_q Y = scast_q(i / GRID_WIDTH, float_q);
+            const QVector3 VERTEX_A(X, Y, SQFloat::_0);
+            const QVector3 VERTEX_B(X + SQFloat::_1, Y, SQFloat::_0);
+            const QVector3 VERTEX_C(X, Y + SQFloat::_1, SQFloat::_0);
+
+            m_arTriangles[i] = QBaseTriangle<QVector3>(VERTEX_A, VERTEX_B, VERTEX_C);
+            m_verticesA.SetPoint(i, VERTEX_A);
+            m_verticesB.SetPoint(i, VERTEX_B);
+            m_verticesC.SetPoint(i, VERTEX_C);
+        }
+
+        // Half of the rays hit the triangle used when testing many rays
+        for(unsigned int i = 0; i < RAY_COUNT; ++i)
+        {
+            const float_q OFFSET = scast_q(i % 32U, float_q) / scast_q(32U, float_q);
+            m_arRays[i] = QRay3D<QVector3>(QVector3(OFFSET, SQFloat::_0_25, SQFloat::_5), QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_1));
+        }
+    }
+
+    QBaseTriangle<QVector3> m_arTriangles[TRIANGLE_COUNT];
+    QSoAPointBuffer m_verticesA;
+    QSoAPointBuffer m_verticesB;
+    QSoAPointBuffer m_verticesC;
+    QRay3D<QVector3> m_arRays[RAY_COUNT];
+    float_q m_arDistances[TRIANGLE_COUNT];
+    float_q m_arU[TRIANGLE_COUNT];
+    float_q m_arV[TRIANGLE_COUNT];
+    unsigned int m_uIntersections;
+};
+
+// Checks one ray against every triangle by means of the plane that contains the triangle
+class QRay3DTrianglesThroughPlanePerformanceTestClass : public QRay3DPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < TRIANGLE_COUNT; ++i)
+            m_uIntersections += m_arRays[0].Intersection(m_arTriangles[i]) ? 1U : 0;
+    }
+};
+
+// Checks one ray against every triangle, obtaining the distance and the barycentric coordinates
+class QRay3DTrianglesWithDistancePerformanceTestClass : public QRay3DPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < TRIANGLE_COUNT; ++i)
+            m_uIntersections += m_arRays[0].Intersection(m_arTriangles[i], m_arDistances[i], m_arU[i], m_arV[i]) ? 1U : 0;
+    }
+};
+
+// Checks one ray against every triangle, stored as a structure of arrays
+class QRay3DTrianglesSoAPerformanceTestClass : public QRay3DPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        m_uIntersections += m_arRays[0].Intersection(m_verticesA, m_verticesB, m_verticesC, m_arDistances, m_arU, m_arV);
+    }
+};
+
+// Checks every ray against one triangle, one by one
+class QRay3DRaysWithDistancePerformanceTestClass : public QRay3DPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < RAY_COUNT; ++i)
+            m_uIntersections += m_arRays[i].Intersection(m_arTriangles[0], m_arDistances[i], m_arU[i], m_arV[i]) ? 1U : 0;
+    }
+};
+
+// Checks every ray against one triangle, in packets
+class QRay3DRaysInPacketsPerformanceTestClass : public QRay3DPerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        m_uIntersections += QRay3D<QVector3>::Intersection(m_arRays, RAY_COUNT, m_arTriangles[0], m_arDistances, m_arU, m_arV);
+    }
+};
+
+
+QTEST_SUITE_BEGIN( QRay3D_TestSuite )
+
+/// <summary>
+/// Measures the time spent checking the intersection of a ray with many triangles using the plane that contains every triangle.
+/// </summary>
+QTEST_CASE ( Intersection_IsMeasuredWhenUsingTrianglePlanes_Test )
+{
+    // [Preparation]
+    QRay3DTrianglesThroughPlanePerformanceTestClass* pTest = new QRay3DTrianglesThroughPlanePerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Intersection through planes, 1 ray x 4096 triangles", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uIntersections != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+/// <summary>
+/// Measures the time spent checking the intersection of a ray with many triangles, obtaining distances and barycentric coordinates.
+/// </summary>
+QTEST_CASE ( Intersection_IsMeasuredWhenObtainingDistanceOfEveryTriangle_Test )
+{
+    // [Preparation]
+    QRay3DTrianglesWithDistancePerformanceTestClass* pTest = new QRay3DTrianglesWithDistancePerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Intersection with distance, 1 ray x 4096 triangles", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uIntersections != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+/// <summary>
+/// Measures the time spent checking the intersection of a ray with many triangles stored as a structure of arrays.
+/// </summary>
+QTEST_CASE ( Intersection_IsMeasuredWhenTrianglesAreStoredAsStructureOfArrays_Test )
+{
+    // [Preparation]
+    QRay3DTrianglesSoAPerformanceTestClass* pTest = new QRay3DTrianglesSoAPerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Intersection with structure of arrays, 1 ray x 4096 triangles", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uIntersections != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+/// <summary>
+/// Measures the time spent checking the intersection of many rays with a triangle, one by one.
+/// </summary>
+QTEST_CASE ( Intersection_IsMeasuredWhenCheckingRaysOneByOne_Test )
+{
+    // [Preparation]
+    QRay3DRaysWithDistancePerformanceTestClass* pTest = new QRay3DRaysWithDistancePerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Intersection with distance, 4096 rays x 1 triangle", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uIntersections != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+/// <summary>
+/// Measures the time spent checking the intersection of many rays with a triangle, in packets.
+/// </summary>
+QTEST_CASE ( Intersection_IsMeasuredWhenCheckingRaysInPackets_Test )
+{
+    // [Preparation]
+    QRay3DRaysInPacketsPerformanceTestClass* pTest = new QRay3DRaysInPacketsPerformanceTestClass();
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Intersection in packets, 4096 rays x 1 triangle", *pTest);
+
+    // [Verification]
+    BOOST_CHECK(pTest->m_uIntersections != 0);
+
+    // [Cleaning]
+    delete pTest;
+}
+
+// End - Test Suite: QRay3D
+QTEST_SUITE_END()
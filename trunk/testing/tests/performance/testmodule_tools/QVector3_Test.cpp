@@ -0,0 +1,133 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+#include "../../testsystem/QPerformanceMeasurement.h"
+
+#include "QVector3.h"
+
+#include "QQuaternion.h"
+#include "SQFloat.h"
+
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Tools::Math::QQuaternion;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
+
+// Base class of the functors measured in the performance tests of QVector3, which stores a set of vectors
+class QVector3PerformanceTestClass
+{
+public:
+
+    static const unsigned int VECTOR_COUNT = 4096U;
+
+    QVector3PerformanceTestClass() : m_fChecksum(SQFloat::_0)
+    {
+        for(unsigned int i = 0; i < VECTOR_COUNT; ++i)
+        {
+            const float_q VALUE = scast_q(i, float_q);
+            m_arVectors[i] = QVector3(VALUE, SQFloat::_1 - VALUE, SQFloat::_2 + VALUE * SQFloat::_0_5);
+        }
+    }
+
+    QVector3 m_arVectors[VECTOR_COUNT];
+    float_q m_fChecksum;
+};
+
+// Normalizes every vector and calculates the dot and cross products with the next one
+class QVector3ProductsPerformanceTestClass : public QVector3PerformanceTestClass
+{
+public:
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < VECTOR_COUNT - 1U; ++i)
+        {
+            const QVector3 NORMALIZED = m_arVectors[i].Normalize();
+            m_fChecksum += NORMALIZED.DotProduct(m_arVectors[i + 1U]) + NORMALIZED.CrossProduct(m_arVectors[i + 1U]).x;
+        }
+    }
+};
+
+// Rotates every vector using a quaternion
+class QVector3TransformPerformanceTestClass : public QVector3PerformanceTestClass
+{
+public:
+
+    QVector3TransformPerformanceTestClass() : m_rotation(SQFloat::_0_25, SQFloat::_0_5, SQFloat::_1)
+    {
+    }
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < VECTOR_COUNT; ++i)
+            m_fChecksum += m_arVectors[i].Transform(m_rotation).y;
+    }
+
+    QQuaternion m_rotation;
+};
+
+
+QTEST_SUITE_BEGIN( QVector3_TestSuite )
+
+/// <summary>
+/// Measures the time spent normalizing vectors and calculating dot and cross products.
+/// </summary>
+QTEST_CASE ( NormalizeDotProductAndCrossProduct_AreMeasured_Test )
+{
+    // [Preparation]
+    QVector3ProductsPerformanceTestClass test;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Normalize, DotProduct and CrossProduct, 4095 vectors", test);
+
+    // [Verification]
+    BOOST_CHECK(test.m_fChecksum != SQFloat::_0);
+}
+
+/// <summary>
+/// Measures the time spent rotating vectors using a quaternion.
+/// </summary>
+QTEST_CASE ( Transform_IsMeasuredWhenUsingQuaternion_Test )
+{
+    // [Preparation]
+    QVector3TransformPerformanceTestClass test;
+
+	// [Execution]
+    QPerformanceMeasurement::Measure("Transform with quaternion, 4096 vectors", test);
+
+    // [Verification]
+    BOOST_CHECK(test.m_fChecksum != SQFloat::_0);
+}
+
+// End - Test Suite: QVector3
+QTEST_SUITE_END()
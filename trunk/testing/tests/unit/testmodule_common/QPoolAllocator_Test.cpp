@@ -1321,6 +1321,103 @@ QTEST_CASE( Reallocate2_AssertionFailsWhenInputBufferIsNull_Test )
 
 #endif
 
+/// <summary>
+/// Checks that the allocated blocks and the sizes of both allocators are exchanged, without copying the blocks.
+/// </summary>
+QTEST_CASE( Swap_AllocatedBlocksAndSizesAreExchanged_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(int);
+    const pointer_uint_q BLOCKS_COUNT_A = 4;
+    const pointer_uint_q BLOCKS_COUNT_B = 8;
+    QPoolAllocator allocatorA(BLOCKS_COUNT_A * BLOCK_SIZE, BLOCK_SIZE, QAlignment(alignof_q(int)));
+    QPoolAllocator allocatorB(BLOCKS_COUNT_B * BLOCK_SIZE, BLOCK_SIZE, QAlignment(alignof_q(int)));
+    *(int*)allocatorA.Allocate() = 1;
+    *(int*)allocatorA.Allocate() = 2;
+    *(int*)allocatorB.Allocate() = 3;
+
+    void* EXPECTED_POINTER_A = allocatorB.GetPointer();
+    void* EXPECTED_POINTER_B = allocatorA.GetPointer();
+    const pointer_uint_q EXPECTED_POOL_SIZE_A = allocatorB.GetPoolSize();
+    const pointer_uint_q EXPECTED_POOL_SIZE_B = allocatorA.GetPoolSize();
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES_A = allocatorB.GetAllocatedBytes();
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES_B = allocatorA.GetAllocatedBytes();
+
+    // [Execution]
+    allocatorA.Swap(allocatorB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocatorA.GetPointer(), EXPECTED_POINTER_A);
+    BOOST_CHECK_EQUAL(allocatorB.GetPointer(), EXPECTED_POINTER_B);
+    BOOST_CHECK_EQUAL(allocatorA.GetPoolSize(), EXPECTED_POOL_SIZE_A);
+    BOOST_CHECK_EQUAL(allocatorB.GetPoolSize(), EXPECTED_POOL_SIZE_B);
+    BOOST_CHECK_EQUAL(allocatorA.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES_A);
+    BOOST_CHECK_EQUAL(allocatorB.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES_B);
+    BOOST_CHECK_EQUAL(*(int*)allocatorA.GetPointer(), 3);
+    BOOST_CHECK_EQUAL(*((int*)allocatorB.GetPointer() + 1), 2);
+}
+
+/// <summary>
+/// Checks that every allocator keeps allocating blocks from the list of free blocks it received.
+/// </summary>
+QTEST_CASE( Swap_AllocationsAreDoneInTheReceivedBlocks_Test )
+{
+    // [Preparation]
+    void* NULL_POINTER = null_q;
+    const pointer_uint_q BLOCK_SIZE = sizeof(int);
+    const pointer_uint_q BLOCKS_COUNT_A = 2;
+    const pointer_uint_q BLOCKS_COUNT_B = 3;
+    QPoolAllocator allocatorA(BLOCKS_COUNT_A * BLOCK_SIZE, BLOCK_SIZE, QAlignment(alignof_q(int)));
+    QPoolAllocator allocatorB(BLOCKS_COUNT_B * BLOCK_SIZE, BLOCK_SIZE, QAlignment(alignof_q(int)));
+    allocatorA.Allocate();
+    allocatorA.Allocate();
+    allocatorB.Allocate();
+
+    // [Execution]
+    allocatorA.Swap(allocatorB);
+
+    // [Verification]
+    void* pAllocationA1 = allocatorA.Allocate();
+    void* pAllocationA2 = allocatorA.Allocate();
+    void* pAllocationA3 = allocatorA.Allocate();
+    void* pAllocationB = allocatorB.Allocate();
+
+    BOOST_CHECK_EQUAL(pAllocationA1, (void*)((int*)allocatorA.GetPointer() + 1));
+    BOOST_CHECK_EQUAL(pAllocationA2, (void*)((int*)allocatorA.GetPointer() + 2));
+    BOOST_CHECK_EQUAL(pAllocationA3, NULL_POINTER);
+    BOOST_CHECK_EQUAL(pAllocationB, NULL_POINTER);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input allocator is the resident allocator.
+/// </summary>
+QTEST_CASE( Swap_AssertionFailsWhenInputAllocatorIsResidentAllocator_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const pointer_uint_q BLOCK_SIZE = sizeof(int);
+    QPoolAllocator allocator(BLOCK_SIZE * 4U, BLOCK_SIZE, QAlignment(alignof_q(int)));
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Swap(allocator);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
 
 // End - Test Suite: QPoolAllocator
 QTEST_SUITE_END()
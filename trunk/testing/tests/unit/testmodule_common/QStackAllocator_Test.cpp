@@ -1344,6 +1344,32 @@ QTEST_CASE ( Deallocate1_DeallocationsWorkWellWhenSomeAllocationsWhereAdjustedTo
     BOOST_CHECK_EQUAL(pTopBeforeDeallocation, pTopAfterDeallocation);
 }
 
+/// <summary>
+/// Checks that consecutive deallocations release the blocks in the reverse order of their allocation.
+/// </summary>
+QTEST_CASE ( Deallocate1_ConsecutiveDeallocationsReleaseBlocksInReverseOrder_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_SIZE = 4U;
+    const QAlignment INPUT_ALIGNMENT(4U);
+    QStackAllocator allocator(128U, QAlignment(4U));
+    allocator.Allocate(INPUT_SIZE, INPUT_ALIGNMENT);
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = allocator.GetAllocatedBytes();
+    void* pExpectedTop = allocator.GetMark().GetMemoryAddress();
+    allocator.Allocate(INPUT_SIZE, INPUT_ALIGNMENT);
+    allocator.Allocate(INPUT_SIZE, INPUT_ALIGNMENT);
+
+    // [Execution]
+    allocator.Deallocate();
+    allocator.Deallocate();
+
+    // [Verification]
+    pointer_uint_q uAllocatedBytes = allocator.GetAllocatedBytes();
+    void* pTop = allocator.GetMark().GetMemoryAddress();
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(pTop, pExpectedTop);
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
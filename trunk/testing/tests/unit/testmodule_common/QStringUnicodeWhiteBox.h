@@ -0,0 +1,75 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QSTRINGUNICODEWHITEBOX__
+#define __QSTRINGUNICODEWHITEBOX__
+
+#include "QStringUnicode.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::QStringUnicode;
+using Kinesis::QuimeraEngine::Common::DataTypes::EQTextEncoding;
+using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+namespace Test
+{
+
+/// <summary>
+/// Class to be used to expose protected methods of QStringUnicode for testing purposes.
+/// </summary>
+class QStringUnicodeWhiteBox : public QStringUnicode
+{
+    // METHODS
+    // ---------------
+public:
+
+    // Exposed method.
+    static UConverter* GetConverter(const EQTextEncoding &eEncoding)
+    {
+        return QStringUnicode::_GetConverter(eEncoding);
+    }
+
+    // Exposed method.
+    static const icu::Collator* GetCollator(const EQComparisonType &eComparisonType)
+    {
+        return QStringUnicode::_GetCollator(eComparisonType);
+    }
+};
+
+} //namespace Test
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QSTRINGUNICODEWHITEBOX__
@@ -28,6 +28,7 @@
 #include <boost/test/unit_test_log.hpp>
 using namespace boost::unit_test;
 #include <boost/mpl/list.hpp>
+#include <boost/thread.hpp>
 
 #include "../../testsystem/TestingExternalDefinitions.h"
 
@@ -42,6 +43,7 @@ using namespace boost::unit_test;
 #include "EQNormalizationForm.h"
 #include "AllocationOperators.h"
 #include "QAssertException.h"
+#include "QStringUnicodeWhiteBox.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Common::DataTypes::QStringUnicode;
@@ -63,6 +65,64 @@ typedef boost::mpl::list<i8_q, i16_q, i32_q, i64_q> TQTemplateSignedTypes;
 typedef boost::mpl::list<u8_q, u16_q, u32_q, u64_q> TQTemplateUnsignedTypes;
 typedef boost::mpl::list<u8_q, u16_q, u32_q, u64_q> TQTemplateUnsignedTypes;
 
+// The ICU objects used by a thread and whether all the results it obtained with them were correct
+struct QStringUnicode_ICUObjectsUsage
+{
+    const void* m_pConverter;
+    const void* m_pCollator;
+    bool m_bResultsAreCorrect;
+};
+
+// Converts and compares strings several times, then stores the ICU objects it used and waits for the other threads to do the same
+class QStringUnicode_ICUObjectsUser
+{
+public:
+
+    QStringUnicode_ICUObjectsUser(QStringUnicode_ICUObjectsUsage &usage, boost::barrier &allThreadsUsedICUObjects) : m_usage(usage),
+                                                                                                                     m_allThreadsUsedICUObjects(allThreadsUsedICUObjects)
+    {
+    }
+
+    void operator()()
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+        using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+        using Kinesis::QuimeraEngine::Common::DataTypes::Test::QStringUnicodeWhiteBox;
+
+        const unsigned int REPETITIONS = 500U;
+        //                                         N    i     ñ                 o
+        const i8_q ISO88591_BYTES[]            = { 'N', 'i', scast_q(0xF1, i8_q), 'o', 0 };
+        const i8_q EXPECTED_UTF8_BYTES[]       = { 'N', 'i', scast_q(0xC3, i8_q), scast_q(0xB1, i8_q), 'o', 0 };
+        //                                         N    I     Ñ                 O
+        const i8_q UPPERCASE_ISO88591_BYTES[]  = { 'N', 'I', scast_q(0xD1, i8_q), 'O', 0 };
+        const QStringUnicode UPPERCASE_STRING(UPPERCASE_ISO88591_BYTES, sizeof(UPPERCASE_ISO88591_BYTES), EQTextEncoding::E_ISO88591);
+
+        bool bResultsAreCorrect = true;
+
+        for(unsigned int i = 0; i < REPETITIONS; ++i)
+        {
+            QStringUnicode strDecoded(ISO88591_BYTES, sizeof(ISO88591_BYTES), EQTextEncoding::E_ISO88591);
+            QArrayResult<i8_q> arUTF8Bytes = strDecoded.ToBytes(EQTextEncoding::E_UTF8);
+
+            bResultsAreCorrect = bResultsAreCorrect && 
+                                 arUTF8Bytes.GetCount() == sizeof(EXPECTED_UTF8_BYTES) && 
+                                 memcmp(arUTF8Bytes.Get(), EXPECTED_UTF8_BYTES, sizeof(EXPECTED_UTF8_BYTES)) == 0 &&
+                                 strDecoded.CompareTo(UPPERCASE_STRING, EQComparisonType::E_CanonicalCaseInsensitive) == 0 && 
+                                 strDecoded.CompareTo(UPPERCASE_STRING, EQComparisonType::E_CanonicalCaseSensitive) != 0;
+        }
+
+        m_usage.m_pConverter = QStringUnicodeWhiteBox::GetConverter(EQTextEncoding::E_UTF8);
+        m_usage.m_pCollator = QStringUnicodeWhiteBox::GetCollator(EQComparisonType::E_CanonicalCaseInsensitive);
+        m_usage.m_bResultsAreCorrect = bResultsAreCorrect;
+
+        // No thread ends before the others have stored their objects, so the objects of a thread cannot be reused by another
+        m_allThreadsUsedICUObjects.wait();
+    }
+
+    QStringUnicode_ICUObjectsUsage &m_usage;
+    boost::barrier &m_allThreadsUsedICUObjects;
+};
+
 
 QTEST_SUITE_BEGIN( QStringUnicode_TestSuite )
 
@@ -1592,6 +1652,62 @@ QTEST_CASE ( OperatorArraySubscript_ReturnsExpectedResultWhenUsingSMPCharacters_
     BOOST_CHECK(character2 == EXPECTED_RESULT2);
 }
 
+/// <summary>
+/// Checks that it returns the expected result when the string is long and contains characters from the Supplementaty Multilingual Plane (SMP) at several positions.
+/// </summary>
+QTEST_CASE ( OperatorArraySubscript_ReturnsExpectedResultWhenUsingLongStringWithSMPCharacters_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::QCharUnicode;
+
+    // [Preparation]
+    const unsigned int CHARACTERS_COUNT = 200U;
+    const unsigned int SMP_CHARACTER_INTERVAL = 7U;
+    QStringUnicode SOURCE_STRING;
+
+    for(unsigned int i = 0; i < CHARACTERS_COUNT; ++i)
+        SOURCE_STRING.Append(i % SMP_CHARACTER_INTERVAL == 0 ? QCharUnicode(0x00010300 + i) : QCharUnicode('A' + i % 26U));
+
+    bool bAllCharactersAreCorrect = true;
+
+	// [Execution]
+    for(unsigned int i = 0; i < CHARACTERS_COUNT && bAllCharactersAreCorrect; ++i)
+    {
+        const QCharUnicode EXPECTED_CHARACTER = i % SMP_CHARACTER_INTERVAL == 0 ? QCharUnicode(0x00010300 + i) : QCharUnicode('A' + i % 26U);
+        bAllCharactersAreCorrect = SOURCE_STRING[i] == EXPECTED_CHARACTER;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAllCharactersAreCorrect);
+}
+
+/// <summary>
+/// Checks that it returns the expected result when the string, which contains characters from the Supplementaty Multilingual Plane (SMP), is modified after accessing it.
+/// </summary>
+QTEST_CASE ( OperatorArraySubscript_ReturnsExpectedResultWhenLongStringWithSMPCharactersIsModified_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::QCharUnicode;
+
+    // [Preparation]
+    QStringUnicode SOURCE_STRING;
+    SOURCE_STRING.Append(QCharUnicode(0x00010300));
+
+    for(unsigned int i = 0; i < 100U; ++i)
+        SOURCE_STRING.Append("AB");
+
+    const unsigned int POSITION = 60U;
+    const QCharUnicode EXPECTED_RESULT_BEFORE('B');
+    const QCharUnicode EXPECTED_RESULT_AFTER(0x00010300);
+    QCharUnicode characterBefore = SOURCE_STRING[POSITION];
+
+	// [Execution]
+    SOURCE_STRING.Replace("B", QStringUnicode(QCharUnicode(0x00010300)));
+    QCharUnicode characterAfter = SOURCE_STRING[POSITION];
+
+    // [Verification]
+    BOOST_CHECK(characterBefore == EXPECTED_RESULT_BEFORE);
+    BOOST_CHECK(characterAfter == EXPECTED_RESULT_AFTER);
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_DISABLED
 
 /// <summary>
@@ -4424,6 +4540,34 @@ QTEST_CASE ( IndexOf1_ReturnsExpectedResultWhenUsingSMPCharacters_Test )
     BOOST_CHECK_EQUAL(uPosition2, EXPECTED_POSITION2);
 }
 
+/// <summary>
+/// Checks that it returns the expected result when the string is long and contains characters from the Supplementaty Multilingual Plane (SMP) at several positions.
+/// </summary>
+QTEST_CASE ( IndexOf1_ReturnsExpectedResultWhenUsingLongStringWithSMPCharacters_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::QCharUnicode;
+    using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+
+    // [Preparation]
+    QStringUnicode SOURCE_STRING;
+
+    for(unsigned int i = 0; i < 100U; ++i)
+    {
+        SOURCE_STRING.Append(QCharUnicode(0x00010300));
+        SOURCE_STRING.Append("A");
+    }
+
+    SOURCE_STRING.Append("PATTERN");
+    const QStringUnicode PATTERN("PATTERN");
+    const int EXPECTED_POSITION = 200;
+
+	// [Execution]
+    int nPosition = SOURCE_STRING.IndexOf(PATTERN, EQComparisonType::E_BinaryCaseSensitive);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(nPosition, EXPECTED_POSITION);
+}
+
 /// <summary>
 /// Checks that it returns "not found" when the pattern is empty.
 /// </summary>
@@ -9443,12 +9587,50 @@ QTEST_CASE ( ToCaseFolded_EmptyStringConvertedToFoldedCase_Test )
     const QStringUnicode EXPECTED_RESULT("");
     QStringUnicode INPUT_STRING("");
 
-	// [Execution]
+    // [Execution]
     QStringUnicode strResult = INPUT_STRING.ToCaseFolded();
 
     // [Verification]
     BOOST_CHECK(strResult == EXPECTED_RESULT);
 }
 
+/// <summary>
+/// Checks that several threads can convert and compare strings at the same time, every one of them using its own converters and collators.
+/// </summary>
+QTEST_CASE ( ICUObjects_EveryThreadUsesItsOwnConvertersAndCollatorsWhenSeveralThreadsUseStringsAtTheSameTime_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+    using Kinesis::QuimeraEngine::Common::DataTypes::Test::QStringUnicodeWhiteBox;
+
+    // [Preparation]
+    const unsigned int THREAD_COUNT = 4U;
+    const void* MAIN_THREAD_CONVERTER = QStringUnicodeWhiteBox::GetConverter(EQTextEncoding::E_UTF8);
+    const void* MAIN_THREAD_COLLATOR = QStringUnicodeWhiteBox::GetCollator(EQComparisonType::E_CanonicalCaseInsensitive);
+    QStringUnicode_ICUObjectsUsage arUsages[THREAD_COUNT];
+    boost::barrier allThreadsUsedICUObjects(THREAD_COUNT);
+
+    // [Execution]
+    boost::thread_group threads;
+
+    for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+        threads.create_thread(QStringUnicode_ICUObjectsUser(arUsages[i], allThreadsUsedICUObjects));
+
+    threads.join_all();
+
+    // [Verification]
+    for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+    {
+        BOOST_CHECK(arUsages[i].m_bResultsAreCorrect);
+        BOOST_CHECK(arUsages[i].m_pConverter != MAIN_THREAD_CONVERTER);
+        BOOST_CHECK(arUsages[i].m_pCollator != MAIN_THREAD_COLLATOR);
+
+        for(unsigned int j = i + 1U; j < THREAD_COUNT; ++j)
+        {
+            BOOST_CHECK(arUsages[i].m_pConverter != arUsages[j].m_pConverter);
+            BOOST_CHECK(arUsages[i].m_pCollator != arUsages[j].m_pCollator);
+        }
+    }
+}
+
 // End - Test Suite: QStringUnicode
 QTEST_SUITE_END()
@@ -36,6 +36,8 @@ using Kinesis::QuimeraEngine::Common::DataTypes::SQVF32;
 using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
 using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::f32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
 
 QTEST_SUITE_BEGIN( SQVF32_TestSuite )
 
@@ -83,5 +85,750 @@ QTEST_CASE ( Unpack_NotTested_Test )
     BOOST_MESSAGE(QE_L("It's not a testable method: no inputs, no outputs, just executes a method of a component."));
 }
 
+/// <summary>
+/// Checks that every component is set to the input value.
+/// </summary>
+QTEST_CASE ( Fill_AllComponentsAreSetToTheValue_Test )
+{
+    // [Preparation]
+    const float_q EXPECTED_VALUE = SQFloat::_5;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Fill(EXPECTED_VALUE);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that values are loaded in the same order they are stored in memory.
+/// </summary>
+QTEST_CASE ( Load_ValuesAreLoadedInTheRightOrder_Test )
+{
+    // [Preparation]
+    const f32_q INPUT_VALUES[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_2;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_4;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_5;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Load(&INPUT_VALUES[1]); // Unaligned address
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that values are loaded in the same order they are stored in memory.
+/// </summary>
+QTEST_CASE ( LoadAligned_ValuesAreLoadedInTheRightOrder_Test )
+{
+    // [Preparation]
+    vf32_q alignedStorage;
+    f32_q* arAlignedValues = rcast_q(&alignedStorage, f32_q*);
+    arAlignedValues[0] = 1.0f;
+    arAlignedValues[1] = 2.0f;
+    arAlignedValues[2] = 3.0f;
+    arAlignedValues[3] = 4.0f;
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_1;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_2;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_4;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::LoadAligned(arAlignedValues);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that components are stored in memory in the right order.
+/// </summary>
+QTEST_CASE ( Store_ComponentsAreStoredInTheRightOrder_Test )
+{
+    // [Preparation]
+    const f32_q EXPECTED_VALUES[] = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f };
+    vf32_q vectorUT;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vectorUT);
+    f32_q arOutput[] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+	// [Execution]
+    SQVF32::Store(vectorUT, &arOutput[1]); // Unaligned address
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arOutput[0], EXPECTED_VALUES[0]);
+    BOOST_CHECK_EQUAL(arOutput[1], EXPECTED_VALUES[1]);
+    BOOST_CHECK_EQUAL(arOutput[2], EXPECTED_VALUES[2]);
+    BOOST_CHECK_EQUAL(arOutput[3], EXPECTED_VALUES[3]);
+    BOOST_CHECK_EQUAL(arOutput[4], EXPECTED_VALUES[4]);
+}
+
+/// <summary>
+/// Checks that components are stored in memory in the right order.
+/// </summary>
+QTEST_CASE ( StoreAligned_ComponentsAreStoredInTheRightOrder_Test )
+{
+    // [Preparation]
+    const f32_q EXPECTED_VALUES[] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    vf32_q vectorUT;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vectorUT);
+    vf32_q alignedStorage;
+    f32_q* arAlignedOutput = rcast_q(&alignedStorage, f32_q*);
+
+	// [Execution]
+    SQVF32::StoreAligned(vectorUT, arAlignedOutput);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arAlignedOutput[0], EXPECTED_VALUES[0]);
+    BOOST_CHECK_EQUAL(arAlignedOutput[1], EXPECTED_VALUES[1]);
+    BOOST_CHECK_EQUAL(arAlignedOutput[2], EXPECTED_VALUES[2]);
+    BOOST_CHECK_EQUAL(arAlignedOutput[3], EXPECTED_VALUES[3]);
+}
+
+/// <summary>
+/// Checks that three values are loaded in the same order they are stored in memory and the fourth component is zero.
+/// </summary>
+QTEST_CASE ( Load3_ValuesAreLoadedInTheRightOrderAndFourthComponentIsZero_Test )
+{
+    // [Preparation]
+    const f32_q INPUT_VALUES[] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_2;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_4;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_0;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Load3(&INPUT_VALUES[1]); // The last 3 values of the array
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that only the first three components are stored in memory, in the right order.
+/// </summary>
+QTEST_CASE ( Store3_OnlyTheFirstThreeComponentsAreStored_Test )
+{
+    // [Preparation]
+    const f32_q EXPECTED_VALUES[] = { 0.0f, 1.0f, 2.0f, 3.0f, 0.0f };
+    vf32_q vectorUT;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vectorUT);
+    f32_q arOutput[] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+	// [Execution]
+    SQVF32::Store3(vectorUT, &arOutput[1]);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arOutput[0], EXPECTED_VALUES[0]);
+    BOOST_CHECK_EQUAL(arOutput[1], EXPECTED_VALUES[1]);
+    BOOST_CHECK_EQUAL(arOutput[2], EXPECTED_VALUES[2]);
+    BOOST_CHECK_EQUAL(arOutput[3], EXPECTED_VALUES[3]);
+    BOOST_CHECK_EQUAL(arOutput[4], EXPECTED_VALUES[4]);
+}
+
+/// <summary>
+/// Checks that components are added one by one.
+/// </summary>
+QTEST_CASE ( Add_ComponentsAreAddedOneByOne_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_4, SQFloat::_5, SQFloat::_6, SQFloat::_7, vf2);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_5;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_7;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_9;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = (float_q)11.0;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Add(vf1, vf2);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that components are subtracted one by one.
+/// </summary>
+QTEST_CASE ( Subtract_ComponentsAreSubtractedOneByOne_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_4, SQFloat::_5, SQFloat::_6, SQFloat::_7, vf1);
+    SQVF32::Pack(SQFloat::_1, SQFloat::_3, SQFloat::_5, SQFloat::_7, vf2);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_2;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_1;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_0;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Subtract(vf1, vf2);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that components are multiplied one by one.
+/// </summary>
+QTEST_CASE ( Multiply_ComponentsAreMultipliedOneByOne_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_2, SQFloat::_3, SQFloat::_0_5, SQFloat::_0, vf2);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_2;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_6;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = (float_q)1.5;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_0;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Multiply(vf1, vf2);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that components are divided one by one.
+/// </summary>
+QTEST_CASE ( Divide_ComponentsAreDividedOneByOne_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_2, SQFloat::_6, SQFloat::_3, SQFloat::_0, vf1);
+    SQVF32::Pack(SQFloat::_2, SQFloat::_3, SQFloat::_2, SQFloat::_1, vf2);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_1;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_2;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = (float_q)1.5;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_0;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Divide(vf1, vf2);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that the product of the two first operands is added to the third one.
+/// </summary>
+QTEST_CASE ( MultiplyAdd_ProductIsAddedToThirdOperand_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2, vf3;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_2, SQFloat::_2, SQFloat::_2, SQFloat::_2, vf2);
+    SQVF32::Pack(SQFloat::_1, SQFloat::_0, -SQFloat::_1, -SQFloat::_8, vf3);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_4;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_5;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_0;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::MultiplyAdd(vf1, vf2, vf3);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that the dot product is calculated using the four components and copied to all the components of the result.
+/// </summary>
+QTEST_CASE ( DotProduct4_ResultIsCopiedToAllComponents_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8, vf2);
+    const float_q EXPECTED_VALUE = (float_q)70.0; // 5 + 12 + 21 + 32
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::DotProduct4(vf1, vf2);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the fourth component does not take part in the dot product and the result is copied to all the components.
+/// </summary>
+QTEST_CASE ( DotProduct3_FourthComponentIsIgnored_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8, vf2);
+    const float_q EXPECTED_VALUE = (float_q)38.0; // 5 + 12 + 21
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::DotProduct3(vf1, vf2);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the two first components are taken from the first pack and the other two from the second one.
+/// </summary>
+QTEST_CASE ( Shuffle1_ComponentsAreTakenFromTheExpectedPacks_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8, vf2);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_4;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_1;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_6;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_6;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Shuffle<3, 0, 1, 1>(vf1, vf2);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that components are rearranged as expected.
+/// </summary>
+QTEST_CASE ( Shuffle2_ComponentsAreRearranged_Test )
+{
+    // [Preparation]
+    vf32_q vf1;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vf1);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_4;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_2;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_1;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Shuffle<3, 2, 1, 0>(vf1);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that the lowest component of every pair is returned.
+/// </summary>
+QTEST_CASE ( Min_LowestComponentsAreReturned_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_6, -SQFloat::_3, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_5, SQFloat::_2, SQFloat::_3, SQFloat::_4, vf2);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_1;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_2;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = -SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_4;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Min(vf1, vf2);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that the greatest component of every pair is returned.
+/// </summary>
+QTEST_CASE ( Max_GreatestComponentsAreReturned_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_6, -SQFloat::_3, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_5, SQFloat::_2, SQFloat::_3, SQFloat::_4, vf2);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_5;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_6;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_4;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Max(vf1, vf2);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that the square root of every component is calculated.
+/// </summary>
+QTEST_CASE ( Sqrt_SquareRootOfEveryComponentIsCalculated_Test )
+{
+    // [Preparation]
+    vf32_q vf1;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_4, SQFloat::_9, SQFloat::_0, vf1);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_1;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_2;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_0;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Sqrt(vf1);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that the estimation is close to the exact value, using the precission guaranteed by the instruction set.
+/// </summary>
+QTEST_CASE ( ReciprocalSqrtEstimate_ResultIsCloseToExactValue_Test )
+{
+    // [Preparation]
+    vf32_q vf1;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_4, (float_q)16.0, (float_q)0.25, vf1);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_1;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_0_5;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_0_25;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_2;
+    const float_q RELATIVE_TOLERANCE = (float_q)0.0004; // 1.5 * 2^-12
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::ReciprocalSqrtEstimate(vf1);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK(SQFloat::AreEqual(fFirst, EXPECTED_VALUE_FOR_FLOAT1, EXPECTED_VALUE_FOR_FLOAT1 * RELATIVE_TOLERANCE));
+    BOOST_CHECK(SQFloat::AreEqual(fSecond, EXPECTED_VALUE_FOR_FLOAT2, EXPECTED_VALUE_FOR_FLOAT2 * RELATIVE_TOLERANCE));
+    BOOST_CHECK(SQFloat::AreEqual(fThird, EXPECTED_VALUE_FOR_FLOAT3, EXPECTED_VALUE_FOR_FLOAT3 * RELATIVE_TOLERANCE));
+    BOOST_CHECK(SQFloat::AreEqual(fFourth, EXPECTED_VALUE_FOR_FLOAT4, EXPECTED_VALUE_FOR_FLOAT4 * RELATIVE_TOLERANCE));
+}
+
+/// <summary>
+/// Checks that the refined reciprocal square root is more accurate than the estimation.
+/// </summary>
+QTEST_CASE ( ReciprocalSqrt_ResultIsMoreAccurateThanEstimation_Test )
+{
+    // [Preparation]
+    vf32_q vf1;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_4, (float_q)16.0, (float_q)0.25, vf1);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_1;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_0_5;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_0_25;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_2;
+    const float_q TOLERANCE = (float_q)0.00001; // Much lower than the error of the estimation
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::ReciprocalSqrt(vf1);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK(SQFloat::AreEqual(fFirst, EXPECTED_VALUE_FOR_FLOAT1, TOLERANCE));
+    BOOST_CHECK(SQFloat::AreEqual(fSecond, EXPECTED_VALUE_FOR_FLOAT2, TOLERANCE));
+    BOOST_CHECK(SQFloat::AreEqual(fThird, EXPECTED_VALUE_FOR_FLOAT3, TOLERANCE));
+    BOOST_CHECK(SQFloat::AreEqual(fFourth, EXPECTED_VALUE_FOR_FLOAT4, TOLERANCE));
+}
+
+/// <summary>
+/// Checks that only the components of the mask whose operands are equal are set.
+/// </summary>
+QTEST_CASE ( CompareEqual_OnlyComponentsThatFulfillTheConditionAreSet_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_4, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_1, SQFloat::_3, SQFloat::_3, SQFloat::_4, vf2);
+    const u32_q EXPECTED_MASK = 0x9;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::CompareEqual(vf1, vf2);
+
+    // [Verification]
+    u32_q uMask = SQVF32::ExtractMask(vectorUT);
+    BOOST_CHECK_EQUAL(uMask, EXPECTED_MASK);
+}
+
+/// <summary>
+/// Checks that only the components of the mask whose operands are not equal are set.
+/// </summary>
+QTEST_CASE ( CompareNotEqual_OnlyComponentsThatFulfillTheConditionAreSet_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_4, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_1, SQFloat::_3, SQFloat::_3, SQFloat::_4, vf2);
+    const u32_q EXPECTED_MASK = 0x6;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::CompareNotEqual(vf1, vf2);
+
+    // [Verification]
+    u32_q uMask = SQVF32::ExtractMask(vectorUT);
+    BOOST_CHECK_EQUAL(uMask, EXPECTED_MASK);
+}
+
+/// <summary>
+/// Checks that only the components of the mask whose operands are less than the second ones are set.
+/// </summary>
+QTEST_CASE ( CompareLess_OnlyComponentsThatFulfillTheConditionAreSet_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_4, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_1, SQFloat::_3, SQFloat::_3, SQFloat::_4, vf2);
+    const u32_q EXPECTED_MASK = 0x2;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::CompareLess(vf1, vf2);
+
+    // [Verification]
+    u32_q uMask = SQVF32::ExtractMask(vectorUT);
+    BOOST_CHECK_EQUAL(uMask, EXPECTED_MASK);
+}
+
+/// <summary>
+/// Checks that only the components of the mask whose operands are less than or equal to the second ones are set.
+/// </summary>
+QTEST_CASE ( CompareLessOrEquals_OnlyComponentsThatFulfillTheConditionAreSet_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_4, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_1, SQFloat::_3, SQFloat::_3, SQFloat::_4, vf2);
+    const u32_q EXPECTED_MASK = 0xB;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::CompareLessOrEquals(vf1, vf2);
+
+    // [Verification]
+    u32_q uMask = SQVF32::ExtractMask(vectorUT);
+    BOOST_CHECK_EQUAL(uMask, EXPECTED_MASK);
+}
+
+/// <summary>
+/// Checks that only the components of the mask whose operands are greater than the second ones are set.
+/// </summary>
+QTEST_CASE ( CompareGreater_OnlyComponentsThatFulfillTheConditionAreSet_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_4, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_1, SQFloat::_3, SQFloat::_3, SQFloat::_4, vf2);
+    const u32_q EXPECTED_MASK = 0x4;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::CompareGreater(vf1, vf2);
+
+    // [Verification]
+    u32_q uMask = SQVF32::ExtractMask(vectorUT);
+    BOOST_CHECK_EQUAL(uMask, EXPECTED_MASK);
+}
+
+/// <summary>
+/// Checks that only the components of the mask whose operands are greater than or equal to the second ones are set.
+/// </summary>
+QTEST_CASE ( CompareGreaterOrEquals_OnlyComponentsThatFulfillTheConditionAreSet_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_4, SQFloat::_4, vf1);
+    SQVF32::Pack(SQFloat::_1, SQFloat::_3, SQFloat::_3, SQFloat::_4, vf2);
+    const u32_q EXPECTED_MASK = 0xD;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::CompareGreaterOrEquals(vf1, vf2);
+
+    // [Verification]
+    u32_q uMask = SQVF32::ExtractMask(vectorUT);
+    BOOST_CHECK_EQUAL(uMask, EXPECTED_MASK);
+}
+
+/// <summary>
+/// Checks that only the components that are set in both masks are set in the result.
+/// </summary>
+QTEST_CASE ( And_OnlyComponentsSetInBothMasksAreSet_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2, vf3;
+    SQVF32::Pack(SQFloat::_0, SQFloat::_0, SQFloat::_1, SQFloat::_1, vf1);
+    SQVF32::Pack(SQFloat::_0, SQFloat::_1, SQFloat::_0, SQFloat::_1, vf2);
+    SQVF32::Pack(SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_0, vf3);
+    const vf32_q MASK1 = SQVF32::CompareEqual(vf1, vf3);
+    const vf32_q MASK2 = SQVF32::CompareEqual(vf2, vf3);
+    const u32_q EXPECTED_MASK = 0x1;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::And(MASK1, MASK2);
+
+    // [Verification]
+    u32_q uMask = SQVF32::ExtractMask(vectorUT);
+    BOOST_CHECK_EQUAL(uMask, EXPECTED_MASK);
+}
+
+/// <summary>
+/// Checks that the components that are set in any of the masks are set in the result.
+/// </summary>
+QTEST_CASE ( Or_ComponentsSetInAnyMaskAreSet_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2, vf3;
+    SQVF32::Pack(SQFloat::_0, SQFloat::_0, SQFloat::_1, SQFloat::_1, vf1);
+    SQVF32::Pack(SQFloat::_0, SQFloat::_1, SQFloat::_0, SQFloat::_1, vf2);
+    SQVF32::Pack(SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_0, vf3);
+    const vf32_q MASK1 = SQVF32::CompareEqual(vf1, vf3);
+    const vf32_q MASK2 = SQVF32::CompareEqual(vf2, vf3);
+    const u32_q EXPECTED_MASK = 0x7;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Or(MASK1, MASK2);
+
+    // [Verification]
+    u32_q uMask = SQVF32::ExtractMask(vectorUT);
+    BOOST_CHECK_EQUAL(uMask, EXPECTED_MASK);
+}
+
+/// <summary>
+/// Checks that components are selected from the first pack where the mask is set and from the second pack where it is not.
+/// </summary>
+QTEST_CASE ( Select_ComponentsAreSelectedDependingOnTheMask_Test )
+{
+    // [Preparation]
+    vf32_q vfIfTrue, vfIfFalse, vfComparand1, vfComparand2;
+    SQVF32::Pack(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4, vfIfTrue);
+    SQVF32::Pack(SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8, vfIfFalse);
+    SQVF32::Pack(SQFloat::_0, SQFloat::_1, SQFloat::_0, SQFloat::_1, vfComparand1);
+    SQVF32::Pack(SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_0, vfComparand2);
+    const vf32_q MASK = SQVF32::CompareEqual(vfComparand1, vfComparand2);
+    const float_q EXPECTED_VALUE_FOR_FLOAT1 = SQFloat::_1;
+    const float_q EXPECTED_VALUE_FOR_FLOAT2 = SQFloat::_6;
+    const float_q EXPECTED_VALUE_FOR_FLOAT3 = SQFloat::_3;
+    const float_q EXPECTED_VALUE_FOR_FLOAT4 = SQFloat::_8;
+
+	// [Execution]
+    vf32_q vectorUT = SQVF32::Select(MASK, vfIfTrue, vfIfFalse);
+
+    // [Verification]
+    float_q fFirst, fSecond, fThird, fFourth;
+    SQVF32::Unpack(vectorUT, fFirst, fSecond, fThird, fFourth);
+
+    BOOST_CHECK_EQUAL(fFirst, EXPECTED_VALUE_FOR_FLOAT1);
+    BOOST_CHECK_EQUAL(fSecond, EXPECTED_VALUE_FOR_FLOAT2);
+    BOOST_CHECK_EQUAL(fThird, EXPECTED_VALUE_FOR_FLOAT3);
+    BOOST_CHECK_EQUAL(fFourth, EXPECTED_VALUE_FOR_FLOAT4);
+}
+
+/// <summary>
+/// Checks that the first component of the mask corresponds to the lowest bit of the returned integer.
+/// </summary>
+QTEST_CASE ( ExtractMask_FirstComponentCorrespondsToLowestBit_Test )
+{
+    // [Preparation]
+    vf32_q vf1, vf2;
+    SQVF32::Pack(SQFloat::_0, SQFloat::_1, SQFloat::_1, SQFloat::_1, vf1);
+    SQVF32::Pack(SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_0, vf2);
+    const vf32_q MASK = SQVF32::CompareEqual(vf1, vf2);
+    const u32_q EXPECTED_RESULT = 1U;
+
+	// [Execution]
+    u32_q uResultUT = SQVF32::ExtractMask(MASK);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uResultUT, EXPECTED_RESULT);
+}
+
 // End - Test Suite: SQVF32
 QTEST_SUITE_END()
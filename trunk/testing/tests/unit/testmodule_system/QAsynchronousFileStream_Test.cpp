@@ -0,0 +1,556 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+// Note: These unit tests make use of some artifacts located at /testing/bin/artifacts/artifacts/QAsynchronousFileStream/ (copied to the cwd before execution).
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QAsynchronousFileStream.h"
+
+#include "QPath.h"
+#include "SQFile.h"
+#include "QMemoryStream.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::QAsynchronousFileStream;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::QPath;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::EQFileOpenMode;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::EQFileSystemError;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::SQFile;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::QFileInfo;
+using Kinesis::QuimeraEngine::System::IO::QMemoryStream;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+// The base path to all the artifacts used by these tests
+static const string_q PATH_TO_ARTIFACTS("./artifacts/QAsynchronousFileStream/");
+
+
+QTEST_SUITE_BEGIN( QAsynchronousFileStream_TestSuite )
+
+/// <summary>
+/// Checks that the instance is initialized as expected.
+/// </summary>
+QTEST_CASE ( Constructor1_InstanceIsInitializedAsExpected_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BUFFER_SIZE = 4U;
+    const unsigned int BUFFER_COUNT = 3U;
+    const QPath EXPECTED_PATH(string_q::GetEmpty());
+    const pointer_uint_q EXPECTED_POSITION = 0;
+    const bool EXPECTED_OPEN_STATUS = false;
+
+    // [Execution]
+    QAsynchronousFileStream stream(BUFFER_SIZE, BUFFER_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+    BOOST_CHECK_EQUAL(stream.IsOpen(), EXPECTED_OPEN_STATUS);
+    BOOST_CHECK(stream.GetPath() == EXPECTED_PATH);
+    BOOST_CHECK_EQUAL(stream.GetBufferSize(), BUFFER_SIZE);
+    BOOST_CHECK_EQUAL(stream.GetBufferCount(), BUFFER_COUNT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the size of the buffers is zero.
+/// </summary>
+QTEST_CASE ( Constructor1_AssertionFailsWhenBufferSizeIsZero_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BUFFER_SIZE = 0;
+    const unsigned int BUFFER_COUNT = 2U;
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        QAsynchronousFileStream stream(BUFFER_SIZE, BUFFER_COUNT);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+/// <summary>
+/// Checks that an assertion fails when there are less than 2 buffers.
+/// </summary>
+QTEST_CASE ( Constructor1_AssertionFailsWhenThereAreLessThanTwoBuffers_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BUFFER_SIZE = 4U;
+    const unsigned int BUFFER_COUNT = 1U;
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        QAsynchronousFileStream stream(BUFFER_SIZE, BUFFER_COUNT);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that it returns Success when the file exists and the open mode is Open.
+/// </summary>
+QTEST_CASE ( Constructor2_ReturnsSuccessWhenFileExistsAndOpenModeIsOpen_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_Open;
+    const EQFileSystemError EXPECTED_RESULT = EQFileSystemError::E_Success;
+    const pointer_uint_q EXPECTED_LENGTH = 26U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    // [Execution]
+    QAsynchronousFileStream stream(INPUT_PATH, OPEN_MODE, 4U, 2U, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK(errorInfo == EXPECTED_RESULT);
+    BOOST_CHECK(stream.IsOpen());
+    BOOST_CHECK(stream.GetPath() == INPUT_PATH);
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that it returns DoesNotExist when the file does not exist and the open mode is Open.
+/// </summary>
+QTEST_CASE ( Constructor2_ReturnsDoesNotExistWhenFileDoesNotExistAndOpenModeIsOpen_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./NonexistentFile.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_Open;
+    const EQFileSystemError EXPECTED_RESULT = EQFileSystemError::E_DoesNotExist;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    // [Execution]
+    QAsynchronousFileStream stream(INPUT_PATH, OPEN_MODE, 4U, 2U, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK(errorInfo == EXPECTED_RESULT);
+    BOOST_CHECK(!stream.IsOpen());
+}
+
+/// <summary>
+/// Checks that the position is set at the end of the stream when the open mode is Append.
+/// </summary>
+QTEST_CASE ( Constructor2_PositionIsSetAtTheEndWhenOpenModeIsAppend_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_Append;
+    const pointer_uint_q EXPECTED_POSITION = 26U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    // [Execution]
+    QAsynchronousFileStream stream(INPUT_PATH, OPEN_MODE, 4U, 2U, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that the stream is flushed before it is destroyed.
+/// </summary>
+QTEST_CASE ( Destructor_StreamIsFlushedBeforeDestroyed_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./DestroyedStream.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_CreateOrOverwrite;
+    const u64_q EXPECTED_SIZE = 10U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    {
+        QAsynchronousFileStream stream(INPUT_PATH, OPEN_MODE, 4U, 2U, errorInfo);
+        stream.Write("ABCDEFGHIJ", 0, 10U);
+
+    // [Execution]
+    } // Destructor called
+
+    // [Verification]
+    QFileInfo fileInfo = SQFile::GetFileInfo(INPUT_PATH, errorInfo);
+    BOOST_CHECK_EQUAL(fileInfo.GetSize(), EXPECTED_SIZE);
+}
+
+/// <summary>
+/// Checks that the complete stream can be read when it is larger than all the buffers together.
+/// </summary>
+QTEST_CASE ( Read_StreamLargerThanBuffersCanBeCompletelyRead_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const string_q EXPECTED_CONTENT("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, 4U, 2U, errorInfo);
+
+    // [Execution]
+    char szContent[27];
+    memset(szContent, 0, sizeof(szContent));
+    stream.Read(szContent, 0, 26U);
+
+    // [Verification]
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), 26U);
+}
+
+/// <summary>
+/// Checks that the stream can be read in small pieces that cross the limits of the windows.
+/// </summary>
+QTEST_CASE ( Read_StreamCanBeReadInPiecesThatCrossWindows_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const string_q EXPECTED_CONTENT("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    const pointer_uint_q PIECE_SIZE = 3U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, 4U, 2U, errorInfo);
+
+    // [Execution]
+    char szContent[27];
+    memset(szContent, 0, sizeof(szContent));
+
+    for(pointer_uint_q i = 0; i < 26U; i += PIECE_SIZE)
+        stream.Read(szContent, i, 26U - i < PIECE_SIZE ? 26U - i : PIECE_SIZE);
+
+    // [Verification]
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+}
+
+/// <summary>
+/// Checks that windows can be read again after they have been replaced by other windows.
+/// </summary>
+QTEST_CASE ( Read_WindowsCanBeReadAgainAfterBeingReplaced_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const string_q EXPECTED_CONTENT1("WXYZ");
+    const string_q EXPECTED_CONTENT2("CDEF");
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, 4U, 2U, errorInfo);
+
+    // [Execution]
+    char szContent1[] = {0, 0, 0, 0, 0};
+    char szContent2[] = {0, 0, 0, 0, 0};
+    stream.SetPosition(22U);
+    stream.Read(szContent1, 0, 4U);
+    stream.SetPosition(2U);
+    stream.Read(szContent2, 0, 4U);
+
+    // [Verification]
+    BOOST_CHECK(string_q(szContent1) == EXPECTED_CONTENT1);
+    BOOST_CHECK(string_q(szContent2) == EXPECTED_CONTENT2);
+}
+
+/// <summary>
+/// Checks that the written content can be read while the stream is open, even if the buffers have been written to the file.
+/// </summary>
+QTEST_CASE ( Write_WrittenContentCanBeReadBack_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./WrittenFile.txt");
+    const string_q EXPECTED_CONTENT("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    const pointer_uint_q EXPECTED_LENGTH = 26U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, 4U, 2U, errorInfo);
+
+    // [Execution]
+    stream.Write("ABCDEFGHIJKLM", 0, 13U);
+    stream.Write("NOPQRSTUVWXYZ", 0, 13U);
+
+    // [Verification]
+    char szContent[27];
+    memset(szContent, 0, sizeof(szContent));
+    stream.SetPosition(0);
+    stream.Read(szContent, 0, EXPECTED_LENGTH);
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that the content of the stream is overwritten when the position is not at the end, keeping the rest of the window.
+/// </summary>
+QTEST_CASE ( Write_ContentIsOverwrittenWhenPositionIsNotAtTheEnd_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./OverwrittenFile.txt");
+    const string_q EXPECTED_CONTENT("ABCDEXYZIJKL");
+    const pointer_uint_q EXPECTED_LENGTH = 12U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, 4U, 2U, errorInfo);
+    stream.Write("ABCDEFGHIJKL", 0, 12U);
+    stream.Close();
+    stream.Open(INPUT_PATH, EQFileOpenMode::E_Open);
+    stream.SetPosition(5U);
+
+    // [Execution]
+    stream.Write("XYZ", 0, 3U);
+    stream.Close();
+
+    // [Verification]
+    char szContent[13];
+    memset(szContent, 0, sizeof(szContent));
+    stream.Open(INPUT_PATH, EQFileOpenMode::E_Open);
+    stream.Read(szContent, 0, EXPECTED_LENGTH);
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that a stream much larger than all the buffers together can be written and read.
+/// </summary>
+QTEST_CASE ( Write_StreamLargerThanBuffersIsWrittenToFile_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./LargeFile.txt");
+    const pointer_uint_q NUMBER_OF_VALUES = 10000U;
+    const u64_q EXPECTED_SIZE = NUMBER_OF_VALUES * sizeof(pointer_uint_q);
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    {
+        QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, 64U, 3U, errorInfo);
+
+    // [Execution]
+        for(pointer_uint_q i = 0; i < NUMBER_OF_VALUES; ++i)
+            stream.Write(&i, 0, sizeof(pointer_uint_q));
+    }
+
+    // [Verification]
+    QFileInfo fileInfo = SQFile::GetFileInfo(INPUT_PATH, errorInfo);
+    BOOST_CHECK_EQUAL(fileInfo.GetSize(), EXPECTED_SIZE);
+
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, 64U, 3U, errorInfo);
+    bool bAllValuesAreCorrect = true;
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_VALUES && bAllValuesAreCorrect; ++i)
+    {
+        pointer_uint_q uValue = 0;
+        stream.Read(&uValue, 0, sizeof(pointer_uint_q));
+        bAllValuesAreCorrect = uValue == i;
+    }
+
+    BOOST_CHECK(bAllValuesAreCorrect);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input size is zero.
+/// </summary>
+QTEST_CASE ( Write_AssertionFailsWhenInputSizeIsZero_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./WrittenFile2.txt");
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, 4U, 2U, errorInfo);
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        stream.Write("ABCD", 0, 0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that all the written content is sent to the file when the stream is flushed.
+/// </summary>
+QTEST_CASE ( Flush_ContentIsSentToFile_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FlushedFile.txt");
+    const u64_q EXPECTED_SIZE = 6U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, 4U, 2U, errorInfo);
+    stream.Write("ABCDEF", 0, 6U);
+
+    // [Execution]
+    stream.Flush();
+
+    // [Verification]
+    QFileInfo fileInfo = SQFile::GetFileInfo(INPUT_PATH, errorInfo);
+    BOOST_CHECK_EQUAL(fileInfo.GetSize(), EXPECTED_SIZE);
+}
+
+/// <summary>
+/// Checks that it returns Success when all the buffers are written to the file without errors.
+/// </summary>
+QTEST_CASE ( Flush_ReturnsSuccessWhenNoErrorOccurred_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FlushedFile.txt");
+    const EQFileSystemError EXPECTED_RESULT = EQFileSystemError::E_Success;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, 4U, 2U, errorInfo);
+    stream.Write("ABCDEFGHIJ", 0, 10U);
+
+    // [Execution]
+    EQFileSystemError eResult = stream.Flush();
+
+    // [Verification]
+    BOOST_CHECK(eResult == EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that the internal pointer is moved backward.
+/// </summary>
+QTEST_CASE ( MoveBackward_InternalPointerIsMovedBackward_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const pointer_uint_q EXPECTED_POSITION = 3U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, 4U, 2U, errorInfo);
+    stream.SetPosition(5U);
+
+    // [Execution]
+    stream.MoveBackward(2U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that the internal pointer is moved forward.
+/// </summary>
+QTEST_CASE ( MoveForward_InternalPointerIsMovedForward_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const pointer_uint_q EXPECTED_POSITION = 5U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, 4U, 2U, errorInfo);
+    stream.SetPosition(2U);
+
+    // [Execution]
+    stream.MoveForward(3U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that the stream can be opened again after it is closed.
+/// </summary>
+QTEST_CASE ( Close_StreamCanBeReopened_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const EQFileSystemError EXPECTED_RESULT = EQFileSystemError::E_Success;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, 4U, 2U, errorInfo);
+
+    // [Execution]
+    stream.Close();
+    errorInfo = stream.Open(INPUT_PATH, EQFileOpenMode::E_Open);
+
+    // [Verification]
+    BOOST_CHECK(errorInfo == EXPECTED_RESULT);
+    BOOST_CHECK(stream.IsOpen());
+}
+
+/// <summary>
+/// Checks that the content of the stream is copied to another stream.
+/// </summary>
+QTEST_CASE ( CopyTo_ContentIsCopiedToDestinationStream_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const string_q EXPECTED_CONTENT("CDEFGHIJK");
+    const pointer_uint_q SOURCE_OFFSET = 2U;
+    const pointer_uint_q DESTINATION_OFFSET = 0;
+    const pointer_uint_q NUMBER_OF_BYTES = 9U;
+    const pointer_uint_q BATCH_SIZE = 2U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QAsynchronousFileStream sourceStream(INPUT_PATH, EQFileOpenMode::E_Open, 4U, 2U, errorInfo);
+    QMemoryStream<> destinationStream(4U);
+
+    // [Execution]
+    sourceStream.CopyTo(destinationStream, SOURCE_OFFSET, DESTINATION_OFFSET, NUMBER_OF_BYTES, BATCH_SIZE);
+
+    // [Verification]
+    char szContent[10];
+    memset(szContent, 0, sizeof(szContent));
+    destinationStream.SetPosition(0);
+    destinationStream.Read(szContent, 0, NUMBER_OF_BYTES);
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+}
+
+// End - Test Suite: QAsynchronousFileStream
+QTEST_SUITE_END()
@@ -34,6 +34,12 @@ using namespace boost::unit_test;
 #include "QAbstractCallStackTracePrinterMock.h"
 #include "QCallStackTracePlainTextFormatter.h"
 #include "EQComparisonType.h"
+#include "QThread.h"
+#include "QMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "SQThisThread.h"
+
+#include <boost/thread/barrier.hpp>
 
 using Kinesis::QuimeraEngine::System::Diagnosis::QCallStackTracer;
 using Kinesis::QuimeraEngine::System::Diagnosis::Test::QAbstractCallStackTracePrinterMock;
@@ -42,6 +48,50 @@ using Kinesis::QuimeraEngine::System::Diagnosis::IQCallStackTraceFormatter;
 using Kinesis::QuimeraEngine::System::Diagnosis::QCallStackTracePlainTextFormatter;
 using Kinesis::QuimeraEngine::System::Diagnosis::QCallTrace;
 using Kinesis::QuimeraEngine::System::Diagnosis::QArgumentTrace;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::System::Threading::QMutex;
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+using Kinesis::QuimeraEngine::System::Threading::SQThisThread;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+
+// Class whose method is executed by secondary threads in the tests of QCallStackTracer; it adds a trace and prints the call stack trace 
+// of the thread once all the threads that share the barrier have added theirs
+class QCallStackTracerTestClass
+{
+public:
+
+    QCallStackTracerTestClass() : m_szFunctionSignature(null_q),
+                                  m_pAllThreadsAddedTraces(null_q),
+                                  m_pPrinterMutex(null_q)
+    {
+    }
+
+    void AddTraceAndDump()
+    {
+        QCallTrace callTrace(m_szFunctionSignature, null_q, 0);
+        QCallStackTracer::Get()->AddTrace(callTrace);
+        m_strThreadId = SQThisThread::ToString();
+
+        m_pAllThreadsAddedTraces->wait();
+
+        // The printer is shared by all the threads
+        {
+            QScopedExclusiveLock<QMutex> lock(*m_pPrinterMutex);
+            QCallStackTracer::Get()->Dump();
+            QAbstractCallStackTracePrinterMock* pPrinter = QCallStackTracer::Get()->GetPrinter()->As<QAbstractCallStackTracePrinterMock>();
+            m_strPrintedText = pPrinter->GetPrintedText();
+            pPrinter->ClearPrintedText();
+        }
+
+        QCallStackTracer::Get()->RemoveLastTrace();
+    }
+
+    const char* m_szFunctionSignature;
+    boost::barrier* m_pAllThreadsAddedTraces;
+    QMutex* m_pPrinterMutex;
+    string_q m_strThreadId;
+    string_q m_strPrintedText;
+};
 
 
 QTEST_SUITE_BEGIN( QCallStackTracer_TestSuite )
@@ -191,5 +241,86 @@ QTEST_CASE ( RemoveLastTrace_CallStackTraceIsDeletedWhenItIsEmpty_Test )
     BOOST_CHECK(bPrintedTextIsEmpty);
 }
 
+/// <summary>
+/// Checks that every thread adds its traces to its own call stack trace when several threads add traces at the same time.
+/// </summary>
+QTEST_CASE ( AddTrace_EveryThreadUsesItsOwnCallStackTraceWhenSeveralThreadsAddTracesAtTheSameTime_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+
+    // [Preparation]
+    InitializeCallStackTracer_TestMethod();
+    const unsigned int THREAD_COUNT = 4U;
+    const char* FUNCTION_SIGNATURES[THREAD_COUNT] = { "void function0()", "void function1()", "void function2()", "void function3()" };
+    const string_q HEADER("Call stack trace for ");
+    boost::barrier allThreadsAddedTraces(THREAD_COUNT);
+    QMutex printerMutex;
+    QCallStackTracerTestClass arTests[THREAD_COUNT];
+    QThread* arThreads[THREAD_COUNT];
+
+    // [Execution]
+    for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+    {
+        arTests[i].m_szFunctionSignature = FUNCTION_SIGNATURES[i];
+        arTests[i].m_pAllThreadsAddedTraces = &allThreadsAddedTraces;
+        arTests[i].m_pPrinterMutex = &printerMutex;
+        arThreads[i] = new QThread(QDelegate<void ()>(&arTests[i], &QCallStackTracerTestClass::AddTraceAndDump));
+    }
+
+    for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+    
+    // [Verification]
+    for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+    {
+        BOOST_CHECK(arTests[i].m_strPrintedText.Contains(HEADER + arTests[i].m_strThreadId, EQComparisonType::E_BinaryCaseSensitive));
+        BOOST_CHECK(arTests[i].m_strPrintedText.Contains(FUNCTION_SIGNATURES[i], EQComparisonType::E_BinaryCaseSensitive));
+
+        for(unsigned int j = 0; j < THREAD_COUNT; ++j)
+            if(j != i)
+                BOOST_CHECK(!arTests[i].m_strPrintedText.Contains(FUNCTION_SIGNATURES[j], EQComparisonType::E_BinaryCaseSensitive));
+    }
+}
+
+/// <summary>
+/// Checks that a thread that reuses the call stack trace of a finished thread is identified by its own Id and does not see the traces of the finished thread.
+/// </summary>
+QTEST_CASE ( AddTrace_ThreadThatReusesCallStackTraceOfFinishedThreadIsIdentifiedByItsOwnId_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+
+    // [Preparation]
+    InitializeCallStackTracer_TestMethod();
+    const char* FINISHED_THREAD_FUNCTION_SIGNATURE = "void finishedThreadFunction()";
+    const char* LATER_THREAD_FUNCTION_SIGNATURE = "void laterThreadFunction()";
+    const string_q HEADER("Call stack trace for ");
+    boost::barrier finishedThreadAddedTrace(1U);
+    boost::barrier laterThreadAddedTrace(1U);
+    QMutex printerMutex;
+    QCallStackTracerTestClass finishedThreadTest;
+    finishedThreadTest.m_szFunctionSignature = FINISHED_THREAD_FUNCTION_SIGNATURE;
+    finishedThreadTest.m_pAllThreadsAddedTraces = &finishedThreadAddedTrace;
+    finishedThreadTest.m_pPrinterMutex = &printerMutex;
+    QCallStackTracerTestClass laterThreadTest;
+    laterThreadTest.m_szFunctionSignature = LATER_THREAD_FUNCTION_SIGNATURE;
+    laterThreadTest.m_pAllThreadsAddedTraces = &laterThreadAddedTrace;
+    laterThreadTest.m_pPrinterMutex = &printerMutex;
+
+    QThread finishedThread(QDelegate<void ()>(&finishedThreadTest, &QCallStackTracerTestClass::AddTraceAndDump));
+    finishedThread.Join();
+
+    // [Execution]
+    QThread laterThread(QDelegate<void ()>(&laterThreadTest, &QCallStackTracerTestClass::AddTraceAndDump));
+    laterThread.Join();
+    
+    // [Verification]
+    BOOST_CHECK(laterThreadTest.m_strPrintedText.Contains(HEADER + laterThreadTest.m_strThreadId, EQComparisonType::E_BinaryCaseSensitive));
+    BOOST_CHECK(laterThreadTest.m_strPrintedText.Contains(LATER_THREAD_FUNCTION_SIGNATURE, EQComparisonType::E_BinaryCaseSensitive));
+    BOOST_CHECK(!laterThreadTest.m_strPrintedText.Contains(FINISHED_THREAD_FUNCTION_SIGNATURE, EQComparisonType::E_BinaryCaseSensitive));
+}
+
 // End - Test Suite: QCallStackTracer
 QTEST_SUITE_END()
@@ -0,0 +1,454 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QLockFreePoolAllocator.h"
+
+#include "QAssertException.h"
+#include "QThread.h"
+
+using Kinesis::QuimeraEngine::System::Threading::QLockFreePoolAllocator;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+// Class whose method is executed by several threads at the same time in the tests of QLockFreePoolAllocator
+class QLockFreePoolAllocatorTestClass
+{
+public:
+
+    static const unsigned int BLOCKS_PER_THREAD = 64U;
+    static const unsigned int ITERATIONS = 2000U;
+
+    QLockFreePoolAllocator* m_pAllocator;
+    u32_q m_uThreadMark;
+    bool m_bBlocksWereShared;
+    bool m_bPoolWasFull;
+
+    QLockFreePoolAllocatorTestClass() : m_pAllocator(null_q),
+                                        m_uThreadMark(0),
+                                        m_bBlocksWereShared(false),
+                                        m_bPoolWasFull(false)
+    {
+    }
+
+    // Allocates blocks, marks them and checks that no other thread modified them before deallocating them
+    void AllocateAndDeallocate()
+    {
+        void* arBlocks[BLOCKS_PER_THREAD];
+
+        for(unsigned int uIteration = 0; uIteration < ITERATIONS; ++uIteration)
+        {
+            const unsigned int BLOCKS = 1U + uIteration % BLOCKS_PER_THREAD;
+
+            for(unsigned int i = 0; i < BLOCKS; ++i)
+            {
+                arBlocks[i] = m_pAllocator->Allocate();
+                m_bPoolWasFull = m_bPoolWasFull || arBlocks[i] == null_q;
+
+                if(arBlocks[i] != null_q)
+                    *scast_q(arBlocks[i], u32_q*) = m_uThreadMark + i;
+            }
+
+            for(unsigned int i = 0; i < BLOCKS; ++i)
+            {
+                if(arBlocks[i] != null_q)
+                {
+                    m_bBlocksWereShared = m_bBlocksWereShared || *scast_q(arBlocks[i], u32_q*) != m_uThreadMark + i;
+                    m_pAllocator->Deallocate(arBlocks[i]);
+                }
+            }
+        }
+    }
+
+    // The same as AllocateAndDeallocate but using batches
+    void AllocateAndDeallocateBatches()
+    {
+        void* arBlocks[BLOCKS_PER_THREAD];
+
+        for(unsigned int uIteration = 0; uIteration < ITERATIONS; ++uIteration)
+        {
+            const unsigned int BLOCKS = m_pAllocator->AllocateBatch(arBlocks, 1U + uIteration % BLOCKS_PER_THREAD);
+            m_bPoolWasFull = m_bPoolWasFull || BLOCKS != 1U + uIteration % BLOCKS_PER_THREAD;
+
+            for(unsigned int i = 0; i < BLOCKS; ++i)
+                *scast_q(arBlocks[i], u32_q*) = m_uThreadMark + i;
+
+            for(unsigned int i = 0; i < BLOCKS; ++i)
+                m_bBlocksWereShared = m_bBlocksWereShared || *scast_q(arBlocks[i], u32_q*) != m_uThreadMark + i;
+
+            m_pAllocator->DeallocateBatch(arBlocks, BLOCKS);
+        }
+    }
+};
+
+
+QTEST_SUITE_BEGIN( QLockFreePoolAllocator_TestSuite )
+
+/// <summary>
+/// Checks that the pool is correctly constructed.
+/// </summary>
+QTEST_CASE ( Constructor_PoolIsCorrectlyConstructed_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_SIZE = 100U;
+    const pointer_uint_q INPUT_BLOCK_SIZE = 8U;
+    const QAlignment INPUT_ALIGNMENT(16U);
+    const pointer_uint_q EXPECTED_BLOCK_COUNT = 12U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+
+    // [Execution]
+    QLockFreePoolAllocator allocator(INPUT_SIZE, INPUT_BLOCK_SIZE, INPUT_ALIGNMENT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), INPUT_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetBlockSize(), INPUT_BLOCK_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetBlockCount(), EXPECTED_BLOCK_COUNT);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(allocator.GetAlignment() == INPUT_ALIGNMENT);
+    BOOST_CHECK(allocator.CanAllocate());
+    BOOST_CHECK_EQUAL(rcast_q(allocator.GetPointer(), pointer_uint_q) % INPUT_ALIGNMENT, 0U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the block size is zero.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenBlockSizeIsZero_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_SIZE = 100U;
+    const pointer_uint_q INPUT_BLOCK_SIZE = 0;
+    const QAlignment INPUT_ALIGNMENT(4U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QLockFreePoolAllocator allocator(INPUT_SIZE, INPUT_BLOCK_SIZE, INPUT_ALIGNMENT);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the pool is smaller than a block.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenSizeIsLowerThanBlockSize_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_SIZE = 4U;
+    const pointer_uint_q INPUT_BLOCK_SIZE = 8U;
+    const QAlignment INPUT_ALIGNMENT(4U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QLockFreePoolAllocator allocator(INPUT_SIZE, INPUT_BLOCK_SIZE, INPUT_ALIGNMENT);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the block to deallocate does not belong to the pool.
+/// </summary>
+QTEST_CASE ( Deallocate_AssertionFailsWhenBlockDoesNotBelongToThePool_Test )
+{
+    // [Preparation]
+    QLockFreePoolAllocator allocator(64U, 8U, QAlignment(8U));
+    u64_q uExternalBlock = 0;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Deallocate(&uExternalBlock);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that every allocated block is different, aligned and inside the pool.
+/// </summary>
+QTEST_CASE ( Allocate_EveryBlockIsDifferentAlignedAndInsideThePool_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q BLOCK_COUNT = 10U;
+    QLockFreePoolAllocator allocator(BLOCK_SIZE * BLOCK_COUNT, BLOCK_SIZE, QAlignment(16U));
+    const pointer_uint_q FIRST_ADDRESS = rcast_q(allocator.GetPointer(), pointer_uint_q);
+    bool arUsedBlocks[BLOCK_COUNT] = { false };
+    bool bResultIsWhatEspected = true;
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < BLOCK_COUNT; ++i)
+    {
+        const pointer_uint_q ADDRESS = rcast_q(allocator.Allocate(), pointer_uint_q);
+        const pointer_uint_q BLOCK = (ADDRESS - FIRST_ADDRESS) / BLOCK_SIZE;
+
+        // [Verification]
+        bResultIsWhatEspected = bResultIsWhatEspected &&
+                                ADDRESS >= FIRST_ADDRESS &&
+                                BLOCK < BLOCK_COUNT &&
+                                (ADDRESS - FIRST_ADDRESS) % BLOCK_SIZE == 0 &&
+                                !arUsedBlocks[BLOCK];
+
+        if(BLOCK < BLOCK_COUNT)
+            arUsedBlocks[BLOCK] = true;
+    }
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), BLOCK_SIZE * BLOCK_COUNT);
+}
+
+/// <summary>
+/// Checks that null is returned when the pool is full.
+/// </summary>
+QTEST_CASE ( Allocate_ReturnsNullWhenPoolIsFull_Test )
+{
+    // [Preparation]
+    const void* EXPECTED_RESULT = null_q;
+    QLockFreePoolAllocator allocator(32U, 8U, QAlignment(8U));
+
+    for(unsigned int i = 0; i < 4U; ++i)
+        allocator.Allocate();
+
+    // [Execution]
+    void* pBlock = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pBlock, EXPECTED_RESULT);
+    BOOST_CHECK(!allocator.CanAllocate());
+}
+
+/// <summary>
+/// Checks that the last deallocated block is the next to be allocated.
+/// </summary>
+QTEST_CASE ( Deallocate_DeallocatedBlockIsAllocatedAgain_Test )
+{
+    // [Preparation]
+    QLockFreePoolAllocator allocator(32U, 8U, QAlignment(8U));
+    allocator.Allocate();
+    void* pExpectedBlock = allocator.Allocate();
+    allocator.Allocate();
+
+    // [Execution]
+    allocator.Deallocate(pExpectedBlock);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), 16U);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), pExpectedBlock);
+}
+
+/// <summary>
+/// Checks that the requested number of different blocks is allocated when there are enough free blocks.
+/// </summary>
+QTEST_CASE ( AllocateBatch_RequestedBlocksAreAllocatedWhenThereAreEnoughFreeBlocks_Test )
+{
+    // [Preparation]
+    const unsigned int INPUT_COUNT = 5U;
+    const unsigned int EXPECTED_COUNT = INPUT_COUNT;
+    QLockFreePoolAllocator allocator(80U, 8U, QAlignment(8U));
+    void* arBlocks[INPUT_COUNT];
+
+    // [Execution]
+    unsigned int uCount = allocator.AllocateBatch(arBlocks, INPUT_COUNT);
+
+    // [Verification]
+    bool bBlocksAreDifferent = true;
+
+    for(unsigned int i = 0; i < uCount; ++i)
+        for(unsigned int j = i + 1U; j < uCount; ++j)
+            bBlocksAreDifferent = bBlocksAreDifferent && arBlocks[i] != arBlocks[j];
+
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK(bBlocksAreDifferent);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), 40U);
+}
+
+/// <summary>
+/// Checks that only the free blocks are allocated when there are not enough.
+/// </summary>
+QTEST_CASE ( AllocateBatch_OnlyFreeBlocksAreAllocatedWhenThereAreNotEnough_Test )
+{
+    // [Preparation]
+    const unsigned int INPUT_COUNT = 8U;
+    const unsigned int EXPECTED_COUNT = 3U;
+    QLockFreePoolAllocator allocator(40U, 8U, QAlignment(8U));
+    allocator.Allocate();
+    allocator.Allocate();
+    void* arBlocks[INPUT_COUNT];
+
+    // [Execution]
+    unsigned int uCount = allocator.AllocateBatch(arBlocks, INPUT_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK(!allocator.CanAllocate());
+    BOOST_CHECK_EQUAL(allocator.AllocateBatch(arBlocks, INPUT_COUNT), 0U);
+}
+
+/// <summary>
+/// Checks that all the blocks of the batch can be allocated again.
+/// </summary>
+QTEST_CASE ( DeallocateBatch_AllBlocksCanBeAllocatedAgain_Test )
+{
+    // [Preparation]
+    const unsigned int BLOCK_COUNT = 6U;
+    QLockFreePoolAllocator allocator(BLOCK_COUNT * 8U, 8U, QAlignment(8U));
+    void* arBlocks[BLOCK_COUNT];
+    allocator.AllocateBatch(arBlocks, BLOCK_COUNT);
+
+    // [Execution]
+    allocator.DeallocateBatch(arBlocks, BLOCK_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), 0U);
+    BOOST_CHECK_EQUAL(allocator.AllocateBatch(arBlocks, BLOCK_COUNT), BLOCK_COUNT);
+}
+
+/// <summary>
+/// Checks that all the blocks are free after clearing the pool.
+/// </summary>
+QTEST_CASE ( Clear_AllBlocksAreFree_Test )
+{
+    // [Preparation]
+    const unsigned int BLOCK_COUNT = 4U;
+    QLockFreePoolAllocator allocator(BLOCK_COUNT * 8U, 8U, QAlignment(8U));
+    void* arBlocks[BLOCK_COUNT];
+    allocator.AllocateBatch(arBlocks, BLOCK_COUNT);
+
+    // [Execution]
+    allocator.Clear();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), 0U);
+    BOOST_CHECK_EQUAL(allocator.AllocateBatch(arBlocks, BLOCK_COUNT), BLOCK_COUNT);
+}
+
+/// <summary>
+/// Checks that a block is never given to two threads at the same time when several threads allocate and deallocate blocks.
+/// </summary>
+QTEST_CASE ( Allocate_BlocksAreNotSharedAmongThreads_Test )
+{
+    // [Preparation]
+    const unsigned int THREADS = 4U;
+    QLockFreePoolAllocator allocator(THREADS * QLockFreePoolAllocatorTestClass::BLOCKS_PER_THREAD * sizeof(u32_q), sizeof(u32_q), QAlignment(4U));
+    QLockFreePoolAllocatorTestClass arTests[THREADS];
+    QThread* arThreads[THREADS];
+
+    // [Execution]
+    for(unsigned int i = 0; i < THREADS; ++i)
+    {
+        arTests[i].m_pAllocator = &allocator;
+        arTests[i].m_uThreadMark = i * 1000U;
+        arThreads[i] = new QThread(QDelegate<void ()>(&arTests[i], &QLockFreePoolAllocatorTestClass::AllocateAndDeallocate));
+    }
+
+    for(unsigned int i = 0; i < THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    for(unsigned int i = 0; i < THREADS; ++i)
+    {
+        BOOST_CHECK(!arTests[i].m_bBlocksWereShared);
+        BOOST_CHECK(!arTests[i].m_bPoolWasFull);
+    }
+
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), 0U);
+}
+
+/// <summary>
+/// Checks that a block is never given to two threads at the same time when several threads allocate and deallocate batches of blocks.
+/// </summary>
+QTEST_CASE ( AllocateBatch_BlocksAreNotSharedAmongThreads_Test )
+{
+    // [Preparation]
+    const unsigned int THREADS = 4U;
+    QLockFreePoolAllocator allocator(THREADS * QLockFreePoolAllocatorTestClass::BLOCKS_PER_THREAD * sizeof(u32_q), sizeof(u32_q), QAlignment(4U));
+    QLockFreePoolAllocatorTestClass arTests[THREADS];
+    QThread* arThreads[THREADS];
+
+    // [Execution]
+    for(unsigned int i = 0; i < THREADS; ++i)
+    {
+        arTests[i].m_pAllocator = &allocator;
+        arTests[i].m_uThreadMark = i * 1000U;
+        arThreads[i] = new QThread(QDelegate<void ()>(&arTests[i], &QLockFreePoolAllocatorTestClass::AllocateAndDeallocateBatches));
+    }
+
+    for(unsigned int i = 0; i < THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    for(unsigned int i = 0; i < THREADS; ++i)
+    {
+        BOOST_CHECK(!arTests[i].m_bBlocksWereShared);
+        BOOST_CHECK(!arTests[i].m_bPoolWasFull);
+    }
+
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), 0U);
+}
+
+// End - Test Suite: QLockFreePoolAllocator
+QTEST_SUITE_END()
@@ -0,0 +1,743 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+// Note: These unit tests make use of some artifacts located at /testing/bin/artifacts/artifacts/QMappedFileStream/ (copied to the cwd before execution).
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QMappedFileStream.h"
+
+#include "QPath.h"
+#include "SQFile.h"
+#include "QMemoryStream.h"
+#include "QBinaryStreamReader.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::QMappedFileStream;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::QPath;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::EQFileOpenMode;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::EQFileSystemError;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::SQFile;
+using Kinesis::QuimeraEngine::System::IO::FileSystem::QFileInfo;
+using Kinesis::QuimeraEngine::System::IO::QMemoryStream;
+using Kinesis::QuimeraEngine::System::IO::QBinaryStreamReader;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+
+// The base path to all the artifacts used by these tests
+static const string_q PATH_TO_ARTIFACTS("./artifacts/QMappedFileStream/");
+
+
+QTEST_SUITE_BEGIN( QMappedFileStream_TestSuite )
+
+/// <summary>
+/// Checks that the instance is initialized as expected.
+/// </summary>
+QTEST_CASE ( Constructor1_InstanceIsInitializedAsExpected_Test )
+{
+    // [Preparation]
+    const QPath EXPECTED_PATH(string_q::GetEmpty());
+    const pointer_uint_q EXPECTED_POSITION = 0;
+    const bool EXPECTED_OPEN_STATUS = false;
+
+    // [Execution]
+    QMappedFileStream stream;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+    BOOST_CHECK_EQUAL(stream.IsOpen(), EXPECTED_OPEN_STATUS);
+    BOOST_CHECK(stream.GetPath() == EXPECTED_PATH);
+}
+
+/// <summary>
+/// Checks that it returns Success when the file exists and the open mode is Open.
+/// </summary>
+QTEST_CASE ( Constructor2_ReturnsSuccessWhenFileExistsAndOpenModeIsOpen_Test )
+{
+    // Assuming the existence of:
+    // -./ExistingFile.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./ExistingFile.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_Open;
+    const EQFileSystemError EXPECTED_RESULT = EQFileSystemError::E_Success;
+    const bool EXPECTED_OPEN_STATUS = true;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    // [Execution]
+    QMappedFileStream stream(INPUT_PATH, OPEN_MODE, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK(errorInfo == EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(stream.IsOpen(), EXPECTED_OPEN_STATUS);
+    BOOST_CHECK(stream.GetPath() == INPUT_PATH);
+}
+
+/// <summary>
+/// Checks that it returns DoesNotExist when the file does not exist and the open mode is Open.
+/// </summary>
+QTEST_CASE ( Constructor2_ReturnsDoesNotExistWhenFileDoesNotExistAndOpenModeIsOpen_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./NonexistentFile.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_Open;
+    const EQFileSystemError EXPECTED_RESULT = EQFileSystemError::E_DoesNotExist;
+    const bool EXPECTED_OPEN_STATUS = false;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    // [Execution]
+    QMappedFileStream stream(INPUT_PATH, OPEN_MODE, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK(errorInfo == EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(stream.IsOpen(), EXPECTED_OPEN_STATUS);
+}
+
+/// <summary>
+/// Checks that it returns AlreadyExists when the file exists and the open mode is Create.
+/// </summary>
+QTEST_CASE ( Constructor2_ReturnsAlreadyExistsWhenFileExistsAndOpenModeIsCreate_Test )
+{
+    // Assuming the existence of:
+    // -./ExistingFile.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./ExistingFile.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_Create;
+    const EQFileSystemError EXPECTED_RESULT = EQFileSystemError::E_AlreadyExists;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    // [Execution]
+    QMappedFileStream stream(INPUT_PATH, OPEN_MODE, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK(errorInfo == EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that the length of the stream is the size of the file.
+/// </summary>
+QTEST_CASE ( Constructor2_LengthOfStreamIsFileSize_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_Open;
+    const pointer_uint_q EXPECTED_LENGTH = 8U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    // [Execution]
+    QMappedFileStream stream(INPUT_PATH, OPEN_MODE, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that the length of the stream is zero when the file is overwritten.
+/// </summary>
+QTEST_CASE ( Constructor2_LengthIsZeroWhenOpenModeIsCreateOrOverwrite_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToReplace.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_CreateOrOverwrite;
+    const pointer_uint_q EXPECTED_LENGTH = 0;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    {
+        QMappedFileStream previousStream(INPUT_PATH, OPEN_MODE, errorInfo);
+        previousStream.Write("ABCD", 0, 4U);
+    }
+
+    // [Execution]
+    QMappedFileStream stream(INPUT_PATH, OPEN_MODE, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that the position is set at the end of the stream when the open mode is Append.
+/// </summary>
+QTEST_CASE ( Constructor2_PositionIsSetAtTheEndWhenOpenModeIsAppend_Test )
+{
+    // Assuming the existence of:
+    // -./ExistingFile.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./ExistingFile.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_Append;
+    const pointer_uint_q EXPECTED_POSITION = 4U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    // [Execution]
+    QMappedFileStream stream(INPUT_PATH, OPEN_MODE, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that an empty file can be opened.
+/// </summary>
+QTEST_CASE ( Constructor2_EmptyFileCanBeOpened_Test )
+{
+    // Assuming the existence of:
+    // -./EmptyFile.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./EmptyFile.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_Open;
+    const EQFileSystemError EXPECTED_RESULT = EQFileSystemError::E_Success;
+    const pointer_uint_q EXPECTED_LENGTH = 0;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    // [Execution]
+    QMappedFileStream stream(INPUT_PATH, OPEN_MODE, errorInfo);
+
+    // [Verification]
+    BOOST_CHECK(errorInfo == EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that the stream is flushed and the file is truncated to the length of the stream before it is destroyed.
+/// </summary>
+QTEST_CASE ( Destructor_FileIsTruncatedToLengthOfStream_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./DestroyedStream.txt");
+    const EQFileOpenMode OPEN_MODE = EQFileOpenMode::E_CreateOrOverwrite;
+    const u64_q EXPECTED_SIZE = 7U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+
+    {
+        QMappedFileStream stream(INPUT_PATH, OPEN_MODE, errorInfo);
+        stream.Write("ABCD", 0, 4U);
+        stream.Write("EFG", 0, 3U);
+
+    // [Execution]
+    } // Destructor called
+
+    // [Verification]
+    QFileInfo fileInfo = SQFile::GetFileInfo(INPUT_PATH, errorInfo);
+    BOOST_CHECK_EQUAL(fileInfo.GetSize(), EXPECTED_SIZE);
+}
+
+/// <summary>
+/// Checks that the complete stream can be read.
+/// </summary>
+QTEST_CASE ( Read_TheCompleteStreamCanBeRead_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const string_q EXPECTED_CONTENT("ABCDEFGH");
+    const pointer_uint_q READ_BLOCK_SIZE = 8U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+
+    // [Execution]
+    char szContent[] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    stream.Read(szContent, 0, READ_BLOCK_SIZE);
+
+    // [Verification]
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+}
+
+/// <summary>
+/// Checks that output offset affects the result.
+/// </summary>
+QTEST_CASE ( Read_OutputOffsetAffectsTheResult_Test )
+{
+    // Assuming the existence of:
+    // -./ExistingFile.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./ExistingFile.txt");
+    const pointer_uint_q OUTPUT_OFFSET = 2U;
+    const string_q EXPECTED_CONTENT("XXAB");
+    const pointer_uint_q READ_BLOCK_SIZE = 2U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+
+    // [Execution]
+    char szContent[] = {'X', 'X', 'X', 'X', 0};
+    stream.Read(szContent, OUTPUT_OFFSET, READ_BLOCK_SIZE);
+
+    // [Verification]
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+}
+
+/// <summary>
+/// Checks that the read pointer is moved forward after every read operation.
+/// </summary>
+QTEST_CASE ( Read_InternalPointerIsMovedForwardAutomatically_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const string_q EXPECTED_CONTENT("CDE");
+    const pointer_uint_q EXPECTED_POSITION = 5U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+
+    // [Execution]
+    char szContent[] = {0, 0, 0, 0};
+    stream.Read(szContent, 0, 2U);
+    stream.Read(szContent, 0, 3U);
+
+    // [Verification]
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that the stream can be read by a binary stream reader.
+/// </summary>
+QTEST_CASE ( Read_StreamCanBeReadByBinaryStreamReader_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const u32_q EXPECTED_VALUE = *rcast_q("EFGH", const u32_q*);
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+    stream.SetPosition(4U);
+    QBinaryStreamReader<QMappedFileStream> reader(stream);
+
+    // [Execution]
+    u32_q uValue = 0;
+    reader >> uValue;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the stream grows when writing beyond its end and that the content can be read back.
+/// </summary>
+QTEST_CASE ( Write_StreamGrowsWhenWritingAtTheEnd_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./WrittenFile.txt");
+    const string_q EXPECTED_CONTENT("ABCDEFGHIJ");
+    const pointer_uint_q EXPECTED_LENGTH = 10U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, errorInfo);
+
+    // [Execution]
+    stream.Write("ABCD", 0, 4U);
+    stream.Write("EFGHIJ", 0, 6U);
+
+    // [Verification]
+    char szContent[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    stream.SetPosition(0);
+    stream.Read(szContent, 0, EXPECTED_LENGTH);
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that the content of the stream is overwritten when the position is not at the end.
+/// </summary>
+QTEST_CASE ( Write_ContentIsOverwrittenWhenPositionIsNotAtTheEnd_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./OverwrittenFile.txt");
+    const string_q EXPECTED_CONTENT("ABXYZF");
+    const pointer_uint_q EXPECTED_LENGTH = 6U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, errorInfo);
+    stream.Write("ABCDEF", 0, 6U);
+    stream.SetPosition(2U);
+
+    // [Execution]
+    stream.Write("XYZ", 0, 3U);
+
+    // [Verification]
+    char szContent[] = {0, 0, 0, 0, 0, 0, 0};
+    stream.SetPosition(0);
+    stream.Read(szContent, 0, EXPECTED_LENGTH);
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that the written content is stored in the file once it is closed.
+/// </summary>
+QTEST_CASE ( Write_ContentIsStoredInFileWhenClosed_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./ClosedFile.txt");
+    const string_q EXPECTED_CONTENT("ABCDEFGH");
+    const pointer_uint_q EXPECTED_LENGTH = 8U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, errorInfo);
+    stream.Write("ABCDEFGH", 0, 8U);
+
+    // [Execution]
+    stream.Close();
+
+    // [Verification]
+    char szContent[] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    stream.Open(INPUT_PATH, EQFileOpenMode::E_Open);
+    stream.Read(szContent, 0, EXPECTED_LENGTH);
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that the content that does not fit in the mapped window is written and read through several windows.
+/// </summary>
+QTEST_CASE ( Write_ContentLargerThanWindowIsReadAsItWasWritten_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./WindowedFile.txt");
+    const pointer_uint_q WINDOW_SIZE = 1U; // It is rounded up to the allocation granularity
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, errorInfo, WINDOW_SIZE);
+    const pointer_uint_q CONTENT_LENGTH = stream.GetWindowSize() * 3U + 5U;
+    u8_q* arInput = new u8_q[CONTENT_LENGTH];
+    u8_q* arOutput = new u8_q[CONTENT_LENGTH];
+
+    for(pointer_uint_q i = 0; i < CONTENT_LENGTH; ++i)
+    {
+        arInput[i] = scast_q(i % 251U, u8_q);
+        arOutput[i] = 0;
+    }
+
+    // [Execution]
+    stream.Write(arInput, 0, CONTENT_LENGTH);
+    stream.Close();
+    stream.Open(INPUT_PATH, EQFileOpenMode::E_Open, WINDOW_SIZE);
+    stream.Read(arOutput, 0, CONTENT_LENGTH);
+
+    // [Verification]
+    BOOST_CHECK(memcmp(arInput, arOutput, CONTENT_LENGTH) == 0);
+    BOOST_CHECK_EQUAL(stream.GetLength(), CONTENT_LENGTH);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), CONTENT_LENGTH);
+
+    delete[] arInput;
+    delete[] arOutput;
+}
+
+/// <summary>
+/// Checks that the content of an existing file is overwritten.
+/// </summary>
+QTEST_CASE ( Write_ExistingFileIsOverwritten_Test )
+{
+    // Assuming the existence of:
+    // -./FileToWrite.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToWrite.txt");
+    const string_q EXPECTED_CONTENT("ABCXYFGH");
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+    stream.SetPosition(3U);
+
+    // [Execution]
+    stream.Write("XY", 0, 2U);
+    stream.Close();
+
+    // [Verification]
+    char szContent[] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    stream.Open(INPUT_PATH, EQFileOpenMode::E_Open);
+    stream.Read(szContent, 0, 8U);
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input size is zero.
+/// </summary>
+QTEST_CASE ( Write_AssertionFailsWhenInputSizeIsZero_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./WrittenFile2.txt");
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, errorInfo);
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        stream.Write("ABCD", 0, 0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the written content can be read from the file after flushing, while the stream is still open.
+/// </summary>
+QTEST_CASE ( Flush_ContentIsSentToFile_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FlushedFile.txt");
+    const string_q EXPECTED_CONTENT("ABCD");
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, errorInfo);
+    stream.Write("ABCD", 0, 4U);
+
+    // [Execution]
+    stream.Flush();
+
+    // [Verification]
+    char szContent[] = {0, 0, 0, 0, 0};
+    QMappedFileStream otherStream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+    otherStream.Read(szContent, 0, 4U);
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+}
+
+/// <summary>
+/// Checks that the internal pointer is moved backward.
+/// </summary>
+QTEST_CASE ( MoveBackward_InternalPointerIsMovedBackward_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const pointer_uint_q EXPECTED_POSITION = 3U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+    stream.SetPosition(5U);
+
+    // [Execution]
+    stream.MoveBackward(2U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that the internal pointer is moved forward.
+/// </summary>
+QTEST_CASE ( MoveForward_InternalPointerIsMovedForward_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const pointer_uint_q EXPECTED_POSITION = 5U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+    stream.SetPosition(2U);
+
+    // [Execution]
+    stream.MoveForward(3U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that the stream can be opened again after it is closed.
+/// </summary>
+QTEST_CASE ( Close_StreamCanBeReopened_Test )
+{
+    // Assuming the existence of:
+    // -./ExistingFile.txt
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH1(PATH_TO_ARTIFACTS + "./ExistingFile.txt");
+    const QPath INPUT_PATH2(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const EQFileSystemError EXPECTED_RESULT = EQFileSystemError::E_Success;
+    const pointer_uint_q EXPECTED_LENGTH = 8U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH1, EQFileOpenMode::E_Open, errorInfo);
+
+    // [Execution]
+    stream.Close();
+    errorInfo = stream.Open(INPUT_PATH2, EQFileOpenMode::E_Open);
+
+    // [Verification]
+    BOOST_CHECK(errorInfo == EXPECTED_RESULT);
+    BOOST_CHECK(stream.IsOpen());
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that the stream is closed.
+/// </summary>
+QTEST_CASE ( Close_StreamIsClosed_Test )
+{
+    // Assuming the existence of:
+    // -./ExistingFile.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./ExistingFile.txt");
+    const bool EXPECTED_OPEN_STATUS = false;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+
+    // [Execution]
+    stream.Close();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.IsOpen(), EXPECTED_OPEN_STATUS);
+}
+
+/// <summary>
+/// Checks that the content of the stream is copied to another stream.
+/// </summary>
+QTEST_CASE ( CopyTo_ContentIsCopiedToDestinationStream_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const string_q EXPECTED_CONTENT("CDEFG");
+    const pointer_uint_q SOURCE_OFFSET = 2U;
+    const pointer_uint_q DESTINATION_OFFSET = 0;
+    const pointer_uint_q NUMBER_OF_BYTES = 5U;
+    const pointer_uint_q BATCH_SIZE = 2U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream sourceStream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+    QMemoryStream<> destinationStream(4U);
+
+    // [Execution]
+    sourceStream.CopyTo(destinationStream, SOURCE_OFFSET, DESTINATION_OFFSET, NUMBER_OF_BYTES, BATCH_SIZE);
+
+    // [Verification]
+    char szContent[] = {0, 0, 0, 0, 0, 0};
+    destinationStream.SetPosition(0);
+    destinationStream.Read(szContent, 0, NUMBER_OF_BYTES);
+    BOOST_CHECK(string_q(szContent) == EXPECTED_CONTENT);
+    BOOST_CHECK_EQUAL(sourceStream.GetPosition(), SOURCE_OFFSET + NUMBER_OF_BYTES);
+}
+
+/// <summary>
+/// Checks that it returns a pointer to the mapped byte the internal pointer points to.
+/// </summary>
+QTEST_CASE ( GetCurrentPointer_ReturnsPointerToByteAtCurrentPosition_Test )
+{
+    // Assuming the existence of:
+    // -./FileToRead.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./FileToRead.txt");
+    const char EXPECTED_FIRST_BYTE = 'A';
+    const char EXPECTED_BYTE = 'F';
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+
+    // [Execution]
+    const char* pFirstByte = scast_q(stream.GetCurrentPointer(), const char*);
+    stream.SetPosition(5U);
+    const char* pByte = scast_q(stream.GetCurrentPointer(), const char*);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*pFirstByte, EXPECTED_FIRST_BYTE);
+    BOOST_CHECK_EQUAL(*pByte, EXPECTED_BYTE);
+    BOOST_CHECK_EQUAL(pByte - pFirstByte, 5);
+}
+
+/// <summary>
+/// Checks that the window that contains the current position is mapped when the position is outside of the mapped window.
+/// </summary>
+QTEST_CASE ( GetCurrentPointer_WindowThatContainsCurrentPositionIsMapped_Test )
+{
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./WindowedPointerFile.txt");
+    const pointer_uint_q WINDOW_SIZE = 1U; // It is rounded up to the allocation granularity
+    const u8_q EXPECTED_BYTE = 7U;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_CreateOrOverwrite, errorInfo, WINDOW_SIZE);
+    const pointer_uint_q CONTENT_LENGTH = stream.GetWindowSize() * 2U;
+    const pointer_uint_q POSITION = stream.GetWindowSize() + 1U;
+    const pointer_uint_q EXPECTED_ACCESSIBLE_BYTES = CONTENT_LENGTH - POSITION;
+    u8_q* arInput = new u8_q[CONTENT_LENGTH];
+    memset(arInput, 0, CONTENT_LENGTH);
+    arInput[POSITION] = EXPECTED_BYTE;
+    stream.Write(arInput, 0, CONTENT_LENGTH);
+    stream.SetPosition(0);
+    stream.GetCurrentPointer();
+
+    // [Execution]
+    stream.SetPosition(POSITION);
+    const u8_q* pByte = scast_q(stream.GetCurrentPointer(), const u8_q*);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*pByte, EXPECTED_BYTE);
+    BOOST_CHECK_EQUAL(stream.GetAccessibleBytes(), EXPECTED_ACCESSIBLE_BYTES);
+
+    delete[] arInput;
+}
+
+/// <summary>
+/// Checks that it returns null when the stream is empty.
+/// </summary>
+QTEST_CASE ( GetCurrentPointer_ReturnsNullWhenStreamIsEmpty_Test )
+{
+    // Assuming the existence of:
+    // -./EmptyFile.txt
+
+    // [Preparation]
+    const QPath INPUT_PATH(PATH_TO_ARTIFACTS + "./EmptyFile.txt");
+    const void* EXPECTED_POINTER = null_q;
+    EQFileSystemError errorInfo = EQFileSystemError::E_Unknown;
+    QMappedFileStream stream(INPUT_PATH, EQFileOpenMode::E_Open, errorInfo);
+
+    // [Execution]
+    void* pPointer = stream.GetCurrentPointer();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pPointer, EXPECTED_POINTER);
+}
+
+// End - Test Suite: QMappedFileStream
+QTEST_SUITE_END()
@@ -0,0 +1,438 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QMemoryStreamView.h"
+
+#include "QMemoryStream.h"
+#include "QBinaryStreamReader.h"
+#include "QTextStreamReader.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::System::IO::QMemoryStreamView;
+using Kinesis::QuimeraEngine::System::IO::QMemoryStream;
+using Kinesis::QuimeraEngine::System::IO::QBinaryStreamReader;
+using Kinesis::QuimeraEngine::System::IO::QTextStreamReader;
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::EQTextEncoding;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+
+
+QTEST_SUITE_BEGIN( QMemoryStreamView_TestSuite )
+
+/// <summary>
+/// Checks that the view is read-only and its length equals the size of the buffer when it is created from a constant buffer.
+/// </summary>
+QTEST_CASE ( Constructor1_ItIsReadOnlyAndLengthEqualsBufferSize_Test )
+{
+    // [Preparation]
+    const u8_q BUFFER[] = {1, 2, 3, 4};
+    const pointer_uint_q BUFFER_SIZE = sizeof(BUFFER);
+    const pointer_uint_q EXPECTED_LENGTH = BUFFER_SIZE;
+    const pointer_uint_q EXPECTED_POSITION = 0;
+    const bool IS_READ_ONLY = true;
+
+    // [Execution]
+    QMemoryStreamView stream(BUFFER, BUFFER_SIZE);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+    BOOST_CHECK_EQUAL(stream.GetCapacity(), EXPECTED_LENGTH);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+    BOOST_CHECK_EQUAL(stream.IsReadOnly(), IS_READ_ONLY);
+}
+
+/// <summary>
+/// Checks that the buffer is not copied.
+/// </summary>
+QTEST_CASE ( Constructor1_BufferIsNotCopied_Test )
+{
+    // [Preparation]
+    const u8_q BUFFER[] = {1, 2, 3, 4};
+    const void* EXPECTED_POINTER = BUFFER;
+
+    // [Execution]
+    QMemoryStreamView stream(BUFFER, sizeof(BUFFER));
+    
+    // [Verification]
+    const void* pPointer = stream.GetCurrentPointer();
+    BOOST_CHECK_EQUAL(pPointer, EXPECTED_POINTER);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input buffer is null.
+/// </summary>
+QTEST_CASE ( Constructor1_AssertionFailsWhenInputBufferIsNull_Test )
+{
+    // [Preparation]
+    const void* NULL_BUFFER = null_q;
+    const pointer_uint_q BUFFER_SIZE = 4U;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QMemoryStreamView stream(NULL_BUFFER, BUFFER_SIZE);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the view is writable and its length and capacity are correctly set when it is created from a non-constant buffer.
+/// </summary>
+QTEST_CASE ( Constructor2_ItIsWritableAndLengthAndCapacityAreCorrectlySet_Test )
+{
+    // [Preparation]
+    u8_q arBuffer[] = {1, 2, 3, 4};
+    const pointer_uint_q BUFFER_SIZE = sizeof(arBuffer);
+    const pointer_uint_q INPUT_LENGTH = 1U;
+    const bool IS_READ_ONLY = false;
+
+    // [Execution]
+    QMemoryStreamView stream(arBuffer, BUFFER_SIZE, INPUT_LENGTH);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(stream.GetLength(), INPUT_LENGTH);
+    BOOST_CHECK_EQUAL(stream.GetCapacity(), BUFFER_SIZE);
+    BOOST_CHECK_EQUAL(stream.IsReadOnly(), IS_READ_ONLY);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input length is greater than the size of the buffer.
+/// </summary>
+QTEST_CASE ( Constructor2_AssertionFailsWhenLengthIsGreaterThanBufferSize_Test )
+{
+    // [Preparation]
+    u8_q arBuffer[] = {1, 2, 3, 4};
+    const pointer_uint_q INPUT_LENGTH = sizeof(arBuffer) + 1U;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QMemoryStreamView stream(arBuffer, sizeof(arBuffer), INPUT_LENGTH);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the bytes are read from the external buffer and the position is moved forward.
+/// </summary>
+QTEST_CASE ( Read_BytesAreReadAndPositionIsMovedForward_Test )
+{
+    // [Preparation]
+    const u8_q BUFFER[] = {1, 2, 3, 4};
+    const u8_q EXPECTED_BYTES[] = {2, 3};
+    const pointer_uint_q EXPECTED_POSITION = 3U;
+    QMemoryStreamView stream(BUFFER, sizeof(BUFFER));
+    stream.SetPosition(1U);
+    u8_q arOutput[2] = {0, 0};
+
+    // [Execution]
+    stream.Read(arOutput, 0, sizeof(arOutput));
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arOutput, arOutput + 2U, EXPECTED_BYTES, EXPECTED_BYTES + 2U);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that the bytes are written to the external buffer and the length grows.
+/// </summary>
+QTEST_CASE ( Write_BytesAreWrittenToTheBufferAndLengthGrows_Test )
+{
+    // [Preparation]
+    u8_q arBuffer[] = {0, 0, 0, 0};
+    const u8_q INPUT_BYTES[] = {5, 6, 7};
+    const u8_q EXPECTED_BYTES[] = {5, 6, 7, 0};
+    const pointer_uint_q EXPECTED_LENGTH = 3U;
+    QMemoryStreamView stream(arBuffer, sizeof(arBuffer), 0);
+
+    // [Execution]
+    stream.Write(INPUT_BYTES, 0, sizeof(INPUT_BYTES));
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arBuffer, arBuffer + 4U, EXPECTED_BYTES, EXPECTED_BYTES + 4U);
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that existing bytes are overwritten and the length does not change when the position is not at the end.
+/// </summary>
+QTEST_CASE ( Write_BytesAreOverwrittenWhenPositionIsNotAtTheEnd_Test )
+{
+    // [Preparation]
+    u8_q arBuffer[] = {1, 2, 3, 4};
+    const u8_q INPUT_BYTES[] = {8, 9};
+    const u8_q EXPECTED_BYTES[] = {1, 8, 9, 4};
+    const pointer_uint_q EXPECTED_LENGTH = 4U;
+    QMemoryStreamView stream(arBuffer, sizeof(arBuffer), sizeof(arBuffer));
+    stream.SetPosition(1U);
+
+    // [Execution]
+    stream.Write(INPUT_BYTES, 0, sizeof(INPUT_BYTES));
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arBuffer, arBuffer + 4U, EXPECTED_BYTES, EXPECTED_BYTES + 4U);
+    BOOST_CHECK_EQUAL(stream.GetLength(), EXPECTED_LENGTH);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when writing to a read-only view.
+/// </summary>
+QTEST_CASE ( Write_AssertionFailsWhenStreamIsReadOnly_Test )
+{
+    // [Preparation]
+    const u8_q BUFFER[] = {1, 2, 3, 4};
+    const u8_q INPUT_BYTE = 5;
+    const bool ASSERTION_FAILED = true;
+    QMemoryStreamView stream(BUFFER, sizeof(BUFFER));
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        stream.Write(&INPUT_BYTE, 0, sizeof(INPUT_BYTE));
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the bytes do not fit in the buffer.
+/// </summary>
+QTEST_CASE ( Write_AssertionFailsWhenBytesDoNotFitInTheBuffer_Test )
+{
+    // [Preparation]
+    u8_q arBuffer[] = {0, 0};
+    const u8_q INPUT_BYTES[] = {5, 6, 7};
+    const bool ASSERTION_FAILED = true;
+    QMemoryStreamView stream(arBuffer, sizeof(arBuffer), 0);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        stream.Write(INPUT_BYTES, 0, sizeof(INPUT_BYTES));
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the bytes are copied to another kind of stream from the source offset.
+/// </summary>
+QTEST_CASE ( CopyTo_BytesAreCopiedToOtherStreamFromTheSourceOffset_Test )
+{
+    // [Preparation]
+    const u8_q BUFFER[] = {1, 2, 3, 4, 5};
+    const u8_q EXPECTED_BYTES[] = {2, 3, 4, 5};
+    const pointer_uint_q SOURCE_OFFSET = 1U;
+    const pointer_uint_q NUMBER_OF_BYTES = 4U;
+    const pointer_uint_q BATCH_SIZE = 3U;
+    QMemoryStreamView stream(BUFFER, sizeof(BUFFER));
+    QMemoryStream<> destinationStream(1U);
+
+    // [Execution]
+    stream.CopyTo(destinationStream, SOURCE_OFFSET, 0, NUMBER_OF_BYTES, BATCH_SIZE);
+    
+    // [Verification]
+    const u8_q* pResult = static_cast<const u8_q*>(destinationStream.GetCurrentPointer()) - NUMBER_OF_BYTES;
+    BOOST_CHECK_EQUAL(destinationStream.GetLength(), NUMBER_OF_BYTES);
+    BOOST_CHECK_EQUAL_COLLECTIONS(pResult, pResult + NUMBER_OF_BYTES, EXPECTED_BYTES, EXPECTED_BYTES + NUMBER_OF_BYTES);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), SOURCE_OFFSET + NUMBER_OF_BYTES);
+}
+
+/// <summary>
+/// Checks that the slice refers to the same memory as the view.
+/// </summary>
+QTEST_CASE ( Slice_SliceRefersToTheSameMemory_Test )
+{
+    // [Preparation]
+    const u8_q BUFFER[] = {1, 2, 3, 4, 5};
+    const pointer_uint_q OFFSET = 1U;
+    const pointer_uint_q LENGTH = 3U;
+    const void* EXPECTED_POINTER = BUFFER + OFFSET;
+    const bool IS_READ_ONLY = true;
+    QMemoryStreamView stream(BUFFER, sizeof(BUFFER));
+
+    // [Execution]
+    QMemoryStreamView slice = stream.Slice(OFFSET, LENGTH);
+    
+    // [Verification]
+    const void* pPointer = slice.GetCurrentPointer();
+    BOOST_CHECK_EQUAL(pPointer, EXPECTED_POINTER);
+    BOOST_CHECK_EQUAL(slice.GetLength(), LENGTH);
+    BOOST_CHECK_EQUAL(slice.GetPosition(), 0U);
+    BOOST_CHECK_EQUAL(slice.IsReadOnly(), IS_READ_ONLY);
+}
+
+/// <summary>
+/// Checks that writing to the slice of a writable view cannot exceed the limits of the slice.
+/// </summary>
+QTEST_CASE ( Slice_WritableSliceCannotGrowBeyondItsLength_Test )
+{
+    // [Preparation]
+    u8_q arBuffer[] = {1, 2, 3, 4, 5};
+    const u8_q INPUT_BYTES[] = {8, 9};
+    const u8_q EXPECTED_BYTES[] = {1, 2, 3, 8, 9};
+    QMemoryStreamView stream(arBuffer, sizeof(arBuffer), sizeof(arBuffer));
+
+    // [Execution]
+    QMemoryStreamView slice = stream.Slice(2U, 3U);
+    slice.SetPosition(1U);
+    slice.Write(INPUT_BYTES, 0, sizeof(INPUT_BYTES));
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(slice.GetCapacity(), 3U);
+    BOOST_CHECK_EQUAL(slice.GetLength(), 3U);
+    BOOST_CHECK_EQUAL_COLLECTIONS(arBuffer, arBuffer + 5U, EXPECTED_BYTES, EXPECTED_BYTES + 5U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the slice exceeds the limits of the stream.
+/// </summary>
+QTEST_CASE ( Slice_AssertionFailsWhenSliceExceedsTheLimitsOfTheStream_Test )
+{
+    // [Preparation]
+    const u8_q BUFFER[] = {1, 2, 3, 4, 5};
+    const bool ASSERTION_FAILED = true;
+    QMemoryStreamView stream(BUFFER, sizeof(BUFFER));
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        stream.Slice(3U, 3U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that a binary reader can read values from the view.
+/// </summary>
+QTEST_CASE ( QBinaryStreamReader_ValuesAreReadFromTheView_Test )
+{
+    // [Preparation]
+    const u32_q BUFFER[] = {0x01020304U, 0x05060708U};
+    const u32_q EXPECTED_VALUE = 0x05060708U;
+    QMemoryStreamView stream(BUFFER, sizeof(BUFFER));
+    QMemoryStreamView slice = stream.Slice(sizeof(u32_q), sizeof(u32_q));
+    QBinaryStreamReader<QMemoryStreamView> reader(slice);
+    u32_q uValue = 0;
+
+    // [Execution]
+    reader >> uValue;
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that a text reader can read lines from the view.
+/// </summary>
+QTEST_CASE ( QTextStreamReader_LinesAreReadFromTheView_Test )
+{
+    // [Preparation]
+    const i8_q BUFFER[] = {'A', 'B', '\n', 'C', 'D'};
+    const string_q EXPECTED_FIRST_LINE = "AB";
+    const string_q EXPECTED_SECOND_LINE = "CD";
+    QMemoryStreamView stream(BUFFER, sizeof(BUFFER));
+    QTextStreamReader<QMemoryStreamView> reader(stream, EQTextEncoding::E_ASCII);
+    string_q strFirstLine;
+    string_q strSecondLine;
+
+    // [Execution]
+    reader.ReadLine(strFirstLine);
+    reader.ReadLine(strSecondLine);
+    
+    // [Verification]
+    BOOST_CHECK(strFirstLine == EXPECTED_FIRST_LINE);
+    BOOST_CHECK(strSecondLine == EXPECTED_SECOND_LINE);
+}
+
+// End - Test Suite: QMemoryStreamView
+QTEST_SUITE_END()
@@ -0,0 +1,342 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QProfiler.h"
+#include "QScopedProfilerSample.h"
+#include "QThread.h"
+
+using Kinesis::QuimeraEngine::System::Diagnosis::QProfiler;
+using Kinesis::QuimeraEngine::System::Diagnosis::QScopedProfilerSample;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+
+
+// Function executed by a secondary thread in the tests of QProfiler
+void RecordSampleInOtherThread_TestMethod()
+{
+    QScopedProfilerSample sample("OtherThreadScope");
+}
+
+// Function executed by a secondary thread that starts after another secondary thread has finished, in the tests of QProfiler
+void RecordSampleInLaterThread_TestMethod()
+{
+    QScopedProfilerSample sample("LaterThreadScope");
+}
+
+// Gets the number that identifies the thread of the first sample with the given name in a Chrome trace
+string_q GetThreadIndexOfSample_TestMethod(const string_q &strTrace, const string_q &strSampleName)
+{
+    const string_q THREAD_INDEX_PREFIX("\"tid\":");
+    const int SAMPLE_POSITION = strTrace.IndexOf(strSampleName);
+    const int THREAD_INDEX_POSITION = strTrace.IndexOf(THREAD_INDEX_PREFIX, SAMPLE_POSITION) + THREAD_INDEX_PREFIX.GetLength();
+    const int THREAD_INDEX_END = strTrace.IndexOf("}", THREAD_INDEX_POSITION);
+
+    return strTrace.Substring(THREAD_INDEX_POSITION, THREAD_INDEX_END - 1);
+}
+
+
+QTEST_SUITE_BEGIN( QProfiler_TestSuite )
+
+/// <summary>
+/// Checks that the same instance is always returned.
+/// </summary>
+QTEST_CASE ( Get_SameInstanceIsAlwaysReturned_Test )
+{
+    // [Preparation]
+    QProfiler* pExpectedInstance = QProfiler::Get();
+
+    // [Execution]
+    QProfiler* pInstance = QProfiler::Get();
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(pInstance, pExpectedInstance);
+}
+
+/// <summary>
+/// Checks that a sample is recorded when a scope ends and that it is exported as a complete event.
+/// </summary>
+QTEST_CASE ( EndSample_SampleIsRecordedAndExportedAsCompleteEvent_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q EXPECTED_EVENT("{\"name\":\"Scope\",\"cat\":\"QE\",\"ph\":\"X\",\"ts\":");
+
+    // [Execution]
+    const u64_q START = QProfiler::Get()->BeginSample();
+    QProfiler::Get()->EndSample("Scope", START);
+    
+    // [Verification]
+    string_q strTrace = QProfiler::Get()->ExportToChromeTrace();
+    BOOST_CHECK(strTrace.Contains(EXPECTED_EVENT));
+}
+
+/// <summary>
+/// Checks that only the most recent samples are exported when a thread records more samples than fit in its ring buffer.
+/// </summary>
+QTEST_CASE ( EndSample_OldestSamplesAreOverwrittenWhenRingBufferIsFull_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q OLDEST_SAMPLE("\"OldestScope\"");
+    const string_q EXPECTED_SUMMARY = string_q("\nOtherScope | calls: ") + string_q::FromInteger(QProfiler::SAMPLES_PER_THREAD - 1U) + " |";
+
+    // [Execution]
+    {
+        QScopedProfilerSample sample("OldestScope");
+    }
+
+    for(u32_q i = 0; i < QProfiler::SAMPLES_PER_THREAD; ++i)
+    {
+        QScopedProfilerSample sample("OtherScope");
+    }
+    
+    // [Verification]
+    string_q strTrace = QProfiler::Get()->ExportToChromeTrace();
+    string_q strSummary = QProfiler::Get()->GetSummary();
+    BOOST_CHECK(!strTrace.Contains(OLDEST_SAMPLE));
+    BOOST_CHECK(strSummary.Contains(EXPECTED_SUMMARY));
+}
+
+/// <summary>
+/// Checks that samples recorded before clearing the profiler are discarded.
+/// </summary>
+QTEST_CASE ( Clear_RecordedSamplesAreDiscarded_Test )
+{
+    // [Preparation]
+    const string_q DISCARDED_SAMPLE("DiscardedScope");
+    const string_q EXPECTED_SAMPLE("KeptScope");
+
+    {
+        QScopedProfilerSample sample("DiscardedScope");
+    }
+
+    // [Execution]
+    QProfiler::Get()->Clear();
+    
+    // [Verification]
+    {
+        QScopedProfilerSample sample("KeptScope");
+    }
+
+    string_q strTrace = QProfiler::Get()->ExportToChromeTrace();
+    BOOST_CHECK(!strTrace.Contains(DISCARDED_SAMPLE));
+    BOOST_CHECK(strTrace.Contains(EXPECTED_SAMPLE));
+}
+
+/// <summary>
+/// Checks that the trace is a valid JSON object with an empty list of events when there are no samples.
+/// </summary>
+QTEST_CASE ( ExportToChromeTrace_TraceHasNoEventsWhenThereAreNoSamples_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q EXPECTED_TRACE("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}");
+
+    // [Execution]
+    string_q strTrace = QProfiler::Get()->ExportToChromeTrace();
+    
+    // [Verification]
+    BOOST_CHECK(strTrace == EXPECTED_TRACE);
+}
+
+/// <summary>
+/// Checks that quotation marks, backslashes and control characters in the names of the scopes are escaped.
+/// </summary>
+QTEST_CASE ( ExportToChromeTrace_SpecialCharactersAreEscaped_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q EXPECTED_NAME("\"name\":\"A\\\"B\\\\C\\u0009D\"");
+
+    {
+        QScopedProfilerSample sample("A\"B\\C\tD");
+    }
+
+    // [Execution]
+    string_q strTrace = QProfiler::Get()->ExportToChromeTrace();
+    
+    // [Verification]
+    BOOST_CHECK(strTrace.Contains(EXPECTED_NAME));
+}
+
+/// <summary>
+/// Checks that the samples of every thread are exported, identifying every thread with a different number.
+/// </summary>
+QTEST_CASE ( ExportToChromeTrace_SamplesOfAllThreadsAreExported_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q EXPECTED_SAMPLE("\"OtherThreadScope\"");
+    const string_q EXPECTED_CURRENT_THREAD_SAMPLE("\"CurrentThreadScope\"");
+    const string_q THREAD_NAME_EVENT("\"thread_name\"");
+
+    {
+        QScopedProfilerSample sample("CurrentThreadScope");
+    }
+
+    QDelegate<void ()> threadFunction(&RecordSampleInOtherThread_TestMethod);
+    QThread thread(threadFunction);
+    thread.Join();
+
+    // [Execution]
+    string_q strTrace = QProfiler::Get()->ExportToChromeTrace();
+    
+    // [Verification]
+    const int FIRST_THREAD_NAME = strTrace.IndexOf(THREAD_NAME_EVENT);
+    const int SECOND_THREAD_NAME = strTrace.IndexOf(THREAD_NAME_EVENT, FIRST_THREAD_NAME + 1);
+    BOOST_CHECK(strTrace.Contains(EXPECTED_SAMPLE));
+    BOOST_CHECK(strTrace.Contains(EXPECTED_CURRENT_THREAD_SAMPLE));
+    BOOST_CHECK(SECOND_THREAD_NAME != string_q::PATTERN_NOT_FOUND);
+}
+
+/// <summary>
+/// Checks that a thread that reuses the ring buffer of a finished thread is identified with a different number.
+/// </summary>
+QTEST_CASE ( ExportToChromeTrace_ThreadThatReusesRingBufferOfFinishedThreadIsIdentifiedWithDifferentNumber_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q FINISHED_THREAD_SAMPLE("\"OtherThreadScope\"");
+    const string_q LATER_THREAD_SAMPLE("\"LaterThreadScope\"");
+
+    QDelegate<void ()> finishedThreadFunction(&RecordSampleInOtherThread_TestMethod);
+    QThread finishedThread(finishedThreadFunction);
+    finishedThread.Join();
+
+    const string_q FINISHED_THREAD_INDEX = GetThreadIndexOfSample_TestMethod(QProfiler::Get()->ExportToChromeTrace(), FINISHED_THREAD_SAMPLE);
+
+    // [Execution]
+    QDelegate<void ()> laterThreadFunction(&RecordSampleInLaterThread_TestMethod);
+    QThread laterThread(laterThreadFunction);
+    laterThread.Join();
+    
+    // [Verification]
+    string_q strTrace = QProfiler::Get()->ExportToChromeTrace();
+    BOOST_CHECK(strTrace.Contains(LATER_THREAD_SAMPLE));
+    BOOST_CHECK(GetThreadIndexOfSample_TestMethod(strTrace, LATER_THREAD_SAMPLE) != FINISHED_THREAD_INDEX);
+}
+
+/// <summary>
+/// Checks that the flat profile accumulates the calls of every scope, regardless of the scope that contains it.
+/// </summary>
+QTEST_CASE ( GetSummary_FlatProfileAccumulatesCallsOfEveryScope_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q EXPECTED_OUTER_LINE("Flat profile\n");
+    const string_q EXPECTED_INNER_LINE("\nInner | calls: 3 |");
+
+    {
+        QScopedProfilerSample outerSample("Outer");
+        {
+            QScopedProfilerSample innerSample("Inner");
+        }
+    }
+    {
+        QScopedProfilerSample innerSample("Inner");
+    }
+    {
+        QScopedProfilerSample innerSample("Inner");
+    }
+
+    // [Execution]
+    string_q strSummary = QProfiler::Get()->GetSummary();
+    
+    // [Verification]
+    BOOST_CHECK(strSummary.Contains(EXPECTED_OUTER_LINE));
+    BOOST_CHECK(strSummary.Contains(EXPECTED_INNER_LINE));
+}
+
+/// <summary>
+/// Checks that the hierarchical profile indents every scope under the scope that contains it.
+/// </summary>
+QTEST_CASE ( GetSummary_HierarchicalProfileIndentsContainedScopes_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q EXPECTED_OUTER_LINE("\nOuter | calls: 2 |");
+    const string_q EXPECTED_INNER_LINE("\n  Inner | calls: 4 |");
+    const string_q EXPECTED_DEEPEST_LINE("\n    Deepest | calls: 2 |");
+    const string_q EXPECTED_ROOT_INNER_LINE("\nInner | calls: 1 |");
+
+    for(unsigned int i = 0; i < 2U; ++i)
+    {
+        QScopedProfilerSample outerSample("Outer");
+        {
+            QScopedProfilerSample innerSample("Inner");
+            QScopedProfilerSample deepestSample("Deepest");
+        }
+        {
+            QScopedProfilerSample innerSample("Inner");
+        }
+    }
+    {
+        QScopedProfilerSample innerSample("Inner");
+    }
+
+    // [Execution]
+    string_q strSummary = QProfiler::Get()->GetSummary();
+    
+    // [Verification]
+    const int HIERARCHICAL_PROFILE = strSummary.IndexOf("Hierarchical profile");
+    BOOST_CHECK(strSummary.IndexOf(EXPECTED_OUTER_LINE, HIERARCHICAL_PROFILE) != string_q::PATTERN_NOT_FOUND);
+    BOOST_CHECK(strSummary.IndexOf(EXPECTED_INNER_LINE, HIERARCHICAL_PROFILE) != string_q::PATTERN_NOT_FOUND);
+    BOOST_CHECK(strSummary.IndexOf(EXPECTED_DEEPEST_LINE, HIERARCHICAL_PROFILE) != string_q::PATTERN_NOT_FOUND);
+    BOOST_CHECK(strSummary.IndexOf(EXPECTED_ROOT_INNER_LINE, HIERARCHICAL_PROFILE) != string_q::PATTERN_NOT_FOUND);
+}
+
+/// <summary>
+/// Checks that the time spent in a scope excluding the scopes it contains is not greater than the total time.
+/// </summary>
+QTEST_CASE ( GetSummary_SelfTimeIsNotGreaterThanTotalTime_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+
+    const u64_q OUTER_START = QProfiler::Get()->BeginSample();
+    const u64_q INNER_START = QProfiler::Get()->BeginSample();
+    QProfiler::Get()->EndSample("Inner", INNER_START);
+    QProfiler::Get()->EndSample("Outer", OUTER_START);
+
+    // [Execution]
+    string_q strSummary = QProfiler::Get()->GetSummary();
+    
+    // [Verification]
+    const int TOTAL_POSITION = strSummary.IndexOf("total: ", strSummary.IndexOf("\nOuter")) + 7;
+    const int SELF_POSITION = strSummary.IndexOf("self: ", TOTAL_POSITION) + 6;
+    const u64_q TOTAL_TIME = scast_q(strSummary.Substring(TOTAL_POSITION, strSummary.IndexOf(" ", TOTAL_POSITION) - 1).ToInteger(), u64_q);
+    const u64_q SELF_TIME = scast_q(strSummary.Substring(SELF_POSITION, strSummary.IndexOf(" ", SELF_POSITION) - 1).ToInteger(), u64_q);
+    BOOST_CHECK(SELF_TIME <= TOTAL_TIME);
+}
+
+// End - Test Suite: QProfiler
+QTEST_SUITE_END()
@@ -0,0 +1,79 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QScopedProfilerSample.h"
+#include "QProfiler.h"
+
+using Kinesis::QuimeraEngine::System::Diagnosis::QScopedProfilerSample;
+using Kinesis::QuimeraEngine::System::Diagnosis::QProfiler;
+
+
+QTEST_SUITE_BEGIN( QScopedProfilerSample_TestSuite )
+
+/// <summary>
+/// Checks that no sample is recorded while the instance exists.
+/// </summary>
+QTEST_CASE ( Constructor_SampleIsNotRecordedWhileInstanceExists_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q SCOPE_NAME("\"UnfinishedScope\"");
+
+    // [Execution]
+    QScopedProfilerSample sample("UnfinishedScope");
+    
+    // [Verification]
+    string_q strTrace = QProfiler::Get()->ExportToChromeTrace();
+    BOOST_CHECK(!strTrace.Contains(SCOPE_NAME));
+}
+
+/// <summary>
+/// Checks that a sample is recorded when the instance is destroyed.
+/// </summary>
+QTEST_CASE ( Destructor_SampleIsRecordedWhenInstanceIsDestroyed_Test )
+{
+    // [Preparation]
+    QProfiler::Get()->Clear();
+    const string_q SCOPE_NAME("\"FinishedScope\"");
+
+    // [Execution]
+    {
+        QScopedProfilerSample sample("FinishedScope");
+    }
+    
+    // [Verification]
+    string_q strTrace = QProfiler::Get()->ExportToChromeTrace();
+    BOOST_CHECK(strTrace.Contains(SCOPE_NAME));
+}
+
+// End - Test Suite: QScopedProfilerSample
+QTEST_SUITE_END()
@@ -0,0 +1,555 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QTaskScheduler.h"
+
+#include "QAssertException.h"
+#include "SQThisThread.h"
+#include "QTimeSpan.h"
+
+using Kinesis::QuimeraEngine::System::Threading::QTaskScheduler;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+// Class whose methods are used as tasks in the tests of QTaskScheduler
+class QTaskSchedulerTestClass
+{
+public:
+
+    static const unsigned int MAX_ITERATIONS = 1024U;
+
+    unsigned int m_uCounter;
+    bool m_bFinished;
+    bool m_bPredecessorsFinished;
+    QTaskSchedulerTestClass* m_arPredecessors[2];
+    QTaskScheduler* m_pScheduler;
+    unsigned int m_arIterations[MAX_ITERATIONS];
+
+    QTaskSchedulerTestClass() : m_uCounter(0),
+                                m_bFinished(false),
+                                m_bPredecessorsFinished(false),
+                                m_pScheduler(null_q)
+    {
+        m_arPredecessors[0] = null_q;
+        m_arPredecessors[1] = null_q;
+
+        for(unsigned int i = 0; i < MAX_ITERATIONS; ++i)
+            m_arIterations[i] = 0;
+    }
+
+    void Count()
+    {
+        ++m_uCounter;
+    }
+
+    // Takes some time so several threads execute tasks at the same time
+    void CountSlowly()
+    {
+        using Kinesis::QuimeraEngine::System::Threading::SQThisThread;
+        using Kinesis::QuimeraEngine::Tools::Time::QTimeSpan;
+
+        SQThisThread::Sleep(QTimeSpan(0, 0, 0, 0, 1, 0, 0));
+        ++m_uCounter;
+    }
+
+    // Checks whether the predecessors had finished when the task started
+    void CheckPredecessorsAndFinish()
+    {
+        using Kinesis::QuimeraEngine::System::Threading::SQThisThread;
+        using Kinesis::QuimeraEngine::Tools::Time::QTimeSpan;
+
+        m_bPredecessorsFinished = true;
+
+        for(unsigned int i = 0; i < 2U; ++i)
+            if(m_arPredecessors[i] != null_q)
+                m_bPredecessorsFinished = m_bPredecessorsFinished && m_arPredecessors[i]->m_bFinished;
+
+        SQThisThread::Sleep(QTimeSpan(0, 0, 0, 0, 5, 0, 0));
+        m_bFinished = true;
+    }
+
+    // Every iteration has its own counter so no synchronization is needed
+    void CountIterations(const unsigned int uFirst, const unsigned int uLast)
+    {
+        for(unsigned int i = uFirst; i < uLast; ++i)
+            ++m_arIterations[i];
+    }
+
+    // Executes a parallel loop from inside a task
+    void CountIterationsInNestedLoop()
+    {
+        m_pScheduler->ParallelFor(0, MAX_ITERATIONS, QDelegate<void (const unsigned int, const unsigned int)>(this, &QTaskSchedulerTestClass::CountIterations), 16U);
+    }
+};
+
+
+QTEST_SUITE_BEGIN( QTaskScheduler_TestSuite )
+
+/// <summary>
+/// Checks that the number of worker threads is correctly stored.
+/// </summary>
+QTEST_CASE ( Constructor_WorkerCountIsCorrectlyStored_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_COUNT = 3U;
+
+	// [Execution]
+    QTaskScheduler scheduler(EXPECTED_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(scheduler.GetWorkerCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the scheduler can be destroyed without having executed any task.
+/// </summary>
+QTEST_CASE ( Destructor_WorkerThreadsFinishWhenNoTaskWasExecuted_Test )
+{
+    // [Preparation]
+    QTaskScheduler* pScheduler = new QTaskScheduler(4U);
+
+	// [Execution]
+    delete pScheduler;
+
+    // [Verification]
+    BOOST_CHECK(true);
+}
+
+/// <summary>
+/// Checks that every task is executed once and only once, and that waiting for the group does not finish before all of them have finished.
+/// </summary>
+QTEST_CASE ( Run_EveryTaskIsExecutedExactlyOnce_Test )
+{
+    // [Preparation]
+    const unsigned int TASKS = 64U;
+    const unsigned int EXPECTED_COUNT = 1U;
+    QTaskSchedulerTestClass arTasks[TASKS];
+    QTaskScheduler scheduler(3U);
+    QTaskScheduler::QTaskGroup group;
+
+	// [Execution]
+    for(unsigned int i = 0; i < TASKS; ++i)
+        scheduler.Run(QDelegate<void ()>(&arTasks[i], &QTaskSchedulerTestClass::CountSlowly), group);
+
+    scheduler.Wait(group);
+
+    // [Verification]
+    for(unsigned int i = 0; i < TASKS; ++i)
+        BOOST_CHECK_EQUAL(arTasks[i].m_uCounter, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the thread that waits for the group executes all the tasks when the scheduler has no worker threads.
+/// </summary>
+QTEST_CASE ( Run_TasksAreExecutedWhenThereAreNoWorkers_Test )
+{
+    // [Preparation]
+    const unsigned int TASKS = 10U;
+    const unsigned int EXPECTED_COUNT = 1U;
+    QTaskSchedulerTestClass arTasks[TASKS];
+    QTaskScheduler scheduler(0);
+    QTaskScheduler::QTaskGroup group;
+
+	// [Execution]
+    for(unsigned int i = 0; i < TASKS; ++i)
+        scheduler.Run(QDelegate<void ()>(&arTasks[i], &QTaskSchedulerTestClass::Count), group);
+
+    scheduler.Wait(group);
+
+    // [Verification]
+    for(unsigned int i = 0; i < TASKS; ++i)
+        BOOST_CHECK_EQUAL(arTasks[i].m_uCounter, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that waiting for a group only waits for the tasks of that group.
+/// </summary>
+QTEST_CASE ( Run_GroupsAreWaitedForIndependently_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_COUNT = 1U;
+    QTaskSchedulerTestClass task1;
+    QTaskSchedulerTestClass task2;
+    QTaskScheduler scheduler(2U);
+    QTaskScheduler::QTaskGroup group1;
+    QTaskScheduler::QTaskGroup group2;
+
+	// [Execution]
+    scheduler.Run(QDelegate<void ()>(&task1, &QTaskSchedulerTestClass::CountSlowly), group1);
+    scheduler.Run(QDelegate<void ()>(&task2, &QTaskSchedulerTestClass::CountSlowly), group2);
+    scheduler.Wait(group1);
+    const unsigned int COUNT1 = task1.m_uCounter;
+    scheduler.Wait(group2);
+    const unsigned int COUNT2 = task2.m_uCounter;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(COUNT1, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(COUNT2, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that a continuation does not start until the task it depends on has finished.
+/// </summary>
+QTEST_CASE ( AddContinuation_ContinuationStartsWhenTaskFinishes_Test )
+{
+    // [Preparation]
+    const bool PREDECESSORS_FINISHED = true;
+    QTaskSchedulerTestClass predecessor;
+    QTaskSchedulerTestClass continuation;
+    continuation.m_arPredecessors[0] = &predecessor;
+    QTaskScheduler scheduler(3U);
+    QTaskScheduler::QTaskGroup group;
+
+    QTaskScheduler::QTask* pPredecessor = scheduler.CreateTask(QDelegate<void ()>(&predecessor, &QTaskSchedulerTestClass::CheckPredecessorsAndFinish), group);
+    QTaskScheduler::QTask* pContinuation = scheduler.CreateTask(QDelegate<void ()>(&continuation, &QTaskSchedulerTestClass::CheckPredecessorsAndFinish), group);
+
+	// [Execution]
+    scheduler.AddContinuation(pPredecessor, pContinuation);
+    scheduler.Submit(pContinuation);
+    scheduler.Submit(pPredecessor);
+    scheduler.Wait(group);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(continuation.m_bPredecessorsFinished, PREDECESSORS_FINISHED);
+}
+
+/// <summary>
+/// Checks that a task that depends on several tasks does not start until all of them have finished, using a diamond-shaped graph.
+/// </summary>
+QTEST_CASE ( AddContinuation_TaskWithSeveralDependenciesStartsWhenAllOfThemFinish_Test )
+{
+    // [Preparation]
+    const bool PREDECESSORS_FINISHED = true;
+    QTaskSchedulerTestClass first;
+    QTaskSchedulerTestClass left;
+    QTaskSchedulerTestClass right;
+    QTaskSchedulerTestClass last;
+    left.m_arPredecessors[0] = &first;
+    right.m_arPredecessors[0] = &first;
+    last.m_arPredecessors[0] = &left;
+    last.m_arPredecessors[1] = &right;
+    QTaskScheduler scheduler(3U);
+    QTaskScheduler::QTaskGroup group;
+
+    QTaskScheduler::QTask* pFirst = scheduler.CreateTask(QDelegate<void ()>(&first, &QTaskSchedulerTestClass::CheckPredecessorsAndFinish), group);
+    QTaskScheduler::QTask* pLeft = scheduler.CreateTask(QDelegate<void ()>(&left, &QTaskSchedulerTestClass::CheckPredecessorsAndFinish), group);
+    QTaskScheduler::QTask* pRight = scheduler.CreateTask(QDelegate<void ()>(&right, &QTaskSchedulerTestClass::CheckPredecessorsAndFinish), group);
+    QTaskScheduler::QTask* pLast = scheduler.CreateTask(QDelegate<void ()>(&last, &QTaskSchedulerTestClass::CheckPredecessorsAndFinish), group);
+
+	// [Execution]
+    scheduler.AddContinuation(pFirst, pLeft);
+    scheduler.AddContinuation(pFirst, pRight);
+    scheduler.AddContinuation(pLeft, pLast);
+    scheduler.AddContinuation(pRight, pLast);
+    scheduler.Submit(pLast);
+    scheduler.Submit(pRight);
+    scheduler.Submit(pLeft);
+    scheduler.Submit(pFirst);
+    scheduler.Wait(group);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(left.m_bPredecessorsFinished, PREDECESSORS_FINISHED);
+    BOOST_CHECK_EQUAL(right.m_bPredecessorsFinished, PREDECESSORS_FINISHED);
+    BOOST_CHECK_EQUAL(last.m_bPredecessorsFinished, PREDECESSORS_FINISHED);
+}
+
+/// <summary>
+/// Checks that every iteration is processed once and only once, for different grain sizes.
+/// </summary>
+QTEST_CASE ( ParallelFor_EveryIterationIsProcessedExactlyOnce_Test )
+{
+    // [Preparation]
+    const unsigned int GRAIN_SIZES[] = { 0, 1U, 7U, QTaskSchedulerTestClass::MAX_ITERATIONS, QTaskSchedulerTestClass::MAX_ITERATIONS * 2U };
+    const unsigned int GRAIN_SIZE_COUNT = sizeof(GRAIN_SIZES) / sizeof(unsigned int);
+    const unsigned int FIRST = 10U;
+    const unsigned int LAST = 1000U;
+    const unsigned int EXPECTED_COUNT = 1U;
+    const unsigned int EXPECTED_UNUSED_COUNT = 0;
+    QTaskScheduler scheduler(3U);
+
+    for(unsigned int iGrainSize = 0; iGrainSize < GRAIN_SIZE_COUNT; ++iGrainSize)
+    {
+        QTaskSchedulerTestClass counters;
+
+        // [Execution]
+        scheduler.ParallelFor(FIRST, LAST, QDelegate<void (const unsigned int, const unsigned int)>(&counters, &QTaskSchedulerTestClass::CountIterations), GRAIN_SIZES[iGrainSize]);
+
+        // [Verification]
+        for(unsigned int i = 0; i < QTaskSchedulerTestClass::MAX_ITERATIONS; ++i)
+            BOOST_CHECK_EQUAL(counters.m_arIterations[i], i >= FIRST && i < LAST ? EXPECTED_COUNT : EXPECTED_UNUSED_COUNT);
+    }
+}
+
+/// <summary>
+/// Checks that nothing is done when the last iteration is not greater than the first one.
+/// </summary>
+QTEST_CASE ( ParallelFor_NothingIsDoneWhenRangeIsEmpty_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_COUNT = 0;
+    QTaskSchedulerTestClass counters;
+    QTaskScheduler scheduler(2U);
+
+	// [Execution]
+    scheduler.ParallelFor(5U, 5U, QDelegate<void (const unsigned int, const unsigned int)>(&counters, &QTaskSchedulerTestClass::CountIterations));
+    scheduler.ParallelFor(6U, 5U, QDelegate<void (const unsigned int, const unsigned int)>(&counters, &QTaskSchedulerTestClass::CountIterations));
+
+    // [Verification]
+    for(unsigned int i = 0; i < QTaskSchedulerTestClass::MAX_ITERATIONS; ++i)
+        BOOST_CHECK_EQUAL(counters.m_arIterations[i], EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that parallel loops can be executed from inside tasks without blocking the worker threads.
+/// </summary>
+QTEST_CASE ( ParallelFor_CanBeCalledFromInsideTasks_Test )
+{
+    // [Preparation]
+    const unsigned int TASKS = 8U;
+    const unsigned int EXPECTED_COUNT = 1U;
+    QTaskSchedulerTestClass arTasks[TASKS];
+    QTaskScheduler scheduler(2U);
+    QTaskScheduler::QTaskGroup group;
+
+    for(unsigned int i = 0; i < TASKS; ++i)
+        arTasks[i].m_pScheduler = &scheduler;
+
+	// [Execution]
+    for(unsigned int i = 0; i < TASKS; ++i)
+        scheduler.Run(QDelegate<void ()>(&arTasks[i], &QTaskSchedulerTestClass::CountIterationsInNestedLoop), group);
+
+    scheduler.Wait(group);
+
+    // [Verification]
+    for(unsigned int iTask = 0; iTask < TASKS; ++iTask)
+        for(unsigned int i = 0; i < QTaskSchedulerTestClass::MAX_ITERATIONS; ++i)
+            BOOST_CHECK_EQUAL(arTasks[iTask].m_arIterations[i], EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that waiting for a group without tasks returns immediately.
+/// </summary>
+QTEST_CASE ( Wait_ReturnsWhenGroupHasNoTasks_Test )
+{
+    // [Preparation]
+    QTaskScheduler scheduler(1U);
+    QTaskScheduler::QTaskGroup group;
+
+	// [Execution]
+    scheduler.Wait(group);
+
+    // [Verification]
+    BOOST_CHECK(true);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the function is null.
+/// </summary>
+QTEST_CASE ( CreateTask_AssertionFailsWhenFunctionIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QTaskScheduler scheduler(1U);
+    QTaskScheduler::QTaskGroup group;
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        scheduler.CreateTask(QDelegate<void ()>(), group);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the task is null.
+/// </summary>
+QTEST_CASE ( AddContinuation_AssertionFailsWhenTaskIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QTaskSchedulerTestClass continuation;
+    QTaskScheduler scheduler(0);
+    QTaskScheduler::QTaskGroup group;
+    QTaskScheduler::QTask* pContinuation = scheduler.CreateTask(QDelegate<void ()>(&continuation, &QTaskSchedulerTestClass::Count), group);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        scheduler.AddContinuation(null_q, pContinuation);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+
+    // [Cleaning]
+    scheduler.Submit(pContinuation);
+    scheduler.Wait(group);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the continuation is null.
+/// </summary>
+QTEST_CASE ( AddContinuation_AssertionFailsWhenContinuationIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QTaskSchedulerTestClass task;
+    QTaskScheduler scheduler(0);
+    QTaskScheduler::QTaskGroup group;
+    QTaskScheduler::QTask* pTask = scheduler.CreateTask(QDelegate<void ()>(&task, &QTaskSchedulerTestClass::Count), group);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        scheduler.AddContinuation(pTask, null_q);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+
+    // [Cleaning]
+    scheduler.Submit(pTask);
+    scheduler.Wait(group);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the task has already been submitted. The scheduler has no workers so the task is not executed.
+/// </summary>
+QTEST_CASE ( AddContinuation_AssertionFailsWhenTaskWasSubmitted_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QTaskSchedulerTestClass task;
+    QTaskSchedulerTestClass continuation;
+    QTaskScheduler scheduler(0);
+    QTaskScheduler::QTaskGroup group;
+    QTaskScheduler::QTask* pTask = scheduler.CreateTask(QDelegate<void ()>(&task, &QTaskSchedulerTestClass::Count), group);
+    QTaskScheduler::QTask* pContinuation = scheduler.CreateTask(QDelegate<void ()>(&continuation, &QTaskSchedulerTestClass::Count), group);
+    scheduler.Submit(pTask);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        scheduler.AddContinuation(pTask, pContinuation);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+
+    // [Cleaning]
+    scheduler.Submit(pContinuation);
+    scheduler.Wait(group);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the task is null.
+/// </summary>
+QTEST_CASE ( Submit_AssertionFailsWhenTaskIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QTaskScheduler scheduler(1U);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        scheduler.Submit(null_q);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the body of the loop is null.
+/// </summary>
+QTEST_CASE ( ParallelFor_AssertionFailsWhenBodyIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QTaskScheduler scheduler(1U);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        scheduler.ParallelFor(0, 10U, QDelegate<void (const unsigned int, const unsigned int)>());
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+// End - Test Suite: QTaskScheduler
+QTEST_SUITE_END()
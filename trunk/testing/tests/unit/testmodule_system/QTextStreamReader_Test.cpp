@@ -975,6 +975,101 @@ QTEST_CASE ( ReadLine_ReturnsTheCorrectResultWhenIsCalledSeveralTimes_Test )
     BOOST_CHECK(strResult == EXPECTED_TEXT);
 }
 
+/// <summary>
+/// Checks that it returns the correct result when the line is longer than the maximum size of the internal read batches.
+/// </summary>
+QTEST_CASE ( ReadLine_ReturnsCorrectStringWhenLineIsGreaterThanMaximumInternalReadBatchesSize_Test )
+{
+    // [Preparation]
+    const EQTextEncoding INPUT_ENCODING = EQTextEncoding::E_UTF8;
+    // Note: Currently, the maximum batch size is 65536 bytes
+    const pointer_uint_q LINE_LENGTH = 100000U;
+    string_q EXPECTED_TEXT;
+
+    for(pointer_uint_q i = 0; i < LINE_LENGTH / 10U; ++i)
+        EXPECTED_TEXT.Append("1234567890");
+
+    string_q strInput = EXPECTED_TEXT + "\nABC";
+    
+    const QArrayResult<i8_q> arBytes = strInput.ToBytes(INPUT_ENCODING);
+    QMemoryStream<> stream(arBytes.Get(), arBytes.GetCount() - 1U); // -1 to quit the trailing zero
+    QTextStreamReader< QMemoryStream<> > reader(stream, INPUT_ENCODING);
+    reader.SetNewLineSeparator(EQNewLineCharacters::E_LF);
+    string_q strResult;
+
+    // [Execution]
+    reader.ReadLine(strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), LINE_LENGTH + 1U);
+}
+
+/// <summary>
+/// Checks that short lines are read correctly after reading a line that is longer than the internal read batches.
+/// </summary>
+QTEST_CASE ( ReadLine_ReturnsCorrectStringsWhenShortLinesFollowLongLines_Test )
+{
+    // [Preparation]
+    const EQTextEncoding INPUT_ENCODING = EQTextEncoding::E_ASCII;
+    const pointer_uint_q LONG_LINE_LENGTH = 5000U;
+    const pointer_uint_q SHORT_LINE_COUNT = 100U;
+    string_q strLongLine;
+
+    for(pointer_uint_q i = 0; i < LONG_LINE_LENGTH / 10U; ++i)
+        strLongLine.Append("1234567890");
+
+    string_q strInput = strLongLine + "\n";
+
+    for(pointer_uint_q i = 0; i < SHORT_LINE_COUNT; ++i)
+        strInput.Append(string_q::FromInteger(i) + "\n");
+    
+    const QArrayResult<i8_q> arBytes = strInput.ToBytes(INPUT_ENCODING);
+    QMemoryStream<> stream(arBytes.Get(), arBytes.GetCount() - 1U); // -1 to quit the trailing zero
+    QTextStreamReader< QMemoryStream<> > reader(stream, INPUT_ENCODING);
+    reader.SetNewLineSeparator(EQNewLineCharacters::E_LF);
+    string_q strLongLineResult;
+    bool bShortLinesAreCorrect = true;
+
+    // [Execution]
+    reader.ReadLine(strLongLineResult);
+
+    for(pointer_uint_q i = 0; i < SHORT_LINE_COUNT && bShortLinesAreCorrect; ++i)
+    {
+        string_q strShortLineResult;
+        reader.ReadLine(strShortLineResult);
+        bShortLinesAreCorrect = strShortLineResult == string_q::FromInteger(i);
+    }
+
+    // [Verification]
+    BOOST_CHECK(strLongLineResult == strLongLine);
+    BOOST_CHECK(bShortLinesAreCorrect);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), stream.GetLength());
+}
+
+/// <summary>
+/// Checks that a LF character that is not preceded by a CR character is not considered a separator when the new line separator is CRLF.
+/// </summary>
+QTEST_CASE ( ReadLine_LFIsNotSeparatorWhenNewLineIsCRLF_Test )
+{
+    // [Preparation]
+    const EQTextEncoding INPUT_ENCODING = EQTextEncoding::E_UTF8;
+    const string_q EXPECTED_TEXT("ABC\nDEF\rGHI");
+    const string_q INPUT_TEXT("ABC\nDEF\rGHI\r\nJKL");
+    
+    const QArrayResult<i8_q> arBytes = INPUT_TEXT.ToBytes(INPUT_ENCODING);
+    QMemoryStream<> stream(arBytes.Get(), arBytes.GetCount() - 1U); // -1 to quit the trailing zero
+    QTextStreamReader< QMemoryStream<> > reader(stream, INPUT_ENCODING);
+    reader.SetNewLineSeparator(EQNewLineCharacters::E_CRLF);
+    string_q strResult;
+
+    // [Execution]
+    reader.ReadLine(strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
 /// <summary>
 /// Checks that the entire stream can be read.
 /// </summary>
@@ -0,0 +1,347 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QThreadLocalPoolAllocator.h"
+
+#include "QThread.h"
+#include "QMutex.h"
+#include "QConditionVariable.h"
+#include "QScopedExclusiveLock.h"
+
+using Kinesis::QuimeraEngine::System::Threading::QThreadLocalPoolAllocator;
+using Kinesis::QuimeraEngine::System::Threading::QLockFreePoolAllocator;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::System::Threading::QMutex;
+using Kinesis::QuimeraEngine::System::Threading::QConditionVariable;
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+
+// Class whose method is executed by several threads at the same time in the tests of QThreadLocalPoolAllocator
+class QThreadLocalPoolAllocatorTestClass
+{
+public:
+
+    static const unsigned int BLOCKS_PER_THREAD = 100U;
+    static const unsigned int ITERATIONS = 500U;
+
+    QThreadLocalPoolAllocator* m_pAllocator;
+    u32_q m_uThreadMark;
+    bool m_bBlocksWereShared;
+    unsigned int m_uCachedBlocks;
+
+    QThreadLocalPoolAllocatorTestClass() : m_pAllocator(null_q),
+                                           m_uThreadMark(0),
+                                           m_bBlocksWereShared(false),
+                                           m_uCachedBlocks(0)
+    {
+    }
+
+    // Allocates blocks, marks them and checks that no other thread modified them before deallocating them
+    void AllocateAndDeallocate()
+    {
+        void* arBlocks[BLOCKS_PER_THREAD];
+
+        for(unsigned int uIteration = 0; uIteration < ITERATIONS; ++uIteration)
+        {
+            const unsigned int BLOCKS = 1U + uIteration % BLOCKS_PER_THREAD;
+
+            for(unsigned int i = 0; i < BLOCKS; ++i)
+            {
+                arBlocks[i] = m_pAllocator->Allocate();
+                *scast_q(arBlocks[i], u32_q*) = m_uThreadMark + i;
+            }
+
+            for(unsigned int i = 0; i < BLOCKS; ++i)
+            {
+                m_bBlocksWereShared = m_bBlocksWereShared || *scast_q(arBlocks[i], u32_q*) != m_uThreadMark + i;
+                m_pAllocator->Deallocate(arBlocks[i]);
+            }
+        }
+
+        m_uCachedBlocks = m_pAllocator->GetCachedBlockCount();
+    }
+};
+
+// Class whose method keeps a thread running, with blocks in its cache, until the allocator it used has been destroyed
+class QThreadLocalPoolAllocatorDestructionTestClass
+{
+public:
+
+    QThreadLocalPoolAllocator* m_pAllocator;
+    QMutex m_mutex;
+    QConditionVariable m_condition;
+    bool m_bCacheIsFilled;
+    bool m_bAllocatorIsDestroyed;
+
+    QThreadLocalPoolAllocatorDestructionTestClass() : m_pAllocator(null_q),
+                                                      m_bCacheIsFilled(false),
+                                                      m_bAllocatorIsDestroyed(false)
+    {
+    }
+
+    // Fills the cache of the thread and waits until the allocator has been destroyed
+    void FillCacheAndWait()
+    {
+        m_pAllocator->Deallocate(m_pAllocator->Allocate());
+
+        QScopedExclusiveLock<> lock(m_mutex);
+        m_bCacheIsFilled = true;
+        m_condition.NotifyAll();
+
+        while(!m_bAllocatorIsDestroyed)
+            m_condition.Wait(lock);
+    }
+};
+
+
+QTEST_SUITE_BEGIN( QThreadLocalPoolAllocator_TestSuite )
+
+/// <summary>
+/// Checks that the shared pool and the capacity of the cache are correctly stored.
+/// </summary>
+QTEST_CASE ( Constructor_SharedPoolAndCacheCapacityAreCorrectlyStored_Test )
+{
+    // [Preparation]
+    QLockFreePoolAllocator sharedPool(64U, 8U, QAlignment(8U));
+    const unsigned int INPUT_CAPACITY = 4U;
+
+    // [Execution]
+    QThreadLocalPoolAllocator allocator(sharedPool, INPUT_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(&allocator.GetSharedPool(), &sharedPool);
+    BOOST_CHECK_EQUAL(allocator.GetCacheCapacity(), INPUT_CAPACITY);
+    BOOST_CHECK_EQUAL(allocator.GetCachedBlockCount(), 0U);
+}
+
+/// <summary>
+/// Checks that half the capacity of the cache is taken from the shared pool when the cache is empty.
+/// </summary>
+QTEST_CASE ( Allocate_HalfTheCapacityIsTakenFromSharedPoolWhenCacheIsEmpty_Test )
+{
+    // [Preparation]
+    QLockFreePoolAllocator sharedPool(64U, 8U, QAlignment(8U));
+    QThreadLocalPoolAllocator allocator(sharedPool, 4U);
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 16U;
+    const unsigned int EXPECTED_CACHED_BLOCKS = 1U;
+
+    // [Execution]
+    void* pBlock = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK(pBlock != null_q);
+    BOOST_CHECK_EQUAL(sharedPool.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.GetCachedBlockCount(), EXPECTED_CACHED_BLOCKS);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock);
+}
+
+/// <summary>
+/// Checks that null is returned when both the cache and the shared pool are empty.
+/// </summary>
+QTEST_CASE ( Allocate_ReturnsNullWhenCacheAndSharedPoolAreEmpty_Test )
+{
+    // [Preparation]
+    QLockFreePoolAllocator sharedPool(16U, 8U, QAlignment(8U));
+    QThreadLocalPoolAllocator allocator(sharedPool, 4U);
+    const void* EXPECTED_RESULT = null_q;
+    void* pBlock1 = allocator.Allocate();
+    void* pBlock2 = allocator.Allocate();
+
+    // [Execution]
+    void* pBlock = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pBlock, EXPECTED_RESULT);
+    BOOST_CHECK(pBlock1 != pBlock2);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock1);
+    allocator.Deallocate(pBlock2);
+}
+
+/// <summary>
+/// Checks that deallocated blocks are kept in the cache and reused.
+/// </summary>
+QTEST_CASE ( Deallocate_BlockIsKeptInCacheAndReused_Test )
+{
+    // [Preparation]
+    QLockFreePoolAllocator sharedPool(64U, 8U, QAlignment(8U));
+    QThreadLocalPoolAllocator allocator(sharedPool, 4U);
+    void* pExpectedBlock = allocator.Allocate();
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = sharedPool.GetAllocatedBytes();
+
+    // [Execution]
+    allocator.Deallocate(pExpectedBlock);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(sharedPool.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.GetCachedBlockCount(), 2U);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), pExpectedBlock);
+
+    // [Cleaning]
+    allocator.Deallocate(pExpectedBlock);
+}
+
+/// <summary>
+/// Checks that half the cached blocks are returned to the shared pool when the cache is full.
+/// </summary>
+QTEST_CASE ( Deallocate_HalfTheBlocksAreReturnedToSharedPoolWhenCacheIsFull_Test )
+{
+    // [Preparation]
+    const unsigned int CACHE_CAPACITY = 4U;
+    QLockFreePoolAllocator sharedPool(64U, 8U, QAlignment(8U));
+    QThreadLocalPoolAllocator allocator(sharedPool, CACHE_CAPACITY);
+    void* arBlocks[CACHE_CAPACITY + 2U];
+
+    // The cache is empty after allocating a multiple of half its capacity
+    for(unsigned int i = 0; i < CACHE_CAPACITY + 2U; ++i)
+        arBlocks[i] = allocator.Allocate();
+
+    for(unsigned int i = 0; i < CACHE_CAPACITY; ++i)
+        allocator.Deallocate(arBlocks[i]);
+
+    const unsigned int EXPECTED_CACHED_BLOCKS = CACHE_CAPACITY / 2U + 1U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = sharedPool.GetAllocatedBytes() - 8U * CACHE_CAPACITY / 2U;
+
+    // [Execution]
+    allocator.Deallocate(arBlocks[CACHE_CAPACITY]);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetCachedBlockCount(), EXPECTED_CACHED_BLOCKS);
+    BOOST_CHECK_EQUAL(sharedPool.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that all the cached blocks are returned to the shared pool.
+/// </summary>
+QTEST_CASE ( ReleaseCache_AllCachedBlocksAreReturnedToSharedPool_Test )
+{
+    // [Preparation]
+    QLockFreePoolAllocator sharedPool(64U, 8U, QAlignment(8U));
+    QThreadLocalPoolAllocator allocator(sharedPool, 4U);
+    allocator.Deallocate(allocator.Allocate());
+
+    // [Execution]
+    allocator.ReleaseCache();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetCachedBlockCount(), 0U);
+    BOOST_CHECK_EQUAL(sharedPool.GetAllocatedBytes(), 0U);
+}
+
+/// <summary>
+/// Checks that a block is never given to two threads and that the blocks cached by every thread are returned when it finishes.
+/// </summary>
+QTEST_CASE ( Allocate_BlocksAreNotSharedAmongThreadsAndCachesAreReleasedWhenThreadsFinish_Test )
+{
+    // [Preparation]
+    const unsigned int THREADS = 4U;
+    const unsigned int CACHE_CAPACITY = 16U;
+    QLockFreePoolAllocator sharedPool(THREADS * (QThreadLocalPoolAllocatorTestClass::BLOCKS_PER_THREAD + CACHE_CAPACITY) * sizeof(u32_q),
+                                      sizeof(u32_q),
+                                      QAlignment(4U));
+    QThreadLocalPoolAllocator allocator(sharedPool, CACHE_CAPACITY);
+    QThreadLocalPoolAllocatorTestClass arTests[THREADS];
+    QThread* arThreads[THREADS];
+
+    // [Execution]
+    for(unsigned int i = 0; i < THREADS; ++i)
+    {
+        arTests[i].m_pAllocator = &allocator;
+        arTests[i].m_uThreadMark = i * 1000U;
+        arThreads[i] = new QThread(QDelegate<void ()>(&arTests[i], &QThreadLocalPoolAllocatorTestClass::AllocateAndDeallocate));
+    }
+
+    for(unsigned int i = 0; i < THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    for(unsigned int i = 0; i < THREADS; ++i)
+    {
+        BOOST_CHECK(!arTests[i].m_bBlocksWereShared);
+        BOOST_CHECK(arTests[i].m_uCachedBlocks > 0);
+    }
+
+    BOOST_CHECK_EQUAL(sharedPool.GetAllocatedBytes(), 0U);
+}
+
+/// <summary>
+/// Checks that the blocks cached by threads that are still running are returned to the shared pool when the allocator is destroyed, and
+/// that those threads do not use the shared pool when they finish.
+/// </summary>
+QTEST_CASE ( Destructor_CachesOfRunningThreadsAreReturnedToSharedPool_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    QLockFreePoolAllocator* pSharedPool = new QLockFreePoolAllocator(64U, 8U, QAlignment(8U));
+    QThreadLocalPoolAllocator* pAllocator = new QThreadLocalPoolAllocator(*pSharedPool, 4U);
+    QThreadLocalPoolAllocatorDestructionTestClass test;
+    test.m_pAllocator = pAllocator;
+    pAllocator->Deallocate(pAllocator->Allocate());
+
+    QThread thread(QDelegate<void ()>(&test, &QThreadLocalPoolAllocatorDestructionTestClass::FillCacheAndWait));
+
+    {
+        QScopedExclusiveLock<> lock(test.m_mutex);
+
+        while(!test.m_bCacheIsFilled)
+            test.m_condition.Wait(lock);
+    }
+
+    // [Execution]
+    delete pAllocator;
+
+    // [Verification]
+    pointer_uint_q uAllocatedBytes = pSharedPool->GetAllocatedBytes();
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+
+    // The thread finishes once the shared pool does not exist
+    delete pSharedPool;
+
+    {
+        QScopedExclusiveLock<> lock(test.m_mutex);
+        test.m_bAllocatorIsDestroyed = true;
+        test.m_condition.NotifyAll();
+    }
+
+    thread.Join();
+}
+
+// End - Test Suite: QThreadLocalPoolAllocator
+QTEST_SUITE_END()
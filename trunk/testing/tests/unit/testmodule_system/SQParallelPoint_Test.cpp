@@ -0,0 +1,1825 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include <cstring>
+#include "SQParallelPoint.h"
+
+#include "SQFloat.h"
+#include "SQAngle.h"
+#include "QVector3.h"
+#include "QVector4.h"
+#include "QMatrix4x3.h"
+#include "QMatrix4x4.h"
+#include "QTranslationMatrix.h"
+#include "QTransformationMatrix.h"
+#include "QRotationMatrix3x3.h"
+#include "QScalingMatrix3x3.h"
+#include "QQuaternion.h"
+#include "QSpaceConversionMatrix.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+using Kinesis::QuimeraEngine::Tools::Math::SQPoint;
+using Kinesis::QuimeraEngine::System::Threading::SQParallelPoint;
+using Kinesis::QuimeraEngine::System::Threading::QTaskScheduler;
+
+// Functions used in the tests of SQParallelPoint
+class SQParallelPointTestHelper
+{
+public:
+
+    // Fills an array with points whose components are not trivial to transform
+    template<class VectorT>
+    static void FillPoints(VectorT* arPoints, const unsigned int uElements)
+    {
+        for(unsigned int i = 0; i < uElements; ++i)
+        {
+            arPoints[i] = VectorT(SQFloat::_1);
+            arPoints[i].x = (float_q)i * (float_q)0.37;
+            arPoints[i].y = -(float_q)i / (float_q)3.0;
+            arPoints[i].z = (float_q)(i % 17) - (float_q)8.1;
+        }
+    }
+
+    // Checks that both arrays are equal bit by bit
+    template<class VectorT>
+    static bool AreIdentical(const VectorT* arPointsA, const VectorT* arPointsB, const unsigned int uElements)
+    {
+        return memcmp(arPointsA, arPointsB, sizeof(VectorT) * uElements) == 0;
+    }
+};
+
+
+QTEST_SUITE_BEGIN( SQParallelPoint_TestSuite )
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Translate1_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QBaseVector3 TRANSLATION(SQFloat::_1, -SQFloat::_2, SQFloat::_3);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Translate(TRANSLATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Translate2_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QBaseVector3 TRANSLATION(SQFloat::_1, -SQFloat::_2, SQFloat::_3);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Translate(TRANSLATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Translate3_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Translate(TRANSLATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Translate4_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Translate(TRANSLATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Translate5_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Translate(TRANSLATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Translate6_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Translate(TRANSLATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Rotate1_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QQuaternion ROTATION(SQAngle::_HalfPi, SQAngle::_QuarterPi, SQAngle::_ThirdPi);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QQuaternion ROTATION(SQAngle::_90, SQAngle::_45, SQAngle::_60);
+#endif
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Rotate(ROTATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Rotate(ROTATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Rotate2_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QQuaternion ROTATION(SQAngle::_HalfPi, SQAngle::_QuarterPi, SQAngle::_ThirdPi);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QQuaternion ROTATION(SQAngle::_90, SQAngle::_45, SQAngle::_60);
+#endif
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Rotate(ROTATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Rotate(ROTATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Rotate3_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Rotate(ROTATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Rotate(ROTATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Rotate4_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Rotate(ROTATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Rotate(ROTATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Scale1_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QBaseVector3 SCALE(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Scale(SCALE, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Scale(SCALE, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Scale2_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QBaseVector3 SCALE(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Scale(SCALE, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Scale(SCALE, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Scale3_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Scale(SCALE, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Scale(SCALE, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Scale4_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Scale(SCALE, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Scale(SCALE, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Transform1_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x3> TRANSFORMATION = QTransformationMatrix<QMatrix4x3>(TRANSLATION, ROTATION, SCALE);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Transform(TRANSFORMATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Transform(TRANSFORMATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Transform2_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x3> TRANSFORMATION = QTransformationMatrix<QMatrix4x3>(TRANSLATION, ROTATION, SCALE);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Transform(TRANSFORMATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Transform(TRANSFORMATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Transform3_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x4> TRANSFORMATION = QTransformationMatrix<QMatrix4x4>(TRANSLATION, ROTATION, SCALE);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Transform(TRANSFORMATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Transform(TRANSFORMATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Transform4_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x4> TRANSFORMATION = QTransformationMatrix<QMatrix4x4>(TRANSLATION, ROTATION, SCALE);
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Transform(TRANSFORMATION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Transform(TRANSFORMATION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Transform5_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    QSpaceConversionMatrix CONVERSION;
+    CONVERSION.SetViewSpaceMatrix(QVector3(SQFloat::_1, SQFloat::_2, SQFloat::_3),
+                                  QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1),
+                                  QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0));
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector3* arExpectedPoints = new QVector3[POINTS_COUNT];
+    QVector3* arPoints = new QVector3[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Transform(CONVERSION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Transform(CONVERSION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+
+/// <summary>
+/// Checks that the result is exactly the same as when the points are transformed by only one thread, whatever the number of partitions.
+/// </summary>
+QTEST_CASE ( Transform6_ResultIsExactlyTheSameAsSerialTransformation_Test )
+{
+    // [Preparation]
+    QSpaceConversionMatrix CONVERSION;
+    CONVERSION.SetViewSpaceMatrix(QVector3(SQFloat::_1, SQFloat::_2, SQFloat::_3),
+                                  QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1),
+                                  QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0));
+    const unsigned int POINTS_COUNT = 1001U;
+    const unsigned int PARTITIONS[] = { 0, 1U, 3U, 7U, 2000U };
+    const unsigned int PARTITION_CASES = sizeof(PARTITIONS) / sizeof(unsigned int);
+    QTaskScheduler scheduler(3U);
+
+    QVector4* arExpectedPoints = new QVector4[POINTS_COUNT];
+    QVector4* arPoints = new QVector4[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQPoint::Transform(CONVERSION, arExpectedPoints, POINTS_COUNT);
+
+    for(unsigned int i = 0; i < PARTITION_CASES; ++i)
+    {
+        SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+
+        // [Execution]
+        SQParallelPoint::Transform(CONVERSION, arPoints, POINTS_COUNT, scheduler, PARTITIONS[i]);
+
+        // [Verification]
+        BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+    }
+
+    // [Cleaning]
+    delete[] arExpectedPoints;
+    delete[] arPoints;
+}
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Translate1_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QBaseVector3 TRANSLATION(SQFloat::_1, -SQFloat::_2, SQFloat::_3);
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Translate(TRANSLATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Translate2_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QBaseVector3 TRANSLATION(SQFloat::_1, -SQFloat::_2, SQFloat::_3);
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Translate(TRANSLATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Translate3_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Translate(TRANSLATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Translate4_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Translate(TRANSLATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Translate5_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Translate(TRANSLATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Translate6_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Translate(TRANSLATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Rotate1_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QQuaternion ROTATION(SQAngle::_HalfPi, SQAngle::_QuarterPi, SQAngle::_ThirdPi);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QQuaternion ROTATION(SQAngle::_90, SQAngle::_45, SQAngle::_60);
+#endif
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Rotate(ROTATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Rotate2_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QQuaternion ROTATION(SQAngle::_HalfPi, SQAngle::_QuarterPi, SQAngle::_ThirdPi);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QQuaternion ROTATION(SQAngle::_90, SQAngle::_45, SQAngle::_60);
+#endif
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Rotate(ROTATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Rotate3_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Rotate(ROTATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Rotate4_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Rotate(ROTATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Scale1_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QBaseVector3 SCALE(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Scale(SCALE, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Scale2_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QBaseVector3 SCALE(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Scale(SCALE, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Scale3_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Scale(SCALE, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Scale4_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Scale(SCALE, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Transform1_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QTranslationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QRotationMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QScalingMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QTransformationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x3;
+
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x3> TRANSFORMATION = QTransformationMatrix<QMatrix4x3>(TRANSLATION, QRotationMatrix3x3::GetIdentity(), SCALE);
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+	// [Execution]
+    SQParallelPoint::Transform(TRANSFORMATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Transform2_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x3> TRANSFORMATION = QTransformationMatrix<QMatrix4x3>(TRANSLATION, ROTATION, SCALE);
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Transform(TRANSFORMATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Transform3_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x4> TRANSFORMATION = QTransformationMatrix<QMatrix4x4>(TRANSLATION, ROTATION, SCALE);
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Transform(TRANSFORMATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Transform4_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x4> TRANSFORMATION = QTransformationMatrix<QMatrix4x4>(TRANSLATION, ROTATION, SCALE);
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Transform(TRANSFORMATION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Transform5_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    QSpaceConversionMatrix CONVERSION;
+    CONVERSION.SetViewSpaceMatrix(QVector3(SQFloat::_1, SQFloat::_2, SQFloat::_3),
+                                  QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1),
+                                  QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0));
+    const QVector3 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    QVector3 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Transform(CONVERSION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that no work is done when the number of points is zero.
+/// </summary>
+QTEST_CASE ( Transform6_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    QSpaceConversionMatrix CONVERSION;
+    CONVERSION.SetViewSpaceMatrix(QVector3(SQFloat::_1, SQFloat::_2, SQFloat::_3),
+                                  QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1),
+                                  QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0));
+    const QVector4 EXPECTED_POINT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1);
+    QVector4 arPoints[] = { EXPECTED_POINT };
+    QTaskScheduler scheduler(2U);
+
+    // [Execution]
+    SQParallelPoint::Transform(CONVERSION, arPoints, 0, scheduler);
+
+    // [Verification]
+    BOOST_CHECK(arPoints[0] == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that the points are transformed when the scheduler has no worker threads.
+/// </summary>
+QTEST_CASE ( Translate1_PointsAreTransformedWhenThereAreNoWorkers_Test )
+{
+    // [Preparation]
+    const QBaseVector3 TRANSLATION(SQFloat::_1, -SQFloat::_2, SQFloat::_3);
+    const unsigned int POINTS_COUNT = 100U;
+    QVector3 arExpectedPoints[POINTS_COUNT];
+    QVector3 arPoints[POINTS_COUNT];
+    SQParallelPointTestHelper::FillPoints(arExpectedPoints, POINTS_COUNT);
+    SQParallelPointTestHelper::FillPoints(arPoints, POINTS_COUNT);
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+    QTaskScheduler scheduler(0);
+
+	// [Execution]
+    SQParallelPoint::Translate(TRANSLATION, arPoints, POINTS_COUNT, scheduler, 4U);
+
+    // [Verification]
+    BOOST_CHECK(SQParallelPointTestHelper::AreIdentical(arPoints, arExpectedPoints, POINTS_COUNT));
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Translate1_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QBaseVector3 TRANSLATION(SQFloat::_1, -SQFloat::_2, SQFloat::_3);
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Translate(TRANSLATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Translate2_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QBaseVector3 TRANSLATION(SQFloat::_1, -SQFloat::_2, SQFloat::_3);
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Translate(TRANSLATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Translate3_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Translate(TRANSLATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Translate4_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Translate(TRANSLATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Translate5_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Translate(TRANSLATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Translate6_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Translate(TRANSLATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Rotate1_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QQuaternion ROTATION(SQAngle::_HalfPi, SQAngle::_QuarterPi, SQAngle::_ThirdPi);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QQuaternion ROTATION(SQAngle::_90, SQAngle::_45, SQAngle::_60);
+#endif
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Rotate(ROTATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Rotate2_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QQuaternion ROTATION(SQAngle::_HalfPi, SQAngle::_QuarterPi, SQAngle::_ThirdPi);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QQuaternion ROTATION(SQAngle::_90, SQAngle::_45, SQAngle::_60);
+#endif
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Rotate(ROTATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Rotate3_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Rotate(ROTATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Rotate4_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Rotate(ROTATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Scale1_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QBaseVector3 SCALE(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Scale(SCALE, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Scale2_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QBaseVector3 SCALE(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Scale(SCALE, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Scale3_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Scale(SCALE, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Scale4_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Scale(SCALE, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Transform1_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x3> TRANSFORMATION = QTransformationMatrix<QMatrix4x3>(TRANSLATION, ROTATION, SCALE);
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Transform(TRANSFORMATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Transform2_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x3> TRANSFORMATION = QTransformationMatrix<QMatrix4x3>(TRANSLATION, ROTATION, SCALE);
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Transform(TRANSFORMATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Transform3_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x4> TRANSFORMATION = QTransformationMatrix<QMatrix4x4>(TRANSLATION, ROTATION, SCALE);
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Transform(TRANSFORMATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Transform4_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x4> TRANSFORMATION = QTransformationMatrix<QMatrix4x4>(TRANSLATION, ROTATION, SCALE);
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Transform(TRANSFORMATION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Transform5_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QSpaceConversionMatrix CONVERSION;
+    CONVERSION.SetViewSpaceMatrix(QVector3(SQFloat::_1, SQFloat::_2, SQFloat::_3),
+                                  QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1),
+                                  QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0));
+    QVector3* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Transform(CONVERSION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Transform6_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QSpaceConversionMatrix CONVERSION;
+    CONVERSION.SetViewSpaceMatrix(QVector3(SQFloat::_1, SQFloat::_2, SQFloat::_3),
+                                  QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1),
+                                  QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0));
+    QVector4* arPoints = null_q;
+    QTaskScheduler scheduler(1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelPoint::Transform(CONVERSION, arPoints, 1U, scheduler);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+// End - Test Suite: SQParallelPoint
+QTEST_SUITE_END()
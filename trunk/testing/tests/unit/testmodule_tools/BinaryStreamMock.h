@@ -0,0 +1,210 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __BINARYSTREAMMOCK__
+#define __BINARYSTREAMMOCK__
+
+#include <vector>
+#include <cstring>
+#include "DataTypesDefinitions.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools    
+{
+namespace Containers
+{
+namespace Test
+{
+
+/// <summary>
+/// Binary writer and reader that stores the bytes in memory and counts the number of calls to its WriteBytes and ReadBytes methods.
+/// Bytes are read in the same order they were written.
+/// </summary>
+class BinaryStreamMock
+{
+    // CONSTRUCTORS
+    // ---------------
+
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    BinaryStreamMock() : m_uReadPosition(0),
+                         m_uWriteCalls(0),
+                         m_uReadCalls(0)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+
+public:
+
+    /// <summary>
+    /// Appends a block of bytes to the stored bytes. Increases the write call count.
+    /// </summary>
+    /// <param name="pBuffer">The bytes to write.</param>
+    /// <param name="uSize">The number of bytes to write.</param>
+    void WriteBytes(const void* pBuffer, const pointer_uint_q uSize)
+    {
+        const u8_q* pBytes = static_cast<const u8_q*>(pBuffer);
+        m_arBytes.insert(m_arBytes.end(), pBytes, pBytes + uSize);
+        ++m_uWriteCalls;
+    }
+
+    /// <summary>
+    /// Copies a block of the stored bytes, from the last read position, to an output buffer. Increases the read call count.
+    /// </summary>
+    /// <param name="pOutput">The buffer where the bytes will be copied.</param>
+    /// <param name="uSize">The number of bytes to read.</param>
+    void ReadBytes(void* pOutput, const pointer_uint_q uSize)
+    {
+        memcpy(pOutput, &m_arBytes[m_uReadPosition], uSize);
+        m_uReadPosition += uSize;
+        ++m_uReadCalls;
+    }
+
+    /// <summary>
+    /// Writes the bytes of a value.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <returns>
+    /// A reference to the mock.
+    /// </returns>
+    template<class T>
+    BinaryStreamMock& operator<<(const T &value)
+    {
+        this->WriteBytes(&value, sizeof(T));
+        return *this;
+    }
+
+    /// <summary>
+    /// Reads the bytes of a value.
+    /// </summary>
+    /// <param name="value">The value to read.</param>
+    /// <returns>
+    /// A reference to the mock.
+    /// </returns>
+    template<class T>
+    BinaryStreamMock& operator>>(T &value)
+    {
+        this->ReadBytes(&value, sizeof(T));
+        return *this;
+    }
+
+    /// <summary>
+    /// Sets both call counters to zero.
+    /// </summary>
+    void ResetCounters()
+    {
+        m_uWriteCalls = 0;
+        m_uReadCalls = 0;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+
+public:
+
+    /// <summary>
+    /// Gets the write call count.
+    /// </summary>
+    /// <returns>
+    /// The number of times the WriteBytes method has been called.
+    /// </returns>
+    unsigned int GetWriteCallsCount() const
+    {
+        return m_uWriteCalls;
+    }
+
+    /// <summary>
+    /// Gets the read call count.
+    /// </summary>
+    /// <returns>
+    /// The number of times the ReadBytes method has been called.
+    /// </returns>
+    unsigned int GetReadCallsCount() const
+    {
+        return m_uReadCalls;
+    }
+
+    /// <summary>
+    /// Gets the number of bytes that have not been read yet.
+    /// </summary>
+    /// <returns>
+    /// The number of remaining bytes.
+    /// </returns>
+    pointer_uint_q GetRemainingBytes() const
+    {
+        return m_arBytes.size() - m_uReadPosition;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+
+private:
+
+    /// <summary>
+    /// The stored bytes.
+    /// </summary>
+    std::vector<u8_q> m_arBytes;
+
+    /// <summary>
+    /// The position of the next byte to read.
+    /// </summary>
+    pointer_uint_q m_uReadPosition;
+
+    /// <summary>
+    /// The number of times the WriteBytes method has been called.
+    /// </summary>
+    unsigned int m_uWriteCalls;
+
+    /// <summary>
+    /// The number of times the ReadBytes method has been called.
+    /// </summary>
+    unsigned int m_uReadCalls;
+
+};
+
+
+} //namespace Test
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __BINARYSTREAMMOCK__
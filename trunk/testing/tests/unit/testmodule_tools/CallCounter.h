@@ -147,6 +147,17 @@ public:
         return (pointer_uint_q)this % uValue;
     }
 
+    /// <summary>
+    /// Conversion operator. Included to be able to use this type inside QFlatHashtable with SQIntegerHashProvider.
+    /// </summary>
+    /// <returns>
+    /// The address of the instance, as an integer.
+    /// </returns>
+    operator pointer_uint_q() const
+    {
+        return (pointer_uint_q)this;
+    }
+
 
     // PROPERTIES
 	// ---------------
@@ -33,10 +33,15 @@ using namespace boost::unit_test;
 #include "QArrayDynamic.h"
 
 #include "CallCounter.h"
+#include "BinaryStreamMock.h"
+#include "SerializableElementMock.h"
 #include "QAssertException.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamMock;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::SerializableElementMock;
 
 
 QTEST_SUITE_BEGIN( QArrayDynamic_TestSuite )
@@ -3949,5 +3954,208 @@ QTEST_CASE ( GetRange2_AssertionFailsWhenLastPositionIsNotLowerThanCount_Test )
 
 #endif
 
+/// <summary>
+/// Checks that the elements read replace the existing elements and are the same that were written.
+/// </summary>
+QTEST_CASE ( Deserialize_ElementsAreReadAsTheyWereWritten_Test )
+{
+    // [Preparation]
+    const u32_q ELEMENTS[] = {1U, 2U, 3U, 4U, 5U};
+    const pointer_uint_q COUNT = sizeof(ELEMENTS) / sizeof(u32_q);
+    QArrayDynamic<u32_q> arInput;
+    QArrayDynamic<u32_q> arResult;
+    BinaryStreamMock stream;
+
+    for(pointer_uint_q i = 0; i < COUNT; ++i)
+        arInput.Add(ELEMENTS[i]);
+
+    arResult.Add(9U);
+    arResult.Add(8U);
+    arInput.Serialize(stream);
+
+    // [Execution]
+    arResult.Deserialize(stream);
+
+    // [Verification]
+    BOOST_CHECK(arResult == arInput);
+    BOOST_CHECK_EQUAL(arResult.GetCount(), COUNT);
+}
+
+/// <summary>
+/// Checks that an empty array is read as an empty array.
+/// </summary>
+QTEST_CASE ( Deserialize_EmptyArrayIsReadAsEmpty_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+    QArrayDynamic<u32_q> arInput;
+    QArrayDynamic<u32_q> arResult;
+    BinaryStreamMock stream;
+    arResult.Add(9U);
+    arInput.Serialize(stream);
+
+    // [Execution]
+    arResult.Deserialize(stream);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arResult.IsEmpty(), IS_EMPTY);
+}
+
+/// <summary>
+/// Checks that elements that are not trivially copyable are read as they were written.
+/// </summary>
+QTEST_CASE ( Deserialize_NonTriviallyCopyableElementsAreReadAsTheyWereWritten_Test )
+{
+    // [Preparation]
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+    QArrayDynamic<string_q> arInput;
+    QArrayDynamic<string_q> arResult;
+    BinaryStreamMock stream;
+    arInput.Add("First");
+    arInput.Add(string_q::GetEmpty());
+    arInput.Add("Third");
+    arInput.Serialize(stream);
+
+    // [Execution]
+    arResult.Deserialize(stream);
+
+    // [Verification]
+    BOOST_CHECK(arResult == arInput);
+    BOOST_CHECK(arResult[2].GetLength() == arInput[2].GetLength());
+}
+
+/// <summary>
+/// Checks that the length of the strings read is calculated from their text instead of trusting the length written in the stream.
+/// </summary>
+QTEST_CASE ( Deserialize_LengthOfStringsIsCalculatedFromTheReadText_Test )
+{
+    // [Preparation]
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+    using Kinesis::QuimeraEngine::Common::DataTypes::u16_q;
+    using Kinesis::QuimeraEngine::Common::DataTypes::char_q;
+    using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+
+    const u16_q TEXT[] = {'a', 0xD83D, 0xDE00, 'b'}; // The second character is formed by a surrogate pair
+    const pointer_uint_q CODE_UNITS = sizeof(TEXT) / sizeof(u16_q);
+    const u32_q CORRUPT_LENGTH = 1000U;
+    const unsigned int EXPECTED_LENGTH = 3U;
+    const char_q EXPECTED_LAST_CHARACTER('b');
+    QArrayDynamic<string_q> arResult;
+    BinaryStreamMock stream;
+    SQBinarySerializer::WriteHeader(stream, SQBinarySerializer::GetElementSize<string_q>(), 1U);
+    SQBinarySerializer::WriteHeader(stream, SQBinarySerializer::GetElementSize<u16_q>(), CODE_UNITS);
+    stream << CORRUPT_LENGTH;
+    SQBinarySerializer::Write(stream, TEXT, CODE_UNITS);
+
+    // [Execution]
+    arResult.Deserialize(stream);
+
+    // [Verification]
+    unsigned int uLength = arResult[0].GetLength();
+    BOOST_CHECK_EQUAL(uLength, EXPECTED_LENGTH);
+    BOOST_CHECK(arResult[0][EXPECTED_LENGTH - 1U] == EXPECTED_LAST_CHARACTER);
+}
+
+/// <summary>
+/// Checks that classes are not considered trivially copyable by default, so the buffers they own are serialized instead of their addresses.
+/// </summary>
+QTEST_CASE ( Deserialize_ClassesAreNotTriviallyCopyableByDefault_Test )
+{
+    // [Preparation]
+    using Kinesis::QuimeraEngine::Common::DataTypes::SQBinarySerializer;
+
+    const pointer_uint_q EXPECTED_ELEMENT_SIZE = 0;
+    QArrayDynamic<SerializableElementMock> arInput;
+    QArrayDynamic<SerializableElementMock> arResult;
+    BinaryStreamMock stream;
+    arInput.Add(SerializableElementMock(1U));
+    arInput.Add(SerializableElementMock(2U));
+    arInput.Add(SerializableElementMock(3U));
+    arInput.Serialize(stream);
+
+    // [Execution]
+    arResult.Deserialize(stream);
+
+    // [Verification]
+    pointer_uint_q uElementSize = SQBinarySerializer::GetElementSize<SerializableElementMock>();
+    BOOST_CHECK_EQUAL(uElementSize, EXPECTED_ELEMENT_SIZE);
+    BOOST_CHECK(arResult[0] == SerializableElementMock(1U));
+    BOOST_CHECK(arResult[1] == SerializableElementMock(2U));
+    BOOST_CHECK(arResult[2] == SerializableElementMock(3U));
+}
+
+/// <summary>
+/// Checks that the elements and the capacity of both arrays are exchanged.
+/// </summary>
+QTEST_CASE ( Swap_ElementsAndCapacityAreExchanged_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY_A = 8U;
+    const pointer_uint_q EXPECTED_CAPACITY_B = 3U;
+    QArrayDynamic<int> arArrayA(EXPECTED_CAPACITY_B);
+    QArrayDynamic<int> arArrayB(EXPECTED_CAPACITY_A);
+    arArrayA.Add(1);
+    arArrayA.Add(2);
+    arArrayB.Add(3);
+    const int* EXPECTED_POINTER_A = &arArrayB[0];
+
+    // [Execution]
+    arArrayA.Swap(arArrayB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arArrayA.GetCount(), 1U);
+    BOOST_CHECK_EQUAL(arArrayB.GetCount(), 2U);
+    BOOST_CHECK_EQUAL(arArrayA.GetCapacity(), EXPECTED_CAPACITY_A);
+    BOOST_CHECK_EQUAL(arArrayB.GetCapacity(), EXPECTED_CAPACITY_B);
+    BOOST_CHECK_EQUAL(&arArrayA[0], EXPECTED_POINTER_A);
+    BOOST_CHECK_EQUAL(arArrayA[0], 3);
+    BOOST_CHECK_EQUAL(arArrayB[0], 1);
+    BOOST_CHECK_EQUAL(arArrayB[1], 2);
+}
+
+/// <summary>
+/// Checks that no copy constructor, assignment operator or destructor is called.
+/// </summary>
+QTEST_CASE ( Swap_ElementsAreNotCopied_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    QArrayDynamic<CallCounter> arArrayA(3U);
+    QArrayDynamic<CallCounter> arArrayB(3U);
+    arArrayA.Add(CallCounter());
+    arArrayB.Add(CallCounter());
+    arArrayB.Add(CallCounter());
+    const unsigned int EXPECTED_CALLS = 0;
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    arArrayA.Swap(arArrayB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetAssignmentCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetDestructorCallsCount(), EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that elements can still be swapped by index.
+/// </summary>
+QTEST_CASE ( Swap_ElementsCanStillBeSwappedByIndex_Test )
+{
+    // [Preparation]
+    QArrayDynamic<int> arArray(3U);
+    arArray.Add(1);
+    arArray.Add(2);
+
+    // [Execution]
+    arArray.Swap(0, 1U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arArray[0], 2);
+    BOOST_CHECK_EQUAL(arArray[1], 1);
+}
+
 // End - Test Suite: QArrayDynamic
 QTEST_SUITE_END()
@@ -35,6 +35,7 @@ using namespace boost::unit_test;
 #include "QArrayFixedTestClass.h"
 #include "ArrayElementMock.h"
 #include "CallCounter.h"
+#include "BinaryStreamMock.h"
 #include "QAssertException.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
@@ -44,6 +45,7 @@ using Kinesis::QuimeraEngine::Tools::Containers::QArrayFixed;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QArrayFixedWhiteBox;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::ArrayElementMock;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QArrayFixedTestClass;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamMock;
 
 i16_q ArrayElementMock::m_nNumberOfAllocatedObjects = 0;
 
@@ -2243,6 +2245,110 @@ QTEST_CASE( IsEmpty_ReturnsFalseWhenTheArrayIsNotEmpty_Test )
     BOOST_CHECK_EQUAL( bIsEmpty, ARRAY_NOT_EMPTY );
 }
 
+/// <summary>
+/// Checks that trivially copyable elements are written with only one call to the writer, after the header.
+/// </summary>
+QTEST_CASE ( Serialize_TriviallyCopyableElementsAreWrittenWithOnlyOneCall_Test )
+{
+    // [Preparation]
+    const unsigned int HEADER_CALLS = 3U;
+    const unsigned int EXPECTED_CALLS = HEADER_CALLS + 1U;
+    QArrayFixed<u32_q> arInput(10, 7U);
+    BinaryStreamMock stream;
+
+    // [Execution]
+    arInput.Serialize(stream);
+
+    // [Verification]
+    unsigned int uCalls = stream.GetWriteCallsCount();
+    BOOST_CHECK_EQUAL(uCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that the elements read are the same that were written.
+/// </summary>
+QTEST_CASE ( Deserialize_ElementsAreReadAsTheyWereWritten_Test )
+{
+    // [Preparation]
+    const u32_q ELEMENTS[] = {1U, 2U, 3U, 4U, 5U};
+    const pointer_uint_q COUNT = sizeof(ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> arInput(COUNT, 0);
+    QArrayFixed<u32_q> arResult(COUNT, 0);
+    BinaryStreamMock stream;
+
+    for(pointer_uint_q i = 0; i < COUNT; ++i)
+        arInput[i] = ELEMENTS[i];
+
+    arInput.Serialize(stream);
+
+    // [Execution]
+    arResult.Deserialize(stream);
+
+    // [Verification]
+    BOOST_CHECK(arResult == arInput);
+    BOOST_CHECK_EQUAL(stream.GetRemainingBytes(), 0U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of elements read does not match the number of elements of the array.
+/// </summary>
+QTEST_CASE ( Deserialize_AssertionFailsWhenTheNumberOfElementsIsDifferent_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QArrayFixed<u32_q> arInput(3, 1U);
+    QArrayFixed<u32_q> arResult(4, 0);
+    BinaryStreamMock stream;
+    arInput.Serialize(stream);
+
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        arResult.Deserialize(stream);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the elements read are of a different type.
+/// </summary>
+QTEST_CASE ( Deserialize_AssertionFailsWhenTheElementTypeIsDifferent_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QArrayFixed<u32_q> arInput(3, 1U);
+    QArrayFixed<u64_q> arResult(3, 0);
+    BinaryStreamMock stream;
+    arInput.Serialize(stream);
+
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        arResult.Deserialize(stream);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
 // End - Test Suite: QArrayFixed
 QTEST_SUITE_END()
 
@@ -48,12 +48,12 @@ namespace Test
 /// <summary>
 /// Class intended to be used to expose protected methods of QBinarySearchTree for testing purposes.
 /// </summary>
-template <class T, class AllocatorT = QPoolAllocator, class ComparatorT = SQComparatorDefault<T> >
-class QBinarySearchTreeWhiteBox : public QBinarySearchTree<T, AllocatorT, ComparatorT>
+template <class T, class AllocatorT = QPoolAllocator, class ComparatorT = SQComparatorDefault<T>, bool IsBalancedT = false>
+class QBinarySearchTreeWhiteBox : public QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>
 {
 public:
 
-    using typename QBinarySearchTree<T, AllocatorT, ComparatorT>::QBinaryNode;
+    using typename QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::QBinaryNode;
 
 
 	// CONSTRUCTORS
@@ -64,7 +64,7 @@ public:
     {
     }
 
-    QBinarySearchTreeWhiteBox(const pointer_uint_q uInitialCapacity) : QBinarySearchTree<T, AllocatorT, ComparatorT>(uInitialCapacity)
+    QBinarySearchTreeWhiteBox(const pointer_uint_q uInitialCapacity) : QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>(uInitialCapacity)
     {
     }
 
@@ -76,17 +76,43 @@ public:
 
     pointer_uint_q GetRootPosition() const
     {
-        return QBinarySearchTree<T, AllocatorT>::m_uRoot;
+        return QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::m_uRoot;
     }
 
     const AllocatorT& GetNodeAllocator() const
     {
-        return QBinarySearchTree<T, AllocatorT>::m_nodeAllocator;
+        return QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::m_nodeAllocator;
     }
 
     static pointer_uint_q GetEndPositionForward()
     {
-        return QBinarySearchTree<T, AllocatorT>::END_POSITION_FORWARD;
+        return QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::END_POSITION_FORWARD;
+    }
+
+    pointer_uint_q GetHeight() const
+    {
+        return this->IsEmpty() ? 0 : (QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::m_pNodeBasePointer + 
+                                      QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::m_uRoot)->GetHeight();
+    }
+
+    pointer_uint_q GetElementsInPreOrder(T* arElements) const
+    {
+        return this->_GetElementsInPreOrder(QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::m_uRoot, arElements);
+    }
+
+private:
+
+    pointer_uint_q _GetElementsInPreOrder(const pointer_uint_q uPosition, T* arElements) const
+    {
+        if(uPosition == QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::END_POSITION_FORWARD)
+            return 0;
+
+        const QBinaryNode* pNode = QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::m_pNodeBasePointer + uPosition;
+        arElements[0] = QBinarySearchTree<T, AllocatorT, ComparatorT, IsBalancedT>::m_pElementBasePointer[uPosition];
+        pointer_uint_q uCount = 1U;
+        uCount += this->_GetElementsInPreOrder(pNode->GetLeftChild(), arElements + uCount);
+        uCount += this->_GetElementsInPreOrder(pNode->GetRightChild(), arElements + uCount);
+        return uCount;
     }
 
 };
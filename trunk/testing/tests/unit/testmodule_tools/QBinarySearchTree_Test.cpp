@@ -33,11 +33,15 @@ using namespace boost::unit_test;
 #include "QBinarySearchTree.h"
 #include "QBinarySearchTreeWhiteBox.h"
 #include "CallCounter.h"
+#include "BinaryStreamMock.h"
 #include "QAssertException.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
 using Kinesis::QuimeraEngine::Tools::Containers::QBinarySearchTree;
+using Kinesis::QuimeraEngine::Tools::Containers::SQComparatorDefault;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QBinarySearchTreeWhiteBox;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamMock;
 
 
 QTEST_SUITE_BEGIN( QBinarySearchTree_TestSuite )
@@ -1125,6 +1129,149 @@ QTEST_CASE ( Add_CapacityIsIncrementedWhenNecessary_Test )
     BOOST_CHECK(uCapacityAfterAdding > CAPACITY_BEFORE_ADDING);
 }
 
+/// <summary>
+/// Checks that the balanced tree rotates its nodes when elements are added in ascending order.
+/// </summary>
+QTEST_CASE ( Add_BalancedTreeIsRotatedWhenElementsAreAddedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const int EXPECTED_VALUES[] = {4, 2, 1, 3, 6, 5, 7};
+    QBinarySearchTreeWhiteBox<int, QPoolAllocator, SQComparatorDefault<int>, true> TREE(7);
+
+    // [Execution]
+    for(int i = 1; i <= 7; ++i)
+        TREE.Add(i, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    int arElements[7];
+    const pointer_uint_q ELEMENT_COUNT = TREE.GetElementsInPreOrder(arElements);
+
+    for(pointer_uint_q i = 0; i < ELEMENT_COUNT; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && arElements[i] == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(ELEMENT_COUNT, 7U);
+}
+
+/// <summary>
+/// Checks that the balanced tree rotates its nodes when elements are added in descending order.
+/// </summary>
+QTEST_CASE ( Add_BalancedTreeIsRotatedWhenElementsAreAddedInDescendingOrder_Test )
+{
+    // [Preparation]
+    const int EXPECTED_VALUES[] = {4, 2, 1, 3, 6, 5, 7};
+    QBinarySearchTreeWhiteBox<int, QPoolAllocator, SQComparatorDefault<int>, true> TREE(7);
+
+    // [Execution]
+    for(int i = 7; i >= 1; --i)
+        TREE.Add(i, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    int arElements[7];
+    const pointer_uint_q ELEMENT_COUNT = TREE.GetElementsInPreOrder(arElements);
+
+    for(pointer_uint_q i = 0; i < ELEMENT_COUNT; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && arElements[i] == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(ELEMENT_COUNT, 7U);
+}
+
+/// <summary>
+/// Checks that the height of the balanced tree is the minimum possible when many elements are added in ascending order.
+/// </summary>
+QTEST_CASE ( Add_BalancedTreeHeightIsMinimumWhenManyElementsAreAddedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const int ELEMENT_COUNT = 1023;
+    const pointer_uint_q EXPECTED_HEIGHT = 10U;
+    QBinarySearchTreeWhiteBox<int, QPoolAllocator, SQComparatorDefault<int>, true> TREE(ELEMENT_COUNT);
+
+    // [Execution]
+    for(int i = 0; i < ELEMENT_COUNT; ++i)
+        TREE.Add(i, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    pointer_uint_q uHeight = TREE.GetHeight();
+    BOOST_CHECK_EQUAL(uHeight, EXPECTED_HEIGHT);
+}
+
+/// <summary>
+/// Checks that the balanced tree performs a double rotation when the element is added to the right of the left child of an unbalanced node.
+/// </summary>
+QTEST_CASE ( Add_BalancedTreeIsRotatedTwiceWhenElementIsAddedToTheRightOfTheLeftChild_Test )
+{
+    // [Preparation]
+    const int EXPECTED_VALUES[] = {2, 1, 3};
+    QBinarySearchTreeWhiteBox<int, QPoolAllocator, SQComparatorDefault<int>, true> TREE(3);
+    TREE.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    TREE.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    int arElements[3];
+    const pointer_uint_q ELEMENT_COUNT = TREE.GetElementsInPreOrder(arElements);
+
+    for(pointer_uint_q i = 0; i < ELEMENT_COUNT; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && arElements[i] == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(ELEMENT_COUNT, 3U);
+}
+
+/// <summary>
+/// Checks that the balanced tree performs a double rotation when the element is added to the left of the right child of an unbalanced node.
+/// </summary>
+QTEST_CASE ( Add_BalancedTreeIsRotatedTwiceWhenElementIsAddedToTheLeftOfTheRightChild_Test )
+{
+    // [Preparation]
+    const int EXPECTED_VALUES[] = {2, 1, 3};
+    QBinarySearchTreeWhiteBox<int, QPoolAllocator, SQComparatorDefault<int>, true> TREE(3);
+    TREE.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    TREE.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    int arElements[3];
+    const pointer_uint_q ELEMENT_COUNT = TREE.GetElementsInPreOrder(arElements);
+
+    for(pointer_uint_q i = 0; i < ELEMENT_COUNT; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && arElements[i] == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(ELEMENT_COUNT, 3U);
+}
+
+/// <summary>
+/// Checks that the returned iterator points to the added element when the tree is balanced and nodes are rotated.
+/// </summary>
+QTEST_CASE ( Add_ReturnedIteratorPointsToAddedElementWhenBalancedTreeIsRotated_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENT = 3;
+    QBinarySearchTree<int, QPoolAllocator, SQComparatorDefault<int>, true> TREE(3);
+    TREE.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    QBinarySearchTree<int, QPoolAllocator, SQComparatorDefault<int>, true>::QConstBinarySearchTreeIterator itResult = TREE.Add(INPUT_ELEMENT, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itResult, INPUT_ELEMENT);
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
@@ -1461,6 +1608,101 @@ QTEST_CASE ( Remove_ReturnedIteratorPointsToNextElement_Test )
     BOOST_CHECK(itResult == EXPECTED_ITERATOR);
 }
 
+/// <summary>
+/// Checks that the element is replaced with its in-order predecessor when the tree is balanced and the element has left and right children.
+/// </summary>
+QTEST_CASE ( Remove_ElementIsReplacedWithPredecessorWhenBalancedTreeAndItHasLeftAndRightChildren_Test )
+{
+    // [Preparation]
+    const int EXPECTED_VALUES[] = {3, 2, 1, 6, 5, 7};
+    QBinarySearchTreeWhiteBox<int, QPoolAllocator, SQComparatorDefault<int>, true> TREE(7);
+
+    for(int i = 1; i <= 7; ++i)
+        TREE.Add(i, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    QBinarySearchTree<int, QPoolAllocator, SQComparatorDefault<int>, true>::QConstBinarySearchTreeIterator itElementPosition = TREE.PositionOf(4, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    TREE.Remove(itElementPosition);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    int arElements[6];
+    const pointer_uint_q ELEMENT_COUNT = TREE.GetElementsInPreOrder(arElements);
+
+    for(pointer_uint_q i = 0; i < ELEMENT_COUNT; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && arElements[i] == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(ELEMENT_COUNT, 6U);
+}
+
+/// <summary>
+/// Checks that the balanced tree rotates its nodes when the removal of a leaf makes it unbalanced.
+/// </summary>
+QTEST_CASE ( Remove_BalancedTreeIsRotatedWhenRemovingLeafUnbalancesIt_Test )
+{
+    // [Preparation]
+    const int EXPECTED_VALUES[] = {3, 2, 4};
+    QBinarySearchTreeWhiteBox<int, QPoolAllocator, SQComparatorDefault<int>, true> TREE(4);
+    TREE.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    QBinarySearchTree<int, QPoolAllocator, SQComparatorDefault<int>, true>::QConstBinarySearchTreeIterator itElementPosition = TREE.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(4, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    TREE.Remove(itElementPosition);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    int arElements[3];
+    const pointer_uint_q ELEMENT_COUNT = TREE.GetElementsInPreOrder(arElements);
+
+    for(pointer_uint_q i = 0; i < ELEMENT_COUNT; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && arElements[i] == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(ELEMENT_COUNT, 3U);
+}
+
+/// <summary>
+/// Checks that the balanced tree keeps all the remaining elements sorted after removing many of them.
+/// </summary>
+QTEST_CASE ( Remove_BalancedTreeKeepsRemainingElementsSortedAfterManyRemovals_Test )
+{
+    // [Preparation]
+    const int ELEMENT_COUNT = 101;
+    QBinarySearchTree<int, QPoolAllocator, SQComparatorDefault<int>, true> TREE(ELEMENT_COUNT);
+
+    for(int i = 0; i < ELEMENT_COUNT; ++i)
+        TREE.Add((i * 37) % ELEMENT_COUNT, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    for(int i = 0; i < ELEMENT_COUNT; i += 2)
+        TREE.Remove(TREE.PositionOf((i * 53) % ELEMENT_COUNT, EQTreeTraversalOrder::E_DepthFirstInOrder));
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    QBinarySearchTree<int, QPoolAllocator, SQComparatorDefault<int>, true>::QConstBinarySearchTreeIterator it = TREE.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+    int nPreviousValue = -1;
+    int nCount = 0;
+
+    for(; !it.IsEnd(); ++it, ++nCount)
+    {
+        bResultIsWhatEspected = bResultIsWhatEspected && *it > nPreviousValue;
+        nPreviousValue = *it;
+    }
+
+    for(int i = 1; i < ELEMENT_COUNT; i += 2)
+        bResultIsWhatEspected = bResultIsWhatEspected && TREE.Contains((i * 53) % ELEMENT_COUNT);
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(nCount, ELEMENT_COUNT / 2);
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
@@ -2000,6 +2242,37 @@ QTEST_CASE ( IsEmpty_ReturnsFalseWhenTreeIsNotEmpty_Test )
     BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
 }
 
+/// <summary>
+/// Checks that the elements read are the same that were written and the tree keeps the same shape.
+/// </summary>
+QTEST_CASE ( Deserialize_ElementsAreReadAsTheyWereWrittenAndTheShapeIsKept_Test )
+{
+    // [Preparation]
+    const int ELEMENTS[] = {5, 3, 8, 1, 4, 9, 7, 2};
+    const pointer_uint_q COUNT = sizeof(ELEMENTS) / sizeof(int);
+    QBinarySearchTreeWhiteBox<int> treeInput(COUNT);
+    QBinarySearchTreeWhiteBox<int> treeResult(1);
+    BinaryStreamMock stream;
+
+    for(pointer_uint_q i = 0; i < COUNT; ++i)
+        treeInput.Add(ELEMENTS[i], EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    treeResult.Add(6, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    treeInput.Serialize(stream);
+
+    // [Execution]
+    treeResult.Deserialize(stream);
+
+    // [Verification]
+    int arExpectedElements[COUNT];
+    int arResultElements[COUNT];
+    treeInput.GetElementsInPreOrder(arExpectedElements);
+    const pointer_uint_q RESULT_COUNT = treeResult.GetElementsInPreOrder(arResultElements);
+
+    BOOST_CHECK_EQUAL(RESULT_COUNT, COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResultElements, arResultElements + COUNT, arExpectedElements, arExpectedElements + COUNT);
+}
+
 // End - Test Suite: QBinarySearchTree
 
 QTEST_SUITE_END()
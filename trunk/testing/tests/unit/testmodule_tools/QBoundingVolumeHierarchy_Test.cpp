@@ -0,0 +1,658 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QBoundingVolumeHierarchy.h"
+#include "QVector3.h"
+#include "QRay3D.h"
+#include "QHexahedron.h"
+#include "QArrayDynamic.h"
+#include "SQFloat.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Tools::Math::QBoundingVolumeHierarchy;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseHexahedron;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseLineSegment;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseOrb;
+using Kinesis::QuimeraEngine::Tools::Math::QHexahedron;
+using Kinesis::QuimeraEngine::Tools::Math::QRay3D;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+
+typedef QBaseTriangle<QVector3> QTriangleT;
+typedef QBaseHexahedron<QVector3> QHexahedronT;
+
+/// <summary>
+/// Fills an array with triangles parallel to the XY plane, one per cell of a grid of 1x1 cells, in several layers separated by 1 unit 
+/// along Z. The size and position of every triangle inside its cell varies so the tree is not perfectly regular.
+/// </summary>
+void GetTriangleGrid(QTriangleT* arTriangles, const unsigned int uCellsPerSide, const unsigned int uLayers)
+{
+    unsigned int uSeed = 1234U;
+
+    for(unsigned int uLayer = 0; uLayer < uLayers; ++uLayer)
+    {
+        for(unsigned int i = 0; i < uCellsPerSide * uCellsPerSide; ++i)
+        {
+            uSeed = uSeed * 1103515245U + 12345U;
+            const float_q OFFSET = scast_q((uSeed >> 16U) % 100U, float_q) * SQFloat::_0_25 / scast_q(100, float_q);
+            const float_q X = scast_q(i % uCellsPerSide, float_q) + OFFSET;
+            const float_q Y = scast_q(i / uCellsPerSide, float_q) + OFFSET;
+            const float_q Z = scast_q(uLayer, float_q) + OFFSET;
+
+            arTriangles[uLayer * uCellsPerSide * uCellsPerSide + i] = QTriangleT(QVector3(X, Y, Z),
+                                                                                 QVector3(X + SQFloat::_0_5, Y, Z),
+                                                                                 QVector3(X, Y + SQFloat::_0_5, Z));
+        }
+    }
+}
+
+/// <summary>
+/// Fills an array with cubes whose edges measure 0.5 units, one per cell of a grid of 1x1x1 cells.
+/// </summary>
+void GetCubeGrid(QHexahedronT* arCubes, const unsigned int uCellsPerSide)
+{
+    for(unsigned int i = 0; i < uCellsPerSide * uCellsPerSide * uCellsPerSide; ++i)
+    {
+        const QVector3 CENTER(scast_q(i % uCellsPerSide, float_q) + SQFloat::_0_5,
+                              scast_q((i / uCellsPerSide) % uCellsPerSide, float_q) + SQFloat::_0_5,
+                              scast_q(i / (uCellsPerSide * uCellsPerSide), float_q) + SQFloat::_0_5);
+        arCubes[i] = QHexahedron<QVector3>(CENTER, SQFloat::_0_5, SQFloat::_0_5, SQFloat::_0_5);
+    }
+}
+
+/// <summary>
+/// Checks whether an array contains a value.
+/// </summary>
+bool Contains(const QArrayDynamic<unsigned int> &arValues, const unsigned int uValue)
+{
+    for(unsigned int i = 0; i < arValues.GetCount(); ++i)
+        if(arValues[i] == uValue)
+            return true;
+
+    return false;
+}
+
+QTEST_SUITE_BEGIN( QBoundingVolumeHierarchy_TestSuite )
+
+/// <summary>
+/// Checks that all the primitives are stored and the tree has the number of nodes of a binary tree.
+/// </summary>
+QTEST_CASE ( Constructor_TreeContainsAllThePrimitives_Test )
+{
+    // [Preparation]
+    const unsigned int PRIMITIVE_COUNT = 300U;
+    QTriangleT arTriangles[PRIMITIVE_COUNT];
+    GetTriangleGrid(arTriangles, 10U, 3U);
+    const unsigned int EXPECTED_MAX_NODE_COUNT = 2U * PRIMITIVE_COUNT - 1U;
+    const unsigned int EXPECTED_MIN_NODE_COUNT = 2U * (PRIMITIVE_COUNT / 4U) - 1U;
+
+	// [Execution]
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, PRIMITIVE_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bvh.GetPrimitiveCount(), PRIMITIVE_COUNT);
+    BOOST_CHECK(bvh.GetNodeCount() <= EXPECTED_MAX_NODE_COUNT);
+    BOOST_CHECK(bvh.GetNodeCount() >= EXPECTED_MIN_NODE_COUNT);
+    BOOST_CHECK_EQUAL(bvh.GetNodeCount() % 2U, 1U);
+}
+
+/// <summary>
+/// Checks that a hierarchy can be created with no primitives and the queries find nothing.
+/// </summary>
+QTEST_CASE ( Constructor_EmptyHierarchyFindsNothing_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_NODE_COUNT = 0;
+    const unsigned int EXPECTED_FOUND_COUNT = 0;
+    const bool EXPECTED_RESULT = false;
+    const QRay3D<QVector3> RAY(QVector3::GetNullVector(), QVector3::GetUnitVectorZ());
+    const QBaseOrb<QVector3> ORB(QVector3::GetNullVector(), SQFloat::_10);
+    QArrayDynamic<unsigned int> arFound;
+    unsigned int uPrimitive = 0;
+    float_q fDistance = SQFloat::_0;
+
+	// [Execution]
+    QBoundingVolumeHierarchy<QTriangleT> bvh(null_q, 0);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bvh.GetNodeCount(), EXPECTED_NODE_COUNT);
+    BOOST_CHECK_EQUAL(bvh.FindClosestIntersection(RAY, uPrimitive, fDistance), EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(bvh.FindIntersections(ORB, arFound), EXPECTED_FOUND_COUNT);
+}
+
+/// <summary>
+/// Checks that the closest triangle is found when a ray crosses several of them.
+/// </summary>
+QTEST_CASE ( FindClosestIntersection1_ReturnsTheClosestTriangle_Test )
+{
+    // [Preparation]
+    const unsigned int LAYERS = 5U;
+    QTriangleT arTriangles[LAYERS];
+
+    for(unsigned int i = 0; i < LAYERS; ++i)
+    {
+        const float_q Z = scast_q(i, float_q);
+        arTriangles[i] = QTriangleT(QVector3(SQFloat::_0, SQFloat::_0, Z), QVector3(SQFloat::_2, SQFloat::_0, Z), QVector3(SQFloat::_0, SQFloat::_2, Z));
+    }
+
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, LAYERS);
+    const QRay3D<QVector3> RAY_UP(QVector3(SQFloat::_0_5, SQFloat::_0_5, -SQFloat::_1), QVector3::GetUnitVectorZ());
+    const QRay3D<QVector3> RAY_DOWN(QVector3(SQFloat::_0_5, SQFloat::_0_5, SQFloat::_10), QVector3::GetUnitVectorInvZ());
+    const unsigned int EXPECTED_PRIMITIVE_UP = 0;
+    const unsigned int EXPECTED_PRIMITIVE_DOWN = LAYERS - 1U;
+    const float_q EXPECTED_DISTANCE_UP = SQFloat::_1;
+    const float_q EXPECTED_DISTANCE_DOWN = SQFloat::_6;
+
+	// [Execution]
+    unsigned int uPrimitiveUp = 0;
+    unsigned int uPrimitiveDown = 0;
+    float_q fDistanceUp = SQFloat::_0;
+    float_q fDistanceDown = SQFloat::_0;
+    bool bResultUp = bvh.FindClosestIntersection(RAY_UP, uPrimitiveUp, fDistanceUp);
+    bool bResultDown = bvh.FindClosestIntersection(RAY_DOWN, uPrimitiveDown, fDistanceDown);
+
+    // [Verification]
+    BOOST_CHECK(bResultUp);
+    BOOST_CHECK(bResultDown);
+    BOOST_CHECK_EQUAL(uPrimitiveUp, EXPECTED_PRIMITIVE_UP);
+    BOOST_CHECK_EQUAL(uPrimitiveDown, EXPECTED_PRIMITIVE_DOWN);
+    BOOST_CHECK(SQFloat::AreEqual(fDistanceUp, EXPECTED_DISTANCE_UP));
+    BOOST_CHECK(SQFloat::AreEqual(fDistanceDown, EXPECTED_DISTANCE_DOWN));
+}
+
+/// <summary>
+/// Checks that the result is the same as checking every triangle one by one, for many rays.
+/// </summary>
+QTEST_CASE ( FindClosestIntersection1_ResultIsTheSameAsCheckingEveryTriangle_Test )
+{
+    // [Preparation]
+    const unsigned int CELLS_PER_SIDE = 12U;
+    const unsigned int PRIMITIVE_COUNT = CELLS_PER_SIDE * CELLS_PER_SIDE * 4U;
+    QTriangleT arTriangles[PRIMITIVE_COUNT];
+    GetTriangleGrid(arTriangles, CELLS_PER_SIDE, 4U);
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, PRIMITIVE_COUNT);
+
+    const unsigned int RAY_COUNT = 200U;
+    bool bAllResultsMatch = true;
+    unsigned int uHits = 0;
+    unsigned int uSeed = 42U;
+
+    for(unsigned int uRay = 0; uRay < RAY_COUNT; ++uRay)
+    {
+        uSeed = uSeed * 1103515245U + 12345U;
+        const float_q X = scast_q((uSeed >> 8U) % 1200U, float_q) / scast_q(100, float_q);
+        const float_q Y = scast_q((uSeed >> 4U) % 1200U, float_q) / scast_q(100, float_q);
+        const QRay3D<QVector3> RAY(QVector3(X, Y, SQFloat::_10), QVector3(SQFloat::_0_25, -SQFloat::_0_5, -SQFloat::_5).Normalize());
+
+        unsigned int uExpectedPrimitive = 0;
+        float_q fExpectedDistance = SQFloat::MaxFloat_Q;
+        bool bExpectedResult = false;
+
+        for(unsigned int i = 0; i < PRIMITIVE_COUNT; ++i)
+        {
+            float_q fDistance, fU, fV;
+
+            if(RAY.Intersection(arTriangles[i], fDistance, fU, fV) && fDistance < fExpectedDistance)
+            {
+                bExpectedResult = true;
+                fExpectedDistance = fDistance;
+                uExpectedPrimitive = i;
+            }
+        }
+
+	    // [Execution]
+        unsigned int uPrimitive = 0;
+        float_q fDistance = SQFloat::_0;
+        const bool RESULT = bvh.FindClosestIntersection(RAY, uPrimitive, fDistance);
+
+        if(RESULT)
+            ++uHits;
+
+        bAllResultsMatch = bAllResultsMatch && RESULT == bExpectedResult && 
+                           (!RESULT || (uPrimitive == uExpectedPrimitive && SQFloat::AreEqual(fDistance, fExpectedDistance)));
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAllResultsMatch);
+    BOOST_CHECK(uHits > 0);
+}
+
+/// <summary>
+/// Checks that nothing is found and the output parameters are not modified when the ray does not hit any primitive.
+/// </summary>
+QTEST_CASE ( FindClosestIntersection1_OutputIsNotModifiedWhenNothingIsHit_Test )
+{
+    // [Preparation]
+    const unsigned int PRIMITIVE_COUNT = 100U;
+    QTriangleT arTriangles[PRIMITIVE_COUNT];
+    GetTriangleGrid(arTriangles, 10U, 1U);
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, PRIMITIVE_COUNT);
+    const QRay3D<QVector3> RAY(QVector3(SQFloat::_5, SQFloat::_5, SQFloat::_5), QVector3::GetUnitVectorZ());
+    const bool EXPECTED_RESULT = false;
+    const unsigned int EXPECTED_PRIMITIVE = 1234U;
+    const float_q EXPECTED_DISTANCE = SQFloat::_8;
+
+	// [Execution]
+    unsigned int uPrimitive = EXPECTED_PRIMITIVE;
+    float_q fDistance = EXPECTED_DISTANCE;
+    bool bResult = bvh.FindClosestIntersection(RAY, uPrimitive, fDistance);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(uPrimitive, EXPECTED_PRIMITIVE);
+    BOOST_CHECK_EQUAL(fDistance, EXPECTED_DISTANCE);
+}
+
+/// <summary>
+/// Checks that the distance is zero when the origin of the ray is inside a hexahedron and that hexahedron is returned.
+/// </summary>
+QTEST_CASE ( FindClosestIntersection1_DistanceIsZeroWhenOriginIsInsideHexahedron_Test )
+{
+    // [Preparation]
+    const unsigned int PRIMITIVE_COUNT = 27U;
+    QHexahedronT arCubes[PRIMITIVE_COUNT];
+    GetCubeGrid(arCubes, 3U);
+    QBoundingVolumeHierarchy<QHexahedronT> bvh(arCubes, PRIMITIVE_COUNT);
+    const QRay3D<QVector3> RAY(QVector3(SQFloat::_1 + SQFloat::_0_5, SQFloat::_1 + SQFloat::_0_5, SQFloat::_1 + SQFloat::_0_5), QVector3::GetUnitVectorX());
+    const unsigned int EXPECTED_PRIMITIVE = 13U;
+    const float_q EXPECTED_DISTANCE = SQFloat::_0;
+
+	// [Execution]
+    unsigned int uPrimitive = 0;
+    float_q fDistance = SQFloat::_1;
+    bool bResult = bvh.FindClosestIntersection(RAY, uPrimitive, fDistance);
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+    BOOST_CHECK_EQUAL(uPrimitive, EXPECTED_PRIMITIVE);
+    BOOST_CHECK(SQFloat::AreEqual(fDistance, EXPECTED_DISTANCE));
+}
+
+/// <summary>
+/// Checks that the closest hexahedron is found when a ray crosses a row of them from the outside.
+/// </summary>
+QTEST_CASE ( FindClosestIntersection1_ReturnsTheClosestHexahedron_Test )
+{
+    // [Preparation]
+    const unsigned int PRIMITIVE_COUNT = 27U;
+    QHexahedronT arCubes[PRIMITIVE_COUNT];
+    GetCubeGrid(arCubes, 3U);
+    QBoundingVolumeHierarchy<QHexahedronT> bvh(arCubes, PRIMITIVE_COUNT);
+    const QRay3D<QVector3> RAY(QVector3(SQFloat::_10, SQFloat::_1 + SQFloat::_0_5, SQFloat::_0_5), QVector3::GetUnitVectorInvX());
+    const unsigned int EXPECTED_PRIMITIVE = 5U;
+    const float_q EXPECTED_DISTANCE = SQFloat::_10 - SQFloat::_2 - SQFloat::_0_5 - SQFloat::_0_25;
+
+	// [Execution]
+    unsigned int uPrimitive = 0;
+    float_q fDistance = SQFloat::_0;
+    bool bResult = bvh.FindClosestIntersection(RAY, uPrimitive, fDistance);
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+    BOOST_CHECK_EQUAL(uPrimitive, EXPECTED_PRIMITIVE);
+    BOOST_CHECK(SQFloat::AreEqual(fDistance, EXPECTED_DISTANCE));
+}
+
+/// <summary>
+/// Checks that triangles beyond the endpoint B of the line segment are ignored and the distance is measured from the endpoint A.
+/// </summary>
+QTEST_CASE ( FindClosestIntersection2_IgnoresPrimitivesBeyondEndpointB_Test )
+{
+    // [Preparation]
+    const unsigned int LAYERS = 5U;
+    QTriangleT arTriangles[LAYERS];
+
+    for(unsigned int i = 0; i < LAYERS; ++i)
+    {
+        const float_q Z = scast_q(i, float_q);
+        arTriangles[i] = QTriangleT(QVector3(SQFloat::_0, SQFloat::_0, Z), QVector3(SQFloat::_2, SQFloat::_0, Z), QVector3(SQFloat::_0, SQFloat::_2, Z));
+    }
+
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, LAYERS);
+    const QBaseLineSegment<QVector3> SEGMENT_HIT(QVector3(SQFloat::_0_5, SQFloat::_0_5, SQFloat::_10), QVector3(SQFloat::_0_5, SQFloat::_0_5, SQFloat::_3 + SQFloat::_0_5));
+    const QBaseLineSegment<QVector3> SEGMENT_MISS(QVector3(SQFloat::_0_5, SQFloat::_0_5, SQFloat::_10), QVector3(SQFloat::_0_5, SQFloat::_0_5, SQFloat::_5));
+    const unsigned int EXPECTED_PRIMITIVE = 4U;
+    const float_q EXPECTED_DISTANCE = SQFloat::_6;
+    const bool EXPECTED_RESULT_MISS = false;
+
+	// [Execution]
+    unsigned int uPrimitive = 0;
+    float_q fDistance = SQFloat::_0;
+    bool bResultHit = bvh.FindClosestIntersection(SEGMENT_HIT, uPrimitive, fDistance);
+    unsigned int uPrimitiveMiss = 0;
+    float_q fDistanceMiss = SQFloat::_0;
+    bool bResultMiss = bvh.FindClosestIntersection(SEGMENT_MISS, uPrimitiveMiss, fDistanceMiss);
+
+    // [Verification]
+    BOOST_CHECK(bResultHit);
+    BOOST_CHECK_EQUAL(uPrimitive, EXPECTED_PRIMITIVE);
+    BOOST_CHECK(SQFloat::AreEqual(fDistance, EXPECTED_DISTANCE));
+    BOOST_CHECK_EQUAL(bResultMiss, EXPECTED_RESULT_MISS);
+}
+
+/// <summary>
+/// Checks that all the triangles crossed by the ray are found.
+/// </summary>
+QTEST_CASE ( FindIntersections1_ReturnsAllTheTrianglesHitByTheRay_Test )
+{
+    // [Preparation]
+    const unsigned int CELLS_PER_SIDE = 10U;
+    const unsigned int LAYERS = 4U;
+    const unsigned int PRIMITIVE_COUNT = CELLS_PER_SIDE * CELLS_PER_SIDE * LAYERS;
+    QTriangleT arTriangles[PRIMITIVE_COUNT];
+    GetTriangleGrid(arTriangles, CELLS_PER_SIDE, LAYERS);
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, PRIMITIVE_COUNT);
+    const QRay3D<QVector3> RAY(QVector3(SQFloat::_3 + SQFloat::_0_25, SQFloat::_2 + SQFloat::_0_25, -SQFloat::_1), QVector3::GetUnitVectorZ());
+
+    QArrayDynamic<unsigned int> arExpected;
+
+    for(unsigned int i = 0; i < PRIMITIVE_COUNT; ++i)
+        if(RAY.Intersection(arTriangles[i]))
+            arExpected.Add(i);
+
+	// [Execution]
+    QArrayDynamic<unsigned int> arFound;
+    unsigned int uFoundCount = bvh.FindIntersections(RAY, arFound);
+
+    // [Verification]
+    BOOST_CHECK(arExpected.GetCount() > 0);
+    BOOST_CHECK_EQUAL(uFoundCount, arExpected.GetCount());
+    BOOST_CHECK_EQUAL(arFound.GetCount(), arExpected.GetCount());
+
+    for(unsigned int i = 0; i < arExpected.GetCount(); ++i)
+        BOOST_CHECK(Contains(arFound, arExpected[i]));
+}
+
+/// <summary>
+/// Checks that found primitives are added after the previous content of the array.
+/// </summary>
+QTEST_CASE ( FindIntersections1_PreviousContentOfArrayIsKept_Test )
+{
+    // [Preparation]
+    const unsigned int LAYERS = 3U;
+    QTriangleT arTriangles[LAYERS];
+
+    for(unsigned int i = 0; i < LAYERS; ++i)
+    {
+        const float_q Z = scast_q(i, float_q);
+        arTriangles[i] = QTriangleT(QVector3(SQFloat::_0, SQFloat::_0, Z), QVector3(SQFloat::_2, SQFloat::_0, Z), QVector3(SQFloat::_0, SQFloat::_2, Z));
+    }
+
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, LAYERS);
+    const QRay3D<QVector3> RAY(QVector3(SQFloat::_0_5, SQFloat::_0_5, -SQFloat::_1), QVector3::GetUnitVectorZ());
+    const unsigned int PREVIOUS_VALUE = 99U;
+    const unsigned int EXPECTED_FOUND_COUNT = LAYERS;
+    const unsigned int EXPECTED_TOTAL_COUNT = LAYERS + 1U;
+    QArrayDynamic<unsigned int> arFound;
+    arFound.Add(PREVIOUS_VALUE);
+
+	// [Execution]
+    unsigned int uFoundCount = bvh.FindIntersections(RAY, arFound);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uFoundCount, EXPECTED_FOUND_COUNT);
+    BOOST_CHECK_EQUAL(arFound.GetCount(), EXPECTED_TOTAL_COUNT);
+    BOOST_CHECK_EQUAL(arFound[0], PREVIOUS_VALUE);
+}
+
+/// <summary>
+/// Checks that only the hexahedra between both endpoints of the line segment are found.
+/// </summary>
+QTEST_CASE ( FindIntersections2_ReturnsOnlyPrimitivesBetweenEndpoints_Test )
+{
+    // [Preparation]
+    const unsigned int PRIMITIVE_COUNT = 64U;
+    QHexahedronT arCubes[PRIMITIVE_COUNT];
+    GetCubeGrid(arCubes, 4U);
+    QBoundingVolumeHierarchy<QHexahedronT> bvh(arCubes, PRIMITIVE_COUNT);
+    const QBaseLineSegment<QVector3> SEGMENT(QVector3(SQFloat::_0_5, SQFloat::_0_5, SQFloat::_0_5), QVector3(SQFloat::_2 + SQFloat::_0_5, SQFloat::_0_5, SQFloat::_0_5));
+    const unsigned int EXPECTED_FOUND_COUNT = 3U;
+    const unsigned int EXPECTED_PRIMITIVES[] = { 0, 1U, 2U };
+
+	// [Execution]
+    QArrayDynamic<unsigned int> arFound;
+    unsigned int uFoundCount = bvh.FindIntersections(SEGMENT, arFound);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uFoundCount, EXPECTED_FOUND_COUNT);
+
+    for(unsigned int i = 0; i < EXPECTED_FOUND_COUNT; ++i)
+        BOOST_CHECK(Contains(arFound, EXPECTED_PRIMITIVES[i]));
+}
+
+/// <summary>
+/// Checks that the triangles touched by the orb are found, including those whose vertices are all outside the orb.
+/// </summary>
+QTEST_CASE ( FindIntersections3_ReturnsTheTrianglesThatIntersectTheOrb_Test )
+{
+    // [Preparation]
+    QTriangleT arTriangles[3];
+    arTriangles[0] = QTriangleT(QVector3(-SQFloat::_10, -SQFloat::_10, SQFloat::_0), QVector3(SQFloat::_10, -SQFloat::_10, SQFloat::_0), QVector3(SQFloat::_0, SQFloat::_10, SQFloat::_0));
+    arTriangles[1] = QTriangleT(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_3), QVector3(SQFloat::_1, SQFloat::_0, SQFloat::_3), QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_3));
+    arTriangles[2] = QTriangleT(QVector3(SQFloat::_0_5, SQFloat::_0_5, SQFloat::_0_5), QVector3(SQFloat::_0_5, -SQFloat::_0_5, SQFloat::_0_5), QVector3(-SQFloat::_0_5, SQFloat::_0_5, SQFloat::_0_5));
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, 3U);
+    const QBaseOrb<QVector3> ORB(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1), SQFloat::_1);
+    const unsigned int EXPECTED_FOUND_COUNT = 2U;
+
+	// [Execution]
+    QArrayDynamic<unsigned int> arFound;
+    unsigned int uFoundCount = bvh.FindIntersections(ORB, arFound);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uFoundCount, EXPECTED_FOUND_COUNT);
+    BOOST_CHECK(Contains(arFound, 0));
+    BOOST_CHECK(Contains(arFound, 2U));
+}
+
+/// <summary>
+/// Checks that the hexahedra touched by the orb are found, including the one that contains it.
+/// </summary>
+QTEST_CASE ( FindIntersections3_ReturnsTheHexahedraThatIntersectTheOrb_Test )
+{
+    // [Preparation]
+    const unsigned int PRIMITIVE_COUNT = 27U;
+    QHexahedronT arCubes[PRIMITIVE_COUNT];
+    GetCubeGrid(arCubes, 3U);
+    QBoundingVolumeHierarchy<QHexahedronT> bvh(arCubes, PRIMITIVE_COUNT);
+    const QBaseOrb<QVector3> ORB(QVector3(SQFloat::_1 + SQFloat::_0_5, SQFloat::_1 + SQFloat::_0_5, SQFloat::_1 + SQFloat::_0_5), SQFloat::_1);
+    const unsigned int EXPECTED_FOUND_COUNT = 7U;
+    const unsigned int EXPECTED_PRIMITIVES[] = { 4U, 10U, 12U, 13U, 14U, 16U, 22U };
+
+	// [Execution]
+    QArrayDynamic<unsigned int> arFound;
+    unsigned int uFoundCount = bvh.FindIntersections(ORB, arFound);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uFoundCount, EXPECTED_FOUND_COUNT);
+
+    for(unsigned int i = 0; i < EXPECTED_FOUND_COUNT; ++i)
+        BOOST_CHECK(Contains(arFound, EXPECTED_PRIMITIVES[i]));
+}
+
+/// <summary>
+/// Checks that the hexahedra that overlap the box are found.
+/// </summary>
+QTEST_CASE ( FindIntersections4_ReturnsTheHexahedraThatIntersectTheHexahedron_Test )
+{
+    // [Preparation]
+    const unsigned int PRIMITIVE_COUNT = 64U;
+    QHexahedronT arCubes[PRIMITIVE_COUNT];
+    GetCubeGrid(arCubes, 4U);
+    QBoundingVolumeHierarchy<QHexahedronT> bvh(arCubes, PRIMITIVE_COUNT);
+    const QHexahedronT BOX = QHexahedron<QVector3>(QVector3(SQFloat::_1, SQFloat::_1, SQFloat::_0_5), SQFloat::_1, SQFloat::_1, SQFloat::_0_5);
+    const unsigned int EXPECTED_FOUND_COUNT = 4U;
+    const unsigned int EXPECTED_PRIMITIVES[] = { 0, 1U, 4U, 5U };
+
+	// [Execution]
+    QArrayDynamic<unsigned int> arFound;
+    unsigned int uFoundCount = bvh.FindIntersections(BOX, arFound);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uFoundCount, EXPECTED_FOUND_COUNT);
+
+    for(unsigned int i = 0; i < EXPECTED_FOUND_COUNT; ++i)
+        BOOST_CHECK(Contains(arFound, EXPECTED_PRIMITIVES[i]));
+}
+
+/// <summary>
+/// Checks that the triangles that cross the box are found, even when no vertex is inside it, and the ones near it are not.
+/// </summary>
+QTEST_CASE ( FindIntersections4_ReturnsTheTrianglesThatIntersectTheHexahedron_Test )
+{
+    // [Preparation]
+    QTriangleT arTriangles[3];
+    arTriangles[0] = QTriangleT(QVector3(-SQFloat::_10, -SQFloat::_10, SQFloat::_0), QVector3(SQFloat::_10, -SQFloat::_10, SQFloat::_0), QVector3(SQFloat::_0, SQFloat::_10, SQFloat::_0));
+    arTriangles[1] = QTriangleT(QVector3(SQFloat::_2, SQFloat::_0, SQFloat::_0), QVector3(SQFloat::_0, SQFloat::_2, SQFloat::_0), QVector3(SQFloat::_2, SQFloat::_2, SQFloat::_0));
+    arTriangles[2] = QTriangleT(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0), QVector3(-SQFloat::_0_25, SQFloat::_0, SQFloat::_0), QVector3(SQFloat::_0, -SQFloat::_0_25, SQFloat::_0));
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, 3U);
+    const QHexahedronT BOX = QHexahedron<QVector3>(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0), SQFloat::_1, SQFloat::_1, SQFloat::_1);
+    const unsigned int EXPECTED_FOUND_COUNT = 2U;
+
+	// [Execution]
+    QArrayDynamic<unsigned int> arFound;
+    unsigned int uFoundCount = bvh.FindIntersections(BOX, arFound);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uFoundCount, EXPECTED_FOUND_COUNT);
+    BOOST_CHECK(Contains(arFound, 0));
+    BOOST_CHECK(Contains(arFound, 2U));
+}
+
+/// <summary>
+/// Checks that the queries use the new positions of the primitives after refitting the tree.
+/// </summary>
+QTEST_CASE ( Refit_QueriesUseTheNewPrimitives_Test )
+{
+    // [Preparation]
+    const unsigned int CELLS_PER_SIDE = 8U;
+    const unsigned int PRIMITIVE_COUNT = CELLS_PER_SIDE * CELLS_PER_SIDE;
+    QTriangleT arTriangles[PRIMITIVE_COUNT];
+    GetTriangleGrid(arTriangles, CELLS_PER_SIDE, 1U);
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, PRIMITIVE_COUNT);
+    const unsigned int EXPECTED_NODE_COUNT = bvh.GetNodeCount();
+
+    // Every triangle is moved up as many units as its position
+    for(unsigned int i = 0; i < PRIMITIVE_COUNT; ++i)
+    {
+        const QVector3 OFFSET(SQFloat::_0, SQFloat::_0, scast_q(i, float_q));
+        arTriangles[i] = QTriangleT(arTriangles[i].A + OFFSET, arTriangles[i].B + OFFSET, arTriangles[i].C + OFFSET);
+    }
+
+    const unsigned int MOVED_PRIMITIVE = 27U;
+    const QVector3 POINT_IN_MOVED_TRIANGLE = (arTriangles[MOVED_PRIMITIVE].A + arTriangles[MOVED_PRIMITIVE].B + arTriangles[MOVED_PRIMITIVE].C) / SQFloat::_3;
+    const QRay3D<QVector3> RAY(QVector3(POINT_IN_MOVED_TRIANGLE.x, POINT_IN_MOVED_TRIANGLE.y, -SQFloat::_1), QVector3::GetUnitVectorZ());
+    const float_q EXPECTED_DISTANCE = POINT_IN_MOVED_TRIANGLE.z + SQFloat::_1;
+    const QBaseOrb<QVector3> ORB_AT_OLD_POSITION(QVector3(POINT_IN_MOVED_TRIANGLE.x, POINT_IN_MOVED_TRIANGLE.y, SQFloat::_0), SQFloat::_0_25);
+    const unsigned int EXPECTED_FOUND_COUNT_AT_OLD_POSITION = 0;
+
+	// [Execution]
+    bvh.Refit(arTriangles);
+
+    // [Verification]
+    unsigned int uPrimitive = 0;
+    float_q fDistance = SQFloat::_0;
+    bool bResult = bvh.FindClosestIntersection(RAY, uPrimitive, fDistance);
+    QArrayDynamic<unsigned int> arFound;
+    unsigned int uFoundCount = bvh.FindIntersections(ORB_AT_OLD_POSITION, arFound);
+
+    BOOST_CHECK(bResult);
+    BOOST_CHECK_EQUAL(uPrimitive, MOVED_PRIMITIVE);
+    BOOST_CHECK(SQFloat::AreEqual(fDistance, EXPECTED_DISTANCE));
+    BOOST_CHECK_EQUAL(uFoundCount, EXPECTED_FOUND_COUNT_AT_OLD_POSITION);
+    BOOST_CHECK_EQUAL(bvh.GetNodeCount(), EXPECTED_NODE_COUNT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the array of primitives is null but the number of primitives is not zero.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenArrayIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QBoundingVolumeHierarchy<QTriangleT> bvh(null_q, 3U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the endpoints of the line segment coincide.
+/// </summary>
+QTEST_CASE ( FindClosestIntersection2_AssertionFailsWhenEndpointsCoincide_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QTriangleT arTriangles[1];
+    arTriangles[0] = QTriangleT(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0), QVector3(SQFloat::_1, SQFloat::_0, SQFloat::_0), QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0));
+    QBoundingVolumeHierarchy<QTriangleT> bvh(arTriangles, 1U);
+    const QBaseLineSegment<QVector3> SEGMENT(QVector3(SQFloat::_1, SQFloat::_1, SQFloat::_1), QVector3(SQFloat::_1, SQFloat::_1, SQFloat::_1));
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        unsigned int uPrimitive = 0;
+        float_q fDistance = SQFloat::_0;
+        bvh.FindClosestIntersection(SEGMENT, uPrimitive, fDistance);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+// End - Test Suite: QBoundingVolumeHierarchy
+QTEST_SUITE_END()
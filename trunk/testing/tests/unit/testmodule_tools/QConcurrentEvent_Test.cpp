@@ -0,0 +1,371 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include <boost/thread.hpp>
+#include <boost/atomic.hpp>
+
+#include "QConcurrentEvent.h"
+
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::QConcurrentEvent;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+
+class QConcurrentEvent_TestClass
+{
+public:
+
+    static void Reset()
+    {
+        sm_bFunction0Called = false;
+        sm_bFunction1ArgumentsAreCorrect = false;
+        sm_bFunction8ArgumentsAreCorrect = false;
+        sm_bSubscriberAreCalledInFIFOOrder = false;
+        sm_uCallCounter = 0;
+        sm_uConcurrentCallCounter.store(0);
+    }
+
+    static int Function0()
+    {
+        sm_bFunction0Called = true;
+        return 0;
+    }
+    
+    static int Function1(int p1)
+    {
+        sm_bFunction1ArgumentsAreCorrect = p1 == 1;
+        return 1;
+    }
+    
+    static int Function8(int p1, int p2, int p3, int p4, int p5, int p6, int p7, int p8)
+    {
+        sm_bFunction8ArgumentsAreCorrect = p1 == 1 && p2 == 2 && p3 == 3 && p4 == 4 && p5 == 5 && p6 == 6 && p7 == 7 && p8 == 8;
+        return 8;
+    }
+
+    static int FunctionD(int p1)
+    {
+        sm_bSubscriberAreCalledInFIFOOrder = sm_uCallCounter == 0;
+        ++sm_uCallCounter;
+        return 1;
+    }
+
+    static int FunctionE(int p1)
+    {
+        sm_bSubscriberAreCalledInFIFOOrder = sm_bSubscriberAreCalledInFIFOOrder && sm_uCallCounter == 1;
+        ++sm_uCallCounter;
+        return 1;
+    }
+    
+    static int FunctionF(int p1)
+    {
+        sm_bSubscriberAreCalledInFIFOOrder = sm_bSubscriberAreCalledInFIFOOrder && sm_uCallCounter == 2;
+        ++sm_uCallCounter;
+        return 1;
+    }
+
+    static int ConcurrentFunction(int p1)
+    {
+        sm_uConcurrentCallCounter.fetch_add(1U);
+        return 1;
+    }
+
+    static int OtherConcurrentFunction(int p1)
+    {
+        return 1;
+    }
+
+    static bool sm_bFunction0Called;
+    static bool sm_bFunction1ArgumentsAreCorrect;
+    static bool sm_bFunction8ArgumentsAreCorrect;
+    static bool sm_bSubscriberAreCalledInFIFOOrder;
+    static unsigned int sm_uCallCounter;
+    static boost::atomic<unsigned int> sm_uConcurrentCallCounter;
+};
+
+bool QConcurrentEvent_TestClass::sm_bFunction0Called = false;
+bool QConcurrentEvent_TestClass::sm_bFunction1ArgumentsAreCorrect = false;
+bool QConcurrentEvent_TestClass::sm_bFunction8ArgumentsAreCorrect = false;
+bool QConcurrentEvent_TestClass::sm_bSubscriberAreCalledInFIFOOrder = false;
+unsigned int QConcurrentEvent_TestClass::sm_uCallCounter = 0;
+boost::atomic<unsigned int> QConcurrentEvent_TestClass::sm_uConcurrentCallCounter(0);
+
+// Raises an event a given number of times
+class QConcurrentEvent_Raiser
+{
+public:
+
+    QConcurrentEvent_Raiser(const QConcurrentEvent<int(int)> &event, const unsigned int uRaises) : m_event(event),
+                                                                                                   m_uRaises(uRaises)
+    {
+    }
+
+    void operator()()
+    {
+        for(unsigned int i = 0; i < m_uRaises; ++i)
+            m_event.Raise(1);
+    }
+
+    const QConcurrentEvent<int(int)> &m_event;
+    unsigned int m_uRaises;
+};
+
+
+QTEST_SUITE_BEGIN( QConcurrentEvent_TestSuite )
+
+/// <summary>
+/// Checks that a single subscriber without parameters is called.
+/// </summary>
+QTEST_CASE ( Raise_SingleSubscriberWithoutParametersIsCalled_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int()> event;
+    event += QConcurrentEvent_TestClass::Function0;
+    QConcurrentEvent_TestClass::Reset();
+
+    // [Execution]
+    event.Raise();
+
+    // [Verification]
+    BOOST_CHECK(QConcurrentEvent_TestClass::sm_bFunction0Called);
+}
+
+/// <summary>
+/// Checks that the argument is correctly passed to a subscriber with 1 parameter.
+/// </summary>
+QTEST_CASE ( Raise_ArgumentIsCorrectlyPassedToSubscriberWith1Parameter_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int(int)> event;
+    event += QConcurrentEvent_TestClass::Function1;
+    QConcurrentEvent_TestClass::Reset();
+
+    // [Execution]
+    event.Raise(1);
+
+    // [Verification]
+    BOOST_CHECK(QConcurrentEvent_TestClass::sm_bFunction1ArgumentsAreCorrect);
+}
+
+/// <summary>
+/// Checks that the arguments are correctly passed to a subscriber with 8 parameters.
+/// </summary>
+QTEST_CASE ( Raise_ArgumentsAreCorrectlyPassedToSubscriberWith8Parameters_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int(int, int, int, int, int, int, int, int)> event;
+    event += QConcurrentEvent_TestClass::Function8;
+    QConcurrentEvent_TestClass::Reset();
+
+    // [Execution]
+    event.Raise(1, 2, 3, 4, 5, 6, 7, 8);
+
+    // [Verification]
+    BOOST_CHECK(QConcurrentEvent_TestClass::sm_bFunction8ArgumentsAreCorrect);
+}
+
+/// <summary>
+/// Checks that subscribers are called in the same order they were subscribed.
+/// </summary>
+QTEST_CASE ( Raise_SubscribersAreCalledInFIFOOrder_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int(int)> event;
+    event += QConcurrentEvent_TestClass::FunctionD;
+    event += QConcurrentEvent_TestClass::FunctionE;
+    event += QConcurrentEvent_TestClass::FunctionF;
+    QConcurrentEvent_TestClass::Reset();
+
+    // [Execution]
+    event.Raise(1);
+
+    // [Verification]
+    BOOST_CHECK(QConcurrentEvent_TestClass::sm_bSubscriberAreCalledInFIFOOrder);
+}
+
+/// <summary>
+/// Checks that every subscriber is called once per raise when several threads raise the event while another thread subscribes and unsubscribes functions.
+/// </summary>
+QTEST_CASE ( Raise_SubscribersAreCalledOncePerRaiseWhenSeveralThreadsRaiseTheEventWhileSubscriptionsChange_Test )
+{
+    // [Preparation]
+    const unsigned int THREAD_COUNT = 4U;
+    const unsigned int RAISES_PER_THREAD = 20000U;
+    const unsigned int SUBSCRIPTION_CHANGES = 2000U;
+    const unsigned int EXPECTED_CALLS = THREAD_COUNT * RAISES_PER_THREAD;
+    QConcurrentEvent<int(int)> event;
+    event += QConcurrentEvent_TestClass::ConcurrentFunction;
+    QConcurrentEvent_TestClass::Reset();
+
+    // [Execution]
+    boost::thread_group threads;
+
+    for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+        threads.create_thread(QConcurrentEvent_Raiser(event, RAISES_PER_THREAD));
+
+    for(unsigned int i = 0; i < SUBSCRIPTION_CHANGES; ++i)
+    {
+        event += QConcurrentEvent_TestClass::OtherConcurrentFunction;
+        event -= QConcurrentEvent_TestClass::OtherConcurrentFunction;
+    }
+
+    threads.join_all();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(QConcurrentEvent_TestClass::sm_uConcurrentCallCounter.load(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(event.GetSubscribers().GetCount(), 1U);
+}
+
+/// <summary>
+/// Checks that the function is added to the list of subscribers.
+/// </summary>
+QTEST_CASE ( OperatorAdditionAssignation_FunctionIsSubscribed_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int(int)> event;
+    QConcurrentEvent<int(int)>::Subscriber EXPECTED_SUBSCRIBER(QConcurrentEvent_TestClass::Function1);
+
+    // [Execution]
+    event += QConcurrentEvent_TestClass::Function1;
+
+    // [Verification]
+    QConcurrentEvent<int(int)>::SubscriberArray arSubscribers = event.GetSubscribers();
+    BOOST_CHECK_EQUAL(arSubscribers.GetCount(), 1U);
+    BOOST_CHECK(arSubscribers[0] == EXPECTED_SUBSCRIBER);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the function is null.
+/// </summary>
+QTEST_CASE ( OperatorAdditionAssignation_AssertionFailsWhenFunctionIsNull_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int(int)> event;
+    QConcurrentEvent<int(int)>::Subscriber NULL_SUBSCRIBER;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        event += NULL_SUBSCRIBER;
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the function is removed from the list of subscribers and the others are kept in the same order.
+/// </summary>
+QTEST_CASE ( OperatorSubtractionAssignation_FunctionIsUnsubscribed_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int(int)> event;
+    event += QConcurrentEvent_TestClass::FunctionD;
+    event += QConcurrentEvent_TestClass::Function1;
+    event += QConcurrentEvent_TestClass::FunctionE;
+    QConcurrentEvent<int(int)>::Subscriber EXPECTED_FIRST_SUBSCRIBER(QConcurrentEvent_TestClass::FunctionD);
+    QConcurrentEvent<int(int)>::Subscriber EXPECTED_SECOND_SUBSCRIBER(QConcurrentEvent_TestClass::FunctionE);
+
+    // [Execution]
+    event -= QConcurrentEvent_TestClass::Function1;
+
+    // [Verification]
+    QConcurrentEvent<int(int)>::SubscriberArray arSubscribers = event.GetSubscribers();
+    BOOST_CHECK_EQUAL(arSubscribers.GetCount(), 2U);
+    BOOST_CHECK(arSubscribers[0] == EXPECTED_FIRST_SUBSCRIBER);
+    BOOST_CHECK(arSubscribers[1] == EXPECTED_SECOND_SUBSCRIBER);
+}
+
+/// <summary>
+/// Checks that unsubscribed functions are not called.
+/// </summary>
+QTEST_CASE ( OperatorSubtractionAssignation_UnsubscribedFunctionIsNotCalled_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int()> event;
+    event += QConcurrentEvent_TestClass::Function0;
+    QConcurrentEvent_TestClass::Reset();
+
+    // [Execution]
+    event -= QConcurrentEvent_TestClass::Function0;
+    event.Raise();
+
+    // [Verification]
+    BOOST_CHECK(!QConcurrentEvent_TestClass::sm_bFunction0Called);
+}
+
+/// <summary>
+/// Checks that all the functions are unsubscribed.
+/// </summary>
+QTEST_CASE ( UnsubscribeAll_AllFunctionsAreUnsubscribed_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int(int)> event;
+    event += QConcurrentEvent_TestClass::FunctionD;
+    event += QConcurrentEvent_TestClass::FunctionE;
+
+    // [Execution]
+    event.UnsubscribeAll();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(event.GetSubscribers().GetCount(), 0U);
+}
+
+/// <summary>
+/// Checks that the list of subscribers is empty when nothing was subscribed.
+/// </summary>
+QTEST_CASE ( GetSubscribers_ReturnsEmptyListWhenNothingWasSubscribed_Test )
+{
+    // [Preparation]
+    QConcurrentEvent<int(int)> event;
+
+    // [Execution]
+    QConcurrentEvent<int(int)>::SubscriberArray arSubscribers = event.GetSubscribers();
+
+    // [Verification]
+    BOOST_CHECK(arSubscribers.IsEmpty());
+}
+
+// End - Test Suite: QConcurrentEvent
+QTEST_SUITE_END()
@@ -4368,6 +4368,85 @@ QTEST_CASE ( Constructor8_AssertionFailsWhenInputStringContainsWhitesSpaces_Test
 
 #endif
 
+/// <summary>
+/// Checks that the expected instance is created when the input timestamp combines a date, a time, a fraction and a time offset.
+/// </summary>
+QTEST_CASE ( Constructor9_CreatesExpectedInstanceWhenTimestampCombinesDateAndTimeWithFractionAndTimeOffset_Test )
+{
+    // [Preparation]
+    const i8_q* TIMESTAMP = "+1234-12-23T12:34:56.1234567+01:30";
+    const unsigned int TIMESTAMP_LENGTH = 34U;
+    const QDateTime EXPECTED_DATETIME(1234, 12, 23, 11, 4, 56, 123, 456, 7, null_q);
+
+	// [Execution]
+    QDateTime dateTime(TIMESTAMP, TIMESTAMP_LENGTH);
+
+    // [Verification]
+    BOOST_CHECK(dateTime == EXPECTED_DATETIME);
+}
+
+/// <summary>
+/// Checks that only the given number of characters is read.
+/// </summary>
+QTEST_CASE ( Constructor9_OnlyTheGivenNumberOfCharactersIsRead_Test )
+{
+    // [Preparation]
+    const i8_q* TIMESTAMP = "2010-01-02T03:04:05Z2011-02-03T04:05:06Z";
+    const unsigned int TIMESTAMP_LENGTH = 20U;
+    const QDateTime EXPECTED_DATETIME(2010, 1, 2, 3, 4, 5, 0, 0, 0, null_q);
+
+	// [Execution]
+    QDateTime dateTime(TIMESTAMP, TIMESTAMP_LENGTH);
+
+    // [Verification]
+    BOOST_CHECK(dateTime == EXPECTED_DATETIME);
+}
+
+/// <summary>
+/// Checks that the same instance is created as when using a string.
+/// </summary>
+QTEST_CASE ( Constructor10_CreatesSameInstanceAsWhenUsingString_Test )
+{
+    // [Preparation]
+    const string_q TIMESTAMP("-0001-03-04T05:06:07,89-02");
+    const QDateTime EXPECTED_DATETIME(TIMESTAMP);
+
+	// [Execution]
+    QDateTime dateTime(TIMESTAMP.GetInternalBuffer(), TIMESTAMP.GetLength());
+
+    // [Verification]
+    BOOST_CHECK(dateTime == EXPECTED_DATETIME);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( Constructor9_AssertionFailsWhenInputArrayIsNull_Test )
+{
+    // [Preparation]
+    const i8_q* NULL_TIMESTAMP = null_q;
+    const bool ASSERTION_FAILED = true;
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QDateTime dateTime(NULL_TIMESTAMP, 10U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
 /// <summary>
 /// Checks that the input date and time are correctly copied.
 /// </summary>
@@ -6527,6 +6606,88 @@ QTEST_CASE ( ToString_NegativeOffsetAreCorrectlyAppended_Test )
     BOOST_CHECK(strTimestamp == EXPECTED_RESULT);
 }
 
+/// <summary>
+/// Checks that the timestamp written to the buffer is the same as the one returned by ToString.
+/// </summary>
+QTEST_CASE ( ToString2_WritesSameTimestampAsWhenReturningString_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Time::SQTimeZoneFactory;
+
+    // [Preparation]
+    const QTimeZone* NEGATIVE_TIMEZONE = SQTimeZoneFactory::GetTimeZoneById(QE_L("Pacific/Marquesas")); // MART-9:30
+    const QDateTime DATETIME(12345, 6, 7, 8, 9, 10, 11, 12, 3, NEGATIVE_TIMEZONE);
+    const string_q EXPECTED_RESULT = DATETIME.ToString();
+
+	// [Execution]
+    i8_q arTimestamp[QDateTime::TIMESTAMP_MAXIMUM_LENGTH];
+    unsigned int uLength = DATETIME.ToString(arTimestamp);
+
+    // [Verification]
+    BOOST_CHECK(string_q(arTimestamp, scast_q(uLength, int)) == EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that the timestamp written to the buffer is the same as the one returned by ToString.
+/// </summary>
+QTEST_CASE ( ToString3_WritesSameTimestampAsWhenReturningString_Test )
+{
+    // [Preparation]
+    const QDateTime DATETIME(5, 6, 7, 8, 9, 10, 500, 0, 0, null_q);
+    const string_q EXPECTED_RESULT = "+0005-06-07T08:09:10.5Z";
+
+	// [Execution]
+    u16_q arTimestamp[QDateTime::TIMESTAMP_MAXIMUM_LENGTH];
+    unsigned int uLength = DATETIME.ToString(arTimestamp);
+
+    // [Verification]
+    BOOST_CHECK(string_q(QDateTime(arTimestamp, uLength).ToString()) == EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(uLength, EXPECTED_RESULT.GetLength());
+}
+
+/// <summary>
+/// Checks that every timestamp is parsed.
+/// </summary>
+QTEST_CASE ( ParseTimestamps_EveryTimestampIsParsed_Test )
+{
+    // [Preparation]
+    const i8_q* TIMESTAMPS[] = { "2001-02-03T04:05:06Z", "-0100-12-31", "10:20:30.5+02:00" };
+    const unsigned int LENGTHS[] = { 20U, 11U, 16U };
+    const unsigned int COUNT = 3U;
+    const QDateTime EXPECTED_DATETIMES[] = { QDateTime(2001, 2, 3, 4, 5, 6, 0, 0, 0, null_q),
+                                             QDateTime(-101, 12, 31, null_q),
+                                             QDateTime(8, 20, 30, 500, 0, 0, null_q) };
+
+	// [Execution]
+    QDateTime arDateTimes[3];
+    QDateTime::ParseTimestamps(TIMESTAMPS, LENGTHS, COUNT, arDateTimes);
+
+    // [Verification]
+    BOOST_CHECK(arDateTimes[0] == EXPECTED_DATETIMES[0]);
+    BOOST_CHECK(arDateTimes[1] == EXPECTED_DATETIMES[1]);
+    BOOST_CHECK(arDateTimes[2] == EXPECTED_DATETIMES[2]);
+}
+
+/// <summary>
+/// Checks that every timestamp is written in its own slot.
+/// </summary>
+QTEST_CASE ( FormatTimestamps_EveryTimestampIsWrittenInItsOwnSlot_Test )
+{
+    // [Preparation]
+    const QDateTime DATETIMES[] = { QDateTime(2001, 2, 3, 4, 5, 6, 0, 0, 0, null_q),
+                                    QDateTime(-101, 12, 31, null_q) };
+    const unsigned int COUNT = 2U;
+    const string_q EXPECTED_TIMESTAMPS[] = { "+2001-02-03T04:05:06Z", "-0100-12-31T00:00:00Z" };
+
+	// [Execution]
+    i8_q arTimestamps[QDateTime::TIMESTAMP_MAXIMUM_LENGTH * 2U];
+    unsigned int arLengths[2];
+    QDateTime::FormatTimestamps(DATETIMES, COUNT, arTimestamps, arLengths);
+
+    // [Verification]
+    BOOST_CHECK(string_q(arTimestamps, scast_q(arLengths[0], int)) == EXPECTED_TIMESTAMPS[0]);
+    BOOST_CHECK(string_q(&arTimestamps[QDateTime::TIMESTAMP_MAXIMUM_LENGTH], scast_q(arLengths[1], int)) == EXPECTED_TIMESTAMPS[1]);
+}
+
 /// <summary>
 /// Checks that it returns the expected value when input date and time is 0004-05-01 00:00:00.000.000.0.
 /// </summary>
@@ -34,11 +34,13 @@ using namespace boost::unit_test;
 
 #include "DataTypesDefinitions.h"
 #include "CallCounter.h"
+#include "BinaryStreamMock.h"
 #include "QAssertException.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::QDictionary;
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamMock;
 
 
 QTEST_SUITE_BEGIN( QDictionary_TestSuite )
@@ -1830,5 +1832,30 @@ QTEST_CASE ( GetCapacity_IsCorrectlyCalculated_Test )
     BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
 }
 
+/// <summary>
+/// Checks that the key-value pairs read replace the existing ones and are the same that were written.
+/// </summary>
+QTEST_CASE ( Deserialize_KeyValuePairsAreReadAsTheyWereWritten_Test )
+{
+    // [Preparation]
+    QDictionary<string_q, int> dictionaryInput;
+    QDictionary<string_q, int> dictionaryResult;
+    BinaryStreamMock stream;
+
+    for(int i = 0; i < 20; ++i)
+        dictionaryInput.Add(string_q::FromInteger(i), i);
+
+    dictionaryResult.Add("Key", 9);
+    dictionaryInput.Serialize(stream);
+
+    // [Execution]
+    dictionaryResult.Deserialize(stream);
+
+    // [Verification]
+    BOOST_CHECK(dictionaryResult == dictionaryInput);
+    BOOST_CHECK_EQUAL(dictionaryResult.GetCount(), dictionaryInput.GetCount());
+    BOOST_CHECK(!dictionaryResult.ContainsKey("Key"));
+}
+
 // End - Test Suite: QDictionary
 QTEST_SUITE_END()
@@ -0,0 +1,732 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QFlatHashtable.h"
+
+#include "QAssertException.h"
+#include "CallCounter.h"
+#include "SQStringHashProvider.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QFlatHashtable;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Tools::Containers::SQStringHashProvider;
+
+
+QTEST_SUITE_BEGIN( QFlatHashtable_TestSuite )
+
+/// <summary>
+/// Checks that the default capacity is one group of 16 slots.
+/// </summary>
+QTEST_CASE ( Constructor1_CapacityIsOneGroup_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 16U;
+
+    // [Execution]
+    QFlatHashtable<int, int> hashtable;
+
+    // [Verification]
+    pointer_uint_q uCapacity = hashtable.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK(hashtable.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the capacity is enough to store the requested number of elements without exceeding the maximum load factor (0.875).
+/// </summary>
+QTEST_CASE ( Constructor2_CapacityIsRoundedUpToPowerOfTwoGroups_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INITIAL_CAPACITY = 100U;
+    const pointer_uint_q EXPECTED_CAPACITY = 128U;
+
+    // [Execution]
+    QFlatHashtable<int, int> hashtable(INITIAL_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uCapacity = hashtable.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that every key-value pair is copied.
+/// </summary>
+QTEST_CASE ( Constructor3_EveryKeyValuePairIsCopied_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 50;
+    QFlatHashtable<int, int> HASHTABLE;
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        HASHTABLE.Add(i, i * 3);
+
+    // [Execution]
+    QFlatHashtable<int, int> hashtableCopy(HASHTABLE);
+
+    // [Verification]
+    bool bResultIsWhatEspected = hashtableCopy.GetCount() == HASHTABLE.GetCount();
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && hashtableCopy[i] == i * 3;
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+/// <summary>
+/// Checks that the copy constructor of every key and value is called.
+/// </summary>
+QTEST_CASE ( Constructor3_CopyConstructorOfEveryKeyAndValueIsCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+    
+    // [Preparation]
+    QFlatHashtable<CallCounter, CallCounter> HASHTABLE;
+    HASHTABLE.Add(CallCounter(), CallCounter());
+    HASHTABLE.Add(CallCounter(), CallCounter());
+    HASHTABLE.Add(CallCounter(), CallCounter());
+    const unsigned int EXPECTED_CALLS = HASHTABLE.GetCount() * 2U; // Stored hashes are copied, GenerateHash is not called
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    QFlatHashtable<CallCounter, CallCounter> hashtableCopy = HASHTABLE;
+
+    // [Verification]
+    unsigned int uCopyConstructorCalls = CallCounter::GetCopyConstructorCallsCount();
+    BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that the destructor of every key and value is called.
+/// </summary>
+QTEST_CASE ( Destructor_TheDestructorOfEveryKeyAndValueIsCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+    
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 6;
+
+    {
+        QFlatHashtable<CallCounter, CallCounter> HASHTABLE;
+        HASHTABLE.Add(CallCounter(), CallCounter());
+        HASHTABLE.Add(CallCounter(), CallCounter());
+        HASHTABLE.Add(CallCounter(), CallCounter());
+        CallCounter::ResetCounters();
+
+    // [Execution]
+    // Destructor is called when the execution flow leaves this block
+    }
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that the capacity is correctly increased and elements are kept.
+/// </summary>
+QTEST_CASE ( Reserve_CapacityIsCorrectlyIncreasedAndElementsAreKept_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 1024U;
+    const string_q EXPECTED_KEYS[] = {"key1", "key2", "key3"};
+    QFlatHashtable<string_q, int, SQStringHashProvider> hashtable;
+    hashtable.Add(EXPECTED_KEYS[0], 1);
+    hashtable.Add(EXPECTED_KEYS[1], 2);
+    hashtable.Add(EXPECTED_KEYS[2], 3);
+
+    // [Execution]
+    hashtable.Reserve(800U);
+
+    // [Verification]
+    pointer_uint_q uCapacity = hashtable.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(hashtable[EXPECTED_KEYS[0]], 1);
+    BOOST_CHECK_EQUAL(hashtable[EXPECTED_KEYS[1]], 2);
+    BOOST_CHECK_EQUAL(hashtable[EXPECTED_KEYS[2]], 3);
+}
+
+/// <summary>
+/// Checks that nothing happens when the amount to reserve is not greater than the current capacity.
+/// </summary>
+QTEST_CASE ( Reserve_NothingHappensWhenTheAmountToReserveIsNoGreaterThanCurrentCapacity_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 64U;
+    QFlatHashtable<int, int> hashtable(50U);
+
+    // [Execution]
+    hashtable.Reserve(10U);
+
+    // [Verification]
+    pointer_uint_q uCapacity = hashtable.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that an element is correctly added when the hashtable is empty.
+/// </summary>
+QTEST_CASE ( Add_ElementIsCorrectlyAddedWhenHashtableIsEmpty_Test )
+{
+    // [Preparation]
+    const string_q EXPECTED_KEY("key1");
+    const int EXPECTED_VALUE = 1;
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    QFlatHashtable<string_q, int, SQStringHashProvider> hashtable;
+
+    // [Execution]
+    QFlatHashtable<string_q, int, SQStringHashProvider>::ConstIterator it = hashtable.Add(EXPECTED_KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    BOOST_CHECK(it->GetKey() == EXPECTED_KEY);
+    BOOST_CHECK_EQUAL(it->GetValue(), EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the hashtable grows and keeps all the elements when many are added.
+/// </summary>
+QTEST_CASE ( Add_AllElementsAreFoundWhenHashtableGrows_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 5000;
+    const float MAX_LOAD_FACTOR = 0.875f;
+    QFlatHashtable<int, int> hashtable;
+    bool bAllElementsAreFound = true;
+
+    // [Execution]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i * 7, i);
+
+    // [Verification]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bAllElementsAreFound = bAllElementsAreFound && hashtable.ContainsKey(i * 7) && hashtable[i * 7] == i;
+
+    BOOST_CHECK(bAllElementsAreFound);
+    BOOST_CHECK(!hashtable.ContainsKey(1));
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), scast_q(NUMBER_OF_ELEMENTS, pointer_uint_q));
+    BOOST_CHECK(hashtable.GetLoadFactor() <= MAX_LOAD_FACTOR);
+}
+
+/// <summary>
+/// Checks that elements whose keys have the same hash are correctly added and found.
+/// </summary>
+QTEST_CASE ( Add_ElementsAreCorrectlyAddedWhenHashesCollide_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 40;
+    QFlatHashtable<int, int> hashtable;
+    bool bAllElementsAreFound = true;
+
+    // [Execution]
+    // Multiples of the number of slots fall in the same group
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i * 1024, i);
+
+    // [Verification]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bAllElementsAreFound = bAllElementsAreFound && hashtable[i * 1024] == i;
+
+    BOOST_CHECK(bAllElementsAreFound);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the key already exists.
+/// </summary>
+QTEST_CASE ( Add_AssertionFailsWhenTheKeyAlreadyExists_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 1;
+    const int INPUT_VALUE = 1;
+    
+    QFlatHashtable<int, int> HASHTABLE;
+    HASHTABLE.Add(INPUT_KEY, INPUT_VALUE);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        HASHTABLE.Add(INPUT_KEY, 0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the key does not exist.
+/// </summary>
+QTEST_CASE ( GetValue_AssertionFailsWhenTheKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> HASHTABLE;
+    HASHTABLE.Add(1, 1);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        HASHTABLE.GetValue(2);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the key to remove does not exist.
+/// </summary>
+QTEST_CASE ( Remove_AssertionFailsWhenTheInputKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> HASHTABLE;
+    HASHTABLE.Add(1, 1);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        HASHTABLE.Remove(2);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the value is correctly set.
+/// </summary>
+QTEST_CASE ( SetValue_ElementIsCorrectlySet_Test )
+{
+    // [Preparation]
+    const string_q INPUT_KEY("key2");
+    const int EXPECTED_VALUE = 5;
+    QFlatHashtable<string_q, int, SQStringHashProvider> hashtable;
+    hashtable.Add("key1", 1);
+    hashtable.Add(INPUT_KEY, 2);
+
+    // [Execution]
+    hashtable.SetValue(INPUT_KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(hashtable.GetValue(INPUT_KEY), EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that it returns False when the hashtable is empty.
+/// </summary>
+QTEST_CASE ( ContainsKey_ReturnsFalseWhenHashtableIsEmpty_Test )
+{
+    // [Preparation]
+    QFlatHashtable<string_q, int, SQStringHashProvider> HASHTABLE;
+
+    // [Execution]
+    bool bResult = HASHTABLE.ContainsKey("key1");
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+}
+
+/// <summary>
+/// Checks that the hashtable is empty when removing the only element in it.
+/// </summary>
+QTEST_CASE ( Remove_HashtableIsEmptyWhenRemovingTheOnlyElementInTheHashtable_Test )
+{
+    // [Preparation]
+    const string_q EXISTING_KEY("key1");
+    QFlatHashtable<string_q, int, SQStringHashProvider> hashtable;
+    hashtable.Add(EXISTING_KEY, 0);
+
+    // [Execution]
+    hashtable.Remove(EXISTING_KEY);
+
+    // [Verification]
+    BOOST_CHECK(hashtable.IsEmpty());
+    BOOST_CHECK(!hashtable.ContainsKey(EXISTING_KEY));
+    BOOST_CHECK(hashtable.GetFirst().IsEnd());
+}
+
+/// <summary>
+/// Checks that the destructor of the removed key and value is called.
+/// </summary>
+QTEST_CASE ( Remove_DestructorOfKeyAndValueIsCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 2U;
+    QFlatHashtable<int, CallCounter> hashtable;
+    hashtable.Add(1, CallCounter());
+    hashtable.Add(2, CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    hashtable.Remove(1);
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_CALLS - 1U); // Only the value is a CallCounter
+}
+
+/// <summary>
+/// Checks that elements added after a removal are found, even when the slots of removed elements are reused.
+/// </summary>
+QTEST_CASE ( Remove_ElementsAreFoundWhenAddingAndRemovingRepeatedly_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ROUNDS = 50;
+    const int ELEMENTS_PER_ROUND = 100;
+    QFlatHashtable<int, int> hashtable;
+    bool bResultIsWhatEspected = true;
+
+    // [Execution]
+    // Every round adds new keys and removes most of the previous ones, so the slots of removed elements are reused or cleaned
+    for(int nRound = 0; nRound < NUMBER_OF_ROUNDS; ++nRound)
+    {
+        for(int i = 0; i < ELEMENTS_PER_ROUND; ++i)
+            hashtable.Add(nRound * ELEMENTS_PER_ROUND + i, i);
+
+        for(int i = 0; nRound > 0 && i < ELEMENTS_PER_ROUND - 1; ++i)
+            hashtable.Remove((nRound - 1) * ELEMENTS_PER_ROUND + i);
+    }
+
+    // [Verification]
+    for(int nRound = 0; nRound < NUMBER_OF_ROUNDS; ++nRound)
+    {
+        for(int i = 0; i < ELEMENTS_PER_ROUND; ++i)
+        {
+            const bool SHOULD_EXIST = nRound == NUMBER_OF_ROUNDS - 1 || i == ELEMENTS_PER_ROUND - 1;
+            bResultIsWhatEspected = bResultIsWhatEspected && hashtable.ContainsKey(nRound * ELEMENTS_PER_ROUND + i) == SHOULD_EXIST;
+        }
+    }
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), scast_q(ELEMENTS_PER_ROUND + NUMBER_OF_ROUNDS - 1, pointer_uint_q));
+    BOOST_CHECK(hashtable.GetCapacity() <= 512U);
+}
+
+/// <summary>
+/// Checks that the returned iterator points to the element with the key.
+/// </summary>
+QTEST_CASE ( PositionOfKey_ReturnsExpectedPositionWhenHashtableContainsTheKey_Test )
+{
+    // [Preparation]
+    const string_q INPUT_KEY("key2");
+    const int EXPECTED_VALUE = 2;
+    QFlatHashtable<string_q, int, SQStringHashProvider> HASHTABLE;
+    HASHTABLE.Add("key1", 1);
+    HASHTABLE.Add(INPUT_KEY, EXPECTED_VALUE);
+    HASHTABLE.Add("key3", 3);
+
+    // [Execution]
+    QFlatHashtable<string_q, int, SQStringHashProvider>::ConstIterator it = HASHTABLE.PositionOfKey(INPUT_KEY);
+
+    // [Verification]
+    BOOST_CHECK(it->GetKey() == INPUT_KEY);
+    BOOST_CHECK_EQUAL(it->GetValue(), EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the returned iterator points to the end position when the key does not exist.
+/// </summary>
+QTEST_CASE ( PositionOfKey_ReturnsEndPositionWhenHashtableDoesNotContainTheElement_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> HASHTABLE;
+    HASHTABLE.Add(1, 1);
+
+    // [Execution]
+    QFlatHashtable<int, int>::ConstIterator it = HASHTABLE.PositionOfKey(2);
+
+    // [Verification]
+    BOOST_CHECK(it.IsEnd());
+}
+
+/// <summary>
+/// Checks that iterating forward and backward visits every element once.
+/// </summary>
+QTEST_CASE ( GetFirst_IteratorVisitsEveryElementOnceInBothDirections_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 100;
+    const int EXPECTED_SUM = NUMBER_OF_ELEMENTS * (NUMBER_OF_ELEMENTS - 1) / 2;
+    QFlatHashtable<int, int> HASHTABLE;
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        HASHTABLE.Add(i, i);
+
+    // [Execution]
+    int nForwardSum = 0;
+    int nForwardCount = 0;
+
+    for(QFlatHashtable<int, int>::ConstIterator it = HASHTABLE.GetFirst(); !it.IsEnd(); ++it, ++nForwardCount)
+        nForwardSum += it->GetValue();
+
+    int nBackwardSum = 0;
+    int nBackwardCount = 0;
+
+    for(QFlatHashtable<int, int>::ConstIterator it = HASHTABLE.GetLast(); !it.IsEnd(); --it, ++nBackwardCount)
+        nBackwardSum += it->GetValue();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(nForwardSum, EXPECTED_SUM);
+    BOOST_CHECK_EQUAL(nForwardCount, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(nBackwardSum, EXPECTED_SUM);
+    BOOST_CHECK_EQUAL(nBackwardCount, NUMBER_OF_ELEMENTS);
+}
+
+/// <summary>
+/// Checks that the iterators point to the end position when the hashtable is empty.
+/// </summary>
+QTEST_CASE ( GetFirst_IteratorPointsToEndPositionWhenHashtableIsEmpty_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> HASHTABLE;
+
+    // [Execution]
+    QFlatHashtable<int, int>::ConstIterator itFirst = HASHTABLE.GetFirst();
+    QFlatHashtable<int, int>::ConstIterator itLast = HASHTABLE.GetLast();
+
+    // [Verification]
+    BOOST_CHECK(itFirst.IsEnd());
+    BOOST_CHECK(itLast.IsEnd());
+}
+
+/// <summary>
+/// Checks that hashtables with the same elements are equal, regardless of the order in which they were added.
+/// </summary>
+QTEST_CASE ( OperatorEquality_ReturnsTrueWhenHashtablesHaveSameElementsInDifferentOrder_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> HASHTABLE_A;
+    QFlatHashtable<int, int> HASHTABLE_B(1000U);
+
+    for(int i = 0; i < 100; ++i)
+    {
+        HASHTABLE_A.Add(i, i);
+        HASHTABLE_B.Add(99 - i, 99 - i);
+    }
+
+    // [Execution]
+    bool bResult = HASHTABLE_A == HASHTABLE_B;
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+}
+
+/// <summary>
+/// Checks that hashtables are different when a value is different.
+/// </summary>
+QTEST_CASE ( OperatorInequality_ReturnsTrueWhenValuesAreDifferent_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> HASHTABLE_A;
+    QFlatHashtable<int, int> HASHTABLE_B;
+    HASHTABLE_A.Add(1, 1);
+    HASHTABLE_A.Add(2, 2);
+    HASHTABLE_B.Add(1, 1);
+    HASHTABLE_B.Add(2, 3);
+
+    // [Execution]
+    bool bResult = HASHTABLE_A != HASHTABLE_B;
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+}
+
+/// <summary>
+/// Checks that the hashtable is correctly copied when the destination has more elements than the source.
+/// </summary>
+QTEST_CASE ( OperatorAssignment_HashtableIsCorrectlyCopiedWhenThereAreLessElementsInSourceThanInDestination_Test )
+{
+    // [Preparation]
+    QFlatHashtable<string_q, int, SQStringHashProvider> HASHTABLE;
+    HASHTABLE.Add("key1", 1);
+    HASHTABLE.Add("key2", 2);
+
+    QFlatHashtable<string_q, int, SQStringHashProvider> copiedHashtable;
+
+    for(int i = 0; i < 100; ++i)
+        copiedHashtable.Add(string_q::FromInteger(i), i);
+
+    // [Execution]
+    copiedHashtable = HASHTABLE;
+
+    // [Verification]
+    BOOST_CHECK(copiedHashtable == HASHTABLE);
+    BOOST_CHECK(!copiedHashtable.ContainsKey("0"));
+}
+
+/// <summary>
+/// Checks that the copy constructors are called for each key and value and destructors for the previous elements.
+/// </summary>
+QTEST_CASE ( OperatorAssignment_ConstructorsAndDestructorsAreCalledForAllKeysAndValues_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    QFlatHashtable<CallCounter, CallCounter> HASHTABLE;
+    HASHTABLE.Add(CallCounter(), CallCounter());
+    HASHTABLE.Add(CallCounter(), CallCounter());
+    HASHTABLE.Add(CallCounter(), CallCounter());
+
+    QFlatHashtable<CallCounter, CallCounter> copiedHashtable;
+    copiedHashtable.Add(CallCounter(), CallCounter());
+
+    const unsigned int EXPECTED_COPY_CONSTRUCTORS_VALUE = HASHTABLE.GetCount() * 2U;
+    const unsigned int EXPECTED_DESTRUCTORS_VALUE = copiedHashtable.GetCount() * 2U;
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    copiedHashtable = HASHTABLE;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_COPY_CONSTRUCTORS_VALUE);
+    BOOST_CHECK_EQUAL(CallCounter::GetDestructorCallsCount(), EXPECTED_DESTRUCTORS_VALUE);
+}
+
+/// <summary>
+/// Checks that the cloned hashtable has the same elements when the source has more capacity than the destination.
+/// </summary>
+QTEST_CASE ( Clone_ClonedHashtableHasSameValuesThanTheOriginalHashtableWhenInputHashtableHasLessCapacity_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> HASHTABLE;
+
+    for(int i = 0; i < 200; ++i)
+        HASHTABLE.Add(i, i * 2);
+
+    QFlatHashtable<int, int> clonedHashtable;
+    clonedHashtable.Add(1000, 1000);
+
+    // [Execution]
+    HASHTABLE.Clone(clonedHashtable);
+
+    // [Verification]
+    BOOST_CHECK(clonedHashtable == HASHTABLE);
+    BOOST_CHECK_EQUAL(clonedHashtable.GetCapacity(), HASHTABLE.GetCapacity());
+}
+
+/// <summary>
+/// Checks that the load factor is the number of elements divided by the number of slots.
+/// </summary>
+QTEST_CASE ( GetLoadFactor_ReturnsNumberOfElementsDividedByCapacity_Test )
+{
+    // [Preparation]
+    const float EXPECTED_LOAD_FACTOR = 0.25f;
+    QFlatHashtable<int, int> hashtable;
+    hashtable.Add(0, 0);
+    hashtable.Add(1, 1);
+    hashtable.Add(2, 2);
+    hashtable.Add(3, 3);
+
+    // [Execution]
+    float fLoadFactor = hashtable.GetLoadFactor();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(fLoadFactor, EXPECTED_LOAD_FACTOR);
+}
+
+/// <summary>
+/// Checks that the result contains all the existing keys.
+/// </summary>
+QTEST_CASE ( GetKeys_ResultContainsAllExistingKeys_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 30U;
+    QFlatHashtable<int, int> HASHTABLE;
+
+    for(pointer_uint_q i = 0; i < EXPECTED_COUNT; ++i)
+        HASHTABLE.Add(scast_q(i, int), 0);
+
+    // [Execution]
+    QArrayResult<int> arResult = HASHTABLE.GetKeys();
+
+    // [Verification]
+    bool bAllKeysAreReturned = arResult.GetCount() == EXPECTED_COUNT;
+    int nSum = 0;
+
+    for(pointer_uint_q i = 0; i < arResult.GetCount(); ++i)
+    {
+        bAllKeysAreReturned = bAllKeysAreReturned && HASHTABLE.ContainsKey(arResult[i]);
+        nSum += arResult[i];
+    }
+
+    BOOST_CHECK(bAllKeysAreReturned);
+    BOOST_CHECK_EQUAL(nSum, 435);
+}
+
+/// <summary>
+/// Checks if the result is null when the hashtable is empty.
+/// </summary>
+QTEST_CASE ( GetKeys_ReturnsNullWhenHashtableIsEmpty_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+
+    // [Preparation]
+    int* EXPECTED_RESULT = null_q;
+    pointer_uint_q EXPECTED_COUNT = 0;
+    QFlatHashtable<int, int> HASHTABLE;
+
+    // [Execution]
+    QArrayResult<int> arResult = HASHTABLE.GetKeys();
+
+    // [Verification]
+    int* pResult = arResult.Get();
+    pointer_uint_q uCount = arResult.GetCount();
+    BOOST_CHECK_EQUAL(pResult, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+// End - Test Suite: QFlatHashtable
+QTEST_SUITE_END()
@@ -0,0 +1,399 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QFrustum.h"
+#include "QSpaceConversionMatrix.h"
+#include "QSoAPointBuffer.h"
+#include "QHexahedron.h"
+#include "SQAngle.h"
+#include "SQFloat.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Tools::Math::QFrustum;
+using Kinesis::QuimeraEngine::Tools::Math::QPlane;
+using Kinesis::QuimeraEngine::Tools::Math::QSpaceConversionMatrix;
+using Kinesis::QuimeraEngine::Tools::Math::QSoAPointBuffer;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseOrb;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseHexahedron;
+using Kinesis::QuimeraEngine::Tools::Math::QHexahedron;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+
+/// <summary>
+/// Gets the frustum of a camera placed at the origin that looks along the Z axis, whose field of view is 90 degrees both vertically
+/// and horizontally and whose near and far planes are at 1 and 100 units.
+/// </summary>
+QFrustum GetCameraFrustum()
+{
+    return QFrustum(QPlane(SQFloat::_1, SQFloat::_0, SQFloat::_1, SQFloat::_0),
+                    QPlane(-SQFloat::_1, SQFloat::_0, SQFloat::_1, SQFloat::_0),
+                    QPlane(SQFloat::_0, SQFloat::_1, SQFloat::_1, SQFloat::_0),
+                    QPlane(SQFloat::_0, -SQFloat::_1, SQFloat::_1, SQFloat::_0),
+                    QPlane(SQFloat::_0, SQFloat::_0, SQFloat::_1, -SQFloat::_1),
+                    QPlane(SQFloat::_0, SQFloat::_0, -SQFloat::_1, scast_q(100, float_q)));
+}
+
+/// <summary>
+/// Checks whether two planes are equal, taking into account the tolerance.
+/// </summary>
+bool AreEqual(const QPlane &plane1, const QPlane &plane2)
+{
+    return SQFloat::AreEqual(plane1.a, plane2.a) && SQFloat::AreEqual(plane1.b, plane2.b) && 
+           SQFloat::AreEqual(plane1.c, plane2.c) && SQFloat::AreEqual(plane1.d, plane2.d);
+}
+
+QTEST_SUITE_BEGIN( QFrustum_TestSuite )
+
+/// <summary>
+/// Checks that the planes are stored normalized and in the expected order.
+/// </summary>
+QTEST_CASE ( Constructor1_PlanesAreNormalized_Test )
+{
+    // [Preparation]
+    const float_q INVERSE_SQRT_2 = SQFloat::_1 / sqrt_q(SQFloat::_2);
+    const QPlane EXPECTED_LEFT(INVERSE_SQRT_2, SQFloat::_0, INVERSE_SQRT_2, SQFloat::_0);
+    const QPlane EXPECTED_TOP(SQFloat::_0, -INVERSE_SQRT_2, INVERSE_SQRT_2, SQFloat::_0);
+    const QPlane EXPECTED_NEAR(SQFloat::_0, SQFloat::_0, SQFloat::_1, -SQFloat::_1);
+    const QPlane EXPECTED_FAR(SQFloat::_0, SQFloat::_0, -SQFloat::_1, scast_q(100, float_q));
+
+	// [Execution]
+    QFrustum frustum = GetCameraFrustum();
+
+    // [Verification]
+    BOOST_CHECK(AreEqual(frustum.GetPlane(0), EXPECTED_LEFT));
+    BOOST_CHECK(AreEqual(frustum.GetPlane(3U), EXPECTED_TOP));
+    BOOST_CHECK(AreEqual(frustum.GetPlane(4U), EXPECTED_NEAR));
+    BOOST_CHECK(AreEqual(frustum.GetPlane(5U), EXPECTED_FAR));
+}
+
+/// <summary>
+/// Checks that the planes extracted from a view and a projection matrix are the ones that delimit the volume seen by the camera.
+/// </summary>
+QTEST_CASE ( Constructor2_PlanesAreExtractedFromViewProjectionMatrix_Test )
+{
+    // [Preparation]
+    #if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+        const float_q VERTICAL_FOV = SQAngle::_90;
+    #else
+        const float_q VERTICAL_FOV = SQAngle::_HalfPi;
+    #endif
+
+    QSpaceConversionMatrix view;
+    view.SetViewSpaceMatrix(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0), QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1), QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0));
+    QSpaceConversionMatrix projection;
+    projection.SetProjectionSpaceMatrix(SQFloat::_1, scast_q(100, float_q), SQFloat::_1, VERTICAL_FOV);
+    const QFrustum EXPECTED_FRUSTUM = GetCameraFrustum();
+
+	// [Execution]
+    QFrustum frustum(view * projection);
+
+    // [Verification]
+    for(unsigned int i = 0; i < QFrustum::PLANE_COUNT - 1U; ++i)
+        BOOST_CHECK(AreEqual(frustum.GetPlane(i), EXPECTED_FRUSTUM.GetPlane(i)));
+
+    // The distance to the far plane is obtained from terms of the projection matrix that lose precision when using single precision
+    const QPlane FAR_PLANE = frustum.GetPlane(QFrustum::PLANE_COUNT - 1U);
+    const QPlane EXPECTED_FAR_PLANE = EXPECTED_FRUSTUM.GetPlane(QFrustum::PLANE_COUNT - 1U);
+    BOOST_CHECK(SQFloat::AreEqual(FAR_PLANE.a, EXPECTED_FAR_PLANE.a));
+    BOOST_CHECK(SQFloat::AreEqual(FAR_PLANE.b, EXPECTED_FAR_PLANE.b));
+    BOOST_CHECK(SQFloat::AreEqual(FAR_PLANE.c, EXPECTED_FAR_PLANE.c));
+    BOOST_CHECK(SQFloat::AreEqual(FAR_PLANE.d, EXPECTED_FAR_PLANE.d, SQFloat::_1 / scast_q(100, float_q)));
+}
+
+/// <summary>
+/// Checks that orbs inside the frustum, partially inside or touching a plane are visible and the ones outside are not.
+/// </summary>
+QTEST_CASE ( IsVisible1_OnlyOrbsOutsideTheFrustumAreNotVisible_Test )
+{
+    // [Preparation]
+    const QFrustum FRUSTUM = GetCameraFrustum();
+    const QBaseOrb<QVector3> ORB_INSIDE(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_10), SQFloat::_1);
+    const QBaseOrb<QVector3> ORB_CROSSING_SIDE(QVector3(SQFloat::_10 + SQFloat::_1, SQFloat::_0, SQFloat::_10), SQFloat::_1);
+    const QBaseOrb<QVector3> ORB_TOUCHING_NEAR(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0), SQFloat::_1);
+    const QBaseOrb<QVector3> ORB_BEHIND(QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_10), SQFloat::_1);
+    const QBaseOrb<QVector3> ORB_BEYOND_FAR(QVector3(SQFloat::_0, SQFloat::_0, scast_q(102, float_q)), SQFloat::_1);
+    const QBaseOrb<QVector3> ORB_ABOVE(QVector3(SQFloat::_0, SQFloat::_10 + SQFloat::_5, SQFloat::_10), SQFloat::_1);
+
+	// [Execution]
+    bool bInsideIsVisible = FRUSTUM.IsVisible(ORB_INSIDE);
+    bool bCrossingSideIsVisible = FRUSTUM.IsVisible(ORB_CROSSING_SIDE);
+    bool bTouchingNearIsVisible = FRUSTUM.IsVisible(ORB_TOUCHING_NEAR);
+    bool bBehindIsVisible = FRUSTUM.IsVisible(ORB_BEHIND);
+    bool bBeyondFarIsVisible = FRUSTUM.IsVisible(ORB_BEYOND_FAR);
+    bool bAboveIsVisible = FRUSTUM.IsVisible(ORB_ABOVE);
+
+    // [Verification]
+    BOOST_CHECK(bInsideIsVisible);
+    BOOST_CHECK(bCrossingSideIsVisible);
+    BOOST_CHECK(bTouchingNearIsVisible);
+    BOOST_CHECK(!bBehindIsVisible);
+    BOOST_CHECK(!bBeyondFarIsVisible);
+    BOOST_CHECK(!bAboveIsVisible);
+}
+
+/// <summary>
+/// Checks that hexahedra inside the frustum, partially inside or containing it are visible and the ones outside are not.
+/// </summary>
+QTEST_CASE ( IsVisible2_OnlyHexahedraOutsideTheFrustumAreNotVisible_Test )
+{
+    // [Preparation]
+    const QFrustum FRUSTUM = GetCameraFrustum();
+    const QBaseHexahedron<QVector3> HEXAHEDRON_INSIDE = QHexahedron<QVector3>(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_10), SQFloat::_1, SQFloat::_1, SQFloat::_1);
+    const QBaseHexahedron<QVector3> HEXAHEDRON_CROSSING_FAR = QHexahedron<QVector3>(QVector3(SQFloat::_0, SQFloat::_0, scast_q(100, float_q)), SQFloat::_2, SQFloat::_2, SQFloat::_2);
+    const QBaseHexahedron<QVector3> HEXAHEDRON_CONTAINING = QHexahedron<QVector3>(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0), scast_q(1000, float_q), scast_q(1000, float_q), scast_q(1000, float_q));
+    const QBaseHexahedron<QVector3> HEXAHEDRON_LEFT = QHexahedron<QVector3>(QVector3(-SQFloat::_10 - SQFloat::_5, SQFloat::_0, SQFloat::_10), SQFloat::_2, SQFloat::_2, SQFloat::_2);
+    const QBaseHexahedron<QVector3> HEXAHEDRON_BEHIND = QHexahedron<QVector3>(QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_5), SQFloat::_2, SQFloat::_2, SQFloat::_2);
+
+	// [Execution]
+    bool bInsideIsVisible = FRUSTUM.IsVisible(HEXAHEDRON_INSIDE);
+    bool bCrossingFarIsVisible = FRUSTUM.IsVisible(HEXAHEDRON_CROSSING_FAR);
+    bool bContainingIsVisible = FRUSTUM.IsVisible(HEXAHEDRON_CONTAINING);
+    bool bLeftIsVisible = FRUSTUM.IsVisible(HEXAHEDRON_LEFT);
+    bool bBehindIsVisible = FRUSTUM.IsVisible(HEXAHEDRON_BEHIND);
+
+    // [Verification]
+    BOOST_CHECK(bInsideIsVisible);
+    BOOST_CHECK(bCrossingFarIsVisible);
+    BOOST_CHECK(bContainingIsVisible);
+    BOOST_CHECK(!bLeftIsVisible);
+    BOOST_CHECK(!bBehindIsVisible);
+}
+
+/// <summary>
+/// Checks that the orbs found are the same as the ones obtained checking them one by one, in ascending order, including the
+/// orbs of the last incomplete block.
+/// </summary>
+QTEST_CASE ( FindVisible1_ResultIsTheSameAsCheckingEveryOrb_Test )
+{
+    // [Preparation]
+    const QFrustum FRUSTUM = GetCameraFrustum();
+    const unsigned int ORB_COUNT = 103U;
+    QSoAPointBuffer centers(ORB_COUNT);
+    float_q arRadii[ORB_COUNT];
+    unsigned int arExpectedIndices[ORB_COUNT];
+    unsigned int uExpectedCount = 0;
+
+    for(unsigned int i = 0; i < ORB_COUNT; ++i)
+    {
+        const QVector3 CENTER(scast_q(i % 10U, float_q) * SQFloat::_3 - SQFloat::_10 - SQFloat::_3, 
+                              SQFloat::_0_5 * scast_q(i % 7U, float_q), 
+                              scast_q(i, float_q) - SQFloat::_5);
+        centers.SetPoint(i, CENTER);
+        arRadii[i] = SQFloat::_0_25 * scast_q(i % 5U, float_q);
+
+        if(FRUSTUM.IsVisible(QBaseOrb<QVector3>(CENTER, arRadii[i])))
+            arExpectedIndices[uExpectedCount++] = i;
+    }
+
+	// [Execution]
+    unsigned int arVisibleIndices[ORB_COUNT];
+    unsigned int uVisibleCount = FRUSTUM.FindVisible(centers, arRadii, arVisibleIndices);
+
+    // [Verification]
+    BOOST_CHECK(uExpectedCount > 0 && uExpectedCount < ORB_COUNT);
+    BOOST_CHECK_EQUAL(uVisibleCount, uExpectedCount);
+
+    for(unsigned int i = 0; i < uExpectedCount; ++i)
+        BOOST_CHECK_EQUAL(arVisibleIndices[i], arExpectedIndices[i]);
+}
+
+/// <summary>
+/// Checks that nothing is found when the buffer is empty.
+/// </summary>
+QTEST_CASE ( FindVisible1_NothingIsFoundWhenThereAreNoOrbs_Test )
+{
+    // [Preparation]
+    const QFrustum FRUSTUM = GetCameraFrustum();
+    const QSoAPointBuffer CENTERS(0);
+    const unsigned int EXPECTED_COUNT = 0;
+
+	// [Execution]
+    unsigned int uVisibleCount = FRUSTUM.FindVisible(CENTERS, null_q, null_q);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uVisibleCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the boxes found are the same as the ones obtained checking them one by one as hexahedra, in ascending order.
+/// </summary>
+QTEST_CASE ( FindVisible2_ResultIsTheSameAsCheckingEveryBox_Test )
+{
+    // [Preparation]
+    const QFrustum FRUSTUM = GetCameraFrustum();
+    const unsigned int BOX_COUNT = 99U;
+    QSoAPointBuffer centers(BOX_COUNT);
+    QSoAPointBuffer halfSizes(BOX_COUNT);
+    unsigned int arExpectedIndices[BOX_COUNT];
+    unsigned int uExpectedCount = 0;
+
+    for(unsigned int i = 0; i < BOX_COUNT; ++i)
+    {
+        const QVector3 CENTER(scast_q(i % 9U, float_q) * SQFloat::_3 - SQFloat::_10 - SQFloat::_2, 
+                              SQFloat::_0_5 * scast_q(i % 7U, float_q), 
+                              scast_q(i, float_q) + SQFloat::_0_25 - SQFloat::_5);
+        const QVector3 HALF_SIZE(SQFloat::_0_25 * scast_q(i % 5U, float_q), SQFloat::_0_5, SQFloat::_0_25 * scast_q(i % 3U, float_q));
+        centers.SetPoint(i, CENTER);
+        halfSizes.SetPoint(i, HALF_SIZE);
+
+        if(FRUSTUM.IsVisible(QHexahedron<QVector3>(CENTER, HALF_SIZE.x * SQFloat::_2, HALF_SIZE.y * SQFloat::_2, HALF_SIZE.z * SQFloat::_2)))
+            arExpectedIndices[uExpectedCount++] = i;
+    }
+
+	// [Execution]
+    unsigned int arVisibleIndices[BOX_COUNT];
+    unsigned int uVisibleCount = FRUSTUM.FindVisible(centers, halfSizes, arVisibleIndices);
+
+    // [Verification]
+    BOOST_CHECK(uExpectedCount > 0 && uExpectedCount < BOX_COUNT);
+    BOOST_CHECK_EQUAL(uVisibleCount, uExpectedCount);
+
+    for(unsigned int i = 0; i < uExpectedCount; ++i)
+        BOOST_CHECK_EQUAL(arVisibleIndices[i], arExpectedIndices[i]);
+}
+
+/// <summary>
+/// Checks that the positions of the visible hexahedra are returned in ascending order.
+/// </summary>
+QTEST_CASE ( FindVisible3_ReturnsThePositionsOfVisibleHexahedra_Test )
+{
+    // [Preparation]
+    const QFrustum FRUSTUM = GetCameraFrustum();
+    const unsigned int HEXAHEDRON_COUNT = 4U;
+    QBaseHexahedron<QVector3> arHexahedra[HEXAHEDRON_COUNT];
+    arHexahedra[0] = QHexahedron<QVector3>(QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_5), SQFloat::_2, SQFloat::_2, SQFloat::_2);
+    arHexahedra[1] = QHexahedron<QVector3>(QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_10), SQFloat::_2, SQFloat::_2, SQFloat::_2);
+    arHexahedra[2] = QHexahedron<QVector3>(QVector3(SQFloat::_10 + SQFloat::_5, SQFloat::_0, SQFloat::_10), SQFloat::_2, SQFloat::_2, SQFloat::_2);
+    arHexahedra[3] = QHexahedron<QVector3>(QVector3(SQFloat::_5, SQFloat::_5, SQFloat::_10), SQFloat::_2, SQFloat::_2, SQFloat::_2);
+    const unsigned int EXPECTED_COUNT = 2U;
+    const unsigned int EXPECTED_INDICES[] = { 1U, 3U };
+
+	// [Execution]
+    unsigned int arVisibleIndices[HEXAHEDRON_COUNT];
+    unsigned int uVisibleCount = FRUSTUM.FindVisible(arHexahedra, HEXAHEDRON_COUNT, arVisibleIndices);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uVisibleCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(arVisibleIndices[0], EXPECTED_INDICES[0]);
+    BOOST_CHECK_EQUAL(arVisibleIndices[1], EXPECTED_INDICES[1]);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the array of radii is null.
+/// </summary>
+QTEST_CASE ( FindVisible1_AssertionFailsWhenRadiiAreNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QFrustum FRUSTUM = GetCameraFrustum();
+    const QSoAPointBuffer CENTERS(3U);
+    unsigned int arVisibleIndices[3];
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        FRUSTUM.FindVisible(CENTERS, null_q, arVisibleIndices);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the number of sizes is not the same as the number of centers.
+/// </summary>
+QTEST_CASE ( FindVisible2_AssertionFailsWhenNumberOfSizesIsDifferent_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QFrustum FRUSTUM = GetCameraFrustum();
+    const QSoAPointBuffer CENTERS(3U);
+    const QSoAPointBuffer HALF_SIZES(2U);
+    unsigned int arVisibleIndices[3];
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        FRUSTUM.FindVisible(CENTERS, HALF_SIZES, arVisibleIndices);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the index of the plane is out of bounds.
+/// </summary>
+QTEST_CASE ( GetPlane_AssertionFailsWhenIndexIsOutOfBounds_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QFrustum FRUSTUM = GetCameraFrustum();
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        FRUSTUM.GetPlane(QFrustum::PLANE_COUNT);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+// End - Test Suite: QFrustum
+QTEST_SUITE_END()
@@ -34,11 +34,31 @@ using namespace boost::unit_test;
 
 #include "QAssertException.h"
 #include "CallCounter.h"
+#include "BinaryStreamMock.h"
 #include "SQStringHashProvider.h"
 
 using Kinesis::QuimeraEngine::Tools::Containers::QHashtable;
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::SQStringHashProvider;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamMock;
+
+/// <summary>
+/// Hash provider that counts how many hashes have been generated.
+/// </summary>
+class SQCountingHashProvider
+{
+public:
+
+    static pointer_uint_q GenerateHash(const int nInput)
+    {
+        ++sm_uGeneratedHashes;
+        return scast_q(nInput, pointer_uint_q);
+    }
+
+    static pointer_uint_q sm_uGeneratedHashes;
+};
+
+pointer_uint_q SQCountingHashProvider::sm_uGeneratedHashes = 0;
 
 
 QTEST_SUITE_BEGIN( QHashtable_TestSuite )
@@ -157,11 +177,7 @@ QTEST_CASE ( Constructor2_CopyConstructorOfEveryKeyAndValueIsCalled_Test )
     HASHTABLE.Add(CallCounter(), CallCounter());
     HASHTABLE.Add(CallCounter(), CallCounter());
     HASHTABLE.Add(CallCounter(), CallCounter());
-#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_DISABLED
-    const unsigned int EXPECTED_CALLS = HASHTABLE.GetCount() * 2U + 3U; // +3 due to calls to GenerateHashKey, which receives a copy of an integer
-#else
-    const unsigned int EXPECTED_CALLS = HASHTABLE.GetCount() * 2U + 6U; // +6 due to calls to GenerateHashKey, which receives a copy of an integer
-#endif
+    const unsigned int EXPECTED_CALLS = HASHTABLE.GetCount() * 2U; // Stored hashes are copied, GenerateHash is not called
     CallCounter::ResetCounters();
 
     // [Execution]
@@ -1490,11 +1506,7 @@ QTEST_CASE ( OperatorAssignment_CopyConstructorsAreCalledForAllKeysAndValues_Tes
     copiedHashtable.Add(CallCounter(), CallCounter());
     copiedHashtable.Add(CallCounter(), CallCounter());
 
-#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_DISABLED
-    const unsigned int EXPECTED_COPY_CONSTRUCTORS_VALUE = HASHTABLE.GetCount() * 2U + HASHTABLE.GetCount(); // +GetCount because CallCounter instances are copied when they are passed to GenerateHashKey
-#else
-    const unsigned int EXPECTED_COPY_CONSTRUCTORS_VALUE = HASHTABLE.GetCount() * 2U + HASHTABLE.GetCount() * 2U; // +GetCount*2 because CallCounter instances are copied when they are passed to GenerateHashKey
-#endif
+    const unsigned int EXPECTED_COPY_CONSTRUCTORS_VALUE = HASHTABLE.GetCount() * 2U; // Stored hashes are copied, GenerateHash is not called
     CallCounter::ResetCounters();
 
     // [Execution]
@@ -1670,5 +1682,201 @@ QTEST_CASE ( GetKeys_ReturnsNullWhenHashtableIsEmpty_Test )
     BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
 }
 
+/// <summary>
+/// Checks that the load factor never exceeds its maximum, which is 1, when adding many elements.
+/// </summary>
+QTEST_CASE ( Add_LoadFactorDoesNotExceedMaximumWhenAddingManyElements_Test )
+{
+    // [Preparation]
+    const float MAX_LOAD_FACTOR = 1.0f;
+    const int NUMBER_OF_ELEMENTS = 1000;
+    QHashtable<int, int> hashtable(2, 1);
+    bool bLoadFactorIsAlwaysLowerThanMaximum = true;
+
+    // [Execution]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        hashtable.Add(i, i * 2);
+        bLoadFactorIsAlwaysLowerThanMaximum = bLoadFactorIsAlwaysLowerThanMaximum && hashtable.GetLoadFactor() <= MAX_LOAD_FACTOR;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bLoadFactorIsAlwaysLowerThanMaximum);
+}
+
+/// <summary>
+/// Checks that every element can be found while the buckets are being rehashed and after that.
+/// </summary>
+QTEST_CASE ( Add_AllElementsAreFoundWhileAndAfterRehashing_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 300;
+    QHashtable<int, int> hashtable(1, 1);
+    bool bAllElementsAreFound = true;
+
+    // [Execution]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        hashtable.Add(i, i * 2);
+
+        // [Verification]
+        for(int j = 0; j <= i; ++j)
+            bAllElementsAreFound = bAllElementsAreFound && hashtable.ContainsKey(j) && hashtable[j] == j * 2 && hashtable.PositionOfKey(j)->GetKey() == j;
+    }
+
+    BOOST_CHECK(bAllElementsAreFound);
+    BOOST_CHECK(!hashtable.ContainsKey(NUMBER_OF_ELEMENTS));
+}
+
+/// <summary>
+/// Checks that the hash provider is called only once per added element, even when the buckets are rehashed.
+/// </summary>
+QTEST_CASE ( Add_HashesAreNotGeneratedAgainWhenRehashing_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 500;
+    const pointer_uint_q EXPECTED_HASHES = NUMBER_OF_ELEMENTS;
+    QHashtable<int, int, SQCountingHashProvider> hashtable(1, 1);
+
+    // [Execution]
+    SQCountingHashProvider::sm_uGeneratedHashes = 0;
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i, i);
+
+    // [Verification]
+    pointer_uint_q uGeneratedHashes = SQCountingHashProvider::sm_uGeneratedHashes;
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_DISABLED
+    BOOST_CHECK_EQUAL(uGeneratedHashes, EXPECTED_HASHES);
+#else
+    BOOST_CHECK_EQUAL(uGeneratedHashes, EXPECTED_HASHES * 2U); // Add checks whether the key exists, which generates the hash too
+#endif
+}
+
+/// <summary>
+/// Checks that elements are correctly removed while the buckets are being rehashed.
+/// </summary>
+QTEST_CASE ( Remove_ElementsAreCorrectlyRemovedWhileRehashing_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 200;
+    QHashtable<int, int> hashtable(1, 1);
+    bool bRemainingElementsAreFound = true;
+    bool bRemovedElementsAreNotFound = true;
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i, i);
+
+    // [Execution]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; i += 2)
+        hashtable.Remove(i);
+
+    // [Verification]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        if(i % 2 == 0)
+            bRemovedElementsAreNotFound = bRemovedElementsAreNotFound && !hashtable.ContainsKey(i);
+        else
+            bRemainingElementsAreFound = bRemainingElementsAreFound && hashtable.ContainsKey(i) && hashtable[i] == i;
+    }
+
+    BOOST_CHECK(bRemovedElementsAreNotFound);
+    BOOST_CHECK(bRemainingElementsAreFound);
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), scast_q(NUMBER_OF_ELEMENTS / 2, pointer_uint_q));
+}
+
+/// <summary>
+/// Checks that the number of buckets grows when reserving space for more elements than buckets.
+/// </summary>
+QTEST_CASE ( Reserve_BucketsGrowWhenReservingMoreElementsThanBuckets_Test )
+{
+    // [Preparation]
+    const float MAX_LOAD_FACTOR = 1.0f;
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 1000;
+    QHashtable<int, int> hashtable(2, 1);
+    hashtable.Add(0, 0);
+    hashtable.Add(1, 1);
+
+    // [Execution]
+    hashtable.Reserve(NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    for(pointer_uint_q i = 2; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(scast_q(i, int), 0);
+
+    float fLoadFactor = hashtable.GetLoadFactor();
+    BOOST_CHECK(fLoadFactor <= MAX_LOAD_FACTOR);
+    BOOST_CHECK(hashtable.ContainsKey(0));
+    BOOST_CHECK(hashtable.ContainsKey(1));
+}
+
+/// <summary>
+/// Checks that a copy of a hashtable whose buckets are being rehashed contains all the elements.
+/// </summary>
+QTEST_CASE ( Constructor2_HashtableIsCorrectlyCopiedWhileRehashing_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 33; // The rehash started when adding the element 33 has not finished
+    QHashtable<int, int> HASHTABLE(1, 1);
+    bool bAllElementsAreFound = true;
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        HASHTABLE.Add(i, i);
+
+    // [Execution]
+    QHashtable<int, int> hashtableCopy(HASHTABLE);
+
+    // [Verification]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bAllElementsAreFound = bAllElementsAreFound && hashtableCopy.ContainsKey(i) && hashtableCopy[i] == i;
+
+    BOOST_CHECK(bAllElementsAreFound);
+    BOOST_CHECK(hashtableCopy == HASHTABLE);
+}
+
+/// <summary>
+/// Checks that the load factor is the number of elements divided by the number of buckets.
+/// </summary>
+QTEST_CASE ( GetLoadFactor_ReturnsNumberOfElementsDividedByNumberOfBuckets_Test )
+{
+    // [Preparation]
+    const float EXPECTED_LOAD_FACTOR = 0.75f;
+    QHashtable<int, int> hashtable(4, 2);
+    hashtable.Add(0, 0);
+    hashtable.Add(1, 1);
+    hashtable.Add(2, 2);
+
+    // [Execution]
+    float fLoadFactor = hashtable.GetLoadFactor();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(fLoadFactor, EXPECTED_LOAD_FACTOR);
+}
+
+/// <summary>
+/// Checks that the key-value pairs read replace the existing ones and are the same that were written.
+/// </summary>
+QTEST_CASE ( Deserialize_KeyValuePairsAreReadAsTheyWereWritten_Test )
+{
+    // [Preparation]
+    QHashtable<string_q, int, SQStringHashProvider> hashtableInput(4, 2);
+    QHashtable<string_q, int, SQStringHashProvider> hashtableResult(4, 2);
+    BinaryStreamMock stream;
+
+    for(int i = 0; i < 20; ++i)
+        hashtableInput.Add(string_q::FromInteger(i), i);
+
+    hashtableResult.Add("Key", 9);
+    hashtableInput.Serialize(stream);
+
+    // [Execution]
+    hashtableResult.Deserialize(stream);
+
+    // [Verification]
+    BOOST_CHECK(hashtableResult == hashtableInput);
+    BOOST_CHECK_EQUAL(hashtableResult.GetCount(), hashtableInput.GetCount());
+    BOOST_CHECK(!hashtableResult.ContainsKey("Key"));
+}
+
 // End - Test Suite: QHashtable
 QTEST_SUITE_END()
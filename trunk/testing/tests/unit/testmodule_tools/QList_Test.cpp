@@ -34,6 +34,7 @@ using namespace boost::unit_test;
 #include "QListWhiteBox.h"
 #include "ListElementMock.h"
 #include "CallCounter.h"
+#include "BinaryStreamMock.h"
 #include "QAssertException.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
@@ -42,6 +43,7 @@ using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QListWhiteBox;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::ListElementMock;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamMock;
 
 
 QTEST_SUITE_BEGIN( QList_TestSuite )
@@ -5156,6 +5158,54 @@ QTEST_CASE( GetCapacity_ReturnsTheCapacityOfTheList_Test )
 }
 
 
+/// <summary>
+/// Checks that the elements are written in blocks instead of calling the writer once per element.
+/// </summary>
+QTEST_CASE ( Serialize_ElementsAreWrittenInBlocks_Test )
+{
+    // [Preparation]
+    const pointer_uint_q COUNT = 100;
+    const unsigned int HEADER_CALLS = 3U;
+    const unsigned int EXPECTED_CALLS = HEADER_CALLS + 1U;
+    QList<u32_q> list;
+    BinaryStreamMock stream;
+
+    for(u32_q i = 0; i < COUNT; ++i)
+        list.Add(i);
+
+    // [Execution]
+    list.Serialize(stream);
+
+    // [Verification]
+    unsigned int uCalls = stream.GetWriteCallsCount();
+    BOOST_CHECK_EQUAL(uCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that the elements read are the same that were written, in the same order, even if the list was fragmented.
+/// </summary>
+QTEST_CASE ( Deserialize_ElementsAreReadAsTheyWereWritten_Test )
+{
+    // [Preparation]
+    QList<u32_q> listInput;
+    QList<u32_q> listResult;
+    BinaryStreamMock stream;
+    listInput.Add(1U);
+    listInput.Add(2U);
+    listInput.Add(3U);
+    listInput.Insert(0U, 0);
+    listInput.Remove(2);
+    listResult.Add(9U);
+    listInput.Serialize(stream);
+
+    // [Execution]
+    listResult.Deserialize(stream);
+
+    // [Verification]
+    BOOST_CHECK(listResult == listInput);
+    BOOST_CHECK_EQUAL(listResult.GetCount(), listInput.GetCount());
+}
+
 // End - Test Suite: QList
 
 QTEST_SUITE_END()
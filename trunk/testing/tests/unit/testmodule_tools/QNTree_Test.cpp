@@ -33,12 +33,14 @@ using namespace boost::unit_test;
 #include "QNTree.h"
 #include "QNTreeWhiteBox.h"
 #include "CallCounter.h"
+#include "BinaryStreamMock.h"
 #include "QAssertException.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::QNTree;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QNTreeWhiteBox;
 using Kinesis::QuimeraEngine::Tools::Containers::EQTreeTraversalOrder;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamMock;
 
 
 QTEST_SUITE_BEGIN( QNTree_TestSuite )
@@ -3771,6 +3773,77 @@ QTEST_CASE ( IsEmpty_ReturnsFalseWhenTreeIsNotEmpty_Test )
     BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
 }
 
+/// <summary>
+/// Checks that the elements read are the same that were written and the tree keeps the same structure, even if it was fragmented.
+/// </summary>
+QTEST_CASE ( Deserialize_ElementsAndStructureAreReadAsTheyWereWritten_Test )
+{
+    // [Preparation]
+    QNTree<char> treeInput(3, 8);
+    treeInput.SetRootValue('A');
+    QNTree<char>::QNTreeIterator itRoot = treeInput.GetIterator(0, EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    QNTree<char>::QNTreeIterator itFirstChild = treeInput.AddChild(itRoot, 'B');
+    QNTree<char>::QNTreeIterator itSecondChild = treeInput.AddChild(itRoot, 'F');
+    treeInput.AddChild(itFirstChild, 'C');
+    treeInput.AddChild(itFirstChild, 'D');
+    treeInput.AddChild(itSecondChild, 'G');
+    treeInput.AddChild(itFirstChild, 'E');
+    treeInput.RemoveChild(itFirstChild, 0);
+
+    QNTree<char> treeResult(3, 1);
+    treeResult.SetRootValue('Z');
+    BinaryStreamMock stream;
+    treeInput.Serialize(stream);
+
+    // [Execution]
+    treeResult.Deserialize(stream);
+
+    // [Verification]
+    BOOST_CHECK(treeResult == treeInput);
+    BOOST_CHECK_EQUAL(treeResult.GetCount(), treeInput.GetCount());
+    QNTree<char>::QConstNTreeIterator itInput = treeInput.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    QNTree<char>::QConstNTreeIterator itResult = treeResult.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    bool bSameStructure = true;
+
+    for(; bSameStructure && !itInput.IsEnd(); ++itInput, ++itResult)
+        bSameStructure = *itInput == *itResult && treeInput.GetChildrenCount(itInput) == treeResult.GetChildrenCount(itResult);
+
+    BOOST_CHECK(bSameStructure);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the tree read allows more children per node than the resident tree.
+/// </summary>
+QTEST_CASE ( Deserialize_AssertionFailsWhenTheTreeReadAllowsMoreChildrenPerNode_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QNTree<char> treeInput(4, 1);
+    treeInput.SetRootValue('A');
+    QNTree<char> treeResult(3, 1);
+    BinaryStreamMock stream;
+    treeInput.Serialize(stream);
+
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        treeResult.Deserialize(stream);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
 // End - Test Suite: QNTree
 
 QTEST_SUITE_END()
@@ -2451,6 +2451,659 @@ QTEST_CASE_TEMPLATE ( Intersection5_AssertionFailsWhenAllHexahedronVerticesCoinc
 
 #endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
+/// <summary>
+/// Checks that it returns the expected distance and barycentric coordinates when a common ray and a common triangle intersect.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection6_ReturnsExpectedDistanceAndBarycentricCoordinatesWhenCommonRayIntersectsWithCommonTriangle_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_1);
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_0, SQFloat::_4, SQFloat::_0, SQFloat::_1 };
+    const T VERTEX_A = T(VERTEX_A_COMPONENTS);
+    const T VERTEX_B = T(VERTEX_B_COMPONENTS);
+    const T VERTEX_C = T(VERTEX_C_COMPONENTS);
+
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(VERTEX_A, VERTEX_B, VERTEX_C);
+
+    const bool EXPECTED_RESULT = true;
+    const float_q EXPECTED_DISTANCE = SQFloat::_3;
+    const float_q EXPECTED_U = SQFloat::_0_25;
+    const float_q EXPECTED_V = SQFloat::_0_5;
+
+	// [Execution]
+    float_q fDistance = SQFloat::_0;
+    float_q fU = SQFloat::_0;
+    float_q fV = SQFloat::_0;
+    bool bResult = RAY.Intersection(TRIANGLE, fDistance, fU, fV);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK(SQFloat::AreEqual(fDistance, EXPECTED_DISTANCE));
+    BOOST_CHECK(SQFloat::AreEqual(fU, EXPECTED_U));
+    BOOST_CHECK(SQFloat::AreEqual(fV, EXPECTED_V));
+}
+
+/// <summary>
+/// Checks that the intersection point can be calculated from both the distance and the barycentric coordinates.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection6_DistanceAndBarycentricCoordinatesDescribeTheSamePoint_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { SQFloat::_3, SQFloat::_3, SQFloat::_1, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_1, -SQFloat::_1, SQFloat::_0).Normalize();
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_1, SQFloat::_1, SQFloat::_1, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_2, SQFloat::_3, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_5, SQFloat::_2, SQFloat::_0, SQFloat::_1 };
+    const T VERTEX_A = T(VERTEX_A_COMPONENTS);
+    const T VERTEX_B = T(VERTEX_B_COMPONENTS);
+    const T VERTEX_C = T(VERTEX_C_COMPONENTS);
+
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(VERTEX_A, VERTEX_B, VERTEX_C);
+
+    T vExpectedPoint;
+    RAY.IntersectionPoint(TRIANGLE, vExpectedPoint);
+
+	// [Execution]
+    float_q fDistance = SQFloat::_0;
+    float_q fU = SQFloat::_0;
+    float_q fV = SQFloat::_0;
+    RAY.Intersection(TRIANGLE, fDistance, fU, fV);
+
+    // [Verification]
+    const QVector3 POINT_FROM_DISTANCE(ORIGIN.x + DIRECTION.x * fDistance,
+                                       ORIGIN.y + DIRECTION.y * fDistance,
+                                       ORIGIN.z + DIRECTION.z * fDistance);
+    const float_q WEIGHT_A = SQFloat::_1 - fU - fV;
+    const QVector3 POINT_FROM_BARYCENTRICS(VERTEX_A.x * WEIGHT_A + VERTEX_B.x * fU + VERTEX_C.x * fV,
+                                           VERTEX_A.y * WEIGHT_A + VERTEX_B.y * fU + VERTEX_C.y * fV,
+                                           VERTEX_A.z * WEIGHT_A + VERTEX_B.z * fU + VERTEX_C.z * fV);
+
+    BOOST_CHECK(SQFloat::AreEqual(POINT_FROM_DISTANCE.x, vExpectedPoint.x));
+    BOOST_CHECK(SQFloat::AreEqual(POINT_FROM_DISTANCE.y, vExpectedPoint.y));
+    BOOST_CHECK(SQFloat::AreEqual(POINT_FROM_DISTANCE.z, vExpectedPoint.z));
+    BOOST_CHECK(SQFloat::AreEqual(POINT_FROM_BARYCENTRICS.x, vExpectedPoint.x));
+    BOOST_CHECK(SQFloat::AreEqual(POINT_FROM_BARYCENTRICS.y, vExpectedPoint.y));
+    BOOST_CHECK(SQFloat::AreEqual(POINT_FROM_BARYCENTRICS.z, vExpectedPoint.z));
+}
+
+/// <summary>
+/// Checks that it returns True when the ray intersects with a vertex of the triangle, and that barycentric coordinates correspond to that vertex.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection6_ReturnsTrueWhenRayIntersectsWithTriangleVertex_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { SQFloat::_4, SQFloat::_0, SQFloat::_3, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_1);
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_0, SQFloat::_4, SQFloat::_0, SQFloat::_1 };
+    const T VERTEX_A = T(VERTEX_A_COMPONENTS);
+    const T VERTEX_B = T(VERTEX_B_COMPONENTS);
+    const T VERTEX_C = T(VERTEX_C_COMPONENTS);
+
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(VERTEX_A, VERTEX_B, VERTEX_C);
+
+    const bool EXPECTED_RESULT = true;
+    const float_q EXPECTED_U = SQFloat::_1;
+    const float_q EXPECTED_V = SQFloat::_0;
+
+	// [Execution]
+    float_q fDistance = SQFloat::_0;
+    float_q fU = SQFloat::_0;
+    float_q fV = SQFloat::_0;
+    bool bResult = RAY.Intersection(TRIANGLE, fDistance, fU, fV);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK(SQFloat::AreEqual(fU, EXPECTED_U));
+    BOOST_CHECK(SQFloat::AreEqual(fV, EXPECTED_V));
+}
+
+/// <summary>
+/// Checks that it returns True when the ray intersects with the back face of the triangle.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection6_ReturnsTrueWhenRayIntersectsWithBackFaceOfTriangle_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { SQFloat::_1, SQFloat::_2, -SQFloat::_3, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1);
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_0, SQFloat::_4, SQFloat::_0, SQFloat::_1 };
+    const T VERTEX_A = T(VERTEX_A_COMPONENTS);
+    const T VERTEX_B = T(VERTEX_B_COMPONENTS);
+    const T VERTEX_C = T(VERTEX_C_COMPONENTS);
+
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(VERTEX_A, VERTEX_B, VERTEX_C);
+
+    const bool EXPECTED_RESULT = true;
+    const float_q EXPECTED_DISTANCE = SQFloat::_3;
+    const float_q EXPECTED_U = SQFloat::_0_25;
+    const float_q EXPECTED_V = SQFloat::_0_5;
+
+	// [Execution]
+    float_q fDistance = SQFloat::_0;
+    float_q fU = SQFloat::_0;
+    float_q fV = SQFloat::_0;
+    bool bResult = RAY.Intersection(TRIANGLE, fDistance, fU, fV);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK(SQFloat::AreEqual(fDistance, EXPECTED_DISTANCE));
+    BOOST_CHECK(SQFloat::AreEqual(fU, EXPECTED_U));
+    BOOST_CHECK(SQFloat::AreEqual(fV, EXPECTED_V));
+}
+
+/// <summary>
+/// Checks that it returns True and a null distance when the origin of the ray is contained in the triangle.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection6_ReturnsTrueWhenOriginIsContainedInTriangle_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { SQFloat::_1, SQFloat::_2, SQFloat::_0, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_1, SQFloat::_1, SQFloat::_1).Normalize();
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_0, SQFloat::_4, SQFloat::_0, SQFloat::_1 };
+    const T VERTEX_A = T(VERTEX_A_COMPONENTS);
+    const T VERTEX_B = T(VERTEX_B_COMPONENTS);
+    const T VERTEX_C = T(VERTEX_C_COMPONENTS);
+
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(VERTEX_A, VERTEX_B, VERTEX_C);
+
+    const bool EXPECTED_RESULT = true;
+    const float_q EXPECTED_DISTANCE = SQFloat::_0;
+
+	// [Execution]
+    float_q fDistance = SQFloat::_1;
+    float_q fU = SQFloat::_0;
+    float_q fV = SQFloat::_0;
+    bool bResult = RAY.Intersection(TRIANGLE, fDistance, fU, fV);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK(SQFloat::AreEqual(fDistance, EXPECTED_DISTANCE));
+}
+
+/// <summary>
+/// Checks that it returns False and output parameters are not modified when the ray and the triangle do not intersect.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection6_ReturnsFalseAndOutputParametersAreNotModifiedWhenRayDoesNotIntersectWithTriangle_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { SQFloat::_3, SQFloat::_3, SQFloat::_3, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_1);
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_0, SQFloat::_4, SQFloat::_0, SQFloat::_1 };
+    const T VERTEX_A = T(VERTEX_A_COMPONENTS);
+    const T VERTEX_B = T(VERTEX_B_COMPONENTS);
+    const T VERTEX_C = T(VERTEX_C_COMPONENTS);
+
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(VERTEX_A, VERTEX_B, VERTEX_C);
+
+    const bool EXPECTED_RESULT = false;
+    const float_q EXPECTED_DISTANCE = SQFloat::_5;
+    const float_q EXPECTED_U = SQFloat::_6;
+    const float_q EXPECTED_V = SQFloat::_7;
+
+	// [Execution]
+    float_q fDistance = EXPECTED_DISTANCE;
+    float_q fU = EXPECTED_U;
+    float_q fV = EXPECTED_V;
+    bool bResult = RAY.Intersection(TRIANGLE, fDistance, fU, fV);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(fDistance, EXPECTED_DISTANCE);
+    BOOST_CHECK_EQUAL(fU, EXPECTED_U);
+    BOOST_CHECK_EQUAL(fV, EXPECTED_V);
+}
+
+/// <summary>
+/// Checks that it returns False when the ray and the triangle would intersect if the ray pointed to the opposite direction.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection6_ReturnsFalseWhenRayDoesNotIntersectWithTriangleButWouldDoIfRayPointedOppositeDirection_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { SQFloat::_1, SQFloat::_2, -SQFloat::_3, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_1);
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_0, SQFloat::_4, SQFloat::_0, SQFloat::_1 };
+    const T VERTEX_A = T(VERTEX_A_COMPONENTS);
+    const T VERTEX_B = T(VERTEX_B_COMPONENTS);
+    const T VERTEX_C = T(VERTEX_C_COMPONENTS);
+
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(VERTEX_A, VERTEX_B, VERTEX_C);
+
+    const bool EXPECTED_RESULT = false;
+
+	// [Execution]
+    float_q fDistance = SQFloat::_0;
+    float_q fU = SQFloat::_0;
+    float_q fV = SQFloat::_0;
+    bool bResult = RAY.Intersection(TRIANGLE, fDistance, fU, fV);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns False when the ray and the triangle are coplanar, even if they intersect.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection6_ReturnsFalseWhenRayAndTriangleAreCoplanar_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { -SQFloat::_1, SQFloat::_1, SQFloat::_0, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_1, SQFloat::_0, SQFloat::_0);
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_0, SQFloat::_4, SQFloat::_0, SQFloat::_1 };
+    const T VERTEX_A = T(VERTEX_A_COMPONENTS);
+    const T VERTEX_B = T(VERTEX_B_COMPONENTS);
+    const T VERTEX_C = T(VERTEX_C_COMPONENTS);
+
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(VERTEX_A, VERTEX_B, VERTEX_C);
+
+    const bool EXPECTED_RESULT = false;
+
+	// [Execution]
+    float_q fDistance = SQFloat::_0;
+    float_q fU = SQFloat::_0;
+    float_q fV = SQFloat::_0;
+    bool bResult = RAY.Intersection(TRIANGLE, fDistance, fU, fV);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that every triangle obtains the same result as when it is checked alone, including those at the incomplete block at the end.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection7_EveryTriangleObtainsTheSameResultAsWhenItIsCheckedAlone_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+    using Kinesis::QuimeraEngine::Tools::Math::QSoAPointBuffer;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { SQFloat::_1, SQFloat::_1, SQFloat::_3, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_0_25, SQFloat::_0, -SQFloat::_1).Normalize();
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const unsigned int TRIANGLE_COUNT = 6U;
+    const QVector3 VERTICES_A[] = { QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                    QVector3(SQFloat::_5, SQFloat::_5, SQFloat::_0),
+                                    QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1),
+                                    QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_5),
+                                    QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_2),
+                                    QVector3(-SQFloat::_1, SQFloat::_1, SQFloat::_0) };
+    const QVector3 VERTICES_B[] = { QVector3(SQFloat::_4, SQFloat::_0, SQFloat::_0),
+                                    QVector3(SQFloat::_9, SQFloat::_5, SQFloat::_0),
+                                    QVector3(SQFloat::_4, SQFloat::_0, SQFloat::_1),
+                                    QVector3(SQFloat::_4, SQFloat::_0, SQFloat::_5),
+                                    QVector3(SQFloat::_4, SQFloat::_0, -SQFloat::_2),
+                                    QVector3(SQFloat::_5, SQFloat::_1, SQFloat::_0) };
+    const QVector3 VERTICES_C[] = { QVector3(SQFloat::_0, SQFloat::_4, SQFloat::_0),
+                                    QVector3(SQFloat::_5, SQFloat::_9, SQFloat::_0),
+                                    QVector3(SQFloat::_0, SQFloat::_4, SQFloat::_1),
+                                    QVector3(SQFloat::_0, SQFloat::_4, SQFloat::_5),
+                                    QVector3(SQFloat::_0, SQFloat::_4, -SQFloat::_2),
+                                    QVector3(-SQFloat::_1, SQFloat::_1, SQFloat::_4) };
+
+    QSoAPointBuffer verticesA(TRIANGLE_COUNT);
+    QSoAPointBuffer verticesB(TRIANGLE_COUNT);
+    QSoAPointBuffer verticesC(TRIANGLE_COUNT);
+
+    float_q arExpectedDistances[TRIANGLE_COUNT];
+    float_q arExpectedU[TRIANGLE_COUNT];
+    float_q arExpectedV[TRIANGLE_COUNT];
+    unsigned int uExpectedIntersections = 0;
+
+    for(unsigned int i = 0; i < TRIANGLE_COUNT; ++i)
+    {
+        verticesA.SetPoint(i, VERTICES_A[i]);
+        verticesB.SetPoint(i, VERTICES_B[i]);
+        verticesC.SetPoint(i, VERTICES_C[i]);
+
+        const float_q VERTEX_A_COMPONENTS[] = { VERTICES_A[i].x, VERTICES_A[i].y, VERTICES_A[i].z, SQFloat::_1 };
+        const float_q VERTEX_B_COMPONENTS[] = { VERTICES_B[i].x, VERTICES_B[i].y, VERTICES_B[i].z, SQFloat::_1 };
+        const float_q VERTEX_C_COMPONENTS[] = { VERTICES_C[i].x, VERTICES_C[i].y, VERTICES_C[i].z, SQFloat::_1 };
+        const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(T(VERTEX_A_COMPONENTS), T(VERTEX_B_COMPONENTS), T(VERTEX_C_COMPONENTS));
+
+        arExpectedDistances[i] = -SQFloat::_1;
+        arExpectedU[i] = SQFloat::_0;
+        arExpectedV[i] = SQFloat::_0;
+
+        if( RAY.Intersection(TRIANGLE, arExpectedDistances[i], arExpectedU[i], arExpectedV[i]) )
+            ++uExpectedIntersections;
+    }
+
+	// [Execution]
+    float_q arDistances[TRIANGLE_COUNT];
+    float_q arU[TRIANGLE_COUNT];
+    float_q arV[TRIANGLE_COUNT];
+    unsigned int uIntersections = RAY.Intersection(verticesA, verticesB, verticesC, arDistances, arU, arV);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIntersections, uExpectedIntersections);
+
+    for(unsigned int i = 0; i < TRIANGLE_COUNT; ++i)
+    {
+        BOOST_CHECK(SQFloat::AreEqual(arDistances[i], arExpectedDistances[i]));
+        BOOST_CHECK(SQFloat::AreEqual(arU[i], arExpectedU[i]));
+        BOOST_CHECK(SQFloat::AreEqual(arV[i], arExpectedV[i]));
+    }
+}
+
+/// <summary>
+/// Checks that the arrays of barycentric coordinates can be null and that the elements after the last triangle are not modified.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection7_BarycentricCoordinatesAreOptionalAndElementsAfterTheLastTriangleAreNotModified_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QSoAPointBuffer;
+
+    // [Preparation]
+    const float_q ORIGIN_COMPONENTS[] = { SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1 };
+    const T ORIGIN(ORIGIN_COMPONENTS);
+    const QVector3 DIRECTION = QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_1);
+    const QRay3D<T> RAY = QRay3D<T>(ORIGIN, DIRECTION);
+
+    const unsigned int TRIANGLE_COUNT = 2U;
+    QSoAPointBuffer verticesA(TRIANGLE_COUNT);
+    QSoAPointBuffer verticesB(TRIANGLE_COUNT);
+    QSoAPointBuffer verticesC(TRIANGLE_COUNT);
+    verticesA.SetPoint(0, QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0));
+    verticesB.SetPoint(0, QVector3(SQFloat::_4, SQFloat::_0, SQFloat::_0));
+    verticesC.SetPoint(0, QVector3(SQFloat::_0, SQFloat::_4, SQFloat::_0));
+    verticesA.SetPoint(1, QVector3(SQFloat::_5, SQFloat::_0, SQFloat::_0));
+    verticesB.SetPoint(1, QVector3(SQFloat::_9, SQFloat::_0, SQFloat::_0));
+    verticesC.SetPoint(1, QVector3(SQFloat::_5, SQFloat::_4, SQFloat::_0));
+
+    const unsigned int EXPECTED_INTERSECTIONS = 1U;
+    const float_q EXPECTED_DISTANCE1 = SQFloat::_3;
+    const float_q EXPECTED_DISTANCE2 = -SQFloat::_1;
+    const float_q EXPECTED_UNMODIFIED_VALUE = SQFloat::_9;
+
+	// [Execution]
+    float_q arDistances[] = { SQFloat::_0, SQFloat::_0, EXPECTED_UNMODIFIED_VALUE, EXPECTED_UNMODIFIED_VALUE };
+    unsigned int uIntersections = RAY.Intersection(verticesA, verticesB, verticesC, arDistances, null_q, null_q);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIntersections, EXPECTED_INTERSECTIONS);
+    BOOST_CHECK(SQFloat::AreEqual(arDistances[0], EXPECTED_DISTANCE1));
+    BOOST_CHECK_EQUAL(arDistances[1], EXPECTED_DISTANCE2);
+    BOOST_CHECK_EQUAL(arDistances[2], EXPECTED_UNMODIFIED_VALUE);
+    BOOST_CHECK_EQUAL(arDistances[3], EXPECTED_UNMODIFIED_VALUE);
+}
+
+/// <summary>
+/// Checks that every ray obtains the same result as when it is checked alone, including those at the incomplete packet at the end.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection8_EveryRayObtainsTheSameResultAsWhenItIsCheckedAlone_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_1, SQFloat::_1, SQFloat::_1, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_2, SQFloat::_3, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_5, SQFloat::_2, SQFloat::_0, SQFloat::_1 };
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(T(VERTEX_A_COMPONENTS), T(VERTEX_B_COMPONENTS), T(VERTEX_C_COMPONENTS));
+
+    const unsigned int RAY_COUNT = 7U;
+    const float_q ORIGIN_COMPONENTS[RAY_COUNT][4] = { { SQFloat::_3, SQFloat::_3, SQFloat::_1, SQFloat::_1 },
+                                                      { SQFloat::_0, SQFloat::_2, SQFloat::_1, SQFloat::_1 },
+                                                      { SQFloat::_9, SQFloat::_9, SQFloat::_9, SQFloat::_1 },
+                                                      { SQFloat::_4, SQFloat::_3, SQFloat::_0, SQFloat::_1 },
+                                                      { SQFloat::_3, -SQFloat::_3, SQFloat::_1, SQFloat::_1 },
+                                                      { SQFloat::_3, SQFloat::_4, SQFloat::_1, SQFloat::_1 },
+                                                      { SQFloat::_1, SQFloat::_1, SQFloat::_1, SQFloat::_1 } };
+    const QVector3 DIRECTIONS[RAY_COUNT] = { QVector3(SQFloat::_1, -SQFloat::_1, SQFloat::_0).Normalize(),
+                                             QVector3(SQFloat::_1, -SQFloat::_1, SQFloat::_0).Normalize(),
+                                             QVector3(SQFloat::_1, SQFloat::_1, SQFloat::_1).Normalize(),
+                                             QVector3(SQFloat::_1, -SQFloat::_1, SQFloat::_0).Normalize(),
+                                             QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0),
+                                             QVector3(SQFloat::_0, -SQFloat::_1, SQFloat::_0),
+                                             QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1) };
+
+    QRay3D<T> arRays[RAY_COUNT];
+    float_q arExpectedDistances[RAY_COUNT];
+    float_q arExpectedU[RAY_COUNT];
+    float_q arExpectedV[RAY_COUNT];
+    unsigned int uExpectedIntersections = 0;
+
+    for(unsigned int i = 0; i < RAY_COUNT; ++i)
+    {
+        arRays[i] = QRay3D<T>(T(ORIGIN_COMPONENTS[i]), DIRECTIONS[i]);
+
+        arExpectedDistances[i] = -SQFloat::_1;
+        arExpectedU[i] = SQFloat::_0;
+        arExpectedV[i] = SQFloat::_0;
+
+        if( arRays[i].Intersection(TRIANGLE, arExpectedDistances[i], arExpectedU[i], arExpectedV[i]) )
+            ++uExpectedIntersections;
+    }
+
+	// [Execution]
+    float_q arDistances[RAY_COUNT];
+    float_q arU[RAY_COUNT];
+    float_q arV[RAY_COUNT];
+    unsigned int uIntersections = QRay3D<T>::Intersection(arRays, RAY_COUNT, TRIANGLE, arDistances, arU, arV);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIntersections, uExpectedIntersections);
+
+    for(unsigned int i = 0; i < RAY_COUNT; ++i)
+    {
+        BOOST_CHECK(SQFloat::AreEqual(arDistances[i], arExpectedDistances[i]));
+        BOOST_CHECK(SQFloat::AreEqual(arU[i], arExpectedU[i]));
+        BOOST_CHECK(SQFloat::AreEqual(arV[i], arExpectedV[i]));
+    }
+}
+
+/// <summary>
+/// Checks that the arrays of barycentric coordinates can be null and that the elements after the last ray are not modified.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection8_BarycentricCoordinatesAreOptionalAndElementsAfterTheLastRayAreNotModified_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const float_q VERTEX_A_COMPONENTS[] = { SQFloat::_0, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_B_COMPONENTS[] = { SQFloat::_4, SQFloat::_0, SQFloat::_0, SQFloat::_1 };
+    const float_q VERTEX_C_COMPONENTS[] = { SQFloat::_0, SQFloat::_4, SQFloat::_0, SQFloat::_1 };
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(T(VERTEX_A_COMPONENTS), T(VERTEX_B_COMPONENTS), T(VERTEX_C_COMPONENTS));
+
+    const float_q ORIGIN_COMPONENTS1[] = { SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_1 };
+    const float_q ORIGIN_COMPONENTS2[] = { SQFloat::_5, SQFloat::_2, SQFloat::_3, SQFloat::_1 };
+    const QVector3 DIRECTION = QVector3(SQFloat::_0, SQFloat::_0, -SQFloat::_1);
+    const QRay3D<T> RAYS[] = { QRay3D<T>(T(ORIGIN_COMPONENTS1), DIRECTION), QRay3D<T>(T(ORIGIN_COMPONENTS2), DIRECTION) };
+    const unsigned int RAY_COUNT = 2U;
+
+    const unsigned int EXPECTED_INTERSECTIONS = 1U;
+    const float_q EXPECTED_DISTANCE1 = SQFloat::_3;
+    const float_q EXPECTED_DISTANCE2 = -SQFloat::_1;
+    const float_q EXPECTED_UNMODIFIED_VALUE = SQFloat::_9;
+
+	// [Execution]
+    float_q arDistances[] = { SQFloat::_0, SQFloat::_0, EXPECTED_UNMODIFIED_VALUE, EXPECTED_UNMODIFIED_VALUE };
+    unsigned int uIntersections = QRay3D<T>::Intersection(RAYS, RAY_COUNT, TRIANGLE, arDistances, null_q, null_q);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIntersections, EXPECTED_INTERSECTIONS);
+    BOOST_CHECK(SQFloat::AreEqual(arDistances[0], EXPECTED_DISTANCE1));
+    BOOST_CHECK_EQUAL(arDistances[1], EXPECTED_DISTANCE2);
+    BOOST_CHECK_EQUAL(arDistances[2], EXPECTED_UNMODIFIED_VALUE);
+    BOOST_CHECK_EQUAL(arDistances[3], EXPECTED_UNMODIFIED_VALUE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the output array of distances is null.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection7_AssertionFailsWhenOutputArrayOfDistancesIsNull_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QSoAPointBuffer;
+
+    // [Preparation]
+    const QRay3D<T> RAY = QRay3D<T>::GetRayZ();
+    const QSoAPointBuffer VERTICES(1U);
+
+    const bool ASSERTION_FAILED = true;
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        RAY.Intersection(VERTICES, VERTICES, VERTICES, null_q, null_q, null_q);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the buffers do not contain the same number of points.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection7_AssertionFailsWhenBuffersHaveDifferentSizes_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QSoAPointBuffer;
+
+    // [Preparation]
+    const QRay3D<T> RAY = QRay3D<T>::GetRayZ();
+    const QSoAPointBuffer VERTICES_A(2U);
+    const QSoAPointBuffer VERTICES_B(1U);
+    const QSoAPointBuffer VERTICES_C(2U);
+
+    const bool ASSERTION_FAILED = true;
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        float_q arDistances[2];
+        RAY.Intersection(VERTICES_A, VERTICES_B, VERTICES_C, arDistances, null_q, null_q);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array of rays is null.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection8_AssertionFailsWhenInputArrayOfRaysIsNull_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(T::GetNullVector(), T::GetNullVector(), T::GetNullVector());
+
+    const bool ASSERTION_FAILED = true;
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        float_q arDistances[1];
+        QRay3D<T>::Intersection(null_q, 1U, TRIANGLE, arDistances, null_q, null_q);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the output array of distances is null.
+/// </summary>
+QTEST_CASE_TEMPLATE ( Intersection8_AssertionFailsWhenOutputArrayOfDistancesIsNull_Test, TQTemplateTypes )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QBaseTriangle;
+
+    // [Preparation]
+    const QBaseTriangle<T> TRIANGLE = QBaseTriangle<T>(T::GetNullVector(), T::GetNullVector(), T::GetNullVector());
+    const QRay3D<T> RAYS[] = { QRay3D<T>::GetRayZ() };
+
+    const bool ASSERTION_FAILED = true;
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QRay3D<T>::Intersection(RAYS, 1U, TRIANGLE, null_q, null_q, null_q);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
 /// <summary>
 /// Checks that it returns no intersection points when rays don't intersect.
 /// </summary>
@@ -0,0 +1,224 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QSoAPointBuffer.h"
+#include "SQFloat.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Tools::Math::QSoAPointBuffer;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseVector3;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+
+QTEST_SUITE_BEGIN( QSoAPointBuffer_TestSuite )
+
+/// <summary>
+/// Checks that the number of points is correctly stored and all the components, including the padding, are initialized to zero.
+/// </summary>
+QTEST_CASE ( Constructor_AllComponentsAreInitializedToZero_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_COUNT = 6U;
+    const float_q EXPECTED_VALUE = SQFloat::_0;
+
+	// [Execution]
+    QSoAPointBuffer points(EXPECTED_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(points.GetCount(), EXPECTED_COUNT);
+
+    for(unsigned int i = 0; i < points.GetStreamLength(); ++i)
+    {
+        BOOST_CHECK_EQUAL(points.GetX()[i], EXPECTED_VALUE);
+        BOOST_CHECK_EQUAL(points.GetY()[i], EXPECTED_VALUE);
+        BOOST_CHECK_EQUAL(points.GetZ()[i], EXPECTED_VALUE);
+    }
+}
+
+/// <summary>
+/// Checks that the length of the streams is rounded up to a multiple of the block size.
+/// </summary>
+QTEST_CASE ( Constructor_StreamLengthIsRoundedUpToMultipleOfBlockSize_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_LENGTH_FOR_1 = 4U;
+    const unsigned int EXPECTED_LENGTH_FOR_4 = 4U;
+    const unsigned int EXPECTED_LENGTH_FOR_5 = 8U;
+
+	// [Execution]
+    QSoAPointBuffer points1(1U);
+    QSoAPointBuffer points4(4U);
+    QSoAPointBuffer points5(5U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(points1.GetStreamLength(), EXPECTED_LENGTH_FOR_1);
+    BOOST_CHECK_EQUAL(points4.GetStreamLength(), EXPECTED_LENGTH_FOR_4);
+    BOOST_CHECK_EQUAL(points5.GetStreamLength(), EXPECTED_LENGTH_FOR_5);
+}
+
+/// <summary>
+/// Checks that an empty buffer can be created and it reserves one block anyway.
+/// </summary>
+QTEST_CASE ( Constructor_EmptyBufferReservesOneBlock_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_COUNT = 0;
+    const unsigned int EXPECTED_LENGTH = QSoAPointBuffer::POINTS_PER_BLOCK;
+
+	// [Execution]
+    QSoAPointBuffer points(0);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(points.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(points.GetStreamLength(), EXPECTED_LENGTH);
+}
+
+/// <summary>
+/// Checks that the three streams are aligned to the expected boundary and do not overlap.
+/// </summary>
+QTEST_CASE ( Constructor_StreamsAreAlignedAndDoNotOverlap_Test )
+{
+    // [Preparation]
+    const pointer_uint_q ALIGNMENT = QSoAPointBuffer::STREAM_ALIGNMENT;
+    const pointer_uint_q EXPECTED_REMAINDER = 0;
+
+	// [Execution]
+    QSoAPointBuffer points(7U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(rcast_q(points.GetX(), pointer_uint_q) % ALIGNMENT, EXPECTED_REMAINDER);
+    BOOST_CHECK_EQUAL(rcast_q(points.GetY(), pointer_uint_q) % ALIGNMENT, EXPECTED_REMAINDER);
+    BOOST_CHECK_EQUAL(rcast_q(points.GetZ(), pointer_uint_q) % ALIGNMENT, EXPECTED_REMAINDER);
+    BOOST_CHECK(points.GetX() + points.GetStreamLength() <= points.GetY());
+    BOOST_CHECK(points.GetY() + points.GetStreamLength() <= points.GetZ());
+}
+
+/// <summary>
+/// Checks that a point is stored in the three streams and can be retrieved.
+/// </summary>
+QTEST_CASE ( SetPoint_PointIsCorrectlyStoredInTheStreams_Test )
+{
+    // [Preparation]
+    const unsigned int INDEX = 5U;
+    const QVector3 EXPECTED_POINT(SQFloat::_1, -SQFloat::_2, SQFloat::_3);
+    QSoAPointBuffer points(6U);
+
+	// [Execution]
+    points.SetPoint(INDEX, EXPECTED_POINT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(points.GetX()[INDEX], EXPECTED_POINT.x);
+    BOOST_CHECK_EQUAL(points.GetY()[INDEX], EXPECTED_POINT.y);
+    BOOST_CHECK_EQUAL(points.GetZ()[INDEX], EXPECTED_POINT.z);
+    BOOST_CHECK(points.GetPoint(INDEX) == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that the point is built from the three streams.
+/// </summary>
+QTEST_CASE ( GetPoint_PointIsBuiltFromTheStreams_Test )
+{
+    // [Preparation]
+    const unsigned int INDEX = 2U;
+    const QVector3 EXPECTED_POINT(SQFloat::_4, SQFloat::_5, -SQFloat::_6);
+    QSoAPointBuffer points(3U);
+    points.GetX()[INDEX] = EXPECTED_POINT.x;
+    points.GetY()[INDEX] = EXPECTED_POINT.y;
+    points.GetZ()[INDEX] = EXPECTED_POINT.z;
+
+	// [Execution]
+    QVector3 vPoint = points.GetPoint(INDEX);
+
+    // [Verification]
+    BOOST_CHECK(vPoint == EXPECTED_POINT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the index is out of bounds.
+/// </summary>
+QTEST_CASE ( GetPoint_AssertionFailsWhenIndexIsOutOfBounds_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QSoAPointBuffer points(3U);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        points.GetPoint(3U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the index is out of bounds.
+/// </summary>
+QTEST_CASE ( SetPoint_AssertionFailsWhenIndexIsOutOfBounds_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QSoAPointBuffer points(3U);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        points.SetPoint(3U, QBaseVector3());
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+// End - Test Suite: QSoAPointBuffer
+QTEST_SUITE_END()
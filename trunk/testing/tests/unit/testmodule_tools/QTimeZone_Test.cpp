@@ -127,6 +127,69 @@ QTEST_CASE ( CalculateOffset_ReturnsExpectedOffsetWhenDstIsNotActive_Test )
     BOOST_CHECK_EQUAL(bOffsetIsNegative, EXPECTED_OFFSET_SIGN);
 }
 
+/// <summary>
+/// Checks that the DST stops being applied at the end of the DST period.
+/// </summary>
+QTEST_CASE ( CalculateOffset_DstIsNotAppliedFromTheEndOfTheDstPeriod_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Time::SQTimeZoneFactory;
+    using Kinesis::QuimeraEngine::Tools::Time::QDateTime;
+
+    // [Preparation]
+    const string_q COMMON_TIMEZONE_ID = QE_L("Europe/Madrid");
+    const QTimeZone* TIME_ZONE = SQTimeZoneFactory::GetTimeZoneById(COMMON_TIMEZONE_ID);
+    const QDateTime DST_END_TIME = TIME_ZONE->GetDstInfo().GetEndInYear(2050);
+    const QDateTime BEFORE_DST_END_TIME = DST_END_TIME - QTimeSpan(1);
+    const QTimeSpan EXPECTED_OFFSET_AT_END = QTimeSpan(36000000000); // +1 hour
+    const QTimeSpan EXPECTED_OFFSET_BEFORE_END = QTimeSpan(72000000000); // +2 hours
+    const bool EXPECTED_OFFSET_SIGN = false;
+
+    // [Execution]
+    QTimeSpan offsetAtEnd(0);
+    bool bOffsetAtEndIsNegative = true;
+    TIME_ZONE->CalculateOffset(DST_END_TIME, offsetAtEnd, bOffsetAtEndIsNegative);
+    QTimeSpan offsetBeforeEnd(0);
+    bool bOffsetBeforeEndIsNegative = true;
+    TIME_ZONE->CalculateOffset(BEFORE_DST_END_TIME, offsetBeforeEnd, bOffsetBeforeEndIsNegative);
+
+    // [Verification]
+    BOOST_CHECK(offsetAtEnd == EXPECTED_OFFSET_AT_END);
+    BOOST_CHECK_EQUAL(bOffsetAtEndIsNegative, EXPECTED_OFFSET_SIGN);
+    BOOST_CHECK(offsetBeforeEnd == EXPECTED_OFFSET_BEFORE_END);
+    BOOST_CHECK_EQUAL(bOffsetBeforeEndIsNegative, EXPECTED_OFFSET_SIGN);
+}
+
+/// <summary>
+/// Checks that the DST is applied in the same way to the years whose DST period is calculated when the time zone is created and to the years after them.
+/// </summary>
+QTEST_CASE ( CalculateOffset_DstIsAppliedBothInsideAndOutsideOfPrecalculatedYears_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Time::SQTimeZoneFactory;
+    using Kinesis::QuimeraEngine::Tools::Time::QDateTime;
+
+    // [Preparation]
+    const string_q COMMON_TIMEZONE_ID = QE_L("Europe/Madrid");
+    const QTimeZone* TIME_ZONE = SQTimeZoneFactory::GetTimeZoneById(COMMON_TIMEZONE_ID);
+    const QDateTime DST_START_TIME_INSIDE = TIME_ZONE->GetDstInfo().GetStartInYear(2100);
+    const QDateTime DST_START_TIME_OUTSIDE = TIME_ZONE->GetDstInfo().GetStartInYear(2101);
+    const QTimeSpan EXPECTED_OFFSET = QTimeSpan(72000000000); // +2 hours
+    const bool EXPECTED_OFFSET_SIGN = false;
+
+    // [Execution]
+    QTimeSpan offsetInside(0);
+    bool bOffsetInsideIsNegative = true;
+    TIME_ZONE->CalculateOffset(DST_START_TIME_INSIDE, offsetInside, bOffsetInsideIsNegative);
+    QTimeSpan offsetOutside(0);
+    bool bOffsetOutsideIsNegative = true;
+    TIME_ZONE->CalculateOffset(DST_START_TIME_OUTSIDE, offsetOutside, bOffsetOutsideIsNegative);
+
+    // [Verification]
+    BOOST_CHECK(offsetInside == EXPECTED_OFFSET);
+    BOOST_CHECK_EQUAL(bOffsetInsideIsNegative, EXPECTED_OFFSET_SIGN);
+    BOOST_CHECK(offsetOutside == EXPECTED_OFFSET);
+    BOOST_CHECK_EQUAL(bOffsetOutsideIsNegative, EXPECTED_OFFSET_SIGN);
+}
+
 /// <summary>
 /// Checks that the DST is not applied when the date is prior to 1916.
 /// </summary>
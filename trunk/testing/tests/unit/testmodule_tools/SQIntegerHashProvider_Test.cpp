@@ -75,6 +75,22 @@ QTEST_CASE ( GenerateHashKey_ItReturnsExpectedValueWhenUsingCommonInputValues_Te
     BOOST_CHECK_EQUAL(uHashKey, EXPECTED_VALUE);
 }
 
+/// <summary>
+/// Checks that the input value is returned, no matter how big it is.
+/// </summary>
+QTEST_CASE ( GenerateHash_ItReturnsInputValue_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_VALUE = scast_q(-2, pointer_uint_q);
+    const pointer_uint_q EXPECTED_VALUE = INPUT_VALUE;
+
+    // [Execution]
+    pointer_uint_q uHash = SQIntegerHashProvider::GenerateHash(INPUT_VALUE);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash, EXPECTED_VALUE);
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
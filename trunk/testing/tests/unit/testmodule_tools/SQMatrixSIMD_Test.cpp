@@ -0,0 +1,785 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQMatrixSIMD.h"
+
+#ifdef QE_MATH_VECTORIZATION_ENABLED
+
+#include "QBaseMatrix4x4.h"
+#include "QBaseMatrix4x3.h"
+#include "SQFloat.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseMatrix4x4;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseMatrix4x3;
+using Kinesis::QuimeraEngine::Tools::Math::SQMatrixSIMD;
+
+
+QTEST_SUITE_BEGIN( SQMatrixSIMD_TestSuite )
+
+/// <summary>
+/// Checks that two 4x4 matrices are correctly multiplied.
+/// </summary>
+QTEST_CASE ( Multiply1_ProductIsCalculatedFollowingMatrixProductRules_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 LEFT_MATRIX(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4,
+                                     SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8,
+                                     SQFloat::_9, SQFloat::_10, (float_q)11.0, (float_q)12.0,
+                                     (float_q)13.0, (float_q)14.0, (float_q)15.0, (float_q)16.0);
+
+    const QBaseMatrix4x4 RIGHT_MATRIX(SQFloat::_2, -SQFloat::_1, SQFloat::_1, SQFloat::_3,
+                                      SQFloat::_1, SQFloat::_4, -SQFloat::_2, SQFloat::_0,
+                                      SQFloat::_0, SQFloat::_5, SQFloat::_1, SQFloat::_2,
+                                      SQFloat::_3, SQFloat::_1, SQFloat::_0, -SQFloat::_6);
+
+    const QBaseMatrix4x4 EXPECTED_VALUE((float_q)16.0, (float_q)26.0, SQFloat::_0, (float_q)-15.0,
+                                        (float_q)40.0, (float_q)62.0, SQFloat::_0, (float_q)-19.0,
+                                        (float_q)64.0, (float_q)98.0, SQFloat::_0, (float_q)-23.0,
+                                        (float_q)88.0, (float_q)134.0, SQFloat::_0, (float_q)-27.0);
+
+    QBaseMatrix4x4 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::Multiply(LEFT_MATRIX, RIGHT_MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]);
+}
+
+/// <summary>
+/// Checks that the result is correct when the output matrix is the left operand.
+/// </summary>
+QTEST_CASE ( Multiply1_OutputCanBeTheLeftOperand_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 RIGHT_MATRIX(SQFloat::_2, -SQFloat::_1, SQFloat::_1, SQFloat::_3,
+                                      SQFloat::_1, SQFloat::_4, -SQFloat::_2, SQFloat::_0,
+                                      SQFloat::_0, SQFloat::_5, SQFloat::_1, SQFloat::_2,
+                                      SQFloat::_3, SQFloat::_1, SQFloat::_0, -SQFloat::_6);
+
+    const QBaseMatrix4x4 EXPECTED_VALUE((float_q)16.0, (float_q)26.0, SQFloat::_0, (float_q)-15.0,
+                                        (float_q)40.0, (float_q)62.0, SQFloat::_0, (float_q)-19.0,
+                                        (float_q)64.0, (float_q)98.0, SQFloat::_0, (float_q)-23.0,
+                                        (float_q)88.0, (float_q)134.0, SQFloat::_0, (float_q)-27.0);
+
+    QBaseMatrix4x4 matrixUT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4,
+                            SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8,
+                            SQFloat::_9, SQFloat::_10, (float_q)11.0, (float_q)12.0,
+                            (float_q)13.0, (float_q)14.0, (float_q)15.0, (float_q)16.0);
+
+    // [Execution]
+    SQMatrixSIMD::Multiply(matrixUT, RIGHT_MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]);
+}
+
+/// <summary>
+/// Checks that the result is correct when the output matrix is the right operand.
+/// </summary>
+QTEST_CASE ( Multiply1_OutputCanBeTheRightOperand_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 LEFT_MATRIX(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4,
+                                     SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8,
+                                     SQFloat::_9, SQFloat::_10, (float_q)11.0, (float_q)12.0,
+                                     (float_q)13.0, (float_q)14.0, (float_q)15.0, (float_q)16.0);
+
+    const QBaseMatrix4x4 EXPECTED_VALUE((float_q)16.0, (float_q)26.0, SQFloat::_0, (float_q)-15.0,
+                                        (float_q)40.0, (float_q)62.0, SQFloat::_0, (float_q)-19.0,
+                                        (float_q)64.0, (float_q)98.0, SQFloat::_0, (float_q)-23.0,
+                                        (float_q)88.0, (float_q)134.0, SQFloat::_0, (float_q)-27.0);
+
+    QBaseMatrix4x4 matrixUT(SQFloat::_2, -SQFloat::_1, SQFloat::_1, SQFloat::_3,
+                            SQFloat::_1, SQFloat::_4, -SQFloat::_2, SQFloat::_0,
+                            SQFloat::_0, SQFloat::_5, SQFloat::_1, SQFloat::_2,
+                            SQFloat::_3, SQFloat::_1, SQFloat::_0, -SQFloat::_6);
+
+    // [Execution]
+    SQMatrixSIMD::Multiply(LEFT_MATRIX, matrixUT, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]);
+}
+
+/// <summary>
+/// Checks that a 4x4 matrix and a 4x3 matrix are correctly multiplied.
+/// </summary>
+QTEST_CASE ( Multiply2_ProductIsCalculatedFollowingMatrixProductRules_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 LEFT_MATRIX(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4,
+                                     SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8,
+                                     SQFloat::_9, SQFloat::_10, (float_q)11.0, (float_q)12.0,
+                                     (float_q)13.0, (float_q)14.0, (float_q)15.0, (float_q)16.0);
+
+    const QBaseMatrix4x3 RIGHT_MATRIX(SQFloat::_2, -SQFloat::_1, SQFloat::_1,
+                                      SQFloat::_1, SQFloat::_4, -SQFloat::_2,
+                                      SQFloat::_0, SQFloat::_5, SQFloat::_1,
+                                      SQFloat::_3, SQFloat::_1, SQFloat::_0);
+
+    const QBaseMatrix4x3 EXPECTED_VALUE((float_q)16.0, (float_q)26.0, SQFloat::_0,
+                                        (float_q)40.0, (float_q)62.0, SQFloat::_0,
+                                        (float_q)64.0, (float_q)98.0, SQFloat::_0,
+                                        (float_q)88.0, (float_q)134.0, SQFloat::_0);
+
+    QBaseMatrix4x3 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::Multiply(LEFT_MATRIX, RIGHT_MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+}
+
+/// <summary>
+/// Checks that the result is correct when the output matrix is the right operand.
+/// </summary>
+QTEST_CASE ( Multiply2_OutputCanBeTheRightOperand_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 LEFT_MATRIX(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4,
+                                     SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8,
+                                     SQFloat::_9, SQFloat::_10, (float_q)11.0, (float_q)12.0,
+                                     (float_q)13.0, (float_q)14.0, (float_q)15.0, (float_q)16.0);
+
+    const QBaseMatrix4x3 EXPECTED_VALUE((float_q)16.0, (float_q)26.0, SQFloat::_0,
+                                        (float_q)40.0, (float_q)62.0, SQFloat::_0,
+                                        (float_q)64.0, (float_q)98.0, SQFloat::_0,
+                                        (float_q)88.0, (float_q)134.0, SQFloat::_0);
+
+    QBaseMatrix4x3 matrixUT(SQFloat::_2, -SQFloat::_1, SQFloat::_1,
+                            SQFloat::_1, SQFloat::_4, -SQFloat::_2,
+                            SQFloat::_0, SQFloat::_5, SQFloat::_1,
+                            SQFloat::_3, SQFloat::_1, SQFloat::_0);
+
+    // [Execution]
+    SQMatrixSIMD::Multiply(LEFT_MATRIX, matrixUT, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+}
+
+/// <summary>
+/// Checks that two 4x4 transformation matrices are correctly multiplied and the fourth column is copied from the left matrix.
+/// </summary>
+QTEST_CASE ( MultiplyTransformations1_ProductIsCalculatedAssumingFourthColumnIsZeroZeroZeroOne_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 LEFT_MATRIX(SQFloat::_2, SQFloat::_1, SQFloat::_0, SQFloat::_0,
+                                     SQFloat::_0, SQFloat::_1, SQFloat::_3, SQFloat::_0,
+                                     SQFloat::_1, SQFloat::_0, SQFloat::_1, SQFloat::_0,
+                                     SQFloat::_4, SQFloat::_5, SQFloat::_6, SQFloat::_1);
+
+    const QBaseMatrix4x4 RIGHT_MATRIX(SQFloat::_1, SQFloat::_0, SQFloat::_2, SQFloat::_0,
+                                      SQFloat::_0, SQFloat::_2, SQFloat::_0, SQFloat::_0,
+                                      SQFloat::_3, SQFloat::_0, SQFloat::_1, SQFloat::_0,
+                                      -SQFloat::_1, SQFloat::_2, -SQFloat::_3, SQFloat::_1);
+
+    const QBaseMatrix4x4 EXPECTED_VALUE(SQFloat::_2, SQFloat::_2, SQFloat::_4, SQFloat::_0,
+                                        SQFloat::_9, SQFloat::_2, SQFloat::_3, SQFloat::_0,
+                                        SQFloat::_4, SQFloat::_0, SQFloat::_3, SQFloat::_0,
+                                        (float_q)21.0, (float_q)12.0, (float_q)11.0, SQFloat::_1);
+
+    QBaseMatrix4x4 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::MultiplyTransformations(LEFT_MATRIX, RIGHT_MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]);
+}
+
+/// <summary>
+/// Checks that the result is correct when the output matrix is the left operand.
+/// </summary>
+QTEST_CASE ( MultiplyTransformations1_OutputCanBeTheLeftOperand_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 RIGHT_MATRIX(SQFloat::_1, SQFloat::_0, SQFloat::_2, SQFloat::_0,
+                                      SQFloat::_0, SQFloat::_2, SQFloat::_0, SQFloat::_0,
+                                      SQFloat::_3, SQFloat::_0, SQFloat::_1, SQFloat::_0,
+                                      -SQFloat::_1, SQFloat::_2, -SQFloat::_3, SQFloat::_1);
+
+    const QBaseMatrix4x4 EXPECTED_VALUE(SQFloat::_2, SQFloat::_2, SQFloat::_4, SQFloat::_0,
+                                        SQFloat::_9, SQFloat::_2, SQFloat::_3, SQFloat::_0,
+                                        SQFloat::_4, SQFloat::_0, SQFloat::_3, SQFloat::_0,
+                                        (float_q)21.0, (float_q)12.0, (float_q)11.0, SQFloat::_1);
+
+    QBaseMatrix4x4 matrixUT(SQFloat::_2, SQFloat::_1, SQFloat::_0, SQFloat::_0,
+                            SQFloat::_0, SQFloat::_1, SQFloat::_3, SQFloat::_0,
+                            SQFloat::_1, SQFloat::_0, SQFloat::_1, SQFloat::_0,
+                            SQFloat::_4, SQFloat::_5, SQFloat::_6, SQFloat::_1);
+
+    // [Execution]
+    SQMatrixSIMD::MultiplyTransformations(matrixUT, RIGHT_MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]);
+}
+
+/// <summary>
+/// Checks that a 4x4 transformation matrix and a 4x3 one are correctly multiplied and the fourth column is copied from the left matrix.
+/// </summary>
+QTEST_CASE ( MultiplyTransformations2_ProductIsCalculatedAssumingFourthColumnIsZeroZeroZeroOne_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 LEFT_MATRIX(SQFloat::_2, SQFloat::_1, SQFloat::_0, SQFloat::_0,
+                                     SQFloat::_0, SQFloat::_1, SQFloat::_3, SQFloat::_0,
+                                     SQFloat::_1, SQFloat::_0, SQFloat::_1, SQFloat::_0,
+                                     SQFloat::_4, SQFloat::_5, SQFloat::_6, SQFloat::_1);
+
+    const QBaseMatrix4x3 RIGHT_MATRIX(SQFloat::_1, SQFloat::_0, SQFloat::_2,
+                                      SQFloat::_0, SQFloat::_2, SQFloat::_0,
+                                      SQFloat::_3, SQFloat::_0, SQFloat::_1,
+                                      -SQFloat::_1, SQFloat::_2, -SQFloat::_3);
+
+    const QBaseMatrix4x4 EXPECTED_VALUE(SQFloat::_2, SQFloat::_2, SQFloat::_4, SQFloat::_0,
+                                        SQFloat::_9, SQFloat::_2, SQFloat::_3, SQFloat::_0,
+                                        SQFloat::_4, SQFloat::_0, SQFloat::_3, SQFloat::_0,
+                                        (float_q)21.0, (float_q)12.0, (float_q)11.0, SQFloat::_1);
+
+    QBaseMatrix4x4 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::MultiplyTransformations(LEFT_MATRIX, RIGHT_MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]);
+}
+
+/// <summary>
+/// Checks that a 4x3 transformation matrix and a 4x4 one are correctly multiplied.
+/// </summary>
+QTEST_CASE ( MultiplyTransformations3_ProductIsCalculatedAssumingFourthColumnIsZeroZeroZeroOne_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x3 LEFT_MATRIX(SQFloat::_2, SQFloat::_1, SQFloat::_0,
+                                     SQFloat::_0, SQFloat::_1, SQFloat::_3,
+                                     SQFloat::_1, SQFloat::_0, SQFloat::_1,
+                                     SQFloat::_4, SQFloat::_5, SQFloat::_6);
+
+    const QBaseMatrix4x4 RIGHT_MATRIX(SQFloat::_1, SQFloat::_0, SQFloat::_2, SQFloat::_0,
+                                      SQFloat::_0, SQFloat::_2, SQFloat::_0, SQFloat::_0,
+                                      SQFloat::_3, SQFloat::_0, SQFloat::_1, SQFloat::_0,
+                                      -SQFloat::_1, SQFloat::_2, -SQFloat::_3, SQFloat::_1);
+
+    const QBaseMatrix4x3 EXPECTED_VALUE(SQFloat::_2, SQFloat::_2, SQFloat::_4,
+                                        SQFloat::_9, SQFloat::_2, SQFloat::_3,
+                                        SQFloat::_4, SQFloat::_0, SQFloat::_3,
+                                        (float_q)21.0, (float_q)12.0, (float_q)11.0);
+
+    QBaseMatrix4x3 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::MultiplyTransformations(LEFT_MATRIX, RIGHT_MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+}
+
+/// <summary>
+/// Checks that two 4x3 transformation matrices are correctly multiplied.
+/// </summary>
+QTEST_CASE ( MultiplyTransformations4_ProductIsCalculatedAssumingFourthColumnIsZeroZeroZeroOne_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x3 LEFT_MATRIX(SQFloat::_2, SQFloat::_1, SQFloat::_0,
+                                     SQFloat::_0, SQFloat::_1, SQFloat::_3,
+                                     SQFloat::_1, SQFloat::_0, SQFloat::_1,
+                                     SQFloat::_4, SQFloat::_5, SQFloat::_6);
+
+    const QBaseMatrix4x3 RIGHT_MATRIX(SQFloat::_1, SQFloat::_0, SQFloat::_2,
+                                      SQFloat::_0, SQFloat::_2, SQFloat::_0,
+                                      SQFloat::_3, SQFloat::_0, SQFloat::_1,
+                                      -SQFloat::_1, SQFloat::_2, -SQFloat::_3);
+
+    const QBaseMatrix4x3 EXPECTED_VALUE(SQFloat::_2, SQFloat::_2, SQFloat::_4,
+                                        SQFloat::_9, SQFloat::_2, SQFloat::_3,
+                                        SQFloat::_4, SQFloat::_0, SQFloat::_3,
+                                        (float_q)21.0, (float_q)12.0, (float_q)11.0);
+
+    QBaseMatrix4x3 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::MultiplyTransformations(LEFT_MATRIX, RIGHT_MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+}
+
+/// <summary>
+/// Checks that the result is correct when the output matrix is the left operand.
+/// </summary>
+QTEST_CASE ( MultiplyTransformations4_OutputCanBeTheLeftOperand_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x3 RIGHT_MATRIX(SQFloat::_1, SQFloat::_0, SQFloat::_2,
+                                      SQFloat::_0, SQFloat::_2, SQFloat::_0,
+                                      SQFloat::_3, SQFloat::_0, SQFloat::_1,
+                                      -SQFloat::_1, SQFloat::_2, -SQFloat::_3);
+
+    const QBaseMatrix4x3 EXPECTED_VALUE(SQFloat::_2, SQFloat::_2, SQFloat::_4,
+                                        SQFloat::_9, SQFloat::_2, SQFloat::_3,
+                                        SQFloat::_4, SQFloat::_0, SQFloat::_3,
+                                        (float_q)21.0, (float_q)12.0, (float_q)11.0);
+
+    QBaseMatrix4x3 matrixUT(SQFloat::_2, SQFloat::_1, SQFloat::_0,
+                            SQFloat::_0, SQFloat::_1, SQFloat::_3,
+                            SQFloat::_1, SQFloat::_0, SQFloat::_1,
+                            SQFloat::_4, SQFloat::_5, SQFloat::_6);
+
+    // [Execution]
+    SQMatrixSIMD::MultiplyTransformations(matrixUT, RIGHT_MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+}
+
+/// <summary>
+/// Checks that rows and columns are swapped.
+/// </summary>
+QTEST_CASE ( Transpose_RowsAndColumnsAreSwapped_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 MATRIX(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4,
+                                SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8,
+                                SQFloat::_9, SQFloat::_10, (float_q)11.0, (float_q)12.0,
+                                (float_q)13.0, (float_q)14.0, (float_q)15.0, (float_q)16.0);
+
+    const QBaseMatrix4x4 EXPECTED_VALUE(SQFloat::_1, SQFloat::_5, SQFloat::_9, (float_q)13.0,
+                                        SQFloat::_2, SQFloat::_6, SQFloat::_10, (float_q)14.0,
+                                        SQFloat::_3, SQFloat::_7, (float_q)11.0, (float_q)15.0,
+                                        SQFloat::_4, SQFloat::_8, (float_q)12.0, (float_q)16.0);
+
+    QBaseMatrix4x4 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::Transpose(MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]);
+}
+
+/// <summary>
+/// Checks that the result is correct when the output matrix is the input matrix.
+/// </summary>
+QTEST_CASE ( Transpose_OutputCanBeTheInputMatrix_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 EXPECTED_VALUE(SQFloat::_1, SQFloat::_5, SQFloat::_9, (float_q)13.0,
+                                        SQFloat::_2, SQFloat::_6, SQFloat::_10, (float_q)14.0,
+                                        SQFloat::_3, SQFloat::_7, (float_q)11.0, (float_q)15.0,
+                                        SQFloat::_4, SQFloat::_8, (float_q)12.0, (float_q)16.0);
+
+    QBaseMatrix4x4 matrixUT(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4,
+                            SQFloat::_5, SQFloat::_6, SQFloat::_7, SQFloat::_8,
+                            SQFloat::_9, SQFloat::_10, (float_q)11.0, (float_q)12.0,
+                            (float_q)13.0, (float_q)14.0, (float_q)15.0, (float_q)16.0);
+
+    // [Execution]
+    SQMatrixSIMD::Transpose(matrixUT, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]);
+    BOOST_CHECK_EQUAL(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]);
+}
+
+/// <summary>
+/// Checks that the inverse of a 4x4 matrix is correctly calculated.
+/// </summary>
+QTEST_CASE ( Invert_InverseIsCorrectlyCalculated_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 MATRIX(SQFloat::_2, SQFloat::_0, SQFloat::_1, SQFloat::_0,
+                                SQFloat::_1, SQFloat::_1, SQFloat::_0, SQFloat::_2,
+                                SQFloat::_0, SQFloat::_3, SQFloat::_1, SQFloat::_1,
+                                SQFloat::_1, SQFloat::_0, SQFloat::_2, SQFloat::_1);
+
+    const QBaseMatrix4x4 EXPECTED_VALUE((float_q)0.55, (float_q)0.15, (float_q)-0.05, -SQFloat::_0_25,
+                                        (float_q)0.15, (float_q)-0.05, (float_q)0.35, -SQFloat::_0_25,
+                                        (float_q)-0.1, (float_q)-0.3, (float_q)0.1, SQFloat::_0_5,
+                                        (float_q)-0.35, (float_q)0.45, (float_q)-0.15, SQFloat::_0_25);
+
+    QBaseMatrix4x4 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::Invert(MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]) );
+}
+
+/// <summary>
+/// Checks that the result is correct when the output matrix is the input matrix.
+/// </summary>
+QTEST_CASE ( Invert_OutputCanBeTheInputMatrix_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 EXPECTED_VALUE((float_q)0.55, (float_q)0.15, (float_q)-0.05, -SQFloat::_0_25,
+                                        (float_q)0.15, (float_q)-0.05, (float_q)0.35, -SQFloat::_0_25,
+                                        (float_q)-0.1, (float_q)-0.3, (float_q)0.1, SQFloat::_0_5,
+                                        (float_q)-0.35, (float_q)0.45, (float_q)-0.15, SQFloat::_0_25);
+
+    QBaseMatrix4x4 matrixUT(SQFloat::_2, SQFloat::_0, SQFloat::_1, SQFloat::_0,
+                            SQFloat::_1, SQFloat::_1, SQFloat::_0, SQFloat::_2,
+                            SQFloat::_0, SQFloat::_3, SQFloat::_1, SQFloat::_1,
+                            SQFloat::_1, SQFloat::_0, SQFloat::_2, SQFloat::_1);
+
+    // [Execution]
+    SQMatrixSIMD::Invert(matrixUT, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]) );
+}
+
+/// <summary>
+/// Checks that the inverse of a 4x4 transformation matrix is correctly calculated and the fourth column is copied from the input matrix.
+/// </summary>
+QTEST_CASE ( InvertTransformation1_InverseIsCorrectlyCalculatedAndFourthColumnIsCopied_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x4 MATRIX(SQFloat::_2, SQFloat::_1, SQFloat::_0, SQFloat::_0,
+                                SQFloat::_0, SQFloat::_1, SQFloat::_3, SQFloat::_0,
+                                SQFloat::_1, SQFloat::_0, SQFloat::_1, SQFloat::_0,
+                                SQFloat::_4, SQFloat::_5, SQFloat::_6, SQFloat::_1);
+
+    const QBaseMatrix4x4 EXPECTED_VALUE((float_q)0.2, (float_q)-0.2, (float_q)0.6, SQFloat::_0,
+                                        (float_q)0.6, (float_q)0.4, (float_q)-1.2, SQFloat::_0,
+                                        (float_q)-0.2, (float_q)0.2, (float_q)0.4, SQFloat::_0,
+                                        (float_q)-2.6, (float_q)-2.4, (float_q)1.2, SQFloat::_1);
+
+    QBaseMatrix4x4 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::InvertTransformation(MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][3], EXPECTED_VALUE.ij[0][3]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][3], EXPECTED_VALUE.ij[1][3]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][3], EXPECTED_VALUE.ij[2][3]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][3], EXPECTED_VALUE.ij[3][3]) );
+}
+
+/// <summary>
+/// Checks that the inverse of a 4x3 transformation matrix is correctly calculated.
+/// </summary>
+QTEST_CASE ( InvertTransformation2_InverseIsCorrectlyCalculated_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x3 MATRIX(SQFloat::_2, SQFloat::_1, SQFloat::_0,
+                                SQFloat::_0, SQFloat::_1, SQFloat::_3,
+                                SQFloat::_1, SQFloat::_0, SQFloat::_1,
+                                SQFloat::_4, SQFloat::_5, SQFloat::_6);
+
+    const QBaseMatrix4x3 EXPECTED_VALUE((float_q)0.2, (float_q)-0.2, (float_q)0.6,
+                                        (float_q)0.6, (float_q)0.4, (float_q)-1.2,
+                                        (float_q)-0.2, (float_q)0.2, (float_q)0.4,
+                                        (float_q)-2.6, (float_q)-2.4, (float_q)1.2);
+
+    QBaseMatrix4x3 matrixUT;
+
+    // [Execution]
+    SQMatrixSIMD::InvertTransformation(MATRIX, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]) );
+}
+
+/// <summary>
+/// Checks that the result is correct when the output matrix is the input matrix.
+/// </summary>
+QTEST_CASE ( InvertTransformation2_OutputCanBeTheInputMatrix_Test )
+{
+    // [Preparation]
+    const QBaseMatrix4x3 EXPECTED_VALUE((float_q)0.2, (float_q)-0.2, (float_q)0.6,
+                                        (float_q)0.6, (float_q)0.4, (float_q)-1.2,
+                                        (float_q)-0.2, (float_q)0.2, (float_q)0.4,
+                                        (float_q)-2.6, (float_q)-2.4, (float_q)1.2);
+
+    QBaseMatrix4x3 matrixUT(SQFloat::_2, SQFloat::_1, SQFloat::_0,
+                            SQFloat::_0, SQFloat::_1, SQFloat::_3,
+                            SQFloat::_1, SQFloat::_0, SQFloat::_1,
+                            SQFloat::_4, SQFloat::_5, SQFloat::_6);
+
+    // [Execution]
+    SQMatrixSIMD::InvertTransformation(matrixUT, matrixUT);
+
+    // [Verification]
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][0], EXPECTED_VALUE.ij[0][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][1], EXPECTED_VALUE.ij[0][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[0][2], EXPECTED_VALUE.ij[0][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][0], EXPECTED_VALUE.ij[1][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][1], EXPECTED_VALUE.ij[1][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[1][2], EXPECTED_VALUE.ij[1][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][0], EXPECTED_VALUE.ij[2][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][1], EXPECTED_VALUE.ij[2][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[2][2], EXPECTED_VALUE.ij[2][2]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][0], EXPECTED_VALUE.ij[3][0]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][1], EXPECTED_VALUE.ij[3][1]) );
+    BOOST_CHECK( SQFloat::AreEqual(matrixUT.ij[3][2], EXPECTED_VALUE.ij[3][2]) );
+}
+
+// End - Test Suite: SQMatrixSIMD
+QTEST_SUITE_END()
+
+#endif // QE_MATH_VECTORIZATION_ENABLED
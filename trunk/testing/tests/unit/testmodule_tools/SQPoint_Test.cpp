@@ -46,6 +46,7 @@ using namespace boost::unit_test;
 #include "QQuaternion.h"
 #include "QSpaceConversionMatrix.h"
 #include "QAssertException.h"
+#include "QSoAPointBuffer.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
@@ -57,6 +58,7 @@ using Kinesis::QuimeraEngine::Tools::Math::QBaseVector3;
 using Kinesis::QuimeraEngine::Tools::Math::QVector3;
 using Kinesis::QuimeraEngine::Tools::Math::QBaseVector4;
 using Kinesis::QuimeraEngine::Tools::Math::QVector4;
+using Kinesis::QuimeraEngine::Tools::Math::QSoAPointBuffer;
 
 
 QTEST_SUITE_BEGIN( SQPoint_TestSuite )
@@ -6695,5 +6697,1082 @@ QTEST_CASE ( TransformWithPivot5_WComponentOfPivotDoesNotMatter_Test )
     BOOST_CHECK(arInputPoints1[0] == arInputPoints2[0]);
 }
 
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Translate11_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    // [Preparation]
+    const QBaseVector3 TRANSLATION(SQFloat::_1, -SQFloat::_2, SQFloat::_3);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Translate(TRANSLATION, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Translate12_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    // [Preparation]
+    const float_q TRANSLATION_X = SQFloat::_1;
+    const float_q TRANSLATION_Y = -SQFloat::_2;
+    const float_q TRANSLATION_Z = SQFloat::_3;
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Translate(TRANSLATION_X, TRANSLATION_Y, TRANSLATION_Z, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Translate(TRANSLATION_X, TRANSLATION_Y, TRANSLATION_Z, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Translate13_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QTranslationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x3;
+
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Translate(TRANSLATION, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Translate14_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QTranslationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x4;
+
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Translate(TRANSLATION, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Translate(TRANSLATION, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Rotate6_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QQuaternion;
+    using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QQuaternion ROTATION(SQAngle::_HalfPi, SQAngle::_QuarterPi, SQAngle::_ThirdPi);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QQuaternion ROTATION(SQAngle::_90, SQAngle::_45, SQAngle::_60);
+#endif
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Rotate(ROTATION, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Rotate(ROTATION, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Rotate7_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QRotationMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Rotate(ROTATION, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Rotate(ROTATION, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Scale9_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    // [Preparation]
+    const QBaseVector3 SCALE(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Scale(SCALE, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Scale(SCALE, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Scale10_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    // [Preparation]
+    const float_q SCALE_X = SQFloat::_0_25;
+    const float_q SCALE_Y = SQFloat::_3;
+    const float_q SCALE_Z = -SQFloat::_1;
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Scale(SCALE_X, SCALE_Y, SCALE_Z, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Scale(SCALE_X, SCALE_Y, SCALE_Z, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Scale11_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QScalingMatrix3x3;
+
+    // [Preparation]
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Scale(SCALE, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Scale(SCALE, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Transform8_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QTranslationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QRotationMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QScalingMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QTransformationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x3;
+    using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x3> TRANSFORMATION = QTransformationMatrix<QMatrix4x3>(TRANSLATION, ROTATION, SCALE);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Transform(TRANSFORMATION, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Transform(TRANSFORMATION, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Transform9_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QTranslationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QRotationMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QScalingMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QTransformationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x4;
+    using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x4> TRANSFORMATION = QTransformationMatrix<QMatrix4x4>(TRANSLATION, ROTATION, SCALE);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Transform(TRANSFORMATION, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Transform(TRANSFORMATION, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( Transform10_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QSpaceConversionMatrix;
+
+    // [Preparation]
+    QSpaceConversionMatrix CONVERSION;
+    CONVERSION.SetViewSpaceMatrix(QVector3(SQFloat::_1, SQFloat::_2, SQFloat::_3),
+                                  QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_1),
+                                  QVector3(SQFloat::_0, SQFloat::_1, SQFloat::_0));
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::Transform(CONVERSION, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::Transform(CONVERSION, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( RotateWithPivot6_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QQuaternion;
+    using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QQuaternion ROTATION(SQAngle::_HalfPi, SQAngle::_QuarterPi, SQAngle::_ThirdPi);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QQuaternion ROTATION(SQAngle::_90, SQAngle::_45, SQAngle::_60);
+#endif
+    const QBaseVector3 PIVOT(SQFloat::_1, -SQFloat::_2, SQFloat::_0_5);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::RotateWithPivot(ROTATION, PIVOT, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::RotateWithPivot(ROTATION, PIVOT, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( RotateWithPivot7_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QRotationMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+
+    // [Preparation]
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QBaseVector3 PIVOT(SQFloat::_1, -SQFloat::_2, SQFloat::_0_5);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::RotateWithPivot(ROTATION, PIVOT, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::RotateWithPivot(ROTATION, PIVOT, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( ScaleWithPivot9_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    // [Preparation]
+    const QBaseVector3 SCALE(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QBaseVector3 PIVOT(SQFloat::_1, -SQFloat::_2, SQFloat::_0_5);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::ScaleWithPivot(SCALE, PIVOT, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::ScaleWithPivot(SCALE, PIVOT, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( ScaleWithPivot10_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    // [Preparation]
+    const float_q SCALE_X = SQFloat::_0_25;
+    const float_q SCALE_Y = SQFloat::_3;
+    const float_q SCALE_Z = -SQFloat::_1;
+    const QBaseVector3 PIVOT(SQFloat::_1, -SQFloat::_2, SQFloat::_0_5);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::ScaleWithPivot(SCALE_X, SCALE_Y, SCALE_Z, PIVOT, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::ScaleWithPivot(SCALE_X, SCALE_Y, SCALE_Z, PIVOT, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( ScaleWithPivot11_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QScalingMatrix3x3;
+
+    // [Preparation]
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QBaseVector3 PIVOT(SQFloat::_1, -SQFloat::_2, SQFloat::_0_5);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::ScaleWithPivot(SCALE, PIVOT, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::ScaleWithPivot(SCALE, PIVOT, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( TransformWithPivot6_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QTranslationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QRotationMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QScalingMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QTransformationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x3;
+    using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x3> TRANSLATION = QTranslationMatrix<QMatrix4x3>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x3> TRANSFORMATION = QTransformationMatrix<QMatrix4x3>(TRANSLATION, ROTATION, SCALE);
+    const QBaseVector3 PIVOT(SQFloat::_1, -SQFloat::_2, SQFloat::_0_5);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::TransformWithPivot(TRANSFORMATION, PIVOT, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::TransformWithPivot(TRANSFORMATION, PIVOT, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+
+/// <summary>
+/// Checks that the points of the buffer are transformed the same way as an array of points.
+/// </summary>
+QTEST_CASE ( TransformWithPivot7_ResultIsTheSameAsWithArrayOfPoints_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Math::QTranslationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QRotationMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QScalingMatrix3x3;
+    using Kinesis::QuimeraEngine::Tools::Math::QTransformationMatrix;
+    using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x4;
+    using Kinesis::QuimeraEngine::Tools::Math::SQAngle;
+
+    // [Preparation]
+    const QTranslationMatrix<QMatrix4x4> TRANSLATION = QTranslationMatrix<QMatrix4x4>(SQFloat::_2, SQFloat::_4, -SQFloat::_6);
+#if QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_DEGREES
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_90, SQAngle::_180, SQAngle::_45);
+#elif QE_CONFIG_ANGLENOTATION_DEFAULT == QE_CONFIG_ANGLENOTATION_RADIANS
+    const QRotationMatrix3x3 ROTATION = QRotationMatrix3x3(SQAngle::_HalfPi, SQAngle::_Pi, SQAngle::_QuarterPi);
+#endif
+    const QScalingMatrix3x3 SCALE = QScalingMatrix3x3(SQFloat::_0_25, SQFloat::_3, -SQFloat::_1);
+    const QTransformationMatrix<QMatrix4x4> TRANSFORMATION = QTransformationMatrix<QMatrix4x4>(TRANSLATION, ROTATION, SCALE);
+    const QBaseVector3 PIVOT(SQFloat::_1, -SQFloat::_2, SQFloat::_0_5);
+
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_0, SQFloat::_0, SQFloat::_0),
+                                        QVector3(-SQFloat::_8, SQFloat::_0_5, -SQFloat::_2),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+
+    QVector3 arExpectedPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arExpectedPoints[i] = INPUT_POINTS[i];
+
+    SQPoint::TransformWithPivot(TRANSFORMATION, PIVOT, arExpectedPoints, POINTS_COUNT);
+
+    QSoAPointBuffer points(POINTS_COUNT);
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+	// [Execution]
+    SQPoint::TransformWithPivot(TRANSFORMATION, PIVOT, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(points.GetPoint(i) == arExpectedPoints[i]);
+    }
+}
+/// <summary>
+/// Checks that the points are copied to the buffer.
+/// </summary>
+QTEST_CASE ( ConvertToSoA1_PointsAreCopiedToTheBuffer_Test )
+{
+    // [Preparation]
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                        QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                        QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                        QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector3);
+    QSoAPointBuffer points(POINTS_COUNT);
+
+	// [Execution]
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(points.GetX()[i], INPUT_POINTS[i].x);
+        BOOST_CHECK_EQUAL(points.GetY()[i], INPUT_POINTS[i].y);
+        BOOST_CHECK_EQUAL(points.GetZ()[i], INPUT_POINTS[i].z);
+    }
+}
+
+/// <summary>
+/// Checks that only the first points of the buffer are replaced when the array is shorter.
+/// </summary>
+QTEST_CASE ( ConvertToSoA1_RemainingPointsAreNotModified_Test )
+{
+    // [Preparation]
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0)
+                                    };
+    const QVector3 EXPECTED_SECOND_POINT(SQFloat::_4, SQFloat::_5, SQFloat::_6);
+    QSoAPointBuffer points(2U);
+    points.SetPoint(1U, EXPECTED_SECOND_POINT);
+
+	// [Execution]
+    SQPoint::ConvertToSoA(INPUT_POINTS, 1U, points);
+
+    // [Verification]
+    BOOST_CHECK(points.GetPoint(0) == INPUT_POINTS[0]);
+    BOOST_CHECK(points.GetPoint(1U) == EXPECTED_SECOND_POINT);
+}
+
+/// <summary>
+/// Checks that the points are copied to the buffer and the W component is discarded.
+/// </summary>
+QTEST_CASE ( ConvertToSoA2_PointsAreCopiedToTheBuffer_Test )
+{
+    // [Preparation]
+    const QVector4 INPUT_POINTS[] = {
+                                        QVector4(SQFloat::_2, SQFloat::_1, SQFloat::_0, SQFloat::_1),
+                                        QVector4(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1, SQFloat::_1),
+                                        QVector4(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5, SQFloat::_1),
+                                        QVector4(SQFloat::_3, -SQFloat::_3, SQFloat::_7, SQFloat::_1),
+                                        QVector4(SQFloat::_10, SQFloat::_6, -SQFloat::_9, SQFloat::_1)
+                                    };
+    const unsigned int POINTS_COUNT = sizeof(INPUT_POINTS) / sizeof(QVector4);
+    QSoAPointBuffer points(POINTS_COUNT);
+
+	// [Execution]
+    SQPoint::ConvertToSoA(INPUT_POINTS, POINTS_COUNT, points);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(points.GetX()[i], INPUT_POINTS[i].x);
+        BOOST_CHECK_EQUAL(points.GetY()[i], INPUT_POINTS[i].y);
+        BOOST_CHECK_EQUAL(points.GetZ()[i], INPUT_POINTS[i].z);
+    }
+}
+
+/// <summary>
+/// Checks that all the points of the buffer are copied to the array.
+/// </summary>
+QTEST_CASE ( ConvertToAoS1_PointsAreCopiedToTheArray_Test )
+{
+    // [Preparation]
+    const QVector3 EXPECTED_POINTS[] = {
+                                           QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                           QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1),
+                                           QVector3(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5),
+                                           QVector3(SQFloat::_3, -SQFloat::_3, SQFloat::_7),
+                                           QVector3(SQFloat::_10, SQFloat::_6, -SQFloat::_9)
+                                       };
+    const unsigned int POINTS_COUNT = sizeof(EXPECTED_POINTS) / sizeof(QVector3);
+    QSoAPointBuffer points(POINTS_COUNT);
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        points.SetPoint(i, EXPECTED_POINTS[i]);
+
+    QVector3 arOutputPoints[POINTS_COUNT];
+
+	// [Execution]
+    SQPoint::ConvertToAoS(points, arOutputPoints);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(arOutputPoints[i] == EXPECTED_POINTS[i]);
+    }
+}
+
+/// <summary>
+/// Checks that all the points of the buffer are copied to the array and the W component is not modified.
+/// </summary>
+QTEST_CASE ( ConvertToAoS2_PointsAreCopiedToTheArrayAndWIsNotModified_Test )
+{
+    // [Preparation]
+    const QVector4 EXPECTED_POINTS[] = {
+                                           QVector4(SQFloat::_2, SQFloat::_1, SQFloat::_0, SQFloat::_1),
+                                           QVector4(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1, SQFloat::_0),
+                                           QVector4(-SQFloat::_1, SQFloat::_4, SQFloat::_0_5, SQFloat::_5)
+                                       };
+    const unsigned int POINTS_COUNT = sizeof(EXPECTED_POINTS) / sizeof(QVector4);
+    QSoAPointBuffer points(POINTS_COUNT);
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        points.SetPoint(i, QBaseVector3(EXPECTED_POINTS[i].x, EXPECTED_POINTS[i].y, EXPECTED_POINTS[i].z));
+
+    QVector4 arOutputPoints[POINTS_COUNT];
+
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+        arOutputPoints[i].w = EXPECTED_POINTS[i].w;
+
+	// [Execution]
+    SQPoint::ConvertToAoS(points, arOutputPoints);
+
+    // [Verification]
+    for(unsigned int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(arOutputPoints[i] == EXPECTED_POINTS[i]);
+    }
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the array contains more points than the buffer.
+/// </summary>
+QTEST_CASE ( ConvertToSoA1_AssertionFailsWhenBufferIsNotBigEnough_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QVector3 INPUT_POINTS[] = {
+                                        QVector3(SQFloat::_2, SQFloat::_1, SQFloat::_0),
+                                        QVector3(SQFloat::_0_25, -SQFloat::_5, -SQFloat::_1)
+                                    };
+    QSoAPointBuffer points(1U);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQPoint::ConvertToSoA(INPUT_POINTS, 2U, points);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null.
+/// </summary>
+QTEST_CASE ( ConvertToSoA1_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QVector3* arInputPoints = null_q;
+    QSoAPointBuffer points(1U);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQPoint::ConvertToSoA(arInputPoints, 1U, points);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the output array is null.
+/// </summary>
+QTEST_CASE ( ConvertToAoS1_AssertionFailsWhenOutputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QVector3* arOutputPoints = null_q;
+    QSoAPointBuffer points(1U);
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQPoint::ConvertToAoS(points, arOutputPoints);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
 // End - Test Suite: SQPoint
 QTEST_SUITE_END()
@@ -75,6 +75,39 @@ QTEST_CASE ( GenerateHashKey_ItReturnsExpectedValueWhenUsingCommonInputValues_Te
     BOOST_CHECK_EQUAL(uHashKey, EXPECTED_VALUE);
 }
 
+/// <summary>
+/// Checks that it returns zero when the input value is empty.
+/// </summary>
+QTEST_CASE ( GenerateHash_ItReturnsZeroWhenInputIsEmpty_Test )
+{
+    // [Preparation]
+    const string_q INPUT_VALUE("");
+    const pointer_uint_q EXPECTED_VALUE = 0;
+
+    // [Execution]
+    pointer_uint_q uHash = SQStringHashProvider::GenerateHash(INPUT_VALUE);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the remainder of dividing the hash by a number of buckets is the hash key generated for that number of buckets.
+/// </summary>
+QTEST_CASE ( GenerateHash_RemainderOfDividingByNumberOfBucketsIsEqualToHashKey_Test )
+{
+    // [Preparation]
+    const string_q INPUT_VALUE("A text to be used to generate a hash key");
+    const pointer_uint_q NUMBER_OF_BUCKETS = 500;
+    const pointer_uint_q EXPECTED_VALUE = SQStringHashProvider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
+
+    // [Execution]
+    pointer_uint_q uHash = SQStringHashProvider::GenerateHash(INPUT_VALUE);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash % NUMBER_OF_BUCKETS, EXPECTED_VALUE);
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
@@ -0,0 +1,123 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SERIALIZABLEELEMENTMOCK__
+#define __SERIALIZABLEELEMENTMOCK__
+
+#include "DataTypesDefinitions.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools    
+{
+namespace Containers
+{
+namespace Test
+{
+
+/// <summary>
+/// Element that stores its value in a separate buffer, so it cannot be serialized as a plain sequence of bytes. It does not 
+/// specialize QSerializationTraits, so containers must serialize it through its Serialize and Deserialize methods.
+/// </summary>
+class SerializableElementMock
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    // Necessary for testing
+    SerializableElementMock() : m_pValue(new u32_q(0))
+    {
+    }
+
+    // Necessary for testing
+    SerializableElementMock(const u32_q uValue) : m_pValue(new u32_q(uValue))
+    {
+    }
+
+    // Copy constructor necessary for testing
+    SerializableElementMock(const SerializableElementMock &element) : m_pValue(new u32_q(*element.m_pValue))
+    {
+    }
+
+    // Destructor necessary for testing
+    ~SerializableElementMock()
+    {
+        delete m_pValue;
+    }
+
+    // METHODS
+    // ---------------
+public:
+
+    // Assignment operator necessary for testing
+    SerializableElementMock& operator=(const SerializableElementMock &element)
+    {
+        *m_pValue = *element.m_pValue;
+        return *this;
+    }
+
+    // Equality operator necessary for testing
+    bool operator==(const SerializableElementMock &element) const
+    {
+        return *m_pValue == *element.m_pValue;
+    }
+
+    // Writes the value, not the address of the buffer
+    template<class WriterT>
+    void Serialize(WriterT &writer) const
+    {
+        writer << *m_pValue;
+    }
+
+    // Reads the value into the existing buffer
+    template<class ReaderT>
+    void Deserialize(ReaderT &reader)
+    {
+        reader >> *m_pValue;
+    }
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    // Buffer that contains the value.
+    u32_q* m_pValue;
+
+};
+
+} //namespace Test
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SERIALIZABLEELEMENTMOCK__
@@ -152,6 +152,11 @@ std::string QCommonTestConfig::GetCurrentTime()
     return strResult;
 }
 
+const std::string& QCommonTestConfig::GetLogFilePath()
+{
+    return QCommonTestConfig::s_strLogFilePath;
+}
+
 } //namespace Test
 } //namespace QuimeraEngine
 } //namespace Kinesis
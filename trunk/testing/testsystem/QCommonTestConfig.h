@@ -92,6 +92,16 @@ public:
 
     // METHODS
     // ---------------
+public:
+
+    /// <summary>
+    /// Gets the path of the file where the tests results are written.
+    /// </summary>
+    /// <returns>
+    /// The path of the results file. It is empty if the test configuration file could not be loaded.
+    /// </returns>
+    static const std::string& GetLogFilePath();
+
 protected:
 
     /// <summary>
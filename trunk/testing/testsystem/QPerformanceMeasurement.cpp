@@ -0,0 +1,175 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "QPerformanceMeasurement.h"
+
+#include <algorithm>
+#include <iostream>
+#include <boost/test/unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Test
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const unsigned int QPerformanceMeasurement::DEFAULT_WARM_UPS = 3U;
+const unsigned int QPerformanceMeasurement::DEFAULT_REPETITIONS = 30U;
+std::string QPerformanceMeasurement::s_strModuleName;
+std::ofstream QPerformanceMeasurement::s_resultsFileStream;
+
+#if defined(QE_OS_WINDOWS)
+
+    LARGE_INTEGER QPerformanceMeasurement::s_frequency;
+
+#elif defined(QE_OS_MAC)
+
+    mach_timebase_info_data_t QPerformanceMeasurement::s_timebaseInfo;
+
+#endif
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void QPerformanceMeasurement::OpenResultsFile(const std::string &strModuleName, const std::string &strFilePath)
+{
+    QPerformanceMeasurement::s_strModuleName = strModuleName;
+
+    if(QPerformanceMeasurement::s_resultsFileStream.is_open())
+        QPerformanceMeasurement::s_resultsFileStream.close();
+
+    QPerformanceMeasurement::s_resultsFileStream.open(strFilePath.c_str(), std::ofstream::out | std::ofstream::trunc);
+
+    if(QPerformanceMeasurement::s_resultsFileStream.is_open())
+        QPerformanceMeasurement::s_resultsFileStream << "module,test,measurement,warm_ups,repetitions,min_ns,mean_ns,p50_ns,p90_ns,p99_ns,max_ns" << std::endl;
+    else
+        std::cout << "An error occured when opening the performance results file (" << strFilePath << ")." << std::endl;
+}
+
+u64_q QPerformanceMeasurement::GetCurrentInstant()
+{
+    static const u64_q NANOSECONDS_IN_SECOND = 1000000000ULL;
+
+#if defined(QE_OS_WINDOWS)
+
+    if(QPerformanceMeasurement::s_frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&QPerformanceMeasurement::s_frequency);
+
+    LARGE_INTEGER ticks;
+    ::QueryPerformanceCounter(&ticks);
+
+    // The division is split so the multiplication does not overflow when the counter is high
+    const u64_q FREQUENCY = QPerformanceMeasurement::s_frequency.QuadPart;
+    return (ticks.QuadPart / FREQUENCY) * NANOSECONDS_IN_SECOND + (ticks.QuadPart % FREQUENCY) * NANOSECONDS_IN_SECOND / FREQUENCY;
+
+#elif defined(QE_OS_LINUX)
+
+    timespec timeSpecData;
+    ::clock_gettime(CLOCK_MONOTONIC_RAW, &timeSpecData);
+
+    return timeSpecData.tv_sec * NANOSECONDS_IN_SECOND + timeSpecData.tv_nsec;
+
+#elif defined(QE_OS_MAC)
+
+    if(QPerformanceMeasurement::s_timebaseInfo.denom == 0)
+        ::mach_timebase_info(&QPerformanceMeasurement::s_timebaseInfo);
+
+    return ::mach_absolute_time() * QPerformanceMeasurement::s_timebaseInfo.numer / QPerformanceMeasurement::s_timebaseInfo.denom;
+
+#endif
+}
+
+void QPerformanceMeasurement::Report(const std::string &strMeasurementName, std::vector<u64_q> &arElapsedTimes, const unsigned int uWarmUps)
+{
+    if(arElapsedTimes.empty())
+        return;
+
+    std::sort(arElapsedTimes.begin(), arElapsedTimes.end());
+
+    u64_q uTotalTime = 0;
+
+    for(std::vector<u64_q>::const_iterator it = arElapsedTimes.begin(); it != arElapsedTimes.end(); ++it)
+        uTotalTime += *it;
+
+    const u64_q MIN_TIME = arElapsedTimes.front();
+    const u64_q MEAN_TIME = uTotalTime / arElapsedTimes.size();
+    const u64_q P50_TIME = QPerformanceMeasurement::GetPercentile(arElapsedTimes, 50U);
+    const u64_q P90_TIME = QPerformanceMeasurement::GetPercentile(arElapsedTimes, 90U);
+    const u64_q P99_TIME = QPerformanceMeasurement::GetPercentile(arElapsedTimes, 99U);
+    const u64_q MAX_TIME = arElapsedTimes.back();
+
+    BOOST_TEST_MESSAGE(strMeasurementName << " (ns, " << arElapsedTimes.size() << " repetitions): min " << MIN_TIME << 
+                       " | mean " << MEAN_TIME << " | p50 " << P50_TIME << " | p90 " << P90_TIME << " | p99 " << P99_TIME << " | max " << MAX_TIME);
+
+    if(QPerformanceMeasurement::s_resultsFileStream.is_open())
+    {
+        const boost::unit_test::test_case &currentTest = boost::unit_test::framework::current_test_case();
+        const std::string &strSuiteName = boost::unit_test::framework::get<boost::unit_test::test_suite>(currentTest.p_parent_id).p_name.get();
+
+        QPerformanceMeasurement::s_resultsFileStream << QPerformanceMeasurement::s_strModuleName << ","
+                                                     << strSuiteName << "/" << currentTest.p_name.get() << ","
+                                                     << "\"" << strMeasurementName << "\","
+                                                     << uWarmUps << ","
+                                                     << arElapsedTimes.size() << ","
+                                                     << MIN_TIME << ","
+                                                     << MEAN_TIME << ","
+                                                     << P50_TIME << ","
+                                                     << P90_TIME << ","
+                                                     << P99_TIME << ","
+                                                     << MAX_TIME << std::endl;
+    }
+}
+
+u64_q QPerformanceMeasurement::GetPercentile(const std::vector<u64_q> &arSortedTimes, const unsigned int uPercentile)
+{
+    // Nearest-rank: the position is ceil(percentile * count / 100), starting at 1
+    const std::vector<u64_q>::size_type RANK = (uPercentile * arSortedTimes.size() + 99U) / 100U;
+
+    return arSortedTimes[RANK == 0 ? 0 : RANK - 1U];
+}
+
+} //namespace Test
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -0,0 +1,201 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QPERFORMANCEMEASUREMENT__
+#define __QPERFORMANCEMEASUREMENT__
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "ExternalDefinitions.h"
+#include "DataTypesDefinitions.h"
+
+#if defined(QE_OS_WINDOWS)
+    #include <Windows.h>
+#elif defined(QE_OS_LINUX)
+    #include <time.h>
+#elif defined(QE_OS_MAC)
+    #include <mach/mach.h>
+    #include <mach/mach_time.h>
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Test
+{
+
+/// <summary>
+/// Executes the code to be measured by performance tests several times and reports statistics about the elapsed times.
+/// </summary>
+/// <remarks>
+/// Every measurement runs the code some times without measuring it (warm-up), so caches, branch predictors and lazy initializations 
+/// do not distort the results, and then measures every repetition separately. The minimum, the mean, the median, the 90th and 99th 
+/// percentiles and the maximum are written to the test log and appended to a CSV results file, one row per measurement, so the 
+/// results of different runs can be compared.<br/>
+/// It does not depend on the System layer so it can be used by the performance tests of every layer.
+/// </remarks>
+class QPerformanceMeasurement
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The number of executions that are not measured, by default.
+    /// </summary>
+    static const unsigned int DEFAULT_WARM_UPS;
+
+    /// <summary>
+    /// The number of measured executions, by default.
+    /// </summary>
+    static const unsigned int DEFAULT_REPETITIONS;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Executes a functor several times, measures every execution and reports the results.
+    /// </summary>
+    /// <typeparam name="FunctorT">The type of the functor. It must provide an operator() that receives no parameters.</typeparam>
+    /// <param name="strMeasurementName">[IN] The name of the measurement as it will appear in the log and the results file.</param>
+    /// <param name="functor">[IN/OUT] The functor that contains the code to be measured. It should store something that depends on its result 
+    /// so the compiler does not remove the code.</param>
+    /// <param name="uWarmUps">[IN] The number of executions that are not measured.</param>
+    /// <param name="uRepetitions">[IN] The number of measured executions. It must be greater than zero.</param>
+    template<class FunctorT>
+    static void Measure(const std::string &strMeasurementName, FunctorT &functor, const unsigned int uWarmUps, const unsigned int uRepetitions)
+    {
+        for(unsigned int i = 0; i < uWarmUps; ++i)
+            functor();
+
+        std::vector<u64_q> arElapsedTimes(uRepetitions);
+
+        for(unsigned int i = 0; i < uRepetitions; ++i)
+        {
+            const u64_q START_INSTANT = QPerformanceMeasurement::GetCurrentInstant();
+            functor();
+            arElapsedTimes[i] = QPerformanceMeasurement::GetCurrentInstant() - START_INSTANT;
+        }
+
+        QPerformanceMeasurement::Report(strMeasurementName, arElapsedTimes, uWarmUps);
+    }
+
+    /// <summary>
+    /// Executes a functor several times, measures every execution and reports the results, using the default number of warm-ups and repetitions.
+    /// </summary>
+    /// <typeparam name="FunctorT">The type of the functor. It must provide an operator() that receives no parameters.</typeparam>
+    /// <param name="strMeasurementName">[IN] The name of the measurement as it will appear in the log and the results file.</param>
+    /// <param name="functor">[IN/OUT] The functor that contains the code to be measured.</param>
+    template<class FunctorT>
+    static void Measure(const std::string &strMeasurementName, FunctorT &functor)
+    {
+        QPerformanceMeasurement::Measure(strMeasurementName, functor, DEFAULT_WARM_UPS, DEFAULT_REPETITIONS);
+    }
+
+    /// <summary>
+    /// Opens the file where the results of the measurements will be written and writes the header of the columns.
+    /// </summary>
+    /// <remarks>
+    /// It is called by the performance test module. If the file cannot be opened, results are only written to the log.
+    /// </remarks>
+    /// <param name="strModuleName">[IN] The name of the test module, written in every row.</param>
+    /// <param name="strFilePath">[IN] The path to the results file. If it already exists, it is replaced.</param>
+    static void OpenResultsFile(const std::string &strModuleName, const std::string &strFilePath);
+
+    /// <summary>
+    /// Gets the current instant of a monotonic high resolution timer.
+    /// </summary>
+    /// <returns>
+    /// The current instant, in nanoseconds. It is only meaningful when compared to other instants.
+    /// </returns>
+    static u64_q GetCurrentInstant();
+
+protected:
+
+    /// <summary>
+    /// Calculates the statistics of a measurement and writes them to the log and the results file.
+    /// </summary>
+    /// <param name="strMeasurementName">[IN] The name of the measurement.</param>
+    /// <param name="arElapsedTimes">[IN] The elapsed time of every repetition, in nanoseconds. It is sorted by the method.</param>
+    /// <param name="uWarmUps">[IN] The number of executions that were not measured.</param>
+    static void Report(const std::string &strMeasurementName, std::vector<u64_q> &arElapsedTimes, const unsigned int uWarmUps);
+
+    /// <summary>
+    /// Gets a percentile of a sorted list of elapsed times, using the nearest-rank method.
+    /// </summary>
+    /// <param name="arSortedTimes">[IN] The elapsed times, in ascending order. It must not be empty.</param>
+    /// <param name="uPercentile">[IN] The percentile, from 1 to 100.</param>
+    /// <returns>
+    /// The smallest elapsed time that is greater than or equal to the given percent of the list.
+    /// </returns>
+    static u64_q GetPercentile(const std::vector<u64_q> &arSortedTimes, const unsigned int uPercentile);
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The name of the test module that is running.
+    /// </summary>
+    static std::string s_strModuleName;
+
+    /// <summary>
+    /// The output file stream where the results are written, in CSV format.
+    /// </summary>
+    static std::ofstream s_resultsFileStream;
+
+#if defined(QE_OS_WINDOWS)
+
+    /// <summary>
+    /// The frequency of the high performance timer on Windows.
+    /// </summary>
+    static LARGE_INTEGER s_frequency;
+
+#elif defined(QE_OS_MAC)
+
+    /// <summary>
+    /// The number of ticks per second of the absolute timer on Mac OS.
+    /// </summary>
+    static mach_timebase_info_data_t s_timebaseInfo;
+
+#endif
+
+};
+
+} //namespace Test
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QPERFORMANCEMEASUREMENT__
@@ -32,11 +32,13 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_log.hpp>
 
-#include "../common/CommonConfigDefinitions.h"
-#include "../common/QCommonTestConfig.h"
+#include "../testsystem/CommonConfigDefinitions.h"
+#include "../testsystem/QCommonTestConfig.h"
+#include "../testsystem/QPerformanceMeasurement.h"
 
 using Kinesis::QuimeraEngine::Test::QCommonTestConfig;
 using Kinesis::QuimeraEngine::Test::EQTestType;
+using Kinesis::QuimeraEngine::Test::QPerformanceMeasurement;
 
 namespace Kinesis
 {
@@ -48,19 +50,30 @@ namespace Test
 /// <summary>
 /// Base class for performance test modules. Always inherit from this class to define a new performance test module.
 /// </summary>
-class QDllExport QPerformanceTestModuleBase
+class QPerformanceTestModuleBase
 {
 	// CONSTRUCTORS
 	// ---------------
 public:
 
 	/// <summary>
-	/// Constructor that receives the name of the module.
+	/// Constructor that receives the name of the module. It opens the file where the results of the measurements are written.
 	/// </summary>
     /// <param name="strModuleName">The name of the module.</param>
 	QPerformanceTestModuleBase(const std::string &strModuleName)
     {
         QCommonTestConfig config(strModuleName, EQTestType::E_PerformanceTest);
+
+        // The results of the measurements are written next to the log, with the same name, so both files of a run can be matched
+        std::string strResultsFilePath = QCommonTestConfig::GetLogFilePath();
+        const std::string LOG_FILE_EXTENSION(".xml");
+
+        if(strResultsFilePath.empty())
+            strResultsFilePath = strModuleName + "_PerformanceResults.csv";
+        else if(strResultsFilePath.size() > LOG_FILE_EXTENSION.size())
+            strResultsFilePath.replace(strResultsFilePath.size() - LOG_FILE_EXTENSION.size(), LOG_FILE_EXTENSION.size(), ".csv");
+
+        QPerformanceMeasurement::OpenResultsFile(strModuleName, strResultsFilePath);
     }
 
 